@@ -0,0 +1,115 @@
+#ifndef __GL_H__
+#define __GL_H__
+
+    /***************************************************************
+                                 GL/gl.h
+
+    A minimal stand-in for Libdragon's OpenGL, so that the Sausage64
+    library can be compiled and run on a PC. Every call is recorded
+    by s64host.c instead of being rendered.
+    ***************************************************************/
+
+    #include <stdint.h>
+
+
+    /*********************************
+                 Types
+    *********************************/
+
+    typedef unsigned int   GLenum;
+    typedef unsigned char  GLboolean;
+    typedef unsigned int   GLbitfield;
+    typedef void           GLvoid;
+    typedef int            GLint;
+    typedef unsigned int   GLuint;
+    typedef int            GLsizei;
+    typedef float          GLfloat;
+    typedef double         GLdouble;
+    typedef intptr_t       GLsizeiptrARB;
+
+    typedef struct sprite_s sprite_t;
+    typedef struct rdpq_texparms_s rdpq_texparms_t;
+
+
+    /*********************************
+                Constants
+    *********************************/
+
+    #define GL_FALSE 0
+    #define GL_TRUE  1
+
+    #define GL_TRIANGLES      0x0004
+    #define GL_FRONT          0x0404
+    #define GL_BACK           0x0405
+    #define GL_FRONT_AND_BACK 0x0408
+    #define GL_CULL_FACE      0x0B44
+    #define GL_LIGHTING       0x0B50
+    #define GL_COLOR_MATERIAL 0x0B57
+    #define GL_DEPTH_TEST     0x0B71
+    #define GL_TEXTURE_2D     0x0DE1
+    #define GL_DIFFUSE        0x1201
+    #define GL_COMPILE        0x1300
+    #define GL_UNSIGNED_SHORT 0x1403
+    #define GL_FLOAT          0x1406
+    #define GL_FLAT           0x1D00
+    #define GL_SMOOTH         0x1D01
+    #define GL_NEAREST        0x2600
+    #define GL_LINEAR         0x2601
+    #define GL_TEXTURE_WRAP_S 0x2802
+    #define GL_TEXTURE_WRAP_T 0x2803
+    #define GL_CLAMP          0x2900
+    #define GL_REPEAT         0x2901
+
+    #define GL_VERTEX_ARRAY        0x8074
+    #define GL_NORMAL_ARRAY        0x8075
+    #define GL_COLOR_ARRAY         0x8076
+    #define GL_TEXTURE_COORD_ARRAY 0x8078
+
+    #define GL_MIRRORED_REPEAT_ARB       0x8370
+    #define GL_ARRAY_BUFFER_ARB          0x8892
+    #define GL_ELEMENT_ARRAY_BUFFER_ARB  0x8893
+    #define GL_STATIC_DRAW_ARB           0x88E4
+
+
+    /*********************************
+                Functions
+    *********************************/
+
+    extern void glEnable(GLenum cap);
+    extern void glDisable(GLenum cap);
+    extern void glEnableClientState(GLenum array);
+    extern void glDisableClientState(GLenum array);
+    extern void glCullFace(GLenum mode);
+    extern void glShadeModel(GLenum mode);
+    extern void glMaterialfv(GLenum face, GLenum pname, const GLfloat* params);
+
+    extern void glPushMatrix(void);
+    extern void glPopMatrix(void);
+    extern void glMultMatrixf(const GLfloat* m);
+    extern void glTranslatef(GLfloat x, GLfloat y, GLfloat z);
+    extern void glScalef(GLfloat x, GLfloat y, GLfloat z);
+
+    extern void   glGenTextures(GLsizei n, GLuint* textures);
+    extern void   glDeleteTextures(GLsizei n, const GLuint* textures);
+    extern void   glBindTexture(GLenum target, GLuint texture);
+    extern void   glTexParameteri(GLenum target, GLenum pname, GLint param);
+    extern void   glSpriteTextureN64(GLenum target, sprite_t* sprite, rdpq_texparms_t* texparms);
+
+    extern void   glGenBuffersARB(GLsizei n, GLuint* buffers);
+    extern void   glDeleteBuffersARB(GLsizei n, const GLuint* buffers);
+    extern void   glBindBufferARB(GLenum target, GLuint buffer);
+    extern void   glBufferDataARB(GLenum target, GLsizeiptrARB size, const GLvoid* data, GLenum usage);
+
+    extern void   glVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+    extern void   glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+    extern void   glNormalPointer(GLenum type, GLsizei stride, const GLvoid* pointer);
+    extern void   glColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+    extern void   glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices);
+
+    extern GLuint glGenLists(GLsizei range);
+    extern void   glDeleteLists(GLuint list, GLsizei range);
+    extern void   glNewList(GLuint list, GLenum mode);
+    extern void   glEndList(void);
+    extern void   glCallList(GLuint list);
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef __LIBDRAGON_ASSET_H
+#define __LIBDRAGON_ASSET_H
+
+    /***************************************************************
+                                 asset.h
+
+    A stand-in for Libdragon's asset loading, which reads files
+    from the PC's filesystem instead of the DragonFS. The path's 
+    "rom:/" prefix is stripped.
+    ***************************************************************/
+
+    extern void* asset_load(const char* fn, int* sz);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef __LIBDRAGON_RDPQ_TEX_H
+#define __LIBDRAGON_RDPQ_TEX_H
+
+    /***************************************************************
+                               rdpq_tex.h
+
+    A stand-in for the parts of Libdragon's RDPQ texture API that
+    the Sausage64 library uses.
+    ***************************************************************/
+
+    #include <stdint.h>
+
+    #define REPEAT_INFINITE 2048
+
+    typedef enum {
+        MIRROR_NONE = 0,
+        MIRROR_REPEAT = 1
+    } mirror_t;
+
+    struct sprite_s {
+        uint16_t width;
+        uint16_t height;
+    };
+
+    struct rdpq_texparms_s {
+        int tmem_addr;
+        int palette;
+        struct {
+            float translate;
+            int scale_log;
+            float repeats;
+            mirror_t mirror;
+        } s, t;
+    };
+
+#endif
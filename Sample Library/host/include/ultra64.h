@@ -0,0 +1,316 @@
+#ifndef _ULTRA64_H_
+#define _ULTRA64_H_
+
+    /***************************************************************
+                                ultra64.h
+
+    A minimal stand-in for Libultra, so that the Sausage64 library
+    can be compiled and run on a PC. Only what sausage64.c uses is
+    here. Display list macros encode F3DEX2 commands like the real
+    ones do, except the second word is pointer sized so that the
+    host can follow the addresses.
+    ***************************************************************/
+
+    #include <stdint.h>
+    #include <math.h>
+
+
+    /*********************************
+                 Types
+    *********************************/
+
+    typedef uint8_t  u8;
+    typedef uint16_t u16;
+    typedef uint32_t u32;
+    typedef uint64_t u64;
+
+    typedef int8_t  s8;
+    typedef int16_t s16;
+    typedef int32_t s32;
+    typedef int64_t s64;
+
+    typedef volatile uint8_t  vu8;
+    typedef volatile uint16_t vu16;
+    typedef volatile uint32_t vu32;
+    typedef volatile uint64_t vu64;
+
+    typedef volatile int8_t  vs8;
+    typedef volatile int16_t vs16;
+    typedef volatile int32_t vs32;
+    typedef volatile int64_t vs64;
+
+    typedef float  f32;
+    typedef double f64;
+
+    typedef struct {
+        u32 w0;
+        uintptr_t w1;
+    } Gwords;
+
+    typedef union {
+        Gwords words;
+        long long int force_structure_alignment;
+    } Gfx;
+
+    typedef struct {
+        s16 ob[3];
+        u16 flag;
+        s16 tc[2];
+        u8  cn[4];
+    } Vtx_t;
+
+    typedef struct {
+        s16 ob[3];
+        u16 flag;
+        s16 tc[2];
+        s8  n[3];
+        u8  a;
+    } Vtx_tn;
+
+    typedef union {
+        Vtx_t  v;
+        Vtx_tn n;
+        long long int force_structure_alignment;
+    } Vtx;
+
+    // Integer parts are stored as u16[16], followed by the fractional parts as u16[16]
+    typedef union {
+        s32 m[4][4];
+        long long int force_structure_alignment;
+    } Mtx;
+
+    typedef void* OSMesg;
+
+    typedef struct {
+        u32 validCount;
+        OSMesg* msg;
+    } OSMesgQueue;
+
+    typedef struct {
+        u32 size;
+    } OSIoMesg;
+
+    #ifndef TRUE
+        #define TRUE 1
+    #endif
+    #ifndef FALSE
+        #define FALSE 0
+    #endif
+
+
+    /*********************************
+             Libultra Macros
+    *********************************/
+
+    #define OS_K0_TO_PHYSICAL(x) ((uintptr_t)(x))
+
+    #define OS_READ  0
+    #define OS_WRITE 1
+
+    #define OS_MESG_PRI_NORMAL 0
+    #define OS_MESG_PRI_HIGH   1
+
+    #define OS_MESG_NOBLOCK 0
+    #define OS_MESG_BLOCK   1
+
+    #define _SHIFTL(v, s, w) ((u32)(((u32)(v) & ((0x01 << (w)) - 1)) << (s)))
+    #define _SHIFTR(v, s, w) ((u32)(((u32)(v) >> (s)) & ((0x01 << (w)) - 1)))
+
+
+    /*********************************
+              F3DEX2 Opcodes
+    *********************************/
+
+    #define G_VTX            0x01
+    #define G_MODIFYVTX      0x02
+    #define G_CULLDL         0x03
+    #define G_BRANCH_Z       0x04
+    #define G_TRI1           0x05
+    #define G_TRI2           0x06
+    #define G_QUAD           0x07
+    #define G_SPECIAL_3      0xD3
+    #define G_SPECIAL_2      0xD4
+    #define G_SPECIAL_1      0xD5
+    #define G_DMA_IO         0xD6
+    #define G_TEXTURE        0xD7
+    #define G_POPMTX         0xD8
+    #define G_GEOMETRYMODE   0xD9
+    #define G_MTX            0xDA
+    #define G_MOVEWORD       0xDB
+    #define G_MOVEMEM        0xDC
+    #define G_LOAD_UCODE     0xDD
+    #define G_DL             0xDE
+    #define G_ENDDL          0xDF
+    #define G_NOOP           0x00
+    #define G_RDPHALF_1      0xE1
+    #define G_SETOTHERMODE_L 0xE2
+    #define G_SETOTHERMODE_H 0xE3
+    #define G_TEXRECT        0xE4
+    #define G_TEXRECTFLIP    0xE5
+    #define G_RDPLOADSYNC    0xE6
+    #define G_RDPPIPESYNC    0xE7
+    #define G_RDPTILESYNC    0xE8
+    #define G_RDPFULLSYNC    0xE9
+    #define G_SETKEYGB       0xEA
+    #define G_SETKEYR        0xEB
+    #define G_SETCONVERT     0xEC
+    #define G_SETSCISSOR     0xED
+    #define G_SETPRIMDEPTH   0xEE
+    #define G_RDPSETOTHERMODE 0xEF
+    #define G_LOADTLUT       0xF0
+    #define G_RDPHALF_2      0xF1
+    #define G_SETTILESIZE    0xF2
+    #define G_LOADBLOCK      0xF3
+    #define G_LOADTILE       0xF4
+    #define G_SETTILE        0xF5
+    #define G_FILLRECT       0xF6
+    #define G_SETFILLCOLOR   0xF7
+    #define G_SETFOGCOLOR    0xF8
+    #define G_SETBLENDCOLOR  0xF9
+    #define G_SETPRIMCOLOR   0xFA
+    #define G_SETENVCOLOR    0xFB
+    #define G_SETCOMBINE     0xFC
+    #define G_SETTIMG        0xFD
+    #define G_SETZIMG        0xFE
+    #define G_SETCIMG        0xFF
+
+
+    /*********************************
+             GBI Parameters
+    *********************************/
+
+    #define G_MTX_MODELVIEW  0x00
+    #define G_MTX_PROJECTION 0x04
+    #define G_MTX_MUL        0x00
+    #define G_MTX_LOAD       0x02
+    #define G_MTX_NOPUSH     0x00
+    #define G_MTX_PUSH       0x01
+
+    #define G_DL_PUSH   0x00
+    #define G_DL_NOPUSH 0x01
+
+    #define G_IM_FMT_RGBA 0
+    #define G_IM_FMT_YUV  1
+    #define G_IM_FMT_CI   2
+    #define G_IM_FMT_IA   3
+    #define G_IM_FMT_I    4
+
+    #define G_IM_SIZ_4b  0
+    #define G_IM_SIZ_8b  1
+    #define G_IM_SIZ_16b 2
+    #define G_IM_SIZ_32b 3
+
+    #define G_MDSFT_RENDERMODE 3
+    #define G_MDSFT_TEXTFILT   12
+    #define G_MDSFT_CYCLETYPE  20
+
+    #define G_TX_LOADTILE       7
+    #define G_TX_RENDERTILE     0
+    #define G_TX_DXT_FRAC       11
+    #define G_TX_LDBLK_MAX_TXL  2047
+    #define G_TEXTURE_IMAGE_FRAC 2
+
+    #define GCCc0w0(saRGB0, mRGB0, saA0, mA0) \
+        (_SHIFTL((saRGB0), 20, 4) | _SHIFTL((mRGB0), 15, 5) | _SHIFTL((saA0), 12, 3) | _SHIFTL((mA0), 9, 3))
+    #define GCCc1w0(saRGB1, mRGB1) \
+        (_SHIFTL((saRGB1), 5, 4) | _SHIFTL((mRGB1), 0, 5))
+    #define GCCc0w1(sbRGB0, aRGB0, sbA0, aA0) \
+        (_SHIFTL((sbRGB0), 28, 4) | _SHIFTL((aRGB0), 15, 3) | _SHIFTL((sbA0), 12, 3) | _SHIFTL((aA0), 9, 3))
+    #define GCCc1w1(sbRGB1, saA1, mA1, aRGB1, sbA1, aA1) \
+        (_SHIFTL((sbRGB1), 24, 4) | _SHIFTL((saA1), 21, 3) | _SHIFTL((mA1), 18, 3) | _SHIFTL((aRGB1), 6, 3) | _SHIFTL((sbA1), 3, 3) | _SHIFTL((aA1), 0, 3))
+
+
+    /*********************************
+          Display List Functions
+    *********************************/
+
+    extern void s64host_gfx(Gfx* pkt, u32 w0, uintptr_t w1);
+    extern void s64host_gfxtri(Gfx* pkt, u32 cmd, u32 v00, u32 v01, u32 v02, u32 flag0, u32 v10, u32 v11, u32 v12, u32 flag1);
+    extern void s64host_gfxloadblock(Gfx* pkt, u32 siz, u32 width, u32 height);
+    extern void s64host_gfxrendertile(Gfx* pkt, u32 fmt, u32 siz, u32 width, u32 pal, u32 cms, u32 cmt, u32 masks, u32 maskt, u32 shifts, u32 shiftt);
+
+    #define gSPVertex(pkt, v, n, v0) \
+        s64host_gfx((pkt), _SHIFTL(G_VTX, 24, 8) | _SHIFTL((n), 12, 8) | _SHIFTL((v0)+(n), 1, 7), (uintptr_t)(v))
+    #define gSP1Triangle(pkt, v0, v1, v2, flag) \
+        s64host_gfxtri((pkt), G_TRI1, (v0), (v1), (v2), (flag), 0, 0, 0, 0)
+    #define gSP2Triangles(pkt, v00, v01, v02, flag0, v10, v11, v12, flag1) \
+        s64host_gfxtri((pkt), G_TRI2, (v00), (v01), (v02), (flag0), (v10), (v11), (v12), (flag1))
+    #define gSPCullDisplayList(pkt, vstart, vend) \
+        s64host_gfx((pkt), _SHIFTL(G_CULLDL, 24, 8) | _SHIFTL((vstart)*2, 0, 16), _SHIFTL((vend)*2, 0, 16))
+    #define gSPDisplayList(pkt, dl) \
+        s64host_gfx((pkt), _SHIFTL(G_DL, 24, 8) | _SHIFTL(G_DL_PUSH, 16, 8), (uintptr_t)(dl))
+    #define gSPEndDisplayList(pkt) \
+        s64host_gfx((pkt), _SHIFTL(G_ENDDL, 24, 8), 0)
+    #define gSPSetGeometryMode(pkt, word) \
+        s64host_gfx((pkt), _SHIFTL(G_GEOMETRYMODE, 24, 8) | _SHIFTL(~(u32)0, 0, 24), (u32)(word))
+    #define gSPClearGeometryMode(pkt, word) \
+        s64host_gfx((pkt), _SHIFTL(G_GEOMETRYMODE, 24, 8) | _SHIFTL(~(u32)(word), 0, 24), 0)
+    #define gSPMatrix(pkt, m, p) \
+        s64host_gfx((pkt), _SHIFTL(G_MTX, 24, 8) | _SHIFTL((sizeof(Mtx)-1)/8, 19, 5) | _SHIFTL((p)^G_MTX_PUSH, 0, 8), (uintptr_t)(m))
+    #define gSPPopMatrix(pkt, n) \
+        s64host_gfx((pkt), _SHIFTL(G_POPMTX, 24, 8) | _SHIFTL((64-1)/8, 19, 5) | _SHIFTL(2, 0, 8), 64)
+    #define gSPSetOtherMode(pkt, cmd, sft, len, data) \
+        s64host_gfx((pkt), _SHIFTL((cmd), 24, 8) | _SHIFTL(32-(sft)-(len), 8, 8) | _SHIFTL((len)-1, 0, 8), (u32)(data))
+
+    #define gDPPipeSync(pkt) \
+        s64host_gfx((pkt), _SHIFTL(G_RDPPIPESYNC, 24, 8), 0)
+    #define gDPLoadSync(pkt) \
+        s64host_gfx((pkt), _SHIFTL(G_RDPLOADSYNC, 24, 8), 0)
+    #define gDPSetCycleType(pkt, type) \
+        gSPSetOtherMode((pkt), G_SETOTHERMODE_H, G_MDSFT_CYCLETYPE, 2, (type))
+    #define gDPSetTextureFilter(pkt, type) \
+        gSPSetOtherMode((pkt), G_SETOTHERMODE_H, G_MDSFT_TEXTFILT, 2, (type))
+    #define gDPSetRenderMode(pkt, c0, c1) \
+        gSPSetOtherMode((pkt), G_SETOTHERMODE_L, G_MDSFT_RENDERMODE, 29, (c0) | (c1))
+    #define gDPSetPrimColor(pkt, m, l, r, g, b, a) \
+        s64host_gfx((pkt), _SHIFTL(G_SETPRIMCOLOR, 24, 8) | _SHIFTL((m), 8, 8) | _SHIFTL((l), 0, 8), \
+            _SHIFTL((r), 24, 8) | _SHIFTL((g), 16, 8) | _SHIFTL((b), 8, 8) | _SHIFTL((a), 0, 8))
+    #define gDPSetTextureImage(pkt, f, s, w, i) \
+        s64host_gfx((pkt), _SHIFTL(G_SETTIMG, 24, 8) | _SHIFTL((f), 21, 3) | _SHIFTL((s), 19, 2) | _SHIFTL((w)-1, 0, 12), (uintptr_t)(i))
+    #define gDPSetTile(pkt, fmt, siz, line, tmem, tile, palette, cmt, maskt, shiftt, cms, masks, shifts) \
+        s64host_gfx((pkt), _SHIFTL(G_SETTILE, 24, 8) | _SHIFTL((fmt), 21, 3) | _SHIFTL((siz), 19, 2) | _SHIFTL((line), 9, 9) | _SHIFTL((tmem), 0, 9), \
+            _SHIFTL((tile), 24, 3) | _SHIFTL((palette), 20, 4) | _SHIFTL((cmt), 18, 2) | _SHIFTL((maskt), 14, 4) | _SHIFTL((shiftt), 10, 4) | \
+            _SHIFTL((cms), 8, 2) | _SHIFTL((masks), 4, 4) | _SHIFTL((shifts), 0, 4))
+    #define gDPSetTileSize(pkt, t, uls, ult, lrs, lrt) \
+        s64host_gfx((pkt), _SHIFTL(G_SETTILESIZE, 24, 8) | _SHIFTL((uls), 12, 12) | _SHIFTL((ult), 0, 12), \
+            _SHIFTL((t), 24, 3) | _SHIFTL((lrs), 12, 12) | _SHIFTL((lrt), 0, 12))
+
+    // Like in Libultra, these expand to multiple commands, and pkt is evaluated once per command
+    #define gDPLoadTextureBlock(pkt, timg, fmt, siz, width, height, pal, cms, cmt, masks, maskt, shifts, shiftt) \
+    { \
+        gDPSetTextureImage((pkt), (fmt), ((siz) == G_IM_SIZ_32b) ? G_IM_SIZ_32b : G_IM_SIZ_16b, 1, (timg)); \
+        gDPSetTile((pkt), (fmt), ((siz) == G_IM_SIZ_32b) ? G_IM_SIZ_32b : G_IM_SIZ_16b, 0, 0, G_TX_LOADTILE, 0, (cmt), (maskt), (shiftt), (cms), (masks), (shifts)); \
+        gDPLoadSync((pkt)); \
+        s64host_gfxloadblock((pkt), (siz), (width), (height)); \
+        gDPPipeSync((pkt)); \
+        s64host_gfxrendertile((pkt), (fmt), (siz), (width), (pal), (cms), (cmt), (masks), (maskt), (shifts), (shiftt)); \
+        gDPSetTileSize((pkt), G_TX_RENDERTILE, 0, 0, ((width)-1) << G_TEXTURE_IMAGE_FRAC, ((height)-1) << G_TEXTURE_IMAGE_FRAC); \
+    }
+    #define gDPLoadTextureBlock_4b(pkt, timg, fmt, width, height, pal, cms, cmt, masks, maskt, shifts, shiftt) \
+    { \
+        gDPSetTextureImage((pkt), (fmt), G_IM_SIZ_16b, 1, (timg)); \
+        gDPSetTile((pkt), (fmt), G_IM_SIZ_16b, 0, 0, G_TX_LOADTILE, 0, (cmt), (maskt), (shiftt), (cms), (masks), (shifts)); \
+        gDPLoadSync((pkt)); \
+        s64host_gfxloadblock((pkt), G_IM_SIZ_4b, (width), (height)); \
+        gDPPipeSync((pkt)); \
+        s64host_gfxrendertile((pkt), (fmt), G_IM_SIZ_4b, (width), (pal), (cms), (cmt), (masks), (maskt), (shifts), (shiftt)); \
+        gDPSetTileSize((pkt), G_TX_RENDERTILE, 0, 0, ((width)-1) << G_TEXTURE_IMAGE_FRAC, ((height)-1) << G_TEXTURE_IMAGE_FRAC); \
+    }
+
+
+    /*********************************
+           Libultra Functions
+    *********************************/
+
+    extern void guMtxF2L(float mf[4][4], Mtx* m);
+    extern void guMtxL2F(float mf[4][4], Mtx* m);
+    extern void guMtxCatF(float m[4][4], float n[4][4], float r[4][4]);
+    extern void guMtxIdentF(float mf[4][4]);
+
+    extern void osCreateMesgQueue(OSMesgQueue* mq, OSMesg* msg, s32 count);
+    extern s32  osRecvMesg(OSMesgQueue* mq, OSMesg* msg, s32 flag);
+    extern s32  osPiStartDma(OSIoMesg* mb, s32 priority, s32 direction, u32 devAddr, void* vAddr, u32 nbytes, OSMesgQueue* mq);
+    extern void osInvalDCache(void* vaddr, s32 nbytes);
+    extern void osWritebackDCache(void* vaddr, s32 nbytes);
+
+#endif
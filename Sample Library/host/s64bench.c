@@ -0,0 +1,815 @@
+/***************************************************************
+                           s64bench.c
+
+Benchmarks the Sausage64 library's loading, animation and
+drawing functions on a PC, using synthetic models of different
+sizes. Times are for the host CPU, so they're only useful when
+compared against each other (or against a previous run), but
+the command and heap counts match what the N64 would see.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <malloc.h>
+#include <math.h>
+#include "s64host.h"
+#ifdef LIBDRAGON
+    #include <rdpq_tex.h>
+#endif
+
+
+/*********************************
+              Macros
+*********************************/
+
+// These must match the DListCName enum in sausage64.c
+#define DL_SP2TRIANGLES     49
+#define DL_SPENDDISPLAYLIST 56
+#define DL_SPVERTEX         88
+
+#define ANIMCOUNT    2
+#define KEYFRAMES    8
+#define KFSPACING    10
+#define TARGETWORK   20000
+#define ASSETNAME    "rom:/synthetic.bin"
+
+// Space for the display list that the model draws into
+#ifndef LIBDRAGON
+    #define GLISTSIZE(meshes) (sizeof(Gfx)*((meshes)*8 + 16))
+#else
+    #define GLISTSIZE(meshes) 1
+#endif
+
+
+/*********************************
+             Structs
+*********************************/
+
+typedef struct {
+    u8* data;
+    u32 size;
+    u32 capacity;
+} Writer;
+
+
+/*********************************
+             Globals
+*********************************/
+
+static size_t global_heaplive = 0;
+static u32 global_seed = 1;
+static const u16 global_meshcounts[] = {1, 8, 32, 128};
+static const u16 global_instcounts[] = {1, 50, 200};
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void* __real_memalign(size_t alignment, size_t size);
+void  __real_free(void* ptr);
+
+
+/*********************************
+         Heap Accounting
+*********************************/
+
+// The library's allocations are redirected here with the linker's --wrap option
+
+void* __wrap_malloc(size_t size)
+{
+    void* ptr = __real_malloc(size);
+    if (ptr != NULL)
+    {
+        global_heaplive += malloc_usable_size(ptr);
+    }
+    return ptr;
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+    void* ptr = __real_calloc(count, size);
+    if (ptr != NULL)
+    {
+        global_heaplive += malloc_usable_size(ptr);
+    }
+    return ptr;
+}
+
+void* __wrap_memalign(size_t alignment, size_t size)
+{
+    void* ptr = __real_memalign(alignment, size);
+    if (ptr != NULL)
+    {
+        global_heaplive += malloc_usable_size(ptr);
+    }
+    return ptr;
+}
+
+void* __wrap_realloc(void* ptr, size_t size)
+{
+    const size_t oldsize = (ptr != NULL) ? malloc_usable_size(ptr) : 0;
+    void* newptr = __real_realloc(ptr, size);
+    if (newptr != NULL)
+    {
+        global_heaplive += malloc_usable_size(newptr) - oldsize;
+    }
+    return newptr;
+}
+
+void __wrap_free(void* ptr)
+{
+    if (ptr != NULL)
+        global_heaplive -= malloc_usable_size(ptr);
+    __real_free(ptr);
+}
+
+
+/*********************************
+         Helper Functions
+*********************************/
+
+/*==============================
+    now_ns
+    Returns the current time
+    @return The time, in nanoseconds
+==============================*/
+
+static u64 now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec*1000000000ULL + (u64)ts.tv_nsec;
+}
+
+
+/*==============================
+    randf
+    Returns a pseudo random number, so that every
+    run uses the same synthetic models
+    @return A number between -1 and 1
+==============================*/
+
+static f32 randf()
+{
+    global_seed = global_seed*1103515245 + 12345;
+    return ((f32)((global_seed >> 8) & 0xFFFF))/32768.0f - 1.0f;
+}
+
+
+/*==============================
+    put
+    Appends data to a writer
+    @param The writer to append to
+    @param The data to append
+    @param The size of the data
+==============================*/
+
+static void put(Writer* w, const void* data, u32 size)
+{
+    if (w->size + size > w->capacity)
+    {
+        w->capacity = (w->capacity + size)*2;
+        w->data = (u8*)__real_realloc(w->data, w->capacity);
+    }
+    memcpy(w->data + w->size, data, size);
+    w->size += size;
+}
+
+static void put8(Writer* w, u8 val)   { put(w, &val, sizeof(u8)); }
+static void put16(Writer* w, u16 val) { put(w, &val, sizeof(u16)); }
+static void put32(Writer* w, u32 val) { put(w, &val, sizeof(u32)); }
+static void putf(Writer* w, f32 val)  { put(w, &val, sizeof(f32)); }
+static void patch32(Writer* w, u32 offset, u32 val) { memcpy(w->data + offset, &val, sizeof(u32)); }
+
+static void align4(Writer* w)
+{
+    while (w->size % 4)
+        put8(w, 0);
+}
+
+
+/*==============================
+    build_model
+    Generates a binary model, already in host byte order,
+    with a cube for each mesh and two animations
+    @param  The number of meshes
+    @param  The number of keyframes in each animation
+    @param  The number of frames between keyframes
+    @param  A pointer to store the size of the model in
+    @return The malloc'd model data
+==============================*/
+
+static u8* build_model(u16 meshcount, u32 keyframes, u32 spacing, u32* size)
+{
+    u32 i, j, k;
+    #ifndef LIBDRAGON
+        const u32 tocsize = 0x1C;
+    #else
+        const u32 tocsize = 0x24;
+    #endif
+    const u32 framecount = (keyframes-1)*spacing + 1;
+    Writer w = {NULL, 0, 0};
+    global_seed = 1;
+
+    // Header
+    put(&w, "S64", 3);
+    put8(&w, 3);
+    put16(&w, meshcount);
+    put16(&w, 0);
+    put16(&w, ANIMCOUNT);
+    put16(&w, 20);
+    put32(&w, 0);
+    put32(&w, 0);
+
+    // Reserve the mesh table of contents
+    for (i=0; i<meshcount*tocsize; i++)
+        put8(&w, 0);
+
+    // Meshes
+    for (i=0; i<meshcount; i++)
+    {
+        char name[16];
+        const u32 toc = 20 + i*tocsize;
+        const u32 meshdata = w.size;
+        u32 verts, faces = 0, dl;
+        sprintf(name, "Mesh%u", i);
+        put16(&w, (i == 0) ? 0xFFFF : (i-1)/2);
+        put8(&w, 0);
+        put8(&w, 0);
+        putf(&w, 0);
+        putf(&w, 0);
+        putf(&w, 0);
+        putf(&w, 20);
+        put(&w, name, strlen(name)+1);
+        align4(&w);
+
+        // A cube
+        verts = w.size;
+        for (j=0; j<8; j++)
+        {
+            const f32 x = (j & 1) ? 10 : -10, y = (j & 2) ? 10 : -10, z = (j & 4) ? 10 : -10;
+            #ifndef LIBDRAGON
+                Vtx v;
+                memset(&v, 0, sizeof(Vtx));
+                v.v.ob[0] = (s16)x;
+                v.v.ob[1] = (s16)y;
+                v.v.ob[2] = (s16)z;
+                v.v.cn[0] = v.v.cn[1] = v.v.cn[2] = v.v.cn[3] = 255;
+                put(&w, &v, sizeof(Vtx));
+            #else
+                const f32 vert[11] = {x, y, z, 0, 0, x/10, y/10, z/10, 1, 1, 1};
+                put(&w, vert, sizeof(vert));
+            #endif
+        }
+        {
+            static const u8 tris[12][3] = {
+                {0, 1, 3}, {0, 3, 2}, {4, 6, 7}, {4, 7, 5}, {0, 4, 5}, {0, 5, 1},
+                {2, 3, 7}, {2, 7, 6}, {0, 2, 6}, {0, 6, 4}, {1, 5, 7}, {1, 7, 3}
+            };
+            #ifndef LIBDRAGON
+                dl = w.size;
+                put32(&w, DL_SPVERTEX);
+                put32(&w, (0 << 16) | (8 << 8) | 0);
+                for (j=0; j<12; j+=2)
+                {
+                    put32(&w, DL_SP2TRIANGLES);
+                    put32(&w, (tris[j][0] << 24) | (tris[j][1] << 16) | (tris[j][2] << 8));
+                    put32(&w, (tris[j+1][0] << 24) | (tris[j+1][1] << 16) | (tris[j+1][2] << 8));
+                }
+                put32(&w, DL_SPENDDISPLAYLIST);
+                patch32(&w, toc + 0x00, meshdata);
+                patch32(&w, toc + 0x04, verts - meshdata);
+                patch32(&w, toc + 0x08, verts);
+                patch32(&w, toc + 0x0C, sizeof(Vtx)*8);
+                patch32(&w, toc + 0x10, dl);
+                patch32(&w, toc + 0x14, w.size - dl);
+                patch32(&w, toc + 0x18, 8);
+            #else
+                faces = w.size;
+                for (j=0; j<12; j++)
+                    for (k=0; k<3; k++)
+                        put16(&w, tris[j][k]);
+                align4(&w);
+                dl = w.size;
+                put16(&w, 8);
+                put16(&w, 0);
+                put16(&w, 12);
+                put16(&w, 0);
+                put32(&w, 0xFFFFFFFF);
+                patch32(&w, toc + 0x00, meshdata);
+                patch32(&w, toc + 0x04, verts - meshdata);
+                patch32(&w, toc + 0x08, verts);
+                patch32(&w, toc + 0x0C, sizeof(f32)*11*8);
+                patch32(&w, toc + 0x10, faces);
+                patch32(&w, toc + 0x14, sizeof(u16)*3*12);
+                patch32(&w, toc + 0x18, dl);
+                patch32(&w, toc + 0x1C, 0xC);
+                patch32(&w, toc + 0x20, 1);
+            #endif
+            (void)faces;
+        }
+    }
+
+    // Animation table of contents
+    align4(&w);
+    patch32(&w, 16, w.size);
+    {
+        const u32 animtoc = w.size;
+        for (i=0; i<ANIMCOUNT*0x10; i++)
+            put8(&w, 0);
+        for (i=0; i<ANIMCOUNT; i++)
+        {
+            char name[16];
+            const u32 animdata = w.size;
+            u32 kfdata;
+            sprintf(name, "Anim%u", i);
+            put32(&w, keyframes);
+            putf(&w, 0);
+            putf(&w, 0);
+            putf(&w, 0);
+            putf(&w, 1000);
+            put32(&w, framecount);
+            for (j=0; j<keyframes; j++)
+                put16(&w, j*spacing);
+            for (j=0; j<framecount; j++)
+                put16(&w, (j/spacing < keyframes) ? j/spacing : keyframes-1);
+            put(&w, name, strlen(name)+1);
+            align4(&w);
+
+            // Random rotations, so that the interpolation has work to do
+            kfdata = w.size;
+            for (j=0; j<keyframes; j++)
+            {
+                for (k=0; k<meshcount; k++)
+                {
+                    f32 q[4] = {randf(), randf(), randf(), randf()};
+                    const f32 n = sqrtf(q[0]*q[0] + q[1]*q[1] + q[2]*q[2] + q[3]*q[3]);
+                    putf(&w, randf()*10);
+                    putf(&w, randf()*10);
+                    putf(&w, 20 + randf()*10);
+                    putf(&w, q[0]/n);
+                    putf(&w, q[1]/n);
+                    putf(&w, q[2]/n);
+                    putf(&w, q[3]/n);
+                    putf(&w, 1);
+                    putf(&w, 1);
+                    putf(&w, 1);
+                }
+            }
+            patch32(&w, animtoc + i*0x10 + 0x00, animdata);
+            patch32(&w, animtoc + i*0x10 + 0x04, kfdata - animdata);
+            patch32(&w, animtoc + i*0x10 + 0x08, kfdata);
+            patch32(&w, animtoc + i*0x10 + 0x0C, w.size - kfdata);
+        }
+    }
+    *size = w.size;
+    return w.data;
+}
+
+
+/*==============================
+    load_model
+    Loads a synthetic model with the library
+    @param  The synthetic model's data
+    @param  The size of the synthetic model
+    @return The loaded model
+==============================*/
+
+static s64ModelData* load_model(u8* data, u32 size)
+{
+    #ifndef LIBDRAGON
+        s64host_setrom(data, size);
+        return sausage64_load_binarymodel(0, size, NULL);
+    #else
+        s64host_setasset(ASSETNAME, data, size);
+        return sausage64_load_binarymodel(ASSETNAME, NULL);
+    #endif
+}
+
+
+/*==============================
+    draw
+    Draws a helper, and returns how many commands
+    it emitted
+    @param  The helper to draw
+    @param  (Libultra) The display list buffer to use
+    @return The number of Gfx commands or GL calls
+==============================*/
+
+#ifndef LIBDRAGON
+    static u32 draw(s64ModelHelper* helper, void* glist)
+    {
+        Gfx* glistp = (Gfx*)glist;
+        s64host_gfxreset();
+        sausage64_drawmodel(&glistp, helper);
+        return s64host_gfxemitted();
+    }
+#else
+    static u32 draw(s64ModelHelper* helper, void* glist)
+    {
+        u32 count;
+        (void)glist;
+        s64host_glreset();
+        sausage64_drawmodel(helper);
+        s64host_glcalls(&count);
+        return count;
+    }
+#endif
+
+
+/*********************************
+            Benchmarks
+*********************************/
+
+/*==============================
+    bench_load
+    Measures sausage64_load_binarymodel, and how much
+    memory models and helpers take up
+==============================*/
+
+static void bench_load()
+{
+    u32 m;
+    printf("\nLoading (sausage64_load_binarymodel, sausage64_inithelper)\n");
+    printf("%8s %12s %14s %16s %14s\n", "meshes", "ns/load", "model bytes", "helper bytes", "leaked bytes");
+    for (m=0; m<sizeof(global_meshcounts)/sizeof(u16); m++)
+    {
+        u32 i, size;
+        const u32 reps = 2000/global_meshcounts[m] + 10;
+        u8* data = build_model(global_meshcounts[m], KEYFRAMES, KFSPACING, &size);
+        size_t before, modelbytes, helperbytes;
+        s64ModelData* mdl;
+        s64ModelHelper* helper;
+        u64 start;
+
+        // Time the loads
+        start = now_ns();
+        for (i=0; i<reps; i++)
+        {
+            mdl = load_model(data, size);
+            sausage64_unload_binarymodel(mdl);
+            #ifdef LIBDRAGON
+                s64host_glreset();
+            #endif
+        }
+        start = now_ns() - start;
+
+        // The GL recorder's log has already grown during the loads above, so it won't count here
+        before = global_heaplive;
+
+        // Measure the memory used
+        mdl = load_model(data, size);
+        modelbytes = global_heaplive - before;
+        helper = sausage64_inithelper(mdl);
+        helperbytes = global_heaplive - before - modelbytes;
+        sausage64_freehelper(helper);
+        sausage64_unload_binarymodel(mdl);
+        printf("%8u %12.0f %14zu %16zu %14zd\n", global_meshcounts[m], ((f64)start)/reps, modelbytes, helperbytes, (ssize_t)(global_heaplive - before));
+        __real_free(data);
+    }
+}
+
+
+/*==============================
+    bench_anim
+    Measures sausage64_advance_anim and sausage64_drawmodel
+    with different amounts of meshes and instances, with and
+    without interpolation and blending
+==============================*/
+
+static void bench_anim()
+{
+    u32 m, n, interp, blend;
+    printf("\nAnimation and drawing (sausage64_advance_anim, sausage64_drawmodel)\n");
+    #ifndef LIBDRAGON
+        printf("%8s %10s %7s %6s %14s %14s %12s %12s\n", "meshes", "instances", "interp", "blend", "advance ns", "draw ns", "Gfx/draw", "bytes/draw");
+    #else
+        printf("%8s %10s %7s %6s %14s %14s %12s\n", "meshes", "instances", "interp", "blend", "advance ns", "draw ns", "GL/draw");
+    #endif
+    for (m=0; m<sizeof(global_meshcounts)/sizeof(u16); m++)
+    {
+        u32 size;
+        const u16 meshcount = global_meshcounts[m];
+        u8* data = build_model(meshcount, KEYFRAMES, KFSPACING, &size);
+        s64ModelData* mdl = load_model(data, size);
+        void* glist = __real_malloc(GLISTSIZE(meshcount));
+        for (n=0; n<sizeof(global_instcounts)/sizeof(u16); n++)
+        {
+            const u16 instances = global_instcounts[n];
+            s64ModelHelper** helpers = (s64ModelHelper**)__real_malloc(sizeof(s64ModelHelper*)*instances);
+            u32 frames = TARGETWORK/(instances*meshcount);
+            if (frames < 3)
+                frames = 3;
+            if (frames > 200)
+                frames = 200;
+            for (interp=0; interp<2; interp++)
+            {
+                for (blend=0; blend<2; blend++)
+                {
+                    u32 i, f, commands = 0;
+                    u64 advancetime = 0, drawtime = 0, start;
+
+                    // Create the instances, each at a different point of the animation
+                    for (i=0; i<instances; i++)
+                    {
+                        helpers[i] = sausage64_inithelper(mdl);
+                        helpers[i]->interpolate = !interp;
+                        sausage64_set_anim(helpers[i], 0);
+                        sausage64_advance_anim(helpers[i], (f32)(i % 60) + 0.5f);
+                        if (blend)
+                            sausage64_set_anim_blend(helpers[i], 1, 1000000.0f);
+                    }
+
+                    // Run the frames
+                    for (f=0; f<frames; f++)
+                    {
+                        start = now_ns();
+                        for (i=0; i<instances; i++)
+                            sausage64_advance_anim(helpers[i], 0.5f);
+                        advancetime += now_ns() - start;
+                        start = now_ns();
+                        for (i=0; i<instances; i++)
+                            commands += draw(helpers[i], glist);
+                        drawtime += now_ns() - start;
+                    }
+                    for (i=0; i<instances; i++)
+                        sausage64_freehelper(helpers[i]);
+
+                    // Report
+                    #ifndef LIBDRAGON
+                        printf("%8u %10u %7s %6s %14.0f %14.0f %12.1f %12.1f\n", meshcount, instances, interp ? "off" : "on", blend ? "on" : "off",
+                            ((f64)advancetime)/(frames*instances), ((f64)drawtime)/(frames*instances),
+                            ((f64)commands)/(frames*instances), ((f64)commands*8)/(frames*instances)
+                        );
+                    #else
+                        printf("%8u %10u %7s %6s %14.0f %14.0f %12.1f\n", meshcount, instances, interp ? "off" : "on", blend ? "on" : "off",
+                            ((f64)advancetime)/(frames*instances), ((f64)drawtime)/(frames*instances),
+                            ((f64)commands)/(frames*instances)
+                        );
+                    #endif
+                }
+            }
+            __real_free(helpers);
+        }
+        __real_free(glist);
+        sausage64_unload_binarymodel(mdl);
+        __real_free(data);
+    }
+}
+
+
+/*==============================
+    bench_lookat
+    Measures sausage64_lookat on the root mesh, which
+    also affects every child
+==============================*/
+
+static void bench_lookat()
+{
+    u32 m;
+    printf("\nLook at (sausage64_lookat on the root mesh, affecting children)\n");
+    printf("%8s %14s %14s %12s\n", "meshes", "draw ns", "lookat ns", "difference");
+    for (m=0; m<sizeof(global_meshcounts)/sizeof(u16); m++)
+    {
+        u32 i, size;
+        const u16 meshcount = global_meshcounts[m];
+        const u32 frames = TARGETWORK/meshcount + 50;
+        u8* data = build_model(meshcount, KEYFRAMES, KFSPACING, &size);
+        s64ModelData* mdl = load_model(data, size);
+        s64ModelHelper* helper = sausage64_inithelper(mdl);
+        void* glist = __real_malloc(GLISTSIZE(meshcount));
+        f32 dir[3] = {0.3f, -0.9f, 0.1f};
+        u64 plain, looked, start;
+        sausage64_set_anim(helper, 0);
+
+        // Draw without looking, and then draw while looking
+        start = now_ns();
+        for (i=0; i<frames; i++)
+        {
+            sausage64_advance_anim(helper, 0.5f);
+            draw(helper, glist);
+        }
+        plain = now_ns() - start;
+        start = now_ns();
+        for (i=0; i<frames; i++)
+        {
+            sausage64_advance_anim(helper, 0.5f);
+            sausage64_lookat(helper, 0, dir, 0.5f, TRUE);
+            draw(helper, glist);
+        }
+        looked = now_ns() - start;
+        printf("%8u %14.0f %14.0f %12.0f\n", meshcount, ((f64)plain)/frames, ((f64)looked)/frames, ((f64)looked - (f64)plain)/frames);
+        sausage64_freehelper(helper);
+        sausage64_unload_binarymodel(mdl);
+        __real_free(glist);
+        __real_free(data);
+    }
+}
+
+
+/*==============================
+    bench_seek
+    Measures sausage64_set_anim_time with random ticks,
+    with and without the frame lookup table
+==============================*/
+
+static void bench_seek()
+{
+    u32 k;
+    static const u32 keyframes[] = {8, 64, 512, 2000, 8192};
+    printf("\nSeeking (sausage64_set_anim_time to random ticks)\n");
+    printf("%10s %16s %16s\n", "keyframes", "lookup ns", "walk ns");
+    for (k=0; k<sizeof(keyframes)/sizeof(u32); k++)
+    {
+        u32 i, size, pass;
+        const u32 seeks = 100000;
+        u64 times[2];
+        u8* data = build_model(1, keyframes[k], 2, &size);
+        s64ModelData* mdl = load_model(data, size);
+        s64ModelHelper* helper = sausage64_inithelper(mdl);
+        const f32 length = (f32)((keyframes[k]-1)*2);
+        const u16* lookup = mdl->anims[0].framelookup;
+        sausage64_set_anim(helper, 0);
+        for (pass=0; pass<2; pass++)
+        {
+            u64 start;
+            *(const u16**)&mdl->anims[0].framelookup = (pass == 0) ? lookup : NULL;
+            global_seed = 1;
+            start = now_ns();
+            for (i=0; i<seeks; i++)
+                sausage64_set_anim_time(helper, (randf()*0.5f + 0.5f)*length);
+            times[pass] = now_ns() - start;
+        }
+        *(const u16**)&mdl->anims[0].framelookup = lookup;
+        printf("%10u %16.1f %16.1f\n", keyframes[k], ((f64)times[0])/seeks, ((f64)times[1])/seeks);
+        sausage64_freehelper(helper);
+        sausage64_unload_binarymodel(mdl);
+        __real_free(data);
+    }
+}
+
+
+/*==============================
+    bench_baked
+    Compares drawing with baked animations against
+    calculating the transforms every frame
+==============================*/
+
+static void bench_baked()
+{
+    u32 m;
+    const u16 instances = 50;
+    printf("\nBaked animations (sausage64_bake_anims, %u instances)\n", instances);
+    printf("%8s %14s %14s %14s\n", "meshes", "dynamic ns", "baked ns", "bake bytes");
+    for (m=0; m<sizeof(global_meshcounts)/sizeof(u16); m++)
+    {
+        u32 i, f, size, pass;
+        const u16 meshcount = global_meshcounts[m];
+        u32 frames = TARGETWORK/(instances*meshcount);
+        u8* data = build_model(meshcount, KEYFRAMES, KFSPACING, &size);
+        s64ModelData* mdl = load_model(data, size);
+        void* glist = __real_malloc(GLISTSIZE(meshcount));
+        s64ModelHelper* helpers[50];
+        u64 times[2];
+        size_t bakebytes = 0;
+        if (frames < 3)
+            frames = 3;
+        for (i=0; i<instances; i++)
+        {
+            helpers[i] = sausage64_inithelper(mdl);
+            sausage64_set_anim(helpers[i], 0);
+            sausage64_advance_anim(helpers[i], (f32)(i % 60));
+        }
+        for (pass=0; pass<2; pass++)
+        {
+            u64 start;
+            if (pass == 1)
+            {
+                const size_t before = global_heaplive;
+                sausage64_bake_anims(mdl);
+                bakebytes = global_heaplive - before;
+            }
+            start = now_ns();
+            for (f=0; f<frames; f++)
+            {
+                for (i=0; i<instances; i++)
+                {
+                    sausage64_advance_anim(helpers[i], 1.0f);
+                    draw(helpers[i], glist);
+                }
+            }
+            times[pass] = now_ns() - start;
+        }
+        printf("%8u %14.0f %14.0f %14zu\n", meshcount, ((f64)times[0])/(frames*instances), ((f64)times[1])/(frames*instances), bakebytes);
+        for (i=0; i<instances; i++)
+            sausage64_freehelper(helpers[i]);
+        sausage64_unload_binarymodel(mdl);
+        __real_free(glist);
+        __real_free(data);
+    }
+}
+
+
+/*==============================
+    bench_rootmtx
+    Compares drawing with a root matrix, where the mesh
+    matrices are composed on the CPU and loaded, against
+    pushing and multiplying them on the RSP
+==============================*/
+
+#ifndef LIBDRAGON
+    static void bench_rootmtx()
+    {
+        u32 m;
+        const u16 instances = 50;
+        static Mtx root;
+        f32 rootf[4][4] = {
+            { 0.8f, 0.0f, -0.6f, 0.0f},
+            { 0.0f, 1.0f,  0.0f, 0.0f},
+            { 0.6f, 0.0f,  0.8f, 0.0f},
+            { 120,  -45,  -650,  1.0f},
+        };
+        guMtxF2L(rootf, &root);
+        printf("\nRoot matrix (sausage64_set_rootmatrix with G_MTX_LOAD, against G_MTX_MUL and G_MTX_PUSH, %u instances)\n", instances);
+        printf("%8s %14s %14s %14s %14s\n", "meshes", "mul ns/draw", "load ns/draw", "mul bytes", "load bytes");
+        for (m=0; m<sizeof(global_meshcounts)/sizeof(u16); m++)
+        {
+            u32 i, f, size, pass;
+            const u16 meshcount = global_meshcounts[m];
+            u32 frames = TARGETWORK/(instances*meshcount);
+            u8* data = build_model(meshcount, KEYFRAMES, KFSPACING, &size);
+            s64ModelData* mdl = load_model(data, size);
+            void* glist = __real_malloc(GLISTSIZE(meshcount));
+            s64ModelHelper* helpers[50];
+            u64 times[2], commands[2];
+            if (frames < 3)
+                frames = 3;
+            for (i=0; i<instances; i++)
+            {
+                helpers[i] = sausage64_inithelper(mdl);
+                sausage64_set_anim(helpers[i], 0);
+                sausage64_advance_anim(helpers[i], (f32)(i % 60) + 0.5f);
+            }
+
+            // Draw the same frames both ways
+            for (pass=0; pass<2; pass++)
+            {
+                u64 start;
+                for (i=0; i<instances; i++)
+                {
+                    sausage64_set_anim_time(helpers[i], (f32)(i % 60) + 0.5f);
+                    sausage64_set_rootmatrix(helpers[i], (pass == 0) ? NULL : &root);
+                }
+                commands[pass] = 0;
+                start = now_ns();
+                for (f=0; f<frames; f++)
+                {
+                    for (i=0; i<instances; i++)
+                    {
+                        sausage64_advance_anim(helpers[i], 0.5f);
+                        commands[pass] += draw(helpers[i], glist);
+                    }
+                }
+                times[pass] = now_ns() - start;
+            }
+            printf("%8u %14.0f %14.0f %14.1f %14.1f\n", meshcount, 
+                ((f64)times[0])/(frames*instances), ((f64)times[1])/(frames*instances),
+                ((f64)commands[0]*8)/(frames*instances), ((f64)commands[1]*8)/(frames*instances)
+            );
+            for (i=0; i<instances; i++)
+                sausage64_freehelper(helpers[i]);
+            sausage64_unload_binarymodel(mdl);
+            __real_free(glist);
+            __real_free(data);
+        }
+    }
+#endif
+
+
+/*==============================
+    main
+    Program entrypoint
+    @return The return code
+==============================*/
+
+int main()
+{
+    #ifndef LIBDRAGON
+        printf("Sausage64 benchmarks (Libultra host build)\n");
+    #else
+        f32 campos[3] = {0, -200, 50};
+        printf("Sausage64 benchmarks (Libdragon host build, GL calls are recorded)\n");
+        sausage64_set_camera(campos);
+    #endif
+    printf("Times are from the host CPU, so compare them against other runs instead of the N64\n");
+    bench_load();
+    bench_anim();
+    bench_lookat();
+    bench_seek();
+    bench_baked();
+    #ifndef LIBDRAGON
+        bench_rootmtx();
+    #endif
+    return 0;
+}
@@ -0,0 +1,199 @@
+/***************************************************************
+                           s64cull.c
+
+Checks Libultra's frustum culling on a binary model. The model
+is drawn through orthographic cameras that see all of it, none
+of it, and only one half of it, and the culling stats are
+checked against the meshes that actually made it into the
+display list. The camera is also moved along with the model,
+to check that a view relative to the model's root keeps it
+visible. Returns 1 if any of the checks failed.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "s64host.h"
+
+
+/*********************************
+              Macros
+*********************************/
+
+#define MAXTEXTURES 256
+#define GFXSIZE     (16*1024)
+
+// Larger than Catherine in every direction
+#define EXTENT      1000.0f
+
+// How far away the model is moved when checking model-relative views
+#define MODELOFFSET 5000.0f
+
+
+/*********************************
+             Globals
+*********************************/
+
+static Gfx* global_glist;
+static u32  global_errors = 0;
+
+
+/*==============================
+    set_ortho
+    Sets an orthographic camera which sees a box
+    @param The model-relative view matrix
+    @param The left and right edges of the box
+    @param The bottom and top edges of the box
+==============================*/
+
+static void set_ortho(f32 view[4][4], f32 l, f32 r, f32 b, f32 t)
+{
+    static Mtx viewfixed, projfixed;
+    const f32 n = -EXTENT, f = EXTENT;
+    f32 proj[4][4];
+    guMtxIdentF(proj);
+    proj[0][0] = 2/(r-l);
+    proj[1][1] = 2/(t-b);
+    proj[2][2] = -2/(f-n);
+    proj[3][0] = -(r+l)/(r-l);
+    proj[3][1] = -(t+b)/(t-b);
+    proj[3][2] = -(f+n)/(f-n);
+    guMtxF2L(view, &viewfixed);
+    guMtxF2L(proj, &projfixed);
+    sausage64_set_camera(&viewfixed, &projfixed);
+}
+
+
+/*==============================
+    draw_count
+    Draws the model and counts the meshes in its display list
+    @param  The model helper to draw
+    @return The number of display lists called
+==============================*/
+
+static u32 draw_count(s64ModelHelper* helper)
+{
+    u32 count = 0;
+    Gfx* glistp = global_glist;
+    sausage64_drawmodel(&glistp, helper);
+    gSPEndDisplayList(glistp++);
+    for (glistp = global_glist; (glistp->words.w0 >> 24) != G_ENDDL; glistp++)
+        if ((glistp->words.w0 >> 24) == G_DL)
+            count++;
+    return count;
+}
+
+
+/*==============================
+    check
+    Prints the result of a check, and counts it if it failed
+    @param The name of the check
+    @param Whether the check passed
+==============================*/
+
+static void check(const char* name, int passed)
+{
+    printf("  %-52s %s\n", name, passed ? "ok" : "FAILED");
+    if (!passed)
+        global_errors++;
+}
+
+
+/*==============================
+    main
+    Program entrypoint
+    @param  The number of extra arguments
+    @param  An array with the arguments
+    @return 0 if every check passed
+==============================*/
+
+int main(int argc, char* argv[])
+{
+    int i;
+    u16 anim;
+    u32 size, meshcount, drawn, left, right, leftculled, rightculled;
+    u8* rom;
+    f32 view[4][4];
+    static u8 texturedata[4096];
+    static u32* textures[MAXTEXTURES];
+    s64ModelData* mdl;
+    s64ModelHelper* helper;
+    if (argc < 2)
+    {
+        printf("Usage: %s <model.bin>\n", argv[0]);
+        return 1;
+    }
+
+    // Load the model
+    for (i=0; i<MAXTEXTURES; i++)
+        textures[i] = (u32*)texturedata;
+    rom = s64host_readmodel(argv[1], &size);
+    if (rom == NULL)
+    {
+        printf("Unable to read '%s'\n", argv[1]);
+        return 1;
+    }
+    s64host_setrom(rom, size);
+    mdl = sausage64_load_binarymodel(0, size, textures);
+    helper = (mdl != NULL) ? sausage64_inithelper(mdl) : NULL;
+    if (helper == NULL)
+    {
+        printf("Unable to load '%s'\n", argv[1]);
+        return 1;
+    }
+    global_glist = (Gfx*)malloc(sizeof(Gfx)*GFXSIZE);
+    meshcount = mdl->meshcount;
+    sausage64_set_culling(helper, TRUE);
+
+    // Check every animation, since they move the meshes around
+    printf("Frustum culling\n");
+    for (anim=0; anim<mdl->animcount; anim++)
+    {
+        printf(" %s\n", mdl->anims[anim].name);
+        sausage64_set_anim(helper, anim);
+        sausage64_advance_anim(helper, 3.5f);
+
+        // A camera which sees the whole model draws every mesh
+        guMtxIdentF(view);
+        set_ortho(view, -EXTENT, EXTENT, -EXTENT, EXTENT);
+        drawn = draw_count(helper);
+        check("Camera around the model draws every mesh", drawn == meshcount && helper->cullstats.meshes_drawn == meshcount && helper->cullstats.meshes_culled == 0);
+
+        // A camera which looks at empty space draws nothing
+        set_ortho(view, 2*EXTENT, 4*EXTENT, -EXTENT, EXTENT);
+        drawn = draw_count(helper);
+        check("Camera away from the model culls it", drawn == 0 && helper->cullstats.model_culled);
+
+        // A camera which sees one half of the model only draws the meshes on that half (depending on the pose, one half might have all of them)
+        set_ortho(view, -EXTENT, 0, -EXTENT, EXTENT);
+        left = draw_count(helper);
+        leftculled = helper->cullstats.meshes_culled;
+        check("Left half draws the meshes it counted", left == helper->cullstats.meshes_drawn && left + leftculled == meshcount);
+        set_ortho(view, 0, EXTENT, -EXTENT, EXTENT);
+        right = draw_count(helper);
+        rightculled = helper->cullstats.meshes_culled;
+        check("Right half draws the meshes it counted", right == helper->cullstats.meshes_drawn && right + rightculled == meshcount);
+        check("Meshes outside of a half are culled", leftculled > 0 || rightculled > 0);
+        check("Both halves together draw every mesh", left + right >= meshcount);
+
+        // With the model moved away, the world view misses it, but the view relative to the model's root doesn't
+        set_ortho(view, MODELOFFSET-EXTENT, MODELOFFSET+EXTENT, -EXTENT, EXTENT);
+        drawn = draw_count(helper);
+        check("Moved model with the world view is culled", drawn == 0 && helper->cullstats.model_culled);
+        view[3][0] = MODELOFFSET;
+        set_ortho(view, MODELOFFSET-EXTENT, MODELOFFSET+EXTENT, -EXTENT, EXTENT);
+        drawn = draw_count(helper);
+        check("Moved model with the model-relative view is drawn", drawn == meshcount && helper->cullstats.meshes_culled == 0);
+    }
+    if (global_errors == 0)
+        printf("No problems found\n");
+    else
+        printf("Found %u problems\n", global_errors);
+
+    // Cleanup
+    free(global_glist);
+    free(rom);
+    sausage64_freehelper(helper);
+    sausage64_unload_binarymodel(mdl);
+    return (global_errors > 0);
+}
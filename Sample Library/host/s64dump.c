@@ -0,0 +1,378 @@
+/***************************************************************
+                           s64dump.c
+
+Loads a binary model exported by Arabiki64 with the Sausage64
+library, plays its animations, and prints what the library
+emits when drawing it. Used to inspect the library's output
+without needing to run a ROM. With -c, it also checks that
+every mesh got a matrix, that the matrix stack is balanced and
+that the animation never lands outside its keyframes, and
+exits with an error if not. The output doesn't change between
+runs, so it can be diffed against a previous one.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "s64host.h"
+#ifdef LIBDRAGON
+    #include <rdpq_tex.h>
+#endif
+
+
+/*********************************
+              Macros
+*********************************/
+
+#define MAXTEXTURES 256
+#define GFXSIZE     (64*1024)
+
+
+/*********************************
+             Globals
+*********************************/
+
+static u8 global_verbose = FALSE;
+static u8 global_check = FALSE;
+static u32 global_frames = 3;
+static f32 global_ticks = 10.0f;
+static s32 global_anim = -1;
+#ifndef LIBDRAGON
+    static Gfx* global_glist;
+#endif
+
+
+/*==============================
+    show_help
+    Prints the program's usage
+==============================*/
+
+static void show_help(const char* name)
+{
+    printf("Usage: %s [options] <model.bin>\n", name);
+    printf("  -a <index>  Only play the animation with this index\n");
+    printf("  -c          Check the output, and exit with an error if something's wrong\n");
+    printf("  -f <count>  Number of frames to draw per animation (default %u)\n", global_frames);
+    printf("  -t <ticks>  Number of ticks to advance between frames (default %g)\n", global_ticks);
+    printf("  -v          Print every command that was emitted\n");
+}
+
+
+/*==============================
+    check_animplay
+    Checks that an animation player is on a keyframe
+    that exists, and that its tick is inside of it
+    @param  The animation player to check
+    @param  The name to print if it's wrong
+    @return The number of problems found
+==============================*/
+
+static u32 check_animplay(const s64AnimPlay* playing, const char* name)
+{
+    const s64Animation* anim = playing->animdata;
+    const u32 kf = playing->curkeyframe;
+    if (!global_check || anim == NULL || anim->keyframecount == 0)
+        return 0;
+    if (kf >= anim->keyframecount)
+    {
+        printf("    ERROR: %s is on keyframe %u, but the animation only has %u\n", name, kf, anim->keyframecount);
+        return 1;
+    }
+    if (playing->curtick < anim->keyframes[kf].framenumber || (kf+1 < anim->keyframecount && playing->curtick >= anim->keyframes[kf+1].framenumber))
+    {
+        printf("    ERROR: %s is on keyframe %u, but tick %.2f is outside of it\n", name, kf, playing->curtick);
+        return 1;
+    }
+    return 0;
+}
+
+
+/*==============================
+    check_count
+    Checks that something was emitted the expected
+    amount of times
+    @param  What was counted
+    @param  The amount counted
+    @param  The amount expected
+    @return The number of problems found
+==============================*/
+
+static u32 check_count(const char* name, u32 count, u32 expected)
+{
+    if (!global_check || count == expected)
+        return 0;
+    printf("    ERROR: Expected %u %s, got %u\n", expected, name, count);
+    return 1;
+}
+
+
+/*==============================
+    draw_frame
+    Draws the model once, and prints what was emitted
+    @param  The model helper to draw
+    @param  The frame number
+    @return The number of problems found
+==============================*/
+
+#ifndef LIBDRAGON
+    static u32 draw_frame(s64ModelHelper* helper, u32 frame)
+    {
+        Gfx* glist = global_glist;
+        Gfx* glistp = glist;
+        s64HostGfxStats stats;
+        u32 mtxcount, pushes = 0, pops = 0, errors = 0;
+
+        // Draw the model into the display list
+        s64host_gfxreset();
+        sausage64_drawmodel(&glistp, helper);
+        gSPEndDisplayList(glistp++);
+
+        // Print the results
+        s64host_gfxstats(glist, &stats);
+        mtxcount = stats.opcodes[G_MTX];
+        printf("    Frame %u (tick %.2f): %u commands emitted, %u commands (%u bytes) executed, %u matrices, %u vertex loads, %u triangle commands, depth %u\n",
+            frame, helper->curanim.curtick, s64host_gfxemitted(), stats.commands, stats.bytes, mtxcount,
+            stats.opcodes[G_VTX], stats.opcodes[G_TRI1] + stats.opcodes[G_TRI2], stats.depth
+        );
+        if (global_verbose)
+            s64host_printgfx(stdout, glist);
+
+        // The matrices are pushed and popped by the model's own display list, not the ones it calls
+        for (glistp = glist; (glistp->words.w0 >> 24) != G_ENDDL; glistp++)
+        {
+            const u32 opcode = glistp->words.w0 >> 24;
+            if (opcode == G_MTX && !(glistp->words.w0 & G_MTX_PUSH))
+                pushes++;
+            else if (opcode == G_POPMTX)
+                pops++;
+        }
+        errors += check_count("matrices", mtxcount, helper->mdldata->meshcount);
+        errors += check_count("matrix pops", pops, pushes);
+        errors += check_animplay(&helper->curanim, "The animation");
+        if (helper->blendticks_left > 0)
+            errors += check_animplay(&helper->blendanim, "The blended animation");
+        return errors;
+    }
+#else
+    static u32 draw_frame(s64ModelHelper* helper, u32 frame)
+    {
+        u32 i, count, pushes = 0, pops = 0, calls = 0, errors = 0;
+        const s64HostGLCall* list;
+
+        // Draw the model
+        s64host_glreset();
+        sausage64_drawmodel(helper);
+
+        // Print the results
+        list = s64host_glcalls(&count);
+        for (i=0; i<count; i++)
+        {
+            if (strcmp(list[i].name, "glPushMatrix") == 0)
+                pushes++;
+            else if (strcmp(list[i].name, "glPopMatrix") == 0)
+                pops++;
+            else if (strcmp(list[i].name, "glCallList") == 0)
+                calls++;
+        }
+        printf("    Frame %u (tick %.2f): %u GL calls, %u display lists called, %u pushes, %u pops\n",
+            frame, helper->curanim.curtick, count, calls, pushes, pops
+        );
+        if (global_verbose)
+            s64host_printgl(stdout);
+        errors += check_count("display list calls", calls, helper->mdldata->meshcount);
+        errors += check_count("matrix pushes", pushes, helper->mdldata->meshcount);
+        errors += check_count("matrix pops", pops, pushes);
+        errors += check_animplay(&helper->curanim, "The animation");
+        if (helper->blendticks_left > 0)
+            errors += check_animplay(&helper->blendanim, "The blended animation");
+        return errors;
+    }
+#endif
+
+
+/*==============================
+    draw_anim
+    Draws the model with its current animation
+    over a few frames
+    @param  The model helper to draw
+    @return The number of problems found
+==============================*/
+
+static u32 draw_anim(s64ModelHelper* helper)
+{
+    u32 frame, pass, lastkf, errors = 0;
+    f32 length;
+    const s64Animation* anim;
+    const u16* lookup;
+    const u8 animated = (helper->curanim.animdata != NULL && helper->curanim.animdata->keyframecount > 0);
+    for (frame=0; frame<global_frames; frame++)
+    {
+        errors += draw_frame(helper, frame);
+        if (animated)
+            sausage64_advance_anim(helper, global_ticks);
+    }
+    if (!global_check || !animated)
+        return errors;
+
+    // Without looping, the animation must stop on its first and last keyframes, rather than going past them
+    // This is done with and without the frame lookup table, as models made with older versions of Arabiki64 don't have one
+    anim = helper->curanim.animdata;
+    lookup = anim->framelookup;
+    lastkf = anim->keyframecount-1;
+    length = (f32)anim->keyframes[lastkf].framenumber;
+    helper->loop = FALSE;
+    for (pass=0; pass<2; pass++)
+    {
+        *(const u16**)&anim->framelookup = (pass == 0) ? lookup : NULL;
+        printf("    Without looping, %s:\n", (pass == 0) ? "with the frame lookup table" : "without the frame lookup table");
+        sausage64_set_anim_time(helper, -global_ticks);
+        errors += draw_frame(helper, 0);
+        sausage64_set_anim_time(helper, length + global_ticks);
+        errors += check_count("keyframe index after jumping past the end", helper->curanim.curkeyframe, lastkf);
+        errors += draw_frame(helper, 1);
+        sausage64_set_anim_time(helper, length - global_ticks/2);
+        for (frame=2; frame<4; frame++)
+        {
+            sausage64_advance_anim(helper, global_ticks);
+            errors += draw_frame(helper, frame);
+        }
+        errors += check_count("keyframe index after playing past the end", helper->curanim.curkeyframe, lastkf);
+    }
+    *(const u16**)&anim->framelookup = lookup;
+    helper->loop = TRUE;
+    return errors;
+}
+
+
+/*==============================
+    main
+    Program entrypoint
+    @param The number of extra arguments
+    @param An array with the arguments
+    @return The return code
+==============================*/
+
+int main(int argc, char* argv[])
+{
+    int i;
+    u16 anim;
+    u32 errors = 0;
+    const char* path = NULL;
+    s64ModelData* mdl;
+    s64ModelHelper* helper;
+    #ifndef LIBDRAGON
+        static u8 texturedata[4096];
+        static u32* textures[MAXTEXTURES];
+        u8* rom;
+        u32 size;
+    #else
+        static sprite_t sprites[MAXTEXTURES];
+        static sprite_t* textures[MAXTEXTURES];
+        f32 campos[3] = {0, -200, 50};
+    #endif
+
+    // Parse the arguments
+    for (i=1; i<argc; i++)
+    {
+        if (!strcmp(argv[i], "-a") && i+1 < argc)
+            global_anim = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-f") && i+1 < argc)
+            global_frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-t") && i+1 < argc)
+            global_ticks = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-c"))
+            global_check = TRUE;
+        else if (!strcmp(argv[i], "-v"))
+            global_verbose = TRUE;
+        else if (argv[i][0] != '-')
+            path = argv[i];
+        else
+        {
+            show_help(argv[0]);
+            return 1;
+        }
+    }
+    if (path == NULL)
+    {
+        show_help(argv[0]);
+        return 1;
+    }
+
+    // Textures aren't rendered, so every material can point to the same dummy texture
+    for (i=0; i<MAXTEXTURES; i++)
+    {
+        #ifndef LIBDRAGON
+            textures[i] = (u32*)texturedata;
+        #else
+            sprites[i].width = 32;
+            sprites[i].height = 32;
+            textures[i] = &sprites[i];
+        #endif
+    }
+
+    // Load the model
+    #ifndef LIBDRAGON
+        rom = s64host_readmodel(path, &size);
+        if (rom == NULL)
+        {
+            printf("Unable to read '%s'\n", path);
+            return 1;
+        }
+        s64host_setrom(rom, size);
+        s64host_gfxreset();
+        mdl = sausage64_load_binarymodel(0, size, textures);
+    #else
+        mdl = sausage64_load_binarymodel((char*)path, textures);
+    #endif
+    if (mdl == NULL)
+    {
+        printf("Unable to load '%s'. Was it exported for this library?\n", path);
+        return 1;
+    }
+    #ifndef LIBDRAGON
+        printf("Loaded '%s': %u meshes, %u animations, %u commands generated\n", path, mdl->meshcount, mdl->animcount, s64host_gfxemitted());
+    #else
+        printf("Loaded '%s': %u meshes, %u animations\n", path, mdl->meshcount, mdl->animcount);
+        sausage64_set_camera(campos);
+    #endif
+
+    // Create the helper
+    helper = sausage64_inithelper(mdl);
+    if (helper == NULL)
+    {
+        printf("Unable to create the model helper\n");
+        return 1;
+    }
+    #ifndef LIBDRAGON
+        global_glist = (Gfx*)malloc(sizeof(Gfx)*GFXSIZE);
+    #endif
+
+    // Draw each animation
+    for (anim=0; anim<mdl->animcount || (anim == 0 && mdl->animcount == 0); anim++)
+    {
+        if (global_anim >= 0 && anim != global_anim)
+            continue;
+        if (mdl->animcount > 0)
+        {
+            sausage64_set_anim(helper, anim);
+            printf("Animation %u '%s': %u keyframes\n", anim, mdl->anims[anim].name, mdl->anims[anim].keyframecount);
+        }
+        errors += draw_anim(helper);
+    }
+
+    // Cleanup
+    #ifndef LIBDRAGON
+        free(global_glist);
+        free(rom);
+    #endif
+    sausage64_freehelper(helper);
+    sausage64_unload_binarymodel(mdl);
+    if (global_check)
+    {
+        if (errors > 0)
+            printf("Found %u problems\n", errors);
+        else
+            printf("No problems found\n");
+    }
+    return (errors > 0);
+}
@@ -0,0 +1,788 @@
+/***************************************************************
+                           s64host.c
+
+Stand-ins for the Libultra and Libdragon functions that the
+Sausage64 library uses, so that it can be built and run on a PC.
+Display lists and OpenGL calls are recorded so that they can be
+inspected, instead of being rendered.
+***************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "s64host.h"
+#ifdef LIBDRAGON
+    #include <rdpq_tex.h>
+    #include <asset.h>
+#endif
+
+
+/*********************************
+              Macros
+*********************************/
+
+// These must match the ones in sausage64.c
+#define BINARY_VERSION 3
+#ifndef LIBDRAGON
+    #define BINARY_LODTOCSIZE 0x18
+#else
+    #define BINARY_LODTOCSIZE 0x20
+#endif
+
+
+/*********************************
+             Globals
+*********************************/
+
+#ifndef LIBDRAGON
+    static u8* s64host_rom = NULL;
+    static u32 s64host_romsize = 0;
+    static u32 s64host_emitted = 0;
+#else
+    static s64HostGLCall* s64host_calls = NULL;
+    static u32 s64host_callcount = 0;
+    static u32 s64host_callsize = 0;
+    static GLuint s64host_lastlist = 0;
+    static GLuint s64host_lastbuffer = 0;
+    static GLuint s64host_lasttexture = 0;
+    static const char* s64host_assetname = NULL;
+    static u8* s64host_assetdata = NULL;
+    static u32 s64host_assetsize = 0;
+#endif
+
+
+/*********************************
+        Byte Order Functions
+*********************************/
+
+/*==============================
+    s64host_swap16
+    Swaps a big endian 16-bit value in place
+    @param  A pointer to the value
+    @return The value in host byte order
+==============================*/
+
+static u16 s64host_swap16(u8* p)
+{
+    u16 val = (u16)((p[0] << 8) | p[1]);
+    memcpy(p, &val, sizeof(u16));
+    return val;
+}
+
+
+/*==============================
+    s64host_swap32
+    Swaps a big endian 32-bit value in place
+    @param  A pointer to the value
+    @return The value in host byte order
+==============================*/
+
+static u32 s64host_swap32(u8* p)
+{
+    u32 val = ((u32)p[0] << 24) | ((u32)p[1] << 16) | ((u32)p[2] << 8) | (u32)p[3];
+    memcpy(p, &val, sizeof(u32));
+    return val;
+}
+
+
+/*==============================
+    s64host_swaprange32
+    Swaps a block of big endian 32-bit values in place
+    @param The first value
+    @param The size of the block, in bytes
+==============================*/
+
+static void s64host_swaprange32(u8* p, u32 size)
+{
+    u32 i;
+    for (i=0; i+4<=size; i+=4)
+        s64host_swap32(p + i);
+}
+
+
+/*==============================
+    s64host_swapgeometry
+    Swaps the geometry of a mesh or LOD in place
+    @param The binary file data
+    @param The offset of the geometry's table of contents
+           (after the LOD's screen size)
+==============================*/
+
+static void s64host_swapgeometry(u8* data, u32 offset)
+{
+    u32 i;
+    const u32 vert_off = s64host_swap32(data + offset + 0);
+    const u32 vert_size = s64host_swap32(data + offset + 4);
+    #ifndef LIBDRAGON
+        const u32 dl_off = s64host_swap32(data + offset + 8);
+        const u32 dl_size = s64host_swap32(data + offset + 12);
+        s64host_swap32(data + offset + 16);
+
+        // Only the position, flag and texture coordinates are wider than a byte
+        for (i=0; i<vert_size; i+=sizeof(Vtx))
+        {
+            int j;
+            for (j=0; j<6; j++)
+                s64host_swap16(data + vert_off + i + j*sizeof(u16));
+        }
+        s64host_swaprange32(data + dl_off, dl_size);
+    #else
+        const u32 face_off = s64host_swap32(data + offset + 8);
+        const u32 face_size = s64host_swap32(data + offset + 12);
+        const u32 dl_off = s64host_swap32(data + offset + 16);
+        const u32 dl_size = s64host_swap32(data + offset + 20);
+        s64host_swap32(data + offset + 24);
+        s64host_swaprange32(data + vert_off, vert_size);
+        for (i=0; i<face_size; i+=sizeof(u16))
+            s64host_swap16(data + face_off + i);
+
+        // Render blocks are four u16s followed by the material index
+        for (i=0; i+0xC<=dl_size; i+=0xC)
+        {
+            s64host_swap16(data + dl_off + i + 0);
+            s64host_swap16(data + dl_off + i + 2);
+            s64host_swap16(data + dl_off + i + 4);
+            s64host_swap16(data + dl_off + i + 6);
+            s64host_swap32(data + dl_off + i + 8);
+        }
+    #endif
+}
+
+
+/*==============================
+    s64host_swapmodel
+    Swaps a binary model's data from big endian to the
+    host's byte order, in place
+    @param The binary file data
+==============================*/
+
+static void s64host_swapmodel(u8* data)
+{
+    u32 i;
+    u16 count_meshes, count_materials, count_anims, offset_meshes;
+    u32 offset_materials, offset_anims;
+
+    // Header
+    count_meshes = s64host_swap16(data + 4);
+    count_materials = s64host_swap16(data + 6);
+    count_anims = s64host_swap16(data + 8);
+    offset_meshes = s64host_swap16(data + 10);
+    offset_materials = s64host_swap32(data + 12);
+    offset_anims = s64host_swap32(data + 16);
+
+    // Meshes, and their LODs
+    for (i=0; i<count_meshes; i++)
+    {
+        u32 j, meshdata, lodcount;
+        #ifndef LIBDRAGON
+            const u32 toc = offset_meshes + 0x1C*i;
+        #else
+            const u32 toc = offset_meshes + 0x24*i;
+        #endif
+        meshdata = s64host_swap32(data + toc);
+        s64host_swap32(data + toc + 4);
+        s64host_swapgeometry(data, toc + 8);
+        s64host_swap16(data + meshdata);
+        lodcount = data[meshdata + 3];
+        s64host_swaprange32(data + meshdata + 4, sizeof(f32)*4);
+        for (j=0; j<lodcount; j++)
+        {
+            const u32 lodtoc = meshdata + 4 + sizeof(f32)*4 + j*BINARY_LODTOCSIZE;
+            s64host_swap32(data + lodtoc);
+            s64host_swapgeometry(data, lodtoc + 4);
+        }
+    }
+
+    // Materials
+    for (i=0; i<count_materials; i++)
+    {
+        const u32 toc = offset_materials + 0x10*i;
+        const u32 matdata = s64host_swap32(data + toc + 0);
+        const u32 matdata_size = s64host_swap32(data + toc + 4);
+        const u32 material = s64host_swap32(data + toc + 8);
+        s64host_swap32(data + toc + 12);
+        (void)matdata_size;
+        #ifdef LIBDRAGON
+            if (data[matdata] == TYPE_TEXTURE)
+            {
+                s64host_swaprange32(data + material, sizeof(u32)*3);
+                s64host_swap16(data + material + 12);
+                s64host_swap16(data + material + 14);
+            }
+        #else
+            (void)matdata;
+            (void)material;
+        #endif
+    }
+
+    // Animations
+    for (i=0; i<count_anims; i++)
+    {
+        u32 j, kfcount, framecount;
+        const u32 toc = offset_anims + 0x10*i;
+        const u32 animdata = s64host_swap32(data + toc + 0);
+        const u32 animsize = s64host_swap32(data + toc + 4);
+        const u32 kfdata = s64host_swap32(data + toc + 8);
+        const u32 kfsize = s64host_swap32(data + toc + 12);
+        (void)animsize;
+        kfcount = s64host_swap32(data + animdata);
+        s64host_swaprange32(data + animdata + 4, sizeof(f32)*4);
+        framecount = s64host_swap32(data + animdata + 4 + sizeof(f32)*4);
+        for (j=0; j<kfcount+framecount; j++)
+            s64host_swap16(data + animdata + 8 + sizeof(f32)*4 + j*sizeof(u16));
+        s64host_swaprange32(data + kfdata, kfsize);
+    }
+}
+
+
+/*==============================
+    s64host_readmodel
+    Reads a binary model exported by Arabiki64, and swaps
+    its contents from the N64's big endian to the host's
+    byte order, so that the library can read it
+    @param  The path of the file to read
+    @param  A pointer to store the size of the file in
+    @return The malloc'd file data, or NULL
+==============================*/
+
+u8* s64host_readmodel(const char* path, u32* size)
+{
+    long len;
+    u8* data;
+    FILE* fp = fopen(path, "rb");
+    if (fp == NULL)
+        return NULL;
+    fseek(fp, 0, SEEK_END);
+    len = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    data = (u8*)malloc(len);
+    if (data == NULL || fread(data, 1, len, fp) != (size_t)len)
+    {
+        free(data);
+        fclose(fp);
+        return NULL;
+    }
+    fclose(fp);
+
+    // Only swap files that the library would accept
+    if (len > 20 && data[0] == 'S' && data[1] == '6' && data[2] == '4' && data[3] == BINARY_VERSION)
+        s64host_swapmodel(data);
+    *size = (u32)len;
+    return data;
+}
+
+
+#ifndef LIBDRAGON
+
+/*********************************
+        Libultra Functions
+*********************************/
+
+/*==============================
+    s64host_setrom
+    Sets the buffer that osPiStartDma will read from
+    @param The ROM data
+    @param The size of the ROM data
+==============================*/
+
+void s64host_setrom(u8* data, u32 size)
+{
+    s64host_rom = data;
+    s64host_romsize = size;
+}
+
+void osCreateMesgQueue(OSMesgQueue* mq, OSMesg* msg, s32 count)
+{
+    mq->validCount = 0;
+    mq->msg = msg;
+    (void)count;
+}
+
+s32 osRecvMesg(OSMesgQueue* mq, OSMesg* msg, s32 flag)
+{
+    (void)flag;
+    if (mq->validCount == 0)
+        return -1;
+    mq->validCount--;
+    if (msg != NULL)
+        *msg = NULL;
+    return 0;
+}
+
+s32 osPiStartDma(OSIoMesg* mb, s32 priority, s32 direction, u32 devAddr, void* vAddr, u32 nbytes, OSMesgQueue* mq)
+{
+    (void)priority;
+    if (direction != OS_READ || s64host_rom == NULL || devAddr + nbytes > s64host_romsize)
+        return -1;
+    memcpy(vAddr, s64host_rom + devAddr, nbytes);
+    mb->size = nbytes;
+    mq->validCount++;
+    return 0;
+}
+
+void osInvalDCache(void* vaddr, s32 nbytes)
+{
+    (void)vaddr;
+    (void)nbytes;
+}
+
+void osWritebackDCache(void* vaddr, s32 nbytes)
+{
+    (void)vaddr;
+    (void)nbytes;
+}
+
+void guMtxIdentF(float mf[4][4])
+{
+    int i, j;
+    for (i=0; i<4; i++)
+        for (j=0; j<4; j++)
+            mf[i][j] = (i == j) ? 1.0f : 0.0f;
+}
+
+void guMtxCatF(float m[4][4], float n[4][4], float r[4][4])
+{
+    int i, j;
+    float temp[4][4];
+    for (i=0; i<4; i++)
+        for (j=0; j<4; j++)
+            temp[i][j] = m[i][0]*n[0][j] + m[i][1]*n[1][j] + m[i][2]*n[2][j] + m[i][3]*n[3][j];
+    memcpy(r, temp, sizeof(temp));
+}
+
+void guMtxF2L(float mf[4][4], Mtx* m)
+{
+    int i, j;
+    u16* integer = (u16*)m;
+    u16* fraction = ((u16*)m) + 16;
+    for (i=0; i<4; i++)
+    {
+        for (j=0; j<4; j++)
+        {
+            s32 e = (s32)(mf[i][j]*65536.0f);
+            integer[i*4 + j] = (u16)(e >> 16);
+            fraction[i*4 + j] = (u16)(e & 0xFFFF);
+        }
+    }
+}
+
+void guMtxL2F(float mf[4][4], Mtx* m)
+{
+    int i, j;
+    u16* integer = (u16*)m;
+    u16* fraction = ((u16*)m) + 16;
+    for (i=0; i<4; i++)
+        for (j=0; j<4; j++)
+            mf[i][j] = ((s32)(((u32)integer[i*4 + j] << 16) | fraction[i*4 + j]))/65536.0f;
+}
+
+
+/*********************************
+       Display List Recording
+*********************************/
+
+void s64host_gfx(Gfx* pkt, u32 w0, uintptr_t w1)
+{
+    pkt->words.w0 = w0;
+    pkt->words.w1 = w1;
+    s64host_emitted++;
+}
+
+void s64host_gfxtri(Gfx* pkt, u32 cmd, u32 v00, u32 v01, u32 v02, u32 flag0, u32 v10, u32 v11, u32 v12, u32 flag1)
+{
+    u32 tri[2][3] = {{v00, v01, v02}, {v10, v11, v12}};
+    u32 flags[2] = {flag0, flag1};
+    u32 words[2];
+    int i;
+
+    // The flag picks which vertex comes first, like __gsSP1Triangle_w1f
+    for (i=0; i<2; i++)
+    {
+        const u32 a = tri[i][flags[i]%3], b = tri[i][(flags[i]+1)%3], c = tri[i][(flags[i]+2)%3];
+        words[i] = _SHIFTL(a*2, 16, 8) | _SHIFTL(b*2, 8, 8) | _SHIFTL(c*2, 0, 8);
+    }
+    if (cmd == G_TRI1)
+        s64host_gfx(pkt, _SHIFTL(G_TRI1, 24, 8) | words[0], 0);
+    else
+        s64host_gfx(pkt, _SHIFTL(G_TRI2, 24, 8) | words[0], words[1]);
+}
+
+void s64host_gfxloadblock(Gfx* pkt, u32 siz, u32 width, u32 height)
+{
+    static const u32 incr[] = {3, 1, 0, 0};
+    static const u32 shift[] = {2, 1, 0, 0};
+    static const u32 bytes[] = {0, 1, 2, 4};
+    u32 lrs, words;
+
+    // Same as CALC_DXT and CALC_DXT_4b
+    lrs = ((width*height + incr[siz]) >> shift[siz]) - 1;
+    if (siz == G_IM_SIZ_4b)
+        words = width/16;
+    else
+        words = width*bytes[siz]/8;
+    if (words < 1)
+        words = 1;
+    if (lrs > G_TX_LDBLK_MAX_TXL)
+        lrs = G_TX_LDBLK_MAX_TXL;
+    s64host_gfx(pkt, _SHIFTL(G_LOADBLOCK, 24, 8),
+        _SHIFTL(G_TX_LOADTILE, 24, 3) | _SHIFTL(lrs, 12, 12) | _SHIFTL(((1 << G_TX_DXT_FRAC) + words - 1)/words, 0, 12)
+    );
+}
+
+void s64host_gfxrendertile(Gfx* pkt, u32 fmt, u32 siz, u32 width, u32 pal, u32 cms, u32 cmt, u32 masks, u32 maskt, u32 shifts, u32 shiftt)
+{
+    static const u32 linebytes[] = {0, 1, 2, 2};
+    u32 line;
+    if (siz == G_IM_SIZ_4b)
+        line = ((width >> 1) + 7) >> 3;
+    else
+        line = ((width*linebytes[siz]) + 7) >> 3;
+    gDPSetTile(pkt, fmt, siz, line, 0, G_TX_RENDERTILE, pal, cmt, maskt, shiftt, cms, masks, shifts);
+}
+
+u32 s64host_gfxemitted()
+{
+    return s64host_emitted;
+}
+
+void s64host_gfxreset()
+{
+    s64host_emitted = 0;
+}
+
+
+/*==============================
+    s64host_walkgfx
+    Walks a display list, following any display lists
+    it calls
+    @param The display list to walk
+    @param The stats struct to fill
+    @param The file to print to, or NULL
+    @param The current call depth
+==============================*/
+
+static void s64host_walkgfx(const Gfx* dl, s64HostGfxStats* stats, FILE* fp, u32 depth)
+{
+    if (depth > stats->depth)
+        stats->depth = depth;
+    while (1)
+    {
+        const u32 w0 = dl->words.w0;
+        const uintptr_t w1 = dl->words.w1;
+        const u8 op = _SHIFTR(w0, 24, 8);
+        stats->commands++;
+        stats->bytes += 8;
+        stats->opcodes[op]++;
+        if (fp != NULL)
+        {
+            fprintf(fp, "%*s", depth*4, "");
+            switch (op)
+            {
+                case G_VTX:           fprintf(fp, "gsSPVertex(%p, %u, %u)\n", (void*)w1, _SHIFTR(w0, 12, 8), _SHIFTR(w0, 1, 7) - _SHIFTR(w0, 12, 8)); break;
+                case G_CULLDL:        fprintf(fp, "gsSPCullDisplayList(%u, %u)\n", _SHIFTR(w0, 0, 16)/2, (u32)(w1/2)); break;
+                case G_TRI1:          fprintf(fp, "gsSP1Triangle(%u, %u, %u, 0)\n", _SHIFTR(w0, 16, 8)/2, _SHIFTR(w0, 8, 8)/2, _SHIFTR(w0, 0, 8)/2); break;
+                case G_TRI2:          fprintf(fp, "gsSP2Triangles(%u, %u, %u, 0, %u, %u, %u, 0)\n", _SHIFTR(w0, 16, 8)/2, _SHIFTR(w0, 8, 8)/2, _SHIFTR(w0, 0, 8)/2, _SHIFTR(w1, 16, 8)/2, _SHIFTR(w1, 8, 8)/2, _SHIFTR(w1, 0, 8)/2); break;
+                case G_DL:            fprintf(fp, "gsSPDisplayList(%p)\n", (void*)w1); break;
+                case G_ENDDL:         fprintf(fp, "gsSPEndDisplayList()\n"); break;
+                case G_POPMTX:        fprintf(fp, "gsSPPopMatrix(G_MTX_MODELVIEW)\n"); break;
+                case G_GEOMETRYMODE:  fprintf(fp, "gsSPGeometryMode(0x%08X, 0x%08X)\n", ~_SHIFTR(w0, 0, 24) & 0xFFFFFF, (u32)w1); break;
+                case G_SETOTHERMODE_H:
+                case G_SETOTHERMODE_L: fprintf(fp, "gsSPSetOtherMode(0x%02X, %u, %u, 0x%08X)\n", op, 32 - _SHIFTR(w0, 8, 8) - (_SHIFTR(w0, 0, 8)+1), _SHIFTR(w0, 0, 8)+1, (u32)w1); break;
+                case G_RDPPIPESYNC:   fprintf(fp, "gsDPPipeSync()\n"); break;
+                case G_RDPLOADSYNC:   fprintf(fp, "gsDPLoadSync()\n"); break;
+                case G_SETPRIMCOLOR:  fprintf(fp, "gsDPSetPrimColor(%u, %u, %u, %u, %u, %u)\n", _SHIFTR(w0, 8, 8), _SHIFTR(w0, 0, 8), _SHIFTR(w1, 24, 8), _SHIFTR(w1, 16, 8), _SHIFTR(w1, 8, 8), _SHIFTR(w1, 0, 8)); break;
+                case G_SETCOMBINE:    fprintf(fp, "gsDPSetCombine(0x%06X, 0x%08X)\n", _SHIFTR(w0, 0, 24), (u32)w1); break;
+                case G_SETTIMG:       fprintf(fp, "gsDPSetTextureImage(%u, %u, %u, %p)\n", _SHIFTR(w0, 21, 3), _SHIFTR(w0, 19, 2), _SHIFTR(w0, 0, 12)+1, (void*)w1); break;
+                case G_SETTILE:       fprintf(fp, "gsDPSetTile(%u, %u, %u, %u, %u, ...)\n", _SHIFTR(w0, 21, 3), _SHIFTR(w0, 19, 2), _SHIFTR(w0, 9, 9), _SHIFTR(w0, 0, 9), _SHIFTR(w1, 24, 3)); break;
+                case G_LOADBLOCK:     fprintf(fp, "gsDPLoadBlock(%u, 0, 0, %u, %u)\n", _SHIFTR(w1, 24, 3), _SHIFTR(w1, 12, 12), _SHIFTR(w1, 0, 12)); break;
+                case G_SETTILESIZE:   fprintf(fp, "gsDPSetTileSize(%u, 0, 0, %u, %u)\n", _SHIFTR(w1, 24, 3), _SHIFTR(w1, 12, 12), _SHIFTR(w1, 0, 12)); break;
+                case G_MTX:
+                {
+                    f32 mf[4][4];
+                    guMtxL2F(mf, (Mtx*)w1);
+                    fprintf(fp, "gsSPMatrix(%p, %s | %s) pos = {%.3f, %.3f, %.3f}\n", (void*)w1,
+                        (_SHIFTR(w0, 0, 8) & G_MTX_LOAD) ? "G_MTX_LOAD" : "G_MTX_MUL",
+                        ((_SHIFTR(w0, 0, 8) ^ G_MTX_PUSH) & G_MTX_PUSH) ? "G_MTX_PUSH" : "G_MTX_NOPUSH",
+                        mf[3][0], mf[3][1], mf[3][2]
+                    );
+                    break;
+                }
+                default:              fprintf(fp, "Unknown command 0x%08X 0x%08lX\n", w0, (unsigned long)w1); break;
+            }
+        }
+
+        // Follow calls and branches
+        if (op == G_DL)
+        {
+            s64host_walkgfx((const Gfx*)w1, stats, fp, depth+1);
+            if (_SHIFTR(w0, 16, 8) == G_DL_NOPUSH)
+                return;
+        }
+        else if (op == G_ENDDL)
+            return;
+        dl++;
+    }
+}
+
+
+/*==============================
+    s64host_gfxstats
+    Walks a display list, following any display lists
+    it calls, and counts the commands in it
+    @param The display list to walk
+    @param The stats struct to fill
+==============================*/
+
+void s64host_gfxstats(const Gfx* dl, s64HostGfxStats* stats)
+{
+    memset(stats, 0, sizeof(s64HostGfxStats));
+    s64host_walkgfx(dl, stats, NULL, 0);
+}
+
+
+/*==============================
+    s64host_printgfx
+    Prints a display list in a human readable form,
+    following any display lists it calls
+    @param The file to print to
+    @param The display list to print
+==============================*/
+
+void s64host_printgfx(FILE* fp, const Gfx* dl)
+{
+    s64HostGfxStats stats;
+    memset(&stats, 0, sizeof(s64HostGfxStats));
+    s64host_walkgfx(dl, &stats, fp, 0);
+}
+
+#else
+
+/*********************************
+        Libdragon Functions
+*********************************/
+
+/*==============================
+    s64host_setasset
+    Makes asset_load return a copy of the given data,
+    instead of reading from disk, for the given path
+    @param The path of the asset
+    @param The asset's data, in host byte order
+    @param The size of the asset's data
+==============================*/
+
+void s64host_setasset(const char* path, u8* data, u32 size)
+{
+    s64host_assetname = path;
+    s64host_assetdata = data;
+    s64host_assetsize = size;
+}
+
+void* asset_load(const char* fn, int* sz)
+{
+    u32 size = 0;
+    u8* data;
+    if (s64host_assetname != NULL && strcmp(fn, s64host_assetname) == 0)
+    {
+        data = (u8*)malloc(s64host_assetsize);
+        if (data != NULL)
+            memcpy(data, s64host_assetdata, s64host_assetsize);
+        if (sz != NULL)
+            *sz = (int)s64host_assetsize;
+        return data;
+    }
+    if (strncmp(fn, "rom:/", 5) == 0)
+        fn += 5;
+    data = s64host_readmodel(fn, &size);
+    if (sz != NULL)
+        *sz = (int)size;
+    return data;
+}
+
+
+/*********************************
+         OpenGL Recording
+*********************************/
+
+/*==============================
+    s64host_glrecord
+    Adds an OpenGL call to the recording
+    @param  The name of the function
+    @param  The first argument
+    @param  The second argument
+    @param  The third argument
+    @param  The fourth argument
+    @return The recorded call
+==============================*/
+
+static s64HostGLCall* s64host_glrecord(const char* name, f64 a, f64 b, f64 c, f64 d)
+{
+    s64HostGLCall* call;
+    if (s64host_callcount == s64host_callsize)
+    {
+        s64HostGLCall* grown;
+        const u32 newsize = (s64host_callsize == 0) ? 256 : s64host_callsize*2;
+        grown = (s64HostGLCall*)realloc(s64host_calls, sizeof(s64HostGLCall)*newsize);
+        if (grown == NULL)
+            return NULL;
+        s64host_calls = grown;
+        s64host_callsize = newsize;
+    }
+    call = &s64host_calls[s64host_callcount++];
+    memset(call, 0, sizeof(s64HostGLCall));
+    call->name = name;
+    call->args[0] = a;
+    call->args[1] = b;
+    call->args[2] = c;
+    call->args[3] = d;
+    return call;
+}
+
+void glEnable(GLenum cap)                { s64host_glrecord("glEnable", cap, 0, 0, 0); }
+void glDisable(GLenum cap)               { s64host_glrecord("glDisable", cap, 0, 0, 0); }
+void glEnableClientState(GLenum array)   { s64host_glrecord("glEnableClientState", array, 0, 0, 0); }
+void glDisableClientState(GLenum array)  { s64host_glrecord("glDisableClientState", array, 0, 0, 0); }
+void glCullFace(GLenum mode)             { s64host_glrecord("glCullFace", mode, 0, 0, 0); }
+void glShadeModel(GLenum mode)           { s64host_glrecord("glShadeModel", mode, 0, 0, 0); }
+void glPushMatrix(void)                  { s64host_glrecord("glPushMatrix", 0, 0, 0, 0); }
+void glPopMatrix(void)                   { s64host_glrecord("glPopMatrix", 0, 0, 0, 0); }
+void glTranslatef(GLfloat x, GLfloat y, GLfloat z) { s64host_glrecord("glTranslatef", x, y, z, 0); }
+void glScalef(GLfloat x, GLfloat y, GLfloat z)     { s64host_glrecord("glScalef", x, y, z, 0); }
+void glBindTexture(GLenum target, GLuint texture)  { s64host_glrecord("glBindTexture", target, texture, 0, 0); }
+void glTexParameteri(GLenum target, GLenum pname, GLint param) { s64host_glrecord("glTexParameteri", target, pname, param, 0); }
+void glBindBufferARB(GLenum target, GLuint buffer) { s64host_glrecord("glBindBufferARB", target, buffer, 0, 0); }
+void glCallList(GLuint list)             { s64host_glrecord("glCallList", list, 0, 0, 0); }
+void glNewList(GLuint list, GLenum mode) { s64host_glrecord("glNewList", list, mode, 0, 0); }
+void glEndList(void)                     { s64host_glrecord("glEndList", 0, 0, 0, 0); }
+void glDeleteLists(GLuint list, GLsizei range) { s64host_glrecord("glDeleteLists", list, range, 0, 0); }
+
+void glMaterialfv(GLenum face, GLenum pname, const GLfloat* params)
+{
+    s64HostGLCall* call = s64host_glrecord("glMaterialfv", face, pname, 0, 0);
+    if (call != NULL)
+        memcpy(call->matrix, params, sizeof(GLfloat)*4);
+}
+
+void glMultMatrixf(const GLfloat* m)
+{
+    s64HostGLCall* call = s64host_glrecord("glMultMatrixf", 0, 0, 0, 0);
+    if (call != NULL)
+        memcpy(call->matrix, m, sizeof(GLfloat)*16);
+}
+
+void glGenTextures(GLsizei n, GLuint* textures)
+{
+    GLsizei i;
+    for (i=0; i<n; i++)
+        textures[i] = ++s64host_lasttexture;
+    s64host_glrecord("glGenTextures", n, 0, 0, 0);
+}
+
+void glDeleteTextures(GLsizei n, const GLuint* textures)
+{
+    s64host_glrecord("glDeleteTextures", n, (n > 0) ? textures[0] : 0, 0, 0);
+}
+
+void glSpriteTextureN64(GLenum target, sprite_t* sprite, rdpq_texparms_t* texparms)
+{
+    s64host_glrecord("glSpriteTextureN64", target, (sprite != NULL) ? sprite->width : 0, texparms->s.mirror, texparms->t.mirror);
+}
+
+void glGenBuffersARB(GLsizei n, GLuint* buffers)
+{
+    GLsizei i;
+    for (i=0; i<n; i++)
+        buffers[i] = ++s64host_lastbuffer;
+    s64host_glrecord("glGenBuffersARB", n, 0, 0, 0);
+}
+
+void glDeleteBuffersARB(GLsizei n, const GLuint* buffers)
+{
+    s64host_glrecord("glDeleteBuffersARB", n, (n > 0) ? buffers[0] : 0, 0, 0);
+}
+
+void glBufferDataARB(GLenum target, GLsizeiptrARB size, const GLvoid* data, GLenum usage)
+{
+    (void)data;
+    s64host_glrecord("glBufferDataARB", target, size, usage, 0);
+}
+
+void glVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    s64host_glrecord("glVertexPointer", size, type, stride, (f64)(uintptr_t)pointer);
+}
+
+void glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    s64host_glrecord("glTexCoordPointer", size, type, stride, (f64)(uintptr_t)pointer);
+}
+
+void glNormalPointer(GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    s64host_glrecord("glNormalPointer", type, stride, (f64)(uintptr_t)pointer, 0);
+}
+
+void glColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    s64host_glrecord("glColorPointer", size, type, stride, (f64)(uintptr_t)pointer);
+}
+
+void glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices)
+{
+    s64host_glrecord("glDrawElements", mode, count, type, (f64)(uintptr_t)indices);
+}
+
+GLuint glGenLists(GLsizei range)
+{
+    const GLuint first = s64host_lastlist + 1;
+    s64host_lastlist += range;
+    s64host_glrecord("glGenLists", range, 0, 0, 0);
+    return first;
+}
+
+
+/*==============================
+    s64host_glcalls
+    Returns the list of OpenGL calls recorded since
+    the last call to s64host_glreset
+    @param  A pointer to store the number of calls in
+    @return The recorded calls
+==============================*/
+
+const s64HostGLCall* s64host_glcalls(u32* count)
+{
+    *count = s64host_callcount;
+    return s64host_calls;
+}
+
+
+/*==============================
+    s64host_printgl
+    Prints the recorded OpenGL calls in a human
+    readable form
+    @param The file to print to
+==============================*/
+
+void s64host_printgl(FILE* fp)
+{
+    u32 i;
+    for (i=0; i<s64host_callcount; i++)
+    {
+        const s64HostGLCall* call = &s64host_calls[i];
+        if (strcmp(call->name, "glMultMatrixf") == 0)
+            fprintf(fp, "%s() pos = {%.3f, %.3f, %.3f}\n", call->name, call->matrix[12], call->matrix[13], call->matrix[14]);
+        else
+            fprintf(fp, "%s(%g, %g, %g, %g)\n", call->name, call->args[0], call->args[1], call->args[2], call->args[3]);
+    }
+}
+
+
+/*==============================
+    s64host_glreset
+    Clears the list of recorded OpenGL calls
+==============================*/
+
+void s64host_glreset()
+{
+    s64host_callcount = 0;
+}
+
+#endif
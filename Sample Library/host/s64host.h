@@ -0,0 +1,144 @@
+#ifndef SAUSAGE64_HOST_H
+#define SAUSAGE64_HOST_H
+
+    #include <stdio.h>
+    #include "../sausage64.h"
+
+    #ifdef LIBDRAGON
+        #ifndef TRUE
+            #define TRUE 1
+        #endif
+        #ifndef FALSE
+            #define FALSE 0
+        #endif
+    #endif
+
+
+    /*********************************
+                 Structs
+    *********************************/
+
+    #ifndef LIBDRAGON
+        typedef struct {
+            u32 commands;
+            u32 bytes;
+            u32 depth;
+            u32 opcodes[256];
+        } s64HostGfxStats;
+    #else
+        typedef struct {
+            const char* name;
+            f64 args[4];
+            f32 matrix[16];
+        } s64HostGLCall;
+    #endif
+
+
+    /*********************************
+                Functions
+    *********************************/
+
+    /*==============================
+        s64host_readmodel
+        Reads a binary model exported by Arabiki64, and swaps
+        its contents from the N64's big endian to the host's
+        byte order, so that the library can read it
+        @param  The path of the file to read
+        @param  A pointer to store the size of the file in
+        @return The malloc'd file data, or NULL
+    ==============================*/
+
+    extern u8* s64host_readmodel(const char* path, u32* size);
+
+    #ifndef LIBDRAGON
+        /*==============================
+            s64host_setrom
+            Sets the buffer that osPiStartDma will read from
+            @param The ROM data
+            @param The size of the ROM data
+        ==============================*/
+
+        extern void s64host_setrom(u8* data, u32 size);
+
+
+        /*==============================
+            s64host_gfxstats
+            Walks a display list, following any display lists
+            it calls, and counts the commands in it
+            @param The display list to walk
+            @param The stats struct to fill
+        ==============================*/
+
+        extern void s64host_gfxstats(const Gfx* dl, s64HostGfxStats* stats);
+
+
+        /*==============================
+            s64host_printgfx
+            Prints a display list in a human readable form,
+            following any display lists it calls
+            @param The file to print to
+            @param The display list to print
+        ==============================*/
+
+        extern void s64host_printgfx(FILE* fp, const Gfx* dl);
+
+
+        /*==============================
+            s64host_gfxemitted
+            Returns how many Gfx commands were written since
+            the last call to s64host_gfxreset
+            @return The number of Gfx commands written
+        ==============================*/
+
+        extern u32 s64host_gfxemitted();
+
+
+        /*==============================
+            s64host_gfxreset
+            Resets the counter of written Gfx commands
+        ==============================*/
+
+        extern void s64host_gfxreset();
+    #else
+        /*==============================
+            s64host_setasset
+            Makes asset_load return a copy of the given data,
+            instead of reading from disk, for the given path
+            @param The path of the asset
+            @param The asset's data, in host byte order
+            @param The size of the asset's data
+        ==============================*/
+
+        extern void s64host_setasset(const char* path, u8* data, u32 size);
+
+
+        /*==============================
+            s64host_glcalls
+            Returns the list of OpenGL calls recorded since
+            the last call to s64host_glreset
+            @param  A pointer to store the number of calls in
+            @return The recorded calls
+        ==============================*/
+
+        extern const s64HostGLCall* s64host_glcalls(u32* count);
+
+
+        /*==============================
+            s64host_printgl
+            Prints the recorded OpenGL calls in a human
+            readable form
+            @param The file to print to
+        ==============================*/
+
+        extern void s64host_printgl(FILE* fp);
+
+
+        /*==============================
+            s64host_glreset
+            Clears the list of recorded OpenGL calls
+        ==============================*/
+
+        extern void s64host_glreset();
+    #endif
+
+#endif
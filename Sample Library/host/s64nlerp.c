@@ -0,0 +1,173 @@
+/***************************************************************
+                           s64nlerp.c
+
+Checks how far Sausage64's normalized lerp drifts from a true
+slerp. Random pairs of rotations are swept from 0 to 180
+degrees apart, and the largest angle between the two results
+is compared against the limits given in the README. Build it
+with S64_NLERP_CORRECTION defined to check the corrected
+version instead. Returns 1 if a limit was exceeded.
+***************************************************************/
+
+#include <math.h>
+#include "s64host.h"
+
+// The interpolation function is static, so the library is built into this program
+#include "../sausage64.c"
+
+
+/*********************************
+              Macros
+*********************************/
+
+#define PAIRS     2000
+#define FRACTIONS 64
+#define ANGLES    4
+
+
+/*********************************
+             Globals
+*********************************/
+
+static u32 global_seed = 1;
+
+// The largest angle between the two rotations in each band, and the error allowed in it (in degrees)
+static const f64 global_angles[ANGLES] = {45, 90, 135, 180};
+#ifndef S64_NLERP_CORRECTION
+    static const f64 global_limits[ANGLES] = {0.15, 1.0, 3.5, 8.5};
+#else
+    static const f64 global_limits[ANGLES] = {0.1, 0.1, 0.1, 0.1};
+#endif
+
+
+/*==============================
+    randf
+    Returns a random number between -1 and 1
+    @return The random number
+==============================*/
+
+static f64 randf()
+{
+    global_seed = global_seed*1103515245 + 12345;
+    return ((global_seed>>8) & 0xFFFF)/32767.5 - 1.0;
+}
+
+
+/*==============================
+    randaxis
+    Returns a random unit length axis
+    @param The array to store the axis in
+==============================*/
+
+static void randaxis(f64 axis[3])
+{
+    f64 len;
+    do
+    {
+        axis[0] = randf();
+        axis[1] = randf();
+        axis[2] = randf();
+        len = sqrt(axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2]);
+    }
+    while (len < 0.01 || len > 1);
+    axis[0] /= len;
+    axis[1] /= len;
+    axis[2] /= len;
+}
+
+
+/*==============================
+    fromaxis
+    Calculates the quaternion of a rotation around an axis
+    @param The quaternion to store the result in
+    @param The axis to rotate around
+    @param The angle to rotate by, in radians
+==============================*/
+
+static void fromaxis(f64 out[4], const f64 axis[3], f64 angle)
+{
+    const f64 s = sin(angle/2);
+    out[0] = cos(angle/2);
+    out[1] = axis[0]*s;
+    out[2] = axis[1]*s;
+    out[3] = axis[2]*s;
+}
+
+
+/*==============================
+    mul
+    Multiplies two quaternions in double precision
+    @param The quaternion to store the result in
+    @param The first quaternion
+    @param The second quaternion
+==============================*/
+
+static void mul(f64 out[4], const f64 a[4], const f64 b[4])
+{
+    out[0] = a[0]*b[0] - a[1]*b[1] - a[2]*b[2] - a[3]*b[3];
+    out[1] = a[0]*b[1] + a[1]*b[0] + a[2]*b[3] - a[3]*b[2];
+    out[2] = a[0]*b[2] - a[1]*b[3] + a[2]*b[0] + a[3]*b[1];
+    out[3] = a[0]*b[3] + a[1]*b[2] - a[2]*b[1] + a[3]*b[0];
+}
+
+
+/*==============================
+    main
+    Program entrypoint
+    @param  The number of extra arguments
+    @param  An array with the arguments
+    @return 0 if every error was within its limit
+==============================*/
+
+int main(int argc, char* argv[])
+{
+    f64 maxerror[ANGLES] = {0};
+    int failed = 0;
+
+    #ifndef S64_NLERP_CORRECTION
+        printf("Normalized lerp error against slerp (without S64_NLERP_CORRECTION)\n");
+    #else
+        printf("Normalized lerp error against slerp (with S64_NLERP_CORRECTION)\n");
+    #endif
+
+    // Interpolate between random rotations, with the second one rotated away from the first around a random axis
+    for (int i=0; i<PAIRS; i++)
+    {
+        f64 axis[3], a[4], b[4], step[4];
+        const f64 angle = M_PI*(i+1)/(PAIRS+1);
+        const int band = (int)ceil(angle*180/M_PI/(180.0/ANGLES)) - 1;
+        s64Quat qa, qb;
+        randaxis(axis);
+        fromaxis(a, axis, M_PI*randf());
+        randaxis(axis);
+        fromaxis(step, axis, angle);
+        mul(b, step, a);
+        qa = (s64Quat){a[0], a[1], a[2], a[3]};
+        qb = (s64Quat){b[0], b[1], b[2], b[3]};
+
+        // Compare every fraction against the exact slerp, which is just a partial rotation around the same axis
+        for (int j=0; j<=FRACTIONS; j++)
+        {
+            const f64 f = ((f64)j)/FRACTIONS;
+            f64 exact[4], dot, error;
+            s64Quat result = s64slerp(qa, qb, f);
+            fromaxis(step, axis, angle*f);
+            mul(exact, step, a);
+            dot = fabs(result.w*exact[0] + result.x*exact[1] + result.y*exact[2] + result.z*exact[3]);
+            error = 2*acos(dot > 1 ? 1 : dot)*180/M_PI;
+            if (error > maxerror[band])
+                maxerror[band] = error;
+        }
+    }
+
+    // Print the results
+    printf("  up to deg    max error deg    limit deg\n");
+    for (int i=0; i<ANGLES; i++)
+    {
+        const int ok = (maxerror[i] <= global_limits[i]);
+        printf("%11.0f %16.4f %12.2f   %s\n", global_angles[i], maxerror[i], global_limits[i], ok ? "ok" : "FAILED");
+        if (!ok)
+            failed = 1;
+    }
+    return failed;
+}
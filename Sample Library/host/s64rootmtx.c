@@ -0,0 +1,275 @@
+/***************************************************************
+                          s64rootmtx.c
+
+Checks that drawing a Libultra model with a root matrix (where
+the library composes each mesh's matrix on the CPU and loads
+it with G_MTX_LOAD) puts every mesh in the same place as the
+regular path, where the RSP multiplies each mesh's matrix onto
+the root. Both display lists are run through a matrix stack in
+double precision, and the resulting matrix for every mesh is
+compared. Returns 1 if they differ by more than the limit.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "s64host.h"
+
+
+/*********************************
+              Macros
+*********************************/
+
+#define MAXTEXTURES 256
+#define MAXMESHES   256
+#define GFXSIZE     (16*1024)
+#define STACKSIZE   18
+#define FRAMES      16
+#define TICKS       3.5f
+
+// The largest difference allowed between both paths, as a fraction of the largest element in the matrix
+#define LIMIT       (4.0/65536.0)
+
+
+/*==============================
+    mtx_mul
+    Multiplies two matrices in double precision
+    @param The matrix to store the result in
+    @param The first matrix
+    @param The second matrix
+==============================*/
+
+static void mtx_mul(f64 out[4][4], f64 a[4][4], f64 b[4][4])
+{
+    int i, j;
+    f64 temp[4][4];
+    for (i=0; i<4; i++)
+        for (j=0; j<4; j++)
+            temp[i][j] = a[i][0]*b[0][j] + a[i][1]*b[1][j] + a[i][2]*b[2][j] + a[i][3]*b[3][j];
+    memcpy(out, temp, sizeof(temp));
+}
+
+
+/*==============================
+    mtx_fromfixed
+    Converts an s15.16 matrix to double precision
+    @param The matrix to store the result in
+    @param The matrix to convert
+==============================*/
+
+static void mtx_fromfixed(f64 out[4][4], const Mtx* m)
+{
+    int i, j;
+    const u16* integer = (const u16*)m;
+    const u16* fraction = ((const u16*)m) + 16;
+    for (i=0; i<4; i++)
+        for (j=0; j<4; j++)
+            out[i][j] = ((s32)(((u32)integer[i*4 + j] << 16) | fraction[i*4 + j]))/65536.0;
+}
+
+
+/*==============================
+    run_matrices
+    Runs the matrix commands of a model's display list,
+    and stores the modelview matrix that each mesh's
+    display list was called with
+    @param  The display list to run
+    @param  The root modelview matrix
+    @param  The array to store each mesh's matrix in
+    @return The number of meshes found, or -1 if the
+            matrix stack over or underflowed
+==============================*/
+
+static int run_matrices(const Gfx* dl, f64 root[4][4], f64 out[][4][4])
+{
+    f64 stack[STACKSIZE][4][4];
+    int depth = 0, count = 0;
+    memcpy(stack[0], root, sizeof(stack[0]));
+    for (; (dl->words.w0 >> 24) != G_ENDDL; dl++)
+    {
+        const u32 opcode = dl->words.w0 >> 24;
+        const u32 params = dl->words.w0 & 0xFF;
+        if (opcode == G_MTX)
+        {
+            f64 m[4][4];
+            mtx_fromfixed(m, (const Mtx*)dl->words.w1);
+
+            // The push flag is stored inverted
+            if (!(params & G_MTX_PUSH))
+            {
+                if (depth+1 == STACKSIZE)
+                    return -1;
+                memcpy(stack[depth+1], stack[depth], sizeof(stack[0]));
+                depth++;
+            }
+            if (params & G_MTX_LOAD)
+                memcpy(stack[depth], m, sizeof(m));
+            else
+                mtx_mul(stack[depth], m, stack[depth]);
+        }
+        else if (opcode == G_POPMTX)
+        {
+            if (depth == 0)
+                return -1;
+            depth--;
+        }
+        else if (opcode == G_DL && count < MAXMESHES)
+            memcpy(out[count++], stack[depth], sizeof(stack[0]));
+    }
+    return (depth == 0) ? count : -1;
+}
+
+
+/*==============================
+    draw_both
+    Draws the model with and without the root matrix,
+    and returns the largest difference between the
+    matrices that each mesh was drawn with
+    @param  The model helper to draw
+    @param  The root matrix, in fixed point
+    @param  The display list buffer to use
+    @return The largest relative difference, or a
+            negative number if the draws didn't match
+==============================*/
+
+static f64 draw_both(s64ModelHelper* helper, Mtx* rootfixed, Gfx* glist)
+{
+    static f64 mul[MAXMESHES][4][4];
+    static f64 load[MAXMESHES][4][4];
+    f64 root[4][4], maxerror = 0;
+    int i, j, k, mulcount, loadcount;
+    Gfx* glistp;
+    mtx_fromfixed(root, rootfixed);
+
+    // Draw the model on top of the root matrix, with the RSP doing the multiplication
+    glistp = glist;
+    sausage64_set_rootmatrix(helper, NULL);
+    sausage64_drawmodel(&glistp, helper);
+    gSPEndDisplayList(glistp++);
+    mulcount = run_matrices(glist, root, mul);
+
+    // Then with the matrices composed on the CPU
+    glistp = glist;
+    sausage64_set_rootmatrix(helper, rootfixed);
+    sausage64_drawmodel(&glistp, helper);
+    gSPEndDisplayList(glistp++);
+    loadcount = run_matrices(glist, root, load);
+    if (mulcount < 0 || loadcount < 0 || mulcount != loadcount)
+        return -1;
+
+    // Compare them
+    for (i=0; i<mulcount; i++)
+    {
+        f64 largest = 1;
+        for (j=0; j<4; j++)
+            for (k=0; k<4; k++)
+                if (fabs(mul[i][j][k]) > largest)
+                    largest = fabs(mul[i][j][k]);
+        for (j=0; j<4; j++)
+        {
+            for (k=0; k<4; k++)
+            {
+                const f64 error = fabs(mul[i][j][k] - load[i][j][k])/largest;
+                if (error > maxerror)
+                    maxerror = error;
+            }
+        }
+    }
+    return maxerror;
+}
+
+
+/*==============================
+    main
+    Program entrypoint
+    @param  The number of extra arguments
+    @param  An array with the arguments
+    @return 0 if both paths matched
+==============================*/
+
+int main(int argc, char* argv[])
+{
+    int i;
+    u16 anim;
+    u32 size;
+    u8* rom;
+    f32 rootf[4][4];
+    int failed = 0;
+    static u8 texturedata[4096];
+    static u32* textures[MAXTEXTURES];
+    static Mtx root;
+    s64ModelData* mdl;
+    s64ModelHelper* helper;
+    Gfx* glist;
+    if (argc < 2)
+    {
+        printf("Usage: %s <model.bin>\n", argv[0]);
+        return 1;
+    }
+
+    // Load the model
+    for (i=0; i<MAXTEXTURES; i++)
+        textures[i] = (u32*)texturedata;
+    rom = s64host_readmodel(argv[1], &size);
+    if (rom == NULL)
+    {
+        printf("Unable to read '%s'\n", argv[1]);
+        return 1;
+    }
+    s64host_setrom(rom, size);
+    mdl = sausage64_load_binarymodel(0, size, textures);
+    helper = (mdl != NULL) ? sausage64_inithelper(mdl) : NULL;
+    if (helper == NULL)
+    {
+        printf("Unable to load '%s'\n", argv[1]);
+        return 1;
+    }
+    glist = (Gfx*)malloc(sizeof(Gfx)*GFXSIZE);
+
+    // A root matrix that rotates, scales and moves the model away from the camera, like a model matrix multiplied by a view would
+    {
+        const f32 c1 = cosf(0.6f), s1 = sinf(0.6f), c2 = cosf(-0.35f), s2 = sinf(-0.35f), scale = 0.75f;
+        const f32 temp[4][4] = {
+            { c1*scale,     0,           -s1*scale,     0},
+            {-s1*s2*scale,  c2*scale,    -c1*s2*scale,  0},
+            { s1*c2*scale,  s2*scale,     c1*c2*scale,  0},
+            { 120,         -45,          -650,          1},
+        };
+        memcpy(rootf, temp, sizeof(temp));
+        guMtxF2L(rootf, &root);
+    }
+
+    // Compare both paths on every animation
+    printf("Root matrix (G_MTX_LOAD) against multiplying on the RSP (G_MTX_MUL)\n");
+    printf("  animation        max difference      limit\n");
+    for (anim=0; anim<mdl->animcount; anim++)
+    {
+        u32 frame;
+        f64 animerror = 0;
+        sausage64_set_anim(helper, anim);
+        for (frame=0; frame<FRAMES; frame++)
+        {
+            const f64 error = draw_both(helper, &root, glist);
+            if (error < 0)
+            {
+                printf("  %-12s  The matrix stack or mesh count didn't match\n", mdl->anims[anim].name);
+                failed = 1;
+                break;
+            }
+            if (error > animerror)
+                animerror = error;
+            sausage64_advance_anim(helper, TICKS);
+        }
+        printf("  %-12s %16.8f %10.8f   %s\n", mdl->anims[anim].name, animerror, LIMIT, (animerror <= LIMIT) ? "ok" : "FAILED");
+        if (animerror > LIMIT)
+            failed = 1;
+    }
+
+    // Cleanup
+    free(glist);
+    free(rom);
+    sausage64_freehelper(helper);
+    sausage64_unload_binarymodel(mdl);
+    return failed;
+}
@@ -0,0 +1,753 @@
+/***************************************************************
+                           s64sim.c
+
+Loads a binary model exported by Arabiki64 with the Libultra
+version of the Sausage64 library, draws it, and interprets the
+resulting display list like F3DEX2 and the RDP would. It checks
+vertex cache usage, tracks RDP state and TMEM to find redundant
+commands and texture loads, and estimates how many cycles each
+mesh costs. The output doesn't change between runs, so it can
+be diffed to check the effect of changes to Arabiki64.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "s64host.h"
+
+
+/*********************************
+              Macros
+*********************************/
+
+#define MAXTEXTURES  256
+#define MAXCACHE     64
+#define MAXTMEMLOADS 64
+#define MAXERRORS    20
+#define TMEMSIZE     4096
+#define DLSTACKSIZE  18
+#define MTXSTACKSIZE 16
+#define GFXSIZE      (64*1024)
+
+// Keys for tracking state that's set by a single command
+#define STATEKEY_TILE     256
+#define STATEKEY_TILESIZE (256+8)
+#define STATEKEY_COUNT    (256+16)
+
+
+/*********************************
+              Enums
+*********************************/
+
+typedef enum {
+    COST_RSP_COMMAND,
+    COST_RSP_VERTEX,
+    COST_RSP_TRIANGLE,
+    COST_RSP_MATRIX,
+    COST_RSP_DL,
+    COST_RDP_COMMAND,
+    COST_RDP_TRIANGLE,
+    COST_RDP_SYNC,
+    COST_RDP_LOAD,
+    COST_RDP_LOADWORD,
+    COST_COUNT
+} CostType;
+
+
+/*********************************
+             Structs
+*********************************/
+
+typedef struct {
+    const char* name;
+    const char* desc;
+    u32 cycles;
+} SimCost;
+
+typedef struct {
+    u8 loaded;
+    u8 used;
+    uintptr_t source;
+} SimVertex;
+
+typedef struct {
+    u32 tmem;
+    u32 bytes;
+    u32 w0;
+    uintptr_t w1;
+    uintptr_t source;
+} SimTexLoad;
+
+typedef struct {
+    u32 commands;
+    u32 vtxloads;
+    u32 verts;
+    u32 redundantverts;
+    u32 unusedverts;
+    u32 tris;
+    u32 degenerate;
+    u32 statecmds;
+    u32 redundantstate;
+    u32 syncs;
+    u32 redundantsyncs;
+    u32 texloads;
+    u32 texbytes;
+    u32 redundantloads;
+    u32 errors;
+    u32 rspcycles;
+    u32 rdpcycles;
+} SimStats;
+
+
+/*********************************
+             Globals
+*********************************/
+
+// Rough estimates, meant for comparing display lists against each other. Override them with -k.
+static SimCost global_costs[COST_COUNT] = {
+    {"rsp_command",  "Fetching and decoding any command", 10},
+    {"rsp_vertex",   "Transforming and lighting a vertex", 40},
+    {"rsp_triangle", "Setting up a triangle", 60},
+    {"rsp_matrix",   "Loading and multiplying a matrix", 150},
+    {"rsp_dl",       "Calling or returning from a display list", 20},
+    {"rdp_command",  "Changing RDP state", 4},
+    {"rdp_triangle", "Triangle setup, not counting the pixels it covers", 40},
+    {"rdp_sync",     "Waiting for the RDP pipeline to drain", 50},
+    {"rdp_load",     "Starting a TMEM load", 30},
+    {"rdp_loadword", "Loading 8 bytes into TMEM", 1},
+};
+
+static u32 global_cachesize = 32;
+static u32 global_instances = 1;
+static u8  global_verbose = FALSE;
+
+static const s64ModelData* global_mdl;
+static SimStats* global_stats;
+static const char* global_meshname;
+static u32 global_cmdindex;
+static u32 global_errorcount;
+
+static SimVertex global_vtxcache[128];
+static SimTexLoad global_tmem[MAXTMEMLOADS];
+static u32 global_tmemcount;
+static u8  global_stateknown[STATEKEY_COUNT];
+static u32 global_statew0[STATEKEY_COUNT];
+static uintptr_t global_statew1[STATEKEY_COUNT];
+static u32 global_othermode[2], global_othermodeknown[2];
+static u32 global_geometry, global_geometryknown;
+static u8  global_drawnsincesync;
+static u32 global_mtxdepth;
+
+
+/*********************************
+         Helper Functions
+*********************************/
+
+/*==============================
+    show_help
+    Prints the program's usage
+==============================*/
+
+static void show_help(const char* name)
+{
+    u32 i;
+    printf("Usage: %s [options] <model.bin>\n", name);
+    printf("  -c <size>   Vertex cache size, matching Arabiki64's -c (default %u)\n", global_cachesize);
+    printf("  -n <count>  Number of times to draw the model in a row (default %u)\n", global_instances);
+    printf("  -k <file>   Read a cost table, with a 'name cycles' pair per line\n");
+    printf("  -v          Print every command that was emitted\n");
+    printf("Cost table entries:\n");
+    for (i=0; i<COST_COUNT; i++)
+        printf("  %-14s %4u  %s\n", global_costs[i].name, global_costs[i].cycles, global_costs[i].desc);
+}
+
+
+/*==============================
+    read_costs
+    Reads a cost table from a file
+    @param  The path of the file to read
+    @return Whether the file was read successfully
+==============================*/
+
+static u8 read_costs(const char* path)
+{
+    char line[256];
+    FILE* fp = fopen(path, "r");
+    if (fp == NULL)
+    {
+        printf("Unable to open cost table '%s'\n", path);
+        return FALSE;
+    }
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        u32 i, cycles;
+        char name[64];
+        if (line[0] == '#' || sscanf(line, "%63s %u", name, &cycles) != 2)
+            continue;
+        for (i=0; i<COST_COUNT; i++)
+            if (!strcmp(name, global_costs[i].name))
+                break;
+        if (i == COST_COUNT)
+        {
+            printf("Unknown cost '%s' in '%s'\n", name, path);
+            fclose(fp);
+            return FALSE;
+        }
+        global_costs[i].cycles = cycles;
+    }
+    fclose(fp);
+    return TRUE;
+}
+
+
+/*==============================
+    sim_error
+    Reports a problem with the display list
+    @param The stats of the mesh being simulated
+    @param The message to print
+==============================*/
+
+static void sim_error(SimStats* stats, const char* message)
+{
+    stats->errors++;
+    global_errorcount++;
+    if (global_errorcount <= MAXERRORS)
+        printf("Error in '%s', command %u: %s\n", global_meshname, global_cmdindex, message);
+    else if (global_errorcount == MAXERRORS+1)
+        printf("Too many errors, the rest won't be printed\n");
+}
+
+
+/*==============================
+    sim_usevertex
+    Checks that a triangle can use a vertex cache slot
+    @param  The stats of the mesh being simulated
+    @param  The slot index
+    @return Whether the slot is valid
+==============================*/
+
+static u8 sim_usevertex(SimStats* stats, u32 index)
+{
+    char message[128];
+    if (index >= global_cachesize)
+    {
+        sprintf(message, "index %u is outside of the %u vertex cache", index, global_cachesize);
+        sim_error(stats, message);
+        return FALSE;
+    }
+    if (!global_vtxcache[index].loaded)
+    {
+        sprintf(message, "index %u uses a slot that was never loaded", index);
+        sim_error(stats, message);
+        return FALSE;
+    }
+    global_vtxcache[index].used = TRUE;
+    return TRUE;
+}
+
+
+/*==============================
+    sim_triangle
+    Simulates a triangle
+    @param The stats of the mesh being simulated
+    @param The word with the triangle's indices
+==============================*/
+
+static void sim_triangle(SimStats* stats, u32 word)
+{
+    const u32 a = _SHIFTR(word, 16, 8)/2, b = _SHIFTR(word, 8, 8)/2, c = _SHIFTR(word, 0, 8)/2;
+    u8 valid = sim_usevertex(stats, a);
+    valid = sim_usevertex(stats, b) && valid;
+    valid = sim_usevertex(stats, c) && valid;
+    if (valid && (a == b || b == c || a == c))
+        stats->degenerate++;
+    stats->tris++;
+    stats->rspcycles += global_costs[COST_RSP_TRIANGLE].cycles;
+    stats->rdpcycles += global_costs[COST_RDP_TRIANGLE].cycles;
+    global_drawnsincesync = TRUE;
+}
+
+
+/*==============================
+    sim_flushunused
+    Counts the vertices that were loaded but never used
+    @param The stats of the mesh being simulated
+==============================*/
+
+static void sim_flushunused(SimStats* stats)
+{
+    u32 i;
+    for (i=0; i<global_cachesize; i++)
+    {
+        if (global_vtxcache[i].loaded && !global_vtxcache[i].used)
+            stats->unusedverts++;
+        global_vtxcache[i].used = TRUE;
+    }
+}
+
+
+/*==============================
+    sim_state
+    Simulates a command which sets a piece of RDP state
+    in its entirety
+    @param The stats of the mesh being simulated
+    @param The key of the state being set
+    @param The command's first word
+    @param The command's second word
+==============================*/
+
+static void sim_state(SimStats* stats, u32 key, u32 w0, uintptr_t w1)
+{
+    if (global_stateknown[key] && global_statew0[key] == w0 && global_statew1[key] == w1)
+        stats->redundantstate++;
+    global_stateknown[key] = TRUE;
+    global_statew0[key] = w0;
+    global_statew1[key] = w1;
+}
+
+
+/*==============================
+    sim_maskedstate
+    Simulates a command which sets some bits of a word
+    @param The stats of the mesh being simulated
+    @param The state word
+    @param The mask of bits in the state word that are known
+    @param The bits that are kept
+    @param The bits that are set
+==============================*/
+
+static void sim_maskedstate(SimStats* stats, u32* state, u32* known, u32 keep, u32 set)
+{
+    const u32 newstate = (*state & keep) | set;
+    if ((*known | keep) == 0xFFFFFFFF && newstate == *state)
+        stats->redundantstate++;
+    *state = newstate;
+    *known |= ~keep;
+}
+
+
+/*==============================
+    sim_texload
+    Simulates loading a texture into TMEM
+    @param The stats of the mesh being simulated
+    @param The number of bytes loaded
+    @param The load command's first word
+    @param The load command's second word
+==============================*/
+
+static void sim_texload(SimStats* stats, u32 bytes, u32 w0, uintptr_t w1)
+{
+    u32 i, j;
+    const u32 tile = _SHIFTR(w1, 24, 3);
+    const u32 tmem = _SHIFTR(global_statew0[STATEKEY_TILE + tile], 0, 9)*8;
+    const uintptr_t source = global_statew1[G_SETTIMG];
+    if (!global_stateknown[G_SETTIMG] || !global_stateknown[STATEKEY_TILE + tile])
+        sim_error(stats, "texture load without a texture image or tile set");
+    if (tmem + bytes > TMEMSIZE)
+        sim_error(stats, "texture load overflows TMEM");
+    stats->texloads++;
+    stats->texbytes += bytes;
+    stats->rdpcycles += global_costs[COST_RDP_LOAD].cycles + ((bytes + 7)/8)*global_costs[COST_RDP_LOADWORD].cycles;
+
+    // Check if this exact load is still sitting in TMEM
+    for (i=0; i<global_tmemcount; i++)
+    {
+        const SimTexLoad* load = &global_tmem[i];
+        if (load->tmem == tmem && load->bytes == bytes && load->source == source && load->w0 == w0 && load->w1 == w1)
+        {
+            stats->redundantloads++;
+            return;
+        }
+    }
+
+    // Forget about any loads that this one overwrites
+    for (i=0, j=0; i<global_tmemcount; i++)
+        if (global_tmem[i].tmem >= tmem + bytes || global_tmem[i].tmem + global_tmem[i].bytes <= tmem)
+            global_tmem[j++] = global_tmem[i];
+    global_tmemcount = j;
+    if (global_tmemcount < MAXTMEMLOADS)
+    {
+        SimTexLoad* load = &global_tmem[global_tmemcount++];
+        load->tmem = tmem;
+        load->bytes = bytes;
+        load->w0 = w0;
+        load->w1 = w1;
+        load->source = source;
+    }
+}
+
+
+/*==============================
+    texel_bytes
+    Calculates how many bytes a number of texels takes up
+    @param  The texel size (G_IM_SIZ_*)
+    @param  The number of texels
+    @return The number of bytes
+==============================*/
+
+static u32 texel_bytes(u32 siz, u32 texels)
+{
+    if (siz == G_IM_SIZ_4b)
+        return (texels + 1)/2;
+    return texels << (siz - 1);
+}
+
+
+/*==============================
+    find_mesh
+    Finds which mesh a display list belongs to
+    @param  The display list
+    @return The mesh index, or -1
+==============================*/
+
+static s32 find_mesh(const Gfx* dl)
+{
+    u32 i, j;
+    for (i=0; i<global_mdl->meshcount; i++)
+    {
+        const s64Mesh* mesh = &global_mdl->meshes[i];
+        if (mesh->dl == dl)
+            return i;
+        for (j=0; j<mesh->lodcount; j++)
+            if (mesh->lods[j].dl == dl)
+                return i;
+    }
+    return -1;
+}
+
+
+/*********************************
+            Simulation
+*********************************/
+
+/*==============================
+    sim_walk
+    Interprets a display list, following any display
+    lists it calls
+    @param The display list to interpret
+    @param The index of the mesh being drawn, or the
+           mesh count if outside of a mesh
+    @param The current call depth
+==============================*/
+
+static void sim_walk(const Gfx* dl, u32 mesh, u32 depth)
+{
+    SimStats* stats = &global_stats[mesh];
+    global_meshname = (mesh < global_mdl->meshcount) ? global_mdl->meshes[mesh].name : "(model)";
+    while (1)
+    {
+        const u32 w0 = dl->words.w0;
+        const uintptr_t w1 = dl->words.w1;
+        const u8 op = _SHIFTR(w0, 24, 8);
+        global_cmdindex++;
+        stats->commands++;
+        stats->rspcycles += global_costs[COST_RSP_COMMAND].cycles;
+        switch (op)
+        {
+            case G_VTX:
+            {
+                u32 i, j;
+                const u32 count = _SHIFTR(w0, 12, 8), end = _SHIFTR(w0, 1, 7);
+                const u32 start = end - count;
+                stats->vtxloads++;
+                stats->verts += count;
+                stats->rspcycles += count*global_costs[COST_RSP_VERTEX].cycles;
+                if (count > end || end > global_cachesize)
+                {
+                    char message[128];
+                    sprintf(message, "loading %u vertices into slot %u overflows the %u vertex cache", count, start, global_cachesize);
+                    sim_error(stats, message);
+                    break;
+                }
+                for (i=0; i<count; i++)
+                {
+                    SimVertex* slot = &global_vtxcache[start + i];
+                    const uintptr_t source = w1 + i*sizeof(Vtx);
+                    if (slot->loaded && !slot->used)
+                        stats->unusedverts++;
+                    for (j=0; j<global_cachesize; j++)
+                        if (global_vtxcache[j].loaded && global_vtxcache[j].source == source)
+                            break;
+                    if (j < global_cachesize)
+                        stats->redundantverts++;
+                    slot->loaded = TRUE;
+                    slot->used = FALSE;
+                    slot->source = source;
+                }
+                break;
+            }
+            case G_TRI1:
+                sim_triangle(stats, w0);
+                break;
+            case G_TRI2:
+                sim_triangle(stats, w0);
+                sim_triangle(stats, (u32)w1);
+                break;
+            case G_CULLDL:
+            {
+                u32 i;
+                for (i=_SHIFTR(w0, 0, 16)/2; i<=w1/2; i++)
+                    if (!sim_usevertex(stats, i))
+                        break;
+                break;
+            }
+            case G_MTX:
+            {
+                u32 i;
+                stats->rspcycles += global_costs[COST_RSP_MATRIX].cycles;
+                if (!((_SHIFTR(w0, 0, 8) ^ G_MTX_PUSH) & G_MTX_PUSH))
+                    break;
+                if (++global_mtxdepth > MTXSTACKSIZE)
+                    sim_error(stats, "matrix stack overflow");
+
+                // Vertices loaded from now on get a new transform, so reloading them isn't redundant
+                for (i=0; i<global_cachesize; i++)
+                    global_vtxcache[i].source = 0;
+                break;
+            }
+            case G_POPMTX:
+            {
+                u32 i;
+                if (global_mtxdepth < w1/64)
+                    sim_error(stats, "matrix stack underflow");
+                else
+                    global_mtxdepth -= w1/64;
+                for (i=0; i<global_cachesize; i++)
+                    global_vtxcache[i].source = 0;
+                break;
+            }
+            case G_DL:
+            {
+                const s32 target = find_mesh((const Gfx*)w1);
+                stats->rspcycles += global_costs[COST_RSP_DL].cycles;
+                if (depth+1 >= DLSTACKSIZE)
+                {
+                    sim_error(stats, "display list stack overflow");
+                    break;
+                }
+                if (target >= 0 && (u32)target != mesh)
+                {
+                    sim_walk((const Gfx*)w1, target, depth+1);
+                    sim_flushunused(&global_stats[target]);
+                    global_meshname = (mesh < global_mdl->meshcount) ? global_mdl->meshes[mesh].name : "(model)";
+                }
+                else
+                    sim_walk((const Gfx*)w1, mesh, depth+1);
+                if (_SHIFTR(w0, 16, 8) == G_DL_NOPUSH)
+                    return;
+                break;
+            }
+            case G_ENDDL:
+                stats->rspcycles += global_costs[COST_RSP_DL].cycles;
+                return;
+            case G_GEOMETRYMODE:
+                stats->statecmds++;
+                sim_maskedstate(stats, &global_geometry, &global_geometryknown, _SHIFTR(w0, 0, 24) | 0xFF000000, (u32)w1);
+                break;
+            case G_SETOTHERMODE_H:
+            case G_SETOTHERMODE_L:
+            {
+                const u32 len = _SHIFTR(w0, 0, 8) + 1;
+                const u32 shift = 32 - _SHIFTR(w0, 8, 8) - len;
+                const u32 mask = ((len == 32) ? 0xFFFFFFFF : ((1U << len) - 1)) << shift;
+                const u32 which = (op == G_SETOTHERMODE_L);
+                stats->statecmds++;
+                stats->rdpcycles += global_costs[COST_RDP_COMMAND].cycles;
+                sim_maskedstate(stats, &global_othermode[which], &global_othermodeknown[which], ~mask, (u32)w1 & mask);
+                break;
+            }
+            case G_SETCOMBINE:
+            case G_SETPRIMCOLOR:
+            case G_SETENVCOLOR:
+            case G_SETFOGCOLOR:
+            case G_SETBLENDCOLOR:
+            case G_SETTIMG:
+            case G_TEXTURE:
+                stats->statecmds++;
+                stats->rdpcycles += global_costs[COST_RDP_COMMAND].cycles;
+                sim_state(stats, op, w0, w1);
+                break;
+            case G_SETTILE:
+                stats->statecmds++;
+                stats->rdpcycles += global_costs[COST_RDP_COMMAND].cycles;
+                sim_state(stats, STATEKEY_TILE + _SHIFTR(w1, 24, 3), w0, w1);
+                break;
+            case G_SETTILESIZE:
+                stats->statecmds++;
+                stats->rdpcycles += global_costs[COST_RDP_COMMAND].cycles;
+                sim_state(stats, STATEKEY_TILESIZE + _SHIFTR(w1, 24, 3), w0, w1);
+                break;
+            case G_RDPPIPESYNC:
+                stats->syncs++;
+                stats->rdpcycles += global_costs[COST_RDP_SYNC].cycles;
+                if (!global_drawnsincesync)
+                    stats->redundantsyncs++;
+                global_drawnsincesync = FALSE;
+                break;
+            case G_RDPLOADSYNC:
+            case G_RDPTILESYNC:
+                stats->syncs++;
+                stats->rdpcycles += global_costs[COST_RDP_SYNC].cycles;
+                break;
+            case G_LOADBLOCK:
+            {
+                const u32 tile = STATEKEY_TILE + _SHIFTR(w1, 24, 3);
+                sim_texload(stats, texel_bytes(_SHIFTR(global_statew0[tile], 19, 2), _SHIFTR(w1, 12, 12) - _SHIFTR(w0, 12, 12) + 1), w0, w1);
+                break;
+            }
+            case G_LOADTILE:
+            {
+                const u32 tile = STATEKEY_TILE + _SHIFTR(w1, 24, 3);
+                const u32 width = (_SHIFTR(w1, 12, 12) - _SHIFTR(w0, 12, 12))/4 + 1;
+                const u32 height = (_SHIFTR(w1, 0, 12) - _SHIFTR(w0, 0, 12))/4 + 1;
+                sim_texload(stats, texel_bytes(_SHIFTR(global_statew0[tile], 19, 2), width*height), w0, w1);
+                break;
+            }
+            default:
+                break;
+        }
+        dl++;
+    }
+}
+
+
+/*==============================
+    print_stats
+    Prints a row of the results table
+    @param The name of the row
+    @param The stats to print
+==============================*/
+
+static void print_stats(const char* name, const SimStats* stats)
+{
+    printf("%-20.20s %5u %4u %5u %4u %4u %5u %4u %5u %4u %4u %4u %4u %6u %4u %8u %8u %4u\n", name,
+        stats->commands, stats->vtxloads, stats->verts, stats->redundantverts, stats->unusedverts,
+        stats->tris, stats->degenerate, stats->statecmds, stats->redundantstate, stats->syncs, stats->redundantsyncs,
+        stats->texloads, stats->texbytes, stats->redundantloads, stats->rspcycles, stats->rdpcycles, stats->errors
+    );
+}
+
+
+/*==============================
+    main
+    Program entrypoint
+    @param The number of extra arguments
+    @param An array with the arguments
+    @return The return code
+==============================*/
+
+int main(int argc, char* argv[])
+{
+    int i;
+    const char* path = NULL;
+    static u64 texturedata[MAXTEXTURES];
+    static u32* textures[MAXTEXTURES];
+    s64ModelData* mdl;
+    s64ModelHelper* helper;
+    SimStats total;
+    Gfx* glist;
+    Gfx* glistp;
+    u8* rom;
+    u32 size;
+
+    // Parse the arguments
+    for (i=1; i<argc; i++)
+    {
+        if (!strcmp(argv[i], "-c") && i+1 < argc)
+            global_cachesize = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-n") && i+1 < argc)
+            global_instances = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-k") && i+1 < argc)
+        {
+            if (!read_costs(argv[++i]))
+                return 1;
+        }
+        else if (!strcmp(argv[i], "-v"))
+            global_verbose = TRUE;
+        else if (argv[i][0] != '-')
+            path = argv[i];
+        else
+        {
+            show_help(argv[0]);
+            return 1;
+        }
+    }
+    if (path == NULL || global_cachesize < 3 || global_cachesize > MAXCACHE || global_instances < 1)
+    {
+        show_help(argv[0]);
+        return 1;
+    }
+
+    // Every material gets its own dummy texture, so that TMEM loads of different textures can be told apart
+    for (i=0; i<MAXTEXTURES; i++)
+        textures[i] = (u32*)&texturedata[i];
+
+    // Load the model
+    rom = s64host_readmodel(path, &size);
+    if (rom == NULL)
+    {
+        printf("Unable to read '%s'\n", path);
+        return 1;
+    }
+    s64host_setrom(rom, size);
+    mdl = sausage64_load_binarymodel(0, size, textures);
+    if (mdl == NULL)
+    {
+        printf("Unable to load '%s'. Was it exported for Libultra?\n", path);
+        return 1;
+    }
+    helper = sausage64_inithelper(mdl);
+    if (helper == NULL)
+    {
+        printf("Unable to create the model helper\n");
+        return 1;
+    }
+    if (mdl->animcount > 0)
+        sausage64_set_anim(helper, 0);
+
+    // Draw the model as many times as requested
+    glist = (Gfx*)malloc(sizeof(Gfx)*GFXSIZE);
+    glistp = glist;
+    for (i=0; i<(int)global_instances; i++)
+        sausage64_drawmodel(&glistp, helper);
+    gSPEndDisplayList(glistp++);
+    if (global_verbose)
+        s64host_printgfx(stdout, glist);
+
+    // Simulate it
+    global_mdl = mdl;
+    global_stats = (SimStats*)calloc(mdl->meshcount+1, sizeof(SimStats));
+    global_drawnsincesync = TRUE;
+    printf("Simulating '%s' drawn %u time(s), with a %u vertex cache\n", path, global_instances, global_cachesize);
+    sim_walk(glist, mdl->meshcount, 0);
+    sim_flushunused(&global_stats[mdl->meshcount]);
+    if (global_mtxdepth != 0)
+        sim_error(&global_stats[mdl->meshcount], "matrix stack isn't empty at the end of the display list");
+
+    // Print the results
+    printf("\n%-20s %5s %4s %5s %4s %4s %5s %4s %5s %4s %4s %4s %4s %6s %4s %8s %8s %4s\n", "Mesh",
+        "Cmds", "VtxL", "Verts", "Rdnt", "Unus", "Tris", "Degn", "State", "Rdnt", "Sync", "Rdnt",
+        "TexL", "TexB", "Rdnt", "RSP cyc", "RDP cyc", "Errs"
+    );
+    memset(&total, 0, sizeof(SimStats));
+    for (i=0; i<=mdl->meshcount; i++)
+    {
+        u32 j;
+        const u32* src = (const u32*)&global_stats[i];
+        u32* dst = (u32*)&total;
+        print_stats((i < mdl->meshcount) ? mdl->meshes[i].name : "(model)", &global_stats[i]);
+        for (j=0; j<sizeof(SimStats)/sizeof(u32); j++)
+            dst[j] += src[j];
+    }
+    print_stats("Total", &total);
+    printf("\nRdnt columns count redundant vertex loads, state changes, pipe syncs and TMEM loads. Unus counts vertices that were loaded but never used.\n");
+    printf("Cycle counts are estimates from the cost table (see -k), and don't include the RDP's fill rate.\n");
+
+    // Cleanup
+    free(global_stats);
+    free(glist);
+    free(rom);
+    sausage64_freehelper(helper);
+    sausage64_unload_binarymodel(mdl);
+    return (total.errors > 0);
+}
@@ -35,7 +35,14 @@ https://github.com/buu342/Blender-Sausage64
        Binary Asset Macros
 *********************************/
 
-#define BINARY_VERSION 0
+#define BINARY_VERSION 3
+
+// Size of a mesh LOD's table of contents
+#ifndef LIBDRAGON
+    #define BINARY_LODTOCSIZE 0x18
+#else
+    #define BINARY_LODTOCSIZE 0x20
+#endif
 
 // Custom Combine LERP function that doesn't do macro hackery
 #ifndef LIBDRAGON
@@ -86,6 +93,9 @@ typedef struct {
 typedef struct {
     s16   parent;
     u8    is_billboard;
+    u8    lodcount;
+    f32   bounds[4];
+    u32   lods_offset;
     char* name;
 } BinFile_MeshData;
 
@@ -115,7 +125,10 @@ typedef struct {
 
 typedef struct {
     u32 kfcount;
+    f32 bounds[4];
+    u32 framecount;
     u16* kfindices;
+    u16* framelookup;
     char* name;
 } BinFile_AnimData;
 
@@ -240,10 +253,13 @@ typedef enum {
 #ifndef LIBDRAGON
     static f32 s64_viewmat[4][4];
     static f32 s64_projmat[4][4];
+    static u8  s64_rootloaded = FALSE;
 #else
     static f32 s64_campos[3];
     static s64Material* s64_lastmat = NULL;
 #endif
+static f32 s64_frustum[6][4];
+static u8  s64_hasfrustum = FALSE;
 
 
 /*********************************
@@ -350,9 +366,12 @@ static inline s64Quat s64quat_difference(s64Quat a, s64Quat b)
 
 /*==============================
     s64slerp
-    Returns the spherical linear 
-    interpolation of two quaternions
-    given a fraction.
+    Returns an approximation of the spherical
+    linear interpolation of two quaternions
+    given a fraction. This is done with a 
+    normalized lerp, which avoids trigonometry,
+    with an optional correction of the fraction
+    to bring it closer to a true slerp.
     @param The first quaternion
     @param The target quaternion
     @param The fraction
@@ -365,6 +384,18 @@ static inline s64Quat s64slerp(s64Quat a, s64Quat b, f32 f)
     const f32 dot = s64quat_dot(a, b);
     f32 scale = (dot >= 0) ? 1.0f : -1.0f;
     
+    // Correct the fraction, as a normalized lerp moves faster in the middle than at the ends
+    // Polynomial fit from https://zeux.io/2015/07/23/approximating-slerp/
+    #ifdef S64_NLERP_CORRECTION
+    {
+        const f32 d = dot*scale;
+        const f32 A = 1.0904f + d*(-3.2452f + d*(3.55645f - d*1.43519f));
+        const f32 B = 0.848013f + d*(-1.06021f + d*0.215638f);
+        const f32 k = A*(f - 0.5f)*(f - 0.5f) + B;
+        f = f + f*(f - 0.5f)*(f - 1)*k;
+    }
+    #endif
+    
     // Scale the quaternion
     result.w = b.w*scale;
     result.x = b.x*scale;
@@ -438,6 +469,28 @@ static inline void s64quat_to_mtx(s64Quat q, f32 dest[][4])
 }
 
 
+/*==============================
+    s64calc_transformmtx
+    Converts a mesh transform to a matrix, which rotates,
+    then scales, then translates
+    @param The transform to convert
+    @param The matrix to fill
+==============================*/
+
+static void s64calc_transformmtx(const s64Transform* fdata, f32 dest[][4])
+{
+    int i, j;
+    s64Quat q = {fdata->rot[0], fdata->rot[1], fdata->rot[2], fdata->rot[3]};
+    s64quat_to_mtx(q, dest);
+    for (i=0; i<3; i++)
+        for (j=0; j<3; j++)
+            dest[i][j] *= fdata->scale[j];
+    dest[3][0] = fdata->pos[0];
+    dest[3][1] = fdata->pos[1];
+    dest[3][2] = fdata->pos[2];
+}
+
+
 /*==============================
     s64quat_fromdir
     Calculates a quaternion from a normalized direction vector (using the up vector)
@@ -526,6 +579,113 @@ static inline s64Quat s64quat_fromeuler(f32 yaw, f32 pitch, f32 roll)
         mtx[2][3] = 0;
         mtx[3][3] = 1;
     }
+    
+    
+    /*==============================
+        s64calc_isidentity
+        Checks if a mesh transform does nothing
+        @param  The transform to check
+        @return Whether the transform is an identity
+    ==============================*/
+
+    static inline u8 s64calc_isidentity(const s64Transform* fdata)
+    {
+        return fdata->pos[0] == 0 && fdata->pos[1] == 0 && fdata->pos[2] == 0 &&
+               fdata->scale[0] == 1 && fdata->scale[1] == 1 && fdata->scale[2] == 1 &&
+               fdata->rot[1] == 0 && fdata->rot[2] == 0 && fdata->rot[3] == 0;
+    }
+    
+    
+    /*==============================
+        s64calc_fixedmtx
+        Writes a mesh's s15.16 matrix straight from its
+        rotation, scale and position, multiplied with a root 
+        matrix, without building intermediate float matrices
+        @param The fixed point matrix to fill
+        @param The mesh's transform
+        @param The mesh's rotation as a 3x3 matrix, or NULL
+               to use the transform's quaternion
+        @param The root matrix to multiply with, or NULL
+    ==============================*/
+
+    static void s64calc_fixedmtx(Mtx* dest, const s64Transform* fdata, f32 rot[][4], f32 root[4][4])
+    {
+        int i, j;
+        u16* integer = (u16*)dest;
+        u16* fraction = ((u16*)dest) + 16;
+        f32 basis[3][3];
+        
+        // Get the rotation basis of the mesh, scaled on each axis
+        if (rot == NULL)
+        {
+            f32 xx, yy, zz, xy, yz, xz, wx, wy, wz, s = 0;
+            const f32 norm = sqrtf(fdata->rot[0]*fdata->rot[0] + fdata->rot[1]*fdata->rot[1] + fdata->rot[2]*fdata->rot[2] + fdata->rot[3]*fdata->rot[3]);
+            if (norm > 0)
+                s = 2/norm;
+            xx = fdata->rot[1]*fdata->rot[1]*s;
+            xy = fdata->rot[1]*fdata->rot[2]*s;
+            xz = fdata->rot[1]*fdata->rot[3]*s;
+            yy = fdata->rot[2]*fdata->rot[2]*s;
+            yz = fdata->rot[2]*fdata->rot[3]*s;
+            zz = fdata->rot[3]*fdata->rot[3]*s;
+            wx = fdata->rot[0]*fdata->rot[1]*s;
+            wy = fdata->rot[0]*fdata->rot[2]*s;
+            wz = fdata->rot[0]*fdata->rot[3]*s;
+            basis[0][0] = (1 - yy - zz)*fdata->scale[0];
+            basis[0][1] = (xy + wz)*fdata->scale[1];
+            basis[0][2] = (xz - wy)*fdata->scale[2];
+            basis[1][0] = (xy - wz)*fdata->scale[0];
+            basis[1][1] = (1 - xx - zz)*fdata->scale[1];
+            basis[1][2] = (yz + wx)*fdata->scale[2];
+            basis[2][0] = (xz + wy)*fdata->scale[0];
+            basis[2][1] = (yz - wx)*fdata->scale[1];
+            basis[2][2] = (1 - xx - yy)*fdata->scale[2];
+        }
+        else
+        {
+            for (i=0; i<3; i++)
+                for (j=0; j<3; j++)
+                    basis[i][j] = rot[i][j]*fdata->scale[j];
+        }
+        
+        // Without a root matrix, the basis and position can be written out as they are
+        if (root == NULL)
+        {
+            for (i=0; i<4; i++)
+            {
+                for (j=0; j<4; j++)
+                {
+                    s32 e;
+                    f32 val;
+                    if (i < 3)
+                        val = (j < 3) ? basis[i][j] : 0;
+                    else
+                        val = (j < 3) ? fdata->pos[j] : 1;
+                    e = (s32)(val*65536.0f);
+                    integer[i*4 + j] = (u16)(e >> 16);
+                    fraction[i*4 + j] = (u16)(e & 0xFFFF);
+                }
+            }
+            return;
+        }
+        
+        // Multiply each row with the root matrix, and write it out in fixed point
+        for (i=0; i<4; i++)
+        {
+            for (j=0; j<4; j++)
+            {
+                s32 e;
+                f32 val;
+                if (i < 3)
+                    val = basis[i][0]*root[0][j] + basis[i][1]*root[1][j] + basis[i][2]*root[2][j];
+                else
+                    val = fdata->pos[0]*root[0][j] + fdata->pos[1]*root[1][j] + fdata->pos[2]*root[2][j] + root[3][j];
+                e = (s32)(val*65536.0f);
+                integer[i*4 + j] = (u16)(e >> 16);
+                fraction[i*4 + j] = (u16)(e & 0xFFFF);
+            }
+        }
+    }
 #else
     /*==============================
         s64calc_billboard
@@ -574,6 +734,109 @@ static inline s64Quat s64quat_fromeuler(f32 yaw, f32 pitch, f32 roll)
 #endif
 
 
+#ifndef LIBDRAGON
+    /*==============================
+        s64calc_screensize
+        Calculate how much of the screen's height a sphere
+        takes up, using the camera's matrices
+        @param  The center of the sphere, relative to the model's root
+        @param  The radius of the sphere
+        @return The fraction of the screen height, or -1 if the
+                camera is inside the sphere
+    ==============================*/
+
+    static inline f32 s64calc_screensize(f32 center[3], f32 radius)
+    {
+        int i;
+        f32 w = s64_projmat[3][3];
+        f32 persp = -s64_projmat[2][3];
+        
+        // Get the clip space W of the sphere's center
+        for (i=0; i<3; i++)
+        {
+            f32 view = center[0]*s64_viewmat[0][i] + center[1]*s64_viewmat[1][i] + center[2]*s64_viewmat[2][i] + s64_viewmat[3][i];
+            w += view*s64_projmat[i][3];
+        }
+        
+        // In perspective projections, W is the (scaled) distance to the camera
+        if (w <= 0 || (persp > 0 && w <= radius*persp))
+            return -1;
+        return radius*s64_projmat[1][1]/w;
+    }
+#else
+    /*==============================
+        s64calc_screensize
+        Calculate how much of the screen's height a sphere
+        takes up, using the camera's position
+        @param  The center of the sphere, relative to the model's root
+        @param  The radius of the sphere
+        @return The fraction of the screen height, or -1 if the
+                camera is inside the sphere
+    ==============================*/
+
+    static inline f32 s64calc_screensize(f32 center[3], f32 radius)
+    {
+        f32 dir[3] = {s64_campos[0] - center[0], s64_campos[1] - center[1], s64_campos[2] - center[2]};
+        f32 dist = sqrtf(dir[0]*dir[0] + dir[1]*dir[1] + dir[2]*dir[2]);
+        if (dist <= radius)
+            return -1;
+        return radius*S64_LOD_PROJSCALE/dist;
+    }
+#endif
+
+
+/*==============================
+    s64calc_frustum
+    Extracts the frustum planes from a combined 
+    view and projection matrix
+    @param The view-projection matrix
+==============================*/
+
+static void s64calc_frustum(f32 viewproj[4][4])
+{
+    int i, j;
+    for (i=0; i<6; i++)
+    {
+        f32 len;
+        const int axis = i/2;
+        const f32 sign = (i%2 == 0) ? 1.0f : -1.0f;
+        
+        // Each plane is the W column plus or minus the X, Y, or Z column
+        for (j=0; j<4; j++)
+            s64_frustum[i][j] = viewproj[j][3] + sign*viewproj[j][axis];
+        
+        // Normalize the plane so that we can compare distances to it
+        len = sqrtf(s64_frustum[i][0]*s64_frustum[i][0] + s64_frustum[i][1]*s64_frustum[i][1] + s64_frustum[i][2]*s64_frustum[i][2]);
+        if (len != 0)
+            len = 1/len;
+        for (j=0; j<4; j++)
+            s64_frustum[i][j] *= len;
+    }
+    s64_hasfrustum = TRUE;
+}
+
+
+/*==============================
+    s64calc_spherevisible
+    Checks if a sphere is (at least partially) inside the 
+    camera's view frustum
+    @param  The center of the sphere, relative to the model's root
+    @param  The radius of the sphere
+    @return Whether the sphere is visible
+==============================*/
+
+static inline u8 s64calc_spherevisible(f32 center[3], f32 radius)
+{
+    int i;
+    if (!s64_hasfrustum)
+        return TRUE;
+    for (i=0; i<6; i++)
+        if (s64_frustum[i][0]*center[0] + s64_frustum[i][1]*center[1] + s64_frustum[i][2]*center[2] + s64_frustum[i][3] < -radius)
+            return FALSE;
+    return TRUE;
+}
+
+
 /*==============================
     s64vec_rotate
     Rotate a vector using a quaternion
@@ -654,6 +917,54 @@ static inline void s64vec_rotate(f32 vec[3], s64Quat rot, f32 result[3])
     }
 
 
+    /*==============================
+        sausage64_load_staticgfx
+        Generates the buffers and display list 
+        of a single s64Gfx
+        @param The s64Gfx to generate
+    ==============================*/
+
+    static void sausage64_load_staticgfx(s64Gfx* dl)
+    {
+        u32 facecount = 0, vertcount = 0;
+
+        // Count the number of faces
+        for (u32 j=0; j<dl->blockcount; j++)
+        {
+            vertcount += dl->renders[j].vertcount;
+            facecount += dl->renders[j].facecount;
+        }
+
+        // Generate the array buffers
+        glGenBuffersARB(1, &dl->guid_verts);
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, dl->guid_verts);
+        glBufferDataARB(GL_ARRAY_BUFFER_ARB, vertcount*sizeof(f32)*11, dl->renders[0].verts, GL_STATIC_DRAW_ARB);
+        glGenBuffersARB(1, &dl->guid_faces);
+        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, dl->guid_faces);
+        glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, facecount*sizeof(u16)*3, dl->renders[0].faces, GL_STATIC_DRAW_ARB);
+
+        // Now generate the display list
+        dl->guid_mdl = glGenLists(1);
+        glNewList(dl->guid_mdl, GL_COMPILE);
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, dl->guid_verts);
+        glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, dl->guid_faces);
+        for (u32 j=0; j<dl->blockcount; j++)
+        {
+            s64RenderBlock* render = &dl->renders[j];
+            int fc = render->facecount;
+            if (render->material != NULL && render->material != s64_lastmat)
+                sausage64_loadmaterial(render->material);
+            s64_lastmat = render->material;
+            glVertexPointer(3, GL_FLOAT, sizeof(f32)*11, (u8*)(0*sizeof(f32)));
+            glTexCoordPointer(2, GL_FLOAT, sizeof(f32)*11, (u8*)(3*sizeof(f32)));
+            glNormalPointer(GL_FLOAT, sizeof(f32)*11, (u8*)(5*sizeof(f32)));
+            glColorPointer(3, GL_FLOAT, sizeof(f32)*11, (u8*)(8*sizeof(f32)));
+            glDrawElements(GL_TRIANGLES, fc * 3, GL_UNSIGNED_SHORT, (u8*)(3*sizeof(u16)*(render->faces - dl->renders[0].faces)));
+        }
+        glEndList();
+    }
+
+
     /*==============================
         sausage64_load_staticmodel
         Generates the display lists for a
@@ -676,46 +987,18 @@ static inline void s64vec_rotate(f32 vec[3], s64Quat rot, f32 result[3])
         glEnableClientState(GL_NORMAL_ARRAY);
         glEnableClientState(GL_COLOR_ARRAY);
 
-        // Generate the buffers, and then assign them to the vert+face arrays
+        // Generate the buffers and display lists of each mesh
+        // Meshes can be culled or swapped for a LOD, so every display list loads its own material
         for (u32 i=0; i<meshcount; i++)
         {
-            s64Gfx* dl = (s64Gfx*)mdldata->meshes[i].dl;
-            u32 facecount = 0, vertcount = 0;
-
-            // Count the number of faces
-            for (u32 j=0; j<dl->blockcount; j++)
-            {
-                vertcount += dl->renders[j].vertcount;
-                facecount += dl->renders[j].facecount;
-            }
-
-            // Generate the array buffers
-            glGenBuffersARB(1, &dl->guid_verts);
-            glBindBufferARB(GL_ARRAY_BUFFER_ARB, dl->guid_verts);
-            glBufferDataARB(GL_ARRAY_BUFFER_ARB, vertcount*sizeof(f32)*11, dl->renders[0].verts, GL_STATIC_DRAW_ARB);
-            glGenBuffersARB(1, &dl->guid_faces);
-            glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, dl->guid_faces);
-            glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, facecount*sizeof(u16)*3, dl->renders[0].faces, GL_STATIC_DRAW_ARB);
-
-            // Now generate the display list
-            dl->guid_mdl = glGenLists(1);
-            glNewList(dl->guid_mdl, GL_COMPILE);
-            glBindBufferARB(GL_ARRAY_BUFFER_ARB, dl->guid_verts);
-            glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, dl->guid_faces);
-            for (u32 j=0; j<dl->blockcount; j++)
+            const s64Mesh* mesh = &mdldata->meshes[i];
+            s64_lastmat = NULL;
+            sausage64_load_staticgfx((s64Gfx*)mesh->dl);
+            for (u32 j=0; j<mesh->lodcount; j++)
             {
-                s64RenderBlock* render = &dl->renders[j];
-                int fc = render->facecount;
-                if (render->material != NULL && render->material != s64_lastmat)
-                    sausage64_loadmaterial(render->material);
-                s64_lastmat = render->material;
-                glVertexPointer(3, GL_FLOAT, sizeof(f32)*11, (u8*)(0*sizeof(f32)));
-                glTexCoordPointer(2, GL_FLOAT, sizeof(f32)*11, (u8*)(3*sizeof(f32)));
-                glNormalPointer(GL_FLOAT, sizeof(f32)*11, (u8*)(5*sizeof(f32)));
-                glColorPointer(3, GL_FLOAT, sizeof(f32)*11, (u8*)(8*sizeof(f32)));
-                glDrawElements(GL_TRIANGLES, fc * 3, GL_UNSIGNED_SHORT, (u8*)(3*sizeof(u16)*(render->faces - dl->renders[0].faces)));
+                s64_lastmat = NULL;
+                sausage64_load_staticgfx((s64Gfx*)mesh->lods[j].dl);
             }
-            glEndList();
         }
         
         // No need for this anymore
@@ -727,6 +1010,24 @@ static inline void s64vec_rotate(f32 vec[3], s64Quat rot, f32 result[3])
     }
 
 
+    /*==============================
+        sausage64_unload_staticgfx
+        Frees the buffers and display list
+        of a single s64Gfx
+        @param The s64Gfx to free
+    ==============================*/
+
+    static void sausage64_unload_staticgfx(s64Gfx* dl)
+    {
+        glDeleteBuffersARB(1, &dl->guid_verts);
+        glDeleteBuffersARB(1, &dl->guid_faces);
+        glDeleteLists(dl->guid_mdl, 1);
+        dl->guid_mdl = 0xFFFFFFFF;
+        dl->guid_verts = 0xFFFFFFFF;
+        dl->guid_faces = 0xFFFFFFFF;
+    }
+
+
     /*==============================
         sausage64_load_staticmodel
         Frees the memory used by the display 
@@ -740,13 +1041,9 @@ static inline void s64vec_rotate(f32 vec[3], s64Quat rot, f32 result[3])
         u32 meshcount = mdldata->meshcount;
         for (u32 i=0; i<meshcount; i++)
         {
-            s64Gfx* dl = (s64Gfx*)mdldata->meshes[i].dl;
-            glDeleteBuffersARB(1, &dl->guid_verts);
-            glDeleteBuffersARB(1, &dl->guid_faces);
-            glDeleteLists(dl->guid_mdl, 1);
-            dl->guid_mdl = 0xFFFFFFFF;
-            dl->guid_verts = 0xFFFFFFFF;
-            dl->guid_faces = 0xFFFFFFFF;
+            sausage64_unload_staticgfx((s64Gfx*)mdldata->meshes[i].dl);
+            for (u32 j=0; j<mdldata->meshes[i].lodcount; j++)
+                sausage64_unload_staticgfx((s64Gfx*)mdldata->meshes[i].lods[j].dl);
         }
     }
 #endif
@@ -785,6 +1082,10 @@ static inline void s64vec_rotate(f32 vec[3], s64Quat rot, f32 result[3])
                     args[0] = data[offset++];
                     gSPVertex(dlist++, verts + ((args[0] & 0xFFFF0000)>>16), (args[0] & 0x0000FF00)>>8, args[0] & 0x000000FF);
                     break;
+                case SPCullDisplayList:
+                    args[0] = data[offset++];
+                    gSPCullDisplayList(dlist++, (args[0] & 0x0000FF00)>>8, args[0] & 0x000000FF);
+                    break;
                 case SP1Triangle:
                     args[0] = data[offset++];
                     gSP1Triangle(dlist++, (args[0] & 0xFF000000)>>24, (args[0] & 0x00FF0000)>>16, (args[0] & 0x0000FF00)>>8, (args[0] & 0x000000FF));
@@ -891,6 +1192,39 @@ static inline void s64vec_rotate(f32 vec[3], s64Quat rot, f32 result[3])
 #endif
 
 
+/*==============================
+    sausage64_readlodtoc
+    Reads the table of contents of a mesh LOD
+    @param  The binary file data
+    @param  The offset of the LOD's table of contents
+    @param  The mesh TOC struct to store the LOD's geometry
+            offsets in
+    @return The screen size to use the LOD at
+==============================*/
+
+static f32 sausage64_readlodtoc(u8* data, u32 offset, BinFile_TOC_Meshes* toc)
+{
+    #ifndef LIBDRAGON
+        toc->vertdata_offset  = *((u32*)&data[offset+1*sizeof(u32)]);
+        toc->vertdata_size    = *((u32*)&data[offset+2*sizeof(u32)]);
+        toc->facedata_offset  = 0; // Unused in Libultra
+        toc->facedata_size    = 0; // Unused in Libultra
+        toc->dldata_offset    = *((u32*)&data[offset+3*sizeof(u32)]);
+        toc->dldata_size      = *((u32*)&data[offset+4*sizeof(u32)]);
+        toc->dldata_slotcount = *((u32*)&data[offset+5*sizeof(u32)]);
+    #else
+        toc->vertdata_offset  = *((u32*)&data[offset+1*sizeof(u32)]);
+        toc->vertdata_size    = *((u32*)&data[offset+2*sizeof(u32)]);
+        toc->facedata_offset  = *((u32*)&data[offset+3*sizeof(u32)]);
+        toc->facedata_size    = *((u32*)&data[offset+4*sizeof(u32)]);
+        toc->dldata_offset    = *((u32*)&data[offset+5*sizeof(u32)]);
+        toc->dldata_size      = *((u32*)&data[offset+6*sizeof(u32)]);
+        toc->dldata_slotcount = *((u32*)&data[offset+7*sizeof(u32)]);
+    #endif
+    return *((f32*)&data[offset]);
+}
+
+
 /*==============================
     sausage64_load_binarymodel
     Load a binary model from ROM
@@ -926,8 +1260,8 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
     BinFile_MatData* matdatas = NULL;
     BinFile_TOC_Anims* toc_anims = NULL;
     BinFile_AnimData* animdatas = NULL;
-    u32 mallocsize_strings = 0, mallocsize_verts = 0, mallocsize_gfx = 0, mallocsize_keyframes = 0, mallocsize_transforms = 0;
-    u32 offset_strings = 0, offset_verts = 0, offset_gfx = 0, offset_keyframes = 0, offset_transforms = 0;
+    u32 mallocsize_strings = 0, mallocsize_verts = 0, mallocsize_gfx = 0, mallocsize_lods = 0, mallocsize_keyframes = 0, mallocsize_transforms = 0, mallocsize_framelookup = 0;
+    u32 offset_strings = 0, offset_verts = 0, offset_gfx = 0, offset_lods = 0, offset_keyframes = 0, offset_transforms = 0, offset_framelookup = 0;
     char* strings = NULL;
     #ifndef LIBDRAGON
         Vtx* verts = NULL;
@@ -937,9 +1271,11 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
     #endif
     s64Gfx* dlists = NULL;
     s64Mesh* meshes = NULL;
+    s64MeshLOD* lods = NULL;
     s64Animation* anims = NULL;
     s64KeyFrame* keyframes = NULL;
     s64Transform* transforms = NULL;
+    u16* framelookup = NULL;
     s64ModelData* mdl = NULL;
     #ifdef LIBDRAGON
         u32 mallocsize_faces = 0, mallocsize_rbs = 0, mallocsize_texes = 0, mallocsize_primcols = 0;
@@ -1048,6 +1384,7 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
     // and then the second iteration is when we'll actually populate the data structures
     for (i=0; i<header.count_meshes; i++)
     {
+        int j;
         #ifndef LIBDRAGON
             int toc_offset = header.offset_meshes + 0x1C*i;
             BinFile_TOC_Meshes toc_mesh = {
@@ -1078,18 +1415,36 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
         BinFile_MeshData meshdata = {
             *((u16*)&data[toc_mesh.meshdata_offset]),
             data[toc_mesh.meshdata_offset+2],
-            (char*)&data[toc_mesh.meshdata_offset+3]
+            data[toc_mesh.meshdata_offset+3],
+            {
+                *((f32*)&data[toc_mesh.meshdata_offset+4+0*sizeof(f32)]),
+                *((f32*)&data[toc_mesh.meshdata_offset+4+1*sizeof(f32)]),
+                *((f32*)&data[toc_mesh.meshdata_offset+4+2*sizeof(f32)]),
+                *((f32*)&data[toc_mesh.meshdata_offset+4+3*sizeof(f32)]),
+            },
+            toc_mesh.meshdata_offset+4+4*sizeof(f32),
+            NULL
         };
+        meshdata.name = (char*)&data[meshdata.lods_offset + meshdata.lodcount*BINARY_LODTOCSIZE];
         mallocsize_strings += strlen(meshdata.name)+1;
-        #ifndef LIBDRAGON
-            mallocsize_verts += toc_mesh.vertdata_size/sizeof(Vtx);
-            mallocsize_gfx += toc_mesh.dldata_slotcount;
-        #else
-            mallocsize_verts += toc_mesh.vertdata_size/(sizeof(f32)*11);
-            mallocsize_faces += toc_mesh.facedata_size/(sizeof(u16)*3);
-            mallocsize_gfx += 1;
-            mallocsize_rbs += toc_mesh.dldata_slotcount;
-        #endif
+        mallocsize_lods += meshdata.lodcount;
+
+        // Count the geometry of the mesh, followed by the geometry of its LODs
+        for (j=0; j<=meshdata.lodcount; j++)
+        {
+            BinFile_TOC_Meshes toc_geo = toc_mesh;
+            if (j > 0)
+                sausage64_readlodtoc(data, meshdata.lods_offset + (j-1)*BINARY_LODTOCSIZE, &toc_geo);
+            #ifndef LIBDRAGON
+                mallocsize_verts += toc_geo.vertdata_size/sizeof(Vtx);
+                mallocsize_gfx += toc_geo.dldata_slotcount;
+            #else
+                mallocsize_verts += toc_geo.vertdata_size/(sizeof(f32)*11);
+                mallocsize_faces += toc_geo.facedata_size/(sizeof(u16)*3);
+                mallocsize_gfx += 1;
+                mallocsize_rbs += toc_geo.dldata_slotcount;
+            #endif
+        }
         
         // Copy the data
         toc_meshes[i] = toc_mesh;
@@ -1136,11 +1491,20 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
         };
         BinFile_AnimData animdata = {
             *((u32*)&data[toc_anim.animdata_offset]),
-            (u16*)&data[toc_anim.animdata_offset+2*sizeof(u16)]
+            {
+                *((f32*)&data[toc_anim.animdata_offset+4+0*sizeof(f32)]),
+                *((f32*)&data[toc_anim.animdata_offset+4+1*sizeof(f32)]),
+                *((f32*)&data[toc_anim.animdata_offset+4+2*sizeof(f32)]),
+                *((f32*)&data[toc_anim.animdata_offset+4+3*sizeof(f32)]),
+            },
+            *((u32*)&data[toc_anim.animdata_offset+4+4*sizeof(f32)]),
+            (u16*)&data[toc_anim.animdata_offset+8+4*sizeof(f32)]
         };
-        animdata.name = (((char*)(animdata.kfindices)) + animdata.kfcount*sizeof(u16));
+        animdata.framelookup = animdata.kfindices + animdata.kfcount;
+        animdata.name = (char*)(animdata.framelookup + animdata.framecount);
         mallocsize_strings += strlen(animdata.name)+1;
         mallocsize_keyframes += animdata.kfcount;
+        mallocsize_framelookup += animdata.framecount;
         mallocsize_transforms += animdata.kfcount*header.count_meshes;
         
         // Copy the data
@@ -1170,6 +1534,12 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
         dlists = (s64Gfx*)malloc(sizeof(s64Gfx)*mallocsize_gfx);
         if (meshes == NULL || verts == NULL || dlists == NULL)
             mallocfailed = TRUE;
+        if (mallocsize_lods > 0)
+        {
+            lods = (s64MeshLOD*)malloc(sizeof(s64MeshLOD)*mallocsize_lods);
+            if (lods == NULL)
+                mallocfailed = TRUE;
+        }
     }
 
     // Malloc material data
@@ -1201,7 +1571,8 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
         anims = (s64Animation*)malloc(sizeof(s64Animation)*header.count_anims);
         keyframes = (s64KeyFrame*)malloc(sizeof(s64KeyFrame)*mallocsize_keyframes);
         transforms = (s64Transform*)malloc(sizeof(s64Transform)*mallocsize_transforms);
-        if (anims == NULL || keyframes == NULL || transforms == NULL)
+        framelookup = (u16*)malloc(sizeof(u16)*mallocsize_framelookup);
+        if (anims == NULL || keyframes == NULL || transforms == NULL || framelookup == NULL)
             mallocfailed = TRUE;
     }
 
@@ -1221,9 +1592,11 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
             free(primcols);
         #endif
         free(dlists);
+        free(lods);
         free(anims);
         free(keyframes);
         free(transforms);
+        free(framelookup);
         free(toc_meshes);
         free(toc_mats);
         free(toc_anims);
@@ -1236,57 +1609,74 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
     // Now we will actually pull data from the binary file and copy it over to our s64 data structs
     for (i=0; i<header.count_meshes; i++)
     {
+        int j;
+        
         // Copy the s64Mesh
         *(u32*)&meshes[i].is_billboard = meshdatas[i].is_billboard;
         *(s32*)&meshes[i].parent = meshdatas[i].parent;
+        memcpy((f32*)meshes[i].bounds, meshdatas[i].bounds, sizeof(f32)*4);
+        *(u32*)&meshes[i].lodcount = meshdatas[i].lodcount;
+        meshes[i].lods = (meshdatas[i].lodcount > 0) ? &lods[offset_lods] : NULL;
         meshes[i].name = strings+offset_strings;
         strcpy(strings+offset_strings, meshdatas[i].name);
-        meshes[i].dl = &dlists[offset_gfx];
 
-        #ifndef LIBDRAGON
-            // Copy the vertex data
-            // It's aligned by design (Thanks SGI!), so we can just memcpy
-            memcpy(&verts[offset_verts], &data[toc_meshes[i].vertdata_offset], toc_meshes[i].vertdata_size);
-            
-            // Generate the display list
-            sausage64_gendlist((u32*)(&data[toc_meshes[i].dldata_offset]), &dlists[offset_gfx], &verts[offset_verts], textures);
-            
-            // Increment pointers
-            offset_verts += toc_meshes[i].vertdata_size/sizeof(Vtx);
-            offset_gfx += toc_meshes[i].dldata_slotcount;
-        #else
-            // Copy the vertex and face data
-            memcpy(&verts[offset_verts], &data[toc_meshes[i].vertdata_offset], toc_meshes[i].vertdata_size);
-            memcpy(&faces[offset_faces], &data[toc_meshes[i].facedata_offset], toc_meshes[i].facedata_size);
-
-            // Copy the s64Gfx data
-            dlists[offset_gfx].blockcount = toc_meshes[i].dldata_slotcount;
-            dlists[offset_gfx].guid_mdl = 0xFFFFFFFF;
-            dlists[offset_gfx].guid_verts = 0xFFFFFFFF;
-            dlists[offset_gfx].guid_faces = 0xFFFFFFFF;
-            dlists[offset_gfx].renders = &rbs[offset_rbs];
-            meshes[i].dl = &dlists[offset_gfx];
-
-            // Copy the render block data
-            for (int j=0; j<toc_meshes[i].dldata_slotcount; j++)
+        // Generate the mesh's display list, followed by the ones of its LODs
+        for (j=0; j<=meshdatas[i].lodcount; j++)
+        {
+            BinFile_TOC_Meshes toc_geo = toc_meshes[i];
+            if (j > 0)
             {
-                int curoffset = toc_meshes[i].dldata_offset + j*0xC;
-                int matid = *((u32*)&data[curoffset + 2*sizeof(u32)]); 
-                rbs[offset_rbs + j].vertcount = *((u16*)&data[curoffset + 0*sizeof(u16)]);
-                rbs[offset_rbs + j].verts     = (f32(*)[11])(&verts[offset_verts] + (*((u16*)&data[curoffset + 1*sizeof(u16)]))*11);
-                rbs[offset_rbs + j].facecount = *((u16*)&data[curoffset + 2*sizeof(u16)]);
-                rbs[offset_rbs + j].faces     = (u16(*)[3])(&faces[offset_faces] + (*((u16*)&data[curoffset + 3*sizeof(u16)]))*3);
-                if (matid == -1)
-                    rbs[offset_rbs + j].material = NULL;
-                else
-                    rbs[offset_rbs + j].material = &mats[matid];
+                *(f32*)&lods[offset_lods].screensize = sausage64_readlodtoc(data, meshdatas[i].lods_offset + (j-1)*BINARY_LODTOCSIZE, &toc_geo);
+                lods[offset_lods].dl = &dlists[offset_gfx];
+                offset_lods++;
             }
+            else
+                meshes[i].dl = &dlists[offset_gfx];
 
-            offset_verts += toc_meshes[i].vertdata_size/(sizeof(f32));
-            offset_faces += toc_meshes[i].facedata_size/(sizeof(u16));
-            offset_rbs += toc_meshes[i].dldata_slotcount;
-            offset_gfx += 1;
-        #endif
+            #ifndef LIBDRAGON
+                // Copy the vertex data
+                // It's aligned by design (Thanks SGI!), so we can just memcpy
+                memcpy(&verts[offset_verts], &data[toc_geo.vertdata_offset], toc_geo.vertdata_size);
+                
+                // Generate the display list
+                sausage64_gendlist((u32*)(&data[toc_geo.dldata_offset]), &dlists[offset_gfx], &verts[offset_verts], textures);
+                
+                // Increment pointers
+                offset_verts += toc_geo.vertdata_size/sizeof(Vtx);
+                offset_gfx += toc_geo.dldata_slotcount;
+            #else
+                // Copy the vertex and face data
+                memcpy(&verts[offset_verts], &data[toc_geo.vertdata_offset], toc_geo.vertdata_size);
+                memcpy(&faces[offset_faces], &data[toc_geo.facedata_offset], toc_geo.facedata_size);
+
+                // Copy the s64Gfx data
+                dlists[offset_gfx].blockcount = toc_geo.dldata_slotcount;
+                dlists[offset_gfx].guid_mdl = 0xFFFFFFFF;
+                dlists[offset_gfx].guid_verts = 0xFFFFFFFF;
+                dlists[offset_gfx].guid_faces = 0xFFFFFFFF;
+                dlists[offset_gfx].renders = &rbs[offset_rbs];
+
+                // Copy the render block data
+                for (int k=0; k<toc_geo.dldata_slotcount; k++)
+                {
+                    int curoffset = toc_geo.dldata_offset + k*0xC;
+                    int matid = *((u32*)&data[curoffset + 2*sizeof(u32)]); 
+                    rbs[offset_rbs + k].vertcount = *((u16*)&data[curoffset + 0*sizeof(u16)]);
+                    rbs[offset_rbs + k].verts     = (f32(*)[11])(&verts[offset_verts] + (*((u16*)&data[curoffset + 1*sizeof(u16)]))*11);
+                    rbs[offset_rbs + k].facecount = *((u16*)&data[curoffset + 2*sizeof(u16)]);
+                    rbs[offset_rbs + k].faces     = (u16(*)[3])(&faces[offset_faces] + (*((u16*)&data[curoffset + 3*sizeof(u16)]))*3);
+                    if (matid == -1)
+                        rbs[offset_rbs + k].material = NULL;
+                    else
+                        rbs[offset_rbs + k].material = &mats[matid];
+                }
+
+                offset_verts += toc_geo.vertdata_size/(sizeof(f32));
+                offset_faces += toc_geo.facedata_size/(sizeof(u16));
+                offset_rbs += toc_geo.dldata_slotcount;
+                offset_gfx += 1;
+            #endif
+        }
         offset_strings += strlen(meshes[i].name)+1;
     }
     #ifdef LIBDRAGON
@@ -1334,8 +1724,14 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
         anims[i].name = strings+offset_strings;
         strcpy(strings+offset_strings, animdatas[i].name);
         *(u32*)&anims[i].keyframecount = animdatas[i].kfcount;
+        memcpy((f32*)anims[i].bounds, animdatas[i].bounds, sizeof(f32)*4);
         anims[i].keyframes = &keyframes[offset_keyframes];
         
+        // Copy the frame lookup table
+        memcpy(&framelookup[offset_framelookup], animdatas[i].framelookup, sizeof(u16)*animdatas[i].framecount);
+        anims[i].framelookup = &framelookup[offset_framelookup];
+        offset_framelookup += animdatas[i].framecount;
+        
         // Copy the s64KeyFrame
         for (j=0; j<animdatas[i].kfcount; j++)
         {
@@ -1363,6 +1759,7 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
         mdl->_matscleanup = mats;
         mdl->_matscount = header.count_materials;
     #endif
+    mdl->baked = NULL;
 
     // Initialize the display lists for Libdragon
     #ifdef LIBDRAGON
@@ -1398,11 +1795,13 @@ s64ModelData* sausage64_load_binarymodel(char* filepath, sprite_t** textures)
 
 void sausage64_unload_binarymodel(s64ModelData* mdl)
 {
+    sausage64_unbake_anims(mdl);
+    
     // Because all the data is malloc'd sequentially, to free, we just need to free the first instance of everything
     if (mdl->meshcount > 0)
     {
+        int i;
         #ifdef LIBDRAGON
-            int i;
             s64Texture* firsttex = NULL;
             s64PrimColor* firstprimcol = NULL;
             for (i=0; i<mdl->_matscount; i++)
@@ -1437,6 +1836,14 @@ void sausage64_unload_binarymodel(s64ModelData* mdl)
         #else
             free(mdl->_vtxcleanup);
         #endif
+        for (i=0; i<mdl->meshcount; i++)
+        {
+            if (mdl->meshes[i].lods != NULL)
+            {
+                free((s64MeshLOD*)mdl->meshes[i].lods);
+                break;
+            }
+        }
         free((char*)mdl->meshes[0].name);
         free((s64Gfx*)mdl->meshes[0].dl);
         free((s64Mesh*)mdl->meshes);
@@ -1445,6 +1852,7 @@ void sausage64_unload_binarymodel(s64ModelData* mdl)
     {
         free((s64Transform*)mdl->anims[0].keyframes[0].framedata);
         free((s64KeyFrame*)mdl->anims[0].keyframes);
+        free((u16*)mdl->anims[0].framelookup);
         free((s64Animation*)mdl->anims);
     }
     free(mdl);
@@ -1473,6 +1881,11 @@ s64ModelHelper* sausage64_inithelper(s64ModelData* mdldata)
     // Initialize the newly allocated structure
     mdl->interpolate = TRUE;
     mdl->loop = TRUE;
+    mdl->cull = FALSE;
+    mdl->cullstats.meshes_drawn = 0;
+    mdl->cullstats.meshes_culled = 0;
+    mdl->cullstats.model_culled = FALSE;
+    mdl->posecache = NULL;
     mdl->rendercount = 1;
     mdl->predraw = NULL;
     mdl->postdraw = NULL;
@@ -1502,11 +1915,24 @@ s64ModelHelper* sausage64_inithelper(s64ModelData* mdldata)
         return NULL;
     }
 
-    // Allocate space for the model matrices in Libultra
+    // Allocate space for the LOD levels of each mesh
+    mdl->lodlevels = (u8*)calloc(sizeof(u8)*mdldata->meshcount, 1);
+    if (mdl->lodlevels == NULL)
+    {
+        free(mdl->transforms);
+        free(mdl);
+        return NULL;
+    }
+
+    // Allocate space for the model matrices in Libultra, one set per buffered frame
     #ifndef LIBDRAGON
-        mdl->matrix = (Mtx*)malloc(sizeof(Mtx)*1); // TODO: Handle frame buffering properly. Will require a better API
+        mdl->mtxbuffer = 0;
+        mdl->mtxauto = TRUE;
+        mdl->mtxload = FALSE;
+        mdl->matrix = (Mtx*)malloc(sizeof(Mtx)*mdldata->meshcount*S64_MTXBUFFERS);
         if (mdl->matrix == NULL)
         {
+            free(mdl->lodlevels);
             free(mdl->transforms);
             free(mdl);
             return NULL;
@@ -1555,19 +1981,92 @@ inline void sausage64_set_animcallback(s64ModelHelper* mdl, void (*animcallback)
 }
 
 
+/*==============================
+    sausage64_set_culling
+    Sets whether meshes outside the camera's view
+    should be skipped when drawing. Disabled by default
+    @param The model helper pointer
+    @param Whether to cull or not
+==============================*/
+
+inline void sausage64_set_culling(s64ModelHelper* mdl, u8 cull)
+{
+    mdl->cull = cull;
+}
+
+
+/*==============================
+    sausage64_set_posecache
+    Sets the pose cache that the helper should share its
+    animation transforms with
+    @param The model helper pointer
+    @param The pose cache to use, or NULL to disable
+==============================*/
+
+inline void sausage64_set_posecache(s64ModelHelper* mdl, s64PoseCache* cache)
+{
+    mdl->posecache = cache;
+}
+
+
+#ifndef LIBDRAGON
+
+    /*==============================
+        sausage64_set_mtxbuffer
+        Sets which matrix buffer the next draw call will use,
+        and disables automatic buffer cycling
+        @param The model helper pointer
+        @param The current frame number
+    ==============================*/
+
+    inline void sausage64_set_mtxbuffer(s64ModelHelper* mdl, u32 frame)
+    {
+        mdl->mtxbuffer = frame%S64_MTXBUFFERS;
+        mdl->mtxauto = FALSE;
+    }
+    
+    
+    /*==============================
+        sausage64_set_rootmatrix
+        Sets the modelview matrix at the model's root, so that
+        each mesh's matrix is composed with it on the CPU and
+        loaded directly, instead of multiplied onto the stack
+        @param The model helper pointer
+        @param The root modelview matrix, or NULL to go back
+               to multiplying onto the matrix stack
+    ==============================*/
+
+    void sausage64_set_rootmatrix(s64ModelHelper* mdl, Mtx* root)
+    {
+        if (root == NULL)
+        {
+            mdl->mtxload = FALSE;
+            return;
+        }
+        guMtxL2F(mdl->rootmtx, root);
+        mdl->mtxload = TRUE;
+    }
+    
+#endif
+
+
 #ifndef LIBDRAGON
     
     /*==============================
         sausage64_set_camera
         Sets the camera for Sausage64 to use for billboarding
-        @param The view matrix
+        @param The view matrix. For culling and LODs, this must
+               be relative to the model's root
         @param The projection matrix
     ==============================*/
 
     void sausage64_set_camera(Mtx* view, Mtx* projection)
     {
+        f32 viewproj[4][4];
         guMtxL2F(s64_viewmat, view);
         guMtxL2F(s64_projmat, projection);
+        guMtxCatF(s64_viewmat, s64_projmat, viewproj);
+        s64calc_frustum(viewproj);
     }
 #else
     
@@ -1583,6 +2082,33 @@ inline void sausage64_set_animcallback(s64ModelHelper* mdl, void (*animcallback)
         s64_campos[1] = campos[1];
         s64_campos[2] = campos[2];
     }
+    
+    
+    /*==============================
+        sausage64_set_frustum
+        Sets the view and projection matrices for Sausage64 
+        to use for frustum culling
+        @param The view matrix, relative to the model's root
+        @param The projection matrix
+    ==============================*/
+    
+    void sausage64_set_frustum(Mtx view, Mtx projection)
+    {
+        int i, j, k;
+        f32 viewproj[4][4];
+        
+        // OpenGL's column major matrices have the same layout as Libultra's, so the multiplication order is the same
+        for (i=0; i<4; i++)
+        {
+            for (j=0; j<4; j++)
+            {
+                viewproj[i][j] = 0;
+                for (k=0; k<4; k++)
+                    viewproj[i][j] += view[i][k]*projection[k][j];
+            }
+        }
+        s64calc_frustum(viewproj);
+    }
 #endif
 
 
@@ -1601,8 +2127,20 @@ static void sausage64_update_animplay(s64AnimPlay* playing)
     u32 nextkf_index = (curkf_index+1)%(anim->keyframecount);
     const u32 curkf_value = anim->keyframes[curkf_index].framenumber;
     
+    // If we have a lookup table, then the keyframe can be found immediately
+    if (anim->framelookup != NULL)
+    {
+        const u32 lastframe = anim->keyframes[anim->keyframecount-1].framenumber;
+        u32 frame = (curtick > 0) ? (u32)curtick : 0;
+        if (frame > lastframe)
+            frame = lastframe;
+        playing->curkeyframe = anim->framelookup[frame];
+        return;
+    }
+    
     // Check if we changed animation frame
-    if (curtick < curkf_value || curtick >= anim->keyframes[nextkf_index].framenumber)
+    // The last keyframe has no next one, so it's only left when going backwards
+    if (curtick < curkf_value || (nextkf_index != 0 && curtick >= anim->keyframes[nextkf_index].framenumber))
     {
         int advance = 1;
         if (curtick < curkf_value)
@@ -1612,8 +2150,8 @@ static void sausage64_update_animplay(s64AnimPlay* playing)
         do
         {
             curkf_index += advance;
-            nextkf_index += advance;
-            if (curtick >= anim->keyframes[curkf_index].framenumber && curtick < anim->keyframes[nextkf_index].framenumber)
+            nextkf_index = curkf_index+1;
+            if (curtick >= anim->keyframes[curkf_index].framenumber && (nextkf_index == anim->keyframecount || curtick < anim->keyframes[nextkf_index].framenumber))
             {
                 playing->curkeyframe = curkf_index;
                 return;
@@ -1742,6 +2280,57 @@ void sausage64_set_anim_blend(s64ModelHelper* mdl, u16 anim, f32 ticks)
 }
 
 
+/*==============================
+    sausage64_set_anim_time
+    Jumps to a specific tick of the current animation. The
+    tick is wrapped if the model is looping, otherwise it is
+    clamped. Does not call the animation end callback.
+    @param The model helper pointer
+    @param The tick to jump to
+==============================*/
+
+void sausage64_set_anim_time(s64ModelHelper* mdl, f32 tick)
+{
+    s64AnimPlay* const playing = &mdl->curanim;
+    const s64Animation* anim = playing->animdata;
+    f32 animlength;
+    if (anim == NULL || anim->keyframecount == 0)
+        return;
+    animlength = (f32)anim->keyframes[anim->keyframecount-1].framenumber;
+    
+    // Bring the tick into the animation's range
+    if (animlength <= 0)
+    {
+        playing->curtick = 0;
+        playing->curkeyframe = 0;
+        return;
+    }
+    else if (tick < 0 || tick >= animlength)
+    {
+        if (mdl->loop)
+        {
+            f32 division = tick/animlength;
+            tick = (division - ((int)division))*animlength;
+            if (tick < 0)
+                tick += animlength;
+        }
+        else if (tick >= animlength)
+        {
+            // Stop at the last keyframe, as there's no next keyframe for the search below to find
+            playing->curtick = animlength;
+            playing->curkeyframe = anim->keyframecount-1;
+            return;
+        }
+        else
+            tick = 0;
+    }
+    
+    // Find the keyframe we landed on
+    playing->curtick = tick;
+    sausage64_update_animplay(playing);
+}
+
+
 #ifdef LIBDRAGON
     /*==============================
         sausage64_loadmaterial
@@ -2036,39 +2625,403 @@ void sausage64_lookat(s64ModelHelper* mdl, const u16 mesh, f32 dir[3], f32 amoun
 
 
 /*==============================
-    sausage64_drawpart
-    Renders a part of a Sausage64 model
-    @param A pointer to a display list pointer
+    sausage64_get_meshlod
+    Get the LOD level that was last used to draw a mesh
+    @param  The model helper pointer
+    @param  The mesh to check
+    @return The LOD level (0 is full detail)
+==============================*/
+
+u32 sausage64_get_meshlod(s64ModelHelper* mdl, const u16 mesh)
+{
+    return mdl->lodlevels[mesh];
+}
+
+
+/*==============================
+    sausage64_calcmeshbounds
+    Calculates where a mesh's bounding sphere currently is
     @param The model helper to use
-    @param The mesh to render
+    @param The mesh to get the bounding sphere of
+    @param The vector to store the sphere's center in,
+           relative to the model's root
+    @param The float to store the sphere's radius in
 ==============================*/
 
-#ifndef LIBDRAGON
-    static inline void sausage64_drawpart(Gfx** glistp, s64ModelHelper* helper, u16 mesh)
-    {
+static void sausage64_calcmeshbounds(s64ModelHelper* mdl, u16 mesh, f32 center[3], f32* radius)
+{
+    int i;
+    const s64Mesh* mdata = &mdl->mdldata->meshes[mesh];
+    
+    // Without an animation, the mesh is drawn as is
+    if (mdl->curanim.animdata == NULL)
+    {
+        center[0] = mdata->bounds[0];
+        center[1] = mdata->bounds[1];
+        center[2] = mdata->bounds[2];
+        *radius = mdata->bounds[3];
+    }
+    else
+    {
+        f32 scale = 0;
+        const s64Transform* fdata = &mdl->transforms[mesh].data;
+        
+        // Billboards can face any direction, so grow the sphere to cover every rotation around the mesh's origin instead
+        if (mdata->is_billboard)
+        {
+            center[0] = 0;
+            center[1] = 0;
+            center[2] = 0;
+            *radius = mdata->bounds[3] + sqrtf(mdata->bounds[0]*mdata->bounds[0] + mdata->bounds[1]*mdata->bounds[1] + mdata->bounds[2]*mdata->bounds[2]);
+        }
+        else
+        {
+            s64Quat q = {fdata->rot[0], fdata->rot[1], fdata->rot[2], fdata->rot[3]};
+            s64vec_rotate((f32*)mdata->bounds, q, center);
+            *radius = mdata->bounds[3];
+        }
+        
+        // Apply the scale and translation
+        for (i=0; i<3; i++)
+        {
+            f32 axisscale = (fdata->scale[i] < 0) ? -fdata->scale[i] : fdata->scale[i];
+            center[i] = fdata->pos[i] + center[i]*fdata->scale[i];
+            if (axisscale > scale)
+                scale = axisscale;
+        }
+        *radius *= scale;
+    }
+}
+
+
+/*==============================
+    sausage64_calclod
+    Picks the LOD of a mesh to draw, based on how
+    much of the screen its bounding sphere covers
+    @param  The model helper to use
+    @param  The mesh to pick the LOD of
+    @param  The center of the mesh's bounding sphere
+    @param  The radius of the mesh's bounding sphere
+    @return The display list to render
+==============================*/
+
+static const s64Gfx* sausage64_calclod(s64ModelHelper* mdl, u16 mesh, f32 center[3], f32 radius)
+{
+    f32 size;
+    u32 lod = mdl->lodlevels[mesh];
+    const s64Mesh* mdata = &mdl->mdldata->meshes[mesh];
+    
+    // Meshes without LODs are always drawn at full detail
+    if (mdata->lodcount == 0 || radius <= 0)
+        return mdata->dl;
+    
+    // Pick the LOD, only going back to higher detail once the mesh is noticeably bigger than the LOD's threshold to prevent popping
+    size = s64calc_screensize(center, radius);
+    if (size < 0)
+        lod = 0;
+    else
+    {
+        while (lod < mdata->lodcount && size < mdata->lods[lod].screensize)
+            lod++;
+        while (lod > 0 && size > mdata->lods[lod-1].screensize*(1.0f + S64_LOD_HYSTERESIS))
+            lod--;
+    }
+    mdl->lodlevels[mesh] = lod;
+    
+    // Return the display list of the LOD
+    if (lod == 0)
+        return mdata->dl;
+    return mdata->lods[lod-1].dl;
+}
+
+
+/*==============================
+    sausage64_calcvisiblesphere
+    Checks whether a mesh should be drawn, and picks its LOD,
+    given the mesh's bounding sphere
+    @param  The model helper to use
+    @param  The mesh to check
+    @param  The center of the mesh's bounding sphere
+    @param  The radius of the mesh's bounding sphere
+    @return The display list to render, or NULL if the
+            mesh was culled
+==============================*/
+
+static const s64Gfx* sausage64_calcvisiblesphere(s64ModelHelper* mdl, u16 mesh, f32 center[3], f32 radius)
+{
+    // Meshes without a bounding sphere can't be culled
+    if (mdl->cull && radius > 0 && !s64calc_spherevisible(center, radius))
+    {
+        mdl->cullstats.meshes_culled++;
+        return NULL;
+    }
+    mdl->cullstats.meshes_drawn++;
+    return sausage64_calclod(mdl, mesh, center, radius);
+}
+
+
+/*==============================
+    sausage64_calcvisible
+    Checks whether a mesh should be drawn, and picks its LOD
+    @param  The model helper to use
+    @param  The mesh to check
+    @return The display list to render, or NULL if the
+            mesh was culled
+==============================*/
+
+static const s64Gfx* sausage64_calcvisible(s64ModelHelper* mdl, u16 mesh)
+{
+    f32 center[3];
+    f32 radius;
+    sausage64_calcmeshbounds(mdl, mesh, center, &radius);
+    return sausage64_calcvisiblesphere(mdl, mesh, center, radius);
+}
+
+
+/*==============================
+    sausage64_calcanimvisible
+    Checks whether an animation's bounding sphere, which holds
+    the entire model during the animation, is visible
+    @param  The animation to check
+    @return Whether the animation is visible, or TRUE if
+            it has no bounding sphere
+==============================*/
+
+static inline u8 sausage64_calcanimvisible(const s64Animation* anim)
+{
+    if (anim == NULL || anim->bounds[3] <= 0)
+        return TRUE;
+    return s64calc_spherevisible((f32*)anim->bounds, anim->bounds[3]);
+}
+
+
+/*==============================
+    sausage64_calcmodelculled
+    Checks whether the entire model is outside the camera's
+    view, and resets the culling statistics
+    @param  The model helper to use
+    @return Whether the model was culled
+==============================*/
+
+static u8 sausage64_calcmodelculled(s64ModelHelper* mdl)
+{
+    mdl->cullstats.meshes_drawn = 0;
+    mdl->cullstats.meshes_culled = 0;
+    mdl->cullstats.model_culled = FALSE;
+    if (!mdl->cull || mdl->curanim.animdata == NULL)
+        return FALSE;
+    
+    // If we're blending, then the model is visible if either animation is
+    if (sausage64_calcanimvisible(mdl->curanim.animdata))
+        return FALSE;
+    if (mdl->blendticks_left > 0 && sausage64_calcanimvisible(mdl->blendanim.animdata))
+        return FALSE;
+    
+    // The whole model is off screen
+    mdl->cullstats.meshes_culled = mdl->mdldata->meshcount;
+    mdl->cullstats.model_culled = TRUE;
+    mdl->rendercount++;
+    return TRUE;
+}
+
+
+/*==============================
+    sausage64_calcbaked
+    Checks whether the helper can use the model's baked 
+    animation matrices this frame
+    @param  The model helper to use
+    @param  A pointer to store the baked frame index in
+    @return The baked animation, or NULL
+==============================*/
+
+static const s64BakedAnim* sausage64_calcbaked(s64ModelHelper* mdl, u32* frame)
+{
+    const s64BakedAnim* baked;
+    const s64ModelData* mdata = mdl->mdldata;
+    if (mdata->baked == NULL || mdl->curanim.animdata == NULL || mdl->blendticks_left > 0)
+        return NULL;
+    #ifndef LIBDRAGON
+        if (mdl->mtxload)
+            return NULL;
+    #endif
+    baked = &mdata->baked[mdl->curanim.animdata - mdata->anims];
+    if (baked->framecount == 0)
+        return NULL;
+    *frame = (mdl->curanim.curtick > 0) ? (u32)mdl->curanim.curtick : 0;
+    if (*frame >= baked->framecount)
+        *frame = baked->framecount-1;
+    return baked;
+}
+
+
+/*==============================
+    s64calc_quantizetick
+    Snaps an animation tick to the pose cache's step
+    @param  The tick to snap
+    @param  The quantization step
+    @return The snapped tick
+==============================*/
+
+static inline f32 s64calc_quantizetick(f32 tick, f32 step)
+{
+    if (step <= 0)
+        return tick;
+    return ((f32)((s32)(tick/step)))*step;
+}
+
+
+/*==============================
+    sausage64_calcposecache
+    Fills the helper's transforms from its pose cache, 
+    calculating and storing the pose if it wasn't cached.
+    Meshes whose transforms were already calculated this
+    frame (for instance, by sausage64_lookat) are left alone
+    @param The model helper to use
+==============================*/
+
+static void sausage64_calcposecache(s64ModelHelper* mdl)
+{
+    u16 i;
+    s64PoseCache* cache = mdl->posecache;
+    s64PoseCacheEntry* entry = NULL;
+    s64AnimPlay cur = mdl->curanim;
+    s64AnimPlay blend = mdl->blendanim;
+    f32 blendleft = 0;
+    const u8 blending = (mdl->blendticks_left > 0);
+    if (cur.animdata->keyframecount == 0 || (blending && blend.animdata->keyframecount == 0))
+        return;
+    
+    // A cache built for a model with a different mesh count can't be used
+    if (mdl->mdldata->meshcount != cache->meshcount)
+        return;
+    
+    // Build the cache key by snapping the animation ticks
+    cur.curtick = s64calc_quantizetick(cur.curtick, cache->quantize);
+    sausage64_update_animplay(&cur);
+    if (blending)
+    {
+        blend.curtick = s64calc_quantizetick(blend.curtick, cache->quantize);
+        sausage64_update_animplay(&blend);
+        blendleft = s64calc_quantizetick(mdl->blendticks_left, cache->quantize);
+        if (blendleft <= 0)
+            blendleft = mdl->blendticks_left;
+    }
+    else
+        blend.animdata = NULL;
+    cache->usecount++;
+        
+    // Look for the pose in the cache, keeping track of the least recently used entry in case we miss
+    for (i=0; i<cache->entrycount; i++)
+    {
+        s64PoseCacheEntry* check = &cache->entries[i];
+        if (check->anim == cur.animdata && check->tick == cur.curtick && check->blendanim == blend.animdata && 
+            check->interpolate == mdl->interpolate && (!blending || (check->blendtick == blend.curtick && check->blendleft == blendleft && check->blendticks == mdl->blendticks)))
+        {
+            check->lastused = cache->usecount;
+            cache->hits++;
+            for (i=0; i<cache->meshcount; i++)
+            {
+                s64FrameTransform* trans = &mdl->transforms[i];
+                if (trans->rendercount == mdl->rendercount)
+                    continue;
+                trans->data = check->transforms[i];
+                trans->rendercount = mdl->rendercount;
+            }
+            return;
+        }
+        if (entry == NULL || check->lastused < entry->lastused)
+            entry = check;
+    }
+    
+    // Cache miss, so calculate the pose with the snapped ticks and store it in the least recently used entry
+    // The helper's animation state is swapped temporarily so the usual transform calculation can be reused
+    cache->misses++;
+    entry->anim = cur.animdata;
+    entry->blendanim = blend.animdata;
+    entry->tick = cur.curtick;
+    entry->blendtick = blend.curtick;
+    entry->blendleft = blendleft;
+    entry->blendticks = blending ? mdl->blendticks : 0;
+    entry->interpolate = mdl->interpolate;
+    entry->lastused = cache->usecount;
+    {
+        const s64AnimPlay oldcur = mdl->curanim;
+        const s64AnimPlay oldblend = mdl->blendanim;
+        const f32 oldblendleft = mdl->blendticks_left;
+        f32 l, bl = 0;
+        mdl->curanim = cur;
+        mdl->blendanim = blend;
+        mdl->blendticks_left = blendleft;
+        l = sausage64_calcanimlerp(&mdl->curanim);
+        if (blending)
+            bl = sausage64_calcanimlerp(&mdl->blendanim);
+        for (i=0; i<cache->meshcount; i++)
+        {
+            s64FrameTransform* trans = &mdl->transforms[i];
+            const u8 done = (trans->rendercount == mdl->rendercount);
+            const s64Transform saved = trans->data;
+            trans->rendercount = mdl->rendercount-1;
+            sausage64_calcanimtransforms(mdl, i, l, bl);
+            entry->transforms[i] = trans->data;
+            if (done)
+                trans->data = saved;
+        }
+        mdl->curanim = oldcur;
+        mdl->blendanim = oldblend;
+        mdl->blendticks_left = oldblendleft;
+    }
+}
+
+
+/*==============================
+    sausage64_drawpart
+    Renders a part of a Sausage64 model
+    @param (Libultra) A pointer to a display list pointer
+    @param The display list to render
+    @param The model helper to use
+    @param The mesh to render
+==============================*/
+
+#ifndef LIBDRAGON
+    static inline void sausage64_drawpart(Gfx** glistp, const Gfx* dl, s64ModelHelper* helper, u16 mesh)
+    {
         f32 helper1[4][4];
-        f32 helper2[4][4];
         s64Transform* fdata = &helper->transforms[mesh].data;
+        Mtx* mtx = &helper->matrix[helper->mtxbuffer*helper->mdldata->meshcount + mesh];
+        const u8 billboard = helper->mdldata->meshes[mesh].is_billboard;
         
-        // Combine the translation and scale matrix
-        guTranslateF(helper1, fdata->pos[0], fdata->pos[1], fdata->pos[2]);
-        guScaleF(helper2, fdata->scale[0], fdata->scale[1], fdata->scale[2]);
-        guMtxCatF(helper2, helper1, helper1);
+        // Meshes that aren't transformed don't need a matrix of their own
+        if (!billboard && s64calc_isidentity(fdata))
+        {
+            if (helper->mtxload && !s64_rootloaded)
+            {
+                guMtxF2L(helper->rootmtx, mtx);
+                gSPMatrix((*glistp)++, OS_K0_TO_PHYSICAL(mtx), G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH);
+                s64_rootloaded = TRUE;
+            }
+            gSPDisplayList((*glistp)++, dl);
+            return;
+        }
         
-        // Combine the rotation matrix
-        if (!helper->mdldata->meshes[mesh].is_billboard)
+        // Generate the fixed point matrix directly, premultiplied with the root matrix if we're loading matrices
+        if (billboard)
         {
-            s64Quat q = {fdata->rot[0], fdata->rot[1], fdata->rot[2], fdata->rot[3]};
-            s64quat_to_mtx(q, helper2);
+            s64calc_billboard(helper1);
+            s64calc_fixedmtx(mtx, fdata, helper1, helper->mtxload ? helper->rootmtx : NULL);
         }
         else
-            s64calc_billboard(helper2);
-        guMtxCatF(helper2, helper1, helper1);
+            s64calc_fixedmtx(mtx, fdata, NULL, helper->mtxload ? helper->rootmtx : NULL);
+        if (helper->mtxload)
+        {
+            gSPMatrix((*glistp)++, OS_K0_TO_PHYSICAL(mtx), G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH);
+            gSPDisplayList((*glistp)++, dl);
+            s64_rootloaded = FALSE;
+            return;
+        }
         
         // Draw the body part
-        guMtxF2L(helper1, &helper->matrix[mesh]);
-        gSPMatrix((*glistp)++, OS_K0_TO_PHYSICAL(&helper->matrix[mesh]), G_MTX_MODELVIEW | G_MTX_MUL | G_MTX_PUSH);
-        gSPDisplayList((*glistp)++, helper->mdldata->meshes[mesh].dl);
+        gSPMatrix((*glistp)++, OS_K0_TO_PHYSICAL(mtx), G_MTX_MODELVIEW | G_MTX_MUL | G_MTX_PUSH);
+        gSPDisplayList((*glistp)++, dl);
         gSPPopMatrix((*glistp)++, G_MTX_MODELVIEW);
     }
 #else
@@ -2098,6 +3051,32 @@ void sausage64_lookat(s64ModelHelper* mdl, const u16 mesh, f32 dir[3], f32 amoun
 #endif
 
 
+/*==============================
+    sausage64_drawbaked
+    Renders a part of a Sausage64 model using a baked matrix
+    @param (Libultra) A pointer to a display list pointer
+    @param The display list to render
+    @param The baked matrix to use
+==============================*/
+
+#ifndef LIBDRAGON
+    static inline void sausage64_drawbaked(Gfx** glistp, const Gfx* dl, Mtx* mtx)
+    {
+        gSPMatrix((*glistp)++, OS_K0_TO_PHYSICAL(mtx), G_MTX_MODELVIEW | G_MTX_MUL | G_MTX_PUSH);
+        gSPDisplayList((*glistp)++, dl);
+        gSPPopMatrix((*glistp)++, G_MTX_MODELVIEW);
+    }
+#else
+    static inline void sausage64_drawbaked(const s64Gfx* dl, Mtx* mtx)
+    {
+        glPushMatrix();
+        glMultMatrixf(&(*mtx)[0][0]);
+        glCallList(dl->guid_mdl);
+        glPopMatrix();
+    }
+#endif
+
+
 /*==============================
     sausage64_drawmodel
     Renders a Sausage64 model
@@ -2114,6 +3093,22 @@ void sausage64_lookat(s64ModelHelper* mdl, const u16 mesh, f32 dir[3], f32 amoun
         const s64ModelData* mdata = mdl->mdldata;
         const u16 mcount = mdata->meshcount;
         const s64Animation* anim = mdl->curanim.animdata;
+        const s64BakedAnim* baked;
+        u32 frame = 0;
+        
+        // Move onto the next matrix buffer, so that we don't overwrite matrices the RSP might still be reading
+        if (mdl->mtxauto)
+            mdl->mtxbuffer = (mdl->mtxbuffer+1)%S64_MTXBUFFERS;
+        s64_rootloaded = FALSE;
+        
+        // Skip the entire model if it's off screen
+        if (sausage64_calcmodelculled(mdl))
+            return;
+        
+        // Use the baked matrices if we can, otherwise grab the pose from the shared cache if we have one
+        baked = sausage64_calcbaked(mdl, &frame);
+        if (anim != NULL && baked == NULL && mdl->posecache != NULL)
+            sausage64_calcposecache(mdl);
     
         // If we have a valid animation, get the lerp value
         if (anim != NULL)
@@ -2131,14 +3126,29 @@ void sausage64_lookat(s64ModelHelper* mdl, const u16 mesh, f32 dir[3], f32 amoun
                 if (!mdl->predraw(i))
                     continue;
             
-            // Draw this part of the model
-            if (anim != NULL)
+            // Draw this part of the model, if it's visible
+            // Baked meshes skip the transform calculations, unless they were already calculated (and maybe modified) this frame
+            if (baked != NULL && !mdata->meshes[i].is_billboard && mdl->transforms[i].rendercount != mdl->rendercount)
+            {
+                const u32 index = frame*mcount + i;
+                const Gfx* dl = sausage64_calcvisiblesphere(mdl, i, baked->bounds[index], baked->bounds[index][3]);
+                if (dl != NULL)
+                    sausage64_drawbaked(glistp, dl, &baked->matrices[index]);
+            }
+            else if (anim != NULL)
             {
+                const Gfx* dl;
                 sausage64_calcanimtransforms(mdl, i, l, bl);
-                sausage64_drawpart(glistp, mdl, i);
+                dl = sausage64_calcvisible(mdl, i);
+                if (dl != NULL)
+                    sausage64_drawpart(glistp, dl, mdl, i);
             }
             else
-                gSPDisplayList((*glistp)++, mdata->meshes[i].dl);
+            {
+                const Gfx* dl = sausage64_calcvisible(mdl, i);
+                if (dl != NULL)
+                    gSPDisplayList((*glistp)++, dl);
+            }
         
             // Call the post draw function
             if (mdl->postdraw != NULL)
@@ -2156,6 +3166,17 @@ void sausage64_lookat(s64ModelHelper* mdl, const u16 mesh, f32 dir[3], f32 amoun
         const s64ModelData* mdata = mdl->mdldata;
         const u16 mcount = mdata->meshcount;
         const s64Animation* anim = mdl->curanim.animdata;
+        const s64BakedAnim* baked;
+        u32 frame = 0;
+        
+        // Skip the entire model if it's off screen
+        if (sausage64_calcmodelculled(mdl))
+            return;
+        
+        // Use the baked matrices if we can, otherwise grab the pose from the shared cache if we have one
+        baked = sausage64_calcbaked(mdl, &frame);
+        if (anim != NULL && baked == NULL && mdl->posecache != NULL)
+            sausage64_calcposecache(mdl);
 
         // Initialize OpenGL state
         glEnableClientState(GL_VERTEX_ARRAY);
@@ -2174,21 +3195,34 @@ void sausage64_lookat(s64ModelHelper* mdl, const u16 mesh, f32 dir[3], f32 amoun
         // Iterate through each mesh
         for (i=0; i<mcount; i++)
         {
-            const s64Gfx* dl = mdl->mdldata->meshes[i].dl;
-            
             // Call the pre draw function
             if (mdl->predraw != NULL)
                 if (!mdl->predraw(i))
                     continue;
             
-            // Draw this part of the model
-            if (anim != NULL)
+            // Draw this part of the model, if it's visible
+            // Baked meshes skip the transform calculations, unless they were already calculated (and maybe modified) this frame
+            if (baked != NULL && !mdata->meshes[i].is_billboard && mdl->transforms[i].rendercount != mdl->rendercount)
             {
+                const u32 index = frame*mcount + i;
+                const s64Gfx* dl = sausage64_calcvisiblesphere(mdl, i, baked->bounds[index], baked->bounds[index][3]);
+                if (dl != NULL)
+                    sausage64_drawbaked(dl, &baked->matrices[index]);
+            }
+            else if (anim != NULL)
+            {
+                const s64Gfx* dl;
                 sausage64_calcanimtransforms(mdl, i, l, bl);
-                sausage64_drawpart(dl, mdl, i);
+                dl = sausage64_calcvisible(mdl, i);
+                if (dl != NULL)
+                    sausage64_drawpart(dl, mdl, i);
             }
             else
-                glCallList(dl->guid_mdl);
+            {
+                const s64Gfx* dl = sausage64_calcvisible(mdl, i);
+                if (dl != NULL)
+                    glCallList(dl->guid_mdl);
+            }
         
             // Call the post draw function
             if (mdl->postdraw != NULL)
@@ -2212,8 +3246,399 @@ void sausage64_lookat(s64ModelHelper* mdl, const u16 mesh, f32 dir[3], f32 amoun
 void sausage64_freehelper(s64ModelHelper* helper)
 {
     free(helper->transforms);
+    free(helper->lodlevels);
     #ifndef LIBDRAGON
         free(helper->matrix);
     #endif
     free(helper);
+}
+
+
+/*********************************
+        Animation Worlds
+*********************************/
+
+/*==============================
+    sausage64_initworld
+    Allocate an animation world, which advances and 
+    calculates the transforms of many model helpers at once
+    @param  The maximum number of helpers in the world
+    @return A newly allocated animation world
+==============================*/
+
+s64AnimWorld* sausage64_initworld(u16 size)
+{
+    s64AnimWorld* world = (s64AnimWorld*)malloc(sizeof(s64AnimWorld));
+    if (world == NULL)
+        return NULL;
+    world->count = 0;
+    world->size = size;
+    
+    // Allocate the per instance arrays
+    world->helpers = (s64ModelHelper**)malloc(sizeof(s64ModelHelper*)*size);
+    world->curframes = (const s64Transform**)malloc(sizeof(s64Transform*)*size);
+    world->nextframes = (const s64Transform**)malloc(sizeof(s64Transform*)*size);
+    world->lerps = (f32*)malloc(sizeof(f32)*size);
+    if (world->helpers == NULL || world->curframes == NULL || world->nextframes == NULL || world->lerps == NULL)
+    {
+        sausage64_freeworld(world);
+        return NULL;
+    }
+    return world;
+}
+
+
+/*==============================
+    sausage64_world_addhelper
+    Adds a model helper to an animation world
+    @param  The animation world
+    @param  The model helper to add
+    @return Whether the helper was added
+==============================*/
+
+u8 sausage64_world_addhelper(s64AnimWorld* world, s64ModelHelper* mdl)
+{
+    if (world->count == world->size)
+        return FALSE;
+    world->helpers[world->count++] = mdl;
+    return TRUE;
+}
+
+
+/*==============================
+    sausage64_world_removehelper
+    Removes a model helper from an animation world
+    @param The animation world
+    @param The model helper to remove
+==============================*/
+
+void sausage64_world_removehelper(s64AnimWorld* world, s64ModelHelper* mdl)
+{
+    u16 i;
+    for (i=0; i<world->count; i++)
+    {
+        if (world->helpers[i] == mdl)
+        {
+            world->helpers[i] = world->helpers[--world->count];
+            return;
+        }
+    }
+}
+
+
+/*==============================
+    sausage64_calcworldgroup
+    Calculates the mesh transforms of a group of helpers 
+    which are playing the same animation, one mesh at a 
+    time, so that the animation's data for that mesh stays
+    in the data cache. Only the keyframe pointers and lerp
+    amounts are stored in the world's arrays, the results
+    are still written to each helper's own transforms
+    @param The animation world
+    @param The first helper of the group
+    @param The helper after the end of the group
+==============================*/
+
+static void sausage64_calcworldgroup(s64AnimWorld* world, u16 start, u16 end)
+{
+    u16 i, mesh;
+    const s64ModelData* mdata = world->helpers[start]->mdldata;
+    
+    for (mesh=0; mesh<mdata->meshcount; mesh++)
+    {
+        const u8 billboard = mdata->meshes[mesh].is_billboard;
+        
+        // Positions and scales
+        for (i=start; i<end; i++)
+        {
+            const s64Transform* cfdata = &world->curframes[i][mesh];
+            const s64Transform* nfdata = &world->nextframes[i][mesh];
+            s64FrameTransform* trans = &world->helpers[i]->transforms[mesh];
+            const f32 l = world->lerps[i];
+            trans->data.pos[0] = s64lerp(cfdata->pos[0], nfdata->pos[0], l);
+            trans->data.pos[1] = s64lerp(cfdata->pos[1], nfdata->pos[1], l);
+            trans->data.pos[2] = s64lerp(cfdata->pos[2], nfdata->pos[2], l);
+            trans->data.scale[0] = s64lerp(cfdata->scale[0], nfdata->scale[0], l);
+            trans->data.scale[1] = s64lerp(cfdata->scale[1], nfdata->scale[1], l);
+            trans->data.scale[2] = s64lerp(cfdata->scale[2], nfdata->scale[2], l);
+            trans->rendercount = world->helpers[i]->rendercount;
+        }
+        
+        // Rotations
+        if (billboard)
+            continue;
+        for (i=start; i<end; i++)
+        {
+            const s64Transform* cfdata = &world->curframes[i][mesh];
+            const s64Transform* nfdata = &world->nextframes[i][mesh];
+            s64Transform* fdata = &world->helpers[i]->transforms[mesh].data;
+            s64Quat q =  {cfdata->rot[0], cfdata->rot[1], cfdata->rot[2], cfdata->rot[3]};
+            s64Quat qn = {nfdata->rot[0], nfdata->rot[1], nfdata->rot[2], nfdata->rot[3]};
+            q = s64slerp(q, qn, world->lerps[i]);
+            fdata->rot[0] = q.w;
+            fdata->rot[1] = q.x;
+            fdata->rot[2] = q.y;
+            fdata->rot[3] = q.z;
+        }
+    }
+}
+
+
+/*==============================
+    sausage64_advance_world
+    Advances the animation of every helper in the world,
+    and calculates all of their mesh transforms so that
+    sausage64_drawmodel doesn't have to. Helpers which were
+    culled last frame, are blending, have interpolation
+    disabled, or can use the model's baked matrices are left
+    to calculate their transforms when drawn, as usual.
+    @param The animation world
+    @param The amount to increase the animation ticks by
+==============================*/
+
+void sausage64_advance_world(s64AnimWorld* world, f32 tickamount)
+{
+    u16 i, start, batched;
+    
+    // Advance all the animation clocks
+    for (i=0; i<world->count; i++)
+        if (world->helpers[i]->curanim.animdata != NULL)
+            sausage64_advance_anim(world->helpers[i], tickamount);
+        
+    // Move the helpers which can be batched to the front of the list, sorted by animation
+    // Since helpers rarely change animation, the list is usually already sorted, so insertion sort is fine
+    batched = 0;
+    for (i=0; i<world->count; i++)
+    {
+        s64ModelHelper* mdl = world->helpers[i];
+        u32 frame;
+        u16 j;
+        if (mdl->curanim.animdata == NULL || mdl->curanim.animdata->keyframecount == 0 || !mdl->interpolate || mdl->blendticks_left > 0 || mdl->cullstats.model_culled)
+            continue;
+        
+        // Helpers which will draw with baked matrices don't need their transforms, and stamping them would stop the baked matrices from being used
+        if (sausage64_calcbaked(mdl, &frame) != NULL)
+            continue;
+        world->helpers[i] = world->helpers[batched];
+        for (j=batched; j>0 && world->helpers[j-1]->curanim.animdata > mdl->curanim.animdata; j--)
+            world->helpers[j] = world->helpers[j-1];
+        world->helpers[j] = mdl;
+        batched++;
+    }
+    
+    // Gather the keyframes and lerp amounts of each batched helper
+    for (i=0; i<batched; i++)
+    {
+        const s64AnimPlay* playing = &world->helpers[i]->curanim;
+        const s64Animation* anim = playing->animdata;
+        world->curframes[i] = anim->keyframes[playing->curkeyframe].framedata;
+        world->nextframes[i] = anim->keyframes[(playing->curkeyframe+1)%anim->keyframecount].framedata;
+        world->lerps[i] = sausage64_calcanimlerp(playing);
+    }
+    
+    // Calculate the transforms, one animation at a time
+    start = 0;
+    for (i=1; i<=batched; i++)
+    {
+        if (i == batched || world->helpers[i]->curanim.animdata != world->helpers[start]->curanim.animdata)
+        {
+            sausage64_calcworldgroup(world, start, i);
+            start = i;
+        }
+    }
+}
+
+
+/*==============================
+    sausage64_freeworld
+    Frees the memory used up by an animation world
+    @param A pointer to the animation world
+==============================*/
+
+void sausage64_freeworld(s64AnimWorld* world)
+{
+    free(world->helpers);
+    free(world->curframes);
+    free(world->nextframes);
+    free(world->lerps);
+    free(world);
+}
+
+
+/*********************************
+          Pose Caches
+*********************************/
+
+/*==============================
+    sausage64_initposecache
+    Allocate a pose cache, which lets helpers that play the
+    same animation at the same tick share their transforms
+    @param  The model data that the helpers will use
+    @param  The number of poses to keep
+    @param  The step (in ticks) to snap animation ticks to.
+            Bigger steps give more cache hits, at the cost of
+            less precise animation timing. 0 for no snapping
+    @return A newly allocated pose cache
+==============================*/
+
+s64PoseCache* sausage64_initposecache(const s64ModelData* mdldata, u16 entries, f32 quantize)
+{
+    u16 i;
+    s64Transform* transforms;
+    s64PoseCache* cache = (s64PoseCache*)malloc(sizeof(s64PoseCache));
+    if (cache == NULL)
+        return NULL;
+    
+    // Allocate the entries, and the transforms for all of them in one go
+    cache->entries = (s64PoseCacheEntry*)malloc(sizeof(s64PoseCacheEntry)*entries);
+    transforms = (s64Transform*)malloc(sizeof(s64Transform)*mdldata->meshcount*entries);
+    if (entries == 0 || cache->entries == NULL || transforms == NULL)
+    {
+        free(transforms);
+        free(cache->entries);
+        free(cache);
+        return NULL;
+    }
+    
+    // Initialize the structure
+    cache->meshcount = mdldata->meshcount;
+    cache->entrycount = entries;
+    cache->quantize = quantize;
+    cache->usecount = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    for (i=0; i<entries; i++)
+    {
+        cache->entries[i].anim = NULL;
+        cache->entries[i].blendanim = NULL;
+        cache->entries[i].tick = -1;
+        cache->entries[i].lastused = 0;
+        cache->entries[i].transforms = &transforms[i*mdldata->meshcount];
+    }
+    return cache;
+}
+
+
+/*==============================
+    sausage64_freeposecache
+    Frees the memory used up by a pose cache. Make sure no
+    helpers are still using it.
+    @param A pointer to the pose cache
+==============================*/
+
+void sausage64_freeposecache(s64PoseCache* cache)
+{
+    free(cache->entries[0].transforms);
+    free(cache->entries);
+    free(cache);
+}
+
+
+/*********************************
+        Animation Baking
+*********************************/
+
+/*==============================
+    sausage64_bake_anims
+    Samples every frame of every animation of a model, and
+    stores the resulting matrices (and bounding spheres) of
+    each mesh. Helpers using this model will then draw 
+    them directly, without interpolation, whenever they're
+    not blending. Uses 80 bytes per mesh per frame.
+    @param  The model data to bake
+    @return Whether the animations were baked
+==============================*/
+
+u8 sausage64_bake_anims(s64ModelData* mdldata)
+{
+    u16 i, k;
+    u32 j, totalframes = 0, offset = 0;
+    const u16 mcount = mdldata->meshcount;
+    s64BakedAnim* baked;
+    Mtx* matrices;
+    f32 (*bounds)[4];
+    s64ModelHelper* helper;
+    if (mdldata->baked != NULL || mdldata->animcount == 0)
+        return TRUE;
+    
+    // Count how many frames we need to store
+    for (i=0; i<mdldata->animcount; i++)
+        if (mdldata->anims[i].keyframecount > 0)
+            totalframes += mdldata->anims[i].keyframes[mdldata->anims[i].keyframecount-1].framenumber + 1;
+    
+    // Allocate everything we need, including a helper to calculate the transforms with
+    baked = (s64BakedAnim*)malloc(sizeof(s64BakedAnim)*mdldata->animcount);
+    matrices = (Mtx*)malloc(sizeof(Mtx)*totalframes*mcount);
+    bounds = (f32(*)[4])malloc(sizeof(f32)*4*totalframes*mcount);
+    helper = sausage64_inithelper(mdldata);
+    if (baked == NULL || matrices == NULL || bounds == NULL || helper == NULL)
+    {
+        free(baked);
+        free(matrices);
+        free(bounds);
+        if (helper != NULL)
+            sausage64_freehelper(helper);
+        return FALSE;
+    }
+    helper->loop = FALSE;
+    
+    // Sample each frame of each animation
+    for (i=0; i<mdldata->animcount; i++)
+    {
+        const s64Animation* anim = &mdldata->anims[i];
+        baked[i].framecount = 0;
+        if (anim->keyframecount > 0)
+            baked[i].framecount = anim->keyframes[anim->keyframecount-1].framenumber + 1;
+        baked[i].matrices = &matrices[offset*mcount];
+        baked[i].bounds = &bounds[offset*mcount];
+        helper->curanim.animdata = anim;
+        helper->curanim.curkeyframe = 0;
+        for (j=0; j<baked[i].framecount; j++)
+        {
+            f32 l;
+            helper->curanim.curtick = (f32)j;
+            if (j == baked[i].framecount-1)
+                helper->curanim.curkeyframe = anim->keyframecount-1;
+            else
+                sausage64_update_animplay(&helper->curanim);
+            l = sausage64_calcanimlerp(&helper->curanim);
+            helper->rendercount++;
+            for (k=0; k<mcount; k++)
+            {
+                f32 mtx[4][4];
+                const u32 index = j*mcount + k;
+                sausage64_calcanimtransforms(helper, k, l, 0);
+                sausage64_calcmeshbounds(helper, k, baked[i].bounds[index], &baked[i].bounds[index][3]);
+                s64calc_transformmtx(&helper->transforms[k].data, mtx);
+                #ifndef LIBDRAGON
+                    guMtxF2L(mtx, &baked[i].matrices[index]);
+                #else
+                    memcpy(&baked[i].matrices[index], mtx, sizeof(Mtx));
+                #endif
+            }
+        }
+        offset += baked[i].framecount;
+    }
+    
+    // Done
+    sausage64_freehelper(helper);
+    mdldata->baked = baked;
+    return TRUE;
+}
+
+
+/*==============================
+    sausage64_unbake_anims
+    Frees the baked animations of a model
+    @param The model data to unbake
+==============================*/
+
+void sausage64_unbake_anims(s64ModelData* mdldata)
+{
+    if (mdldata->baked == NULL)
+        return;
+    free(mdldata->baked[0].matrices);
+    free(mdldata->baked[0].bounds);
+    free(mdldata->baked);
+    mdldata->baked = NULL;
 }
\ No newline at end of file
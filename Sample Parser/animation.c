@@ -7,34 +7,71 @@ Handles the parsing and creation of animations
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <math.h>
 #include "main.h"
 #include "material.h"
 #include "mesh.h"
 #include "animation.h"
 
 
+/*==============================
+    transform_sphere
+    Moves a mesh's bounding sphere to where the mesh is 
+    in a frame of an animation
+    @param The framedata of the mesh
+    @param The vector to store the sphere's new center in
+    @param The float to store the sphere's new radius in
+==============================*/
+
+static void transform_sphere(s64Transform* fdata, Vector3D* center, float* radius)
+{
+    Vector4D q = fdata->rotation;
+    Vector3D v = fdata->mesh->boundcenter;
+    Vector3D t;
+    float scale = fabsf(fdata->scale.x);
+    if (fabsf(fdata->scale.y) > scale) scale = fabsf(fdata->scale.y);
+    if (fabsf(fdata->scale.z) > scale) scale = fabsf(fdata->scale.z);
+    
+    // Rotate the center by the quaternion (v + 2w(q x v) + 2q x (q x v))
+    t.x = 2*(q.y*v.z - q.z*v.y);
+    t.y = 2*(q.z*v.x - q.x*v.z);
+    t.z = 2*(q.x*v.y - q.y*v.x);
+    center->x = v.x + q.w*t.x + (q.y*t.z - q.z*t.y);
+    center->y = v.y + q.w*t.y + (q.z*t.x - q.x*t.z);
+    center->z = v.z + q.w*t.z + (q.x*t.y - q.y*t.x);
+    
+    // Then scale and translate it
+    center->x = fdata->translation.x + center->x*fdata->scale.x;
+    center->y = fdata->translation.y + center->y*fdata->scale.y;
+    center->z = fdata->translation.z + center->z*fdata->scale.z;
+    *radius = fdata->mesh->boundradius*scale;
+}
+
+
 /*==============================
     add_animation
     Creates an animation object and adds it to the global list of animations
+    @param The conversion context
     @param The name of the animation
     @returns A pointer to the created animation
 ==============================*/
 
-s64Anim* add_animation(char* name)
+s64Anim* add_animation(arabikiContext* ctx, char* name)
 {
     // Allocate memory for the animation struct and string name
     s64Anim* anim = (s64Anim*)calloc(1, sizeof(s64Anim));
     if (anim == NULL)
-        terminate("Error: Unable to allocate memory for animation object\n");
+        terminate(ctx, "Error: Unable to allocate memory for animation object\n");
     anim->name = (char*)calloc(strlen(name)+1, 1);
     if (anim->name == NULL)
-        terminate("Error: Unable to allocate memory for animation name\n");
+        terminate(ctx, "Error: Unable to allocate memory for animation name\n");
     
     // Store the data in the newly created animation struct
     strcpy(anim->name, name);
     
     // Add this animation to our animation list and return it
-    list_append(&list_animations, anim);
+    if (list_append(&ctx->animations, anim) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
     return anim;
 }
 
@@ -42,17 +79,19 @@ s64Anim* add_animation(char* name)
 /*==============================
     add_keyframe
     Creates a keyframe object and adds it to an animation's list of keyframes
+    @param The conversion context
     @param A pointer to the animation
     @returns A pointer to the created keyframe
 ==============================*/
 
-s64Keyframe* add_keyframe(s64Anim* anim, unsigned int keyframe)
+s64Keyframe* add_keyframe(arabikiContext* ctx, s64Anim* anim, unsigned int keyframe)
 {
     s64Keyframe* keyf = (s64Keyframe*)calloc(1, sizeof(s64Keyframe));
     if (keyf == NULL)
-        terminate("Error: Unable to allocate memory for animation keyframe\n");
+        terminate(ctx, "Error: Unable to allocate memory for animation keyframe\n");
     keyf->keyframe = keyframe;
-    list_append(&(anim->keyframes), keyf);
+    if (list_append(&(anim->keyframes), keyf) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
     return keyf;
 }
 
@@ -60,15 +99,126 @@ s64Keyframe* add_keyframe(s64Anim* anim, unsigned int keyframe)
 /*==============================
     add_framedata
     Creates a framedata object and adds it to a keyframe's list of framedata
+    @param The conversion context
     @param A pointer to the keyframe
     @returns A pointer to the created framedata
 ==============================*/
 
-s64Transform* add_framedata(s64Keyframe* frame)
+s64Transform* add_framedata(arabikiContext* ctx, s64Keyframe* frame)
 {
     s64Transform* fdata = (s64Transform*)calloc(1, sizeof(s64Transform));
     if (fdata == NULL)
-        terminate("Error: Unable to allocate memory for animation framedata\n");
-    list_append(&(frame->framedata), fdata);
+        terminate(ctx, "Error: Unable to allocate memory for animation framedata\n");
+    if (list_append(&(frame->framedata), fdata) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
     return fdata;
+}
+
+
+/*==============================
+    calc_animbounds
+    Calculates a bounding sphere that contains every mesh of the
+    model throughout an entire animation, relative to the model's 
+    root. Requires the bounding spheres of the meshes to have been 
+    calculated beforehand
+    @param The animation to calculate the bounding sphere of
+==============================*/
+
+void calc_animbounds(s64Anim* anim)
+{
+    listNode* keyfnode;
+    Vector3D min = {0, 0, 0}, max = {0, 0, 0};
+    float radius = 0;
+    bool first = TRUE;
+    
+    // Find the bounding box of every mesh's sphere in every keyframe
+    anim->boundcenter = (Vector3D){0, 0, 0};
+    anim->boundradius = 0;
+    for (keyfnode = anim->keyframes.head; keyfnode != NULL; keyfnode = keyfnode->next)
+    {
+        listNode* fdatanode;
+        s64Keyframe* keyf = (s64Keyframe*)keyfnode->data;
+        for (fdatanode = keyf->framedata.head; fdatanode != NULL; fdatanode = fdatanode->next)
+        {
+            Vector3D center;
+            float r;
+            s64Transform* fdata = (s64Transform*)fdatanode->data;
+            if (fdata->mesh->boundradius <= 0)
+                continue;
+            transform_sphere(fdata, &center, &r);
+            if (first || center.x - r < min.x) min.x = center.x - r;
+            if (first || center.y - r < min.y) min.y = center.y - r;
+            if (first || center.z - r < min.z) min.z = center.z - r;
+            if (first || center.x + r > max.x) max.x = center.x + r;
+            if (first || center.y + r > max.y) max.y = center.y + r;
+            if (first || center.z + r > max.z) max.z = center.z + r;
+            first = FALSE;
+        }
+    }
+    if (first)
+        return;
+    anim->boundcenter.x = (min.x + max.x)/2;
+    anim->boundcenter.y = (min.y + max.y)/2;
+    anim->boundcenter.z = (min.z + max.z)/2;
+    
+    // Now find the sphere which reaches furthest from the center
+    for (keyfnode = anim->keyframes.head; keyfnode != NULL; keyfnode = keyfnode->next)
+    {
+        listNode* fdatanode;
+        s64Keyframe* keyf = (s64Keyframe*)keyfnode->data;
+        for (fdatanode = keyf->framedata.head; fdatanode != NULL; fdatanode = fdatanode->next)
+        {
+            Vector3D center;
+            float r, dx, dy, dz;
+            s64Transform* fdata = (s64Transform*)fdatanode->data;
+            if (fdata->mesh->boundradius <= 0)
+                continue;
+            transform_sphere(fdata, &center, &r);
+            dx = center.x - anim->boundcenter.x;
+            dy = center.y - anim->boundcenter.y;
+            dz = center.z - anim->boundcenter.z;
+            r += sqrtf(dx*dx + dy*dy + dz*dz);
+            if (r > radius)
+                radius = r;
+        }
+    }
+    anim->boundradius = radius;
+}
+
+
+/*==============================
+    calc_framelookup
+    Generates a table which stores, for every frame of an
+    animation, the index of the keyframe that it starts in.
+    This lets the library seek through the animation in
+    constant time. Expects the keyframes to be sorted
+    @param The conversion context
+    @param The animation to generate the table for
+==============================*/
+
+void calc_framelookup(arabikiContext* ctx, s64Anim* anim)
+{
+    listNode* keyfnode;
+    unsigned int frame = 0;
+    unsigned short index = 0;
+    
+    // The table covers every frame up to (and including) the last keyframe
+    anim->framelookup = NULL;
+    anim->framecount = 0;
+    if (anim->keyframes.tail == NULL)
+        return;
+    anim->framecount = ((s64Keyframe*)anim->keyframes.tail->data)->keyframe + 1;
+    anim->framelookup = (unsigned short*)calloc(anim->framecount, sizeof(unsigned short));
+    if (anim->framelookup == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for animation frame lookup table\n");
+    
+    // Fill the table, moving onto the next keyframe when we reach it
+    for (keyfnode = anim->keyframes.head; keyfnode != NULL; keyfnode = keyfnode->next)
+    {
+        s64Keyframe* keyf = (s64Keyframe*)keyfnode->data;
+        for (; frame < keyf->keyframe; frame++)
+            anim->framelookup[frame] = (index > 0) ? index-1 : 0;
+        index++;
+    }
+    anim->framelookup[frame] = index-1;
 }
\ No newline at end of file
@@ -23,6 +23,10 @@
     typedef struct {
         char* name;
         linkedList keyframes;
+        Vector3D boundcenter;
+        float boundradius;
+        unsigned short* framelookup;
+        unsigned int framecount;
     } s64Anim;
     
     
@@ -30,8 +34,10 @@
                 Functions
     *********************************/
     
-    extern s64Anim*      add_animation(char* name);
-    extern s64Keyframe*  add_keyframe(s64Anim* anim, unsigned int keyframe);
-    extern s64Transform* add_framedata(s64Keyframe* frame);
+    extern s64Anim*      add_animation(arabikiContext* ctx, char* name);
+    extern s64Keyframe*  add_keyframe(arabikiContext* ctx, s64Anim* anim, unsigned int keyframe);
+    extern s64Transform* add_framedata(arabikiContext* ctx, s64Keyframe* frame);
+    extern void          calc_animbounds(s64Anim* anim);
+    extern void          calc_framelookup(arabikiContext* ctx, s64Anim* anim);
     
 #endif
\ No newline at end of file
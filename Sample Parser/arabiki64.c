@@ -0,0 +1,371 @@
+/***************************************************************
+                          arabiki64.c
+
+Library interface. Conversions keep all of their state in a
+context object, and errors return to the caller instead of
+exiting, so that other programs can run the converter as many
+times as they want.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "main.h"
+#include "material.h"
+#include "mesh.h"
+#include "animation.h"
+#include "parser.h"
+#include "optimizer.h"
+#include "dlist.h"
+#include "output.h"
+
+
+/*==============================
+    free_mesh
+    Frees a mesh and its LODs
+    @param The mesh to free
+    @param Whether the mesh is a LOD of another mesh
+==============================*/
+
+static void free_mesh(s64Mesh* mesh, bool islod)
+{
+    // Vertex caches share their lists with the mesh if it fit in a single cache
+    for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+    {
+        vertCache* vcache = (vertCache*)vcachenode->data;
+        if (vcache->verts.head != mesh->verts.head)
+            list_destroy(&vcache->verts);
+        if (vcache->faces.head != mesh->faces.head)
+            list_destroy(&vcache->faces);
+        free(vcache);
+    }
+    list_destroy(&mesh->vertcache);
+
+    // Free the LODs
+    for (listNode* lodnode = mesh->lods.head; lodnode != NULL; lodnode = lodnode->next)
+        free_mesh((s64Mesh*)lodnode->data, TRUE);
+    list_destroy(&mesh->lods);
+
+    // LODs share their vertices, parent and properties with the full detail mesh
+    if (islod)
+        list_destroy(&mesh->verts);
+    else
+    {
+        list_destroy_deep(&mesh->verts);
+        list_destroy_deep(&mesh->props);
+        free(mesh->parent);
+    }
+    list_destroy_deep(&mesh->faces);
+    list_destroy(&mesh->materials);
+    free(mesh->name);
+    free(mesh);
+}
+
+
+/*==============================
+    free_model
+    Frees the model data of a context, so that it
+    can be used for another conversion
+    @param The conversion context
+==============================*/
+
+static void free_model(arabikiContext* ctx)
+{
+    // Close the input files, in case the last conversion failed while reading them
+    if (ctx->modelfile != NULL)
+        fclose(ctx->modelfile);
+    if (ctx->materialfile != NULL)
+        fclose(ctx->materialfile);
+    ctx->modelfile = NULL;
+    ctx->materialfile = NULL;
+
+    // Free the meshes
+    for (listNode* meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
+        free_mesh((s64Mesh*)meshnode->data, FALSE);
+    list_destroy(&ctx->meshes);
+
+    // Free the animations
+    for (listNode* animnode = ctx->animations.head; animnode != NULL; animnode = animnode->next)
+    {
+        s64Anim* anim = (s64Anim*)animnode->data;
+        for (listNode* keyfnode = anim->keyframes.head; keyfnode != NULL; keyfnode = keyfnode->next)
+            list_destroy_deep(&((s64Keyframe*)keyfnode->data)->framedata);
+        list_destroy_deep(&anim->keyframes);
+        free(anim->framelookup);
+        free(anim->name);
+        free(anim);
+    }
+    list_destroy(&ctx->animations);
+
+    // Free the materials, except for the shared "None" material
+    for (listNode* matnode = ctx->materials.head; matnode != NULL; matnode = matnode->next)
+    {
+        n64Material* mat = (n64Material*)matnode->data;
+        if (mat == &material_none)
+            continue;
+        free(mat->name);
+        free(mat);
+    }
+    list_destroy(&ctx->materials);
+    list_destroy_deep(&ctx->flagstrings);
+
+    // Reset the rest of the conversion state
+    free(ctx->forsyth_posscore);
+    free(ctx->forsyth_valencescore);
+    free(ctx->budgets);
+    ctx->forsyth_posscore = NULL;
+    ctx->forsyth_valencescore = NULL;
+    ctx->budgets = NULL;
+    ctx->budgetcount = 0;
+    ctx->lastmaterial = NULL;
+    ctx->flagmaterial = NULL;
+}
+
+
+/*==============================
+    measure_budgets
+    Builds the display list of every mesh, in the order
+    they'll be drawn, and counts what each one costs
+    @param The conversion context
+==============================*/
+
+static void measure_budgets(arabikiContext* ctx)
+{
+    int i = 0;
+
+    // Allocate the budget list
+    if (ctx->meshes.size == 0)
+        return;
+    ctx->budgets = (arabikiMeshBudget*)calloc(ctx->meshes.size, sizeof(arabikiMeshBudget));
+    if (ctx->budgets == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for mesh budgets\n");
+    ctx->budgetcount = ctx->meshes.size;
+
+    // The material state carries over from one mesh to the next, like it does when the model is drawn
+    ctx->lastmaterial = NULL;
+    for (listNode* meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
+    {
+        s64Mesh* mesh = (s64Mesh*)meshnode->data;
+        arabikiMeshBudget* budget = &ctx->budgets[i++];
+        linkedList* dl = dlist_frommesh(ctx, mesh, TRUE);
+
+        // Count the commands
+        budget->name = mesh->name;
+        for (listNode* cmdnode = dl->head; cmdnode != NULL; cmdnode = cmdnode->next)
+        {
+            DLCBinary* cmd = (DLCBinary*)cmdnode->data;
+            budget->dlbytes += commands_f3dex2[cmd->cmd].size*8;
+            switch (cmd->cmd)
+            {
+                case SPVertex:
+                    budget->vertloads++;
+                    break;
+                case DPLoadTextureBlock:
+                case DPLoadTextureBlock_4b:
+                    budget->texloads++;
+                    break;
+                case SP1Triangle:
+                    budget->tri1++;
+                    break;
+                case SP2Triangles:
+                    budget->tri2++;
+                    break;
+                default:
+                    break;
+            }
+            free(cmd->data);
+            free(cmd);
+        }
+        list_destroy(dl);
+        free(dl);
+    }
+    ctx->lastmaterial = NULL;
+}
+
+
+/*==============================
+    arabiki_defaultsettings
+    Fills a settings struct with the default settings
+    @param The settings struct to fill
+==============================*/
+
+void arabiki_defaultsettings(arabikiSettings* settings)
+{
+    memset(settings, 0, sizeof(arabikiSettings));
+    settings->fixroot = TRUE;
+    settings->binaryout = TRUE;
+    settings->initialload = TRUE;
+    settings->writeoutput = TRUE;
+    settings->outputname = "outdlist";
+    settings->modelname = "MyModel";
+    settings->cachesize = 32;
+}
+
+
+/*==============================
+    arabiki_create
+    Creates a conversion context
+    @param   The settings to convert with, or NULL for the defaults
+    @returns The new context, or NULL if it couldn't be allocated
+==============================*/
+
+arabikiContext* arabiki_create(const arabikiSettings* settings)
+{
+    arabikiContext* ctx = (arabikiContext*)calloc(1, sizeof(arabikiContext));
+    if (ctx == NULL)
+        return NULL;
+    if (settings != NULL)
+        ctx->settings = *settings;
+    else
+        arabiki_defaultsettings(&ctx->settings);
+    return ctx;
+}
+
+
+/*==============================
+    arabiki_convert
+    Converts a model. The results of any previous
+    conversion with this context are discarded
+    @param   The conversion context
+    @param   The path to the .s64 model
+    @param   The path to the materials file, or NULL
+    @returns Whether the conversion succeeded. If it
+             didn't, use arabiki_geterror to find out why
+==============================*/
+
+int arabiki_convert(arabikiContext* ctx, const char* modelpath, const char* materialpath)
+{
+    free_model(ctx);
+    ctx->errormessage[0] = '\0';
+
+    // Errors jump back here
+    if (setjmp(ctx->errorjump) != 0)
+    {
+        free_model(ctx);
+        return FALSE;
+    }
+
+    // Open the input files
+    ctx->modelfile = fopen(modelpath, "r");
+    if (ctx->modelfile == NULL)
+    {
+        snprintf(ctx->errormessage, ERRORMSG_SIZE, "Unable to open file '%s'\n", modelpath);
+        terminate(ctx, ctx->errormessage);
+    }
+    if (materialpath != NULL)
+    {
+        ctx->materialfile = fopen(materialpath, "r");
+        if (ctx->materialfile == NULL)
+        {
+            snprintf(ctx->errormessage, ERRORMSG_SIZE, "Error: Unable to open file '%s'\n", materialpath);
+            terminate(ctx, ctx->errormessage);
+        }
+    }
+
+    // Parse the materials file if it's given
+    if (list_append(&ctx->materials, &material_none) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
+    if (ctx->materialfile != NULL)
+    {
+        parse_materials(ctx, ctx->materialfile);
+        fclose(ctx->materialfile);
+        ctx->materialfile = NULL;
+    }
+
+    // Parse the model file
+    parse_sausage(ctx, ctx->modelfile);
+    fclose(ctx->modelfile);
+    ctx->modelfile = NULL;
+
+    // Optimize the model, and see how much each mesh costs to draw
+    optimize_mdl(ctx);
+    if (!ctx->settings.opengl)
+        measure_budgets(ctx);
+
+    // Save our model data to a file
+    if (ctx->settings.writeoutput)
+    {
+        if (!ctx->settings.binaryout)
+            write_output_text(ctx);
+        else
+            write_output_binary(ctx);
+    }
+    return TRUE;
+}
+
+
+/*==============================
+    arabiki_geterror
+    Gets the reason the last conversion failed
+    @param   The conversion context
+    @returns The error message, or an empty string
+==============================*/
+
+const char* arabiki_geterror(arabikiContext* ctx)
+{
+    return ctx->errormessage;
+}
+
+
+/*==============================
+    arabiki_getmeshcount
+    Gets the number of meshes with a budget from
+    the last conversion. Budgets are only measured
+    for Libultra display lists
+    @param   The conversion context
+    @returns The number of meshes
+==============================*/
+
+int arabiki_getmeshcount(arabikiContext* ctx)
+{
+    return ctx->budgetcount;
+}
+
+
+/*==============================
+    arabiki_getmeshbudget
+    Gets what it costs to draw a mesh from the last
+    conversion, in the order the meshes are drawn
+    @param   The conversion context
+    @param   The index of the mesh
+    @returns The mesh's budget, or NULL
+==============================*/
+
+const arabikiMeshBudget* arabiki_getmeshbudget(arabikiContext* ctx, int index)
+{
+    if (index < 0 || index >= ctx->budgetcount)
+        return NULL;
+    return &ctx->budgets[index];
+}
+
+
+/*==============================
+    arabiki_destroy
+    Frees a conversion context and everything in it
+    @param The conversion context
+==============================*/
+
+void arabiki_destroy(arabikiContext* ctx)
+{
+    if (ctx == NULL)
+        return;
+    free_model(ctx);
+    free(ctx);
+}
+
+
+/*==============================
+    terminate
+    Stops the conversion, returning to arabiki_convert
+    @param The conversion context
+    @param The error message, or NULL
+==============================*/
+
+void terminate(arabikiContext* ctx, char* message)
+{
+    if (message == NULL)
+        ctx->errormessage[0] = '\0';
+    else if (message != ctx->errormessage)
+        snprintf(ctx->errormessage, ERRORMSG_SIZE, "%s", message);
+    longjmp(ctx->errorjump, 1);
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#ifndef _SAUSN64_ARABIKI64_H
+#define _SAUSN64_ARABIKI64_H
+
+    /*********************************
+                  Macros
+    *********************************/
+
+    #define ARABIKI_MAXLODS 8
+
+
+    /*********************************
+                 Structs
+    *********************************/
+
+    // Conversion settings, matching the command line arguments
+    typedef struct {
+        int          quiet;
+        int          fixroot;
+        int          binaryout;
+        int          initialload;
+        int          no2tri;
+        int          opengl;
+        int          cullbox;
+        int          meshload;    // Whether every mesh loads its own material, so meshes can be skipped on the CPU
+        int          writeoutput; // Whether to write the converted model to disk
+        int          interactive; // Whether to ask on stdin about materials missing from the materials file
+        const char*  outputname;
+        const char*  modelname;
+        unsigned int cachesize;
+        unsigned int lodcount;
+        float        lodratios[ARABIKI_MAXLODS];
+        float        lodsizes[ARABIKI_MAXLODS];
+    } arabikiSettings;
+
+    // The cost of drawing a mesh's display list (Libultra only)
+    typedef struct {
+        const char*  name;
+        unsigned int dlbytes;
+        unsigned int vertloads;
+        unsigned int texloads;
+        unsigned int tri1;
+        unsigned int tri2;
+    } arabikiMeshBudget;
+
+    // The converter state, see main.h
+    typedef struct arabikiContext arabikiContext;
+
+
+    /*********************************
+                Functions
+    *********************************/
+
+    #ifdef __cplusplus
+    extern "C" {
+    #endif
+
+    extern void                     arabiki_defaultsettings(arabikiSettings* settings);
+    extern arabikiContext*          arabiki_create(const arabikiSettings* settings);
+    extern int                      arabiki_convert(arabikiContext* ctx, const char* modelpath, const char* materialpath);
+    extern const char*              arabiki_geterror(arabikiContext* ctx);
+    extern int                      arabiki_getmeshcount(arabikiContext* ctx);
+    extern const arabikiMeshBudget* arabiki_getmeshbudget(arabikiContext* ctx, int index);
+    extern void                     arabiki_destroy(arabikiContext* ctx);
+
+    #ifdef __cplusplus
+    }
+    #endif
+
+#endif
\ No newline at end of file
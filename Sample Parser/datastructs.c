@@ -33,7 +33,7 @@ linkedList* list_new()
     Appends data to a linked list
     @param The linked list to append to
     @param The data to append
-    @returns The created node
+    @returns The created node, or NULL if it couldn't be allocated
 ==============================*/
 
 listNode* list_append(linkedList* list, void* data)
@@ -41,7 +41,7 @@ listNode* list_append(linkedList* list, void* data)
     // Allocate memory for our new node
     listNode* node = (listNode*)calloc(sizeof(listNode), 1);
     if (node == NULL)
-        terminate("Error: Unable to allocate memory for linked list node\n");
+        return NULL;
     node->data = data;
     
     // Assign the node to the list
@@ -323,7 +323,7 @@ bool list_hasvalue(linkedList* list, void* data)
     @param The dictionary to append to
     @param The key of the data
     @param The data to append
-    @returns The created node
+    @returns The created node, or NULL if it couldn't be allocated
 ==============================*/
 
 dictNode* dict_append(Dictionary* dict, int key, void* value)
@@ -331,7 +331,7 @@ dictNode* dict_append(Dictionary* dict, int key, void* value)
     // Allocate memory for our new node
     dictNode* node = (dictNode*)calloc(1, sizeof(dictNode));
     if (node == NULL)
-        terminate("Error: Unable to allocate memory for dictionary node\n");
+        return NULL;
     node->key = key;
     node->value = value;
     
@@ -18,7 +18,7 @@ Constructs a display list string for outputting later.
 
 #define STRBUF_SIZE 512
 
-#define generate(c, ...) (generator(c, commands_f3dex2[c].argcount, ##__VA_ARGS__))
+#define generate(c, ...) (generator(ctx, c, commands_f3dex2[c].argcount, ##__VA_ARGS__))
 
 
 /*********************************
@@ -39,13 +39,11 @@ const DListCName supported_binary[] = {
     SPVertex,
     SP1Triangle,
     SP2Triangles,
+    SPCullDisplayList,
     DPPipeSync,
     SPEndDisplayList
 }; 
 
-// Global parsing state
-n64Material* lastMaterial = NULL;
-
 
 /*==============================
     swap_endian16
@@ -113,13 +111,14 @@ static char* mallocstring(char* str)
     Creates a static display list command
     string from a dlist command.
     Don't use directly, use the macro
+    @param   The conversion context
     @param   The display list command name
     @param   The number of arguments
     @param   Variable arguments
     @returns A malloc'ed string
 ==============================*/
 
-static void* _dlist_commandstring(DListCName c, int size, ...)
+static void* _dlist_commandstring(arabikiContext* ctx, DListCName c, int size, ...)
 {
     va_list args;
     char strbuff[STRBUF_SIZE];
@@ -142,13 +141,14 @@ static void* _dlist_commandstring(DListCName c, int size, ...)
     Creates a binary display list command
     from a dlist command.
     Don't use directly, use the macro
+    @param   The conversion context
     @param   The display list command name
     @param   The number of arguments
     @param   Variable arguments
     @returns A malloc'ed binary block
 ==============================*/
 
-static void* _dlist_commandbinary(DListCName c, int size, ...)
+static void* _dlist_commandbinary(arabikiContext* ctx, DListCName c, int size, ...)
 {
     char supported = 0;
     va_list args;
@@ -170,13 +170,13 @@ static void* _dlist_commandbinary(DListCName c, int size, ...)
     {
         char strbuff[STRBUF_SIZE];
         sprintf(strbuff, "Unsupported Binary DL command %s", commands_f3dex2[c].name);
-        terminate(strbuff);
+        terminate(ctx, strbuff);
     }
 
     // Malloc the binary data
     binarydata = (DLCBinary*)calloc(sizeof(DLCBinary), 1);
     if (binarydata == NULL)
-        terminate("Unable to malloc binary data struct");
+        terminate(ctx, "Unable to malloc binary data struct");
     binarydata->cmd = c;
     binarydata->size = size;
     switch (c)
@@ -188,6 +188,9 @@ static void* _dlist_commandbinary(DListCName c, int size, ...)
         case SPVertex: // Compact the offset into 1 word, and the other two arguments into 2 bytes
             binarydata->size = 1;
             break;
+        case SPCullDisplayList: // Both vertex indices fit in 2 bytes
+            binarydata->size = 1;
+            break;
         case SP1Triangle: // All arguments for 1Triangle fit in 1 dword
             binarydata->size = 1;
             break;
@@ -204,7 +207,7 @@ static void* _dlist_commandbinary(DListCName c, int size, ...)
     }
     binarydata->data = (uint32_t*)calloc(sizeof(uint32_t)*binarydata->size, 1);
     if (binarydata->data  == NULL)
-        terminate("Unable to malloc binary data buffer");
+        terminate(ctx, "Unable to malloc binary data buffer");
 
     // Go through each argument
     for (int i=0; i<size; i++)
@@ -219,7 +222,7 @@ static void* _dlist_commandbinary(DListCName c, int size, ...)
             case DPLoadTextureBlock:
                 if (i == 0) // First argument is the texture name, we just want the texture index
                 {
-                    *(((uint16_t*)(&binarydata->data[0]))) = swap_endian16(get_validtexindex(&list_materials, arg));
+                    *(((uint16_t*)(&binarydata->data[0]))) = swap_endian16(get_validtexindex(&ctx->materials, arg));
                 }
                 else
                 {
@@ -247,6 +250,10 @@ static void* _dlist_commandbinary(DListCName c, int size, ...)
                 *(((uint8_t*)(&binarydata->data[0]))+i) = (uint8_t)atoi(arg);
                 parsed = TRUE;
                 break;
+            case SPCullDisplayList:
+                ((uint8_t*)binarydata->data)[2+i] = atoi(arg);
+                parsed = TRUE;
+                break;
             case DPSetPrimColor:
                 if (i == 0 || i == 1)
                     *(((int16_t*)(&binarydata->data[0]))+i) = swap_endian16(atoi(arg));
@@ -302,22 +309,231 @@ static void* _dlist_commandbinary(DListCName c, int size, ...)
 
 
 /*==============================
-    dlist_frommesh
+    dlist_loadmaterial
+    Appends the commands needed to switch from the last 
+    loaded material to a new one
+    @param The conversion context
+    @param The display list to append to
+    @param The command generation function
+    @param The material to load
+==============================*/
+
+static void dlist_loadmaterial(arabikiContext* ctx, linkedList* out, void* (*generator)(arabikiContext* ctx, DListCName c, int size, ...), n64Material* mat)
+{
+    char strbuff[STRBUF_SIZE];
+    int i;
+    bool pipesync = FALSE;
+    bool changedgeo = FALSE;
+    
+    // Check for different cycle type
+    if (ctx->lastmaterial == NULL || strcmp(mat->cycle, ctx->lastmaterial->cycle) != 0)
+    {
+        list_append(out, generate(DPSetCycleType, mat->cycle));
+        pipesync = TRUE;
+    }
+    
+    // Check for different render mode
+    if (ctx->lastmaterial == NULL || strcmp(mat->rendermode1, ctx->lastmaterial->rendermode1) != 0 || strcmp(mat->rendermode2, ctx->lastmaterial->rendermode2) != 0)
+    {
+        list_append(out, generate(DPSetRenderMode, mat->rendermode1, mat->rendermode2));
+        pipesync = TRUE;
+    }
+    
+    // Check for different combine mode
+    if (ctx->lastmaterial == NULL || strcmp(mat->combinemode1, ctx->lastmaterial->combinemode1) != 0 || strcmp(mat->combinemode2, ctx->lastmaterial->combinemode2) != 0)
+    {
+        list_append(out, generate(DPSetCombineMode, mat->combinemode1, mat->combinemode2));
+        pipesync = TRUE;
+    }
+    
+    // Check for different texture filter
+    if (ctx->lastmaterial == NULL || strcmp(mat->texfilter, ctx->lastmaterial->texfilter) != 0)
+    {
+        list_append(out, generate(DPSetTextureFilter, mat->texfilter));
+        pipesync = TRUE;
+    }
+    
+    // Check for different geometry mode
+    if (ctx->lastmaterial != NULL)
+    {
+        int flagcount_old = 0;
+        int flagcount_new = 0;
+        char* flags_old[MAXGEOFLAGS];
+        char* flags_new[MAXGEOFLAGS];
+
+        // Store the pointer to the flags somewhere to make the iteration easier
+        for (i=0; i<MAXGEOFLAGS; i++)
+        {
+            if (mat->geomode[i][0] != '\0')
+            {
+                flags_new[flagcount_new] = mat->geomode[i];
+                flagcount_new++;
+            }
+            if (ctx->lastmaterial->geomode[i][0] != '\0')
+            {
+                flags_old[flagcount_old] = ctx->lastmaterial->geomode[i];
+                flagcount_old++;
+            }
+        }
+
+        // Check if all the flags exist in this other texture
+        if (flagcount_new == flagcount_old)
+        {
+            int j;
+            bool hasthisflag = FALSE;
+            for (i=0; i<flagcount_new; i++)
+            {
+                for (j=0; j<flagcount_old; j++)
+                {
+                    if (!strcmp(flags_new[i], flags_old[j]))
+                    {
+                        hasthisflag = TRUE;
+                        break;
+                    }
+                }
+                if (!hasthisflag)
+                {
+                    changedgeo = TRUE;
+                    break;
+                }
+            }
+        }
+        else
+            changedgeo = TRUE;
+    }
+    else
+        changedgeo = TRUE;
+        
+    // If a geometry mode flag changed, then update the display list
+    if (changedgeo)
+    {
+        bool appendline = FALSE;
+    
+        // TODO: Smartly omit geometry flags commands based on what changed
+        list_append(out, generate(SPClearGeometryMode, "0xFFFFFFFF"));
+        strbuff[0] = '\0';
+        for (i=0; i<MAXGEOFLAGS; i++)
+        {
+            if (mat->geomode[i][0] == '\0')
+                continue;
+            if (appendline)
+            {
+                strcat(strbuff, " | ");
+                appendline = FALSE;
+            }
+            strcat(strbuff, mat->geomode[i]);
+            appendline = TRUE;
+        }
+        list_append(out, generate(SPSetGeometryMode, strbuff));
+    }
+    
+    // Load the material if it wasn't marked as DONTLOAD
+    if (!mat->dontload)
+    {
+        char d1[32], d2[32], d3[32], d4[32];
+        if (mat->type == TYPE_TEXTURE)
+        {
+            sprintf(d1, "%d", mat->data.image.w);
+            sprintf(d2, "%d", mat->data.image.h);
+            sprintf(d3, "%d", nearest_pow2(mat->data.image.w));
+            sprintf(d4, "%d", nearest_pow2(mat->data.image.h));
+            if (!strcmp(mat->data.image.colsize, "G_IM_SIZ_4b"))
+            {
+                list_append(out, generate(DPLoadTextureBlock_4b, 
+                    mat->name, mat->data.image.coltype, d1, d2, "0",
+                    mat->data.image.texmodes, mat->data.image.texmodet, d3, d4, "G_TX_NOLOD", "G_TX_NOLOD")
+                );
+            }
+            else
+            {
+                list_append(out, generate(DPLoadTextureBlock, 
+                    mat->name, mat->data.image.coltype, mat->data.image.colsize, d1, d2, "0",
+                    mat->data.image.texmodes, mat->data.image.texmodet, d3, d4, "G_TX_NOLOD", "G_TX_NOLOD")
+                );
+            }
+            pipesync = TRUE;
+        }
+        else if (mat->type == TYPE_PRIMCOL)
+        {
+            sprintf(d1, "%d", mat->data.color.r);
+            sprintf(d2, "%d", mat->data.color.g);
+            sprintf(d3, "%d", mat->data.color.b);
+            list_append(out, generate(DPSetPrimColor, "0", "0", d1, d2, d3, "255"));
+        }
+    }
+    
+    // Call a pipesync if needed
+    if (pipesync)
+        list_append(out, generate(DPPipeSync));
+
+    // Update the last texture
+    ctx->lastmaterial = mat;
+}
+
+
+/*==============================
+    dlist_cancullbox
+    Checks if a display list can be culled by the RSP.
+    Since the display lists rely on the material state
+    left by the previous one, culling is only safe if
+    the material that gets loaded before the bounding
+    box test is the one that the DL would leave loaded
+    @param   The conversion context
+    @param   The mesh to check
+    @param   The material to leave loaded at the end
+             of the DL, or NULL to not care
+    @returns Whether the bounding box can be added
+==============================*/
+
+static bool dlist_cancullbox(arabikiContext* ctx, s64Mesh* mesh, n64Material* exitmat)
+{
+    n64Material* usedmat = NULL;
+    if (!ctx->settings.cullbox || ctx->settings.opengl || ctx->settings.cachesize < 8 || mesh->boundradius <= 0)
+        return FALSE;
+    for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+    {
+        vertCache* vcache = (vertCache*)vcachenode->data;
+        for (listNode* facenode = vcache->faces.head; facenode != NULL; facenode = facenode->next)
+        {
+            n64Material* mat = ((s64Face*)facenode->data)->material;
+            if (mat->type == TYPE_OMIT)
+                continue;
+            if (usedmat != NULL && usedmat != mat)
+                return FALSE;
+            usedmat = mat;
+        }
+    }
+    return (exitmat == NULL || usedmat == NULL || exitmat == usedmat);
+}
+
+
+/*==============================
+    dlist_build
     Constructs a display list from a single mesh
+    @param   The conversion context
     @param   The mesh to build a DL of
     @param   Whether the DL should be binary
+    @param   The material to leave loaded at the end
+             of the DL, or NULL to not care
     @returns A linked list with the DL data
 ==============================*/
 
-linkedList* dlist_frommesh(s64Mesh* mesh, char isbinary)
+static linkedList* dlist_build(arabikiContext* ctx, s64Mesh* mesh, char isbinary, n64Material* exitmat)
 {
     char strbuff[STRBUF_SIZE];
     linkedList* out = list_new();
-    bool ismultimesh = (list_meshes.size > 1);
+    bool ismultimesh = (ctx->meshes.size > 1);
+    bool needcull;
     int vertindex = 0;
     if (out == NULL)
-        terminate("Error: Unable to malloc for output list\n");
-    void* (*generator)(DListCName c, int size, ...);
+        terminate(ctx, "Error: Unable to malloc for output list\n");
+    void* (*generator)(arabikiContext* ctx, DListCName c, int size, ...);
+    
+    // The bounding box verts go before the rest of the mesh's verts
+    mesh->hascullbox = dlist_cancullbox(ctx, mesh, exitmat);
+    needcull = mesh->hascullbox;
+    if (mesh->hascullbox)
+        vertindex = 8;
 
     // Select the generation function
     if (isbinary)
@@ -339,172 +555,34 @@ linkedList* dlist_frommesh(s64Mesh* mesh, char isbinary)
             n64Material* mat = face->material;
             
             // If we want to skip the initial display list setup, then change the value of our last texture to skip the next if statement
-            if (lastMaterial == NULL && !global_initialload)
-                lastMaterial = mat;
+            if (ctx->lastmaterial == NULL && !ctx->settings.initialload && !ctx->settings.meshload)
+                ctx->lastmaterial = mat;
         
             // If a texture change was detected, load the new texture data
-            if (lastMaterial != mat && mat->type != TYPE_OMIT)
-            {
-                int i;
-                bool pipesync = FALSE;
-                bool changedgeo = FALSE;
-                
-                // Check for different cycle type
-                if (lastMaterial == NULL || strcmp(mat->cycle, lastMaterial->cycle) != 0)
-                {
-                    list_append(out, generate(DPSetCycleType, mat->cycle));
-                    pipesync = TRUE;
-                }
-                
-                // Check for different render mode
-                if (lastMaterial == NULL || strcmp(mat->rendermode1, lastMaterial->rendermode1) != 0 || strcmp(mat->rendermode2, lastMaterial->rendermode2) != 0)
-                {
-                    list_append(out, generate(DPSetRenderMode, mat->rendermode1, mat->rendermode2));
-                    pipesync = TRUE;
-                }
-                
-                // Check for different combine mode
-                if (lastMaterial == NULL || strcmp(mat->combinemode1, lastMaterial->combinemode1) != 0 || strcmp(mat->combinemode2, lastMaterial->combinemode2) != 0)
-                {
-                    list_append(out, generate(DPSetCombineMode, mat->combinemode1, mat->combinemode2));
-                    pipesync = TRUE;
-                }
-                
-                // Check for different texture filter
-                if (lastMaterial == NULL || strcmp(mat->texfilter, lastMaterial->texfilter) != 0)
-                {
-                    list_append(out, generate(DPSetTextureFilter, mat->texfilter));
-                    pipesync = TRUE;
-                }
-                
-                // Check for different geometry mode
-                if (lastMaterial != NULL)
-                {
-                    int flagcount_old = 0;
-                    int flagcount_new = 0;
-                    char* flags_old[MAXGEOFLAGS];
-                    char* flags_new[MAXGEOFLAGS];
-
-                    // Store the pointer to the flags somewhere to make the iteration easier
-                    for (i=0; i<MAXGEOFLAGS; i++)
-                    {
-                        if (mat->geomode[i][0] != '\0')
-                        {
-                            flags_new[flagcount_new] = mat->geomode[i];
-                            flagcount_new++;
-                        }
-                        if (lastMaterial->geomode[i][0] != '\0')
-                        {
-                            flags_old[flagcount_old] = lastMaterial->geomode[i];
-                            flagcount_old++;
-                        }
-                    }
-
-                    // Check if all the flags exist in this other texture
-                    if (flagcount_new == flagcount_old)
-                    {
-                        int j;
-                        bool hasthisflag = FALSE;
-                        for (i=0; i<flagcount_new; i++)
-                        {
-                            for (j=0; j<flagcount_old; j++)
-                            {
-                                if (!strcmp(flags_new[i], flags_old[j]))
-                                {
-                                    hasthisflag = TRUE;
-                                    break;
-                                }
-                            }
-                            if (!hasthisflag)
-                            {
-                                changedgeo = TRUE;
-                                break;
-                            }
-                        }
-                    }
-                    else
-                        changedgeo = TRUE;
-                }
-                else
-                    changedgeo = TRUE;
-                    
-                // If a geometry mode flag changed, then update the display list
-                if (changedgeo)
-                {
-                    bool appendline = FALSE;
-                
-                    // TODO: Smartly omit geometry flags commands based on what changed
-                    list_append(out, generate(SPClearGeometryMode, "0xFFFFFFFF"));
-                    strbuff[0] = '\0';
-                    for (i=0; i<MAXGEOFLAGS; i++)
-                    {
-                        if (mat->geomode[i][0] == '\0')
-                            continue;
-                        if (appendline)
-                        {
-                            strcat(strbuff, " | ");
-                            appendline = FALSE;
-                        }
-                        strcat(strbuff, mat->geomode[i]);
-                        appendline = TRUE;
-                    }
-                    list_append(out, generate(SPSetGeometryMode, strbuff));
-                }
-                
-                // Load the material if it wasn't marked as DONTLOAD
-                if (!mat->dontload)
-                {
-                    char d1[32], d2[32], d3[32], d4[32];
-                    if (mat->type == TYPE_TEXTURE)
-                    {
-                        sprintf(d1, "%d", mat->data.image.w);
-                        sprintf(d2, "%d", mat->data.image.h);
-                        sprintf(d3, "%d", nearest_pow2(mat->data.image.w));
-                        sprintf(d4, "%d", nearest_pow2(mat->data.image.h));
-                        if (!strcmp(mat->data.image.colsize, "G_IM_SIZ_4b"))
-                        {
-                            list_append(out, generate(DPLoadTextureBlock_4b, 
-                                mat->name, mat->data.image.coltype, d1, d2, "0",
-                                mat->data.image.texmodes, mat->data.image.texmodet, d3, d4, "G_TX_NOLOD", "G_TX_NOLOD")
-                            );
-                        }
-                        else
-                        {
-                            list_append(out, generate(DPLoadTextureBlock, 
-                                mat->name, mat->data.image.coltype, mat->data.image.colsize, d1, d2, "0",
-                                mat->data.image.texmodes, mat->data.image.texmodet, d3, d4, "G_TX_NOLOD", "G_TX_NOLOD")
-                            );
-                        }
-                        pipesync = TRUE;
-                    }
-                    else if (mat->type == TYPE_PRIMCOL)
-                    {
-                        sprintf(d1, "%d", mat->data.color.r);
-                        sprintf(d2, "%d", mat->data.color.g);
-                        sprintf(d3, "%d", mat->data.color.b);
-                        list_append(out, generate(DPSetPrimColor, "0", "0", d1, d2, d3, "255"));
-                    }
-                }
-                
-                // Call a pipesync if needed
-                if (pipesync)
-                    list_append(out, generate(DPPipeSync));
-
-                // Update the last texture
-                lastMaterial = mat;
-            }
+            if (ctx->lastmaterial != mat && mat->type != TYPE_OMIT)
+                dlist_loadmaterial(ctx, out, generator, mat);
 
             // Load a new vertex block if it hasn't been
             if (!loadedverts)
             {
                 char d2[32];
-                sprintf(strbuff, "vtx_%s", global_modelname);
-                if (ismultimesh)
+                sprintf(strbuff, "vtx_%s", ctx->settings.modelname);
+                if (ismultimesh || mesh->lodlevel > 0)
                 {
                     strcat(strbuff, "_");
                     strcat(strbuff, mesh->name);
                 }
                 strcat(strbuff, "+");
+                
+                // Before the first vertex block, test the bounding box so the RSP can skip the rest of the DL
+                if (needcull)
+                {
+                    char bboxstr[STRBUF_SIZE];
+                    sprintf(bboxstr, "%s0", strbuff);
+                    list_append(out, generate(SPVertex, bboxstr, "8", "0"));
+                    list_append(out, generate(SPCullDisplayList, "0", "7"));
+                    needcull = FALSE;
+                }
                 sprintf(d2, "%d", vertindex);
                 strcat(strbuff, d2);
                 sprintf(d2, "%d", vcache->verts.size);
@@ -514,7 +592,7 @@ linkedList* dlist_frommesh(s64Mesh* mesh, char isbinary)
             }
             
             // If we can, dump a 2Tri, otherwise dump a single triangle
-            if (!global_no2tri && facenode->next != NULL && ((s64Face*)facenode->next->data)->material == lastMaterial)
+            if (!ctx->settings.no2tri && facenode->next != NULL && ((s64Face*)facenode->next->data)->material == ctx->lastmaterial)
             {
                 char d1[32], d2[32], d3[32], d4[32], d5[32], d6[32];
                 s64Face* prevface = face;
@@ -544,32 +622,169 @@ linkedList* dlist_frommesh(s64Mesh* mesh, char isbinary)
         if (!isbinary && vcachenode->next != NULL)
             list_append(out, mallocstring("\n"));
     }
+    
+    // Ensure the requested material is loaded when we leave
+    if (exitmat != NULL && ctx->lastmaterial != exitmat)
+        dlist_loadmaterial(ctx, out, generator, exitmat);
     list_append(out, generate(SPEndDisplayList));
     return out;
 }
 
 
+/*==============================
+    dlist_frommesh
+    Constructs a display list from a single mesh.
+    If every mesh needs to load its own material, the
+    material state left by the previous mesh is ignored
+    @param   The conversion context
+    @param   The mesh to build a DL of
+    @param   Whether the DL should be binary
+    @returns A linked list with the DL data
+==============================*/
+
+linkedList* dlist_frommesh(arabikiContext* ctx, s64Mesh* mesh, char isbinary)
+{
+    // If the meshes can be culled on the CPU, every mesh must load its own material
+    if (ctx->settings.meshload)
+        ctx->lastmaterial = NULL;
+    return dlist_build(ctx, mesh, isbinary, NULL);
+}
+
+
+/*==============================
+    dlist_fromlod
+    Constructs a display list from a mesh LOD.
+    Since only one of a mesh's LODs is drawn, every LOD
+    must start and end with the same material state as
+    the full detail mesh's display list
+    @param   The conversion context
+    @param   The LOD mesh to build a DL of
+    @param   The material loaded before the mesh's DL
+    @param   The material loaded after the mesh's DL
+    @param   Whether the DL should be binary
+    @returns A linked list with the DL data
+==============================*/
+
+linkedList* dlist_fromlod(arabikiContext* ctx, s64Mesh* lod, n64Material* entrymat, n64Material* exitmat, char isbinary)
+{
+    if (ctx->settings.meshload)
+    {
+        entrymat = NULL;
+        exitmat = NULL;
+    }
+    ctx->lastmaterial = entrymat;
+    return dlist_build(ctx, lod, isbinary, exitmat);
+}
+
+
+/*==============================
+    dltext_writemesh
+    Writes a mesh's vertices and display list
+    to a file
+    @param The conversion context
+    @param The file to write to
+    @param The mesh to write
+    @param The mesh's display list
+==============================*/
+
+static void dltext_writemesh(arabikiContext* ctx, FILE* fp, s64Mesh* mesh, linkedList* dl)
+{
+    bool ismultimesh = (ctx->meshes.size > 1);
+    int vertindex = 0;
+    
+    // Cycle through the vertex cache list and dump the vertices
+    fprintf(fp, "static Vtx vtx_%s", ctx->settings.modelname);
+    if (ismultimesh || mesh->lodlevel > 0)
+        fprintf(fp, "_%s", mesh->name);
+    fprintf(fp, "[] = {\n");
+    if (mesh->hascullbox)
+    {
+        for (int i=0; i<8; i++)
+        {
+            Vector3D corner = get_cullbox_corner(mesh, i);
+            fprintf(fp, "    {%d, %d, %d, 0, 0, 0, 0, 0, 0, 255}, /* %d */\n", (int)corner.x, (int)corner.y, (int)corner.z, vertindex++);
+        }
+    }
+    for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+    {
+        vertCache* vcache = (vertCache*)vcachenode->data;
+        listNode* vertnode;
+        
+        // Cycle through all the verts
+        for (vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
+        {
+            int texturew = 0, textureh = 0;
+            s64Vert* vert = (s64Vert*)vertnode->data;
+            n64Material* mat = find_material_fromvert(&vcache->faces, vert);
+            Vector3D normorcol = {0, 0, 0};
+            
+            // Ensure the texture is valid
+            if (mat == NULL)
+                terminate(ctx, "Error: Inconsistent face/vertex texture information\n");
+            
+            // Retrieve texture/normal/color data for this vertex
+            switch (mat->type)
+            {
+                case TYPE_TEXTURE:
+                    // Get the texture size
+                    texturew = (mat->data).image.w;
+                    textureh = (mat->data).image.h;
+                    
+                    // Intentional fallthrough
+                case TYPE_PRIMCOL:
+                    // Pick vertex normals or vertex colors, depending on the texture flag
+                    if (mat_hasgeoflag(mat, "G_LIGHTING"))
+                        normorcol = vector_scale(vert->normal, 127);
+                    else
+                        normorcol = vector_scale(vert->color, 255);
+                    break;
+                case TYPE_OMIT:
+                    break;
+            }
+            
+            // Dump the vert data
+            fprintf(fp, "    {%d, %d, %d, 0, %d, %d, %d, %d, %d, 255}, /* %d */\n", 
+                (int)round(vert->pos.x), (int)round(vert->pos.y), (int)round(vert->pos.z),
+                float_to_s10p5(vert->UV.x*texturew), float_to_s10p5(vert->UV.y*textureh),
+                (int)round(normorcol.x), (int)round(normorcol.y), (int)round(normorcol.z),
+                vertindex++
+            );
+        }
+    }
+    fprintf(fp, "};\n\n");
+    
+    // Then cycle through the vertex cache list again, but now dump the display list
+    fprintf(fp, "static Gfx gfx_%s", ctx->settings.modelname);
+    if (ismultimesh || mesh->lodlevel > 0)
+        fprintf(fp, "_%s", mesh->name);
+    fprintf(fp, "[] = {\n");
+    for (listNode* dlnode = dl->head; dlnode != NULL; dlnode = dlnode->next)
+        fprintf(fp, "%s", (char*)dlnode->data);
+    list_destroy_deep(dl);
+    fprintf(fp, "};\n\n");
+}
+
+
 /*==============================
     construct_dltext
     Constructs a display list and stores it
     in a temporary file
+    @param The conversion context
 ==============================*/
 
-void construct_dltext()
+void construct_dltext(arabikiContext* ctx)
 {
     FILE* fp;
-    linkedList* dl;
     char strbuff[STRBUF_SIZE];
-    bool ismultimesh = (list_meshes.size > 1);
     
     // Open a temp file to write our display list to
-    sprintf(strbuff, "temp_%s", global_outputname);
+    sprintf(strbuff, "temp_%s", ctx->settings.outputname);
     fp = fopen(strbuff, "w+");
     if (fp == NULL)
-        terminate("Error: Unable to open temporary file for writing\n");
+        terminate(ctx, "Error: Unable to open temporary file for writing\n");
     
     // Announce we're gonna construct the DL
-    if (!global_quiet) printf("Constructing display lists\n");
+    if (!ctx->settings.quiet) printf("Constructing display lists\n");
     
     // Vertex data header
     fprintf(fp, "\n// Custom combine mode to allow mixing primitive and vertex colors\n"
@@ -580,77 +795,25 @@ void construct_dltext()
     );
     
     // Iterate through all the meshes
-    for (listNode* meshnode = list_meshes.head; meshnode != NULL; meshnode = meshnode->next)
+    for (listNode* meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
     {
-        int vertindex = 0;
         s64Mesh* mesh = (s64Mesh*)meshnode->data;
+        n64Material* entrymat = ctx->lastmaterial;
+        n64Material* exitmat;
+        
+        // Write the mesh itself
+        dltext_writemesh(ctx, fp, mesh, dlist_frommesh(ctx, mesh, FALSE));
+        exitmat = ctx->lastmaterial;
         
-        // Cycle through the vertex cache list and dump the vertices
-        fprintf(fp, "static Vtx vtx_%s", global_modelname);
-        if (ismultimesh)
-            fprintf(fp, "_%s", mesh->name);
-        fprintf(fp, "[] = {\n");
-        for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+        // Then its LODs
+        for (listNode* lodnode = mesh->lods.head; lodnode != NULL; lodnode = lodnode->next)
         {
-            vertCache* vcache = (vertCache*)vcachenode->data;
-            listNode* vertnode;
-            
-            // Cycle through all the verts
-            for (vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
-            {
-                int texturew = 0, textureh = 0;
-                s64Vert* vert = (s64Vert*)vertnode->data;
-                n64Material* mat = find_material_fromvert(&vcache->faces, vert);
-                Vector3D normorcol = {0, 0, 0};
-                
-                // Ensure the texture is valid
-                if (mat == NULL)
-                    terminate("Error: Inconsistent face/vertex texture information\n");
-                
-                // Retrieve texture/normal/color data for this vertex
-                switch (mat->type)
-                {
-                    case TYPE_TEXTURE:
-                        // Get the texture size
-                        texturew = (mat->data).image.w;
-                        textureh = (mat->data).image.h;
-                        
-                        // Intentional fallthrough
-                    case TYPE_PRIMCOL:
-                        // Pick vertex normals or vertex colors, depending on the texture flag
-                        if (mat_hasgeoflag(mat, "G_LIGHTING"))
-                            normorcol = vector_scale(vert->normal, 127);
-                        else
-                            normorcol = vector_scale(vert->color, 255);
-                        break;
-                    case TYPE_OMIT:
-                        break;
-                }
-                
-                // Dump the vert data
-                fprintf(fp, "    {%d, %d, %d, 0, %d, %d, %d, %d, %d, 255}, /* %d */\n", 
-                    (int)round(vert->pos.x), (int)round(vert->pos.y), (int)round(vert->pos.z),
-                    float_to_s10p5(vert->UV.x*texturew), float_to_s10p5(vert->UV.y*textureh),
-                    (int)round(normorcol.x), (int)round(normorcol.y), (int)round(normorcol.z),
-                    vertindex++
-                );
-            }
+            s64Mesh* lod = (s64Mesh*)lodnode->data;
+            dltext_writemesh(ctx, fp, lod, dlist_fromlod(ctx, lod, entrymat, exitmat, FALSE));
         }
-        fprintf(fp, "};\n\n");
-        
-        // Then cycle through the vertex cache list again, but now dump the display list
-        fprintf(fp, "static Gfx gfx_%s", global_modelname);
-        if (ismultimesh)
-            fprintf(fp, "_%s", mesh->name);
-        fprintf(fp, "[] = {\n");
-        dl = dlist_frommesh(mesh, FALSE);
-        for (listNode* dlnode = dl->head; dlnode != NULL; dlnode = dlnode->next)
-            fprintf(fp, "%s", (char*)dlnode->data);
-        list_destroy_deep(dl);
-        fprintf(fp, "};\n\n");
     }
     
     // State we finished
-    if (!global_quiet) printf("Finish building display lists\n");
+    if (!ctx->settings.quiet) printf("Finish building display lists\n");
     fclose(fp);
 }
\ No newline at end of file
@@ -10,11 +10,12 @@
         uint32_t size;
         uint32_t* data;
     } DLCBinary;
-
+    
     extern uint16_t    swap_endian16(uint16_t val);
     extern uint32_t    swap_endian32(uint32_t val);
     extern float       swap_endianfloat(float val);
-    extern linkedList* dlist_frommesh(s64Mesh* mesh, bool isbinary);
-    extern void        construct_dltext();
+    extern linkedList* dlist_frommesh(arabikiContext* ctx, s64Mesh* mesh, bool isbinary);
+    extern linkedList* dlist_fromlod(arabikiContext* ctx, s64Mesh* lod, n64Material* entrymat, n64Material* exitmat, bool isbinary);
+    extern void        construct_dltext(arabikiContext* ctx);
     
 #endif
\ No newline at end of file
@@ -0,0 +1,587 @@
+/***************************************************************
+                             lod.c
+
+Generates lower detail versions of meshes by collapsing edges,
+using the quadric error metric from Garland and Heckbert's
+"Surface Simplification Using Quadric Error Metrics".
+Only half-edge collapses are performed (a vertex is merged into
+one of its neighbours), so LODs reuse the original vertices and
+never need new UVs, normals or colors to be interpolated.
+***************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "main.h"
+#include "mesh.h"
+
+
+/*********************************
+              Macros
+*********************************/
+
+// Minimum cosine between a face's normal before and after a collapse
+#define LOD_MINNORMALDOT 0.2
+
+
+/*********************************
+             Structs
+*********************************/
+
+typedef struct {
+    double q[10];  // The upper half of a symmetric 4x4 matrix
+    bool   locked; // Whether this vertex can't be collapsed
+    bool   alive;  // Whether this vertex hasn't been collapsed
+    bool   dirty;  // Whether this vertex was modified during this pass
+    int    mark;   // Used for neighbour checking
+} LODVert;
+
+typedef struct {
+    int          verts[MAXVERTS];
+    n64Material* material;
+    bool         alive;
+} LODFace;
+
+typedef struct {
+    int    from;
+    int    to;
+    double cost;
+} LODCollapse;
+
+typedef struct {
+    int a;
+    int b;
+} LODEdge;
+
+typedef struct {
+    s64Vert** vertptrs;
+    LODVert*  verts;
+    int       vertcount;
+    LODFace*  faces;
+    int       facecount;
+    int       facesalive;
+    int       mark;
+} LODMesh;
+
+
+/*==============================
+    quadric_add_plane
+    Adds a plane to a quadric
+    @param The quadric to modify
+    @param The plane's normal
+    @param The plane's distance from the origin
+    @param The weight to give the plane
+==============================*/
+
+static void quadric_add_plane(double* q, Vector3D n, double d, double weight)
+{
+    q[0] += weight*n.x*n.x; q[1] += weight*n.x*n.y; q[2] += weight*n.x*n.z; q[3] += weight*n.x*d;
+    q[4] += weight*n.y*n.y; q[5] += weight*n.y*n.z; q[6] += weight*n.y*d;
+    q[7] += weight*n.z*n.z; q[8] += weight*n.z*d;
+    q[9] += weight*d*d;
+}
+
+
+/*==============================
+    quadric_error
+    Calculates the error of a point, given two quadrics
+    @param The first quadric
+    @param The second quadric
+    @param The point to evaluate
+    @returns The squared distance of the point to the quadrics' planes
+==============================*/
+
+static double quadric_error(double* qa, double* qb, Vector3D p)
+{
+    double q[10];
+    for (int i=0; i<10; i++)
+        q[i] = qa[i] + qb[i];
+    return q[0]*p.x*p.x + 2*q[1]*p.x*p.y + 2*q[2]*p.x*p.z + 2*q[3]*p.x
+         + q[4]*p.y*p.y + 2*q[5]*p.y*p.z + 2*q[6]*p.y
+         + q[7]*p.z*p.z + 2*q[8]*p.z
+         + q[9];
+}
+
+
+/*==============================
+    face_normal
+    Calculates the (unnormalized) normal of a triangle
+    @param The three points of the triangle
+    @returns The normal, with a length of twice the triangle's area
+==============================*/
+
+static Vector3D face_normal(Vector3D a, Vector3D b, Vector3D c)
+{
+    Vector3D u = {b.x - a.x, b.y - a.y, b.z - a.z};
+    Vector3D v = {c.x - a.x, c.y - a.y, c.z - a.z};
+    Vector3D n = {u.y*v.z - u.z*v.y, u.z*v.x - u.x*v.z, u.x*v.y - u.y*v.x};
+    return n;
+}
+
+
+/*==============================
+    compare_edges
+    qsort comparison function for LODEdges
+==============================*/
+
+static int compare_edges(const void* a, const void* b)
+{
+    const LODEdge* e1 = (const LODEdge*)a;
+    const LODEdge* e2 = (const LODEdge*)b;
+    if (e1->a != e2->a)
+        return e1->a - e2->a;
+    return e1->b - e2->b;
+}
+
+
+/*==============================
+    compare_collapses
+    qsort comparison function for LODCollapses
+==============================*/
+
+static int compare_collapses(const void* a, const void* b)
+{
+    const LODCollapse* c1 = (const LODCollapse*)a;
+    const LODCollapse* c2 = (const LODCollapse*)b;
+    if (c1->cost < c2->cost)
+        return -1;
+    return (c1->cost > c2->cost);
+}
+
+
+/*==============================
+    lodmesh_init
+    Builds the working data for simplifying a mesh
+    @param The conversion context
+    @param The mesh to simplify
+    @param The working data to fill
+==============================*/
+
+static void lodmesh_init(arabikiContext* ctx, s64Mesh* mesh, LODMesh* lmesh)
+{
+    int i;
+    int edgecount = 0;
+    LODEdge* edges;
+    listNode* node;
+
+    // Allocate memory for the working data
+    lmesh->vertcount = mesh->verts.size;
+    lmesh->facecount = mesh->faces.size;
+    lmesh->facesalive = mesh->faces.size;
+    lmesh->mark = 0;
+    lmesh->vertptrs = (s64Vert**)calloc(lmesh->vertcount, sizeof(s64Vert*));
+    lmesh->verts = (LODVert*)calloc(lmesh->vertcount, sizeof(LODVert));
+    lmesh->faces = (LODFace*)calloc(lmesh->facecount, sizeof(LODFace));
+    edges = (LODEdge*)calloc(lmesh->facecount*MAXVERTS, sizeof(LODEdge));
+    if (lmesh->vertptrs == NULL || lmesh->verts == NULL || lmesh->faces == NULL || edges == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for LOD generation\n");
+
+    // Copy the vertices
+    i = 0;
+    for (node = mesh->verts.head; node != NULL; node = node->next)
+    {
+        lmesh->vertptrs[i] = (s64Vert*)node->data;
+        lmesh->verts[i].alive = TRUE;
+        i++;
+    }
+
+    // Copy the faces
+    i = 0;
+    for (node = mesh->faces.head; node != NULL; node = node->next)
+    {
+        s64Face* face = (s64Face*)node->data;
+        lmesh->faces[i].material = face->material;
+        lmesh->faces[i].alive = TRUE;
+        for (int j=0; j<MAXVERTS; j++)
+            lmesh->faces[i].verts[j] = list_index_from_data(&mesh->verts, face->verts[j]);
+        i++;
+    }
+
+    // Calculate the vertex quadrics and lock vertices shared between materials
+    for (i=0; i<lmesh->facecount; i++)
+    {
+        LODFace* face = &lmesh->faces[i];
+        Vector3D n = face_normal(lmesh->vertptrs[face->verts[0]]->pos, lmesh->vertptrs[face->verts[1]]->pos, lmesh->vertptrs[face->verts[2]]->pos);
+        double len = sqrt(n.x*n.x + n.y*n.y + n.z*n.z);
+        if (len > 0)
+        {
+            Vector3D p = lmesh->vertptrs[face->verts[0]]->pos;
+            n.x /= len;
+            n.y /= len;
+            n.z /= len;
+            for (int j=0; j<MAXVERTS; j++)
+                quadric_add_plane(lmesh->verts[face->verts[j]].q, n, -(n.x*p.x + n.y*p.y + n.z*p.z), len/2);
+        }
+        for (int j=0; j<MAXVERTS; j++)
+        {
+            int v = face->verts[j];
+            for (int k=0; k<i; k++)
+            {
+                LODFace* other = &lmesh->faces[k];
+                if (other->material != face->material && (other->verts[0] == v || other->verts[1] == v || other->verts[2] == v))
+                {
+                    lmesh->verts[v].locked = TRUE;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Lock vertices which share a position with another vertex (UV seams and hard edges)
+    for (i=0; i<lmesh->vertcount; i++)
+    {
+        Vector3D p1 = lmesh->vertptrs[i]->pos;
+        for (int j=i+1; j<lmesh->vertcount; j++)
+        {
+            Vector3D p2 = lmesh->vertptrs[j]->pos;
+            if (p1.x == p2.x && p1.y == p2.y && p1.z == p2.z)
+            {
+                lmesh->verts[i].locked = TRUE;
+                lmesh->verts[j].locked = TRUE;
+            }
+        }
+    }
+
+    // Lock vertices on open or non-manifold edges, by counting how many faces use each edge
+    for (i=0; i<lmesh->facecount; i++)
+    {
+        for (int j=0; j<MAXVERTS; j++)
+        {
+            int a = lmesh->faces[i].verts[j];
+            int b = lmesh->faces[i].verts[(j+1)%MAXVERTS];
+            edges[edgecount].a = (a < b) ? a : b;
+            edges[edgecount].b = (a < b) ? b : a;
+            edgecount++;
+        }
+    }
+    qsort(edges, edgecount, sizeof(LODEdge), compare_edges);
+    for (i=0; i<edgecount;)
+    {
+        int count = 1;
+        while (i+count < edgecount && !compare_edges(&edges[i], &edges[i+count]))
+            count++;
+        if (count != 2)
+        {
+            lmesh->verts[edges[i].a].locked = TRUE;
+            lmesh->verts[edges[i].b].locked = TRUE;
+        }
+        i += count;
+    }
+    free(edges);
+}
+
+
+/*==============================
+    lodmesh_cancollapse
+    Checks whether merging one vertex into another keeps
+    the mesh valid
+    @param The working data
+    @param The vertex to remove
+    @param The vertex to merge into
+    @returns Whether the collapse is allowed
+==============================*/
+
+static bool lodmesh_cancollapse(LODMesh* lmesh, int from, int to)
+{
+    int shared = 0;
+    lmesh->mark += 2;
+
+    // Mark all the neighbours of the vertex being removed
+    for (int i=0; i<lmesh->facecount; i++)
+    {
+        LODFace* face = &lmesh->faces[i];
+        if (!face->alive || (face->verts[0] != from && face->verts[1] != from && face->verts[2] != from))
+            continue;
+        for (int j=0; j<MAXVERTS; j++)
+            lmesh->verts[face->verts[j]].mark = lmesh->mark;
+    }
+
+    // Count how many neighbours are shared. More than two means the collapse would create a non-manifold edge
+    for (int i=0; i<lmesh->facecount; i++)
+    {
+        LODFace* face = &lmesh->faces[i];
+        if (!face->alive || (face->verts[0] != to && face->verts[1] != to && face->verts[2] != to))
+            continue;
+        for (int j=0; j<MAXVERTS; j++)
+        {
+            int v = face->verts[j];
+            if (v != from && v != to && lmesh->verts[v].mark == lmesh->mark)
+            {
+                lmesh->verts[v].mark = lmesh->mark+1;
+                shared++;
+            }
+        }
+    }
+    if (shared > 2)
+        return FALSE;
+
+    // Ensure none of the remaining faces flip or become degenerate
+    for (int i=0; i<lmesh->facecount; i++)
+    {
+        LODFace* face = &lmesh->faces[i];
+        Vector3D old[MAXVERTS], new[MAXVERTS];
+        Vector3D n1, n2;
+        double len1, len2;
+        if (!face->alive || (face->verts[0] != from && face->verts[1] != from && face->verts[2] != from))
+            continue;
+        if (face->verts[0] == to || face->verts[1] == to || face->verts[2] == to)
+            continue;
+        for (int j=0; j<MAXVERTS; j++)
+        {
+            old[j] = new[j] = lmesh->vertptrs[face->verts[j]]->pos;
+            if (face->verts[j] == from)
+                new[j] = lmesh->vertptrs[to]->pos;
+        }
+        n1 = face_normal(old[0], old[1], old[2]);
+        n2 = face_normal(new[0], new[1], new[2]);
+        len1 = sqrt(n1.x*n1.x + n1.y*n1.y + n1.z*n1.z);
+        len2 = sqrt(n2.x*n2.x + n2.y*n2.y + n2.z*n2.z);
+        if (len2 == 0 || (len1 > 0 && (n1.x*n2.x + n1.y*n2.y + n1.z*n2.z)/(len1*len2) < LOD_MINNORMALDOT))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+
+/*==============================
+    lodmesh_collapse
+    Merges one vertex into another
+    @param The working data
+    @param The vertex to remove
+    @param The vertex to merge into
+==============================*/
+
+static void lodmesh_collapse(LODMesh* lmesh, int from, int to)
+{
+    for (int i=0; i<lmesh->facecount; i++)
+    {
+        LODFace* face = &lmesh->faces[i];
+        bool usesfrom = FALSE, usesto = FALSE;
+        if (!face->alive)
+            continue;
+        for (int j=0; j<MAXVERTS; j++)
+        {
+            usesfrom |= (face->verts[j] == from);
+            usesto |= (face->verts[j] == to);
+        }
+
+        // Faces with both vertices disappear, faces with the removed vertex now use the other one
+        if (usesfrom && usesto)
+        {
+            face->alive = FALSE;
+            lmesh->facesalive--;
+        }
+        else if (usesfrom)
+        {
+            for (int j=0; j<MAXVERTS; j++)
+            {
+                if (face->verts[j] == from)
+                    face->verts[j] = to;
+                lmesh->verts[face->verts[j]].dirty = TRUE;
+            }
+        }
+    }
+
+    // Accumulate the error of the removed vertex
+    for (int i=0; i<10; i++)
+        lmesh->verts[to].q[i] += lmesh->verts[from].q[i];
+    lmesh->verts[from].alive = FALSE;
+    lmesh->verts[from].dirty = TRUE;
+    lmesh->verts[to].dirty = TRUE;
+}
+
+
+/*==============================
+    lodmesh_simplify
+    Collapses edges until the mesh reaches a target face count,
+    or until no more edges can be collapsed
+    @param The conversion context
+    @param The working data
+    @param The face count to reach
+==============================*/
+
+static void lodmesh_simplify(arabikiContext* ctx, LODMesh* lmesh, int target)
+{
+    LODCollapse* collapses = (LODCollapse*)malloc(sizeof(LODCollapse)*lmesh->facecount*MAXVERTS*2);
+    if (collapses == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for LOD generation\n");
+
+    // Each pass finds the cheapest collapses that don't touch each other and performs them
+    while (lmesh->facesalive > target)
+    {
+        int count = 0, performed = 0;
+
+        // Find every possible collapse
+        for (int i=0; i<lmesh->facecount; i++)
+        {
+            LODFace* face = &lmesh->faces[i];
+            if (!face->alive)
+                continue;
+            for (int j=0; j<MAXVERTS; j++)
+            {
+                int a = face->verts[j];
+                int b = face->verts[(j+1)%MAXVERTS];
+                if (!lmesh->verts[a].locked)
+                {
+                    collapses[count].from = a;
+                    collapses[count].to = b;
+                    collapses[count].cost = quadric_error(lmesh->verts[a].q, lmesh->verts[b].q, lmesh->vertptrs[b]->pos);
+                    count++;
+                }
+                if (!lmesh->verts[b].locked)
+                {
+                    collapses[count].from = b;
+                    collapses[count].to = a;
+                    collapses[count].cost = quadric_error(lmesh->verts[a].q, lmesh->verts[b].q, lmesh->vertptrs[a]->pos);
+                    count++;
+                }
+            }
+        }
+        qsort(collapses, count, sizeof(LODCollapse), compare_collapses);
+
+        // Perform the cheapest ones
+        for (int i=0; i<lmesh->vertcount; i++)
+            lmesh->verts[i].dirty = FALSE;
+        for (int i=0; i<count && lmesh->facesalive > target; i++)
+        {
+            LODCollapse* c = &collapses[i];
+            if (!lmesh->verts[c->from].alive || lmesh->verts[c->from].dirty || lmesh->verts[c->to].dirty)
+                continue;
+            if (!lodmesh_cancollapse(lmesh, c->from, c->to))
+                continue;
+            lodmesh_collapse(lmesh, c->from, c->to);
+            performed++;
+        }
+
+        // Stop if the mesh can't be simplified any further
+        if (performed == 0)
+            break;
+    }
+    free(collapses);
+}
+
+
+/*==============================
+    lodmesh_tomesh
+    Creates a mesh object from the current state of the working data
+    @param The conversion context
+    @param The mesh being simplified
+    @param The working data
+    @param The LOD level
+    @param The screen size to use this LOD at
+    @returns The newly created mesh
+==============================*/
+
+static s64Mesh* lodmesh_tomesh(arabikiContext* ctx, s64Mesh* mesh, LODMesh* lmesh, int level, float screensize)
+{
+    int i;
+    bool* used;
+    s64Mesh* lod = (s64Mesh*)calloc(1, sizeof(s64Mesh));
+    if (lod == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for mesh LOD\n");
+    lod->name = (char*)calloc(strlen(mesh->name)+16, 1);
+    if (lod->name == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for mesh LOD name\n");
+    used = (bool*)calloc(lmesh->vertcount, sizeof(bool));
+    if (used == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for LOD generation\n");
+
+    // Copy the mesh's information
+    sprintf(lod->name, "%s_LOD%d", mesh->name, level);
+    lod->parent = mesh->parent;
+    lod->root = mesh->root;
+    lod->props = mesh->props;
+    lod->lodlevel = level;
+    lod->lodscreensize = screensize;
+    lod->boundcenter = mesh->boundcenter;
+    lod->boundradius = mesh->boundradius;
+    lod->boundmin = mesh->boundmin;
+    lod->boundmax = mesh->boundmax;
+
+    // Create the faces, keeping the original order so the material sorting is preserved
+    for (i=0; i<lmesh->facecount; i++)
+    {
+        s64Face* face;
+        if (!lmesh->faces[i].alive)
+            continue;
+        face = add_face(ctx, lod);
+        face->material = lmesh->faces[i].material;
+        for (int j=0; j<MAXVERTS; j++)
+        {
+            face->verts[j] = lmesh->vertptrs[lmesh->faces[i].verts[j]];
+            used[lmesh->faces[i].verts[j]] = TRUE;
+        }
+    }
+
+    // Add the vertices that are still in use
+    for (i=0; i<lmesh->vertcount; i++)
+        if (used[i])
+            list_append(&lod->verts, lmesh->vertptrs[i]);
+
+    // Add the materials that are still in use
+    for (listNode* matnode = mesh->materials.head; matnode != NULL; matnode = matnode->next)
+    {
+        for (listNode* facenode = lod->faces.head; facenode != NULL; facenode = facenode->next)
+        {
+            if (((s64Face*)facenode->data)->material == (n64Material*)matnode->data)
+            {
+                list_append(&lod->materials, matnode->data);
+                break;
+            }
+        }
+    }
+
+    // Done
+    free(used);
+    return lod;
+}
+
+
+/*==============================
+    generate_lods
+    Generates the LODs for every mesh in the model
+    @param The conversion context
+==============================*/
+
+void generate_lods(arabikiContext* ctx)
+{
+    if (!ctx->settings.quiet) printf("    Generating LODs\n");
+
+    for (listNode* meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
+    {
+        LODMesh lmesh;
+        int lastcount;
+        s64Mesh* mesh = (s64Mesh*)meshnode->data;
+
+        // Skip meshes which shouldn't have LODs
+        if (mesh->faces.size == 0 || has_property(mesh, "NoLOD"))
+            continue;
+
+        // Simplify the mesh progressively, storing a snapshot at every level
+        lodmesh_init(ctx, mesh, &lmesh);
+        lastcount = lmesh.facesalive;
+        for (int i=0; i<ctx->settings.lodcount; i++)
+        {
+            int target = (int)(mesh->faces.size*ctx->settings.lodratios[i] + 0.5f);
+            if (target < 1)
+                target = 1;
+            lodmesh_simplify(ctx, &lmesh, target);
+
+            // If we couldn't reduce the mesh any further, then stop here
+            if (lmesh.facesalive == lastcount)
+            {
+                if (!ctx->settings.quiet) printf("        Mesh '%s' can't be simplified further than %d faces\n", mesh->name, lastcount);
+                break;
+            }
+            lastcount = lmesh.facesalive;
+            list_append(&mesh->lods, lodmesh_tomesh(ctx, mesh, &lmesh, mesh->lods.size+1, ctx->settings.lodsizes[i]));
+            if (!ctx->settings.quiet) printf("        Mesh '%s' LOD%d has %d faces (from %d)\n", mesh->name, mesh->lods.size, lastcount, mesh->faces.size);
+        }
+
+        // Garbage collect
+        free(lmesh.vertptrs);
+        free(lmesh.verts);
+        free(lmesh.faces);
+    }
+}
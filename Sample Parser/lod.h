@@ -0,0 +1,6 @@
+#ifndef _SAUSN64_LOD_H
+#define _SAUSN64_LOD_H
+
+    extern void generate_lods(arabikiContext* ctx);
+    
+#endif
\ No newline at end of file
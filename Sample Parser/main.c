@@ -1,17 +1,14 @@
 /***************************************************************
                              main.c
                              
-Program entrypoint
+Program entrypoint. The conversion itself is done by the
+library in arabiki64.c, this just handles the command line
 ***************************************************************/
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "main.h"
-#include "material.h"
-#include "parser.h"
-#include "optimizer.h"
-#include "output.h"
 
 
 /*********************************
@@ -19,31 +16,20 @@ Program entrypoint
 *********************************/
 
 static void parse_programargs(int argc, char* argv[]);
+static void parse_lodlist(char* arg);
+static void cli_terminate(char* message);
 
 
 /*********************************
              Globals
 *********************************/
 
-// Model data lists
-linkedList list_meshes = EMPTY_LINKEDLIST;
-linkedList list_animations = EMPTY_LINKEDLIST;
-linkedList list_materials = EMPTY_LINKEDLIST;
-
 // Program settings
-bool global_quiet = FALSE;
-bool global_fixroot = TRUE;
-bool global_binaryout = TRUE;
-bool global_initialload = TRUE;
-bool global_no2tri = FALSE;
-bool global_opengl = FALSE;
-char* global_outputname = "outdlist";
-char* global_modelname = "MyModel";
-unsigned int global_cachesize = 32;
+static arabikiSettings settings;
 
-// Input file pointers
-static FILE *fp_m = NULL;
-static FILE *fp_t = NULL;
+// Input file paths
+static char* path_model = NULL;
+static char* path_materials = NULL;
 
 
 /*==============================
@@ -55,22 +41,25 @@ static FILE *fp_t = NULL;
 
 int main(int argc, char* argv[])
 {
-    lexState state = STATE_NONE;
+    arabikiContext* ctx;
     
     // Print the program title
     printf("======== "PROGRAM_NAME" V"PROGRAM_VERSION" ========""\n");
     
     // If no arguments are given, print the argument list
     if (argc == 1)
-        terminate(
+        cli_terminate(
             "Program arguments:\n"
             "\t-f <File>\tThe file to load\n"
             "\t-s \t\t(optional) Export as C structs\n"
             "\t-t <File>\t(optional) A list of materials and their data\n"
             "\t-2 \t\t(optional) Disable 2Tri optimization (libultra only)\n"
+            "\t-b \t\t(optional) Add bounding boxes to the meshes for RSP culling (libultra only)\n"
             "\t-g \t\t(optional) Export an OpenGL compatible model instead\n"
             "\t-c <Int>\t(optional) Vertex cache size (default '32') (libultra only)\n"
             "\t-i \t\t(optional) Omit initial display list setup (libultra only)\n"
+            "\t-l <Ratios>\t(optional) Generate LODs with the given triangle ratios (ie '0.5,0.25')\n"
+            "\t-m \t\t(optional) Load the material at the start of every mesh, for CPU culling (libultra only)\n"
             "\t-n <Name>\t(optional) Model name (default 'MyModel')\n"
             "\t-o <File>\t(optional) Output filename (default 'outdlist')\n"
             "\t-q \t\t(optional) Quiet mode\n"
@@ -78,24 +67,19 @@ int main(int argc, char* argv[])
         );
      
     // Parse the command line arguments
+    arabiki_defaultsettings(&settings);
+    settings.interactive = TRUE;
     parse_programargs(argc, argv);
+    if (path_model == NULL)
+        cli_terminate("Error: No model file given, use '-f'\n");
     
-    // Parse the materials file if it's given
-    list_append(&list_materials, &material_none);
-    if (fp_t != NULL)
-        parse_materials(fp_t);
-        
-    // Parse the model file
-    parse_sausage(fp_m);
-    
-    // Optimize the model
-    optimize_mdl();
-    
-    // Save our model data to a file
-    if (!global_binaryout)
-        write_output_text();
-    else
-        write_output_binary();
+    // Convert the model
+    ctx = arabiki_create(&settings);
+    if (ctx == NULL)
+        cli_terminate("Error: Unable to allocate memory for the converter\n");
+    if (!arabiki_convert(ctx, path_model, path_materials))
+        puts(arabiki_geterror(ctx));
+    arabiki_destroy(ctx);
     return 0;
 }
 
@@ -122,85 +106,148 @@ static void parse_programargs(int argc, char* argv[])
                 case 'f':
                     i++;
                     if (i == argc)
-                        terminate("Error: Incorrect number of arguments provided for '-f'\n");
-                    fp_m = fopen(argv[i], "r");
-                    if (fp_m == NULL)
-                    {
-                        sprintf(errbuf, "Unable to open file '%s'\n", argv[i]);
-                        terminate(errbuf);
-                    }
+                        cli_terminate("Error: Incorrect number of arguments provided for '-f'\n");
+                    path_model = argv[i];
                     break;
                 case 't':
                     i++;
                     if (i == argc)
-                        terminate("Error: Incorrect number of arguments provided for '-t'\n");
-                    fp_t = fopen(argv[i], "r");
-                    if (fp_t == NULL)
-                    {
-                        sprintf(errbuf, "Error: Unable to open file '%s'\n", argv[i]);
-                        terminate(errbuf);
-                    }
+                        cli_terminate("Error: Incorrect number of arguments provided for '-t'\n");
+                    path_materials = argv[i];
                     break;
                 case 'g':
-                    global_opengl = !global_opengl;
+                    settings.opengl = !settings.opengl;
                     break;
                 case 'c':
                     i++;
                     if (i == argc)
-                        terminate("Error: Incorrect number of arguments provided for '-c'\n");
-                    global_cachesize = atoi(argv[i]);
-                    if (global_cachesize < 3)
-                        terminate("Error: Vertex cache size can't be smaller than a triangle.\n");
+                        cli_terminate("Error: Incorrect number of arguments provided for '-c'\n");
+                    settings.cachesize = atoi(argv[i]);
+                    if (settings.cachesize < 3)
+                        cli_terminate("Error: Vertex cache size can't be smaller than a triangle.\n");
                     break;
                 case 'o':
                     i++;
                     if (i == argc)
-                        terminate("Error: Incorrect number of arguments provided for '-o'\n");
-                    global_outputname = argv[i];
+                        cli_terminate("Error: Incorrect number of arguments provided for '-o'\n");
+                    settings.outputname = argv[i];
                     break;
                 case 'n':
                     i++;
                     if (i == argc)
-                        terminate("Error: Incorrect number of arguments provided for '-n'\n");
-                    global_modelname = argv[i];
+                        cli_terminate("Error: Incorrect number of arguments provided for '-n'\n");
+                    settings.modelname = argv[i];
+                    break;
+                case 'l':
+                    i++;
+                    if (i == argc)
+                        cli_terminate("Error: Incorrect number of arguments provided for '-l'\n");
+                    parse_lodlist(argv[i]);
                     break;
                 case 'r':
-                    global_fixroot = !global_fixroot;
+                    settings.fixroot = !settings.fixroot;
                     break;
                 case 'q':
-                    global_quiet = !global_quiet;
+                    settings.quiet = !settings.quiet;
                     break;
                 case 's':
-                    global_binaryout = !global_binaryout;
+                    settings.binaryout = !settings.binaryout;
                     break;
                 case 'i':
-                    global_initialload = !global_initialload;
+                    settings.initialload = !settings.initialload;
                     break;
                 case '2':
-                    global_no2tri = !global_no2tri;
+                    settings.no2tri = !settings.no2tri;
+                    break;
+                case 'b':
+                    settings.cullbox = !settings.cullbox;
+                    break;
+                case 'm':
+                    settings.meshload = !settings.meshload;
                     break;
                 default:
                     sprintf(errbuf, "Error: Unknown argument '%s'\n", argv[i]);
-                    terminate(errbuf);
+                    cli_terminate(errbuf);
                     break;
             }
         }
         else
         {
             sprintf(errbuf, "Error: Invalid argument '%s'\n", argv[i]);
-            terminate(errbuf);
+            cli_terminate(errbuf);
         }
     }
 }
 
 
 /*==============================
-    terminate
+    parse_lodlist
+    Parses the list of LOD levels to generate. Each level is
+    given as "Ratio[:ScreenSize]", separated by commas, where
+    the ratio is the fraction of triangles to keep and the
+    screen size is the fraction of the screen height below 
+    which the LOD should be used.
+    @param The LOD list string
+==============================*/
+
+static void parse_lodlist(char* arg)
+{
+    char errbuf[256];
+    char* token = strtok(arg, ",");
+    
+    settings.lodcount = 0;
+    while (token != NULL)
+    {
+        char* size = strchr(token, ':');
+        float ratio;
+        
+        // Check we haven't gone over the limit
+        if (settings.lodcount == MAXLODS)
+        {
+            sprintf(errbuf, "Error: Only up to %d LODs are supported\n", MAXLODS);
+            cli_terminate(errbuf);
+        }
+        
+        // Get the triangle ratio
+        ratio = atof(token);
+        if (ratio <= 0.0f || ratio >= 1.0f)
+        {
+            sprintf(errbuf, "Error: LOD ratio '%s' must be between 0 and 1\n", token);
+            cli_terminate(errbuf);
+        }
+        if (settings.lodcount > 0 && ratio >= settings.lodratios[settings.lodcount-1])
+            cli_terminate("Error: LOD ratios must be in decreasing order\n");
+        settings.lodratios[settings.lodcount] = ratio;
+        
+        // Get the screen size, or calculate one from the ratio if it wasn't given
+        if (size != NULL)
+        {
+            settings.lodsizes[settings.lodcount] = atof(size+1);
+            if (settings.lodsizes[settings.lodcount] <= 0.0f)
+            {
+                sprintf(errbuf, "Error: Invalid LOD screen size '%s'\n", size+1);
+                cli_terminate(errbuf);
+            }
+        }
+        else
+            settings.lodsizes[settings.lodcount] = ratio*LOD_DEFAULTSIZE;
+        if (settings.lodcount > 0 && settings.lodsizes[settings.lodcount] >= settings.lodsizes[settings.lodcount-1])
+            cli_terminate("Error: LOD screen sizes must be in decreasing order\n");
+        
+        // Next LOD
+        settings.lodcount++;
+        token = strtok(NULL, ",");
+    }
+}
+
+
+/*==============================
+    cli_terminate
     Stops the program with an optional message
     @param The message to print, or NULL
 ==============================*/
 
-void terminate(char* message)
+static void cli_terminate(char* message)
 {
     if (message != NULL)
         puts(message);
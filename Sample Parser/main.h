@@ -1,7 +1,11 @@
 #ifndef _SAUSN64_MAIN_H
 #define _SAUSN64_MAIN_H
 
+    #include <stdio.h>
+    #include <setjmp.h>
     #include "datastructs.h"
+    #include "arabiki64.h"
+    #include "material.h"
 
 
     /*********************************
@@ -10,32 +14,59 @@
 
     #define PROGRAM_NAME    "Arabiki64"
     #define PROGRAM_VERSION "1.4"
-    #define BINARY_VERSION  0
+    #define BINARY_VERSION  3
+    
+    #define MAXLODS ARABIKI_MAXLODS
+    #define LOD_DEFAULTSIZE 0.2f
+    
+    #define ERRORMSG_SIZE 512
     
     
     /*********************************
-                 Globals
+                 Structs
     *********************************/
     
-    extern linkedList list_meshes;
-    extern linkedList list_animations;
-    extern linkedList list_materials;
-    
-    extern bool global_quiet;
-    extern bool global_fixroot;
-    extern bool global_binaryout;
-    extern bool global_initialload;
-    extern bool global_no2tri;
-    extern bool global_opengl;
-    extern char* global_outputname;
-    extern char* global_modelname;
-    extern unsigned int global_cachesize;
+    // Everything a single conversion works with
+    struct arabikiContext {
+        arabikiSettings settings;
+        
+        // Input files
+        FILE* modelfile;
+        FILE* materialfile;
+        
+        // Model data lists
+        linkedList meshes;
+        linkedList animations;
+        linkedList materials;
+        
+        // Display list state
+        n64Material* lastmaterial;
+        
+        // Material flag parsing state
+        n64Material* flagmaterial;
+        bool flagrender2;
+        bool flagcombine2;
+        bool flagtexmode2;
+        linkedList flagstrings;
+        
+        // Forsyth lookup tables
+        int* forsyth_posscore;
+        int* forsyth_valencescore;
+        
+        // Per mesh display list costs
+        arabikiMeshBudget* budgets;
+        int budgetcount;
+        
+        // Error handling
+        jmp_buf errorjump;
+        char errormessage[ERRORMSG_SIZE];
+    };
     
     
     /*********************************
                 Functions
     *********************************/
 
-    extern void terminate(char* message);
+    extern void terminate(arabikiContext* ctx, char* message);
     
 #endif
\ No newline at end of file
@@ -1 +1 @@
-gcc -O3 -o arabiki64.exe main.c datastructs.c mesh.c material.c animation.c parser.c optimizer.c dlist.c opengl.c output.c gbi.c
\ No newline at end of file
+gcc -O3 -o arabiki64.exe main.c arabiki64.c datastructs.c mesh.c material.c animation.c parser.c optimizer.c lod.c dlist.c opengl.c output.c gbi.c
\ No newline at end of file
@@ -43,21 +43,22 @@ void clean_stdin()
 /*==============================
     add_texture
     Creates an image texture and adds it to the material list
+    @param The conversion context
     @param The name of the material
     @param The image width in texels
     @param The image height in texels
     @returns The newly created n64Material
 ==============================*/
 
-n64Material* add_texture(char* name, short w, short h)
+n64Material* add_texture(arabikiContext* ctx, char* name, short w, short h)
 {
     // Allocate memory for the material struct and string name
     n64Material* mat = (n64Material*)calloc(1, sizeof(n64Material));
     if (mat == NULL)
-        terminate("Error: Unable to allocate memory for texture object\n");
+        terminate(ctx, "Error: Unable to allocate memory for texture object\n");
     mat->name = (char*)calloc(1, strlen(name)+1);
     if (mat->name == NULL)
-        terminate("Error: Unable to allocate memory for texture name\n");
+        terminate(ctx, "Error: Unable to allocate memory for texture name\n");
     
     // Store the data in the newly created texture struct
     mat->type = TYPE_TEXTURE;
@@ -79,7 +80,8 @@ n64Material* add_texture(char* name, short w, short h)
     memcpy(mat->geomode, default_geoflags, 10*32);
     
     // Add this texture to our material list and return it
-    list_append(&list_materials, mat);
+    if (list_append(&ctx->materials, mat) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
     return mat;
 }
 
@@ -87,6 +89,7 @@ n64Material* add_texture(char* name, short w, short h)
 /*==============================
     add_primcol
     Creates a primitive color material and adds it to the material list
+    @param The conversion context
     @param The name of the material
     @param The primitve red component
     @param The primitve green component
@@ -94,15 +97,15 @@ n64Material* add_texture(char* name, short w, short h)
     @returns The newly created n64Material
 ==============================*/
 
-n64Material* add_primcol(char* name, color r, color g, color b)
+n64Material* add_primcol(arabikiContext* ctx, char* name, color r, color g, color b)
 {
     // Allocate memory for the material struct and string name
     n64Material* mat = (n64Material*)calloc(1, sizeof(n64Material));
     if (mat == NULL)
-        terminate("Error: Unable to allocate memory for primitive color object\n");
+        terminate(ctx, "Error: Unable to allocate memory for primitive color object\n");
     mat->name = (char*)calloc(1, strlen(name)+1);
     if (mat->name == NULL)
-        terminate("Error: Unable to allocate memory for primitive color name\n");
+        terminate(ctx, "Error: Unable to allocate memory for primitive color name\n");
     
     // Store the data in the newly created material struct
     mat->type = TYPE_PRIMCOL;
@@ -121,7 +124,8 @@ n64Material* add_primcol(char* name, color r, color g, color b)
     memcpy(mat->geomode, default_geoflags, 10*32);
     
     // Add this material to our materials list and return it
-    list_append(&list_materials, mat);
+    if (list_append(&ctx->materials, mat) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
     return mat;
 }
 
@@ -129,16 +133,17 @@ n64Material* add_primcol(char* name, color r, color g, color b)
 /*==============================
     find_material
     Searches through the list of materials for a material with the specified name
+    @param The conversion context
     @param The material name
     @returns The requested n64Material, or NULL if none was found 
 ==============================*/
 
-n64Material* find_material(char* name)
+n64Material* find_material(arabikiContext* ctx, char* name)
 {
     listNode* curnode;
     
     // Iterate through the material list
-    for (curnode = list_materials.head; curnode != NULL; curnode = curnode->next)
+    for (curnode = ctx->materials.head; curnode != NULL; curnode = curnode->next)
     {
         n64Material* cmat = (n64Material*)curnode->data;
         
@@ -156,6 +161,7 @@ n64Material* find_material(char* name)
     parse_materials
     Reads a text file and parses material data from it
     This function does very little error checking
+    @param The conversion context
     @param The pointer to the material file's handle
     @returns A pointer to the new n64Material 
 ==============================*/
@@ -163,10 +169,10 @@ n64Material* find_material(char* name)
 #pragma GCC diagnostic push 
 #pragma GCC diagnostic ignored "-Wunused-result" // TODO: Implement proper error checking
 
-n64Material* parse_materials(FILE* fp)
+n64Material* parse_materials(arabikiContext* ctx, FILE* fp)
 {
     n64Material* mat;
-    if (!global_quiet) printf("Parsing materials file\n");
+    if (!ctx->settings.quiet) printf("Parsing materials file\n");
     
     // Read the file until we reached the end
     while (!feof(fp))
@@ -205,12 +211,12 @@ n64Material* parse_materials(FILE* fp)
             readname = (char*)calloc(1, strlen(name)+1);
             readtype = (char*)calloc(1, strlen(tok)+1);
             if (readname == NULL || readtype == NULL)
-                terminate("Error: Unable to allocate memory for material error message. Oh dear...\n");
+                terminate(ctx, "Error: Unable to allocate memory for material error message. Oh dear...\n");
             strcpy(readname, name);
             strcpy(readtype, tok);
             memset(strbuf, 0, STRBUFF_SIZE);
             sprintf(strbuf, "Error: Unknown material type '%s' in material '%s'\n", readtype, readname);
-            terminate(strbuf);
+            terminate(ctx, strbuf);
         }
         
         // Create the material from the type
@@ -219,37 +225,37 @@ n64Material* parse_materials(FILE* fp)
             case TYPE_TEXTURE:
                 w = (short)atoi(strtok(NULL, " "));
                 h = (short)atoi(strtok(NULL, " "));
-                mat = add_texture(name, w, h);
-                if (!global_quiet) printf("    Added texture '%s'\n", name);
+                mat = add_texture(ctx, name, w, h);
+                if (!ctx->settings.quiet) printf("    Added texture '%s'\n", name);
                 break;
             case TYPE_PRIMCOL:
                 r = (color)atoi(strtok(NULL, " "));
                 g = (color)atoi(strtok(NULL, " "));
                 b = (color)atoi(strtok(NULL, " "));
-                mat = add_primcol(name, r, g, b);
-                if (!global_quiet) printf("    Added primitive color '%s'\n", name);
+                mat = add_primcol(ctx, name, r, g, b);
+                if (!ctx->settings.quiet) printf("    Added primitive color '%s'\n", name);
                 break;
             case TYPE_OMIT:
                 mat = (n64Material*)calloc(1, sizeof(n64Material));
                 if (mat == NULL)
-                    terminate("Error: Unable to allocate memory for none type material\n");
+                    terminate(ctx, "Error: Unable to allocate memory for none type material\n");
                 mat->name = (char*)calloc(1, strlen(name)+1);
                 if (mat->name == NULL)
-                    terminate("Error: Unable to allocate memory for none material name\n");
+                    terminate(ctx, "Error: Unable to allocate memory for none material name\n");
                 strcpy(mat->name, name);
                 mat->type = TYPE_OMIT;
-                list_append(&list_materials, mat);
+                if (list_append(&ctx->materials, mat) == NULL)
+                    terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
                 break;
         }
         
         // Parse the rest of the arguments
         for (tok = strtok(NULL, " \n\r"); tok != NULL; tok = strtok(NULL, " \n\r"))
-            mat_setflag(mat, tok);
+            mat_setflag(ctx, mat, tok);
     }
     
-    // Close the file, as it's done being parsed
-    if (!global_quiet) printf("Finished parsing materials file\n");
-    fclose(fp);
+    // Finished
+    if (!ctx->settings.quiet) printf("Finished parsing materials file\n");
     return mat;
 }
 
@@ -257,11 +263,12 @@ n64Material* parse_materials(FILE* fp)
 /*==============================
     request_material
     Requests information regarding a new material from the user
+    @param The conversion context
     @param The name of the new material
     @returns A pointer to the new n64Material 
 ==============================*/
 
-n64Material* request_material(char* name)
+n64Material* request_material(arabikiContext* ctx, char* name)
 {
     char* tok;
     char strbuf[STRBUFF_SIZE];
@@ -270,6 +277,13 @@ n64Material* request_material(char* name)
     color r, g, b;
     n64Material* mat;
     
+    // Libraries can't ask the user, so the material must be in the materials file
+    if (!ctx->settings.interactive)
+    {
+        sprintf(strbuf, "Error: Material '%s' is not in the materials file\n", name);
+        terminate(ctx, strbuf);
+    }
+    
     // Request the material type
     printf("New material '%s' found, please specify the following:\n", name);
     printf("\tMaterial type (0 = omit, 1 = texture, 2 = primitive color): ");
@@ -283,12 +297,12 @@ n64Material* request_material(char* name)
             scanf("%d", (int*)&w); clean_stdin();
             printf("\tTexture Height: ");
             scanf("%d", (int*)&h); clean_stdin();
-            mat = add_texture(name, w, h);
+            mat = add_texture(ctx, name, w, h);
             printf("\tMaterial flags (separate by spaces): ");
             fgets(strbuf, STRBUFF_SIZE, stdin);
             for (tok = strtok(strbuf, " \n\r"); tok != NULL; tok = strtok(NULL, " \n\r"))
-                mat_setflag(mat, tok);
-            if (!global_quiet) printf("Added texture '%s'\n", name);
+                mat_setflag(ctx, mat, tok);
+            if (!ctx->settings.quiet) printf("Added texture '%s'\n", name);
             break;
         case TYPE_PRIMCOL:
             printf("\tPrimitve Red: ");
@@ -297,28 +311,29 @@ n64Material* request_material(char* name)
             scanf("%d", (int*)&g); clean_stdin();
             printf("\tPrimitve Blue: ");
             scanf("%d", (int*)&b); clean_stdin();
-            mat = add_primcol(name, r, g, b);
+            mat = add_primcol(ctx, name, r, g, b);
             printf("\tMaterial flags (separate by spaces): ");
             fgets(strbuf, STRBUFF_SIZE, stdin);
             for (tok = strtok(strbuf, " \n\r"); tok != NULL; tok = strtok(NULL, " \n\r"))
-                mat_setflag(mat, tok);
-            if (!global_quiet) printf("Added primitive color '%s'\n", name);
+                mat_setflag(ctx, mat, tok);
+            if (!ctx->settings.quiet) printf("Added primitive color '%s'\n", name);
             break;
         case TYPE_OMIT:
             mat = (n64Material*)calloc(1, sizeof(n64Material));
             if (mat == NULL)
-                terminate("Error: Unable to allocate memory for none type material\n");
+                terminate(ctx, "Error: Unable to allocate memory for none type material\n");
             mat->name = (char*)calloc(1, strlen(name)+1);
             if (mat->name == NULL)
-                terminate("Error: Unable to allocate memory for none material name\n");
+                terminate(ctx, "Error: Unable to allocate memory for none material name\n");
             strcpy(mat->name, name);
             mat->type = TYPE_OMIT;
-            list_append(&list_materials, mat);
-            if (!global_quiet) printf("Omitting material '%s'\n", name);
+            if (list_append(&ctx->materials, mat) == NULL)
+                terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
+            if (!ctx->settings.quiet) printf("Omitting material '%s'\n", name);
             return mat;
         default:
             sprintf(strbuf, "Error: Unknown material type '%d'\n", (int)type);
-            terminate(strbuf);
+            terminate(ctx, strbuf);
     }
     return mat;
 }
@@ -327,32 +342,28 @@ n64Material* request_material(char* name)
 /*==============================
     mat_setflag
     Allows you to modify a material flag
+    @param The conversion context
     @param The material to change
     @param The flag to set
 ==============================*/
 
-void mat_setflag(n64Material* mat, char* flag)
+void mat_setflag(arabikiContext* ctx, n64Material* mat, char* flag)
 {
-    // Static variables to keep track of stuff between sucessive calls to this function
     char* copy;
-    static n64Material* lastmat = NULL;
-    static bool render2 = FALSE;
-    static bool combine2 = FALSE;
-    static bool texmode2 = FALSE;
     
-    // Make a copy of the string
+    // Make a copy of the string, which the context frees when it's destroyed
     copy = (char*)calloc(1, strlen(flag)+1);
-    if (copy == NULL)
-        terminate("Error: Unable to allocate memory for flag name copy\n");
+    if (copy == NULL || list_append(&ctx->flagstrings, copy) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for flag name copy\n");
     strcpy(copy, flag);
     
     // If our texture changed, reset the last flags
-    if (lastmat != mat)
+    if (ctx->flagmaterial != mat)
     {
-        render2 = FALSE;
-        combine2 = FALSE;
-        texmode2 = FALSE;
-        lastmat = mat;
+        ctx->flagrender2 = FALSE;
+        ctx->flagcombine2 = FALSE;
+        ctx->flagtexmode2 = FALSE;
+        ctx->flagmaterial = mat;
     }
     
     // Set the material flags
@@ -374,20 +385,20 @@ void mat_setflag(n64Material* mat, char* flag)
     }
     else if (!strncmp(copy, G_CC_, sizeof(G_CC_)-1))
     {
-        if (!combine2)
+        if (!ctx->flagcombine2)
         {
             mat->combinemode1 = copy;
-            combine2 = TRUE;
+            ctx->flagcombine2 = TRUE;
         }
         else
             mat->combinemode2 = copy;
     }
     else if (!strncmp(copy, G_RM_, sizeof(G_RM_)-1))
     {
-        if (!render2)
+        if (!ctx->flagrender2)
         {
             mat->rendermode1 = copy;
-            render2 = TRUE;
+            ctx->flagrender2 = TRUE;
         }
         else
             mat->rendermode2 = copy;
@@ -395,23 +406,23 @@ void mat_setflag(n64Material* mat, char* flag)
     else if (!strncmp(copy, G_IM_FMT_, sizeof(G_IM_FMT_)-1))
     {
         if (mat->type != TYPE_TEXTURE)
-            terminate("Error: Attempted to set image format on something that isn't a texture!\n");
+            terminate(ctx, "Error: Attempted to set image format on something that isn't a texture!\n");
         mat->data.image.coltype = copy;
     }
     else if (!strncmp(copy, G_IM_SIZ_, sizeof(G_IM_SIZ_)-1))
     {
         if (mat->type != TYPE_TEXTURE)
-            terminate("Error: Attempted to set image bit size on something that isn't a texture!\n");
+            terminate(ctx, "Error: Attempted to set image bit size on something that isn't a texture!\n");
         mat->data.image.colsize = copy;
     }
     else if (!strncmp(copy, G_TX_, sizeof(G_TX_)-1))
     {
         if (mat->type != TYPE_TEXTURE)
-            terminate("Error: Attempted to set texture mode on something that isn't a texture!\n");
-        if (!texmode2)
+            terminate(ctx, "Error: Attempted to set texture mode on something that isn't a texture!\n");
+        if (!ctx->flagtexmode2)
         {
             mat->data.image.texmodes = copy;
-            texmode2 = TRUE;
+            ctx->flagtexmode2 = TRUE;
         }
         else
             mat->data.image.texmodet = copy;
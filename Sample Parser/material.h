@@ -115,12 +115,12 @@
                 Functions
     *********************************/
     
-    extern n64Material* add_texture(char* name, short w, short h);
-    extern n64Material* add_primcol(char* name, color r, color g, color b);
-    extern n64Material* find_material(char* name);
-    extern n64Material* parse_materials(FILE* fp);
-    extern n64Material* request_material(char* name);
-    extern void        mat_setflag(n64Material* mat, char* flag);
+    extern n64Material* add_texture(arabikiContext* ctx, char* name, short w, short h);
+    extern n64Material* add_primcol(arabikiContext* ctx, char* name, color r, color g, color b);
+    extern n64Material* find_material(arabikiContext* ctx, char* name);
+    extern n64Material* parse_materials(arabikiContext* ctx, FILE* fp);
+    extern n64Material* request_material(arabikiContext* ctx, char* name);
+    extern void        mat_setflag(arabikiContext* ctx, n64Material* mat, char* flag);
     extern bool        mat_hasgeoflag(n64Material* mat, char* flag);
     extern bool        isvalidmat(n64Material* mat);
     extern int         get_validtexindex(linkedList* materials, char* name);
@@ -7,6 +7,7 @@ Handles the parsing and creation of meshes
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include "main.h"
 #include "mesh.h"
 
@@ -14,25 +15,27 @@ Handles the parsing and creation of meshes
 /*==============================
     add_mesh
     Creates a mesh object and adds it to the global list of meshes
+    @param   The conversion context
     @param   The name of the mesh
     @returns A pointer to the created mesh
 ==============================*/
 
-s64Mesh* add_mesh(char* name)
+s64Mesh* add_mesh(arabikiContext* ctx, char* name)
 {
     // Allocate memory for the mesh struct and string name
     s64Mesh* mesh = (s64Mesh*)calloc(1, sizeof(s64Mesh));
     if (mesh == NULL)
-        terminate("Error: Unable to allocate memory for mesh object\n");
+        terminate(ctx, "Error: Unable to allocate memory for mesh object\n");
     mesh->name = (char*)calloc(strlen(name)+1, 1);
     if (mesh->name == NULL)
-        terminate("Error: Unable to allocate memory for mesh name\n");
+        terminate(ctx, "Error: Unable to allocate memory for mesh name\n");
     
     // Store the data in the newly created mesh struct
     strcpy(mesh->name, name);
     
     // Add this mesh to our mesh list and return it
-    list_append(&list_meshes, mesh);
+    if (list_append(&ctx->meshes, mesh) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
     return mesh;
 }
 
@@ -40,16 +43,18 @@ s64Mesh* add_mesh(char* name)
 /*==============================
     add_vertex
     Creates a vertex object and adds it to a mesh's list of vertices
+    @param   The conversion context
     @param   A pointer to the mesh
     @returns A pointer to the created vertex
 ==============================*/
 
-s64Vert* add_vertex(s64Mesh* mesh)
+s64Vert* add_vertex(arabikiContext* ctx, s64Mesh* mesh)
 {
     s64Vert* vert = (s64Vert*)calloc(1, sizeof(s64Vert));
     if (vert == NULL)
-        terminate("Error: Unable to allocate memory for mesh vertex\n");
-    list_append(&(mesh->verts), vert);
+        terminate(ctx, "Error: Unable to allocate memory for mesh vertex\n");
+    if (list_append(&(mesh->verts), vert) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
     return vert;
 }
 
@@ -57,16 +62,18 @@ s64Vert* add_vertex(s64Mesh* mesh)
 /*==============================
     add_face
     Creates a face object and adds it to a mesh's list of faces
+    @param   The conversion context
     @param   A pointer to the mesh
     @returns A pointer to the created face
 ==============================*/
 
-s64Face* add_face(s64Mesh* mesh)
+s64Face* add_face(arabikiContext* ctx, s64Mesh* mesh)
 {
     s64Face* face = (s64Face*)calloc(1, sizeof(s64Face));
     if (face == NULL)
-        terminate("Error: Unable to allocate memory for mesh face\n");
-    list_append(&(mesh->faces), face);
+        terminate(ctx, "Error: Unable to allocate memory for mesh face\n");
+    if (list_append(&(mesh->faces), face) == NULL)
+        terminate(ctx, "Error: Unable to allocate memory for linked list node\n");
     return face;
 }
 
@@ -74,16 +81,17 @@ s64Face* add_face(s64Mesh* mesh)
 /*==============================
     find_mesh
     Searches through the list of meshes for a mesh with the specified name
+    @param   The conversion context
     @param   The mesh name
     @returns The requested s64Mesh, or NULL if none was found 
 ==============================*/
 
-s64Mesh* find_mesh(char* name)
+s64Mesh* find_mesh(arabikiContext* ctx, char* name)
 {
     listNode* meshnode;
     
     // Iterate through the mesh list
-    for (meshnode = list_meshes.head; meshnode != NULL; meshnode = meshnode->next)
+    for (meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
     {
         s64Mesh* mesh = (s64Mesh*)meshnode->data;
         
@@ -158,4 +166,77 @@ bool has_property(s64Mesh* mesh, char* property)
     
     // Property was not found
     return FALSE;
+}
+
+/*==============================
+    calc_boundingsphere
+    Calculates the bounding sphere of a mesh, relative to its root.
+    The sphere is centered on the mesh's bounding box, which is not
+    the tightest fit but is good enough for LOD selection and culling
+    @param The mesh to calculate the bounding sphere of
+==============================*/
+
+void calc_boundingsphere(s64Mesh* mesh)
+{
+    listNode* vertnode;
+    Vector3D min, max;
+    float radius = 0;
+    
+    // Empty meshes have no bounds
+    mesh->boundcenter = (Vector3D){0, 0, 0};
+    mesh->boundradius = 0;
+    mesh->boundmin = (Vector3D){0, 0, 0};
+    mesh->boundmax = (Vector3D){0, 0, 0};
+    if (mesh->verts.head == NULL)
+        return;
+    
+    // Find the bounding box of the mesh
+    min = max = ((s64Vert*)mesh->verts.head->data)->pos;
+    for (vertnode = mesh->verts.head; vertnode != NULL; vertnode = vertnode->next)
+    {
+        Vector3D pos = ((s64Vert*)vertnode->data)->pos;
+        if (pos.x < min.x) min.x = pos.x;
+        if (pos.y < min.y) min.y = pos.y;
+        if (pos.z < min.z) min.z = pos.z;
+        if (pos.x > max.x) max.x = pos.x;
+        if (pos.y > max.y) max.y = pos.y;
+        if (pos.z > max.z) max.z = pos.z;
+    }
+    mesh->boundmin = min;
+    mesh->boundmax = max;
+    mesh->boundcenter.x = (min.x + max.x)/2;
+    mesh->boundcenter.y = (min.y + max.y)/2;
+    mesh->boundcenter.z = (min.z + max.z)/2;
+    
+    // Now find the vertex furthest away from the center
+    for (vertnode = mesh->verts.head; vertnode != NULL; vertnode = vertnode->next)
+    {
+        Vector3D pos = ((s64Vert*)vertnode->data)->pos;
+        float dx = pos.x - mesh->boundcenter.x;
+        float dy = pos.y - mesh->boundcenter.y;
+        float dz = pos.z - mesh->boundcenter.z;
+        float dist = dx*dx + dy*dy + dz*dz;
+        if (dist > radius)
+            radius = dist;
+    }
+    mesh->boundradius = sqrtf(radius);
+}
+
+
+/*==============================
+    get_cullbox_corner
+    Gets one of the 8 corners of a mesh's bounding box,
+    rounded outwards so that the box fits in a Vtx
+    @param   The mesh to get the corner of
+    @param   The index of the corner (from 0 to 7)
+    @returns The position of the corner
+==============================*/
+
+Vector3D get_cullbox_corner(s64Mesh* mesh, int corner)
+{
+    Vector3D ret;
+    ret.x = (corner & 1) ? ceilf(mesh->boundmax.x) : floorf(mesh->boundmin.x);
+    ret.y = (corner & 2) ? ceilf(mesh->boundmax.y) : floorf(mesh->boundmin.y);
+    ret.z = (corner & 4) ? ceilf(mesh->boundmax.z) : floorf(mesh->boundmin.z);
+    return ret;
 }
\ No newline at end of file
@@ -20,6 +20,14 @@
         linkedList materials;
         linkedList props;
         linkedList vertcache;
+        linkedList lods;
+        int lodlevel;
+        float lodscreensize;
+        Vector3D boundcenter;
+        float boundradius;
+        Vector3D boundmin;
+        Vector3D boundmax;
+        bool hascullbox;
     } s64Mesh;
     
     // Vertex struct
@@ -47,12 +55,14 @@
                 Functions
     *********************************/
     
-    extern s64Mesh*     add_mesh(char* name);
-    extern s64Vert*     add_vertex(s64Mesh* mesh);
-    extern s64Face*     add_face(s64Mesh* mesh);
-    extern s64Mesh*     find_mesh(char* name);
+    extern s64Mesh*     add_mesh(arabikiContext* ctx, char* name);
+    extern s64Vert*     add_vertex(arabikiContext* ctx, s64Mesh* mesh);
+    extern s64Face*     add_face(arabikiContext* ctx, s64Mesh* mesh);
+    extern s64Mesh*     find_mesh(arabikiContext* ctx, char* name);
     extern s64Vert*     find_vert(s64Mesh* mesh, int index);
     extern n64Material* find_material_fromvert(linkedList* faces, s64Vert* vert);
     extern bool         has_property(s64Mesh* mesh, char* property);
+    extern void         calc_boundingsphere(s64Mesh* mesh);
+    extern Vector3D     get_cullbox_corner(s64Mesh* mesh, int corner);
     
 #endif
\ No newline at end of file
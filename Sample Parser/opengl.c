@@ -27,11 +27,12 @@ later.
     generate_opengl_vcachelist
     Constructs an OpenGL vertex cache list for
     dumping a s64RenderBlock
+    @param  The conversion context
     @param  The mesh to generate the vcache list of
     @return The generated list of vcache blocks
 ==============================*/
 
-linkedList* generate_opengl_vcachelist(s64Mesh* mesh)
+linkedList* generate_opengl_vcachelist(arabikiContext* ctx, s64Mesh* mesh)
 {
     linkedList* list_vcacherender = list_new();
     n64Material* lastMaterial = NULL;
@@ -55,13 +56,13 @@ linkedList* generate_opengl_vcachelist(s64Mesh* mesh)
                 lastMaterial = face->material;
                 VCacheRenderBlock* vcrb = calloc(1, sizeof(VCacheRenderBlock));
                 if (vcrb == NULL)
-                    terminate("Error: Unable to allocate memory for VCache Render Block\n");
+                    terminate(ctx, "Error: Unable to allocate memory for VCache Render Block\n");
                 list_append(list_vcacherender, vcrb);
                 if (face->material->type == TYPE_OMIT || face->material->dontload)
                     vcrb->mat = NULL;
                 else
                     vcrb->mat = face->material;
-                vcrb->matid = get_validmatindex(&list_materials, face->material->name);
+                vcrb->matid = get_validmatindex(&ctx->materials, face->material->name);
                 faceoffset = facecount;
                 if (lastrenderblock == NULL)
                     vcrb->vertoffset = 0;
@@ -94,23 +95,132 @@ linkedList* generate_opengl_vcachelist(s64Mesh* mesh)
 }
 
 
+/*==============================
+    opengl_writemesh
+    Writes a mesh's vertices, faces and render
+    blocks to a file
+    @param The conversion context
+    @param The file to write to
+    @param The mesh to write
+==============================*/
+
+static void opengl_writemesh(arabikiContext* ctx, FILE* fp, s64Mesh* mesh)
+{
+    bool ismultimesh = (ctx->meshes.size > 1);
+    int faceindex = 0, vertindex = 0;
+    linkedList* list_vcacherender = generate_opengl_vcachelist(ctx, mesh);
+    
+    // Cycle through the vertex cache list and dump the vertices
+    vertindex = 0;
+    fprintf(fp, "static f32 vtx_%s", ctx->settings.modelname);
+    if (ismultimesh || mesh->lodlevel > 0)
+        fprintf(fp, "_%s", mesh->name);
+    fprintf(fp, "[][11] = {\n");
+    for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+    {
+        vertCache* vcache = (vertCache*)vcachenode->data;
+        
+        // Cycle through all the verts
+        for (listNode* vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
+        {
+            s64Vert* vert = (s64Vert*)vertnode->data;
+            
+            // Dump the vert data
+            fprintf(fp, "    {%.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff}, /* %d */\n", 
+                vert->pos.x, vert->pos.y, vert->pos.z,
+                vert->UV.x, vert->UV.y,
+                vert->normal.x, vert->normal.y, vert->normal.z,
+                vert->color.x, vert->color.y, vert->color.z,
+                vertindex++
+            );
+        }
+    }
+    fprintf(fp, "};\n\n");
+    
+    // Then cycle through the vertex cache list again, but now dump the faces
+    fprintf(fp, "static u16 ind_%s", ctx->settings.modelname);
+    if (ismultimesh || mesh->lodlevel > 0)
+        fprintf(fp, "_%s", mesh->name);
+    fprintf(fp, "[][3] = {\n");
+    vertindex = 0;
+    faceindex = 0;
+    for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+    {
+        vertCache* vcache = (vertCache*)vcachenode->data;
+        
+        // Cycle through all the faces
+        for (listNode* vertnode = vcache->faces.head; vertnode != NULL; vertnode = vertnode->next)
+        {
+            s64Face* face = (s64Face*)vertnode->data;
+            
+            // Dump the face data
+            fprintf(fp, "    {%u, %u, %u}, /* %d */\n", 
+                vertindex + list_index_from_data(&vcache->verts, face->verts[0]), 
+                vertindex + list_index_from_data(&vcache->verts, face->verts[1]), 
+                vertindex + list_index_from_data(&vcache->verts, face->verts[2]),
+                faceindex++
+            );
+        }
+        vertindex += vcache->verts.size;
+    }
+    fprintf(fp, "};\n\n");
+    
+    // Next, generate the render blocks
+    fprintf(fp, "static s64RenderBlock renb_%s", ctx->settings.modelname);
+    if (ismultimesh || mesh->lodlevel > 0)
+        fprintf(fp, "_%s", mesh->name);
+    fprintf(fp, "[] = {\n");
+    for (listNode* vcachenode = list_vcacherender->head; vcachenode != NULL; vcachenode = vcachenode->next)
+    {
+        VCacheRenderBlock* vcacheb = (VCacheRenderBlock*)vcachenode->data;
+        fprintf(fp, "\t{");
+        fprintf(fp, "&vtx_%s", ctx->settings.modelname);
+        if (ismultimesh || mesh->lodlevel > 0)
+            fprintf(fp, "_%s", mesh->name);
+        fprintf(fp, "[%d], %d, %d, ", vcacheb->vertoffset, vcacheb->vertcount, vcacheb->facecount);
+        fprintf(fp, "&ind_%s", ctx->settings.modelname);
+        if (ismultimesh || mesh->lodlevel > 0)
+            fprintf(fp, "_%s", mesh->name);
+        if (vcacheb->mat != NULL)
+            fprintf(fp, "[%d], &mat_%s},\n", vcacheb->faceoffset, vcacheb->mat->name);
+        else
+            fprintf(fp, "[%d], NULL},\n", vcacheb->faceoffset);
+    }
+    fprintf(fp, "};\n\n");
+    
+    // Finally, generate the "Display List"
+    fprintf(fp, "static s64Gfx gfx_%s", ctx->settings.modelname);
+    if (ismultimesh || mesh->lodlevel > 0)
+        fprintf(fp, "_%s", mesh->name);
+    fprintf(fp, " = {%d, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, ", list_vcacherender->size);
+    fprintf(fp, "renb_%s", ctx->settings.modelname);
+    if (ismultimesh || mesh->lodlevel > 0)
+        fprintf(fp, "_%s", mesh->name);
+    fprintf(fp, "};\n\n");
+    
+    // Cleanup
+    list_destroy_deep(list_vcacherender);
+    free(list_vcacherender);
+}
+
+
 /*==============================
     construct_opengl
     Constructs an OpenGL Command List 
     and stores it in a temporary file
+    @param The conversion context
 ==============================*/
 
-void construct_opengl()
+void construct_opengl(arabikiContext* ctx)
 {
     FILE* fp;
     char strbuff[STRBUF_SIZE];
-    bool ismultimesh = (list_meshes.size > 1);
     
     // Open a temp file to write our opengl command list to
-    sprintf(strbuff, "temp_%s", global_outputname);
+    sprintf(strbuff, "temp_%s", ctx->settings.outputname);
     fp = fopen(strbuff, "w+");
     if (fp == NULL)
-        terminate("Error: Unable to open temporary file for writing\n");
+        terminate(ctx, "Error: Unable to open temporary file for writing\n");
         
     // Material data header
     fprintf(fp, "\n/*********************************\n"
@@ -119,7 +229,7 @@ void construct_opengl()
     );
     
     // Generate the s64Material struct for each material
-    for (listNode* matnode = list_materials.head; matnode != NULL; matnode = matnode->next)
+    for (listNode* matnode = ctx->materials.head; matnode != NULL; matnode = matnode->next)
     {
         n64Material* mat = (n64Material*)matnode->data;
         
@@ -177,107 +287,16 @@ void construct_opengl()
                 "*********************************/\n\n"
     );
         
-    // Iterate through all the meshes
-    for (listNode* meshnode = list_meshes.head; meshnode != NULL; meshnode = meshnode->next)
+    // Iterate through all the meshes and their LODs
+    for (listNode* meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
     {
         s64Mesh* mesh = (s64Mesh*)meshnode->data;
-        int faceindex = 0, vertindex = 0;
-        linkedList* list_vcacherender = generate_opengl_vcachelist(mesh);
-        
-        // Cycle through the vertex cache list and dump the vertices
-        vertindex = 0;
-        fprintf(fp, "static f32 vtx_%s", global_modelname);
-        if (ismultimesh)
-            fprintf(fp, "_%s", mesh->name);
-        fprintf(fp, "[][11] = {\n");
-        for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
-        {
-            vertCache* vcache = (vertCache*)vcachenode->data;
-            
-            // Cycle through all the verts
-            for (listNode* vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
-            {
-                s64Vert* vert = (s64Vert*)vertnode->data;
-                
-                // Dump the vert data
-                fprintf(fp, "    {%.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff, %.4ff}, /* %d */\n", 
-                    vert->pos.x, vert->pos.y, vert->pos.z,
-                    vert->UV.x, vert->UV.y,
-                    vert->normal.x, vert->normal.y, vert->normal.z,
-                    vert->color.x, vert->color.y, vert->color.z,
-                    vertindex++
-                );
-            }
-        }
-        fprintf(fp, "};\n\n");
-        
-        // Then cycle through the vertex cache list again, but now dump the faces
-        fprintf(fp, "static u16 ind_%s", global_modelname);
-        if (ismultimesh)
-            fprintf(fp, "_%s", mesh->name);
-        fprintf(fp, "[][3] = {\n");
-        vertindex = 0;
-        faceindex = 0;
-        for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
-        {
-            vertCache* vcache = (vertCache*)vcachenode->data;
-            
-            // Cycle through all the faces
-            for (listNode* vertnode = vcache->faces.head; vertnode != NULL; vertnode = vertnode->next)
-            {
-                s64Face* face = (s64Face*)vertnode->data;
-                
-                // Dump the face data
-                fprintf(fp, "    {%u, %u, %u}, /* %d */\n", 
-                    vertindex + list_index_from_data(&vcache->verts, face->verts[0]), 
-                    vertindex + list_index_from_data(&vcache->verts, face->verts[1]), 
-                    vertindex + list_index_from_data(&vcache->verts, face->verts[2]),
-                    faceindex++
-                );
-            }
-            vertindex += vcache->verts.size;
-        }
-        fprintf(fp, "};\n\n");
-        
-        // Next, generate the render blocks
-        fprintf(fp, "static s64RenderBlock renb_%s", global_modelname);
-        if (ismultimesh)
-            fprintf(fp, "_%s", mesh->name);
-        fprintf(fp, "[] = {\n");
-        for (listNode* vcachenode = list_vcacherender->head; vcachenode != NULL; vcachenode = vcachenode->next)
-        {
-            VCacheRenderBlock* vcacheb = (VCacheRenderBlock*)vcachenode->data;
-            fprintf(fp, "\t{");
-            fprintf(fp, "&vtx_%s", global_modelname);
-            if (ismultimesh)
-                fprintf(fp, "_%s", mesh->name);
-            fprintf(fp, "[%d], %d, %d, ", vcacheb->vertoffset, vcacheb->vertcount, vcacheb->facecount);
-            fprintf(fp, "&ind_%s", global_modelname);
-            if (ismultimesh)
-                fprintf(fp, "_%s", mesh->name);
-            if (vcacheb->mat != NULL)
-                fprintf(fp, "[%d], &mat_%s},\n", vcacheb->faceoffset, vcacheb->mat->name);
-            else
-                fprintf(fp, "[%d], NULL},\n", vcacheb->faceoffset);
-        }
-        fprintf(fp, "};\n\n");
-        
-        // Finally, generate the "Display List"
-        fprintf(fp, "static s64Gfx gfx_%s", global_modelname);
-        if (ismultimesh)
-            fprintf(fp, "_%s", mesh->name);
-        fprintf(fp, " = {%d, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, ", list_vcacherender->size);
-        fprintf(fp, "renb_%s", global_modelname);
-        if (ismultimesh)
-            fprintf(fp, "_%s", mesh->name);
-        fprintf(fp, "};\n\n");
-        
-        // Cleanup
-        list_destroy_deep(list_vcacherender);
-        free(list_vcacherender);
+        opengl_writemesh(ctx, fp, mesh);
+        for (listNode* lodnode = mesh->lods.head; lodnode != NULL; lodnode = lodnode->next)
+            opengl_writemesh(ctx, fp, (s64Mesh*)lodnode->data);
     }
     
     // State we finished
-    if (!global_quiet) printf("Finish building display lists\n");
+    if (!ctx->settings.quiet) printf("Finish building display lists\n");
     fclose(fp);
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #ifndef _SAUSN64_OPENGL_H
 #define _SAUSN64_OPENGL_H
 
-    #include "material.h"
+    #include "mesh.h"
 
     typedef struct {
         uint16_t vertcount;
@@ -12,7 +12,7 @@
         int32_t matid;
     } VCacheRenderBlock;
 
-    extern linkedList* generate_opengl_vcachelist();
-    extern void construct_opengl();
+    extern linkedList* generate_opengl_vcachelist(arabikiContext* ctx, s64Mesh* mesh);
+    extern void construct_opengl(arabikiContext* ctx);
     
 #endif
\ No newline at end of file
@@ -6,6 +6,7 @@ generates vertex caches. The optimizations are as follows:
 - Sorts the meshes to reduce material loading using a custom
   algorithm.
 - Merges verticies which both use PRIMCOLOR materials
+- Generates lower detail versions of the meshes (see lod.c)
 - Optimizes the triangle loading order using Forsyth, heavily 
   basing my code off the implementation by Martin Strosjo, 
   available here: http://www.martin.st/thesis/forsyth.cpp
@@ -17,6 +18,8 @@ generates vertex caches. The optimizations are as follows:
 #include <math.h>
 #include "main.h"
 #include "mesh.h"
+#include "animation.h"
+#include "lod.h"
 
 
 /*********************************
@@ -52,10 +55,6 @@ typedef struct {
 // Factorial lookup table, up to 12 factorial
 static unsigned int factorial[] = {1, 1, 2, 6, 24, 120, 720, 5040, 40320, 362880, 3628800, 39916800, 479001600};
 
-// Forsyth globals
-static int* forsyth_posscore = NULL;
-static int* forsyth_valencescore = NULL;
-
 
 /*==============================
     find_index_vert_vcache
@@ -85,49 +84,50 @@ static int find_index_vert_vcache(vertCache* vcache, s64Vert* vert)
 /*==============================
     forsyth_init
     Initialize the global Forsyth score lookup tables
+    @param The conversion context
 ==============================*/
 
-static inline void forsyth_init()
+static inline void forsyth_init(arabikiContext* ctx)
 {
     int i;
     
     // Allocate memory for the cache position score array
-    if (forsyth_posscore == NULL)
+    if (ctx->forsyth_posscore == NULL)
     {
-        forsyth_posscore = (int*)malloc(sizeof(int)*global_cachesize);
-        if (forsyth_posscore == NULL)
-            terminate("Unable to allocate memory for Forsyth cache pos score\n");
+        ctx->forsyth_posscore = (int*)malloc(sizeof(int)*ctx->settings.cachesize);
+        if (ctx->forsyth_posscore == NULL)
+            terminate(ctx, "Unable to allocate memory for Forsyth cache pos score\n");
     }
     
     // Allocate memory for the valence score array
-    if (forsyth_valencescore == NULL)
+    if (ctx->forsyth_valencescore == NULL)
     {
-        forsyth_valencescore = (int*)malloc(sizeof(int)*global_cachesize);
-        if (forsyth_valencescore == NULL)
-            terminate("Unable to allocate memory for Forsyth valence score\n");
+        ctx->forsyth_valencescore = (int*)malloc(sizeof(int)*ctx->settings.cachesize);
+        if (ctx->forsyth_valencescore == NULL)
+            terminate(ctx, "Unable to allocate memory for Forsyth valence score\n");
     }
     
     // Precalculate the position score array
-    for (i=0; i<global_cachesize; i++)
+    for (i=0; i<ctx->settings.cachesize; i++)
     {
         float score = 0;
         if (i >= 3)
         {
-            const float scaler = 1.0/(global_cachesize - 3);
+            const float scaler = 1.0/(ctx->settings.cachesize - 3);
             score = 1.0 - (i - 3)*scaler;
             score = powf(score, FORSYTH_CACHE_DECAY_POWER);
         }
         else
             score = FORSYTH_LAST_TRI_SCORE;
-        forsyth_posscore[i] = (FORSYTH_SCORE_SCALING * score);
+        ctx->forsyth_posscore[i] = (FORSYTH_SCORE_SCALING * score);
     }
 
     // Precalculate the valence score array
-    for (i=1; i<global_cachesize; i++)
+    for (i=1; i<ctx->settings.cachesize; i++)
     {
         float valenceboost = powf(i, -FORSYTH_VALENCE_BOOST_POWER);
         float score = FORSYTH_VALENCE_BOOST_SCALE*valenceboost;
-        forsyth_valencescore[i] = (FORSYTH_SCORE_SCALING*score);
+        ctx->forsyth_valencescore[i] = (FORSYTH_SCORE_SCALING*score);
     }
 }
 
@@ -135,12 +135,13 @@ static inline void forsyth_init()
 /*==============================
     forsyth_calcvertscore
     Calculates the heuristic for a vertex
+    @param The conversion context
     @param The amount of triangles shared by this vertex
     @param The cache position of this vertex
     @returns The calculated score
 ==============================*/
 
-static int forsyth_calcvertscore(int verttris, int cachepos)
+static int forsyth_calcvertscore(arabikiContext* ctx, int verttris, int cachepos)
 {
     int score = 0;
 
@@ -150,11 +151,11 @@ static int forsyth_calcvertscore(int verttris, int cachepos)
 
     // If the vertex is in the cache, give it a score based on its position
     if (cachepos >= 0)
-        score = forsyth_posscore[cachepos];
+        score = ctx->forsyth_posscore[cachepos];
 
     // Add to the score based on how many triangles this vert is sharing
-    if (verttris < global_cachesize)
-        score += forsyth_valencescore[verttris];
+    if (verttris < ctx->settings.cachesize)
+        score += ctx->forsyth_valencescore[verttris];
     return score;
 }
 
@@ -166,12 +167,13 @@ static int forsyth_calcvertscore(int verttris, int cachepos)
     https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
     After it generates the optimal list, this function also then generates a
     linked list with a set of new cache blocks to replace the old (too big) one
+    @param The conversion context
     @param The mesh we're optimizing
     @param The vertex cache to optimize
     @returns A list of vertex caches, split to fit the cache limit
 ==============================*/
 
-static linkedList* forsyth(vertCache* vcacheoriginal)
+static linkedList* forsyth(arabikiContext* ctx, vertCache* vcacheoriginal)
 {
     int i, j;
     int *indices, *activetricount;
@@ -189,12 +191,12 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
     indices = (int*) calloc(1, sizeof(int)*tricount*3);
     outindices = (int*) calloc(1, sizeof(int)*tricount*3); // To be removed later
     if (indices == NULL)
-        terminate("Error: Unable to allocate memory for vertex indices list\n");
+        terminate(ctx, "Error: Unable to allocate memory for vertex indices list\n");
     
     // Allocate memory for the vertex triangle count list
     activetricount = (int*)calloc(1, sizeof(int)*vertcount);
     if (activetricount == NULL)
-        terminate("Error: Unable to allocate memory for vertex triangle count\n");
+        terminate(ctx, "Error: Unable to allocate memory for vertex triangle count\n");
     
     // Generate a list of vertex triangle indices
     for (curnode = vcacheoriginal->faces.head; curnode != NULL; curnode = curnode->next)
@@ -220,10 +222,10 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
     triscore = (int*) calloc(1, sizeof(int)*tricount);
     triindices = (int*) calloc(1, sizeof(int)*3*tricount);
     outtris = (int*)calloc(1, sizeof(int)*tricount);
-    tempcache = (int*)malloc(sizeof(int)*(global_cachesize+3));
+    tempcache = (int*)malloc(sizeof(int)*(ctx->settings.cachesize+3));
     triadded = (bool*) calloc(1, sizeof(bool)*tricount);
     if (offsets == NULL || lastscore == NULL || cachetag == NULL || triscore == NULL || triindices == NULL || outtris == NULL || tempcache == NULL || triadded == NULL)
-        terminate("Error: Failure allocating memory for Forsyth algorithm\n");
+        terminate(ctx, "Error: Failure allocating memory for Forsyth algorithm\n");
         
     // Count the triangle array offset for each vertex
     for (i=0; i<vertcount; i++) 
@@ -248,7 +250,7 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
     // Initialize the score for all vertices
     for (i=0; i<vertcount; i++)
     {
-        lastscore[i] = forsyth_calcvertscore(activetricount[i], cachetag[i]);
+        lastscore[i] = forsyth_calcvertscore(ctx, activetricount[i], cachetag[i]);
         for (j=0; j<activetricount[i]; j++)
             triscore[triindices[offsets[i] + j]] += lastscore[i];
     }
@@ -264,7 +266,7 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
     }
     
     // Output the best triangle, as long as there are triangles left to output
-    memset(tempcache, -1, sizeof(int)*(global_cachesize+3));
+    memset(tempcache, -1, sizeof(int)*(ctx->settings.cachesize+3));
     while(besttri >= 0)
     {
         // Mark this triangle as added
@@ -279,7 +281,7 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
 
             // Check the current cache position, if it is in the cache
             if (cachetag[v] < 0)
-                cachetag[v] = global_cachesize + i;
+                cachetag[v] = ctx->settings.cachesize + i;
             if (cachetag[v] > i)
             {
                 // Move all cache entries from the previous position in the cache to the new target position
@@ -312,7 +314,7 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
         }
         
         // Update the scores of all triangles in the cache
-        for (i=0; i<global_cachesize+3; i++)
+        for (i=0; i<ctx->settings.cachesize+3; i++)
         {
             int newscore, diff;
             int v = tempcache[i];
@@ -322,14 +324,14 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
                 break;
                 
             // This vertex has been pushed outside of the actual cache
-            if (i >= global_cachesize)
+            if (i >= ctx->settings.cachesize)
             {
                 cachetag[v] = -1;
                 tempcache[i] = -1;
             }
             
             // Calculate the new score
-            newscore = forsyth_calcvertscore(activetricount[v], cachetag[v]);
+            newscore = forsyth_calcvertscore(ctx, activetricount[v], cachetag[v]);
             diff = newscore - lastscore[v];
             for (j=0; j<activetricount[v]; j++)
                 triscore[triindices[offsets[v] + j]] += diff;
@@ -339,7 +341,7 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
         // Find the best triangle referenced by vertices in the cache
         besttri = -1;
         bestscore = -1;
-        for (i=0; i<global_cachesize; i++)
+        for (i=0; i<ctx->settings.cachesize; i++)
         {
             int v = tempcache[i];
             
@@ -393,7 +395,7 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
     newvcachelist = (linkedList*)calloc(1, sizeof(linkedList));
     neednewblock = TRUE;
     if (newvcachelist == NULL)
-        terminate("Error: Failure allocating memory for optimized vertex cache list\n");
+        terminate(ctx, "Error: Failure allocating memory for optimized vertex cache list\n");
     
     // Now generate the blocks
     for (i=0; i<tricount*3; i+=3)
@@ -423,7 +425,7 @@ static linkedList* forsyth(vertCache* vcacheoriginal)
         }
         
         // If the number of new verts exceed the vertex cache size, restart this loop and allocate a new block
-        if (vcachenew->verts.size + newvertcount > global_cachesize)
+        if (vcachenew->verts.size + newvertcount > ctx->settings.cachesize)
         {
             i -= 3;
             neednewblock = TRUE;
@@ -531,9 +533,10 @@ static inline bool shares_materials(s64Mesh* a, s64Mesh* b)
 /*==============================
     optimize_materialloads
     Optimizes the material loading order in the model
+    @param The conversion context
 ==============================*/
 
-static void optimize_materialloads()
+static void optimize_materialloads(arabikiContext* ctx)
 {
     /*
     * We want to sort meshes to reduce the amount of material loads
@@ -553,10 +556,10 @@ static void optimize_materialloads()
     TSPNode* nodeslist;
     linkedList meshes_groupedby_mat = EMPTY_LINKEDLIST;
     linkedList neworder = EMPTY_LINKEDLIST;
-    if (!global_quiet) printf("    Optimizing material loading order\n");
+    if (!ctx->settings.quiet) printf("    Optimizing material loading order\n");
     
     // First, group all meshes by the materials they use
-    for (listNode* mesh = list_meshes.head; mesh != NULL; mesh = mesh->next)
+    for (listNode* mesh = ctx->meshes.head; mesh != NULL; mesh = mesh->next)
     {
         bool found = FALSE;
                         
@@ -596,7 +599,7 @@ static void optimize_materialloads()
                 
         // Ensure we don't have two or more materials with LOADFIRST in this mesh
         if (loadfirstcount > 1)
-            terminate("Error: Mesh uses two materials with LOADFIRST flag\n");
+            terminate(ctx, "Error: Mesh uses two materials with LOADFIRST flag\n");
             
         // Add to our total node count the factorial of the material count (excluding materials with LOADFIRST)
         if (has_property(mesh, "NoSort"))
@@ -844,8 +847,9 @@ static void optimize_materialloads()
     
     // Print the optimal order
     #if DEBUG
-        printf("Optimal loading order:\n");
-        for (int i=0; i<finalpathsize; i++)
+        if (!ctx->settings.quiet)
+            printf("Optimal loading order:\n");
+        for (int i=0; i<finalpathsize && !ctx->settings.quiet; i++)
         {
             printf("%d (%d)\n", shortest[i], finalpathsize);
             for (listNode* m = nodeslist[shortest[i]].meshes->head; m != NULL; m = m->next)
@@ -878,11 +882,11 @@ static void optimize_materialloads()
     for (int i=0; i<finalpathsize; i++)
         for (listNode* m = nodeslist[shortest[i]].meshes->head; m != NULL; m = m->next)
             list_append(&neworder,  m->data);
-    list_destroy(&list_meshes);
-    list_meshes = neworder;
+    list_destroy(&ctx->meshes);
+    ctx->meshes = neworder;
     
     // Finally, sort the material list in each mesh, since it's not in the new order
-    for (listNode* m = list_meshes.head; m != NULL; m = m->next)
+    for (listNode* m = ctx->meshes.head; m != NULL; m = m->next)
     {
         s64Mesh* mesh = (s64Mesh*)m->data;
         n64Material* lastmat = NULL;
@@ -918,14 +922,15 @@ static void optimize_materialloads()
 /*==============================
     optimize_duplicatedverts
     Optimizes duplicated vertices using PRIMCOLOR
+    @param The conversion context
 ==============================*/
 
-static void optimize_duplicatedverts()
+static void optimize_duplicatedverts(arabikiContext* ctx)
 {
     int merged = 0;
-    if (!global_quiet) printf("    Merging unecessary vertices\n");
+    if (!ctx->settings.quiet) printf("    Merging unecessary vertices\n");
     
-    for (listNode* meshnode = list_meshes.head; meshnode != NULL; meshnode = meshnode->next)
+    for (listNode* meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
     {
         s64Mesh* mesh = (s64Mesh*)meshnode->data;
         for (listNode* vertnode1 = mesh->verts.head; vertnode1 != NULL; vertnode1 = vertnode1->next)
@@ -1013,7 +1018,7 @@ static void optimize_duplicatedverts()
         }
     }
     
-    if (!global_quiet) printf("        %d verts merged\n", merged);
+    if (!ctx->settings.quiet) printf("        %d verts merged\n", merged);
 }
 
 
@@ -1068,10 +1073,11 @@ static void optimize_duplicatedverts()
     combine_caches
     Attempts to combine vertex caches
     Ineffient since it's O(N^2)
+    @param The conversion context
     @param The mesh to parse
 ==============================*/
 
-static void combine_caches(s64Mesh* mesh)
+static void combine_caches(arabikiContext* ctx, s64Mesh* mesh)
 {
     linkedList removedlist = EMPTY_LINKEDLIST;
     
@@ -1097,7 +1103,7 @@ static void combine_caches(s64Mesh* mesh)
             if (vc1 != vc2)
             {
                 // If these two together would fit in the chace, then combine them
-                if (vc1->verts.size + vc2->verts.size <= global_cachesize)
+                if (vc1->verts.size + vc2->verts.size <= ctx->settings.cachesize)
                 {
                     list_combine(&vc1->verts, &vc2->verts);
                     list_combine(&vc1->faces, &vc2->faces); 
@@ -1116,75 +1122,105 @@ static void combine_caches(s64Mesh* mesh)
 }
 
 
+/*==============================
+    generate_vertcache
+    Splits a mesh into blocks that fit in the vertex cache
+    @param The conversion context
+    @param The mesh to parse
+==============================*/
+
+static void generate_vertcache(arabikiContext* ctx, s64Mesh* mesh)
+{
+    // See if the model fits in the vertex cache
+    if (mesh->verts.size > ctx->settings.cachesize)
+    {
+        int index = 0;
+        if (!ctx->settings.quiet) printf("    Mesh '%s' too large for vertex cache, splitting by material.\n", mesh->name);
+    
+        // Oh dear, this model doesn't fit... Let's split the mesh by material and see if that helps
+        split_verts_by_material(mesh);
+        
+        // Try to combine any cache blocks that could fit together after having been split by material
+        combine_caches(ctx, mesh);
+        
+        // If that didn't help, then split the vertex block further and duplicate verts with the help of Forsyth
+        for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+        {
+            vertCache* vcache = (vertCache*)vcachenode->data;
+            if (vcache->verts.size > ctx->settings.cachesize)
+            {
+                linkedList* list;
+                if (!ctx->settings.quiet) printf("        Cache needs to be split further, applying Forsyth + duplicating verts.\n");
+                
+                // Apply Forsyth on this cache node and retrieve a new list of vertex caches to replace this one
+                list = forsyth(ctx, vcache);
+                free(list_swapindex_withlist(&mesh->vertcache, index, list));
+                vcachenode = list->tail;
+                index += list->size;
+                continue;
+            }
+            index++;
+        }
+    }
+    else
+    {
+        // Model fits fine, lets just shove every vert into a cache.
+        vertCache* vcache = (vertCache*) calloc(1, sizeof(vertCache));
+        if (vcache == NULL)
+            terminate(ctx, "Error: Unable to allocate memory for vertex cache\n");
+        vcache->verts = mesh->verts;
+        vcache->faces = mesh->faces;
+        list_append(&mesh->vertcache, vcache);
+    }
+}
+
+
 /*==============================
     optimize_mdl
     Performs all sorts of optimizations on the model
+    @param The conversion context
 ==============================*/
 
-void optimize_mdl()
+void optimize_mdl(arabikiContext* ctx)
 {
-    if (!global_quiet) printf("Optimizing model\n");
+    if (!ctx->settings.quiet) printf("Optimizing model\n");
     
     // Initialize Forsyth, we might need it
-    forsyth_init();
+    forsyth_init(ctx);
     
     // First, lets try to optimize the material loading order in the entire model
-    if (list_meshes.size > 1 && list_materials.size > 1)
-        optimize_materialloads();
+    if (ctx->meshes.size > 1 && ctx->materials.size > 1)
+        optimize_materialloads(ctx);
     
     // If there's two duplicated vertices with same normals and vcolors, but they're both used for primitive color materials, we can safely merge them (since UV's are useless)
-    optimize_duplicatedverts();
+    optimize_duplicatedverts(ctx);
+    
+    // Calculate the bounding spheres of each mesh, and then of each animation
+    for (listNode* meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
+        calc_boundingsphere((s64Mesh*)meshnode->data);
+    for (listNode* animnode = ctx->animations.head; animnode != NULL; animnode = animnode->next)
+    {
+        calc_animbounds((s64Anim*)animnode->data);
+        calc_framelookup(ctx, (s64Anim*)animnode->data);
+    }
+    
+    // Generate the lower detail versions of each mesh
+    if (ctx->settings.lodcount > 0)
+        generate_lods(ctx);
     
-    // Now that our model is all nice and optimized, go through each model
-    for (listNode* meshnode = list_meshes.head; meshnode != NULL; meshnode = meshnode->next)
+    // Now that our model is all nice and optimized, go through each model and its LODs and generate the vertex caches
+    for (listNode* meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next)
     {
         s64Mesh* mesh = (s64Mesh*)meshnode->data;
-        
-        // See if the model fits in the vertex cache
-        if (mesh->verts.size > global_cachesize)
-        {
-            int index = 0;
-            printf("    Mesh '%s' too large for vertex cache, splitting by material.\n", mesh->name);
-        
-            // Oh dear, this model doesn't fit... Let's split the mesh by material and see if that helps
-            split_verts_by_material(mesh);
-            
-            // Try to combine any cache blocks that could fit together after having been split by material
-            combine_caches(mesh);
-            
-            // If that didn't help, then split the vertex block further and duplicate verts with the help of Forsyth
-            for (listNode* vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
-            {
-                vertCache* vcache = (vertCache*)vcachenode->data;
-                if (vcache->verts.size > global_cachesize)
-                {
-                    linkedList* list;
-                    printf("        Cache needs to be split further, applying Forsyth + duplicating verts.\n");
-                    
-                    // Apply Forsyth on this cache node and retrieve a new list of vertex caches to replace this one
-                    list = forsyth(vcache);
-                    free(list_swapindex_withlist(&mesh->vertcache, index, list));
-                    vcachenode = list->tail;
-                    index += list->size;
-                    continue;
-                }
-                index++;
-            }
-        }
-        else
-        {
-            // Model fits fine, lets just shove every vert into a cache.
-            vertCache* vcache = (vertCache*) calloc(1, sizeof(vertCache));
-            if (vcache == NULL)
-                terminate("Error: Unable to allocate memory for vertex cache\n");
-            vcache->verts = mesh->verts;
-            vcache->faces = mesh->faces;
-            list_append(&mesh->vertcache, vcache);
-        }
+        generate_vertcache(ctx, mesh);
+        for (listNode* lodnode = mesh->lods.head; lodnode != NULL; lodnode = lodnode->next)
+            generate_vertcache(ctx, (s64Mesh*)lodnode->data);
     }
     
     // Finished
-    if (!global_quiet) printf("Finished optimizing\n");
-    free(forsyth_posscore);
-    free(forsyth_valencescore);
+    if (!ctx->settings.quiet) printf("Finished optimizing\n");
+    free(ctx->forsyth_posscore);
+    free(ctx->forsyth_valencescore);
+    ctx->forsyth_posscore = NULL;
+    ctx->forsyth_valencescore = NULL;
 }
\ No newline at end of file
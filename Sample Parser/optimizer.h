@@ -1,6 +1,6 @@
 #ifndef _SAUSN64_OPTIMIZER_H
 #define _SAUSN64_OPTIMIZER_H
 
-    extern void optimize_mdl();
+    extern void optimize_mdl(arabikiContext* ctx);
     
 #endif
\ No newline at end of file
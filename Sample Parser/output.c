@@ -42,9 +42,23 @@ typedef struct {
 } BinFile_TOC_Meshes;
 
 typedef struct {
-    int16_t parent;
-    uint8_t is_billboard;
-    char*   name;
+    float    screensize;
+    uint32_t vertdata_offset;
+    uint32_t vertdata_size;
+    uint32_t facedata_offset;
+    uint32_t facedata_size;
+    uint32_t dldata_offset;
+    uint32_t dldata_size;
+    uint32_t dldata_slotcount;
+} BinFile_TOC_LOD;
+
+typedef struct {
+    int16_t  parent;
+    uint8_t  is_billboard;
+    uint8_t  lodcount;
+    float    bounds[4];
+    BinFile_TOC_LOD* lods;
+    char*    name;
 } BinFile_MeshData;
 
 typedef struct {
@@ -69,6 +83,15 @@ typedef struct {
     int32_t matid;
 } BinFile_VCacheRenderBlock;
 
+typedef struct {
+    int       vtotal;
+    int       ftotal;
+    void*     vertdata;
+    uint16_t* facedata;
+    uint32_t* dldata;
+    uint32_t  dlsize;
+} BinFile_Geometry;
+
 typedef struct {
     uint32_t matdata_offset;
     uint32_t matdata_size;
@@ -110,7 +133,10 @@ typedef struct {
 
 typedef struct {
     uint32_t kfcount;
+    float    bounds[4];
+    uint32_t framecount;
     uint16_t* kfindices;
+    uint16_t* framelookup;
     char* name;
 } BinFile_AnimData;
 
@@ -153,11 +179,12 @@ static void writepadding(FILE* fp, int padvalue)
 /*==============================
     write_header
     Writes the header data to a text file.
+    @param The conversion context
     @param The file pointer
     @param Whether to generate helper macros
 ==============================*/
 
-static void write_header(FILE* fp, bool makemacros)
+static void write_header(arabikiContext* ctx, FILE* fp, bool makemacros)
 {
     int i;
     int count;
@@ -165,14 +192,14 @@ static void write_header(FILE* fp, bool makemacros)
     int longestmeshname = 0, longestanimname = 0;
         
     // Find the mesh and animation with the longest name
-    for (curnode = list_meshes.head; curnode != NULL; curnode = curnode->next)
+    for (curnode = ctx->meshes.head; curnode != NULL; curnode = curnode->next)
     {
         s64Mesh* mesh = (s64Mesh*)curnode->data;
         int len = strlen(mesh->name);
         if (len > longestmeshname)
             longestmeshname = len;
     }
-    for (curnode = list_animations.head; curnode != NULL; curnode = curnode->next)
+    for (curnode = ctx->animations.head; curnode != NULL; curnode = curnode->next)
     {
         s64Anim* anim = (s64Anim*)curnode->data;
         int len = strlen(anim->name);
@@ -189,12 +216,12 @@ static void write_header(FILE* fp, bool makemacros)
     {
         // Iterate through all the meshes and print their names
         count = 0;
-        fprintf(fp, "// Mesh data\n#define MESHCOUNT_%s %d\n\n", global_modelname, list_meshes.size);
-        for (curnode = list_meshes.head; curnode != NULL; curnode = curnode->next)
+        fprintf(fp, "// Mesh data\n#define MESHCOUNT_%s %d\n\n", ctx->settings.modelname, ctx->meshes.size);
+        for (curnode = ctx->meshes.head; curnode != NULL; curnode = curnode->next)
         {
             s64Mesh* mesh = (s64Mesh*)curnode->data;
             int nspaces = strlen(mesh->name);
-            fprintf(fp, "#define MESH_%s_%s ", global_modelname, mesh->name);
+            fprintf(fp, "#define MESH_%s_%s ", ctx->settings.modelname, mesh->name);
             for (i=nspaces; i<longestmeshname; i++) fputc(' ', fp);
             fprintf(fp, "%d\n", count++);
         }
@@ -202,12 +229,12 @@ static void write_header(FILE* fp, bool makemacros)
         
         // Iterate through all the animations and print their names
         count = 0;
-        fprintf(fp, "// Animation data\n#define ANIMATIONCOUNT_%s %d\n\n", global_modelname, list_animations.size);
-        for (curnode = list_animations.head; curnode != NULL; curnode = curnode->next)
+        fprintf(fp, "// Animation data\n#define ANIMATIONCOUNT_%s %d\n\n", ctx->settings.modelname, ctx->animations.size);
+        for (curnode = ctx->animations.head; curnode != NULL; curnode = curnode->next)
         {
             s64Anim* anim = (s64Anim*)curnode->data;
             int nspaces = strlen(anim->name);
-            fprintf(fp, "#define ANIMATION_%s_%s ", global_modelname, anim->name);
+            fprintf(fp, "#define ANIMATION_%s_%s ", ctx->settings.modelname, anim->name);
             for (i=nspaces; i<longestanimname; i++) fputc(' ', fp);
             fprintf(fp, "%d\n", count++);
         }
@@ -219,9 +246,10 @@ static void write_header(FILE* fp, bool makemacros)
 /*==============================
     write_output_text
     Writes the output to a text file
+    @param The conversion context
 ==============================*/
 
-void write_output_text()
+void write_output_text(arabikiContext* ctx)
 {
     int i;
     FILE* fp;
@@ -229,41 +257,41 @@ void write_output_text()
     listNode* curnode;
     int tempc;
     char strbuff[STRBUF_SIZE];
-    bool makestructs = (list_animations.size > 0 || list_meshes.size > 1);
+    bool makestructs = (ctx->animations.size > 0 || ctx->meshes.size > 1 || ctx->settings.lodcount > 0);
 
     // Open the file
-    sprintf(strbuff, "%s.h", global_outputname);
+    sprintf(strbuff, "%s.h", ctx->settings.outputname);
     fp = fopen(strbuff, "w+");
     if (fp == NULL)
-        terminate("Error: Unable to open file for writing\n");
+        terminate(ctx, "Error: Unable to open file for writing\n");
         
     // Print the header
-    write_header(fp, makestructs);
+    write_header(ctx, fp, makestructs);
 
     // Construct a text display list
-    if (!global_opengl)
-        construct_dltext();
+    if (!ctx->settings.opengl)
+        construct_dltext(ctx);
     else
-        construct_opengl();
+        construct_opengl(ctx);
     
     // Dump our temporary file into our final file, and then remove it after we're done
-    sprintf(strbuff, "temp_%s", global_outputname);
+    sprintf(strbuff, "temp_%s", ctx->settings.outputname);
     fp_temp = fopen(strbuff, "r+");
     if (fp_temp == NULL)
-        terminate("Error: Unable to open temporary file for reading\n");
+        terminate(ctx, "Error: Unable to open temporary file for reading\n");
     while ((tempc = fgetc(fp_temp)) != EOF)
        fputc(tempc, fp);
     fclose(fp_temp);
     remove(strbuff);
     
     // Write the animation data
-    if (list_animations.size > 0)
+    if (ctx->animations.size > 0)
     {
         fputs("\n", fp);
         fputs("/*********************************\n"
               "          Animation Data\n"
               "*********************************/", fp);
-        for (curnode = list_animations.head; curnode != NULL; curnode = curnode->next)
+        for (curnode = ctx->animations.head; curnode != NULL; curnode = curnode->next)
         {
             listNode* keyfnode;
             s64Anim* anim = (s64Anim*)curnode->data;
@@ -274,8 +302,8 @@ void write_output_text()
             {
                 listNode* meshnode;
                 s64Keyframe* keyf = (s64Keyframe*)keyfnode->data;
-                fprintf(fp, "static s64Transform anim_%s_%s_framedata%d[] = {\n", global_modelname, anim->name, keyf->keyframe);
-                for (meshnode = list_meshes.head; meshnode != NULL; meshnode = meshnode->next) // Iterating meshes because they can be out of order to the frame data, due to material sorting optimization
+                fprintf(fp, "static s64Transform anim_%s_%s_framedata%d[] = {\n", ctx->settings.modelname, anim->name, keyf->keyframe);
+                for (meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next) // Iterating meshes because they can be out of order to the frame data, due to material sorting optimization
                 {
                     listNode* fdatanode;
                     for (fdatanode = keyf->framedata.head; fdatanode != NULL; fdatanode = fdatanode->next)
@@ -296,20 +324,29 @@ void write_output_text()
             }
             
             // Then print an array of keyframes
-            fprintf(fp, "static s64KeyFrame anim_%s_%s_keyframes[] = {\n", global_modelname, anim->name);
+            fprintf(fp, "static s64KeyFrame anim_%s_%s_keyframes[] = {\n", ctx->settings.modelname, anim->name);
             for (keyfnode = anim->keyframes.head; keyfnode != NULL; keyfnode = keyfnode->next)
             {
                 s64Keyframe* keyf = (s64Keyframe*)keyfnode->data;
-                fprintf(fp, "    {%d, anim_%s_%s_framedata%d},\n", keyf->keyframe, global_modelname, anim->name, keyf->keyframe);
+                fprintf(fp, "    {%d, anim_%s_%s_framedata%d},\n", keyf->keyframe, ctx->settings.modelname, anim->name, keyf->keyframe);
             }
-            fprintf(fp, "};");
+            fprintf(fp, "};\n");
+            
+            // And the keyframe index of every frame, for seeking
+            fprintf(fp, "static u16 anim_%s_%s_framelookup[] = {", ctx->settings.modelname, anim->name);
+            for (i=0; i<anim->framecount; i++)
+            {
+                fprintf(fp, (i%16 == 0) ? "\n    " : " ");
+                fprintf(fp, "%d,", anim->framelookup[i]);
+            }
+            fprintf(fp, "\n};");
         }
     }
     
     // Finally, print the Sausage64 structs
     if (makestructs)
     {
-        bool ismultimesh = (list_meshes.size > 1);
+        bool ismultimesh = (ctx->meshes.size > 1);
         
         // Struct comment header
         fputs("\n\n\n", fp);
@@ -318,27 +355,42 @@ void write_output_text()
               "*********************************/\n", fp);
         fputs("\n", fp);
         
+        // Mesh LOD lists
+        for (curnode = ctx->meshes.head; curnode != NULL; curnode = curnode->next)
+        {
+            s64Mesh* mesh = (s64Mesh*)curnode->data;
+            if (mesh->lods.size == 0)
+                continue;
+            fprintf(fp, "static s64MeshLOD lods_%s_%s[] = {\n", ctx->settings.modelname, mesh->name);
+            for (listNode* lodnode = mesh->lods.head; lodnode != NULL; lodnode = lodnode->next)
+            {
+                s64Mesh* lod = (s64Mesh*)lodnode->data;
+                fprintf(fp, "    {%.4ff, %sgfx_%s_%s},\n", lod->lodscreensize, ctx->settings.opengl ? "&" : "", ctx->settings.modelname, lod->name);
+            }
+            fputs("};\n\n", fp);
+        }
+        
         // Mesh list
-        fprintf(fp, "static s64Mesh meshes_%s[] = {\n", global_modelname);
-        for (curnode = list_meshes.head; curnode != NULL; curnode = curnode->next)
+        fprintf(fp, "static s64Mesh meshes_%s[] = {\n", ctx->settings.modelname);
+        for (curnode = ctx->meshes.head; curnode != NULL; curnode = curnode->next)
         {
             bool billboard = FALSE;
             s64Mesh* mesh = (s64Mesh*)curnode->data;
             
             // Write the model data line
             fprintf(fp, "    {\"%s\", %d, ", mesh->name, has_property(mesh, "Billboard"));
-            if (global_opengl)
+            if (ctx->settings.opengl)
                 fputs("&", fp);
             if (ismultimesh)
-                fprintf(fp, "gfx_%s_%s, ", global_modelname, mesh->name);
+                fprintf(fp, "gfx_%s_%s, ", ctx->settings.modelname, mesh->name);
             else
-                fprintf(fp, "gfx_%s, ", global_modelname);
+                fprintf(fp, "gfx_%s, ", ctx->settings.modelname);
             if (mesh->parent != NULL)
             {
                 int index = 0;
                 listNode* pnode;
 
-                for (pnode = list_meshes.head; pnode != NULL; pnode = pnode->next)
+                for (pnode = ctx->meshes.head; pnode != NULL; pnode = pnode->next)
                 {
                     s64Mesh* parent = (s64Mesh*)pnode->data;
                     if (!strcmp(parent->name, mesh->parent))
@@ -351,36 +403,414 @@ void write_output_text()
             }
             else
                 fprintf(fp, "-1");
-
+            
+            // Write the bounds and LODs
+            fprintf(fp, ", {%.4ff, %.4ff, %.4ff, %.4ff}, %d, ", mesh->boundcenter.x, mesh->boundcenter.y, mesh->boundcenter.z, mesh->boundradius, mesh->lods.size);
+            if (mesh->lods.size > 0)
+                fprintf(fp, "lods_%s_%s", ctx->settings.modelname, mesh->name);
+            else
+                fprintf(fp, "NULL");
             fprintf(fp, "},\n");
         }
         fputs("};\n\n", fp);
         
         // Animation list
-        fprintf(fp, "static s64Animation anims_%s[] = {\n", global_modelname);
-        for (curnode = list_animations.head; curnode != NULL; curnode = curnode->next)
+        fprintf(fp, "static s64Animation anims_%s[] = {\n", ctx->settings.modelname);
+        for (curnode = ctx->animations.head; curnode != NULL; curnode = curnode->next)
         {
             s64Anim* anim = (s64Anim*)curnode->data;
-            fprintf(fp, "    {\"%s\", %d, anim_%s_%s_keyframes},\n", anim->name, anim->keyframes.size, global_modelname, anim->name);
+            fprintf(fp, "    {\"%s\", %d, anim_%s_%s_keyframes, {%.4ff, %.4ff, %.4ff, %.4ff}, anim_%s_%s_framelookup},\n", anim->name, anim->keyframes.size, ctx->settings.modelname, anim->name, anim->boundcenter.x, anim->boundcenter.y, anim->boundcenter.z, anim->boundradius, ctx->settings.modelname, anim->name);
         }
         fputs("};\n\n", fp);
 
         // Final model data
-        fprintf(fp, "static s64ModelData mdl_%s = {%d, %d, meshes_%s, anims_%s, NULL};", global_modelname, list_meshes.size, list_animations.size, global_modelname, global_modelname);
+        fprintf(fp, "static s64ModelData mdl_%s = {%d, %d, meshes_%s, anims_%s, NULL};", ctx->settings.modelname, ctx->meshes.size, ctx->animations.size, ctx->settings.modelname, ctx->settings.modelname);
     }
     
     // Finish
-    if (!global_quiet) printf("Wrote output to '%s.h'\n", global_outputname);
+    if (!ctx->settings.quiet) printf("Wrote output to '%s.h'\n", ctx->settings.outputname);
     fclose(fp);
 }
 
 
+/*==============================
+    binary_buildgeometry
+    Generates the binary vertex, face and display list 
+    data of a mesh
+    @param  The conversion context
+    @param  The mesh to generate the data of
+    @param  The mesh's binary display list (libultra only)
+    @param  The offset in the file where the data will start
+    @param  The TOC to fill in
+    @param  The geometry struct to fill in
+    @return The offset in the file where the data ends
+==============================*/
+
+static uint32_t binary_buildgeometry(arabikiContext* ctx, s64Mesh* mesh, linkedList* dllist, uint32_t offset, BinFile_TOC_LOD* toc, BinFile_Geometry* geo)
+{
+    listNode* vcachenode;
+    
+    // Get the total vert and face count
+    geo->vtotal = 0;
+    geo->ftotal = 0;
+    for (vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+    {
+        vertCache* vcache = (vertCache*)vcachenode->data;
+        listNode* vertnode;
+        
+        // Cycle through all the verts
+        for (vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
+            geo->vtotal++;
+        for (vertnode = vcache->faces.head; vertnode != NULL; vertnode = vertnode->next)
+            geo->ftotal++;
+    }
+    if (mesh->hascullbox)
+        geo->vtotal += 8;
+
+    // Create the vert data
+    if (!ctx->settings.opengl)
+    {
+        int j = 0;
+
+        geo->vertdata = (BinFile_UltraVert*)malloc(sizeof(BinFile_UltraVert)*geo->vtotal);
+        if (geo->vertdata == NULL)
+            terminate(ctx, "Error: Unable to malloc for vert data\n");
+
+        // The bounding box corners come first, as the display list expects
+        if (mesh->hascullbox)
+        {
+            for (j=0; j<8; j++)
+            {
+                Vector3D corner = get_cullbox_corner(mesh, j);
+                memset(&((BinFile_UltraVert*)geo->vertdata)[j], 0, sizeof(BinFile_UltraVert));
+                ((BinFile_UltraVert*)geo->vertdata)[j].pos[0] = corner.x;
+                ((BinFile_UltraVert*)geo->vertdata)[j].pos[1] = corner.y;
+                ((BinFile_UltraVert*)geo->vertdata)[j].pos[2] = corner.z;
+                ((BinFile_UltraVert*)geo->vertdata)[j].colornormal[3] = 255;
+            }
+        }
+
+        // Copy the vert data by cycling through the vcache blocks
+        for (vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+        {
+            vertCache* vcache = (vertCache*)vcachenode->data;
+            listNode* vertnode;
+            
+            // Cycle through all the verts
+            for (vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
+            {
+                int texturew = 0, textureh = 0;
+                s64Vert* vert = (s64Vert*)vertnode->data;
+                n64Material* mat = find_material_fromvert(&vcache->faces, vert);
+                Vector3D normorcol = {0, 0, 0};
+                
+                // Ensure the texture is valid
+                if (mat == NULL)
+                    terminate(ctx, "Error: Inconsistent face/vertex material information\n");
+                
+                // Retrieve texture/normal/color data for this vertex
+                switch (mat->type)
+                {
+                    case TYPE_TEXTURE:
+                        // Get the texture size
+                        texturew = (mat->data).image.w;
+                        textureh = (mat->data).image.h;
+                        
+                        // Intentional fallthrough
+                    case TYPE_PRIMCOL:
+                        // Pick vertex normals or vertex colors, depending on the texture flag
+                        if (mat_hasgeoflag(mat, "G_LIGHTING"))
+                            normorcol = vector_scale(vert->normal, 127);
+                        else
+                            normorcol = vector_scale(vert->color, 255);
+                        break;
+                    case TYPE_OMIT:
+                        break;
+                }
+
+                // Dump the vert data
+                ((BinFile_UltraVert*)geo->vertdata)[j].pos[0] = round(vert->pos.x);
+                ((BinFile_UltraVert*)geo->vertdata)[j].pos[1] = round(vert->pos.y);
+                ((BinFile_UltraVert*)geo->vertdata)[j].pos[2] = round(vert->pos.z);
+                ((BinFile_UltraVert*)geo->vertdata)[j].pad = 0;
+                ((BinFile_UltraVert*)geo->vertdata)[j].tex[0] = float_to_s10p5(vert->UV.x*texturew);
+                ((BinFile_UltraVert*)geo->vertdata)[j].tex[1] = float_to_s10p5(vert->UV.y*textureh);
+                ((BinFile_UltraVert*)geo->vertdata)[j].colornormal[0] = round(normorcol.x);
+                ((BinFile_UltraVert*)geo->vertdata)[j].colornormal[1] = round(normorcol.y);
+                ((BinFile_UltraVert*)geo->vertdata)[j].colornormal[2] = round(normorcol.z);
+                ((BinFile_UltraVert*)geo->vertdata)[j].colornormal[3] = 255;
+                j++;
+            }
+        }
+
+        // Update the vert data size and offset in the TOC
+        toc->vertdata_size = (member_size(BinFile_UltraVert, pos)
+                                    + member_size(BinFile_UltraVert, pad) 
+                                    + member_size(BinFile_UltraVert, tex)
+                                    + member_size(BinFile_UltraVert, colornormal)
+                                    )*geo->vtotal;
+    }
+    else
+    {
+        int j = 0;
+
+        geo->vertdata = (BinFile_DragonVert*)malloc(sizeof(BinFile_DragonVert)*geo->vtotal);
+        if (geo->vertdata == NULL)
+            terminate(ctx, "Error: Unable to malloc for vert data\n");
+
+        for (vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+        {
+            listNode* vertnode;
+            vertCache* vcache = (vertCache*)vcachenode->data;
+            
+            // Cycle through all the verts
+            for (vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
+            {
+                s64Vert* vert = (s64Vert*)vertnode->data;
+                
+                // Dump the vert data
+                ((BinFile_DragonVert*)geo->vertdata)[j].pos[0] = swap_endianfloat(vert->pos.x);
+                ((BinFile_DragonVert*)geo->vertdata)[j].pos[1] = swap_endianfloat(vert->pos.y);
+                ((BinFile_DragonVert*)geo->vertdata)[j].pos[2] = swap_endianfloat(vert->pos.z);
+                ((BinFile_DragonVert*)geo->vertdata)[j].tex[0] = swap_endianfloat(vert->UV.x);
+                ((BinFile_DragonVert*)geo->vertdata)[j].tex[1] = swap_endianfloat(vert->UV.y);
+                ((BinFile_DragonVert*)geo->vertdata)[j].normal[0] = swap_endianfloat(vert->normal.x);
+                ((BinFile_DragonVert*)geo->vertdata)[j].normal[1] = swap_endianfloat(vert->normal.y);
+                ((BinFile_DragonVert*)geo->vertdata)[j].normal[2] = swap_endianfloat(vert->normal.z);
+                ((BinFile_DragonVert*)geo->vertdata)[j].color[0] = swap_endianfloat(vert->color.x);
+                ((BinFile_DragonVert*)geo->vertdata)[j].color[1] = swap_endianfloat(vert->color.y);
+                ((BinFile_DragonVert*)geo->vertdata)[j].color[2] = swap_endianfloat(vert->color.z);
+                j++;
+            }
+        }
+
+        // Update the vert data size and offset in the TOC
+        toc->vertdata_size = (member_size(BinFile_DragonVert, pos)
+                                    + member_size(BinFile_DragonVert, tex)
+                                    + member_size(BinFile_DragonVert, normal) 
+                                    + member_size(BinFile_DragonVert, color)
+                                    )*geo->vtotal;
+    }
+    toc->vertdata_offset = offset;
+
+    // Create the faces list (OpenGL)
+    if (ctx->settings.opengl)
+    {
+        int vertindex = 0;
+        int faceindex = 0;
+
+        // Malloc the face data
+        geo->facedata = (uint16_t*)malloc(sizeof(uint16_t)*geo->ftotal*3);
+        if (geo->facedata == NULL)
+            terminate(ctx, "Error: Unable to malloc for face data\n");
+
+        // Assign the face data
+        for (vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
+        {
+            listNode* vertnode;
+            vertCache* vcache = (vertCache*)vcachenode->data;
+            
+            // Cycle through all the faces
+            for (vertnode = vcache->faces.head; vertnode != NULL; vertnode = vertnode->next)
+            {
+                s64Face* face = (s64Face*)vertnode->data;
+                geo->facedata[faceindex*3 + 0] = swap_endian16(vertindex + list_index_from_data(&vcache->verts, face->verts[0]));
+                geo->facedata[faceindex*3 + 1] = swap_endian16(vertindex + list_index_from_data(&vcache->verts, face->verts[1]));
+                geo->facedata[faceindex*3 + 2] = swap_endian16(vertindex + list_index_from_data(&vcache->verts, face->verts[2]));
+                faceindex++;
+            }
+            vertindex += vcache->verts.size;
+        }
+
+        // Update the vert data size and offset in the TOC
+        toc->facedata_size = sizeof(uint16_t)*geo->ftotal*3;
+        toc->facedata_offset = toc->vertdata_offset + toc->vertdata_size;
+    }
+
+    // Create the display list
+    if (!ctx->settings.opengl)
+    {
+        int dloffset = 0;
+        int finalsize = 0;
+        int slotcount = 0;
+        listNode* dllnode;
+
+        // Count the finalsize and slotcount
+        for (dllnode = dllist->head; dllnode != NULL; dllnode = dllnode->next)
+        {
+            DLCBinary* bindl = (DLCBinary*)dllnode->data;
+            finalsize += (1 + bindl->size)*sizeof(uint32_t);
+            slotcount += commands_f3dex2[bindl->cmd].size;
+        }
+
+        // Update the TOC
+        toc->dldata_size = finalsize;
+        toc->dldata_slotcount = slotcount;
+        toc->dldata_offset = toc->vertdata_offset + toc->vertdata_size;
+
+        // Malloc the final data buffer
+        geo->dldata = (uint32_t*)calloc(finalsize, 1);
+        if (geo->dldata == NULL)
+            terminate(ctx, "Error: Unable to malloc for DLData\n");
+
+        // Copy the binary list to the final data buffer
+        for (dllnode = dllist->head; dllnode != NULL; dllnode = dllnode->next)
+        {
+            DLCBinary* bindl = (DLCBinary*)dllnode->data;
+            geo->dldata[dloffset] = swap_endian32(bindl->cmd);
+            dloffset++;
+            memcpy(&geo->dldata[dloffset], bindl->data, sizeof(uint32_t)*bindl->size);
+            dloffset += bindl->size;
+        }
+
+        // Cleanup memory
+        for (dllnode = dllist->head; dllnode != NULL; dllnode = dllnode->next)
+            free(((DLCBinary*)dllnode->data)->data);
+        list_destroy_deep(dllist);
+    }
+    else
+    {
+        int j=0;
+        linkedList* list_vcacherender = generate_opengl_vcachelist(ctx, mesh);
+
+        // Copy our data to the dldata block
+        geo->dldata = (uint32_t*)malloc(sizeof(uint32_t)*3*list_vcacherender->size);
+        if (geo->dldata == NULL)
+            terminate(ctx, "Error: Unable to malloc for DLData\n");
+        for (vcachenode = list_vcacherender->head; vcachenode != NULL; vcachenode = vcachenode->next)
+        {
+            VCacheRenderBlock* vcrb = vcachenode->data;
+            geo->dldata[j*3 + 0] = ((swap_endian16(vcrb->vertoffset) << 16) & 0xFFFF0000) | (swap_endian16(vcrb->vertcount) & 0x0000FFFF);
+            geo->dldata[j*3 + 1] = ((swap_endian16(vcrb->faceoffset) << 16) & 0xFFFF0000) | (swap_endian16(vcrb->facecount) & 0x0000FFFF);
+            geo->dldata[j*3 + 2] = swap_endian32(vcrb->matid);
+            j++;
+        }
+
+        // Fill in the dldata info
+        toc->dldata_size = (member_size(VCacheRenderBlock, vertcount)
+                                + member_size(VCacheRenderBlock, vertoffset)
+                                + member_size(VCacheRenderBlock, facecount)
+                                + member_size(VCacheRenderBlock, faceoffset)
+                                + member_size(VCacheRenderBlock, matid))
+                                *list_vcacherender->size;
+        toc->dldata_slotcount = list_vcacherender->size;
+        toc->dldata_offset = toc->facedata_offset + align_32bits(toc->facedata_size);
+
+        // Cleanup
+        list_destroy_deep(list_vcacherender);
+        free(list_vcacherender);
+    }
+    geo->dlsize = toc->dldata_size;
+    return toc->dldata_offset + toc->dldata_size;
+}
+
+
+/*==============================
+    binary_writegeometry
+    Writes the binary vertex, face and display list 
+    data of a mesh to a file
+    @param The conversion context
+    @param The file to write to
+    @param The geometry to write
+==============================*/
+
+static void binary_writegeometry(arabikiContext* ctx, FILE* fp, BinFile_Geometry* geo)
+{
+    int j;
+    if (!ctx->settings.opengl)
+    {
+        for (j=0; j<geo->vtotal; j++)
+        {
+            ((BinFile_UltraVert*)geo->vertdata)[j].pos[0] = swap_endian16(((BinFile_UltraVert*)geo->vertdata)[j].pos[0]);
+            ((BinFile_UltraVert*)geo->vertdata)[j].pos[1] = swap_endian16(((BinFile_UltraVert*)geo->vertdata)[j].pos[1]);
+            ((BinFile_UltraVert*)geo->vertdata)[j].pos[2] = swap_endian16(((BinFile_UltraVert*)geo->vertdata)[j].pos[2]);
+            ((BinFile_UltraVert*)geo->vertdata)[j].pad = swap_endian16(((BinFile_UltraVert*)geo->vertdata)[j].pad);
+            ((BinFile_UltraVert*)geo->vertdata)[j].tex[0] = swap_endian16(((BinFile_UltraVert*)geo->vertdata)[j].tex[0]);
+            ((BinFile_UltraVert*)geo->vertdata)[j].tex[1] = swap_endian16(((BinFile_UltraVert*)geo->vertdata)[j].tex[1]);
+            fwrite(&((BinFile_UltraVert*)geo->vertdata)[j].pos[0], member_size(BinFile_UltraVert, pos), 1, fp);
+            fwrite(&((BinFile_UltraVert*)geo->vertdata)[j].pad, member_size(BinFile_UltraVert, pad), 1, fp);
+            fwrite(&((BinFile_UltraVert*)geo->vertdata)[j].tex[0], member_size(BinFile_UltraVert, tex), 1, fp);
+            fwrite(&((BinFile_UltraVert*)geo->vertdata)[j].colornormal[0], member_size(BinFile_UltraVert, colornormal), 1, fp);
+        }
+    }
+    else
+    {
+        for (j=0; j<geo->vtotal; j++)
+        {
+            fwrite(&((BinFile_DragonVert*)geo->vertdata)[j].pos[0], member_size(BinFile_DragonVert, pos), 1, fp);
+            fwrite(&((BinFile_DragonVert*)geo->vertdata)[j].tex[0], member_size(BinFile_DragonVert, tex), 1, fp);
+            fwrite(&((BinFile_DragonVert*)geo->vertdata)[j].normal[0], member_size(BinFile_DragonVert, normal), 1, fp);
+            fwrite(&((BinFile_DragonVert*)geo->vertdata)[j].color[0], member_size(BinFile_DragonVert, color), 1, fp);
+        }
+        for (j=0; j<geo->ftotal; j++)
+            fwrite(&geo->facedata[j*3], sizeof(uint16_t), 3, fp);
+        writepadding(fp, sizeof(uint16_t)*geo->ftotal*3);
+    }
+    fwrite(geo->dldata, geo->dlsize, 1, fp);
+}
+
+
+/*==============================
+    binary_writelodtoc
+    Writes a mesh LOD's TOC to a file
+    @param The conversion context
+    @param The file to write to
+    @param The TOC to write
+==============================*/
+
+static void binary_writelodtoc(arabikiContext* ctx, FILE* fp, BinFile_TOC_LOD* toc)
+{
+    BinFile_TOC_LOD out;
+    out.screensize = swap_endianfloat(toc->screensize);
+    out.vertdata_offset = swap_endian32(toc->vertdata_offset);
+    out.vertdata_size = swap_endian32(toc->vertdata_size);
+    out.facedata_offset = swap_endian32(toc->facedata_offset);
+    out.facedata_size = swap_endian32(toc->facedata_size);
+    out.dldata_offset = swap_endian32(toc->dldata_offset);
+    out.dldata_size = swap_endian32(toc->dldata_size);
+    out.dldata_slotcount = swap_endian32(toc->dldata_slotcount);
+    fwrite(&out.screensize, member_size(BinFile_TOC_LOD, screensize), 1, fp);
+    fwrite(&out.vertdata_offset, member_size(BinFile_TOC_LOD, vertdata_offset), 1, fp);
+    fwrite(&out.vertdata_size, member_size(BinFile_TOC_LOD, vertdata_size), 1, fp);
+    if (ctx->settings.opengl)
+    {
+        fwrite(&out.facedata_offset, member_size(BinFile_TOC_LOD, facedata_offset), 1, fp);
+        fwrite(&out.facedata_size, member_size(BinFile_TOC_LOD, facedata_size), 1, fp);
+    }
+    fwrite(&out.dldata_offset, member_size(BinFile_TOC_LOD, dldata_offset), 1, fp);
+    fwrite(&out.dldata_size, member_size(BinFile_TOC_LOD, dldata_size), 1, fp);
+    fwrite(&out.dldata_slotcount, member_size(BinFile_TOC_LOD, dldata_slotcount), 1, fp);
+}
+
+
+/*==============================
+    binary_lodtocsize
+    Gets the size of a mesh LOD's TOC in the binary file
+    @return The size of the TOC, in bytes
+    @param The conversion context
+==============================*/
+
+static int binary_lodtocsize(arabikiContext* ctx)
+{
+    int size = member_size(BinFile_TOC_LOD, screensize)
+             + member_size(BinFile_TOC_LOD, vertdata_offset)
+             + member_size(BinFile_TOC_LOD, vertdata_size)
+             + member_size(BinFile_TOC_LOD, dldata_offset)
+             + member_size(BinFile_TOC_LOD, dldata_size)
+             + member_size(BinFile_TOC_LOD, dldata_slotcount);
+    if (ctx->settings.opengl)
+        size += member_size(BinFile_TOC_LOD, facedata_offset) + member_size(BinFile_TOC_LOD, facedata_size);
+    return size;
+}
+
+
 /*==============================
     write_output_binary
     Writes the output to a binary file.
+    @param The conversion context
 ==============================*/
 
-void write_output_binary()
+void write_output_binary(arabikiContext* ctx)
 {
     int i;
     FILE* fp;
@@ -389,16 +819,13 @@ void write_output_binary()
     BinFile bin;
     BinFile_TOC_Meshes* toc_meshes;
     BinFile_MeshData* meshdatas;
-    void* vertdatas;
-    int* vtotal;
-    int* ftotal;
-    uint16_t** facedatas;
-    uint32_t** dldatas;
+    BinFile_Geometry** geometries;
+    uint32_t meshend;
     BinFile_TOC_Anims* toc_anims;
     BinFile_AnimData* animdatas;
     BinFile_KeyFrame** kfdatas;
     int* kftotal;
-    bool makestructs = (list_animations.size > 0 || list_meshes.size > 1);
+    bool makestructs = (ctx->animations.size > 0 || ctx->meshes.size > 1);
     int texturecount = 0, primcolorcount = 0;
     int longesttexname = 0;
     BinFile_TOC_Materials* toc_materials;
@@ -407,22 +834,22 @@ void write_output_binary()
     BinFile_Material_PrimColor* primcolors;
     
     // Open the file
-    sprintf(strbuff, "%s.bin", global_outputname);
+    sprintf(strbuff, "%s.bin", ctx->settings.outputname);
     fp = fopen(strbuff, "wb+");
     if (fp == NULL)
-        terminate("Error: Unable to open file for writing\n");
+        terminate(ctx, "Error: Unable to open file for writing\n");
     
     // Generate the file header
     bin.header[0]     = 'S';
     bin.header[1]     = '6';
     bin.header[2]     = '4';
     bin.header[3]     = BINARY_VERSION;
-    bin.count_meshes  = list_meshes.size;
+    bin.count_meshes  = ctx->meshes.size;
     bin.count_materials = 0;
-    bin.count_anims   = list_animations.size;
-    if (global_opengl)
+    bin.count_anims   = ctx->animations.size;
+    if (ctx->settings.opengl)
     {
-        for (curnode = list_materials.head; curnode != NULL; curnode = curnode->next)
+        for (curnode = ctx->materials.head; curnode != NULL; curnode = curnode->next)
         {
             n64Material* mat = (n64Material*)curnode->data;
             if (isvalidmat(mat))
@@ -431,36 +858,57 @@ void write_output_binary()
     }
 
     // Malloc stuff
-    toc_meshes = (BinFile_TOC_Meshes*)calloc(sizeof(BinFile_TOC_Meshes)*list_meshes.size, 1);
-    meshdatas = (BinFile_MeshData*)calloc(sizeof(BinFile_MeshData)*list_meshes.size, 1);
-    if (!global_opengl)
-        vertdatas = (BinFile_UltraVert**)calloc(sizeof(BinFile_UltraVert*)*list_meshes.size, 1);
-    else
-        vertdatas = (BinFile_DragonVert**)calloc(sizeof(BinFile_DragonVert*)*list_meshes.size, 1);
-    facedatas = (uint16_t**)calloc(sizeof(uint16_t*)*list_meshes.size, 1);
-    dldatas = (uint32_t**)calloc(sizeof(uint32_t*)*list_meshes.size, 1);
-    vtotal = (int*)calloc(sizeof(int)*list_meshes.size, 1);
-    ftotal = (int*)calloc(sizeof(int)*list_meshes.size, 1);
-    kftotal = (int*)calloc(sizeof(int)*list_animations.size, 1);
-    kfdatas = (BinFile_KeyFrame**)calloc(sizeof(BinFile_KeyFrame*)*list_animations.size, 1);
-    if (toc_meshes == NULL || meshdatas == NULL || vertdatas == NULL || facedatas == NULL || dldatas == NULL || vtotal == NULL || ftotal == NULL || kftotal == NULL || kfdatas == NULL)
-        terminate("Error: Malloc failure during binary output\n");
+    toc_meshes = (BinFile_TOC_Meshes*)calloc(sizeof(BinFile_TOC_Meshes)*ctx->meshes.size, 1);
+    meshdatas = (BinFile_MeshData*)calloc(sizeof(BinFile_MeshData)*ctx->meshes.size, 1);
+    geometries = (BinFile_Geometry**)calloc(sizeof(BinFile_Geometry*)*ctx->meshes.size, 1);
+    kftotal = (int*)calloc(sizeof(int)*ctx->animations.size, 1);
+    kfdatas = (BinFile_KeyFrame**)calloc(sizeof(BinFile_KeyFrame*)*ctx->animations.size, 1);
+    if (toc_meshes == NULL || meshdatas == NULL || geometries == NULL || kftotal == NULL || kfdatas == NULL)
+        terminate(ctx, "Error: Malloc failure during binary output\n");
 
 
     // -------------- Mesh Data --------------
 
+    // The mesh data starts after the header and the mesh TOCs
+    meshend = 0;
+    meshend += member_size(BinFile_TOC_Meshes, meshdata_offset);
+    meshend += member_size(BinFile_TOC_Meshes, meshdata_size);
+    meshend += member_size(BinFile_TOC_Meshes, vertdata_offset);
+    meshend += member_size(BinFile_TOC_Meshes, vertdata_size);
+    if (ctx->settings.opengl)
+    {
+        meshend += member_size(BinFile_TOC_Meshes, facedata_offset);
+        meshend += member_size(BinFile_TOC_Meshes, facedata_size);
+    }
+    meshend += member_size(BinFile_TOC_Meshes, dldata_offset);
+    meshend += member_size(BinFile_TOC_Meshes, dldata_size);
+    meshend += member_size(BinFile_TOC_Meshes, dldata_slotcount);
+    meshend *= ctx->meshes.size;
+    meshend += member_size(BinFile, header) ;
+    meshend += member_size(BinFile, count_materials);
+    meshend += member_size(BinFile, count_meshes);
+    meshend += member_size(BinFile, count_anims);
+    meshend += member_size(BinFile, offset_meshes);
+    meshend += member_size(BinFile, offset_anims);
+    meshend += member_size(BinFile, offset_materials);
+
     i = 0;
-    for (curnode = list_meshes.head; curnode != NULL; curnode = curnode->next)
+    for (curnode = ctx->meshes.head; curnode != NULL; curnode = curnode->next)
     {
+        int j;
         int parent = 0;
-        listNode* vcachenode;
+        listNode* lodnode;
+        linkedList* dllist = NULL;
+        BinFile_TOC_LOD toc;
+        n64Material* entrymat;
+        n64Material* exitmat;
         s64Mesh* mesh = (s64Mesh*)curnode->data;
 
         // Find the parent mesh
         if (mesh->parent != NULL)
         {
             listNode* pnode;
-            for (pnode = list_meshes.head; pnode != NULL; pnode = pnode->next)
+            for (pnode = ctx->meshes.head; pnode != NULL; pnode = pnode->next)
             {
                 s64Mesh* p = (s64Mesh*)pnode->data;
                 if (!strcmp(p->name, mesh->parent))
@@ -474,271 +922,50 @@ void write_output_binary()
         // Assign the meshdata
         meshdatas[i].parent = parent;
         meshdatas[i].is_billboard = has_property(mesh, "Billboard");
+        meshdatas[i].lodcount = mesh->lods.size;
+        meshdatas[i].bounds[0] = mesh->boundcenter.x;
+        meshdatas[i].bounds[1] = mesh->boundcenter.y;
+        meshdatas[i].bounds[2] = mesh->boundcenter.z;
+        meshdatas[i].bounds[3] = mesh->boundradius;
         meshdatas[i].name = mesh->name;
+        meshdatas[i].lods = (BinFile_TOC_LOD*)calloc(sizeof(BinFile_TOC_LOD)*(mesh->lods.size+1), 1);
+        geometries[i] = (BinFile_Geometry*)calloc(sizeof(BinFile_Geometry)*(mesh->lods.size+1), 1);
+        if (meshdatas[i].lods == NULL || geometries[i] == NULL)
+            terminate(ctx, "Error: Unable to malloc for mesh LOD data\n");
  
         // Update the mesh data size and offset
         toc_meshes[i].meshdata_size = member_size(BinFile_MeshData, parent) 
                                     + member_size(BinFile_MeshData, is_billboard)
+                                    + member_size(BinFile_MeshData, lodcount)
+                                    + member_size(BinFile_MeshData, bounds)
+                                    + binary_lodtocsize(ctx)*meshdatas[i].lodcount
                                     + strlen(meshdatas[i].name)+1;
-        if (i == 0)
+        toc_meshes[i].meshdata_offset = meshend;
+
+        // Create the full detail vert, face, and display list data
+        entrymat = ctx->lastmaterial;
+        if (!ctx->settings.opengl)
+            dllist = dlist_frommesh(ctx, mesh, TRUE);
+        exitmat = ctx->lastmaterial;
+        meshend = binary_buildgeometry(ctx, mesh, dllist, toc_meshes[i].meshdata_offset + align_32bits(toc_meshes[i].meshdata_size), &toc, &geometries[i][0]);
+        toc_meshes[i].vertdata_offset = toc.vertdata_offset;
+        toc_meshes[i].vertdata_size = toc.vertdata_size;
+        toc_meshes[i].facedata_offset = toc.facedata_offset;
+        toc_meshes[i].facedata_size = toc.facedata_size;
+        toc_meshes[i].dldata_offset = toc.dldata_offset;
+        toc_meshes[i].dldata_size = toc.dldata_size;
+        toc_meshes[i].dldata_slotcount = toc.dldata_slotcount;
+
+        // Then the LODs, which are placed right after
+        j = 0;
+        for (lodnode = mesh->lods.head; lodnode != NULL; lodnode = lodnode->next)
         {
-            toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, meshdata_offset);
-            toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, meshdata_size);
-            toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, vertdata_offset);
-            toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, vertdata_size);
-            if (global_opengl)
-            {
-                toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, facedata_offset);
-                toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, facedata_size);
-            }
-            toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, dldata_offset);
-            toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, dldata_size);
-            toc_meshes[i].meshdata_offset += member_size(BinFile_TOC_Meshes, dldata_slotcount);
-            toc_meshes[i].meshdata_offset *= list_meshes.size;
-            toc_meshes[i].meshdata_offset += member_size(BinFile, header) ;
-            toc_meshes[i].meshdata_offset += member_size(BinFile, count_materials);
-            toc_meshes[i].meshdata_offset += member_size(BinFile, count_meshes);
-            toc_meshes[i].meshdata_offset += member_size(BinFile, count_anims);
-            toc_meshes[i].meshdata_offset += member_size(BinFile, offset_meshes);
-            toc_meshes[i].meshdata_offset += member_size(BinFile, offset_anims);
-            toc_meshes[i].meshdata_offset += member_size(BinFile, offset_materials);
-        }
-        else
-            toc_meshes[i].meshdata_offset = toc_meshes[i-1].dldata_offset + toc_meshes[i-1].dldata_size;
-
-        // Get the total vert and face count
-        vtotal[i] = 0;
-        for (vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
-        {
-            vertCache* vcache = (vertCache*)vcachenode->data;
-            listNode* vertnode;
-            
-            // Cycle through all the verts
-            for (vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
-                vtotal[i]++;
-            for (vertnode = vcache->faces.head; vertnode != NULL; vertnode = vertnode->next)
-                ftotal[i]++;
-        }
-
-        // Create the vert data
-        if (!global_opengl)
-        {
-            int j = 0;
-
-            ((BinFile_UltraVert**)vertdatas)[i] = (BinFile_UltraVert*)malloc(sizeof(BinFile_UltraVert)*vtotal[i]);
-            if (((BinFile_UltraVert**)vertdatas)[i] == NULL)
-                terminate("Error: Unable to malloc for vert data\n");
-
-            // Copy the vert data by cycling through the vcache blocks
-            for (vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
-            {
-                vertCache* vcache = (vertCache*)vcachenode->data;
-                listNode* vertnode;
-                
-                // Cycle through all the verts
-                for (vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
-                {
-                    int texturew = 0, textureh = 0;
-                    s64Vert* vert = (s64Vert*)vertnode->data;
-                    n64Material* mat = find_material_fromvert(&vcache->faces, vert);
-                    Vector3D normorcol = {0, 0, 0};
-                    
-                    // Ensure the texture is valid
-                    if (mat == NULL)
-                        terminate("Error: Inconsistent face/vertex material information\n");
-                    
-                    // Retrieve texture/normal/color data for this vertex
-                    switch (mat->type)
-                    {
-                        case TYPE_TEXTURE:
-                            // Get the texture size
-                            texturew = (mat->data).image.w;
-                            textureh = (mat->data).image.h;
-                            
-                            // Intentional fallthrough
-                        case TYPE_PRIMCOL:
-                            // Pick vertex normals or vertex colors, depending on the texture flag
-                            if (mat_hasgeoflag(mat, "G_LIGHTING"))
-                                normorcol = vector_scale(vert->normal, 127);
-                            else
-                                normorcol = vector_scale(vert->color, 255);
-                            break;
-                        case TYPE_OMIT:
-                            break;
-                    }
-
-                    // Dump the vert data
-                    ((BinFile_UltraVert**)vertdatas)[i][j].pos[0] = round(vert->pos.x);
-                    ((BinFile_UltraVert**)vertdatas)[i][j].pos[1] = round(vert->pos.y);
-                    ((BinFile_UltraVert**)vertdatas)[i][j].pos[2] = round(vert->pos.z);
-                    ((BinFile_UltraVert**)vertdatas)[i][j].pad = 0;
-                    ((BinFile_UltraVert**)vertdatas)[i][j].tex[0] = float_to_s10p5(vert->UV.x*texturew);
-                    ((BinFile_UltraVert**)vertdatas)[i][j].tex[1] = float_to_s10p5(vert->UV.y*textureh);
-                    ((BinFile_UltraVert**)vertdatas)[i][j].colornormal[0] = round(normorcol.x);
-                    ((BinFile_UltraVert**)vertdatas)[i][j].colornormal[1] = round(normorcol.y);
-                    ((BinFile_UltraVert**)vertdatas)[i][j].colornormal[2] = round(normorcol.z);
-                    ((BinFile_UltraVert**)vertdatas)[i][j].colornormal[3] = 255;
-                    j++;
-                }
-            }
-
-            // Update the vert data size and offset in the TOC
-            toc_meshes[i].vertdata_size = (member_size(BinFile_UltraVert, pos)
-                                        + member_size(BinFile_UltraVert, pad) 
-                                        + member_size(BinFile_UltraVert, tex)
-                                        + member_size(BinFile_UltraVert, colornormal)
-                                        )*vtotal[i];
-        }
-        else
-        {
-            int j = 0;
-
-            ((BinFile_DragonVert**)vertdatas)[i] = (BinFile_DragonVert*)malloc(sizeof(BinFile_DragonVert)*vtotal[i]);
-            if (((BinFile_DragonVert**)vertdatas)[i] == NULL)
-                terminate("Error: Unable to malloc for vert data\n");
-
-            for (vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
-            {
-                listNode* vertnode;
-                vertCache* vcache = (vertCache*)vcachenode->data;
-                
-                // Cycle through all the verts
-                for (vertnode = vcache->verts.head; vertnode != NULL; vertnode = vertnode->next)
-                {
-                    s64Vert* vert = (s64Vert*)vertnode->data;
-                    
-                    // Dump the vert data
-                    ((BinFile_DragonVert**)vertdatas)[i][j].pos[0] = swap_endianfloat(vert->pos.x);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].pos[1] = swap_endianfloat(vert->pos.y);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].pos[2] = swap_endianfloat(vert->pos.z);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].tex[0] = swap_endianfloat(vert->UV.x);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].tex[1] = swap_endianfloat(vert->UV.y);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].normal[0] = swap_endianfloat(vert->normal.x);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].normal[1] = swap_endianfloat(vert->normal.y);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].normal[2] = swap_endianfloat(vert->normal.z);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].color[0] = swap_endianfloat(vert->color.x);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].color[1] = swap_endianfloat(vert->color.y);
-                    ((BinFile_DragonVert**)vertdatas)[i][j].color[2] = swap_endianfloat(vert->color.z);
-                    j++;
-                }
-            }
-
-            // Update the vert data size and offset in the TOC
-            toc_meshes[i].vertdata_size = (member_size(BinFile_DragonVert, pos)
-                                        + member_size(BinFile_DragonVert, tex)
-                                        + member_size(BinFile_DragonVert, normal) 
-                                        + member_size(BinFile_DragonVert, color)
-                                        )*vtotal[i];
-        }
-        toc_meshes[i].vertdata_offset = toc_meshes[i].meshdata_offset + align_32bits(toc_meshes[i].meshdata_size);
-
-        // Create the faces list (OpenGL)
-        if (global_opengl)
-        {
-            int vertindex = 0;
-            int faceindex = 0;
-
-            // Malloc the face data
-            facedatas[i] = (uint16_t*)malloc(sizeof(uint16_t)*ftotal[i]*3);
-            if (facedatas[i] == NULL)
-                terminate("Error: Unable to malloc for face data\n");
-
-            // Assign the face data
-            for (vcachenode = mesh->vertcache.head; vcachenode != NULL; vcachenode = vcachenode->next)
-            {
-                listNode* vertnode;
-                vertCache* vcache = (vertCache*)vcachenode->data;
-                
-                // Cycle through all the faces
-                for (vertnode = vcache->faces.head; vertnode != NULL; vertnode = vertnode->next)
-                {
-                    s64Face* face = (s64Face*)vertnode->data;
-                    facedatas[i][faceindex*3 + 0] = swap_endian16(vertindex + list_index_from_data(&vcache->verts, face->verts[0]));
-                    facedatas[i][faceindex*3 + 1] = swap_endian16(vertindex + list_index_from_data(&vcache->verts, face->verts[1]));
-                    facedatas[i][faceindex*3 + 2] = swap_endian16(vertindex + list_index_from_data(&vcache->verts, face->verts[2]));
-                    faceindex++;
-                }
-                vertindex += vcache->verts.size;
-            }
-
-            // Update the vert data size and offset in the TOC
-            toc_meshes[i].facedata_size = sizeof(uint16_t)*ftotal[i]*3;
-            toc_meshes[i].facedata_offset = toc_meshes[i].vertdata_offset + toc_meshes[i].vertdata_size;
-        }
-
-        // Create the display list
-        if (!global_opengl)
-        {
-            int offset = 0;
-            int finalsize = 0;
-            int slotcount = 0;
-            listNode* dllnode;
-            linkedList* dllist = dlist_frommesh(mesh, TRUE);
-
-            // Count the finalsize and slotcount
-            for (dllnode = dllist->head; dllnode != NULL; dllnode = dllnode->next)
-            {
-                DLCBinary* bindl = (DLCBinary*)dllnode->data;
-                finalsize += (1 + bindl->size)*sizeof(uint32_t);
-                slotcount += commands_f3dex2[bindl->cmd].size;
-            }
-
-            // Update the TOC
-            toc_meshes[i].dldata_size = finalsize;
-            toc_meshes[i].dldata_slotcount = slotcount;
-            toc_meshes[i].dldata_offset = toc_meshes[i].vertdata_offset + toc_meshes[i].vertdata_size;
-
-            // Malloc the final data buffer
-            dldatas[i] = (uint32_t*)calloc(finalsize, 1);
-            if (dldatas[i] == NULL)
-                terminate("Error: Unable to malloc for DLData\n");
-
-            // Copy the binary list to the final data buffer
-            for (dllnode = dllist->head; dllnode != NULL; dllnode = dllnode->next)
-            {
-                DLCBinary* bindl = (DLCBinary*)dllnode->data;
-                dldatas[i][offset] = swap_endian32(bindl->cmd);
-                offset++;
-                memcpy(&dldatas[i][offset], bindl->data, sizeof(uint32_t)*bindl->size);
-                offset += bindl->size;
-            }
-
-            // Cleanup memory
-            for (dllnode = dllist->head; dllnode != NULL; dllnode = dllnode->next)
-                free(((DLCBinary*)dllnode->data)->data);
-            list_destroy_deep(dllist);
-        }
-        else
-        {
-            int j=0;
-            linkedList* list_vcacherender = generate_opengl_vcachelist(mesh);
-
-            // Copy our data to the dldata block
-            dldatas[i] = (uint32_t*)malloc(sizeof(uint32_t)*3*list_vcacherender->size);
-            if (dldatas[i] == NULL)
-                terminate("Error: Unable to malloc for DLData\n");
-            for (vcachenode = list_vcacherender->head; vcachenode != NULL; vcachenode = vcachenode->next)
-            {
-                VCacheRenderBlock* vcrb = vcachenode->data;
-                dldatas[i][j*3 + 0] = ((swap_endian16(vcrb->vertoffset) << 16) & 0xFFFF0000) | (swap_endian16(vcrb->vertcount) & 0x0000FFFF);
-                dldatas[i][j*3 + 1] = ((swap_endian16(vcrb->faceoffset) << 16) & 0xFFFF0000) | (swap_endian16(vcrb->facecount) & 0x0000FFFF);
-                dldatas[i][j*3 + 2] = swap_endian32(vcrb->matid);
-                j++;
-            }
-
-            // Fill in the dldata info
-            toc_meshes[i].dldata_size = (member_size(VCacheRenderBlock, vertcount)
-                                    + member_size(VCacheRenderBlock, vertoffset)
-                                    + member_size(VCacheRenderBlock, facecount)
-                                    + member_size(VCacheRenderBlock, faceoffset)
-                                    + member_size(VCacheRenderBlock, matid))
-                                    *list_vcacherender->size;
-            toc_meshes[i].dldata_slotcount = list_vcacherender->size;
-            toc_meshes[i].dldata_offset = toc_meshes[i].facedata_offset + align_32bits(toc_meshes[i].facedata_size);
-
-            // Cleanup
-            list_destroy_deep(list_vcacherender);
-            free(list_vcacherender);
+            s64Mesh* lod = (s64Mesh*)lodnode->data;
+            if (!ctx->settings.opengl)
+                dllist = dlist_fromlod(ctx, lod, entrymat, exitmat, TRUE);
+            meshend = binary_buildgeometry(ctx, lod, dllist, meshend, &meshdatas[i].lods[j], &geometries[i][j+1]);
+            meshdatas[i].lods[j].screensize = lod->lodscreensize;
+            j++;
         }
 
         // Done
@@ -751,15 +978,15 @@ void write_output_binary()
     if (bin.count_materials > 0)
     {
         int j, k;
-        bin.offset_materials = toc_meshes[list_meshes.size-1].dldata_offset + toc_meshes[list_meshes.size-1].dldata_size;
+        bin.offset_materials = meshend;
         toc_materials = (BinFile_TOC_Materials*)malloc(sizeof(BinFile_TOC_Materials)*bin.count_materials);
         matdatas = (BinFile_MatData*)malloc(sizeof(BinFile_MatData)*bin.count_materials);
         if (toc_materials == NULL || matdatas == NULL)
-            terminate("Error: Unable to malloc for material data");
+            terminate(ctx, "Error: Unable to malloc for material data");
 
         // Count the type of each material, and fill in the matdatas
         i=0;
-        for (curnode = list_materials.head; curnode != NULL; curnode = curnode->next)
+        for (curnode = ctx->materials.head; curnode != NULL; curnode = curnode->next)
         {
             n64Material* mat = (n64Material*)curnode->data;
             if (!isvalidmat(mat))
@@ -790,13 +1017,13 @@ void write_output_binary()
         textures = (BinFile_Material_Texture*)malloc(sizeof(BinFile_Material_Texture)*texturecount);
         primcolors = (BinFile_Material_PrimColor*)malloc(sizeof(BinFile_Material_PrimColor)*primcolorcount);
         if ((texturecount > 0 && textures == NULL) || (primcolorcount > 0 && primcolors == NULL))
-            terminate("Error: Unable to malloc for material data");
+            terminate(ctx, "Error: Unable to malloc for material data");
 
         // Fill in the material structs
         i=0;
         j=0;
         k=0;
-        for (curnode = list_materials.head; curnode != NULL; curnode = curnode->next)
+        for (curnode = ctx->materials.head; curnode != NULL; curnode = curnode->next)
         {
             n64Material* mat = (n64Material*)curnode->data;
             if (!isvalidmat(mat))
@@ -841,7 +1068,7 @@ void write_output_binary()
                     k++;
                     break;
                 default:
-                    terminate("Error: Unknown material type");
+                    terminate(ctx, "Error: Unknown material type");
                     break;
             }
 
@@ -853,8 +1080,7 @@ void write_output_binary()
                                                 + member_size(BinFile_TOC_Materials, material_offset)
                                                 + member_size(BinFile_TOC_Materials, material_size))
                                                 * bin.count_materials
-                                                + toc_meshes[list_meshes.size-1].dldata_offset 
-                                                + toc_meshes[list_meshes.size-1].dldata_size);
+                                                + meshend);
             else
                 toc_materials[i].matdata_offset = toc_materials[i-1].material_offset + align_32bits(toc_materials[i-1].material_size);
             toc_materials[i].material_offset = toc_materials[i].matdata_offset + align_32bits(toc_materials[i].matdata_size);
@@ -868,19 +1094,19 @@ void write_output_binary()
     // Update the header's animation offset
     if (bin.count_materials == 0)
     {
-        bin.offset_anims = toc_meshes[list_meshes.size-1].dldata_offset + toc_meshes[list_meshes.size-1].dldata_size;
+        bin.offset_anims = meshend;
         bin.offset_materials = bin.offset_anims;
     }
     else
         bin.offset_anims = toc_materials[bin.count_materials-1].material_offset + toc_materials[bin.count_materials-1].material_size;
 
     // Create the animation TOC
-    toc_anims = (BinFile_TOC_Anims*)malloc(sizeof(BinFile_TOC_Anims)*list_animations.size);
-    animdatas = (BinFile_AnimData*)malloc(sizeof(BinFile_AnimData)*list_animations.size);
+    toc_anims = (BinFile_TOC_Anims*)malloc(sizeof(BinFile_TOC_Anims)*ctx->animations.size);
+    animdatas = (BinFile_AnimData*)malloc(sizeof(BinFile_AnimData)*ctx->animations.size);
     if (toc_anims == NULL || animdatas == NULL)
-        terminate("Error: Unable to malloc for Anim Data\n");
+        terminate(ctx, "Error: Unable to malloc for Anim Data\n");
     i = 0;
-    for (curnode = list_animations.head; curnode != NULL; curnode = curnode->next)
+    for (curnode = ctx->animations.head; curnode != NULL; curnode = curnode->next)
     {
         int j=0;
         listNode* kfnode;
@@ -891,23 +1117,32 @@ void write_output_binary()
         animdatas[i].kfcount = anim->keyframes.size;
         animdatas[i].kfindices = (uint16_t*)malloc(sizeof(uint16_t)*anim->keyframes.size);
         if (animdatas[i].kfindices == NULL)
-            terminate("Error: Unable to malloc for AnimData kfindices\n");
+            terminate(ctx, "Error: Unable to malloc for AnimData kfindices\n");
         for (kfnode = anim->keyframes.head; kfnode != NULL; kfnode = kfnode->next)
             animdatas[i].kfindices[j++] = ((s64Keyframe*)kfnode->data)->keyframe;
+        animdatas[i].framecount = anim->framecount;
+        animdatas[i].framelookup = anim->framelookup;
         animdatas[i].name = anim->name;
+        animdatas[i].bounds[0] = anim->boundcenter.x;
+        animdatas[i].bounds[1] = anim->boundcenter.y;
+        animdatas[i].bounds[2] = anim->boundcenter.z;
+        animdatas[i].bounds[3] = anim->boundradius;
 
         // Assign some keyframe data
-        kftotal[i] = animdatas[i].kfcount*list_meshes.size;
+        kftotal[i] = animdatas[i].kfcount*ctx->meshes.size;
         for (kfnode = anim->keyframes.head; kfnode != NULL; kfnode = kfnode->next)
         {
             kfdatas[i] = (BinFile_KeyFrame*)malloc(sizeof(BinFile_KeyFrame)*kftotal[i]);
             if (kfdatas[i] == NULL)
-                terminate("Error: Unable to malloc for AnimData kfdatas\n");
+                terminate(ctx, "Error: Unable to malloc for AnimData kfdatas\n");
         }
 
         // Update the anim data size and offset
         toc_anims[i].animdata_size = member_size(BinFile_AnimData, kfcount) 
+                                    + member_size(BinFile_AnimData, bounds)
+                                    + member_size(BinFile_AnimData, framecount)
                                     + (sizeof(uint16_t)*animdatas[i].kfcount)
+                                    + (sizeof(uint16_t)*animdatas[i].framecount)
                                     + strlen(animdatas[i].name)+1;
         if (i == 0)
             toc_anims[i].animdata_offset = bin.offset_anims +
@@ -915,16 +1150,16 @@ void write_output_binary()
                                             member_size(BinFile_TOC_Anims, animdata_size) +
                                             member_size(BinFile_TOC_Anims, kfdata_offset) +
                                             member_size(BinFile_TOC_Anims, kfdata_size))
-                                            *list_animations.size;
+                                            *ctx->animations.size;
         else
             toc_anims[i].animdata_offset = toc_anims[i-1].kfdata_offset + toc_anims[i-1].kfdata_size;
-        toc_anims[i].kfdata_size = (member_size(BinFile_KeyFrame, pos) + member_size(BinFile_KeyFrame, rot) + member_size(BinFile_KeyFrame, scale))*animdatas[i].kfcount*list_meshes.size;
+        toc_anims[i].kfdata_size = (member_size(BinFile_KeyFrame, pos) + member_size(BinFile_KeyFrame, rot) + member_size(BinFile_KeyFrame, scale))*animdatas[i].kfcount*ctx->meshes.size;
         toc_anims[i].kfdata_offset = toc_anims[i].animdata_offset + align_32bits(toc_anims[i].animdata_size);
         j=0;
         for (kfnode = anim->keyframes.head; kfnode != NULL; kfnode = kfnode->next)
         {
             s64Keyframe* keyf = (s64Keyframe*)kfnode->data;
-            for (meshnode = list_meshes.head; meshnode != NULL; meshnode = meshnode->next) // Iterating meshes because they can be out of order to the frame data, due to material sorting optimization
+            for (meshnode = ctx->meshes.head; meshnode != NULL; meshnode = meshnode->next) // Iterating meshes because they can be out of order to the frame data, due to material sorting optimization
             {
                 listNode* fdatanode;
                 for (fdatanode = keyf->framedata.head; fdatanode != NULL; fdatanode = fdatanode->next)
@@ -972,7 +1207,7 @@ void write_output_binary()
     fwrite(&bin.offset_anims, member_size(BinFile, offset_anims), 1, fp);
 
     // Write the mesh TOCs
-    for (i=0; i<list_meshes.size; i++)
+    for (i=0; i<ctx->meshes.size; i++)
     {
         toc_meshes[i].meshdata_offset = swap_endian32(toc_meshes[i].meshdata_offset);
         toc_meshes[i].meshdata_size = swap_endian32(toc_meshes[i].meshdata_size);
@@ -985,7 +1220,7 @@ void write_output_binary()
         fwrite(&toc_meshes[i].meshdata_size, member_size(BinFile_TOC_Meshes, meshdata_size), 1, fp);
         fwrite(&toc_meshes[i].vertdata_offset, member_size(BinFile_TOC_Meshes, vertdata_offset), 1, fp);
         fwrite(&toc_meshes[i].vertdata_size, member_size(BinFile_TOC_Meshes, vertdata_size), 1, fp);
-        if (global_opengl)
+        if (ctx->settings.opengl)
         {
             toc_meshes[i].facedata_offset = swap_endian32(toc_meshes[i].facedata_offset);
             toc_meshes[i].facedata_size = swap_endian32(toc_meshes[i].facedata_size);
@@ -998,44 +1233,23 @@ void write_output_binary()
     }
 
     // Write the mesh data + verts + faces + dl
-    for (i=0; i<list_meshes.size; i++)
+    for (i=0; i<ctx->meshes.size; i++)
     {
         int j;
         meshdatas[i].parent = swap_endian16(meshdatas[i].parent);
+        for (j=0; j<4; j++)
+            meshdatas[i].bounds[j] = swap_endianfloat(meshdatas[i].bounds[j]);
         fwrite(&meshdatas[i].parent, member_size(BinFile_MeshData, parent), 1, fp);
         fwrite(&meshdatas[i].is_billboard, member_size(BinFile_MeshData, is_billboard), 1, fp);
+        fwrite(&meshdatas[i].lodcount, member_size(BinFile_MeshData, lodcount), 1, fp);
+        fwrite(&meshdatas[i].bounds[0], member_size(BinFile_MeshData, bounds), 1, fp);
+        for (j=0; j<meshdatas[i].lodcount; j++)
+            binary_writelodtoc(ctx, fp, &meshdatas[i].lods[j]);
         fwrite(meshdatas[i].name, strlen(meshdatas[i].name)+1, 1, fp);
         writepadding(fp, swap_endian32(toc_meshes[i].meshdata_size));
-        if (!global_opengl)
-        {
-            for (j=0; j<vtotal[i]; j++)
-            {
-                ((BinFile_UltraVert**)vertdatas)[i][j].pos[0] = swap_endian16(((BinFile_UltraVert**)vertdatas)[i][j].pos[0]);
-                ((BinFile_UltraVert**)vertdatas)[i][j].pos[1] = swap_endian16(((BinFile_UltraVert**)vertdatas)[i][j].pos[1]);
-                ((BinFile_UltraVert**)vertdatas)[i][j].pos[2] = swap_endian16(((BinFile_UltraVert**)vertdatas)[i][j].pos[2]);
-                ((BinFile_UltraVert**)vertdatas)[i][j].pad = swap_endian16(((BinFile_UltraVert**)vertdatas)[i][j].pad);
-                ((BinFile_UltraVert**)vertdatas)[i][j].tex[0] = swap_endian16(((BinFile_UltraVert**)vertdatas)[i][j].tex[0]);
-                ((BinFile_UltraVert**)vertdatas)[i][j].tex[1] = swap_endian16(((BinFile_UltraVert**)vertdatas)[i][j].tex[1]);
-                fwrite(&((BinFile_UltraVert**)vertdatas)[i][j].pos[0], member_size(BinFile_UltraVert, pos), 1, fp);
-                fwrite(&((BinFile_UltraVert**)vertdatas)[i][j].pad, member_size(BinFile_UltraVert, pad), 1, fp);
-                fwrite(&((BinFile_UltraVert**)vertdatas)[i][j].tex[0], member_size(BinFile_UltraVert, tex), 1, fp);
-                fwrite(&((BinFile_UltraVert**)vertdatas)[i][j].colornormal[0], member_size(BinFile_UltraVert, colornormal), 1, fp);
-            }
-        }
-        else
-        {
-            for (j=0; j<vtotal[i]; j++)
-            {
-                fwrite(&((BinFile_DragonVert**)vertdatas)[i][j].pos[0], member_size(BinFile_DragonVert, pos), 1, fp);
-                fwrite(&((BinFile_DragonVert**)vertdatas)[i][j].tex[0], member_size(BinFile_DragonVert, tex), 1, fp);
-                fwrite(&((BinFile_DragonVert**)vertdatas)[i][j].normal[0], member_size(BinFile_DragonVert, normal), 1, fp);
-                fwrite(&((BinFile_DragonVert**)vertdatas)[i][j].color[0], member_size(BinFile_DragonVert, color), 1, fp);
-            }
-            for (j=0; j<ftotal[i]; j++)
-                fwrite(&facedatas[i][j*3], sizeof(uint16_t), 3, fp);
-            writepadding(fp, swap_endian32(toc_meshes[i].facedata_size));
-        }
-        fwrite(dldatas[i], swap_endian32(toc_meshes[i].dldata_size), 1, fp);
+        binary_writegeometry(ctx, fp, &geometries[i][0]);
+        for (j=0; j<meshdatas[i].lodcount; j++)
+            binary_writegeometry(ctx, fp, &geometries[i][j+1]);
     }
 
     // Write the material TOCs
@@ -1085,7 +1299,7 @@ void write_output_binary()
     }
 
     // Write the animation TOCs
-    for (i=0; i<list_animations.size; i++)
+    for (i=0; i<ctx->animations.size; i++)
     {
         toc_anims[i].animdata_offset = swap_endian32(toc_anims[i].animdata_offset);
         toc_anims[i].animdata_size = swap_endian32(toc_anims[i].animdata_size);
@@ -1098,14 +1312,22 @@ void write_output_binary()
     }
 
     // Write the anim data + keyframes
-    for (i=0; i<list_animations.size; i++)
+    for (i=0; i<ctx->animations.size; i++)
     {
         int j;
         for (j=0; j<animdatas[i].kfcount; j++)
             animdatas[i].kfindices[j] = swap_endian16(animdatas[i].kfindices[j]);
+        for (j=0; j<animdatas[i].framecount; j++)
+            animdatas[i].framelookup[j] = swap_endian16(animdatas[i].framelookup[j]);
+        for (j=0; j<4; j++)
+            animdatas[i].bounds[j] = swap_endianfloat(animdatas[i].bounds[j]);
         animdatas[i].kfcount = swap_endian32(animdatas[i].kfcount);
+        animdatas[i].framecount = swap_endian32(animdatas[i].framecount);
         fwrite(&animdatas[i].kfcount, member_size(BinFile_AnimData, kfcount), 1, fp);
+        fwrite(&animdatas[i].bounds[0], member_size(BinFile_AnimData, bounds), 1, fp);
+        fwrite(&animdatas[i].framecount, member_size(BinFile_AnimData, framecount), 1, fp);
         fwrite(animdatas[i].kfindices, sizeof(uint16_t)*swap_endian32(animdatas[i].kfcount), 1, fp);
+        fwrite(animdatas[i].framelookup, sizeof(uint16_t)*swap_endian32(animdatas[i].framecount), 1, fp);
         fwrite(animdatas[i].name, strlen(animdatas[i].name)+1, 1, fp);
         writepadding(fp, swap_endian32(toc_anims[i].animdata_size));
         for (j=0; j<kftotal[i]; j++)
@@ -1131,17 +1353,17 @@ void write_output_binary()
     // -------------- Helper Header File --------------
     
     // Open the file
-    sprintf(strbuff, "%s.h", global_outputname);
+    sprintf(strbuff, "%s.h", ctx->settings.outputname);
     fp = fopen(strbuff, "w+");
     if (fp == NULL)
-        terminate("Error: Unable to open file for writing\n");
+        terminate(ctx, "Error: Unable to open file for writing\n");
 
     // Print the header
-    write_header(fp, makestructs);
+    write_header(ctx, fp, makestructs);
 
     // Print texture count and texture list
     texturecount = 0;
-    for (curnode = list_materials.head; curnode != NULL; curnode = curnode->next)
+    for (curnode = ctx->materials.head; curnode != NULL; curnode = curnode->next)
     {
         n64Material* tex = (n64Material*)curnode->data;
         if (isvalidmat(tex) && tex->type == TYPE_TEXTURE)
@@ -1154,12 +1376,12 @@ void write_output_binary()
     }
     if (texturecount > 0)
     {
-        fprintf(fp, "// Texture data\n#define TEXTURECOUNT_%s %d\n\n", global_modelname, texturecount);
-        for (curnode = list_materials.head; curnode != NULL; curnode = curnode->next)
+        fprintf(fp, "// Texture data\n#define TEXTURECOUNT_%s %d\n\n", ctx->settings.modelname, texturecount);
+        for (curnode = ctx->materials.head; curnode != NULL; curnode = curnode->next)
         {
             int nspaces;
             n64Material* tex = (n64Material*)curnode->data;
-            int tindex = get_validtexindex(&list_materials, tex->name);
+            int tindex = get_validtexindex(&ctx->materials, tex->name);
             if (tindex != -1)
             {
                 fprintf(fp, "#define TEXTURE_%s ", tex->name);
@@ -1171,16 +1393,16 @@ void write_output_binary()
     }
 
     // Print the extern definitions
-    if (!global_opengl)
+    if (!ctx->settings.opengl)
     {
         fprintf(fp, "\n// Extern definitions\n");
-        fprintf(fp, "extern u8 _%sSegmentRomStart[];\n", global_modelname);
-        fprintf(fp, "extern u8 _%sSegmentRomEnd[];", global_modelname);
+        fprintf(fp, "extern u8 _%sSegmentRomStart[];\n", ctx->settings.modelname);
+        fprintf(fp, "extern u8 _%sSegmentRomEnd[];", ctx->settings.modelname);
     }
 
     // Done
     fclose(fp);
 
     // Finished writing the output
-    if (!global_quiet) printf("Wrote output to '%s.bin' and '%s.h'\n", global_outputname, global_outputname);
+    if (!ctx->settings.quiet) printf("Wrote output to '%s.bin' and '%s.h'\n", ctx->settings.outputname, ctx->settings.outputname);
 }
\ No newline at end of file
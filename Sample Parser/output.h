@@ -1,7 +1,7 @@
 #ifndef _SAUSN64_OUTPUT_H
 #define _SAUSN64_OUTPUT_H
 
-    extern void write_output_text();
-    extern void write_output_binary();
+    extern void write_output_text(arabikiContext* ctx);
+    extern void write_output_binary(arabikiContext* ctx);
     
 #endif
\ No newline at end of file
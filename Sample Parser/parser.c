@@ -24,48 +24,42 @@ generated exactly from Blender, that's not a big deal.
 #define STRBUFF_SIZE 512
 
 
-/*********************************
-             Globals
-*********************************/
-
-// Lexer state
-static lexState lexer_curstate = STATE_NONE;
-static lexState lexer_prevstate = STATE_NONE;
-
-
 /*==============================
     lexer_changestate
     Changes the current lexer state
+    @param The lexer to change the state of
     @param The new lexer state
 ==============================*/
 
-static inline void lexer_changestate(lexState state)
+static inline void lexer_changestate(lexContext* lexer, lexState state)
 {
-    lexer_prevstate = lexer_curstate;
-    lexer_curstate = state;
+    lexer->prevstate = lexer->curstate;
+    lexer->curstate = state;
 }
 
 
 /*==============================
     lexer_restorestate
     Restores the lexer state to its previous value
+    @param The lexer to restore the state of
 ==============================*/
 
-static inline void lexer_restorestate()
+static inline void lexer_restorestate(lexContext* lexer)
 {
-    if (lexer_curstate == lexer_prevstate)
-        lexer_prevstate = STATE_NONE;
-    lexer_curstate = lexer_prevstate;
+    if (lexer->curstate == lexer->prevstate)
+        lexer->prevstate = STATE_NONE;
+    lexer->curstate = lexer->prevstate;
 }
 
 
 /*==============================
     parse_sausage
     Parses a sausage64 model file
+    @param The conversion context
     @param The pointer to the .s64 file's handle
 ==============================*/
 
-void parse_sausage(FILE* fp)
+void parse_sausage(arabikiContext* ctx, FILE* fp)
 {
     int vertcount;
     listNode* curnode;
@@ -78,8 +72,9 @@ void parse_sausage(FILE* fp)
     s64Transform* curframedata;
     n64Material* curmat;
     Vector3D tempvec;
+    lexContext lexer = {STATE_NONE, STATE_NONE};
     
-    if (!global_quiet) printf("Parsing s64 model\n");
+    if (!ctx->settings.quiet) printf("Parsing s64 model\n");
     
     // Read the file until we reached the end
     while (!feof(fp))
@@ -89,7 +84,7 @@ void parse_sausage(FILE* fp)
         
         // Read a string from the text file
         if (fgets(strbuf, STRBUFF_SIZE, fp) == NULL && !feof(fp))
-            terminate("Error: Problem reading s64 file\n");
+            terminate(ctx, "Error: Problem reading s64 file\n");
         
         // Split the string by spaces
         strdata = strtok(strbuf, " ");
@@ -104,15 +99,15 @@ void parse_sausage(FILE* fp)
             // Handle C comment block starting
             if (strstr(strdata, "/*") != NULL)
             {
-                lexer_changestate(STATE_COMMENTBLOCK);
+                lexer_changestate(&lexer, STATE_COMMENTBLOCK);
                 break;
             }
                 
             // Handle C comment blocks
-            if (lexer_curstate == STATE_COMMENTBLOCK)
+            if (lexer.curstate == STATE_COMMENTBLOCK)
             {
                 if (strstr(strdata, "*/") != NULL)
-                    lexer_restorestate();
+                    lexer_restorestate(&lexer);
                 continue;
             }
             
@@ -121,58 +116,58 @@ void parse_sausage(FILE* fp)
             {
                 // Handle the next substring
                 strdata = strtok(NULL, " ");
-                switch (lexer_curstate)
+                switch (lexer.curstate)
                 {
                     case STATE_MESH:
                         strdata[strcspn(strdata, "\r\n")] = 0;
                         if (!strcmp(strdata, "VERTICES"))
-                            lexer_changestate(STATE_VERTICES);
+                            lexer_changestate(&lexer, STATE_VERTICES);
                         else if (!strcmp(strdata, "FACES"))
-                            lexer_changestate(STATE_FACES);
+                            lexer_changestate(&lexer, STATE_FACES);
                         break;
                     case STATE_ANIMATION:
                         if (!strcmp(strdata, "KEYFRAME"))
                         {
-                            lexer_changestate(STATE_KEYFRAME);
-                            curkeyframe = add_keyframe(curanim, atoi(strtok(NULL, " ")));
+                            lexer_changestate(&lexer, STATE_KEYFRAME);
+                            curkeyframe = add_keyframe(ctx, curanim, atoi(strtok(NULL, " ")));
                         }
                         break;
                     case STATE_NONE:
                         if (!strcmp(strdata, "MESH"))
                         {
-                            lexer_changestate(STATE_MESH);
+                            lexer_changestate(&lexer, STATE_MESH);
                             
                             // Get the mesh name and fix the trailing newline
                             strdata = strtok(NULL, " ");
                             strdata[strcspn(strdata, "\r\n")] = 0;
                             
                             // Create the mesh
-                            curmesh = add_mesh(strdata);
-                            if (!global_quiet) printf("    Created new mesh '%s'\n", strdata);
+                            curmesh = add_mesh(ctx, strdata);
+                            if (!ctx->settings.quiet) printf("    Created new mesh '%s'\n", strdata);
                         }
                         else if (!strcmp(strdata, "ANIMATION"))
                         {
-                            lexer_changestate(STATE_ANIMATION);
+                            lexer_changestate(&lexer, STATE_ANIMATION);
                             
                             // Get the animation name and fix the trailing newline
                             strdata = strtok(NULL, " ");
                             strdata[strcspn(strdata, "\r\n")] = 0;
                             
                             // Create the animation
-                            curanim = add_animation(strdata);
-                            if (!global_quiet) printf("    Created new animation '%s'\n", strdata);
+                            curanim = add_animation(ctx, strdata);
+                            if (!ctx->settings.quiet) printf("    Created new animation '%s'\n", strdata);
                         }
                         break;
                 }
             }
             else if (!strcmp(strdata, "END")) // Handle End
             {
-                lexer_restorestate();
+                lexer_restorestate(&lexer);
             }
             else // Handle the rest
             {
                 listNode* mmat = NULL;
-                switch (lexer_curstate)
+                switch (lexer.curstate)
                 {
                     case STATE_MESH:
                         if (!strcmp(strdata, "ROOT"))
@@ -201,7 +196,7 @@ void parse_sausage(FILE* fp)
                         }
                         break;
                     case STATE_VERTICES:
-                        curvert = add_vertex(curmesh);
+                        curvert = add_vertex(ctx, curmesh);
                         
                         // Set the vertex data
                         curvert->pos.x = atof(strdata);
@@ -217,12 +212,12 @@ void parse_sausage(FILE* fp)
                         curvert->UV.y = atof(strtok(NULL, " "));
                         break;
                     case STATE_FACES:
-                        curface = add_face(curmesh);
+                        curface = add_face(ctx, curmesh);
                         
                         // Set the face data
                         vertcount = atoi(strdata);
                         if (vertcount > 4)
-                            terminate("Error: This tool does not support faces with more than 4 vertices\n");
+                            terminate(ctx, "Error: This tool does not support faces with more than 4 vertices\n");
                         curface->verts[0] = find_vert(curmesh, atof(strtok(NULL, " ")));
                         curface->verts[1] = find_vert(curmesh, atof(strtok(NULL, " ")));
                         curface->verts[2] = find_vert(curmesh, atof(strtok(NULL, " ")));
@@ -232,7 +227,7 @@ void parse_sausage(FILE* fp)
                         if (vertcount == 4)
                         {
                             prevface = curface;
-                            curface = add_face(curmesh);
+                            curface = add_face(ctx, curmesh);
                             curface->verts[0] = prevface->verts[0];
                             curface->verts[1] = prevface->verts[2];
                             curface->verts[2] = find_vert(curmesh, atof(strtok(NULL, " ")));
@@ -241,9 +236,9 @@ void parse_sausage(FILE* fp)
                         // Get the material name and check if it exists already
                         strdata = strtok(NULL, " ");
                         strdata[strcspn(strdata, "\r\n")] = 0;
-                        curmat = find_material(strdata);
+                        curmat = find_material(ctx, strdata);
                         if (curmat == NULL && strcmp(strdata, "None") != 0)
-                            curmat = request_material(strdata);
+                            curmat = request_material(ctx, strdata);
                         curface->material = curmat;
                         
                         // Assign the face to the previous face as well, if we have a quad
@@ -263,8 +258,8 @@ void parse_sausage(FILE* fp)
                             list_append(&curmesh->materials, curmat);
                         break;
                     case STATE_KEYFRAME:
-                        curframedata = add_framedata(curkeyframe);
-                        curframedata->mesh = find_mesh(strdata);
+                        curframedata = add_framedata(ctx, curkeyframe);
+                        curframedata->mesh = find_mesh(ctx, strdata);
                         curframedata->translation.x = atof(strtok(NULL, " "));
                         curframedata->translation.y = atof(strtok(NULL, " "));
                         curframedata->translation.z = atof(strtok(NULL, " "));
@@ -282,12 +277,11 @@ void parse_sausage(FILE* fp)
         while ((strdata = strtok(NULL, " ")) != NULL);
     }
         
-    // Close the file as we're done with it
-    if (!global_quiet) printf("Finished parsing s64 model\n    Mesh count: %d\n    Animation count: %d\n    Material count: %d\n", list_meshes.size, list_animations.size, list_materials.size-1);
-    fclose(fp);
+    // State we're done with the file
+    if (!ctx->settings.quiet) printf("Finished parsing s64 model\n    Mesh count: %d\n    Animation count: %d\n    Material count: %d\n", ctx->meshes.size, ctx->animations.size, ctx->materials.size-1);
     
     // Sort the framedata by the order the meshes are in (Note: horrible time complexity as this is a bodge solution)
-    for (curnode = list_animations.head; curnode != NULL; curnode = curnode->next)
+    for (curnode = ctx->animations.head; curnode != NULL; curnode = curnode->next)
     {
         listNode* curkeyfnode;
         s64Anim* anim = (s64Anim*)curnode->data;
@@ -300,7 +294,7 @@ void parse_sausage(FILE* fp)
             s64Keyframe* keyf = (s64Keyframe*)curkeyfnode->data;
             
             // Go through each mesh
-            for (curmeshnode = list_meshes.head; curmeshnode != NULL; curmeshnode = curmeshnode->next)
+            for (curmeshnode = ctx->meshes.head; curmeshnode != NULL; curmeshnode = curmeshnode->next)
             {
                 listNode* curfdatanode;
                 s64Mesh* mesh = (s64Mesh*)curmeshnode->data;
@@ -323,7 +317,7 @@ void parse_sausage(FILE* fp)
     }
     
     // Iterate through the animations
-    for (curnode = list_animations.head; curnode != NULL; curnode = curnode->next)
+    for (curnode = ctx->animations.head; curnode != NULL; curnode = curnode->next)
     {
         int firstframe = -1;
         listNode* animnode;
@@ -343,12 +337,12 @@ void parse_sausage(FILE* fp)
     }    
 
     // Fix mesh and animation roots
-    if (global_fixroot)
+    if (ctx->settings.fixroot)
     {
         listNode* datanode;
         
         // Iterate through the meshes
-        for (datanode = list_meshes.head; datanode != NULL; datanode = datanode->next)
+        for (datanode = ctx->meshes.head; datanode != NULL; datanode = datanode->next)
         {
             listNode* vertnode;
             s64Mesh* mesh = (s64Mesh*)datanode->data;
@@ -364,7 +358,7 @@ void parse_sausage(FILE* fp)
         }
         
         // Iterate through the animations
-        for (datanode = list_animations.head; datanode != NULL; datanode = datanode->next)
+        for (datanode = ctx->animations.head; datanode != NULL; datanode = datanode->next)
         {
             listNode* animnode;
             s64Anim* anim = (s64Anim*)datanode->data;
@@ -387,6 +381,6 @@ void parse_sausage(FILE* fp)
                 }
             }
         }
-        if (!global_quiet) printf("Fixed model and animation roots\n");
+        if (!ctx->settings.quiet) printf("Fixed model and animation roots\n");
     }
 }
\ No newline at end of file
@@ -17,10 +17,21 @@
     } lexState;
     
     
+    /*********************************
+                 Structs
+    *********************************/
+    
+    // The current and previous lexer states
+    typedef struct {
+        lexState curstate;
+        lexState prevstate;
+    } lexContext;
+    
+    
     /*********************************
                 Functions
     *********************************/
 
-    extern void parse_sausage(FILE* fp);
+    extern void parse_sausage(arabikiContext* ctx, FILE* fp);
     
 #endif
\ No newline at end of file
@@ -5,10 +5,16 @@ This file handles the wxWidgets initialization.
 ***************************************************************/
 
 #include "app.h"
+#include "headless.h"
 #include "Resources/icon_play.h"
 #include "Resources/icon_program.h"
 
-wxIMPLEMENT_APP(App);
+// On Linux, the program can also run without a window, so it needs its own entrypoint
+#if defined(LINUX) && !defined(MACOS)
+    wxIMPLEMENT_APP_NO_MAIN(App);
+#else
+    wxIMPLEMENT_APP(App);
+#endif
 
 
 /*********************************
@@ -73,4 +79,23 @@ bool App::OnInit()
     this->m_frame1->Show();
     SetTopWindow(this->m_frame1);
     return true;
-}
\ No newline at end of file
+}
+
+
+#if defined(LINUX) && !defined(MACOS)
+/*==============================
+    main
+    Program entrypoint. Skips creating any windows if the
+    program was asked to run headless.
+    @param The number of arguments
+    @param The list of arguments
+    @returns The program's exit code
+==============================*/
+
+int main(int argc, char* argv[])
+{
+    if (IsHeadless(argc, argv))
+        return RunHeadless(argc, argv);
+    return wxEntry(argc, argv);
+}
+#endif
\ No newline at end of file
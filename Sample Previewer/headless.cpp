@@ -0,0 +1,516 @@
+/***************************************************************
+                          headless.cpp
+
+This file handles rendering models without a window, into an
+offscreen buffer. It's used for benchmarking the renderer and
+for generating image sequences on machines without a display.
+***************************************************************/
+
+#include "headless.h"
+
+#if defined(LINUX) && !defined(MACOS)
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <wx/wx.h>
+#include <wx/textfile.h>
+#include <wx/tokenzr.h>
+#include <wx/filename.h>
+#include <wx/dir.h>
+#include "main.h"
+#include "modelrenderer.h"
+
+
+/*********************************
+              Macros
+*********************************/
+
+#define DEFAULT_FRAMES   120
+#define DEFAULT_WIDTH    640
+#define DEFAULT_HEIGHT   480
+#define DEFAULT_ORBIT    360.0f
+#define DEFAULT_PITCH    20.0f
+
+// The field of view used by ModelRenderer::SetupView
+#define VIEW_FOV 60.0f
+
+
+/*********************************
+            Structures
+*********************************/
+
+typedef struct {
+    const char* model;
+    const char* materials;
+    const char* anim;
+    const char* output;
+    int frames;
+    int width;
+    int height;
+    float orbit;
+    float pitch;
+    float distance;
+} headlessOptions;
+
+typedef struct {
+    EGLDisplay display;
+    EGLSurface surface;
+    EGLContext context;
+} headlessContext;
+
+
+/*==============================
+    IsHeadless
+    Checks if the program was asked to run without a window
+    @param The number of arguments
+    @param The list of arguments
+    @returns Whether --headless was passed
+==============================*/
+
+bool IsHeadless(int argc, char* argv[])
+{
+    for (int i=1; i<argc; i++)
+        if (!strcmp(argv[i], "--headless"))
+            return true;
+    return false;
+}
+
+
+/*==============================
+    PrintUsage
+    Prints the headless mode's arguments
+==============================*/
+
+static void PrintUsage()
+{
+    printf("Usage: Chorizo --headless <Model.S64 or Model.bin> [Options]\n");
+    printf("Options:\n");
+    printf("    --materials <File>  Material definition file to apply\n");
+    printf("    --anim <Name>       Animation to play\n");
+    printf("    --frames <N>        Number of frames to render (default %d)\n", DEFAULT_FRAMES);
+    printf("    --size <W>x<H>      Size of the frames (default %dx%d)\n", DEFAULT_WIDTH, DEFAULT_HEIGHT);
+    printf("    --orbit <Degrees>   How far the camera orbits the model (default %.0f)\n", DEFAULT_ORBIT);
+    printf("    --pitch <Degrees>   Camera pitch (default %.0f)\n", DEFAULT_PITCH);
+    printf("    --distance <Units>  Camera distance (default fits the model)\n");
+    printf("    --output <Dir>      Save every frame as a PNG in the given folder\n");
+    printf("    --nogrid            Don't render the grid\n");
+    printf("    --yup               Treat the Y axis as up\n");
+    printf("    --crowd <N>         Render N copies of the model, each with a random animation\n");
+    printf("    --overlay <Cost>    Color binary models by vertloads, texloads, 1tri or dlbytes\n");
+}
+
+
+/*==============================
+    ParseOptions
+    Reads the headless mode's arguments
+    @param The number of arguments
+    @param The list of arguments
+    @param The options struct to fill
+    @returns Whether the arguments were valid
+==============================*/
+
+static bool ParseOptions(int argc, char* argv[], headlessOptions* opts)
+{
+    memset(opts, 0, sizeof(headlessOptions));
+    opts->frames = DEFAULT_FRAMES;
+    opts->width = DEFAULT_WIDTH;
+    opts->height = DEFAULT_HEIGHT;
+    opts->orbit = DEFAULT_ORBIT;
+    opts->pitch = DEFAULT_PITCH;
+    for (int i=1; i<argc; i++)
+    {
+        bool hasvalue = (i+1 < argc);
+        if (!strcmp(argv[i], "--headless") && hasvalue)
+            opts->model = argv[++i];
+        else if (!strcmp(argv[i], "--materials") && hasvalue)
+            opts->materials = argv[++i];
+        else if (!strcmp(argv[i], "--anim") && hasvalue)
+            opts->anim = argv[++i];
+        else if (!strcmp(argv[i], "--output") && hasvalue)
+            opts->output = argv[++i];
+        else if (!strcmp(argv[i], "--frames") && hasvalue)
+            opts->frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--size") && hasvalue)
+        {
+            if (sscanf(argv[++i], "%dx%d", &opts->width, &opts->height) != 2)
+                return false;
+        }
+        else if (!strcmp(argv[i], "--orbit") && hasvalue)
+            opts->orbit = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--pitch") && hasvalue)
+            opts->pitch = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--distance") && hasvalue)
+            opts->distance = (float)atof(argv[++i]);
+        else if (!strcmp(argv[i], "--nogrid"))
+            settings_showgrid = false;
+        else if (!strcmp(argv[i], "--yup"))
+            settings_yaxisup = true;
+        else if (!strcmp(argv[i], "--crowd") && hasvalue)
+            settings_crowdsize = strtoul(argv[++i], NULL, 10);
+        else if (!strcmp(argv[i], "--overlay") && hasvalue)
+        {
+            const char* overlays[] = {"none", "vertloads", "texloads", "1tri", "dlbytes"};
+            const char* overlay = argv[++i];
+            for (int j=0; j<(int)(sizeof(overlays)/sizeof(overlays[0])); j++)
+                if (!strcmp(overlay, overlays[j]))
+                    settings_costoverlay = (costOverlay)j;
+            if (settings_costoverlay == OVERLAY_NONE && strcmp(overlay, "none"))
+                return false;
+        }
+        else
+            return false;
+    }
+    return opts->model != NULL && opts->frames > 0 && opts->width > 0 && opts->height > 0;
+}
+
+
+/*==============================
+    CreateContext
+    Creates an OpenGL context that renders into an offscreen
+    buffer. Mesa's surfaceless platform is used when available,
+    as it doesn't need an X or Wayland display.
+    @param The context struct to fill
+    @param The width of the buffer
+    @param The height of the buffer
+    @returns Whether the context was created
+==============================*/
+
+static bool CreateContext(headlessContext* ctx, int width, int height)
+{
+    EGLConfig config;
+    EGLint configcount;
+    const EGLint configattribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_DEPTH_SIZE, 24,
+        EGL_NONE
+    };
+    const EGLint surfaceattribs[] = {
+        EGL_WIDTH, width,
+        EGL_HEIGHT, height,
+        EGL_NONE
+    };
+    const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    PFNEGLGETPLATFORMDISPLAYEXTPROC getplatformdisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    // Get the display
+    if (getplatformdisplay != NULL && extensions != NULL && strstr(extensions, "EGL_MESA_platform_surfaceless") != NULL)
+        ctx->display = getplatformdisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+    else
+        ctx->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (ctx->display == EGL_NO_DISPLAY || !eglInitialize(ctx->display, NULL, NULL))
+    {
+        fprintf(stderr, "Error: Unable to initialize EGL (0x%x)\n", eglGetError());
+        return false;
+    }
+
+    // Create the offscreen buffer and the context
+    if (!eglChooseConfig(ctx->display, configattribs, &config, 1, &configcount) || configcount == 0)
+    {
+        fprintf(stderr, "Error: No EGL config supports offscreen OpenGL rendering\n");
+        return false;
+    }
+    ctx->surface = eglCreatePbufferSurface(ctx->display, config, surfaceattribs);
+    if (ctx->surface == EGL_NO_SURFACE)
+    {
+        fprintf(stderr, "Error: Unable to create a %dx%d offscreen buffer (0x%x)\n", width, height, eglGetError());
+        return false;
+    }
+    eglBindAPI(EGL_OPENGL_API);
+    ctx->context = eglCreateContext(ctx->display, config, EGL_NO_CONTEXT, NULL);
+    if (ctx->context == EGL_NO_CONTEXT || !eglMakeCurrent(ctx->display, ctx->surface, ctx->surface, ctx->context))
+    {
+        fprintf(stderr, "Error: Unable to create an OpenGL context (0x%x)\n", eglGetError());
+        return false;
+    }
+    return true;
+}
+
+
+/*==============================
+    DestroyContext
+    Frees the offscreen OpenGL context
+    @param The context to free
+==============================*/
+
+static void DestroyContext(headlessContext* ctx)
+{
+    if (ctx->display == EGL_NO_DISPLAY)
+        return;
+    eglMakeCurrent(ctx->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (ctx->context != EGL_NO_CONTEXT)
+        eglDestroyContext(ctx->display, ctx->context);
+    if (ctx->surface != EGL_NO_SURFACE)
+        eglDestroySurface(ctx->display, ctx->surface);
+    eglTerminate(ctx->display);
+}
+
+
+/*==============================
+    LoadMaterials
+    Applies a material definition file to a model. Textures
+    are loaded from the definition file's folder.
+    @param The model to apply the materials to
+    @param The path of the material definition file
+    @returns Whether the file was read
+==============================*/
+
+static bool LoadMaterials(s64Model* mdl, wxString path)
+{
+    wxString line;
+    wxTextFile file;
+    if (!file.Open(path))
+        return false;
+    for (line = file.GetFirstLine(); !file.Eof(); line = file.GetNextLine())
+    {
+        wxStringTokenizer tkz = wxStringTokenizer(line, wxT(" "));
+        n64Material* mat = mdl->GetMaterialFromName(tkz.GetNextToken().ToStdString());
+        wxString token;
+        if (mat == NULL)
+            continue;
+
+        // Get the material type
+        token = tkz.GetNextToken();
+        if (token == "OMIT")
+        {
+            mat->CreateDefaultUnknown();
+            continue;
+        }
+        else if (token == "PRIMCOL")
+        {
+            unsigned long r, g, b;
+            mat->CreateDefaultPrimCol();
+            tkz.GetNextToken().ToULong(&r);
+            tkz.GetNextToken().ToULong(&g);
+            tkz.GetNextToken().ToULong(&b);
+            mat->GetPrimColorData()->r = (uint8_t)r;
+            mat->GetPrimColorData()->g = (uint8_t)g;
+            mat->GetPrimColorData()->b = (uint8_t)b;
+        }
+        else if (token == "TEXTURE")
+        {
+            wxDir dir;
+            wxString imgfilename;
+            unsigned long w, h;
+            bool cont;
+            tkz.GetNextToken().ToULong(&w);
+            tkz.GetNextToken().ToULong(&h);
+            mat->CreateDefaultTexture(w, h);
+
+            // See if an image of the texture is in the directory
+            dir.Open(wxFileName(path).GetPath());
+            cont = dir.GetFirst(&imgfilename, wxEmptyString, wxDIR_FILES);
+            while (cont)
+            {
+                if (imgfilename.ToStdString().find(mat->name) != std::string::npos)
+                {
+                    mat->SetImageFromFile((dir.GetName() + "/" + imgfilename).ToStdString());
+                    break;
+                }
+                cont = dir.GetNext(&imgfilename);
+            }
+        }
+
+        // Now go through each flag until the end
+        while (tkz.HasMoreTokens())
+            mat->SetFlag(tkz.GetNextToken().ToStdString());
+    }
+    file.Close();
+    return true;
+}
+
+
+/*==============================
+    SaveFrame
+    Saves the offscreen buffer as a PNG
+    @param The width of the buffer
+    @param The height of the buffer
+    @param The path to save the image to
+    @returns Whether the image was saved
+==============================*/
+
+static bool SaveFrame(int width, int height, wxString path)
+{
+    wxImage img(width, height, false);
+    std::vector<unsigned char> pixels(width*height*3);
+    unsigned char* dest = img.GetData();
+    const size_t rowsize = width*3;
+
+    // OpenGL's rows go from the bottom up, so flip them while copying
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, &pixels[0]);
+    for (int y=0; y<height; y++)
+        memcpy(dest + y*rowsize, &pixels[(height - 1 - y)*rowsize], rowsize);
+    return img.SaveFile(path, wxBITMAP_TYPE_PNG);
+}
+
+
+/*==============================
+    RenderFrames
+    Renders the requested frames and prints their timings
+    @param The options to render with
+    @param The model to render
+    @returns The program's exit code
+==============================*/
+
+static int RenderFrames(headlessOptions* opts, s64Model* mdl)
+{
+    ModelRenderer renderer;
+    std::vector<double> times;
+    glm::vec3 center;
+    double total = 0;
+    size_t drawcalls = 0, triangles = 0;
+    float radius = GetModelBounds(mdl, &center);
+    float distance = opts->distance;
+    float pitch = glm::radians(opts->pitch);
+
+    // In crowd mode, the camera needs to see every copy of the model
+    if (settings_crowdsize > 0)
+    {
+        renderer.BuildCrowd(mdl);
+        radius = renderer.GetCrowdRadius();
+    }
+
+    // Fit the model in the view if no distance was given
+    if (distance <= 0)
+        distance = std::max(radius/sinf(glm::radians(VIEW_FOV/2)), 100.0f)*1.1f;
+    renderer.InitializeOpenGL();
+    times.reserve(opts->frames);
+    for (int i=0; i<opts->frames; i++)
+    {
+        float yaw = glm::radians(opts->orbit*i/opts->frames);
+        glm::vec3 offset;
+        wxLongLong start;
+        double elapsed;
+        if (settings_yaxisup)
+            offset = glm::vec3(cosf(pitch)*cosf(yaw), sinf(pitch), cosf(pitch)*sinf(yaw));
+        else
+            offset = glm::vec3(cosf(pitch)*cosf(yaw), cosf(pitch)*sinf(yaw), sinf(pitch));
+
+        // Render the frame, waiting for the GPU to finish so the timing is meaningful
+        start = wxGetUTCTimeUSec();
+        renderer.SetCamera(center + offset*distance, -offset);
+        renderer.Render(mdl, opts->width, opts->height);
+        glFinish();
+        elapsed = (wxGetUTCTimeUSec() - start).ToDouble()/1000.0;
+        times.push_back(elapsed);
+        total += elapsed;
+        drawcalls = renderer.GetDrawCallCount();
+        triangles = renderer.GetTriangleCount();
+        printf("Frame %d: %.3fms, %zu draw calls, %zu triangles\n", i, elapsed, drawcalls, triangles);
+
+        // Save the frame if needed
+        if (opts->output != NULL)
+        {
+            wxString path = wxString::Format("%s/frame%04d.png", opts->output, i);
+            if (!SaveFrame(opts->width, opts->height, path))
+            {
+                fprintf(stderr, "Error: Unable to save '%s'\n", (const char*)path.mb_str());
+                return 1;
+            }
+        }
+
+        // Advance the animation as if the program was running at its usual framerate
+        renderer.AdvanceAnim(settings_playbackspeed);
+    }
+
+    // Print the summary
+    std::sort(times.begin(), times.end());
+    printf("\nRenderer: %s (%s)\n", (const char*)glGetString(GL_RENDERER), (const char*)glGetString(GL_VERSION));
+    printf("Rendered %d frames at %dx%d\n", opts->frames, opts->width, opts->height);
+    if (settings_crowdsize > 0)
+        printf("    Instances: %zu\n", settings_crowdsize);
+    printf("    Average: %.3fms (%.1f fps)\n", total/opts->frames, 1000.0*opts->frames/total);
+    printf("    Min:     %.3fms\n", times.front());
+    printf("    Max:     %.3fms\n", times.back());
+    printf("    95th:    %.3fms\n", times[std::min(times.size() - 1, (size_t)(times.size()*0.95))]);
+    printf("    Last frame: %zu draw calls, %zu triangles\n", drawcalls, triangles);
+    renderer.FreeRenderBuffers();
+    return 0;
+}
+
+
+/*==============================
+    RunHeadless
+    Loads a model and renders it into an offscreen buffer,
+    without creating any windows
+    @param The number of arguments
+    @param The list of arguments
+    @returns The program's exit code
+==============================*/
+
+int RunHeadless(int argc, char* argv[])
+{
+    headlessOptions opts;
+    headlessContext ctx = {EGL_NO_DISPLAY, EGL_NO_SURFACE, EGL_NO_CONTEXT};
+    s64Model* mdl;
+    wxLogNull nolog;
+    bool loaded;
+    int ret;
+    if (!ParseOptions(argc, argv, &opts))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    // There's no display to draw material previews on, so only initialize what's needed to decode images
+    wxInitAllImageHandlers();
+    material_previews = false;
+    if (!CreateContext(&ctx, opts.width, opts.height))
+    {
+        DestroyContext(&ctx);
+        return 1;
+    }
+
+    // Load the model
+    mdl = new s64Model();
+    if (wxFileName(opts.model).GetExt().IsSameAs("bin", false))
+        loaded = mdl->GenerateFromBinary(opts.model);
+    else
+        loaded = mdl->GenerateFromFile(opts.model);
+    if (!loaded)
+    {
+        fprintf(stderr, "Error: Unable to load model '%s'\n", opts.model);
+        delete mdl;
+        DestroyContext(&ctx);
+        return 1;
+    }
+    if (opts.materials != NULL && !LoadMaterials(mdl, opts.materials))
+        fprintf(stderr, "Warning: Unable to read material definitions '%s'\n", opts.materials);
+
+    // Select the animation
+    if (opts.anim != NULL)
+    {
+        for (std::vector<s64Anim>::iterator it = mdl->GetAnimList()->begin(); it != mdl->GetAnimList()->end(); ++it)
+        {
+            if (it->name == opts.anim)
+            {
+                highlighted_anim = &(*it);
+                highlighted_anim_length = it->GetLength();
+                highlighted_anim_tick = 0;
+                break;
+            }
+        }
+        if (highlighted_anim == NULL)
+            fprintf(stderr, "Warning: Animation '%s' not found\n", opts.anim);
+    }
+
+    // Render, then clean up
+    ret = RenderFrames(&opts, mdl);
+    highlighted_anim = NULL;
+    delete mdl;
+    DestroyContext(&ctx);
+    return ret;
+}
+
+#endif
\ No newline at end of file
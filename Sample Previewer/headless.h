@@ -0,0 +1,11 @@
+#pragma once
+
+typedef struct IUnknown IUnknown;
+
+
+/*********************************
+            Functions
+*********************************/
+
+bool IsHeadless(int argc, char* argv[]);
+int  RunHeadless(int argc, char* argv[]);
\ No newline at end of file
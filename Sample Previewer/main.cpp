@@ -1,7 +1,11 @@
 #include "main.h"
+#include <thread>
+#include <functional>
 #include <wx/textfile.h>
 #include <wx/tokenzr.h>
 #include <wx/dir.h>
+#include <wx/progdlg.h>
+#include <wx/filename.h>
 
 
 /*********************************
@@ -9,9 +13,22 @@
 *********************************/
 
 #define PROGRAM_FRAMERATE    60.0f
+#define PROGRAM_IDLERATE     10.0f
 #define ANIMATION_FRAMERATE  30.0f
 #define DEFAULT_PLAYBACK     (ANIMATION_FRAMERATE/PROGRAM_FRAMERATE)
 
+#define PROGRESS_RANGE       1000
+#define PROGRESS_INTERVAL    30
+
+#define RELOAD_DELAY         250
+
+#define CROWD_SIZES          {0, 16, 64, 256, 1024, 4096}
+
+#define BUDGET_INTERVAL      500
+#define BUDGET_MINCACHE      3
+#define BUDGET_MAXCACHE      64
+#define BUDGET_COLUMNS       {"Mesh", "DL Bytes", "Vertex Loads", "Texture Loads", "Triangles", "1Tri", "2Tri"}
+
 
 /*********************************
              Globals
@@ -26,6 +43,100 @@ bool settings_showhighlight    = true;
 bool settings_animating        = true;
 float settings_playbackspeed   = DEFAULT_PLAYBACK;
 bool settings_animatingreverse = false;
+bool settings_watchfiles       = true;
+size_t settings_crowdsize      = 0;
+costOverlay settings_costoverlay = OVERLAY_NONE;
+
+
+/*********************************
+        Background Loading
+*********************************/
+
+// A texture to decode on a worker thread
+typedef struct {
+    n64Material* mat;
+    std::string path;
+    matDecodedImage img;
+    bool decoded;
+} TextureJob;
+
+
+/*==============================
+    RunInBackground
+    Runs a task on worker threads while showing a progress
+    dialog, so that the window keeps responding
+    @param The parent window of the progress dialog
+    @param The title of the progress dialog
+    @param The task to run on each worker thread
+    @param The number of worker threads to start
+    @param A function that returns the progress, from 0 to PROGRESS_RANGE
+    @param The flag to raise if the user cancels the task
+    @returns Whether the task ran to completion without being cancelled
+==============================*/
+
+static bool RunInBackground(wxWindow* parent, wxString title, std::function<void()> task, unsigned int threads, std::function<int()> getprogress, std::atomic<bool>* cancel)
+{
+    std::atomic<unsigned int> running(threads);
+    std::vector<std::thread> workers;
+    wxProgressDialog dialog(title, "Please wait...", PROGRESS_RANGE, parent, wxPD_APP_MODAL | wxPD_CAN_ABORT | wxPD_AUTO_HIDE | wxPD_ELAPSED_TIME);
+
+    // Start the workers
+    for (unsigned int i=0; i<threads; i++)
+        workers.push_back(std::thread([&task, &running]{task(); running--;}));
+
+    // Keep the progress dialog updated until all the workers are done
+    while (running > 0)
+    {
+        int progress = getprogress();
+        if (!dialog.Update(std::max(0, std::min(progress, PROGRESS_RANGE - 1))) && !(*cancel))
+        {
+            *cancel = true;
+            dialog.Update(std::max(0, std::min(progress, PROGRESS_RANGE - 1)), "Cancelling...");
+        }
+        wxMilliSleep(PROGRESS_INTERVAL);
+    }
+    for (std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+        it->join();
+    return !(*cancel);
+}
+
+
+/*********************************
+          File Watching
+*********************************/
+
+/*==============================
+    WatchFile
+    Starts keeping track of a file that should be reloaded
+    when it changes
+    @param The struct to keep track of the file with
+    @param The path of the file
+==============================*/
+
+static void WatchFile(WatchedFile* file, wxString path)
+{
+    file->path = wxFileName(path).GetFullPath();
+    file->modified = wxFileExists(path) ? wxFileName(path).GetModificationTime() : wxDateTime();
+}
+
+
+/*==============================
+    WatchedFileChanged
+    Checks if a watched file was modified since it was last
+    loaded. Files that are missing, such as while they're being
+    saved, don't count as changed.
+    @param The watched file to check
+    @returns Whether the file changed
+==============================*/
+
+static bool WatchedFileChanged(WatchedFile* file)
+{
+    wxDateTime modified;
+    if (file->path.IsEmpty() || !wxFileExists(file->path))
+        return false;
+    modified = wxFileName(file->path).GetModificationTime();
+    return modified.IsValid() && (!file->modified.IsValid() || modified != file->modified);
+}
 
 
 /*********************************
@@ -40,6 +151,11 @@ bool settings_animatingreverse = false;
 Main::Main() : wxFrame(nullptr, wxID_ANY, PROGRAM_NAME, wxPoint(0, 0), wxSize(640, 480))
 {
     this->m_Sausage64Model = NULL;
+    this->m_Watcher = NULL;
+    this->m_ReloadPending = false;
+    this->m_Reloading = false;
+    this->m_BudgetWindow = NULL;
+    this->m_BudgetTime = 0;
     this->SetSizeHints(wxDefaultSize, wxDefaultSize);
 
     // Menu bar 'File'
@@ -53,6 +169,10 @@ Main::Main() : wxFrame(nullptr, wxID_ANY, PROGRAM_NAME, wxPoint(0, 0), wxSize(64
     this->m_Menu_File->AppendSeparator();
     this->m_MenuItem_FileMaterialExport = new wxMenuItem(this->m_Menu_File, wxID_ANY, wxString(wxT("Export Material Definition")) + wxT('\t') + wxT("Ctrl+E"), wxEmptyString, wxITEM_NORMAL);
     this->m_Menu_File->Append(this->m_MenuItem_FileMaterialExport);
+    this->m_Menu_File->AppendSeparator();
+    this->m_MenuItem_FileWatch = new wxMenuItem(this->m_Menu_File, wxID_ANY, wxString(wxT("Reload Changed Files")), wxEmptyString, wxITEM_CHECK);
+    this->m_Menu_File->Append(this->m_MenuItem_FileWatch);
+    this->m_MenuItem_FileWatch->Check(settings_watchfiles);
     this->m_MenuBar->Append(this->m_Menu_File, wxT("File"));
     this->m_MenuItem_FileMaterialImport->Enable(false);
     this->m_MenuItem_FileMaterialExport->Enable(false);
@@ -104,6 +224,34 @@ Main::Main() : wxFrame(nullptr, wxID_ANY, PROGRAM_NAME, wxPoint(0, 0), wxSize(64
     m_MenuItem_ViewHighlight = new wxMenuItem(this->m_Menu_View, wxID_ANY, wxString(wxT("Highlight Selected")), wxEmptyString, wxITEM_CHECK);
     this->m_Menu_View->Append(m_MenuItem_ViewHighlight);
     m_MenuItem_ViewHighlight->Check(settings_showhighlight);
+    m_Menu_View->AppendSeparator();
+    this->m_SubMenu_ViewCrowd = new wxMenu();
+    wxMenuItem* m_SubMenu_ViewCrowdItem = new wxMenuItem(this->m_Menu_View, wxID_ANY, wxT("Crowd"), wxEmptyString, wxITEM_NORMAL, this->m_SubMenu_ViewCrowd);
+    const size_t crowdsizes[] = CROWD_SIZES;
+    for (size_t i=0; i<sizeof(crowdsizes)/sizeof(crowdsizes[0]); i++)
+    {
+        wxString label = (crowdsizes[i] == 0) ? wxString(wxT("Off")) : wxString::Format("%zu", crowdsizes[i]);
+        wxMenuItem* item = new wxMenuItem(this->m_SubMenu_ViewCrowd, wxID_ANY, label, wxEmptyString, wxITEM_RADIO);
+        this->m_SubMenu_ViewCrowd->Append(item);
+        item->Check(crowdsizes[i] == settings_crowdsize);
+        this->m_MenuItem_ViewCrowd.push_back(item);
+    }
+    this->m_Menu_View->Append(m_SubMenu_ViewCrowdItem);
+    this->m_SubMenu_ViewCostOverlay = new wxMenu();
+    wxMenuItem* m_SubMenu_ViewCostOverlayItem = new wxMenuItem(this->m_Menu_View, wxID_ANY, wxT("Cost Overlay"), wxEmptyString, wxITEM_NORMAL, this->m_SubMenu_ViewCostOverlay);
+    const char* overlaynames[] = COSTOVERLAY_NAMES;
+    for (size_t i=0; i<sizeof(overlaynames)/sizeof(overlaynames[0]); i++)
+    {
+        wxMenuItem* item = new wxMenuItem(this->m_SubMenu_ViewCostOverlay, wxID_ANY, overlaynames[i], wxEmptyString, wxITEM_RADIO);
+        this->m_SubMenu_ViewCostOverlay->Append(item);
+        item->Check(i == (size_t)settings_costoverlay);
+        this->m_MenuItem_ViewCostOverlay.push_back(item);
+    }
+    this->m_Menu_View->Append(m_SubMenu_ViewCostOverlayItem);
+    m_Menu_View->AppendSeparator();
+    wxMenuItem* m_MenuItem_ViewBudget;
+    m_MenuItem_ViewBudget = new wxMenuItem(this->m_Menu_View, wxID_ANY, wxString(wxT("Display List Budget...")) + wxT('\t') + wxT("Ctrl+B"), wxEmptyString, wxITEM_NORMAL);
+    this->m_Menu_View->Append(m_MenuItem_ViewBudget);
     this->m_MenuBar->Append(this->m_Menu_View, wxT("View"));
 
     // Create the menu bar
@@ -297,11 +445,13 @@ Main::Main() : wxFrame(nullptr, wxID_ANY, PROGRAM_NAME, wxPoint(0, 0), wxSize(64
     this->m_Timer_MainLoop.SetOwner(this, wxID_ANY);
     this->m_Timer_MainLoop.Start(1000.0f/PROGRAM_FRAMERATE);
     this->Connect(wxID_ANY, wxEVT_TIMER, wxTimerEventHandler(Main::m_Timer_MainLoopOnTimer));
+    this->Connect(wxEVT_ACTIVATE, wxActivateEventHandler(Main::OnActivate));
 
     // Connect any other events
     this->m_Menu_File->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ImportOnMenuSelection), this, m_MenuItem_FileImport->GetId());
     this->m_Menu_File->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ImportMaterialOnMenuSelection), this, m_MenuItem_FileMaterialImport->GetId());
     this->m_Menu_File->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ExportMaterialOnMenuSelection), this, m_MenuItem_FileMaterialExport->GetId());
+    this->m_Menu_File->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_FileWatchOnMenuSelection), this, this->m_MenuItem_FileWatch->GetId());
     this->m_Menu_Animation->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_AnimationPlayToggleOnMenuSelection), this, this->m_MenuItem_AnimationPlayToggle->GetId());
     this->m_Menu_Animation->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_AnimationReverseOnMenuSelection), this, this->m_MenuItem_AnimationReverse->GetId());
     this->m_SubMenu_AnimationSpeed->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_AnimationFasterOnMenuSelection), this, this->m_MenuItem_AnimationFaster->GetId());
@@ -313,6 +463,11 @@ Main::Main() : wxFrame(nullptr, wxID_ANY, PROGRAM_NAME, wxPoint(0, 0), wxSize(64
     this->m_Menu_View->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ViewMeshRootsOnSelected), this, m_MenuItem_ViewMeshRoots->GetId());
     this->m_Menu_View->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ViewYUpOnSelected), this, m_MenuItem_ViewYUp->GetId());
     this->m_Menu_View->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ViewHighlightOnSelected), this, m_MenuItem_ViewHighlight->GetId());
+    for (std::vector<wxMenuItem*>::iterator it = this->m_MenuItem_ViewCrowd.begin(); it != this->m_MenuItem_ViewCrowd.end(); ++it)
+        this->m_SubMenu_ViewCrowd->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ViewCrowdOnSelected), this, (*it)->GetId());
+    for (std::vector<wxMenuItem*>::iterator it = this->m_MenuItem_ViewCostOverlay.begin(); it != this->m_MenuItem_ViewCostOverlay.end(); ++it)
+        this->m_SubMenu_ViewCostOverlay->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ViewCostOverlayOnSelected), this, (*it)->GetId());
+    this->m_Menu_View->Bind(wxEVT_COMMAND_MENU_SELECTED, wxCommandEventHandler(Main::m_MenuItem_ViewBudgetOnSelected), this, m_MenuItem_ViewBudget->GetId());
     this->m_CheckBox_Mesh_Billboard->Connect(wxEVT_COMMAND_CHECKBOX_CLICKED, wxCommandEventHandler(Main::m_CheckBox_Mesh_BillboardOnCheck), NULL, this);
     this->m_Radio_Image->Connect(wxEVT_COMMAND_RADIOBUTTON_SELECTED, wxCommandEventHandler(Main::m_Radio_MaterialTypeOnButton1), NULL, this);
     this->m_Radio_PrimColor->Connect(wxEVT_COMMAND_RADIOBUTTON_SELECTED, wxCommandEventHandler(Main::m_Radio_MaterialTypeOnButton2), NULL, this);
@@ -390,24 +545,83 @@ void Main::m_Splitter_VerticalOnIdle(wxIdleEvent& event)
 
 void Main::m_MenuItem_ImportOnMenuSelection(wxCommandEvent& event)
 {
-    s64Model* newmodel;
-    wxFileDialog file(this, _("Import S64 Model"), "", "", "Sausage64 model file (*.S64)|*.S64", wxFD_OPEN);
+    wxFileDialog file(this, _("Import S64 Model"), "", "", "Sausage64 model file (*.S64)|*.S64|Arabiki64 binary model (*.bin)|*.bin", wxFD_OPEN);
 
     // Ensure we didn't cancel the file opening dialog
     if (file.ShowModal() == wxID_CANCEL)
         return;
 
-    // Get our path and try to parse the model
-    wxFileName path = file.GetPath();
+    // Load the model
+    this->LoadModel(file.GetPath(), false);
+}
+
+
+/*==============================
+    Main::LoadModel
+    Parses a Sausage64 model on a worker thread and replaces the
+    loaded model with it. When reloading, the unchanged blocks and
+    the materials are taken from the loaded model, and the camera,
+    selection and animation time are kept. Binary models exported
+    by Arabiki64 take the loaded model's materials too, as they
+    only store the texture names.
+    @param The path of the .S64 or .bin file
+    @param Whether this is a reload of the loaded model
+    @returns Whether the model was loaded
+==============================*/
+
+bool Main::LoadModel(wxString path, bool reload)
+{
+    s64Model* newmodel;
+    wxFileName filename = path;
+    bool binary = filename.GetExt().IsSameAs("bin", false);
+    s64Model* previous = (reload || binary) ? this->m_Sausage64Model : NULL;
+    s64LoadProgress progress;
+    bool success = false;
+    size_t newmaterials = 0;
+    wxString selectedname, selectedparent;
+    std::string animname;
+    float animtick = highlighted_anim_tick;
+    std::string fullpath = filename.GetFullPath().ToStdString();
+
+    // Parse the model on a worker thread
     newmodel = new s64Model();
-    if (!newmodel->GenerateFromFile(path.GetFullPath().ToStdString()))
+    progress.read = 0;
+    progress.total = 0;
+    progress.cancel = false;
+    RunInBackground(this, (reload ? "Reloading " : "Importing ") + filename.GetFullName(),
+        [&]{success = binary ? newmodel->GenerateFromBinary(fullpath, &progress) : newmodel->GenerateFromFile(fullpath, &progress, previous);}, 1,
+        [&]{return (progress.total > 0) ? (int)(((double)progress.read)*PROGRESS_RANGE/progress.total) : 0;},
+        &progress.cancel
+    );
+    if (progress.cancel)
     {
-        wxMessageBox("Problem parsing Sausage64 Model.", "S64 Import error", wxOK | wxICON_EXCLAMATION, this);
         delete newmodel;
-        newmodel = NULL;
-        return;
+        return false;
+    }
+    if (!success)
+    {
+        // A reload can catch the file while it's still being written, so only complain on imports
+        if (!reload)
+            wxMessageBox("Problem parsing Sausage64 Model.", "S64 Import error", wxOK | wxICON_EXCLAMATION, this);
+        delete newmodel;
+        return false;
     }
 
+    // Remember what was selected, so that it can be selected again after a reload
+    if (reload)
+    {
+        wxTreeItemId selected = this->m_TreeCtrl_ModelData->GetSelection();
+        if (selected.IsOk() && this->m_TreeCtrl_ModelData->GetItemParent(selected).IsOk())
+        {
+            selectedname = this->m_TreeCtrl_ModelData->GetItemText(selected);
+            selectedparent = this->m_TreeCtrl_ModelData->GetItemText(this->m_TreeCtrl_ModelData->GetItemParent(selected));
+        }
+        if (highlighted_anim != NULL)
+            animname = highlighted_anim->name;
+    }
+    if (previous != NULL)
+        newmaterials = newmodel->AdoptMaterials(previous);
+
     // Replace our model pointer with the newly parsed model
     if (this->m_Sausage64Model != NULL)
     {
@@ -415,6 +629,7 @@ void Main::m_MenuItem_ImportOnMenuSelection(wxCommandEvent& event)
         delete this->m_Sausage64Model;
     }
     this->m_Sausage64Model = newmodel;
+    this->m_Model_Canvas->InvalidateRenderBuffers();
     this->m_MenuItem_FileMaterialImport->Enable(true);
     this->m_MenuItem_FileMaterialExport->Enable(true);
 
@@ -426,29 +641,115 @@ void Main::m_MenuItem_ImportOnMenuSelection(wxCommandEvent& event)
     this->m_Sizer_Bottom_Material->ShowItems(false);
     this->m_Sizer_Bottom_Animation->ShowItems(false);
 
+    // Keep track of the files that belong to this model
+    WatchFile(&this->m_ModelFile, filename.GetFullPath());
+    if (previous != NULL)
+    {
+        std::vector<n64Material*>* matlist = this->m_Sausage64Model->GetMaterialList();
+        for (std::map<n64Material*, WatchedFile>::iterator it = this->m_TextureFiles.begin(); it != this->m_TextureFiles.end();)
+        {
+            if (std::find(matlist->begin(), matlist->end(), it->first) == matlist->end())
+                this->m_TextureFiles.erase(it++);
+            else
+                ++it;
+        }
+    }
+    else
+    {
+        this->m_MaterialFile.path.Clear();
+        this->m_TextureFiles.clear();
+    }
+
     // Generate the tree list
-    wxTreeItemId MDLData = this->m_TreeCtrl_ModelData->AddRoot(path.GetFullName());
+    this->BuildModelTree();
+
+    // Restore the selection and the animation
+    if (reload)
+    {
+        wxTreeItemId item = this->FindTreeItem(selectedparent, selectedname);
+        if (item.IsOk())
+            this->m_TreeCtrl_ModelData->SelectItem(item);
+        if (!animname.empty())
+        {
+            std::vector<s64Anim>* animlist = this->m_Sausage64Model->GetAnimList();
+            for (std::vector<s64Anim>::iterator it = animlist->begin(); it != animlist->end(); ++it)
+            {
+                if (it->name == animname)
+                {
+                    highlighted_anim = &(*it);
+                    highlighted_anim_length = it->GetLength();
+                    highlighted_anim_tick = std::min(animtick, (float)highlighted_anim_length);
+                    this->m_Slider_Animation->SetMax(highlighted_anim_length);
+                    this->m_Slider_Animation->SetValue(highlighted_anim_tick);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Materials that are new to the model still need their definitions
+    if (newmaterials > 0 && !this->m_MaterialFile.path.IsEmpty())
+        this->LoadMaterials(this->m_MaterialFile.path, true);
+    this->UpdateFileWatches();
+    return true;
+}
+
+
+/*==============================
+    Main::BuildModelTree
+    Fills the tree control with the contents of the loaded model
+==============================*/
+
+void Main::BuildModelTree()
+{
+    wxTreeItemId MDLData = this->m_TreeCtrl_ModelData->AddRoot(wxFileName(this->m_ModelFile.path).GetFullName());
     if (this->m_Sausage64Model->GetMeshCount() > 0)
     {
-        std::list<s64Mesh*>* meshlist = this->m_Sausage64Model->GetMeshList();
+        std::vector<s64Mesh>* meshlist = this->m_Sausage64Model->GetMeshList();
         wxTreeItemId treenode = this->m_TreeCtrl_ModelData->AppendItem(MDLData, "Meshes");
-        for (std::list<s64Mesh*>::iterator it = meshlist->begin(); it != meshlist->end(); ++it)
-            this->m_TreeCtrl_ModelData->AppendItem(treenode, (*it)->name);
+        for (std::vector<s64Mesh>::iterator it = meshlist->begin(); it != meshlist->end(); ++it)
+            this->m_TreeCtrl_ModelData->AppendItem(treenode, it->name);
     }
     if (this->m_Sausage64Model->GetMaterialCount() > 0)
     {
-        std::list<n64Material*>* matlist = this->m_Sausage64Model->GetMaterialList();
+        std::vector<n64Material*>* matlist = this->m_Sausage64Model->GetMaterialList();
         wxTreeItemId treenode = this->m_TreeCtrl_ModelData->AppendItem(MDLData, "Materials");
-        for (std::list<n64Material*>::iterator it = matlist->begin(); it != matlist->end(); ++it)
+        for (std::vector<n64Material*>::iterator it = matlist->begin(); it != matlist->end(); ++it)
             this->m_TreeCtrl_ModelData->AppendItem(treenode, (*it)->name);
     }
     if (this->m_Sausage64Model->GetAnimCount() > 0)
     {
-        std::list<s64Anim*>* animlist = this->m_Sausage64Model->GetAnimList();
+        std::vector<s64Anim>* animlist = this->m_Sausage64Model->GetAnimList();
         wxTreeItemId treenode = this->m_TreeCtrl_ModelData->AppendItem(MDLData, "Animations");
-        for (std::list<s64Anim*>::iterator it = animlist->begin(); it != animlist->end(); ++it)
-            this->m_TreeCtrl_ModelData->AppendItem(treenode, (*it)->name);
+        for (std::vector<s64Anim>::iterator it = animlist->begin(); it != animlist->end(); ++it)
+            this->m_TreeCtrl_ModelData->AppendItem(treenode, it->name);
+    }
+}
+
+
+/*==============================
+    Main::FindTreeItem
+    Finds an item in the tree control
+    @param The name of the item's parent node
+    @param The name of the item
+    @returns The tree item, or an invalid item if it wasn't found
+==============================*/
+
+wxTreeItemId Main::FindTreeItem(wxString parentname, wxString name)
+{
+    wxTreeItemIdValue nodecookie, itemcookie;
+    wxTreeItemId root = this->m_TreeCtrl_ModelData->GetRootItem();
+    if (!root.IsOk())
+        return wxTreeItemId();
+    for (wxTreeItemId node = this->m_TreeCtrl_ModelData->GetFirstChild(root, nodecookie); node.IsOk(); node = this->m_TreeCtrl_ModelData->GetNextChild(root, nodecookie))
+    {
+        if (this->m_TreeCtrl_ModelData->GetItemText(node) != parentname)
+            continue;
+        for (wxTreeItemId item = this->m_TreeCtrl_ModelData->GetFirstChild(node, itemcookie); item.IsOk(); item = this->m_TreeCtrl_ModelData->GetNextChild(node, itemcookie))
+            if (this->m_TreeCtrl_ModelData->GetItemText(item) == name)
+                return item;
     }
+    return wxTreeItemId();
 }
 
 
@@ -460,16 +761,39 @@ void Main::m_MenuItem_ImportOnMenuSelection(wxCommandEvent& event)
 
 void Main::m_MenuItem_ImportMaterialOnMenuSelection(wxCommandEvent& event)
 {
-    wxString line;
-    wxTextFile file;
     wxFileDialog dialog(this, _("Import Material Definition"), "", "", "Material definition file (*.txt)|*.txt", wxFD_OPEN);
 
     // Ensure we didn't cancel the file opening dialog
     if (dialog.ShowModal() == wxID_CANCEL)
         return;
 
+    // Load the material definitions
+    this->LoadMaterials(dialog.GetPath(), false);
+}
+
+
+/*==============================
+    Main::LoadMaterials
+    Applies a material definition file to the loaded model. When
+    reloading, textures whose image file didn't change are kept
+    instead of being decoded and uploaded again.
+    @param The path of the material definition file
+    @param Whether this is a reload of the loaded definitions
+    @returns Whether the file was read
+==============================*/
+
+bool Main::LoadMaterials(wxString path, bool reload)
+{
+    wxString line;
+    wxTextFile file;
+    std::vector<TextureJob> jobs;
+    std::atomic<size_t> nextjob(0);
+    std::atomic<size_t> jobsdone(0);
+    std::atomic<bool> cancel(false);
+
     // Read the file
-    file.Open(dialog.GetPath());
+    if (!file.Open(path))
+        return false;
     line = file.GetFirstLine();
     while (!file.Eof())
     {
@@ -489,6 +813,8 @@ void Main::m_MenuItem_ImportMaterialOnMenuSelection(wxCommandEvent& event)
         if (token == "OMIT")
         {
             mat->CreateDefaultUnknown();
+            mat->ResetFlags();
+            this->m_TextureFiles.erase(mat);
             line = file.GetNextLine();
             continue;
         }
@@ -496,6 +822,8 @@ void Main::m_MenuItem_ImportMaterialOnMenuSelection(wxCommandEvent& event)
         {
             unsigned long r, g, b;
             mat->CreateDefaultPrimCol();
+            mat->ResetFlags();
+            this->m_TextureFiles.erase(mat);
             tkz.GetNextToken().ToULong(&r);
             tkz.GetNextToken().ToULong(&g);
             tkz.GetNextToken().ToULong(&b);
@@ -507,24 +835,50 @@ void Main::m_MenuItem_ImportMaterialOnMenuSelection(wxCommandEvent& event)
         {
             wxDir dir;
             wxString imgfilename;
+            wxString imgpath;
             bool cont;
             unsigned long w, h;
+            std::map<n64Material*, WatchedFile>::iterator itfile = this->m_TextureFiles.find(mat);
             tkz.GetNextToken().ToULong(&w);
             tkz.GetNextToken().ToULong(&h);
-            mat->CreateDefaultTexture(w, h);
 
-            // See if an image of the texture is in the directory, and if so, load it automatically
-            dir.Open(dialog.GetDirectory());
+            // See if an image of the texture is in the directory
+            dir.Open(wxFileName(path).GetPath());
             cont = dir.GetFirst(&imgfilename, wxEmptyString, wxDIR_FILES);
             while (cont)
             {
                 if (imgfilename.ToStdString().find(mat->name) != std::string::npos)
                 {
-                    mat->SetImageFromFile((dir.GetName() + "/" + imgfilename).ToStdString());
+                    imgpath = dir.GetName() + "/" + imgfilename;
                     break;
                 }
                 cont = dir.GetNext(&imgfilename);
             }
+
+            // Keep the texture if its image didn't change since it was loaded, otherwise queue the image to be loaded
+            if (reload && mat->type == TYPE_TEXTURE && !imgpath.IsEmpty() && itfile != this->m_TextureFiles.end() && wxFileName(itfile->second.path).SameAs(imgpath) && !WatchedFileChanged(&itfile->second))
+            {
+                matImage* tex = mat->GetTextureData();
+                std::string texfilter = mat->texfilter, texmodes = tex->texmodes, texmodet = tex->texmodet;
+                mat->ResetFlags();
+                while (tkz.HasMoreTokens())
+                    mat->SetFlag(tkz.GetNextToken().ToStdString());
+                if (texfilter != mat->texfilter || texmodes != tex->texmodes || texmodet != tex->texmodet)
+                    mat->RegenerateTexture();
+                line = file.GetNextLine();
+                continue;
+            }
+            mat->CreateDefaultTexture(w, h);
+            mat->ResetFlags();
+            this->m_TextureFiles.erase(mat);
+            if (!imgpath.IsEmpty())
+            {
+                TextureJob job;
+                job.mat = mat;
+                job.path = imgpath.ToStdString();
+                job.decoded = false;
+                jobs.push_back(job);
+            }
         }
 
         // Now go through each flag until the end
@@ -537,27 +891,39 @@ void Main::m_MenuItem_ImportMaterialOnMenuSelection(wxCommandEvent& event)
 
     // Close the file, we're done with it
     file.Close();
+    WatchFile(&this->m_MaterialFile, path);
 
-    // Refresh the bottom panel
-    if (highlighted_material != NULL)
+    // Decode the textures on worker threads, then upload them here, as this is the OpenGL thread
+    if (jobs.size() > 0)
     {
-        switch (highlighted_material->type)
+        unsigned int threads = std::max(1u, std::min(std::thread::hardware_concurrency(), (unsigned int)jobs.size()));
+        RunInBackground(this, "Loading textures",
+            [&]{
+                size_t i;
+                while (!cancel && (i = nextjob++) < jobs.size())
+                {
+                    jobs[i].decoded = n64Material::DecodeImageFile(jobs[i].path, &jobs[i].img);
+                    jobsdone++;
+                }
+            }, threads,
+            [&]{return (int)(jobsdone*PROGRESS_RANGE/jobs.size());},
+            &cancel
+        );
+        for (std::vector<TextureJob>::iterator it = jobs.begin(); it != jobs.end(); ++it)
         {
-            case TYPE_PRIMCOL:
-                this->m_Radio_PrimColor->SetValue(true);
-                this->m_Sizer_Bottom_Texture_Setup->Show(false);
-                this->m_Sizer_Bottom_PrimCol_Setup->Show(true);
-                this->RefreshPrimColPanel();
-                break;
-            case TYPE_TEXTURE:
-                this->m_Radio_Image->SetValue(true);
-                this->m_Sizer_Bottom_Texture_Setup->Show(true);
-                this->m_Sizer_Bottom_PrimCol_Setup->Show(false);
-                this->RefreshTextureImage();
-                break;
-            default: break;
+            if (it->decoded && it->mat->type == TYPE_TEXTURE)
+            {
+                it->mat->SetImageFromDecoded(&it->img);
+                WatchFile(&this->m_TextureFiles[it->mat], it->path);
+            }
         }
     }
+
+    // Refresh the bottom panel
+    this->RefreshMaterialPanel();
+    this->UpdateFileWatches();
+    this->m_Model_Canvas->RequestRedraw();
+    return true;
 }
 
 
@@ -580,79 +946,96 @@ void Main::m_MenuItem_ExportMaterialOnMenuSelection(wxCommandEvent& event)
     wxFile file;
     file.Create(fileDialogue.GetPath(), true);
     file.Open(fileDialogue.GetPath(), wxFile::write);
+    file.Write(this->GetMaterialDefinitions());
+
+    // Finished writing the file
+    file.Close();
+}
+
+
+/*==============================
+    Main::GetMaterialDefinitions
+    Generates the material definitions of the loaded model, in
+    the format that Arabiki64 reads
+    @returns The material definitions text
+==============================*/
+
+wxString Main::GetMaterialDefinitions()
+{
+    wxString defs;
 
     // Iterate through each material
-    std::list<n64Material*>* matlist = this->m_Sausage64Model->GetMaterialList();
-    for (std::list<n64Material*>::iterator it = matlist->begin(); it != matlist->end(); ++it)
+    std::vector<n64Material*>* matlist = this->m_Sausage64Model->GetMaterialList();
+    for (std::vector<n64Material*>::iterator it = matlist->begin(); it != matlist->end(); ++it)
     {
         n64Material* mat = *it;
 
         // Write the name and texture type
-        file.Write(mat->name);
+        defs += mat->name;
         switch (mat->type)
         {
             case TYPE_TEXTURE:
-                file.Write(" TEXTURE");
-                file.Write(wxString::Format(wxT(" %zu %zu"), mat->GetTextureData()->w, mat->GetTextureData()->h));
+                defs += " TEXTURE";
+                defs += wxString::Format(wxT(" %zu %zu"), mat->GetTextureData()->w, mat->GetTextureData()->h);
                 if (mat->GetTextureData()->coltype != DEFAULT_IMAGEFORMAT)
-                    file.Write(" " + mat->GetTextureData()->coltype);
+                    defs += " " + mat->GetTextureData()->coltype;
                 if (mat->GetTextureData()->colsize != DEFAULT_IMAGESIZE)
-                    file.Write(" " + mat->GetTextureData()->colsize);
+                    defs += " " + mat->GetTextureData()->colsize;
                 if (mat->GetTextureData()->texmodes != DEFAULT_TEXFLAGS)
-                    file.Write(" " + mat->GetTextureData()->texmodes);
+                    defs += " " + mat->GetTextureData()->texmodes;
                 if (mat->GetTextureData()->texmodet != DEFAULT_TEXFLAGT)
-                    file.Write(" " + mat->GetTextureData()->texmodet);
+                    defs += " " + mat->GetTextureData()->texmodet;
                 break;
             case TYPE_PRIMCOL:
-                file.Write(" PRIMCOL");
-                file.Write(wxString::Format(wxT(" %d %d %d"), mat->GetPrimColorData()->r, mat->GetPrimColorData()->g, mat->GetPrimColorData()->b));
+                defs += " PRIMCOL";
+                defs += wxString::Format(wxT(" %d %d %d"), mat->GetPrimColorData()->r, mat->GetPrimColorData()->g, mat->GetPrimColorData()->b);
                 break;
             case TYPE_UNKNOWN:
-                file.Write(" OMIT\r\n");
+                defs += " OMIT\r\n";
                 continue;
         }
 
         // Handle loading flags
         if (mat->dontload)
-            file.Write(" DONTLOAD");
+            defs += " DONTLOAD";
         if (mat->loadfirst)
-            file.Write(" LOADFIRST");
+            defs += " LOADFIRST";
 
         // Handle cycle mode
         if (mat->cycle != DEFAULT_CYCLE)
-            file.Write(" " + mat->cycle);
+            defs += " " + mat->cycle;
 
         // Handle combine modes
         switch (mat->type)
         {
             case TYPE_TEXTURE:
                 if (mat->texfilter != DEFAULT_TEXFILTER)
-                    file.Write(" " + mat->texfilter);
+                    defs += " " + mat->texfilter;
                 if (mat->combinemode1 != DEFAULT_COMBINE1_TEX)
-                    file.Write(" " + mat->combinemode1);
+                    defs += " " + mat->combinemode1;
                 if (mat->cycle == "G_CYC_2CYCLE" && mat->combinemode2 != DEFAULT_COMBINE2_TEX)
-                    file.Write(" " + mat->combinemode2);
+                    defs += " " + mat->combinemode2;
                 else if (mat->cycle == "G_CYC_1CYCLE" && mat->combinemode1 != DEFAULT_COMBINE1_TEX)
-                    file.Write(" " + mat->combinemode1);
+                    defs += " " + mat->combinemode1;
                 break;
             case TYPE_PRIMCOL:
                 if (mat->combinemode1 != DEFAULT_COMBINE1_PRIM)
-                    file.Write(" " + mat->combinemode1);
+                    defs += " " + mat->combinemode1;
                 if (mat->cycle == "G_CYC_2CYCLE" && mat->combinemode2 != DEFAULT_COMBINE2_PRIM)
-                    file.Write(" " + mat->combinemode2);
+                    defs += " " + mat->combinemode2;
                 else if (mat->cycle == "G_CYC_1CYCLE" && mat->combinemode1 != DEFAULT_COMBINE1_PRIM)
-                    file.Write(" " + mat->combinemode1);
+                    defs += " " + mat->combinemode1;
                 break;
             default: break;
         }
 
         // Handle render modes
         if (mat->rendermode1 != DEFAULT_RENDERMODE1)
-            file.Write(" " + mat->rendermode1);
+            defs += " " + mat->rendermode1;
         if (mat->cycle == "G_CYC_2CYCLE" && mat->rendermode2 != DEFAULT_RENDERMODE2)
-            file.Write(" " + mat->rendermode2);
+            defs += " " + mat->rendermode2;
         else if (mat->cycle == "G_CYC_1CYCLE" && mat->rendermode1 != DEFAULT_RENDERMODE1)
-            file.Write(" " + mat->rendermode1 + "2");
+            defs += " " + mat->rendermode1 + "2";
 
         // Write the geometry flags that are new from the defaults
         std::string defaultgeo[] = DEFAULT_GEOFLAGS;
@@ -675,7 +1058,7 @@ void Main::m_MenuItem_ExportMaterialOnMenuSelection(wxCommandEvent& event)
                 continue;
 
             // Write the flag
-            file.Write(" " + flag);
+            defs += " " + flag;
         }
 
         // Finally, negate default flags which aren't present
@@ -694,13 +1077,189 @@ void Main::m_MenuItem_ExportMaterialOnMenuSelection(wxCommandEvent& event)
 
             // Write the negated flag
             if (!hasflag)
-                file.Write(" !" + defaultgeo[i]);
+                defs += " !" + defaultgeo[i];
         }
-        file.Write("\r\n");
+        defs += "\r\n";
     }
 
-    // Finished writing the file
-    file.Close();
+    return defs;
+}
+
+
+/*==============================
+    Main::m_MenuItem_FileWatchOnMenuSelection
+    Handles clicking on the Reload Changed Files menu option
+    @param The wxWidgets command event
+==============================*/
+
+void Main::m_MenuItem_FileWatchOnMenuSelection(wxCommandEvent& event)
+{
+    settings_watchfiles = event.IsChecked();
+
+    // Catch up with anything that changed while we weren't watching
+    if (settings_watchfiles)
+    {
+        this->m_ReloadPending = true;
+        this->m_ReloadTime = wxGetLocalTimeMillis();
+    }
+}
+
+
+/*==============================
+    Main::OnFileSystemChanged
+    Handles a change to a file in one of the watched directories
+    @param The wxWidgets file system watcher event
+==============================*/
+
+void Main::OnFileSystemChanged(wxFileSystemWatcherEvent& event)
+{
+    wxFileName path = (event.GetChangeType() == wxFSW_EVENT_RENAME) ? event.GetNewPath() : event.GetPath();
+    bool watched = path.SameAs(this->m_ModelFile.path) || path.SameAs(this->m_MaterialFile.path);
+    if (!settings_watchfiles || this->m_Sausage64Model == NULL)
+        return;
+
+    // Ignore files that aren't part of the loaded model
+    for (std::map<n64Material*, WatchedFile>::iterator it = this->m_TextureFiles.begin(); it != this->m_TextureFiles.end() && !watched; ++it)
+        watched = path.SameAs(it->second.path);
+    if (!watched)
+        return;
+
+    // Exporters write files in multiple steps, so wait for the changes to settle before reloading
+    this->m_ReloadPending = true;
+    this->m_ReloadTime = wxGetLocalTimeMillis() + RELOAD_DELAY;
+}
+
+
+/*==============================
+    Main::ReloadChangedFiles
+    Reloads every watched file that was modified since it was
+    last loaded
+==============================*/
+
+void Main::ReloadChangedFiles()
+{
+    this->m_ReloadPending = false;
+    if (this->m_Sausage64Model == NULL)
+        return;
+    this->m_Reloading = true;
+    if (WatchedFileChanged(&this->m_ModelFile))
+        this->LoadModel(this->m_ModelFile.path, true);
+    if (WatchedFileChanged(&this->m_MaterialFile))
+        this->LoadMaterials(this->m_MaterialFile.path, true);
+    this->ReloadTextures();
+    this->m_Reloading = false;
+}
+
+
+/*==============================
+    Main::ReloadTextures
+    Decodes and uploads the textures whose image files were
+    modified since they were last loaded
+==============================*/
+
+void Main::ReloadTextures()
+{
+    std::vector<TextureJob> jobs;
+    std::atomic<size_t> nextjob(0);
+    std::atomic<size_t> jobsdone(0);
+    std::atomic<bool> cancel(false);
+    for (std::map<n64Material*, WatchedFile>::iterator it = this->m_TextureFiles.begin(); it != this->m_TextureFiles.end(); ++it)
+    {
+        if (it->first->type == TYPE_TEXTURE && WatchedFileChanged(&it->second))
+        {
+            TextureJob job;
+            job.mat = it->first;
+            job.path = it->second.path.ToStdString();
+            job.decoded = false;
+            jobs.push_back(job);
+        }
+    }
+    if (jobs.size() == 0)
+        return;
+
+    // Decode the textures on worker threads, then upload them here, as this is the OpenGL thread
+    RunInBackground(this, "Reloading textures",
+        [&]{
+            size_t i;
+            while (!cancel && (i = nextjob++) < jobs.size())
+            {
+                jobs[i].decoded = n64Material::DecodeImageFile(jobs[i].path, &jobs[i].img);
+                jobsdone++;
+            }
+        }, std::max(1u, std::min(std::thread::hardware_concurrency(), (unsigned int)jobs.size())),
+        [&]{return (int)(jobsdone*PROGRESS_RANGE/jobs.size());},
+        &cancel
+    );
+    for (std::vector<TextureJob>::iterator it = jobs.begin(); it != jobs.end(); ++it)
+    {
+        if (it->decoded)
+        {
+            it->mat->SetImageFromDecoded(&it->img);
+            WatchFile(&this->m_TextureFiles[it->mat], it->path);
+        }
+    }
+    this->RefreshMaterialPanel();
+    this->m_Model_Canvas->RequestRedraw();
+}
+
+
+/*==============================
+    Main::UpdateFileWatches
+    Watches the directories of the model, its material definitions
+    and its textures, so that they can be reloaded when they change.
+    Directories are watched instead of the files themselves, as many
+    programs save by replacing the file.
+==============================*/
+
+void Main::UpdateFileWatches()
+{
+    std::list<wxString> dirs;
+
+    // The watcher needs the event loop to be running, so it is only created once something gets loaded
+    if (this->m_Watcher == NULL)
+    {
+        this->m_Watcher = new wxFileSystemWatcher();
+        this->m_Watcher->SetOwner(this);
+        this->Connect(wxEVT_FSWATCHER, wxFileSystemWatcherEventHandler(Main::OnFileSystemChanged));
+    }
+
+    // Collect the directories to watch
+    if (!this->m_ModelFile.path.IsEmpty())
+        dirs.push_back(wxFileName(this->m_ModelFile.path).GetPath());
+    if (!this->m_MaterialFile.path.IsEmpty())
+        dirs.push_back(wxFileName(this->m_MaterialFile.path).GetPath());
+    for (std::map<n64Material*, WatchedFile>::iterator it = this->m_TextureFiles.begin(); it != this->m_TextureFiles.end(); ++it)
+        dirs.push_back(wxFileName(it->second.path).GetPath());
+    dirs.sort();
+    dirs.unique();
+
+    // Watch them
+    this->m_Watcher->RemoveAll();
+    for (std::list<wxString>::iterator it = dirs.begin(); it != dirs.end(); ++it)
+        this->m_Watcher->Add(wxFileName::DirName(*it), wxFSW_EVENT_CREATE | wxFSW_EVENT_RENAME | wxFSW_EVENT_MODIFY);
+}
+
+
+/*==============================
+    Main::UpdateBudgetWindow
+    Passes the model and its material definitions to the budget
+    window, which converts them again if they changed
+==============================*/
+
+void Main::UpdateBudgetWindow()
+{
+    wxLongLong curtime = wxGetLocalTimeMillis();
+
+    // Generating the material definitions every frame would be wasteful, so only check for changes every so often
+    if (curtime >= this->m_BudgetTime)
+    {
+        if (this->m_Sausage64Model == NULL)
+            this->m_BudgetWindow->SetSource(wxEmptyString, wxEmptyString);
+        else
+            this->m_BudgetWindow->SetSource(this->m_ModelFile.path, this->GetMaterialDefinitions());
+        this->m_BudgetTime = curtime + BUDGET_INTERVAL;
+    }
+    this->m_BudgetWindow->PollConversion();
 }
 
 
@@ -721,10 +1280,10 @@ void Main::m_TreeCtrl_ModelDataOnTreeSelChanged(wxTreeEvent& event)
     wxString parentname = this->m_TreeCtrl_ModelData->GetItemText(parent);
     if (parentname == "Meshes")
     {
-        std::list<s64Mesh*>* meshlist = this->m_Sausage64Model->GetMeshList();
-        for (std::list<s64Mesh*>::iterator it = meshlist->begin(); it != meshlist->end(); ++it)
+        std::vector<s64Mesh>* meshlist = this->m_Sausage64Model->GetMeshList();
+        for (std::vector<s64Mesh>::iterator it = meshlist->begin(); it != meshlist->end(); ++it)
         {
-            s64Mesh* mesh = *it;
+            s64Mesh* mesh = &(*it);
             if (name == mesh->name)
             {
                 highlighted_mesh = mesh;
@@ -740,8 +1299,8 @@ void Main::m_TreeCtrl_ModelDataOnTreeSelChanged(wxTreeEvent& event)
     }
     else if (parentname == "Materials")
     {
-        std::list<n64Material*>* materiallist = this->m_Sausage64Model->GetMaterialList();
-        for (std::list<n64Material*>::iterator it = materiallist->begin(); it != materiallist->end(); ++it)
+        std::vector<n64Material*>* materiallist = this->m_Sausage64Model->GetMaterialList();
+        for (std::vector<n64Material*>::iterator it = materiallist->begin(); it != materiallist->end(); ++it)
         {
             n64Material* mat = *it;
             if (name == mat->name)
@@ -780,14 +1339,14 @@ void Main::m_TreeCtrl_ModelDataOnTreeSelChanged(wxTreeEvent& event)
     }
     else if (parentname == "Animations")
     {
-        std::list<s64Anim*>* animlist = this->m_Sausage64Model->GetAnimList();
-        for (std::list<s64Anim*>::iterator it = animlist->begin(); it != animlist->end(); ++it)
+        std::vector<s64Anim>* animlist = this->m_Sausage64Model->GetAnimList();
+        for (std::vector<s64Anim>::iterator it = animlist->begin(); it != animlist->end(); ++it)
         {
-            s64Anim* anim = *it;
+            s64Anim* anim = &(*it);
             if (name == anim->name)
             {
                 highlighted_anim = anim;
-                highlighted_anim_length = anim->keyframes.back()->keyframe;
+                highlighted_anim_length = anim->GetLength();
                 highlighted_anim_tick = 0;
                 break;
             }
@@ -809,6 +1368,7 @@ void Main::m_TreeCtrl_ModelDataOnTreeSelChanged(wxTreeEvent& event)
         this->m_Sizer_Bottom_Material->ShowItems(false);
         this->m_Sizer_Bottom_Animation->ShowItems(false);
     }
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -882,6 +1442,7 @@ void Main::m_MenuItem_AnimationSlowerOnMenuSelection(wxCommandEvent& event)
 void Main::m_MenuItem_ViewGridOnSelected(wxCommandEvent& event)
 {
     settings_showgrid = event.IsChecked();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -894,6 +1455,7 @@ void Main::m_MenuItem_ViewGridOnSelected(wxCommandEvent& event)
 void Main::m_MenuItem_ViewOriginOnSelected(wxCommandEvent& event)
 {
     settings_showorigin = event.IsChecked();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -906,6 +1468,7 @@ void Main::m_MenuItem_ViewOriginOnSelected(wxCommandEvent& event)
 void Main::m_MenuItem_ViewLightingOnSelected(wxCommandEvent& event)
 {
     settings_showlighting = event.IsChecked();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -918,6 +1481,7 @@ void Main::m_MenuItem_ViewLightingOnSelected(wxCommandEvent& event)
 void Main::m_MenuItem_ViewMeshRootsOnSelected(wxCommandEvent& event)
 {
     settings_showmeshroots = event.IsChecked();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -943,6 +1507,54 @@ void Main::m_MenuItem_ViewYUpOnSelected(wxCommandEvent& event)
 void Main::m_MenuItem_ViewHighlightOnSelected(wxCommandEvent& event)
 {
     settings_showhighlight = event.IsChecked();
+    this->m_Model_Canvas->RequestRedraw();
+}
+
+
+/*==============================
+    Main::m_MenuItem_ViewCrowdOnSelected
+    Handles clicking on one of the View Crowd menu options
+    @param The wxWidgets command event
+==============================*/
+
+void Main::m_MenuItem_ViewCrowdOnSelected(wxCommandEvent& event)
+{
+    const size_t crowdsizes[] = CROWD_SIZES;
+    for (size_t i=0; i<this->m_MenuItem_ViewCrowd.size(); i++)
+        if (this->m_MenuItem_ViewCrowd[i]->GetId() == event.GetId())
+            settings_crowdsize = crowdsizes[i];
+    this->m_Model_Canvas->RequestRedraw();
+}
+
+
+/*==============================
+    Main::m_MenuItem_ViewCostOverlayOnSelected
+    Handles clicking on one of the View Cost Overlay menu options
+    @param The wxWidgets command event
+==============================*/
+
+void Main::m_MenuItem_ViewCostOverlayOnSelected(wxCommandEvent& event)
+{
+    for (size_t i=0; i<this->m_MenuItem_ViewCostOverlay.size(); i++)
+        if (this->m_MenuItem_ViewCostOverlay[i]->GetId() == event.GetId())
+            settings_costoverlay = (costOverlay)i;
+    this->m_Model_Canvas->RequestRedraw();
+}
+
+
+/*==============================
+    Main::m_MenuItem_ViewBudgetOnSelected
+    Handles clicking on the Display List Budget menu option
+    @param The wxWidgets command event
+==============================*/
+
+void Main::m_MenuItem_ViewBudgetOnSelected(wxCommandEvent& event)
+{
+    if (this->m_BudgetWindow == NULL)
+        this->m_BudgetWindow = new BudgetWindow(this);
+    this->m_BudgetTime = 0;
+    this->m_BudgetWindow->Show();
+    this->m_BudgetWindow->Raise();
 }
 
 
@@ -955,6 +1567,7 @@ void Main::m_MenuItem_ViewHighlightOnSelected(wxCommandEvent& event)
 void Main::m_CheckBox_Mesh_BillboardOnCheck(wxCommandEvent& event)
 {
     highlighted_mesh->billboard = event.IsChecked();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -971,6 +1584,7 @@ void Main::m_Slider_AnimationOnScroll(wxScrollEvent& event)
     highlighted_anim_tick = this->m_Slider_Animation->GetValue();
     if (highlighted_anim_tick == highlighted_anim_length)
         highlighted_anim_tick -= 0.01f;
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -1038,6 +1652,7 @@ void Main::m_Radio_MaterialTypeOnButton3(wxCommandEvent& event)
         this->m_Sizer_Bottom_Texture_Setup->Show(false);
         this->m_Sizer_Bottom_PrimCol_Setup->Show(false);
         highlighted_material->CreateDefaultUnknown();
+        this->m_Model_Canvas->RequestRedraw();
     }
 }
 
@@ -1058,6 +1673,8 @@ void Main::m_Image_TextureOnLeftDown(wxMouseEvent& event)
 
     // Get our path and generate the texture from it
     highlighted_material->SetImageFromFile(file.GetPath().ToStdString());
+    WatchFile(&this->m_TextureFiles[highlighted_material], file.GetPath());
+    this->UpdateFileWatches();
     this->RefreshTextureImage();
 }
 
@@ -1084,6 +1701,7 @@ void Main::m_Choice_Texture_SFlagOnChoice(wxCommandEvent& event)
 {
     highlighted_material->GetTextureData()->texmodes = this->m_Choice_Texture_SFlag->GetString(event.GetSelection());
     highlighted_material->RegenerateTexture();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -1109,6 +1727,7 @@ void Main::m_Choice_Texture_TFlagOnChoice(wxCommandEvent& event)
 {
     highlighted_material->GetTextureData()->texmodet = this->m_Choice_Texture_TFlag->GetString(event.GetSelection());
     highlighted_material->RegenerateTexture();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -1163,6 +1782,7 @@ void Main::m_Button_AdvancedOnClick(wxCommandEvent& event)
 {
     AdvancedRenderSettings* dialog = new AdvancedRenderSettings(this);
     dialog->ShowModal();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -1202,8 +1822,21 @@ void Main::m_Timer_MainLoopOnTimer(wxTimerEvent& event)
     wxLongLong curtime = wxGetLocalTimeMillis();
     double elapsed = ((curtime - lasttime).ToDouble())/(1000.0f/PROGRAM_FRAMERATE);
 
+    // Reload the watched files once they stop changing, without letting the animation skip ahead
+    if (this->m_ReloadPending && !this->m_Reloading && curtime >= this->m_ReloadTime)
+    {
+        this->ReloadChangedFiles();
+        curtime = wxGetLocalTimeMillis();
+        elapsed = 0;
+    }
+
+    // Keep the budget window up to date with the model and its materials
+    if (this->m_BudgetWindow != NULL && this->m_BudgetWindow->IsShown())
+        this->UpdateBudgetWindow();
+
     // Read the controls
-    this->m_Model_Canvas->HandleControls();
+    if (this->m_Model_Canvas->HandleControls())
+        this->m_Model_Canvas->RequestRedraw();
 
     // Animate the model
     if (settings_animating)
@@ -1213,16 +1846,40 @@ void Main::m_Timer_MainLoopOnTimer(wxTimerEvent& event)
         else
             this->m_Model_Canvas->AdvanceAnim(settings_playbackspeed*elapsed);
         this->m_Slider_Animation->SetValue(highlighted_anim_tick);
+        if (highlighted_anim != NULL || settings_crowdsize > 0)
+            this->m_Model_Canvas->RequestRedraw();
     }
 
-    // Refresh the OpenGL context
-    this->m_Model_Canvas->Refresh();
+    // The highlight pulses, so it needs to be redrawn while it's visible
+    if (settings_showhighlight && (highlighted_mesh != NULL || highlighted_material != NULL))
+        this->m_Model_Canvas->RequestRedraw();
+
+    // Refresh the OpenGL context, but only if something changed since it was last drawn
+    if (this->m_Model_Canvas->NeedsRedraw())
+        this->m_Model_Canvas->Refresh();
 
     // Store the current time
     lasttime = curtime;
 }
 
 
+/*==============================
+    Main::OnActivate
+    Handles the window gaining or losing focus. The main loop
+    runs slower while the window is in the background.
+    @param The wxWidgets activate event
+==============================*/
+
+void Main::OnActivate(wxActivateEvent& event)
+{
+    if (event.GetActive())
+        this->m_Timer_MainLoop.Start(1000.0f/PROGRAM_FRAMERATE);
+    else
+        this->m_Timer_MainLoop.Start(1000.0f/PROGRAM_IDLERATE);
+    event.Skip();
+}
+
+
 /*==============================
     Main::m_Label_PrimColOnLeftDown
     Handles clicking on the primcolor color labels
@@ -1289,7 +1946,7 @@ void Main::RefreshPrimColPanel()
     this->m_CheckBox_PrimCol_DontLoad->SetValue(highlighted_material->dontload);
     this->m_Panel_Bottom->Layout();
     this->m_Panel_Bottom->Refresh();
-    this->m_Model_Canvas->Refresh();
+    this->m_Model_Canvas->RequestRedraw();
 }
 
 
@@ -1313,6 +1970,41 @@ void Main::RefreshTextureImage()
     this->m_Image_Texture->Update();
     this->m_Image_Texture->Refresh();
     this->m_Panel_Bottom->Refresh();
+    this->m_Model_Canvas->RequestRedraw();
+}
+
+
+/*==============================
+    Main::RefreshMaterialPanel
+    Refreshes the bottom panel of the highlighted material, after
+    its type or settings were changed from outside of the panel
+==============================*/
+
+void Main::RefreshMaterialPanel()
+{
+    if (highlighted_material == NULL)
+        return;
+    switch (highlighted_material->type)
+    {
+        case TYPE_PRIMCOL:
+            this->m_Radio_PrimColor->SetValue(true);
+            this->m_Sizer_Bottom_Texture_Setup->Show(false);
+            this->m_Sizer_Bottom_PrimCol_Setup->Show(true);
+            this->RefreshPrimColPanel();
+            break;
+        case TYPE_TEXTURE:
+            this->m_Radio_Image->SetValue(true);
+            this->m_Sizer_Bottom_Texture_Setup->Show(true);
+            this->m_Sizer_Bottom_PrimCol_Setup->Show(false);
+            this->RefreshTextureImage();
+            break;
+        case TYPE_UNKNOWN:
+            this->m_Radio_Omit->SetValue(true);
+            this->m_Sizer_Bottom_Texture_Setup->Show(false);
+            this->m_Sizer_Bottom_PrimCol_Setup->Show(false);
+            this->m_Panel_Bottom->Layout();
+            break;
+    }
 }
 
 
@@ -1565,6 +2257,7 @@ void AdvancedRenderSettings::m_Checklist_GeoFlagsOnToggled(wxCommandEvent& event
     }
     else
         highlighted_material->geomode.push_back(selection);
+    highlighted_material->UpdateRenderState();
 }
 
 
@@ -1823,4 +2516,291 @@ uint8_t ColorPickerHelper::GetGreen()
 uint8_t ColorPickerHelper::GetBlue()
 {
     return wxAtoi(this->m_TextCtrl_RGB_Blue->GetValue());
+}
+
+/*********************************
+        BudgetWindow Class
+*********************************/
+
+/*==============================
+    AddBudgetRow
+    Adds a mesh's budget to the end of the budget list
+    @param The list to add the row to
+    @param The budget to show
+==============================*/
+
+static void AddBudgetRow(wxListCtrl* list, const arabikiMeshBudget* budget)
+{
+    long row = list->InsertItem(list->GetItemCount(), wxString(budget->name));
+    list->SetItem(row, 1, wxString::Format("%u", budget->dlbytes));
+    list->SetItem(row, 2, wxString::Format("%u", budget->vertloads));
+    list->SetItem(row, 3, wxString::Format("%u", budget->texloads));
+    list->SetItem(row, 4, wxString::Format("%u", budget->tri1 + budget->tri2*2));
+    list->SetItem(row, 5, wxString::Format("%u", budget->tri1));
+    list->SetItem(row, 6, wxString::Format("%u", budget->tri2));
+}
+
+
+/*==============================
+    BudgetWindow (Constructor)
+    Initializes the class
+==============================*/
+
+BudgetWindow::BudgetWindow(wxWindow* parent, wxWindowID id, const wxString& title, const wxPoint& pos, const wxSize& size, long style) : wxDialog(parent, id, title, pos, size, style)
+{
+    arabikiSettings defaults;
+    const char* columns[] = BUDGET_COLUMNS;
+    arabiki_defaultsettings(&defaults);
+    this->m_Context = NULL;
+    this->m_Converting = false;
+    this->m_ConvertSuccess = false;
+    this->m_SourceChanged = false;
+    this->m_MaterialPath = wxFileName::CreateTempFileName("arabiki");
+    this->SetSizeHints(wxDefaultSize, wxDefaultSize);
+
+    // Add the main sizer
+    wxBoxSizer* m_Sizer_Main;
+    m_Sizer_Main = new wxBoxSizer(wxVERTICAL);
+
+    // Add the conversion settings
+    wxBoxSizer* m_Sizer_Settings;
+    m_Sizer_Settings = new wxBoxSizer(wxHORIZONTAL);
+    wxStaticText* m_Label_CacheSize;
+    m_Label_CacheSize = new wxStaticText(this, wxID_ANY, wxT("Vertex Cache Size"), wxDefaultPosition, wxDefaultSize, 0);
+    m_Label_CacheSize->Wrap(-1);
+    m_Sizer_Settings->Add(m_Label_CacheSize, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
+    this->m_Spin_CacheSize = new wxSpinCtrl(this, wxID_ANY, wxEmptyString, wxDefaultPosition, wxDefaultSize, wxSP_ARROW_KEYS, BUDGET_MINCACHE, BUDGET_MAXCACHE, defaults.cachesize);
+    m_Sizer_Settings->Add(this->m_Spin_CacheSize, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
+    this->m_CheckBox_No2Tri = new wxCheckBox(this, wxID_ANY, wxT("Disable 2Tri"), wxDefaultPosition, wxDefaultSize, 0);
+    this->m_CheckBox_No2Tri->SetValue(defaults.no2tri);
+    m_Sizer_Settings->Add(this->m_CheckBox_No2Tri, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
+    this->m_CheckBox_CullBox = new wxCheckBox(this, wxID_ANY, wxT("Bounding Boxes"), wxDefaultPosition, wxDefaultSize, 0);
+    this->m_CheckBox_CullBox->SetValue(defaults.cullbox);
+    m_Sizer_Settings->Add(this->m_CheckBox_CullBox, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
+    this->m_CheckBox_InitialLoad = new wxCheckBox(this, wxID_ANY, wxT("Initial Load"), wxDefaultPosition, wxDefaultSize, 0);
+    this->m_CheckBox_InitialLoad->SetValue(defaults.initialload);
+    m_Sizer_Settings->Add(this->m_CheckBox_InitialLoad, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
+    m_Sizer_Main->Add(m_Sizer_Settings, 0, wxEXPAND, 5);
+
+    // Add the conversion status
+    this->m_Label_Status = new wxStaticText(this, wxID_ANY, wxT("No model loaded"), wxDefaultPosition, wxDefaultSize, 0);
+    this->m_Label_Status->Wrap(-1);
+    m_Sizer_Main->Add(this->m_Label_Status, 0, wxALL, 5);
+
+    // Add the budget list
+    this->m_List_Budget = new wxListCtrl(this, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxLC_SINGLE_SEL);
+    for (size_t i=0; i<sizeof(columns)/sizeof(columns[0]); i++)
+        this->m_List_Budget->InsertColumn(i, columns[i], (i == 0) ? wxLIST_FORMAT_LEFT : wxLIST_FORMAT_RIGHT);
+    m_Sizer_Main->Add(this->m_List_Budget, 1, wxALL | wxEXPAND, 5);
+
+    // Finalize the layout
+    this->SetSizer(m_Sizer_Main);
+    this->Layout();
+    this->Centre(wxBOTH);
+
+    // Connect events
+    this->Connect(wxEVT_CLOSE_WINDOW, wxCloseEventHandler(BudgetWindow::OnClose));
+    this->m_Spin_CacheSize->Connect(wxEVT_COMMAND_SPINCTRL_UPDATED, wxSpinEventHandler(BudgetWindow::m_Spin_CacheSizeOnSpinCtrl), NULL, this);
+    this->m_CheckBox_No2Tri->Connect(wxEVT_COMMAND_CHECKBOX_CLICKED, wxCommandEventHandler(BudgetWindow::m_CheckBox_SettingOnCheckBox), NULL, this);
+    this->m_CheckBox_CullBox->Connect(wxEVT_COMMAND_CHECKBOX_CLICKED, wxCommandEventHandler(BudgetWindow::m_CheckBox_SettingOnCheckBox), NULL, this);
+    this->m_CheckBox_InitialLoad->Connect(wxEVT_COMMAND_CHECKBOX_CLICKED, wxCommandEventHandler(BudgetWindow::m_CheckBox_SettingOnCheckBox), NULL, this);
+}
+
+
+/*==============================
+    BudgetWindow (Destructor)
+    Cleans up the class before deletion
+==============================*/
+
+BudgetWindow::~BudgetWindow()
+{
+    // Conversions can't be interrupted, so wait for the current one to finish
+    if (this->m_Worker.joinable())
+        this->m_Worker.join();
+    arabiki_destroy(this->m_Context);
+    wxRemoveFile(this->m_MaterialPath);
+
+    // Disconnect events
+    this->Disconnect(wxEVT_CLOSE_WINDOW, wxCloseEventHandler(BudgetWindow::OnClose));
+    this->m_Spin_CacheSize->Disconnect(wxEVT_COMMAND_SPINCTRL_UPDATED, wxSpinEventHandler(BudgetWindow::m_Spin_CacheSizeOnSpinCtrl), NULL, this);
+    this->m_CheckBox_No2Tri->Disconnect(wxEVT_COMMAND_CHECKBOX_CLICKED, wxCommandEventHandler(BudgetWindow::m_CheckBox_SettingOnCheckBox), NULL, this);
+    this->m_CheckBox_CullBox->Disconnect(wxEVT_COMMAND_CHECKBOX_CLICKED, wxCommandEventHandler(BudgetWindow::m_CheckBox_SettingOnCheckBox), NULL, this);
+    this->m_CheckBox_InitialLoad->Disconnect(wxEVT_COMMAND_CHECKBOX_CLICKED, wxCommandEventHandler(BudgetWindow::m_CheckBox_SettingOnCheckBox), NULL, this);
+}
+
+
+/*==============================
+    BudgetWindow::OnClose
+    Handles closing the window. It's only hidden, so that
+    the settings are kept for the next time it's opened
+    @param The wxWidgets close event
+==============================*/
+
+void BudgetWindow::OnClose(wxCloseEvent& event)
+{
+    this->Hide();
+}
+
+
+/*==============================
+    BudgetWindow::m_Spin_CacheSizeOnSpinCtrl
+    Handles changing the vertex cache size
+    @param The wxWidgets spin event
+==============================*/
+
+void BudgetWindow::m_Spin_CacheSizeOnSpinCtrl(wxSpinEvent& event)
+{
+    this->m_SourceChanged = true;
+}
+
+
+/*==============================
+    BudgetWindow::m_CheckBox_SettingOnCheckBox
+    Handles clicking on one of the conversion setting checkboxes
+    @param The wxWidgets command event
+==============================*/
+
+void BudgetWindow::m_CheckBox_SettingOnCheckBox(wxCommandEvent& event)
+{
+    this->m_SourceChanged = true;
+}
+
+
+/*==============================
+    BudgetWindow::SetSource
+    Sets the model and material definitions to measure. The
+    model is converted again if either of them changed, or
+    if the model file was modified.
+    @param The path of the model, or an empty string if
+           there is no model loaded
+    @param The material definitions text
+==============================*/
+
+void BudgetWindow::SetSource(wxString modelpath, wxString materials)
+{
+    if (modelpath != this->m_ModelFile.path || WatchedFileChanged(&this->m_ModelFile))
+    {
+        WatchFile(&this->m_ModelFile, modelpath);
+        this->m_SourceChanged = true;
+    }
+    if (materials != this->m_Materials)
+    {
+        this->m_Materials = materials;
+        this->m_SourceChanged = true;
+    }
+}
+
+
+/*==============================
+    BudgetWindow::PollConversion
+    Shows the results of the conversion once it finishes, and
+    starts a new one if anything changed in the meantime
+==============================*/
+
+void BudgetWindow::PollConversion()
+{
+    if (this->m_Converting)
+        return;
+    if (this->m_Worker.joinable())
+    {
+        this->m_Worker.join();
+        this->ShowResults();
+    }
+    if (this->m_SourceChanged)
+        this->StartConversion();
+}
+
+
+/*==============================
+    BudgetWindow::StartConversion
+    Converts the model with Arabiki64 on a worker thread
+==============================*/
+
+void BudgetWindow::StartConversion()
+{
+    wxFile file;
+    arabikiSettings settings;
+    std::string modelpath = this->m_ModelFile.path.ToStdString();
+    std::string materialpath = this->m_MaterialPath.ToStdString();
+    this->m_SourceChanged = false;
+
+    // Check there's something to convert, as binary models were already converted
+    if (this->m_ModelFile.path.IsEmpty())
+    {
+        this->m_List_Budget->DeleteAllItems();
+        this->m_Label_Status->SetLabel(wxT("No model loaded"));
+        return;
+    }
+    if (wxFileName(this->m_ModelFile.path).GetExt().IsSameAs("bin", false))
+    {
+        this->m_List_Budget->DeleteAllItems();
+        this->m_Label_Status->SetLabel(wxT("Budgets can only be measured for S64 models"));
+        return;
+    }
+
+    // Arabiki64 reads the material definitions from a file
+    if (!file.Open(this->m_MaterialPath, wxFile::write) || !file.Write(this->m_Materials))
+    {
+        this->m_Label_Status->SetLabel(wxT("Unable to write the material definitions to ") + this->m_MaterialPath);
+        return;
+    }
+    file.Close();
+
+    // Convert the same way the command line tool does, but without writing anything to disk
+    arabiki_defaultsettings(&settings);
+    settings.quiet = true;
+    settings.writeoutput = false;
+    settings.cachesize = this->m_Spin_CacheSize->GetValue();
+    settings.no2tri = this->m_CheckBox_No2Tri->GetValue();
+    settings.cullbox = this->m_CheckBox_CullBox->GetValue();
+    settings.initialload = this->m_CheckBox_InitialLoad->GetValue();
+    arabiki_destroy(this->m_Context);
+    this->m_Context = arabiki_create(&settings);
+    if (this->m_Context == NULL)
+    {
+        this->m_Label_Status->SetLabel(wxT("Unable to allocate memory for the converter"));
+        return;
+    }
+
+    // Start the conversion
+    this->m_Label_Status->SetLabel(wxT("Converting..."));
+    this->m_Converting = true;
+    this->m_Worker = std::thread([this, modelpath, materialpath]{
+        this->m_ConvertSuccess = arabiki_convert(this->m_Context, modelpath.c_str(), materialpath.c_str());
+        this->m_Converting = false;
+    });
+}
+
+
+/*==============================
+    BudgetWindow::ShowResults
+    Fills the budget list with the results of the last conversion
+==============================*/
+
+void BudgetWindow::ShowResults()
+{
+    arabikiMeshBudget total = {"Total", 0, 0, 0, 0, 0};
+    int count = arabiki_getmeshcount(this->m_Context);
+    this->m_List_Budget->DeleteAllItems();
+    if (!this->m_ConvertSuccess)
+    {
+        this->m_Label_Status->SetLabel(wxString(arabiki_geterror(this->m_Context)).Trim());
+        return;
+    }
+
+    // Add a row for each mesh, in the order they're drawn, followed by the totals
+    for (int i=0; i<count; i++)
+    {
+        const arabikiMeshBudget* budget = arabiki_getmeshbudget(this->m_Context, i);
+        AddBudgetRow(this->m_List_Budget, budget);
+        total.dlbytes += budget->dlbytes;
+        total.vertloads += budget->vertloads;
+        total.texloads += budget->texloads;
+        total.tri1 += budget->tri1;
+        total.tri2 += budget->tri2;
+    }
+    AddBudgetRow(this->m_List_Budget, &total);
+    for (int i=0; i<this->m_List_Budget->GetColumnCount(); i++)
+        this->m_List_Budget->SetColumnWidth(i, wxLIST_AUTOSIZE_USEHEADER);
+    this->m_Label_Status->SetLabel(wxString::Format("%d meshes, in the order they're drawn", count));
 }
\ No newline at end of file
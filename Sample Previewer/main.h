@@ -2,7 +2,11 @@
 
 typedef struct IUnknown IUnknown;
 
+#include <atomic>
 #include <list>
+#include <map>
+#include <thread>
+#include <vector>
 #include <wx/wx.h>
 #include <wx/artprov.h>
 #include <wx/xrc/xmlres.h>
@@ -31,8 +35,13 @@ typedef struct IUnknown IUnknown;
 #include <wx/colordlg.h>
 #include <wx/timer.h>
 #include <wx/frame.h>
+#include <wx/fswatcher.h>
+#include <wx/datetime.h>
+#include <wx/listctrl.h>
+#include <wx/spinctrl.h>
 #include "sausage.h"
 #include "modelcanvas.h"
+#include "../Sample Parser/arabiki64.h"
 
 
 /*********************************
@@ -60,12 +69,28 @@ extern bool  settings_showhighlight;
 extern bool  settings_animating;
 extern float settings_playbackspeed;
 extern bool  settings_animatingreverse;
+extern bool  settings_watchfiles;
+extern size_t settings_crowdsize;
+extern costOverlay settings_costoverlay;
+
+
+/*********************************
+            Structures
+*********************************/
+
+// A file that gets reloaded when it changes on disk
+typedef struct {
+    wxString path;
+    wxDateTime modified;
+} WatchedFile;
 
 
 /*********************************
              Classes
 *********************************/
 
+class BudgetWindow;
+
 class Main : public wxFrame
 {
     private:
@@ -75,6 +100,7 @@ class Main : public wxFrame
         wxMenu* m_Menu_File;
         wxMenuItem* m_MenuItem_FileMaterialImport;
         wxMenuItem* m_MenuItem_FileMaterialExport;
+        wxMenuItem* m_MenuItem_FileWatch;
         wxMenu* m_Menu_Animation;
         wxMenuItem* m_MenuItem_AnimationPlayToggle;
         wxMenuItem* m_MenuItem_AnimationReverse;
@@ -82,6 +108,10 @@ class Main : public wxFrame
         wxMenuItem* m_MenuItem_AnimationFaster;
         wxMenuItem* m_MenuItem_AnimationNormal;
         wxMenuItem* m_MenuItem_AnimationSlower;
+        wxMenu* m_SubMenu_ViewCrowd;
+        std::vector<wxMenuItem*> m_MenuItem_ViewCrowd;
+        wxMenu* m_SubMenu_ViewCostOverlay;
+        std::vector<wxMenuItem*> m_MenuItem_ViewCostOverlay;
         wxMenu* m_Menu_View;
         wxSplitterWindow* m_Splitter_Horizontal;
         wxPanel* m_Panel_Top;
@@ -120,6 +150,15 @@ class Main : public wxFrame
         wxCheckBox* m_CheckBox_PrimCol_DontLoad;
         wxTimer m_Timer_MainLoop;
         s64Model* m_Sausage64Model;
+        wxFileSystemWatcher* m_Watcher;
+        WatchedFile m_ModelFile;
+        WatchedFile m_MaterialFile;
+        std::map<n64Material*, WatchedFile> m_TextureFiles;
+        bool m_ReloadPending;
+        bool m_Reloading;
+        wxLongLong m_ReloadTime;
+        BudgetWindow* m_BudgetWindow;
+        wxLongLong m_BudgetTime;
         
     public:
         Main();
@@ -127,9 +166,12 @@ class Main : public wxFrame
         void m_Splitter_HorizontalOnIdle(wxIdleEvent& event);
         void m_Splitter_VerticalOnIdle(wxIdleEvent& event);
         void m_Timer_MainLoopOnTimer(wxTimerEvent& event);
+        void OnActivate(wxActivateEvent& event);
         void m_MenuItem_ImportOnMenuSelection(wxCommandEvent& event);
         void m_MenuItem_ImportMaterialOnMenuSelection(wxCommandEvent& event);
         void m_MenuItem_ExportMaterialOnMenuSelection(wxCommandEvent& event);
+        void m_MenuItem_FileWatchOnMenuSelection(wxCommandEvent& event);
+        void OnFileSystemChanged(wxFileSystemWatcherEvent& event);
         void m_MenuItem_AnimationPlayToggleOnMenuSelection(wxCommandEvent& event);
         void m_MenuItem_AnimationReverseOnMenuSelection(wxCommandEvent& event);
         void m_MenuItem_AnimationFasterOnMenuSelection(wxCommandEvent& event);
@@ -141,6 +183,9 @@ class Main : public wxFrame
         void m_MenuItem_ViewMeshRootsOnSelected(wxCommandEvent& event);
         void m_MenuItem_ViewYUpOnSelected(wxCommandEvent& event);
         void m_MenuItem_ViewHighlightOnSelected(wxCommandEvent& event);
+        void m_MenuItem_ViewCrowdOnSelected(wxCommandEvent& event);
+        void m_MenuItem_ViewCostOverlayOnSelected(wxCommandEvent& event);
+        void m_MenuItem_ViewBudgetOnSelected(wxCommandEvent& event);
         void m_CheckBox_Mesh_BillboardOnCheck(wxCommandEvent& event);
         void m_Slider_AnimationOnScroll(wxScrollEvent& event);
         void m_Button_AnimationToggleOnClick(wxCommandEvent& event);
@@ -162,6 +207,16 @@ class Main : public wxFrame
         s64Model* GetLoadedModel();
         void RefreshPrimColPanel();
         void RefreshTextureImage();
+        void RefreshMaterialPanel();
+        bool LoadModel(wxString path, bool reload);
+        bool LoadMaterials(wxString path, bool reload);
+        void ReloadTextures();
+        void ReloadChangedFiles();
+        void UpdateFileWatches();
+        void UpdateBudgetWindow();
+        void BuildModelTree();
+        wxString GetMaterialDefinitions();
+        wxTreeItemId FindTreeItem(wxString parentname, wxString name);
 };
 
 class AdvancedRenderSettings : public wxDialog
@@ -224,4 +279,37 @@ class ColorPickerHelper : public wxDialog
         uint8_t GetRed();
         uint8_t GetGreen();
         uint8_t GetBlue();
+};
+
+class BudgetWindow : public wxDialog
+{
+    private:
+
+    protected:
+        wxSpinCtrl* m_Spin_CacheSize;
+        wxCheckBox* m_CheckBox_No2Tri;
+        wxCheckBox* m_CheckBox_CullBox;
+        wxCheckBox* m_CheckBox_InitialLoad;
+        wxStaticText* m_Label_Status;
+        wxListCtrl* m_List_Budget;
+        arabikiContext* m_Context;
+        std::thread m_Worker;
+        std::atomic<bool> m_Converting;
+        bool m_Converted;
+        bool m_ConvertSuccess;
+        bool m_SourceChanged;
+        WatchedFile m_ModelFile;
+        wxString m_Materials;
+        wxString m_MaterialPath;
+
+    public:
+        BudgetWindow(wxWindow* parent, wxWindowID id = wxID_ANY, const wxString& title = wxT("Display List Budget"), const wxPoint& pos = wxDefaultPosition, const wxSize& size = wxSize(600, 400), long style = wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER);
+        ~BudgetWindow();
+        void OnClose(wxCloseEvent& event);
+        void m_Spin_CacheSizeOnSpinCtrl(wxSpinEvent& event);
+        void m_CheckBox_SettingOnCheckBox(wxCommandEvent& event);
+        void SetSource(wxString modelpath, wxString materials);
+        void PollConversion();
+        void StartConversion();
+        void ShowResults();
 };
\ No newline at end of file
@@ -4,34 +4,11 @@ typedef struct IUnknown IUnknown;
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 #include <wx/wx.h>
 #include <wx/glcanvas.h>
 #include <wx/wxprec.h>
-#ifdef MACOS
-    #include <OpenGL/glu.h>
-#else
-    #include <GL/glu.h>
-#endif
-#include "Include/glm/glm/glm.hpp"
-#include "Include/glm/glm/ext/matrix_transform.hpp"
-
-
-/*********************************
-             Globals
-*********************************/
-
-// Placeholder missing texture
-extern n64Material* texture_missing;
-extern GLuint texture_missing_id;
-
-// Highlighted objects
-extern s64Mesh* highlighted_mesh;
-extern n64Material* highlighted_material;
-extern s64Anim* highlighted_anim;
-
-// Highlighted animation information
-extern size_t highlighted_anim_length;
-extern float  highlighted_anim_tick;
+#include "modelrenderer.h"
 
 
 /*********************************
@@ -55,6 +32,8 @@ class ModelCanvas : public wxGLCanvas
         bool backward_pressed;
         bool left_pressed;
         bool right_pressed;
+        ModelRenderer m_renderer;
+        bool m_redraw;
         
     protected:
     
@@ -63,13 +42,11 @@ class ModelCanvas : public wxGLCanvas
         ~ModelCanvas();
         void      SetApp(void* app);
         glm::vec3 DirFromAngles(float pitch, float yaw);
-        void      HandleControls();
+        bool      HandleControls();
+        void      RequestRedraw();
+        bool      NeedsRedraw();
         void      AdvanceAnim(float tickamount);
-        void      InitializeOpenGL();
-        void      SetupView();
-        void      RenderGrid();
-        void      RenderOrigin(float x, float y, float z, float scale);
-        void      RenderSausage64();
+        void      InvalidateRenderBuffers();
         void      m_Canvas_OnMouse(wxMouseEvent& event);
         void      m_Canvas_OnPaint(wxPaintEvent& event);
         void      OnKeyDown(wxKeyEvent& event);
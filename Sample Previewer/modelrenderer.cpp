@@ -0,0 +1,1482 @@
+#define GL_GLEXT_PROTOTYPES
+#include <math.h>
+#include <float.h>
+#include <ctype.h>
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <stddef.h>
+#include "main.h"
+#include "modelrenderer.h"
+#include "Include/glm/glm/gtx/compatibility.hpp"
+#include "Include/glm/glm/gtc/type_ptr.hpp"
+#include "Include/glm/glm/gtx/euler_angles.hpp"
+
+
+/*********************************
+              Macros
+*********************************/
+
+#define GRIDSIZE 10000.0
+
+// Crowd mode macros
+#define CROWD_SEED       64
+#define CROWD_BATCH      16
+#define CROWD_MINSPACING 100.0f
+
+// On-screen text macros
+#define FONT_WIDTH  5
+#define FONT_HEIGHT 7
+#define FONT_SCALE  2
+#define FONT_CHARS  "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ:.-/"
+
+
+/*********************************
+             Globals
+*********************************/
+
+// Missing texture
+n64Material* texture_missing;
+GLuint texture_missing_id;
+
+// Highlighted model sections
+s64Mesh* highlighted_mesh = NULL;
+n64Material* highlighted_material = NULL;
+s64Anim* highlighted_anim = NULL;
+
+// Highlighted animation info
+size_t highlighted_anim_length = 0;
+float  highlighted_anim_tick = 0;
+
+// 5x7 font for on-screen text, one byte per row from the top, one bit per column from the left
+static const GLubyte font_glyphs[][FONT_HEIGHT] = {
+    {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}, // 0
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}, // 1
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}, // 2
+    {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}, // 3
+    {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}, // 4
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}, // 5
+    {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}, // 6
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}, // 7
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}, // 8
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}, // 9
+    {0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11}, // A
+    {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}, // B
+    {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}, // C
+    {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}, // D
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}, // E
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}, // F
+    {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}, // G
+    {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}, // H
+    {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}, // I
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}, // J
+    {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}, // K
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}, // L
+    {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}, // M
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}, // N
+    {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, // O
+    {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}, // P
+    {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}, // Q
+    {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}, // R
+    {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}, // S
+    {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, // T
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}, // U
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}, // V
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}, // W
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}, // X
+    {0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04}, // Y
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}, // Z
+    {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}, // :
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}, // .
+    {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}, // -
+    {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}, // /
+};
+
+// Default OpenGL lighting
+static const GLfloat default_ambient[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+static const GLfloat default_diffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+static const GLfloat default_specular[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+
+
+/*********************************
+        OpenGL Extensions
+*********************************/
+
+// Windows only exposes OpenGL 1.1, so the buffer object functions need to be fetched from the driver
+#ifdef _WIN32
+    #define GL_ARRAY_BUFFER         0x8892
+    #define GL_ELEMENT_ARRAY_BUFFER 0x8893
+    #define GL_STATIC_DRAW          0x88E4
+
+    typedef void (APIENTRY* glGenBuffersFunc)(GLsizei n, GLuint* buffers);
+    typedef void (APIENTRY* glDeleteBuffersFunc)(GLsizei n, const GLuint* buffers);
+    typedef void (APIENTRY* glBindBufferFunc)(GLenum target, GLuint buffer);
+    typedef void (APIENTRY* glBufferDataFunc)(GLenum target, ptrdiff_t size, const void* data, GLenum usage);
+
+    static glGenBuffersFunc    glGenBuffers = NULL;
+    static glDeleteBuffersFunc glDeleteBuffers = NULL;
+    static glBindBufferFunc    glBindBuffer = NULL;
+    static glBufferDataFunc    glBufferData = NULL;
+#endif
+
+
+/*==============================
+    HasBufferObjects
+    Checks if buffer objects can be used, and on Windows,
+    loads their functions. The OpenGL context must be current.
+    @returns Whether buffer objects are available
+==============================*/
+
+static bool HasBufferObjects()
+{
+    #ifdef _WIN32
+        static bool loaded = false;
+        if (!loaded)
+        {
+            glGenBuffers = (glGenBuffersFunc)wglGetProcAddress("glGenBuffers");
+            glDeleteBuffers = (glDeleteBuffersFunc)wglGetProcAddress("glDeleteBuffers");
+            glBindBuffer = (glBindBufferFunc)wglGetProcAddress("glBindBuffer");
+            glBufferData = (glBufferDataFunc)wglGetProcAddress("glBufferData");
+            loaded = true;
+        }
+        return glGenBuffers != NULL && glDeleteBuffers != NULL && glBindBuffer != NULL && glBufferData != NULL;
+    #else
+        return true;
+    #endif
+}
+
+
+/*==============================
+    ModelRenderer (Constructor)
+    Initializes the class
+==============================*/
+
+ModelRenderer::ModelRenderer()
+{
+    this->m_campos = glm::vec3(0.0f, 0.0f, 0.0f);
+    this->m_camdir = glm::vec3(1.0f, 0.0f, 0.0f);
+    this->m_rendermodel = NULL;
+    this->m_buffersdirty = true;
+    this->m_staterevision = 0;
+    this->m_stateknown = false;
+    this->m_stateflags = 0;
+    this->m_statetype = TYPE_UNKNOWN;
+    this->m_statetexture = 0;
+    this->m_poseanim = NULL;
+    this->m_lastposetick = -1.0f;
+    this->m_drawcalls = 0;
+    this->m_triangles = 0;
+    this->m_gizmosbuilt = false;
+    this->m_gridyup = false;
+    this->m_gridvbo = 0;
+    this->m_originvbo = 0;
+    this->m_crowdmodel = NULL;
+    this->m_crowdyup = false;
+    this->m_crowdtick = 0;
+    this->m_crowdradius = 0;
+    this->m_frametime = 0;
+}
+
+
+/*==============================
+    ModelRenderer (Destructor)
+    Cleans up the class before deletion
+==============================*/
+
+ModelRenderer::~ModelRenderer()
+{
+
+}
+
+
+/*==============================
+    ModelRenderer::InitializeOpenGL
+    Initializes OpenGL
+==============================*/
+
+void ModelRenderer::InitializeOpenGL()
+{
+    // Initialize our missing texture
+    texture_missing = new n64Material(TYPE_TEXTURE);
+    glGenTextures(1, &texture_missing_id);
+    glBindTexture(GL_TEXTURE_2D, texture_missing_id);
+    glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 32, 32, 0, GL_RGB, GL_UNSIGNED_BYTE, texture_missing->GetTextureData()->wximg.GetData());
+    glEnable(GL_ALPHA_TEST);
+    glAlphaFunc(GL_GREATER, 0.5f);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, default_diffuse);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, default_ambient);
+    glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, default_specular);
+}
+
+
+/*==============================
+    ModelRenderer::SetCamera
+    Sets where the scene is viewed from
+    @param The position of the camera
+    @param The direction the camera is looking at
+==============================*/
+
+void ModelRenderer::SetCamera(glm::vec3 pos, glm::vec3 dir)
+{
+    this->m_campos = pos;
+    this->m_camdir = dir;
+}
+
+
+/*==============================
+    ModelRenderer::Render
+    Renders a whole frame into the current OpenGL context
+    @param The model to render, or NULL
+    @param The width of the frame, in pixels
+    @param The height of the frame, in pixels
+==============================*/
+
+void ModelRenderer::Render(s64Model* mdl, int width, int height)
+{
+    wxLongLong start = wxGetUTCTimeUSec();
+    this->m_drawcalls = 0;
+    this->m_triangles = 0;
+
+    // Clear the frame buffer with a color, and initialize the depth buffer
+    glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+    glClearDepth(1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glDepthFunc(GL_LEQUAL);
+
+    // Setup the render view
+    this->SetupView(width, height);
+
+    // Draw a grid on the floor
+    this->RenderGrid();
+    if (settings_showorigin)
+        this->RenderOrigin(0.0f, 0.0f, 0.0f, 100.0f);
+
+    // Render our model
+    this->RenderSausage64(mdl);
+    if (settings_costoverlay != OVERLAY_NONE && settings_crowdsize == 0 && mdl != NULL && mdl->IsBinary())
+        this->RenderCostLegend(mdl, width, height);
+
+    // In crowd mode, wait for the frame to finish so its time can be shown
+    if (settings_crowdsize > 0 && mdl != NULL)
+    {
+        glFinish();
+        this->m_frametime = (wxGetUTCTimeUSec() - start).ToDouble()/1000.0;
+        this->RenderCrowdCounter(width, height);
+    }
+}
+
+
+/*==============================
+    ModelRenderer::SetupView
+    Initializes the view for rendering
+    @param The width of the frame, in pixels
+    @param The height of the frame, in pixels
+==============================*/
+
+void ModelRenderer::SetupView(int width, int height)
+{
+    const float aspect = ((float)width)/height;
+    glm::vec3 up;
+    if (settings_yaxisup)
+        up = UPVECTORY;
+    else
+        up = UPVECTORZ;
+    const glm::vec3 camright = glm::normalize(glm::cross(up, this->m_camdir));
+    const GLfloat ambient[] = {0.5f, 0.5f, 0.5f, 0.5f};
+
+    glViewport(0, 0, width, height);
+    glScissor(0, 0, width, height);
+
+    glEnable(GL_CULL_FACE);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_LIGHTING);
+    glEnable(GL_LIGHT0);
+    glEnable(GL_TEXTURE_2D);
+
+    glLightfv(GL_LIGHT0, GL_AMBIENT, ambient);
+
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    gluPerspective(60, aspect, 10.0f, 10000.0f);
+
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    glMultMatrixf(&glm::lookAt(this->m_campos, this->m_campos + this->m_camdir, glm::cross(this->m_camdir, camright))[0][0]);
+}
+
+
+/*==============================
+    AddLine
+    Adds a line to a list of line vertices
+    @param The list to add the line to
+    @param The start of the line
+    @param The end of the line
+    @param The color of the line
+==============================*/
+
+static void AddLine(std::vector<lineVert>* verts, glm::vec3 start, glm::vec3 end, const GLubyte color[4])
+{
+    lineVert vert = {{start.x, start.y, start.z}, {color[0], color[1], color[2], color[3]}};
+    verts->push_back(vert);
+    vert.pos[0] = end.x;
+    vert.pos[1] = end.y;
+    vert.pos[2] = end.z;
+    verts->push_back(vert);
+}
+
+
+/*==============================
+    AddGridLines
+    Adds the lines of a grid to a list of line vertices
+    @param The list to add the lines to
+    @param The number of cells in each direction
+    @param The color of the lines
+==============================*/
+
+static void AddGridLines(std::vector<lineVert>* verts, int cells, const GLubyte color[4])
+{
+    for (int i=0; i<=cells; i++)
+    {
+        float x = (float)(-GRIDSIZE + (i*(GRIDSIZE/cells)*2));
+        if (settings_yaxisup)
+        {
+            AddLine(verts, glm::vec3(x, 0, -GRIDSIZE), glm::vec3(x, 0, GRIDSIZE), color);
+            AddLine(verts, glm::vec3(-GRIDSIZE, 0, x), glm::vec3(GRIDSIZE, 0, x), color);
+        }
+        else
+        {
+            AddLine(verts, glm::vec3(x, -GRIDSIZE, 0), glm::vec3(x, GRIDSIZE, 0), color);
+            AddLine(verts, glm::vec3(-GRIDSIZE, x, 0), glm::vec3(GRIDSIZE, x, 0), color);
+        }
+    }
+}
+
+
+/*==============================
+    ModelRenderer::BuildGizmoBuffers
+    Builds the line buffers for the grid and the origin, so
+    they don't have to be sent to OpenGL every frame
+==============================*/
+
+void ModelRenderer::BuildGizmoBuffers()
+{
+    const GLubyte gridcolor[4] = {88, 88, 88, 255};
+    const GLubyte gridmajorcolor[4] = {128, 128, 128, 255};
+    const GLubyte xcolor[4] = {255, 0, 0, 255};
+    const GLubyte ycolor[4] = {0, 255, 0, 255};
+    const GLubyte zcolor[4] = {0, 0, 255, 255};
+
+    // Generate the lines
+    this->m_gridverts.clear();
+    AddGridLines(&this->m_gridverts, 256, gridcolor);
+    AddGridLines(&this->m_gridverts, 16, gridmajorcolor);
+    this->m_originverts.clear();
+    AddLine(&this->m_originverts, glm::vec3(0, 0, 0), glm::vec3(1, 0, 0), xcolor);
+    AddLine(&this->m_originverts, glm::vec3(0, 0, 0), glm::vec3(0, 1, 0), ycolor);
+    AddLine(&this->m_originverts, glm::vec3(0, 0, 0), glm::vec3(0, 0, 1), zcolor);
+
+    // Upload them, if we can
+    if (HasBufferObjects())
+    {
+        if (this->m_gridvbo == 0)
+            glGenBuffers(1, &this->m_gridvbo);
+        glBindBuffer(GL_ARRAY_BUFFER, this->m_gridvbo);
+        glBufferData(GL_ARRAY_BUFFER, this->m_gridverts.size()*sizeof(lineVert), &this->m_gridverts[0], GL_STATIC_DRAW);
+        if (this->m_originvbo == 0)
+            glGenBuffers(1, &this->m_originvbo);
+        glBindBuffer(GL_ARRAY_BUFFER, this->m_originvbo);
+        glBufferData(GL_ARRAY_BUFFER, this->m_originverts.size()*sizeof(lineVert), &this->m_originverts[0], GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    this->m_gridyup = settings_yaxisup;
+    this->m_gizmosbuilt = true;
+}
+
+
+/*==============================
+    ModelRenderer::RenderLines
+    Draws a list of lines built by BuildGizmoBuffers
+    @param The buffer object holding the lines, or zero
+    @param The list of line vertices
+==============================*/
+
+void ModelRenderer::RenderLines(GLuint vbo, const std::vector<lineVert>* verts)
+{
+    const char* vertbase = (const char*)&(*verts)[0];
+    if (vbo != 0)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        vertbase = NULL;
+    }
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glVertexPointer(3, GL_FLOAT, sizeof(lineVert), vertbase + offsetof(lineVert, pos));
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(lineVert), vertbase + offsetof(lineVert, color));
+    glDrawArrays(GL_LINES, 0, (GLsizei)verts->size());
+    glDisableClientState(GL_COLOR_ARRAY);
+    glDisableClientState(GL_VERTEX_ARRAY);
+    if (vbo != 0)
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+
+/*==============================
+    ModelRenderer::RenderGrid
+    Draws a grid on the floor
+==============================*/
+
+void ModelRenderer::RenderGrid()
+{
+    if (!settings_showgrid)
+        return;
+    if (!this->m_gizmosbuilt || this->m_gridyup != settings_yaxisup)
+        this->BuildGizmoBuffers();
+
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_LIGHTING);
+    glLineWidth(1.0f);
+    this->RenderLines(this->m_gridvbo, &this->m_gridverts);
+    glEnable(GL_LIGHTING);
+    glEnable(GL_TEXTURE_2D);
+}
+
+
+/*==============================
+    ModelRenderer::RenderOrigin
+    Renders a grid on a given coordinate
+    @param The x coordinate
+    @param The y coordinate
+    @param The z coordinate
+    @param The scale to render the origin as
+==============================*/
+
+void ModelRenderer::RenderOrigin(float x, float y, float z, float scale)
+{
+    if (!this->m_gizmosbuilt)
+        this->BuildGizmoBuffers();
+
+    glDepthRange(0.0f, 0.0f);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_TEXTURE_2D);
+    glLineWidth(2.0f);
+    glPushMatrix();
+    glTranslatef(x, y, z);
+    glScalef(scale, scale, scale);
+    this->RenderLines(this->m_originvbo, &this->m_originverts);
+    glPopMatrix();
+    glLineWidth(1.0f);
+    glEnable(GL_TEXTURE_2D);
+    glEnable(GL_LIGHTING);
+
+    glDepthRange(0.0f, 1.0f);
+}
+
+/*==============================
+    ModelRenderer::BuildRenderBuffers
+    Builds the vertex and index buffers for each mesh in a model,
+    with the faces grouped by material
+    @param The model to build the buffers for
+==============================*/
+
+void ModelRenderer::BuildRenderBuffers(s64Model* mdl)
+{
+    const bool usebuffers = HasBufferObjects();
+    this->FreeRenderBuffers();
+    for (std::vector<s64Mesh>::iterator itmesh = mdl->GetMeshList()->begin(); itmesh != mdl->GetMeshList()->end(); ++itmesh)
+    {
+        s64Mesh* mesh = &(*itmesh);
+        std::vector<n64Material*> materials;
+        renderMesh rmesh;
+        rmesh.vbo = 0;
+        rmesh.ibo = 0;
+
+        // Copy the vertices into an interleaved array
+        rmesh.verts.reserve(mesh->verts.size());
+        for (std::vector<s64Vert>::iterator itvert = mesh->verts.begin(); itvert != mesh->verts.end(); ++itvert)
+        {
+            renderVert rvert = {
+                {itvert->pos.x, itvert->pos.y, itvert->pos.z},
+                {itvert->normal.x, itvert->normal.y, itvert->normal.z},
+                {itvert->UV.x, itvert->UV.y}
+            };
+            rmesh.verts.push_back(rvert);
+        }
+
+        // Find the materials in the order that they're first used
+        for (std::vector<s64Face>::iterator itface = mesh->faces.begin(); itface != mesh->faces.end(); ++itface)
+            if (std::find(materials.begin(), materials.end(), itface->material) == materials.end())
+                materials.push_back(itface->material);
+
+        // Generate the indices, with a range for each material
+        for (std::vector<n64Material*>::iterator itmat = materials.begin(); itmat != materials.end(); ++itmat)
+        {
+            renderRange range;
+            range.material = *itmat;
+            range.start = (GLsizei)rmesh.indices.size();
+            for (std::vector<s64Face>::iterator itface = mesh->faces.begin(); itface != mesh->faces.end(); ++itface)
+            {
+                if (itface->material != range.material)
+                    continue;
+                if (itface->verts[0] >= rmesh.verts.size() || itface->verts[1] >= rmesh.verts.size() || itface->verts[2] >= rmesh.verts.size())
+                    continue;
+                rmesh.indices.push_back(itface->verts[0]);
+                rmesh.indices.push_back(itface->verts[1]);
+                rmesh.indices.push_back(itface->verts[2]);
+            }
+            range.count = (GLsizei)rmesh.indices.size() - range.start;
+            if (range.count > 0)
+                rmesh.ranges.push_back(range);
+        }
+
+        // Upload the buffers to the GPU, if possible
+        if (usebuffers && rmesh.indices.size() > 0)
+        {
+            glGenBuffers(1, &rmesh.vbo);
+            glBindBuffer(GL_ARRAY_BUFFER, rmesh.vbo);
+            glBufferData(GL_ARRAY_BUFFER, rmesh.verts.size()*sizeof(renderVert), &rmesh.verts[0], GL_STATIC_DRAW);
+            glGenBuffers(1, &rmesh.ibo);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, rmesh.ibo);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, rmesh.indices.size()*sizeof(GLuint), &rmesh.indices[0], GL_STATIC_DRAW);
+        }
+        this->m_rendermeshes.push_back(rmesh);
+    }
+    if (usebuffers)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+    this->m_rendermodel = mdl;
+    this->m_buffersdirty = false;
+    this->SortRenderRanges();
+}
+
+
+/*==============================
+    ModelRenderer::FreeRenderBuffers
+    Frees the vertex and index buffers of the last built model
+==============================*/
+
+void ModelRenderer::FreeRenderBuffers()
+{
+    for (std::vector<renderMesh>::iterator itrmesh = this->m_rendermeshes.begin(); itrmesh != this->m_rendermeshes.end(); ++itrmesh)
+    {
+        if (itrmesh->vbo != 0)
+            glDeleteBuffers(1, &itrmesh->vbo);
+        if (itrmesh->ibo != 0)
+            glDeleteBuffers(1, &itrmesh->ibo);
+    }
+    this->m_rendermeshes.clear();
+    this->m_rendermodel = NULL;
+    this->m_poseanim = NULL;
+}
+
+
+/*==============================
+    ModelRenderer::InvalidateRenderBuffers
+    Marks the render buffers as outdated, so that they're rebuilt
+    the next time the model is rendered. Call this whenever the
+    loaded model is replaced or its geometry changes.
+==============================*/
+
+void ModelRenderer::InvalidateRenderBuffers()
+{
+    this->m_buffersdirty = true;
+    this->m_crowdmodel = NULL;
+}
+
+
+/*==============================
+    CompareRenderRanges
+    Orders render ranges by their material's render state, so
+    that ranges with the same state end up next to each other
+    @param The first range
+    @param The second range
+    @returns Whether the first range should go before the second
+==============================*/
+
+static bool CompareRenderRanges(const renderRange& a, const renderRange& b)
+{
+    const matRenderState* statea = &a.material->renderstate;
+    const matRenderState* stateb = &b.material->renderstate;
+    if (statea->flags != stateb->flags)
+        return statea->flags < stateb->flags;
+    return statea->type < stateb->type;
+}
+
+
+/*==============================
+    ModelRenderer::SortRenderRanges
+    Sorts each mesh's render ranges by render state, so that
+    drawing them needs as few state changes as possible
+==============================*/
+
+void ModelRenderer::SortRenderRanges()
+{
+    for (std::vector<renderMesh>::iterator itrmesh = this->m_rendermeshes.begin(); itrmesh != this->m_rendermeshes.end(); ++itrmesh)
+        std::stable_sort(itrmesh->ranges.begin(), itrmesh->ranges.end(), CompareRenderRanges);
+    this->m_staterevision = material_staterevision;
+}
+
+
+/*==============================
+    ModelRenderer::ApplyMaterial
+    Sets the OpenGL render state for a material, only touching
+    the state that differs from the last applied material
+    @param The material to apply
+==============================*/
+
+void ModelRenderer::ApplyMaterial(n64Material* mat)
+{
+    uint32_t flags = mat->renderstate.flags;
+    uint32_t changed;
+    GLuint texture = 0;
+
+    // Find out what changed since the last material
+    if (!settings_showlighting)
+        flags &= ~RENDERFLAG_LIGHTING;
+    changed = this->m_stateknown ? (flags ^ this->m_stateflags) : 0xFFFFFFFF;
+
+    // Geometry flags
+    if (changed & RENDERFLAG_LIGHTING)
+    {
+        if (flags & RENDERFLAG_LIGHTING)
+            glEnable(GL_LIGHTING);
+        else
+            glDisable(GL_LIGHTING);
+    }
+    if (changed & RENDERFLAG_ZBUFFER)
+    {
+        if (flags & RENDERFLAG_ZBUFFER)
+            glEnable(GL_DEPTH_TEST);
+        else
+            glDisable(GL_DEPTH_TEST);
+    }
+    if (changed & (RENDERFLAG_CULLFRONT | RENDERFLAG_CULLBACK))
+    {
+        glEnable(GL_CULL_FACE);
+        if ((flags & RENDERFLAG_CULLFRONT) && (flags & RENDERFLAG_CULLBACK))
+            glCullFace(GL_FRONT_AND_BACK);
+        else if (flags & RENDERFLAG_CULLFRONT)
+            glCullFace(GL_FRONT);
+        else if (flags & RENDERFLAG_CULLBACK)
+            glCullFace(GL_BACK);
+        else
+            glDisable(GL_CULL_FACE);
+    }
+    if (changed & RENDERFLAG_SMOOTH)
+        glShadeModel((flags & RENDERFLAG_SMOOTH) ? GL_SMOOTH : GL_FLAT);
+
+    // Material type
+    if (!this->m_stateknown || mat->renderstate.type != this->m_statetype)
+    {
+        switch (mat->renderstate.type)
+        {
+            case TYPE_PRIMCOL:
+                glDisable(GL_TEXTURE);
+                glDisable(GL_TEXTURE_2D);
+                glEnable(GL_COLOR_MATERIAL);
+                glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, default_diffuse);
+                glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, default_ambient);
+                glColorMaterial(GL_FRONT_AND_BACK, GL_DIFFUSE);
+                break;
+            case TYPE_TEXTURE:
+            case TYPE_UNKNOWN:
+                glEnable(GL_TEXTURE);
+                glEnable(GL_TEXTURE_2D);
+                glDisable(GL_COLOR_MATERIAL);
+                glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, default_diffuse);
+                glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, default_ambient);
+                break;
+        }
+    }
+
+    // Texture
+    if (mat->renderstate.type == TYPE_TEXTURE)
+        texture = mat->GetTextureData()->glid;
+    else if (mat->renderstate.type == TYPE_UNKNOWN)
+        texture = texture_missing_id;
+    if (texture != 0 && (!this->m_stateknown || texture != this->m_statetexture))
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        this->m_statetexture = texture;
+    }
+    this->m_stateknown = true;
+    this->m_stateflags = flags;
+    this->m_statetype = mat->renderstate.type;
+}
+
+
+/*==============================
+    ModelRenderer::EvaluatePoses
+    Calculates the transform of every mesh in a model at a given
+    tick of an animation
+    @param The model to evaluate
+    @param The animation to sample, or NULL for the bind pose
+    @param The tick to sample the animation at
+    @param The array to store the poses in, one per mesh
+==============================*/
+
+void ModelRenderer::EvaluatePoses(s64Model* mdl, s64Anim* anim, float tick, renderPose* poses)
+{
+    size_t i = 0;
+    float l;
+    const s64Keyframe* curkeyf = NULL;
+    const s64Keyframe* nextkeyf = NULL;
+    if (anim != NULL)
+        anim->GetKeyframes(tick, &curkeyf, &nextkeyf, &l);
+    for (std::vector<s64Mesh>::iterator itmesh = mdl->GetMeshList()->begin(); itmesh != mdl->GetMeshList()->end(); ++itmesh, i++)
+    {
+        s64Mesh* mesh = &(*itmesh);
+        renderPose* pose = &poses[i];
+        if (curkeyf == NULL)
+        {
+            pose->translation = mesh->root;
+            pose->scale = glm::vec3(1.0f, 1.0f, 1.0f);
+            pose->matrix = glm::translate(glm::mat4(1.0f), pose->translation);
+            continue;
+        }
+        const s64FrameData* fdata = &curkeyf->framedata[i];
+        const s64FrameData* nextfdata = &nextkeyf->framedata[i];
+        pose->translation = glm::lerp(fdata->translation, nextfdata->translation, l) + mesh->root;
+        pose->scale = glm::lerp(fdata->scale, nextfdata->scale, l);
+        pose->matrix = glm::translate(glm::mat4(1.0f), pose->translation);
+        pose->matrix = pose->matrix*glm::toMat4(glm::slerp(fdata->rotation, nextfdata->rotation, l));
+        pose->matrix = glm::scale(pose->matrix, pose->scale);
+    }
+}
+
+
+/*==============================
+    ModelRenderer::GetAnimPoses
+    Gets the transform of every mesh for the highlighted
+    animation's current tick. Whole ticks are cached for the
+    whole animation, so scrubbing and looping is nearly free,
+    and the last fractional tick is kept for paused playback.
+    @param The model being rendered
+    @returns An array with one pose per mesh
+==============================*/
+
+const renderPose* ModelRenderer::GetAnimPoses(s64Model* mdl)
+{
+    size_t meshcount = mdl->GetMeshList()->size();
+    size_t ticks = ((size_t)highlighted_anim->GetLength()) + 1;
+    size_t tick = (size_t)highlighted_anim_tick;
+
+    // Reset the cache if the animation changed
+    if (this->m_poseanim != highlighted_anim)
+    {
+        this->m_poseanim = highlighted_anim;
+        this->m_posecache.resize(ticks*meshcount);
+        this->m_posecached.assign(ticks, false);
+        this->m_lastposes.resize(meshcount);
+        this->m_lastposetick = -1.0f;
+    }
+
+    // Whole ticks get stored in the cache
+    if (highlighted_anim_tick >= 0 && tick < ticks && (float)tick == highlighted_anim_tick)
+    {
+        if (!this->m_posecached[tick])
+        {
+            this->EvaluatePoses(mdl, highlighted_anim, highlighted_anim_tick, &this->m_posecache[tick*meshcount]);
+            this->m_posecached[tick] = true;
+        }
+        return &this->m_posecache[tick*meshcount];
+    }
+
+    // Otherwise, only recalculate if the tick changed
+    if (this->m_lastposetick != highlighted_anim_tick)
+    {
+        this->EvaluatePoses(mdl, highlighted_anim, highlighted_anim_tick, &this->m_lastposes[0]);
+        this->m_lastposetick = highlighted_anim_tick;
+    }
+    return &this->m_lastposes[0];
+}
+
+
+/*==============================
+    BillboardMatrix
+    Calculates the transform of a billboarded mesh, so that it
+    faces the camera
+    @param The mesh's pose
+    @param The position of the camera
+    @returns The mesh's transform
+==============================*/
+
+static glm::mat4 BillboardMatrix(const renderPose* pose, glm::vec3 campos)
+{
+    glm::mat4 mat = glm::translate(glm::mat4(1.0f), pose->translation);
+    glm::vec3 direction = -glm::normalize(campos - pose->translation);
+    mat = mat * glm::inverse(glm::lookAt(glm::vec3(0, 0, 0), direction, glm::cross(direction, glm::normalize(glm::cross(UPVECTORZ, direction)))));
+    return glm::scale(mat, pose->scale);
+}
+
+
+/*==============================
+    GetMeshCost
+    Gets the part of a mesh's cost that an overlay shows
+    @param The mesh to check
+    @param The overlay being shown
+    @returns The mesh's cost
+==============================*/
+
+static float GetMeshCost(const s64Mesh* mesh, costOverlay overlay)
+{
+    size_t triangles = mesh->cost.tri1 + 2*mesh->cost.tri2;
+    switch (overlay)
+    {
+        case OVERLAY_VERTLOADS:
+            return (float)mesh->cost.vertloads;
+        case OVERLAY_TEXLOADS:
+            return (float)mesh->cost.texloads;
+        case OVERLAY_1TRI:
+            return (triangles > 0) ? ((float)mesh->cost.tri1)/triangles : 0.0f;
+        case OVERLAY_DLBYTES:
+            return (float)mesh->cost.dlbytes;
+        default:
+            return 0.0f;
+    }
+}
+
+
+/*==============================
+    GetMaxMeshCost
+    Gets the highest cost of any mesh in a model, which is what
+    the overlay's hottest color stands for
+    @param The model to check
+    @param The overlay being shown
+    @returns The highest cost
+==============================*/
+
+static float GetMaxMeshCost(s64Model* mdl, costOverlay overlay)
+{
+    float maxcost = 0.0f;
+
+    // The share of lone triangles is already a fraction, and it's more useful to see it as one
+    if (overlay == OVERLAY_1TRI)
+        return 1.0f;
+    for (std::vector<s64Mesh>::iterator itmesh = mdl->GetMeshList()->begin(); itmesh != mdl->GetMeshList()->end(); ++itmesh)
+        maxcost = std::max(maxcost, GetMeshCost(&(*itmesh), overlay));
+    return maxcost;
+}
+
+
+/*==============================
+    HeatColor
+    Converts a value to a color that goes from blue, to green,
+    to red as it gets hotter
+    @param The value, from 0 to 1
+    @returns The color
+==============================*/
+
+static glm::vec3 HeatColor(float heat)
+{
+    heat = std::max(0.0f, std::min(heat, 1.0f));
+    if (heat < 0.5f)
+        return glm::vec3(0.0f, heat*2.0f, 1.0f - heat*2.0f);
+    return glm::vec3(heat*2.0f - 1.0f, 2.0f - heat*2.0f, 0.0f);
+}
+
+
+/*==============================
+    ModelRenderer::RenderSausage64
+    Renders a Sausage64 model, using the buffers built by
+    BuildRenderBuffers
+    @param The model to render, or NULL
+==============================*/
+
+void ModelRenderer::RenderSausage64(s64Model* mdl)
+{
+    float highlightcolor[4] = { 1.0f, 1.0f, 0.0f, 1.0f };
+    const renderPose* poses = NULL;
+    std::vector<renderMesh>::iterator itrmesh;
+    bool showcost;
+    float maxcost = 0.0f;
+
+    // If no model is loaded, stop
+    if (mdl == NULL)
+        return;
+
+    // Rebuild the buffers if the model was changed
+    if (this->m_buffersdirty || this->m_rendermodel != mdl)
+        this->BuildRenderBuffers(mdl);
+    else if (this->m_staterevision != material_staterevision)
+        this->SortRenderRanges();
+
+    // The grid and origin change the OpenGL state behind our back
+    this->m_stateknown = false;
+
+    // Handle highlight (it's really just fog)
+    glFogi(GL_FOG_MODE, GL_LINEAR);
+    glFogfv(GL_FOG_COLOR, highlightcolor);
+    glFogf(GL_FOG_DENSITY, 0.8f);
+    glHint(GL_FOG_HINT, GL_NICEST);
+    glFogf(GL_FOG_START, 0.0f);
+    glFogf(GL_FOG_END, 500.0f + 500.0f*sin(wxGetLocalTimeMillis().ToDouble()/100.0f));
+
+    // In crowd mode, draw lots of copies of the model instead
+    if (settings_crowdsize > 0)
+    {
+        this->RenderCrowd(mdl);
+        glDisable(GL_FOG);
+        return;
+    }
+
+    // Get the mesh transforms for the current animation frame
+    if (highlighted_anim != NULL && this->m_rendermeshes.size() > 0)
+        poses = this->GetAnimPoses(mdl);
+
+    // Binary models can show what each mesh costs to draw instead of their materials
+    showcost = (settings_costoverlay != OVERLAY_NONE && mdl->IsBinary());
+    if (showcost)
+        maxcost = GetMaxMeshCost(mdl, settings_costoverlay);
+
+    // Handle each mesh
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    itrmesh = this->m_rendermeshes.begin();
+    for (std::vector<s64Mesh>::iterator itmesh = mdl->GetMeshList()->begin(); itmesh != mdl->GetMeshList()->end(); ++itmesh, ++itrmesh)
+    {
+        const char* vertbase;
+        const GLuint* indexbase;
+        s64Mesh* mesh = &(*itmesh);
+        glm::vec3 heat;
+
+        // Position the mesh based on the current animation frame
+        glPushMatrix();
+        if (poses != NULL)
+        {
+            const renderPose* pose = &poses[itrmesh - this->m_rendermeshes.begin()];
+            if (mesh->billboard)
+            {
+                glm::mat4 mat = BillboardMatrix(pose, this->m_campos);
+                glMultMatrixf(&mat[0][0]);
+            }
+            else
+                glMultMatrixf(&pose->matrix[0][0]);
+        }
+        else
+        {
+            glm::mat4 mat = glm::mat4(1.0f);
+            mat = glm::translate(mat, glm::vec3(mesh->root.x, mesh->root.y, mesh->root.z));
+            if (mesh->billboard)
+            {
+                glm::vec3 direction = -glm::normalize(this->m_campos - glm::vec3(mesh->root.x, mesh->root.y, mesh->root.z));
+                //glm::quat quaternion = glm::quat(glm::vec3(glm::radians(-90.0f), 0, 0));
+                mat = mat*glm::inverse(glm::lookAt(glm::vec3(0,0,0), direction, glm::cross(direction, glm::normalize(glm::cross(UPVECTORZ, direction)))));
+                //mat = mat*glm::mat4_cast(quaternion);
+            }
+            glMultMatrixf(&mat[0][0]);
+            if (mesh->billboard)
+            {
+                this->RenderOrigin(0.0f, 0.0f, 0.0f, 50.0f);
+                this->m_stateknown = false;
+            }
+        }
+
+        // Render the mesh roots
+        if (settings_showmeshroots)
+        {
+            this->RenderOrigin(0.0f, 0.0f, 0.0f, 10.0f);
+            this->m_stateknown = false;
+        }
+
+        // Point OpenGL to the mesh's buffers
+        if (itrmesh->ranges.size() == 0)
+        {
+            glPopMatrix();
+            continue;
+        }
+        if (itrmesh->vbo != 0)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, itrmesh->vbo);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, itrmesh->ibo);
+            vertbase = NULL;
+            indexbase = NULL;
+        }
+        else
+        {
+            vertbase = (const char*)&itrmesh->verts[0];
+            indexbase = &itrmesh->indices[0];
+        }
+        glVertexPointer(3, GL_FLOAT, sizeof(renderVert), vertbase + offsetof(renderVert, pos));
+        glNormalPointer(GL_FLOAT, sizeof(renderVert), vertbase + offsetof(renderVert, normal));
+        glTexCoordPointer(2, GL_FLOAT, sizeof(renderVert), vertbase + offsetof(renderVert, uv));
+        if (showcost)
+            heat = HeatColor((maxcost > 0.0f) ? GetMeshCost(mesh, settings_costoverlay)/maxcost : 0.0f);
+
+        // Draw each material's range of triangles
+        for (std::vector<renderRange>::iterator itrange = itrmesh->ranges.begin(); itrange != itrmesh->ranges.end(); ++itrange)
+        {
+            n64Material* mat = itrange->material;
+
+            // Handle render settings
+            this->ApplyMaterial(mat);
+            if (showcost)
+            {
+                const GLfloat heatcolor[4] = {heat.x, heat.y, heat.z, 1.0f};
+                glDisable(GL_TEXTURE_2D);
+                glDisable(GL_COLOR_MATERIAL);
+                glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, heatcolor);
+                glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, default_ambient);
+                glColor3f(heat.x, heat.y, heat.z);
+            }
+            else if (mat->type == TYPE_PRIMCOL)
+            {
+                matCol* col = mat->GetPrimColorData();
+                if (col == NULL)
+                    continue;
+                glColor3f(((float)col->r)/255.0f, ((float)col->g)/255.0f, ((float)col->b)/255.0f);
+            }
+            else
+                glColor3f(1.0f, 1.0f, 1.0f);
+
+            // Enable fog if highlighted
+            if (settings_showhighlight && (highlighted_mesh == mesh || highlighted_material == mat))
+                glEnable(GL_FOG);
+            else
+                glDisable(GL_FOG);
+
+            // Render
+            glDrawElements(GL_TRIANGLES, itrange->count, GL_UNSIGNED_INT, indexbase + itrange->start);
+            this->m_drawcalls++;
+            this->m_triangles += itrange->count/3;
+        }
+        if (itrmesh->vbo != 0)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        }
+
+        // Pop the matrix for this mesh
+        glPopMatrix();
+    }
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+    glDisable(GL_FOG);
+
+    // The overlay changed the texture state behind ApplyMaterial's back
+    if (showcost)
+        this->m_stateknown = false;
+}
+
+
+/*==============================
+    GetModelBounds
+    Calculates the bounding sphere of a model in its bind pose
+    @param The model to check
+    @param The vector to store the center in
+    @returns The radius of the bounding sphere
+==============================*/
+
+float GetModelBounds(s64Model* mdl, glm::vec3* center)
+{
+    glm::vec3 minpos = glm::vec3(FLT_MAX), maxpos = glm::vec3(-FLT_MAX);
+    for (std::vector<s64Mesh>::iterator itmesh = mdl->GetMeshList()->begin(); itmesh != mdl->GetMeshList()->end(); ++itmesh)
+    {
+        for (std::vector<s64Vert>::iterator itvert = itmesh->verts.begin(); itvert != itmesh->verts.end(); ++itvert)
+        {
+            minpos = glm::min(minpos, itvert->pos + itmesh->root);
+            maxpos = glm::max(maxpos, itvert->pos + itmesh->root);
+        }
+    }
+    if (minpos.x > maxpos.x)
+    {
+        *center = glm::vec3(0.0f);
+        return 0.0f;
+    }
+    *center = (minpos + maxpos)*0.5f;
+    return glm::length(maxpos - *center);
+}
+
+
+/*==============================
+    ModelRenderer::BuildCrowd
+    Lays out the copies of the model for crowd mode on a grid,
+    giving each one a random animation and starting point
+    @param The model to build the crowd for
+==============================*/
+
+void ModelRenderer::BuildCrowd(s64Model* mdl)
+{
+    std::minstd_rand rng(CROWD_SEED);
+    std::vector<s64Anim>* anims = mdl->GetAnimList();
+    glm::vec3 center;
+    float radius = GetModelBounds(mdl, &center);
+    float spacing = std::max(radius*2.0f, CROWD_MINSPACING);
+    size_t side = (size_t)ceil(sqrt((double)settings_crowdsize));
+
+    // Place each copy of the model
+    this->m_crowd.clear();
+    this->m_crowd.reserve(settings_crowdsize);
+    for (size_t i=0; i<settings_crowdsize; i++)
+    {
+        renderInstance inst;
+        float x = (((float)(i%side)) - (side - 1)/2.0f)*spacing;
+        float y = (((float)(i/side)) - (side - 1)/2.0f)*spacing;
+        if (settings_yaxisup)
+            inst.offset = glm::vec3(x, 0.0f, y);
+        else
+            inst.offset = glm::vec3(x, y, 0.0f);
+        inst.anim = NULL;
+        inst.phase = 0;
+        if (anims->size() > 0)
+        {
+            inst.anim = &(*anims)[rng() % anims->size()];
+            inst.phase = (rng() % 1000)*inst.anim->GetLength()/1000.0f;
+        }
+        this->m_crowd.push_back(inst);
+    }
+    this->m_crowdradius = radius + (side*spacing/2.0f)*sqrtf(2.0f);
+    this->m_crowdmodel = mdl;
+    this->m_crowdyup = settings_yaxisup;
+}
+
+
+/*==============================
+    ModelRenderer::EvaluateCrowd
+    Calculates the transform of every mesh of every copy of the
+    model in crowd mode, spread across multiple threads
+    @param The model being rendered
+==============================*/
+
+void ModelRenderer::EvaluateCrowd(s64Model* mdl)
+{
+    size_t meshcount = mdl->GetMeshList()->size();
+    size_t batches = (this->m_crowd.size() + CROWD_BATCH - 1)/CROWD_BATCH;
+    std::atomic<size_t> nextbatch(0);
+    std::vector<std::thread> workers;
+    unsigned int threads = std::max(1u, std::min(std::thread::hardware_concurrency(), (unsigned int)batches));
+    this->m_crowdposes.resize(this->m_crowd.size()*meshcount);
+
+    // Pose the copies on a pool of worker threads, a batch at a time
+    for (unsigned int i=0; i<threads; i++)
+    {
+        workers.push_back(std::thread([&]{
+            size_t batch;
+            while ((batch = nextbatch++) < batches)
+            {
+                size_t last = std::min((batch + 1)*CROWD_BATCH, this->m_crowd.size());
+                for (size_t j=batch*CROWD_BATCH; j<last; j++)
+                {
+                    renderInstance* inst = &this->m_crowd[j];
+                    renderPose* poses = &this->m_crowdposes[j*meshcount];
+                    float tick = 0;
+                    if (inst->anim != NULL && inst->anim->GetLength() > 0)
+                    {
+                        float length = (float)inst->anim->GetLength();
+                        tick = (float)fmod(this->m_crowdtick + inst->phase, length);
+                        if (tick < 0)
+                            tick += length;
+                    }
+                    this->EvaluatePoses(mdl, inst->anim, tick, poses);
+                    for (size_t k=0; k<meshcount; k++)
+                    {
+                        poses[k].translation += inst->offset;
+                        poses[k].matrix = glm::translate(glm::mat4(1.0f), inst->offset)*poses[k].matrix;
+                    }
+                }
+            }
+        }));
+    }
+    for (std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+        it->join();
+}
+
+
+/*==============================
+    ModelRenderer::RenderCrowd
+    Renders every copy of the model in crowd mode. Each mesh's
+    buffers are bound and each material applied only once, and
+    then drawn for every copy.
+    @param The model to render
+==============================*/
+
+void ModelRenderer::RenderCrowd(s64Model* mdl)
+{
+    size_t meshcount = this->m_rendermeshes.size();
+    if (this->m_crowdmodel != mdl || this->m_crowd.size() != settings_crowdsize || this->m_crowdyup != settings_yaxisup)
+        this->BuildCrowd(mdl);
+    this->EvaluateCrowd(mdl);
+
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    for (size_t i=0; i<meshcount; i++)
+    {
+        const char* vertbase;
+        const GLuint* indexbase;
+        renderMesh* rmesh = &this->m_rendermeshes[i];
+        s64Mesh* mesh = &(*mdl->GetMeshList())[i];
+        if (rmesh->ranges.size() == 0)
+            continue;
+
+        // Point OpenGL to the mesh's buffers
+        if (rmesh->vbo != 0)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, rmesh->vbo);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, rmesh->ibo);
+            vertbase = NULL;
+            indexbase = NULL;
+        }
+        else
+        {
+            vertbase = (const char*)&rmesh->verts[0];
+            indexbase = &rmesh->indices[0];
+        }
+        glVertexPointer(3, GL_FLOAT, sizeof(renderVert), vertbase + offsetof(renderVert, pos));
+        glNormalPointer(GL_FLOAT, sizeof(renderVert), vertbase + offsetof(renderVert, normal));
+        glTexCoordPointer(2, GL_FLOAT, sizeof(renderVert), vertbase + offsetof(renderVert, uv));
+
+        // Draw each material's range of triangles for every copy
+        for (std::vector<renderRange>::iterator itrange = rmesh->ranges.begin(); itrange != rmesh->ranges.end(); ++itrange)
+        {
+            n64Material* mat = itrange->material;
+            this->ApplyMaterial(mat);
+            if (mat->type == TYPE_PRIMCOL)
+            {
+                matCol* col = mat->GetPrimColorData();
+                if (col == NULL)
+                    continue;
+                glColor3f(((float)col->r)/255.0f, ((float)col->g)/255.0f, ((float)col->b)/255.0f);
+            }
+            else
+                glColor3f(1.0f, 1.0f, 1.0f);
+            if (settings_showhighlight && (highlighted_mesh == mesh || highlighted_material == mat))
+                glEnable(GL_FOG);
+            else
+                glDisable(GL_FOG);
+            for (size_t j=0; j<this->m_crowd.size(); j++)
+            {
+                const renderPose* pose = &this->m_crowdposes[j*meshcount + i];
+                glPushMatrix();
+                if (mesh->billboard)
+                {
+                    glm::mat4 billboard = BillboardMatrix(pose, this->m_campos);
+                    glMultMatrixf(&billboard[0][0]);
+                }
+                else
+                    glMultMatrixf(&pose->matrix[0][0]);
+                glDrawElements(GL_TRIANGLES, itrange->count, GL_UNSIGNED_INT, indexbase + itrange->start);
+                glPopMatrix();
+            }
+            this->m_drawcalls += this->m_crowd.size();
+            this->m_triangles += (itrange->count/3)*this->m_crowd.size();
+        }
+        if (rmesh->vbo != 0)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+        }
+    }
+    glDisableClientState(GL_VERTEX_ARRAY);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+}
+
+
+/*==============================
+    ModelRenderer::RenderCrowdCounter
+    Draws the crowd mode statistics on the top left of the screen
+    @param The width of the frame, in pixels
+    @param The height of the frame, in pixels
+==============================*/
+
+void ModelRenderer::RenderCrowdCounter(int width, int height)
+{
+    char text[128];
+    sprintf(text, "Instances: %zu  Triangles: %zu  Frame: %.2fms", this->m_crowd.size(), this->m_triangles, this->m_frametime);
+    this->RenderText(8, 8, text, width, height);
+}
+
+
+/*==============================
+    ModelRenderer::RenderText
+    Draws text on the screen, with a shadow so it's readable
+    over anything. Only uppercase letters, numbers and some
+    punctuation are available, lowercase letters are shown in
+    uppercase.
+    @param The x position of the text, from the left, in pixels
+    @param The y position of the text, from the top, in pixels
+    @param The text to draw
+    @param The width of the frame, in pixels
+    @param The height of the frame, in pixels
+==============================*/
+
+void ModelRenderer::RenderText(int x, int y, std::string text, int width, int height)
+{
+    static GLubyte bitmaps[sizeof(font_glyphs)/sizeof(font_glyphs[0])][FONT_HEIGHT*FONT_SCALE][2];
+    static bool bitmapsbuilt = false;
+    const GLubyte space[FONT_HEIGHT*FONT_SCALE][2] = {{0}};
+    const char* chars = FONT_CHARS;
+
+    // Scale up the font, flipping it as glBitmap goes from the bottom up
+    if (!bitmapsbuilt)
+    {
+        memset(bitmaps, 0, sizeof(bitmaps));
+        for (size_t i=0; i<sizeof(font_glyphs)/sizeof(font_glyphs[0]); i++)
+            for (int row=0; row<FONT_HEIGHT*FONT_SCALE; row++)
+                for (int col=0; col<FONT_WIDTH*FONT_SCALE; col++)
+                    if (font_glyphs[i][FONT_HEIGHT - 1 - row/FONT_SCALE] & (0x10 >> (col/FONT_SCALE)))
+                        bitmaps[i][row][col/8] |= 0x80 >> (col%8);
+        bitmapsbuilt = true;
+    }
+
+    // Draw in screen space
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho(0, width, 0, height, -1, 1);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+    glLoadIdentity();
+    glDisable(GL_LIGHTING);
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_FOG);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int pass=0; pass<2; pass++)
+    {
+        if (pass == 0)
+            glColor3ub(0, 0, 0);
+        else
+            glColor3ub(255, 255, 255);
+        glRasterPos2i(x + 1 - pass, height - y - FONT_HEIGHT*FONT_SCALE - 1 + pass);
+        for (std::string::iterator it = text.begin(); it != text.end(); ++it)
+        {
+            const char* found = (*it != '\0') ? strchr(chars, toupper(*it)) : NULL;
+            const GLubyte* bitmap = (found != NULL) ? &bitmaps[found - chars][0][0] : &space[0][0];
+            glBitmap(FONT_WIDTH*FONT_SCALE, FONT_HEIGHT*FONT_SCALE, 0, 0, (FONT_WIDTH + 1)*FONT_SCALE, 0, bitmap);
+        }
+    }
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_TEXTURE_2D);
+    glEnable(GL_LIGHTING);
+    this->m_stateknown = false;
+}
+
+
+/*==============================
+    ModelRenderer::RenderCostLegend
+    Draws what the cost overlay's colors stand for on the top
+    left of the screen, along with the whole model's cost and
+    the selected mesh's cost
+    @param The model being rendered
+    @param The width of the frame, in pixels
+    @param The height of the frame, in pixels
+==============================*/
+
+void ModelRenderer::RenderCostLegend(s64Model* mdl, int width, int height)
+{
+    const char* names[] = COSTOVERLAY_NAMES;
+    const int lineheight = (FONT_HEIGHT + 3)*FONT_SCALE;
+    s64MeshCost total;
+    char text[256];
+    int y = 8;
+
+    // The range of the colors
+    if (settings_costoverlay == OVERLAY_1TRI)
+        sprintf(text, "%s: Blue 0.00 - Red 1.00", names[settings_costoverlay]);
+    else
+        sprintf(text, "%s: Blue 0 - Red %.0f", names[settings_costoverlay], GetMaxMeshCost(mdl, settings_costoverlay));
+    this->RenderText(8, y, text, width, height);
+    y += lineheight;
+
+    // The cost of the whole model
+    memset(&total, 0, sizeof(total));
+    for (std::vector<s64Mesh>::iterator itmesh = mdl->GetMeshList()->begin(); itmesh != mdl->GetMeshList()->end(); ++itmesh)
+    {
+        total.vertloads += itmesh->cost.vertloads;
+        total.texloads += itmesh->cost.texloads;
+        total.tri1 += itmesh->cost.tri1;
+        total.tri2 += itmesh->cost.tri2;
+        total.dlbytes += itmesh->cost.dlbytes;
+    }
+    sprintf(text, "Model: %zu verts  %zu textures  %zu/%zu 1tri/2tri  %zu bytes", total.vertloads, total.texloads, total.tri1, total.tri2, total.dlbytes);
+    this->RenderText(8, y, text, width, height);
+    y += lineheight;
+
+    // And the selected mesh
+    if (highlighted_mesh != NULL)
+    {
+        const s64MeshCost* cost = &highlighted_mesh->cost;
+        sprintf(text, "%.64s: %zu verts  %zu textures  %zu/%zu 1tri/2tri  %zu bytes", highlighted_mesh->name.c_str(), cost->vertloads, cost->texloads, cost->tri1, cost->tri2, cost->dlbytes);
+        this->RenderText(8, y, text, width, height);
+    }
+}
+
+
+/*==============================
+    ModelRenderer::GetCrowdRadius
+    Gets the size of the area covered by crowd mode, as of the
+    last time the crowd was built
+    @returns The radius of the crowd's bounding sphere
+==============================*/
+
+float ModelRenderer::GetCrowdRadius()
+{
+    return this->m_crowdradius;
+}
+
+
+/*==============================
+    ModelRenderer::AdvanceAnim
+    Advances the current animation by a given tick amount
+    @param The tick amount to advance the animation by
+==============================*/
+
+void ModelRenderer::AdvanceAnim(float tickamount)
+{
+    this->m_crowdtick += tickamount;
+    if (highlighted_anim == NULL)
+        return;
+    highlighted_anim_tick += tickamount;
+
+    // If the animation ended, call the callback function and roll the tick value over
+    if (highlighted_anim_tick >= highlighted_anim_length)
+    {       
+        float division = highlighted_anim_tick/((float)highlighted_anim_length);
+        highlighted_anim_tick = (division - ((int)division))*((float)highlighted_anim_length);
+    }
+    else if (highlighted_anim_tick <= 0)
+    { 
+        float division = highlighted_anim_tick/((float)highlighted_anim_length);
+        highlighted_anim_tick = (1 + (division - ((int)division)))*((float)highlighted_anim_length);
+    }
+}
+
+
+/*==============================
+    ModelRenderer::GetDrawCallCount
+    Gets how many draw calls the last rendered frame made
+    @returns The number of draw calls
+==============================*/
+
+size_t ModelRenderer::GetDrawCallCount()
+{
+    return this->m_drawcalls;
+}
+
+
+/*==============================
+    ModelRenderer::GetTriangleCount
+    Gets how many triangles the last rendered frame drew
+    @returns The number of triangles
+==============================*/
+
+size_t ModelRenderer::GetTriangleCount()
+{
+    return this->m_triangles;
+}
\ No newline at end of file
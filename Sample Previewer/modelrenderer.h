@@ -0,0 +1,186 @@
+#pragma once
+
+typedef struct IUnknown IUnknown;
+
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <wx/wx.h>
+#ifdef MACOS
+    #include <OpenGL/glu.h>
+#else
+    #include <GL/glu.h>
+#endif
+#include "Include/glm/glm/glm.hpp"
+#include "Include/glm/glm/ext/matrix_transform.hpp"
+#include "sausage.h"
+
+
+/*********************************
+              Macros
+*********************************/
+
+#define UPVECTORZ glm::vec3(0.0f, 0.0f, 1.0f)
+#define UPVECTORY glm::vec3(0.0f, 1.0f, 0.0f)
+
+// Names of the cost overlays, in the same order as costOverlay
+#define COSTOVERLAY_NAMES {"Off", "Vertex Loads", "Texture Loads", "Lone Triangles", "Display List Size"}
+
+
+/*********************************
+           Custom Types
+*********************************/
+
+// The mesh cost shown as a heat map on binary models
+typedef enum {
+    OVERLAY_NONE,
+    OVERLAY_VERTLOADS,
+    OVERLAY_TEXLOADS,
+    OVERLAY_1TRI,
+    OVERLAY_DLBYTES
+} costOverlay;
+
+
+/*********************************
+            Structures
+*********************************/
+
+// A vertex, as it's stored in a mesh's vertex buffer
+typedef struct {
+    GLfloat pos[3];
+    GLfloat normal[3];
+    GLfloat uv[2];
+} renderVert;
+
+// A range of a mesh's index buffer that uses the same material
+typedef struct {
+    n64Material* material;
+    GLsizei start;
+    GLsizei count;
+} renderRange;
+
+// The buffers used to render a mesh
+typedef struct {
+    GLuint vbo;
+    GLuint ibo;
+    std::vector<renderVert> verts;
+    std::vector<GLuint> indices;
+    std::vector<renderRange> ranges;
+} renderMesh;
+
+// A vertex of the grid and origin lines
+typedef struct {
+    GLfloat pos[3];
+    GLubyte color[4];
+} lineVert;
+
+// A mesh's transform at a given animation tick
+typedef struct {
+    glm::vec3 translation;
+    glm::vec3 scale;
+    glm::mat4 matrix;
+} renderPose;
+
+// A copy of the model in crowd mode
+typedef struct {
+    glm::vec3 offset;
+    s64Anim* anim;
+    float phase;
+} renderInstance;
+
+
+/*********************************
+             Globals
+*********************************/
+
+// Placeholder missing texture
+extern n64Material* texture_missing;
+extern GLuint texture_missing_id;
+
+// Highlighted objects
+extern s64Mesh* highlighted_mesh;
+extern n64Material* highlighted_material;
+extern s64Anim* highlighted_anim;
+
+// Highlighted animation information
+extern size_t highlighted_anim_length;
+extern float  highlighted_anim_tick;
+
+
+/*********************************
+            Functions
+*********************************/
+
+float GetModelBounds(s64Model* mdl, glm::vec3* center);
+
+
+/*********************************
+             Classes
+*********************************/
+
+class ModelRenderer
+{
+    private:
+        glm::vec3 m_campos;
+        glm::vec3 m_camdir;
+        s64Model* m_rendermodel;
+        bool m_buffersdirty;
+        std::vector<renderMesh> m_rendermeshes;
+        uint32_t m_staterevision;
+        bool m_stateknown;
+        uint32_t m_stateflags;
+        matType m_statetype;
+        GLuint m_statetexture;
+        s64Anim* m_poseanim;
+        std::vector<renderPose> m_posecache;
+        std::vector<bool> m_posecached;
+        std::vector<renderPose> m_lastposes;
+        float m_lastposetick;
+        size_t m_drawcalls;
+        size_t m_triangles;
+        bool m_gizmosbuilt;
+        bool m_gridyup;
+        GLuint m_gridvbo;
+        GLuint m_originvbo;
+        std::vector<lineVert> m_gridverts;
+        std::vector<lineVert> m_originverts;
+        s64Model* m_crowdmodel;
+        bool m_crowdyup;
+        std::vector<renderInstance> m_crowd;
+        std::vector<renderPose> m_crowdposes;
+        double m_crowdtick;
+        float m_crowdradius;
+        double m_frametime;
+
+    protected:
+
+    public:
+        ModelRenderer();
+        ~ModelRenderer();
+        void      InitializeOpenGL();
+        void      SetCamera(glm::vec3 pos, glm::vec3 dir);
+        void      Render(s64Model* mdl, int width, int height);
+        void      SetupView(int width, int height);
+        void      RenderGrid();
+        void      RenderOrigin(float x, float y, float z, float scale);
+        void      BuildGizmoBuffers();
+        void      RenderLines(GLuint vbo, const std::vector<lineVert>* verts);
+        void      RenderSausage64(s64Model* mdl);
+        void      BuildCrowd(s64Model* mdl);
+        void      EvaluateCrowd(s64Model* mdl);
+        void      RenderCrowd(s64Model* mdl);
+        void      RenderCrowdCounter(int width, int height);
+        void      RenderText(int x, int y, std::string text, int width, int height);
+        void      RenderCostLegend(s64Model* mdl, int width, int height);
+        float     GetCrowdRadius();
+        void      BuildRenderBuffers(s64Model* mdl);
+        void      FreeRenderBuffers();
+        void      SortRenderRanges();
+        void      ApplyMaterial(n64Material* mat);
+        void      InvalidateRenderBuffers();
+        void      EvaluatePoses(s64Model* mdl, s64Anim* anim, float tick, renderPose* poses);
+        const renderPose* GetAnimPoses(s64Model* mdl);
+        void      AdvanceAnim(float tickamount);
+        size_t    GetDrawCallCount();
+        size_t    GetTriangleCount();
+};
\ No newline at end of file
@@ -1,3 +1,8 @@
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <thread>
+#include <algorithm>
 #include "sausage.h"
 
 
@@ -5,7 +10,31 @@
               Macros
 *********************************/
 
-#define STRBUFF_SIZE 512
+// How many lines to parse between progress reports
+#define PROGRESS_LINES 4096
+
+
+/*********************************
+            Structures
+*********************************/
+
+// A top level mesh or animation block in a .S64 file
+typedef struct {
+    lexState type;
+    size_t start;
+    size_t end;
+} s64Block;
+
+// The contents of a block, before it is stitched into the model
+typedef struct {
+    bool success;
+    s64Mesh* mesh;
+    s64Anim* anim;
+    std::vector<std::string> materials;      // Material names, in order of first use
+    std::vector<unsigned int> facematerials; // Index into materials for each face
+    std::vector<std::string> meshnames;      // Mesh names, indexing each keyframe's frame data, if it wasn't reused
+    int reuse;                               // Index of the identical block in the previous model, or -1
+} s64BlockResult;
 
 
 /*==============================
@@ -15,7 +44,8 @@
 
 s64Model::s64Model()
 {
-    this->m_lexer_statestack.push(STATE_NONE);
+    this->m_reusedblocks = 0;
+    this->m_binary = false;
 }
 
 
@@ -26,11 +56,7 @@ s64Model::s64Model()
 
 s64Model::~s64Model()
 {
-    for (std::list<s64Mesh*>::iterator it = this->m_meshes.begin(); it != this->m_meshes.end(); ++it)
-        delete *it;
-    for (std::list<n64Material*>::iterator it = this->m_materials.begin(); it != this->m_materials.end(); ++it)
-        delete *it;
-    for (std::list<s64Anim*>::iterator it = this->m_anims.begin(); it != this->m_anims.end(); ++it)
+    for (std::vector<n64Material*>::iterator it = this->m_materials.begin(); it != this->m_materials.end(); ++it)
         delete *it;
 }
 
@@ -44,7 +70,7 @@ s64Model::~s64Model()
 
 n64Material* s64Model::GetMaterialFromName(std::string name)
 {
-    for (std::list<n64Material*>::iterator itmat = this->m_materials.begin(); itmat != this->m_materials.end(); ++itmat)
+    for (std::vector<n64Material*>::iterator itmat = this->m_materials.begin(); itmat != this->m_materials.end(); ++itmat)
         if (name == (*itmat)->name)
             return *itmat;
     return NULL;
@@ -52,45 +78,277 @@ n64Material* s64Model::GetMaterialFromName(std::string name)
 
 
 /*==============================
-    s64Model::GenerateFromFile
-    Generates a Sausage64 model from a .S64 file
-    @param The filepath to the .S64 model
-    @returns Whether the model generated successfully
+    FindInRange
+    Finds a string inside a range of text which isn't null
+    terminated
+    @param The start of the range
+    @param The end of the range
+    @param The string to find
+    @returns A pointer to the string inside the range, or NULL
+==============================*/
+
+static const char* FindInRange(const char* start, const char* end, const char* str)
+{
+    size_t len = strlen(str);
+    const char* found = std::search(start, end, str, str + len);
+    return (found == end) ? NULL : found;
+}
+
+
+/*==============================
+    NextToken
+    Splits off the next space separated token from a line of
+    text. Unlike strtok, this keeps its state in the cursor, so
+    that multiple threads can tokenize at the same time.
+    @param A pointer to the cursor, which is advanced past the token
+    @returns The null terminated token, or NULL if there are none left
+==============================*/
+
+static char* NextToken(char** cursor)
+{
+    char* start = *cursor;
+    char* end;
+    while (*start == ' ' || *start == '\t' || *start == '\r' || *start == '\n')
+        start++;
+    if (*start == '\0')
+    {
+        *cursor = start;
+        return NULL;
+    }
+    end = start;
+    while (*end != '\0' && *end != ' ' && *end != '\t' && *end != '\r' && *end != '\n')
+        end++;
+    if (*end != '\0')
+        *end++ = '\0';
+    *cursor = end;
+    return start;
+}
+
+
+/*==============================
+    NextFloat
+    Reads the next token from a line of text as a float
+    @param A pointer to the cursor, which is advanced past the token
+    @returns The value of the token, or zero if there are none left
+==============================*/
+
+static float NextFloat(char** cursor)
+{
+    char* token = NextToken(cursor);
+    return (token == NULL) ? 0.0f : (float)atof(token);
+}
+
+
+/*==============================
+    NextInt
+    Reads the next token from a line of text as an integer
+    @param A pointer to the cursor, which is advanced past the token
+    @returns The value of the token, or zero if there are none left
+==============================*/
+
+static int NextInt(char** cursor)
+{
+    char* token = NextToken(cursor);
+    return (token == NULL) ? 0 : atoi(token);
+}
+
+
+/*==============================
+    FindBlocks
+    Scans a .S64 file for its top level mesh and animation
+    blocks, following the same comment rules as the parser
+    @param The contents of the file
+    @param The size of the file
+    @param The vector to add the blocks to, in file order
+==============================*/
+
+static void FindBlocks(const char* text, size_t size, std::vector<s64Block>* blocks)
+{
+    const char* line = text;
+    const char* fileend = text + size;
+    bool incomment = false;
+    int depth = 0;
+    s64Block block;
+    while (line < fileend)
+    {
+        const char* lineend = (const char*)memchr(line, '\n', fileend - line);
+        const char* next = (lineend == NULL) ? fileend : lineend + 1;
+        const char* cursor = line;
+        if (lineend == NULL)
+            lineend = fileend;
+
+        // Lines that are just numbers can't change the block structure
+        while (cursor < lineend && (*cursor == ' ' || *cursor == '\t'))
+            cursor++;
+        if (!incomment && (cursor == lineend || (*cursor >= '0' && *cursor <= '9') || *cursor == '-') && memchr(line, '/', lineend - line) == NULL)
+        {
+            line = next;
+            continue;
+        }
+
+        // Go through each token in the line
+        while (cursor < lineend)
+        {
+            const char* tokenend = cursor;
+            while (tokenend < lineend && *tokenend != ' ' && *tokenend != '\t' && *tokenend != '\r')
+                tokenend++;
+            if (tokenend == cursor)
+            {
+                cursor++;
+                continue;
+            }
+
+            // Handle comments
+            if (incomment)
+            {
+                if (FindInRange(cursor, tokenend, "*/") != NULL)
+                    incomment = false;
+                cursor = tokenend;
+                continue;
+            }
+            if (FindInRange(cursor, tokenend, "//") != NULL)
+                break;
+            if (FindInRange(cursor, tokenend, "/*") != NULL)
+            {
+                incomment = true;
+                break;
+            }
+
+            // Track the depth of the blocks
+            if (tokenend - cursor == 5 && !strncmp(cursor, "BEGIN", 5))
+            {
+                if (depth == 0)
+                {
+                    const char* type = tokenend;
+                    while (type < lineend && (*type == ' ' || *type == '\t'))
+                        type++;
+                    if (lineend - type >= 4 && !strncmp(type, "MESH", 4))
+                        block.type = STATE_MESH;
+                    else if (lineend - type >= 9 && !strncmp(type, "ANIMATION", 9))
+                        block.type = STATE_ANIMATION;
+                    else
+                        break;
+                    block.start = line - text;
+                }
+                depth++;
+                break;
+            }
+            else if (tokenend - cursor == 3 && !strncmp(cursor, "END", 3))
+            {
+                if (depth > 0 && --depth == 0)
+                {
+                    block.end = next - text;
+                    blocks->push_back(block);
+                }
+            }
+            cursor = tokenend;
+        }
+        line = next;
+    }
+}
+
+
+/*==============================
+    HashBlock
+    Hashes the text of a block with FNV-1a, so that blocks which
+    didn't change between two versions of a file can be found
+    @param The text of the block
+    @param The size of the block
+    @returns The hash of the block
 ==============================*/
 
-bool s64Model::GenerateFromFile(std::string path)
+static uint64_t HashBlock(const char* text, size_t size)
 {
-    s64Mesh* curmesh = NULL;
-    s64Vert* curvert = NULL;
-    s64Face* prevface = NULL;
-    s64Face* curface = NULL;
-    s64Anim* curanim = NULL;
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i=0; i<size; i++)
+    {
+        hash ^= (unsigned char)text[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+
+/*==============================
+    ReuseBlock
+    Fills in a block's results by copying the mesh or animation
+    that was generated from the same text in a previous model,
+    instead of parsing it again
+    @param The model to copy from
+    @param The index of the mesh or animation in the previous model
+    @param The struct to store the results in
+==============================*/
+
+static void ReuseBlock(s64Model* previous, size_t index, s64BlockResult* result)
+{
+    if (result->mesh != NULL)
+    {
+        s64Mesh* mesh = &(*previous->GetMeshList())[index];
+        *result->mesh = *mesh;
+        result->mesh->parentindex = -1;
+
+        // Turn the face materials back into names, so they can be stitched like a parsed block
+        for (std::vector<n64Material*>::iterator itmat = mesh->materials.begin(); itmat != mesh->materials.end(); ++itmat)
+            result->materials.push_back((*itmat)->name);
+        for (std::vector<s64Face>::iterator itface = mesh->faces.begin(); itface != mesh->faces.end(); ++itface)
+            result->facematerials.push_back(std::find(mesh->materials.begin(), mesh->materials.end(), itface->material) - mesh->materials.begin());
+    }
+    else
+    {
+        // The frame data stays indexed by the previous model's meshes, until it is stitched
+        *result->anim = (*previous->GetAnimList())[index];
+    }
+    result->success = true;
+}
+
+
+/*==============================
+    ParseBlock
+    Parses a single top level block of a .S64 file. The names of
+    materials and meshes are kept as they are, so that they can
+    be resolved once every block has been parsed.
+    @param The text of the block, which will be modified
+    @param The size of the block
+    @param The struct to store the results in
+    @param The struct to report progress to, or NULL
+==============================*/
+
+static void ParseBlock(char* text, size_t size, s64BlockResult* result, s64LoadProgress* progress)
+{
+    char* line = text;
+    char* reported = text;
+    char* blockend = text + size;
+    unsigned int lines = 0;
+    std::stack<lexState> statestack;
+    std::map<std::string, unsigned int> matindices;
+    std::map<std::string, unsigned int> meshindices;
+    s64Mesh* curmesh = result->mesh;
+    s64Anim* curanim = result->anim;
     s64Keyframe* curkeyframe = NULL;
-    s64FrameData* curframedata = NULL;
-    n64Material* curmat = NULL;
-    std::list<s64Vert*>::iterator vertit;
-    FILE* fp = fopen(path.c_str(), "r+");
-    if (fp == NULL)
-        return false;
+    result->success = false;
+    statestack.push(STATE_NONE);
 
-    // Read the file until we reached the end
-    while (!feof(fp))
+    // Parse each line in the block
+    while (line < blockend)
     {
-        char strbuf[STRBUFF_SIZE];
+        char* lineend = (char*)memchr(line, '\n', blockend - line);
+        char* next = (lineend == NULL) ? blockend : lineend + 1;
+        char* cursor = line;
         char* strdata;
+        if (lineend != NULL)
+            *lineend = '\0';
 
-        // Read a string from the text file
-        if (fgets(strbuf, STRBUFF_SIZE, fp) == NULL && !feof(fp))
+        // Report our progress every so often, and stop if we were cancelled
+        if (progress != NULL && ((++lines) % PROGRESS_LINES) == 0)
         {
-            fclose(fp);
-            return false;
+            progress->read += (long)(line - reported);
+            reported = line;
+            if (progress->cancel)
+                return;
         }
 
-        // Split the string by spaces
-        strdata = strtok(strbuf, " ");
-
         // Parse each substring
-        do
+        while ((strdata = NextToken(&cursor)) != NULL)
         {
             // Handle C comment lines
             if (strstr(strdata, "//") != NULL)
@@ -99,213 +357,435 @@ bool s64Model::GenerateFromFile(std::string path)
             // Handle C comment block starting
             if (strstr(strdata, "/*") != NULL)
             {
-                this->m_lexer_statestack.push(STATE_COMMENTBLOCK);
+                statestack.push(STATE_COMMENTBLOCK);
                 break;
             }
 
             // Handle C comment blocks
-            if (this->m_lexer_statestack.top() == STATE_COMMENTBLOCK)
+            if (statestack.top() == STATE_COMMENTBLOCK)
             {
                 if (strstr(strdata, "*/") != NULL)
-                    this->m_lexer_statestack.pop();
+                    statestack.pop();
                 continue;
             }
 
             // Handle Begin
             if (!strcmp(strdata, "BEGIN"))
             {
-                // Handle the next substring
-                strdata = strtok(NULL, " ");
-                switch (this->m_lexer_statestack.top())
+                strdata = NextToken(&cursor);
+                if (strdata == NULL)
+                    break;
+                switch (statestack.top())
                 {
                     case STATE_MESH:
-                        strdata[strcspn(strdata, "\r\n")] = 0;
                         if (!strcmp(strdata, "VERTICES"))
-                            this->m_lexer_statestack.push(STATE_VERTICES);
+                            statestack.push(STATE_VERTICES);
                         else if (!strcmp(strdata, "FACES"))
-                            this->m_lexer_statestack.push(STATE_FACES);
+                            statestack.push(STATE_FACES);
                         break;
                     case STATE_ANIMATION:
                         if (!strcmp(strdata, "KEYFRAME"))
                         {
-                            this->m_lexer_statestack.push(STATE_KEYFRAME);
-                            curkeyframe = new s64Keyframe();
-                            curkeyframe->keyframe = atoi(strtok(NULL, " "));
-                            curanim->keyframes.push_back(curkeyframe);
+                            statestack.push(STATE_KEYFRAME);
+                            curanim->keyframes.push_back(s64Keyframe());
+                            curkeyframe = &curanim->keyframes.back();
+                            curkeyframe->keyframe = NextInt(&cursor);
                         }
                         break;
                     case STATE_NONE:
-                        if (!strcmp(strdata, "MESH"))
+                        if (!strcmp(strdata, "MESH") && curmesh != NULL)
                         {
-                            this->m_lexer_statestack.push(STATE_MESH);
-
-                            // Get the mesh name and fix the trailing newline
-                            strdata = strtok(NULL, " ");
-                            strdata[strcspn(strdata, "\r\n")] = 0;
-
-                            // Create and initialize the mesh
-                            curmesh = new s64Mesh();
-                            curmesh->name = strdata;
-                            this->m_meshes.push_back(curmesh);
+                            statestack.push(STATE_MESH);
+                            strdata = NextToken(&cursor);
+                            curmesh->name = (strdata != NULL) ? strdata : "";
                         }
-                        else if (!strcmp(strdata, "ANIMATION"))
+                        else if (!strcmp(strdata, "ANIMATION") && curanim != NULL)
                         {
-                            this->m_lexer_statestack.push(STATE_ANIMATION);
-
-                            // Get the animation name and fix the trailing newline
-                            strdata = strtok(NULL, " ");
-                            strdata[strcspn(strdata, "\r\n")] = 0;
-
-                            // Create the animation
-                            curanim = new s64Anim();
-                            curanim->name = strdata;
-                            this->m_anims.push_back(curanim);
+                            statestack.push(STATE_ANIMATION);
+                            strdata = NextToken(&cursor);
+                            curanim->name = (strdata != NULL) ? strdata : "";
                         }
                         break;
                     default: break;
                 }
+                break;
             }
             else if (!strcmp(strdata, "END")) // Handle End
             {
-                this->m_lexer_statestack.pop();
+                statestack.pop();
+                if (statestack.empty())
+                    return;
             }
             else
             {
                 int vertcount;
-                switch (this->m_lexer_statestack.top())
+                unsigned int quadverts[4];
+                std::map<std::string, unsigned int>::iterator itindex;
+                s64Vert* curvert;
+                s64Face* curface;
+                s64FrameData* curframedata;
+                switch (statestack.top())
                 {
                     case STATE_MESH:
                         if (!strcmp(strdata, "ROOT"))
                         {
-                            curmesh->root.x = (float)atof(strtok(NULL, " "));
-                            curmesh->root.y = (float)atof(strtok(NULL, " "));
-                            curmesh->root.z = (float)atof(strtok(NULL, " "));
+                            curmesh->root.x = NextFloat(&cursor);
+                            curmesh->root.y = NextFloat(&cursor);
+                            curmesh->root.z = NextFloat(&cursor);
+                        }
+                        else if (!strcmp(strdata, "PARENT"))
+                        {
+                            strdata = NextToken(&cursor);
+                            if (strdata != NULL)
+                                curmesh->parent = strdata;
                         }
-                        if (!strcmp(strdata, "PROPERTIES"))
+                        else if (!strcmp(strdata, "PROPERTIES"))
                         {
-                            while ((strdata = strtok(NULL, " ")) != NULL)
-                            {
-                                strdata[strcspn(strdata, "\r\n")] = 0;
+                            while ((strdata = NextToken(&cursor)) != NULL)
                                 curmesh->props.push_back(strdata);
-                            }
                             curmesh->ParseProperties();
                         }
                         break;
                     case STATE_VERTICES:
-                        curvert = new s64Vert();
-                        curmesh->verts.push_back(curvert);
+                        curmesh->verts.push_back(s64Vert());
+                        curvert = &curmesh->verts.back();
 
                         // Set the vertex data
                         curvert->pos.x = (float)atof(strdata) - curmesh->root.x;
-                        curvert->pos.y = (float)atof(strtok(NULL, " ")) - curmesh->root.y;
-                        curvert->pos.z = (float)atof(strtok(NULL, " ")) - curmesh->root.z;
-                        curvert->normal.x = (float)atof(strtok(NULL, " "));
-                        curvert->normal.y = (float)atof(strtok(NULL, " "));
-                        curvert->normal.z = (float)atof(strtok(NULL, " "));
-                        curvert->color.x = (float)atof(strtok(NULL, " "));
-                        curvert->color.y = (float)atof(strtok(NULL, " "));
-                        curvert->color.z = (float)atof(strtok(NULL, " "));
-                        curvert->UV.x = (float)atof(strtok(NULL, " "));
-                        curvert->UV.y = (float)atof(strtok(NULL, " "));
+                        curvert->pos.y = NextFloat(&cursor) - curmesh->root.y;
+                        curvert->pos.z = NextFloat(&cursor) - curmesh->root.z;
+                        curvert->normal.x = NextFloat(&cursor);
+                        curvert->normal.y = NextFloat(&cursor);
+                        curvert->normal.z = NextFloat(&cursor);
+                        curvert->color.x = NextFloat(&cursor);
+                        curvert->color.y = NextFloat(&cursor);
+                        curvert->color.z = NextFloat(&cursor);
+                        curvert->UV.x = NextFloat(&cursor);
+                        curvert->UV.y = NextFloat(&cursor);
                         break;
                     case STATE_FACES:
 
-                        curface = new s64Face();
-                        curmesh->faces.push_back(curface);
-
-                        // Set the face data
+                        // Read the vertex indices
                         vertcount = atoi(strdata);
-                        if (vertcount > 4)
+                        if (vertcount < 3 || vertcount > 4)
+                            return;
+                        for (int i=0; i<vertcount; i++)
+                            quadverts[i] = (unsigned int)NextInt(&cursor);
+
+                        // Get the material index, adding the material if this is its first use
+                        strdata = NextToken(&cursor);
+                        if (strdata == NULL)
+                            return;
+                        itindex = matindices.find(strdata);
+                        if (itindex == matindices.end())
                         {
-                            fclose(fp);
-                            return false;
+                            itindex = matindices.insert(std::make_pair(std::string(strdata), (unsigned int)result->materials.size())).first;
+                            result->materials.push_back(strdata);
                         }
-                        curface->verts.push_back(curmesh->GetVertFromIndex(atoi(strtok(NULL, " "))));
-                        curface->verts.push_back(curmesh->GetVertFromIndex(atoi(strtok(NULL, " "))));
-                        curface->verts.push_back(curmesh->GetVertFromIndex(atoi(strtok(NULL, " "))));
 
-                        // Handle quads
-                        prevface = NULL;
+                        // Create the face, splitting quads into two triangles
+                        curmesh->faces.push_back(s64Face());
+                        curface = &curmesh->faces.back();
+                        curface->verts[0] = quadverts[0];
+                        curface->verts[1] = quadverts[1];
+                        curface->verts[2] = quadverts[2];
+                        result->facematerials.push_back(itindex->second);
                         if (vertcount == 4)
                         {
-                            prevface = curface;
-                            curface = new s64Face();
-                            curmesh->faces.push_back(curface);
-                            curface->verts.push_back(prevface->GetVertFromIndex(0));
-                            curface->verts.push_back(prevface->GetVertFromIndex(2));
-                            curface->verts.push_back(curmesh->GetVertFromIndex(atoi(strtok(NULL, " "))));
-                        }
-
-                        // Get the material name and check if it exists already
-                        strdata = strtok(NULL, " ");
-                        strdata[strcspn(strdata, "\r\n")] = 0;
-                        curmat = this->GetMaterialFromName(strdata);
-                        if (curmat == NULL)
-                        {
-                            curmat = new n64Material(TYPE_UNKNOWN);
-                            curmat->name = strdata;
-                            this->m_materials.push_back(curmat);
-                        }
-                        curface->material = curmat;
-
-                        // Assign the face to the previous face as well, if we have a quad
-                        if (prevface != NULL)
-                        {
-                            prevface->material = curmat;
-                            prevface = NULL;
+                            curmesh->faces.push_back(s64Face());
+                            curface = &curmesh->faces.back();
+                            curface->verts[0] = quadverts[0];
+                            curface->verts[1] = quadverts[2];
+                            curface->verts[2] = quadverts[3];
+                            result->facematerials.push_back(itindex->second);
                         }
-
-                        // If this material hasn't been added to this mesh yet, do so
-                        if (curmesh->GetMaterialFromName(strdata) == NULL)
-                            curmesh->materials.push_back(curmat);
                         break;
                     case STATE_KEYFRAME:
-                        curframedata = new s64FrameData();
-                        curkeyframe->framedata.push_back(curframedata);
-                        for (std::list<s64Mesh*>::iterator itfdata = this->m_meshes.begin(); itfdata != this->m_meshes.end(); ++itfdata)
+
+                        // Get the mesh index, adding the mesh if this is its first use
+                        itindex = meshindices.find(strdata);
+                        if (itindex == meshindices.end())
                         {
-                            if (!strcmp(strdata, (*itfdata)->name.c_str()))
-                            {
-                                curframedata->mesh = (*itfdata);
-                                break;
-                            }
+                            itindex = meshindices.insert(std::make_pair(std::string(strdata), (unsigned int)result->meshnames.size())).first;
+                            result->meshnames.push_back(strdata);
                         }
-                        curframedata->translation.x = (float)atof(strtok(NULL, " "));
-                        curframedata->translation.y = (float)atof(strtok(NULL, " "));
-                        curframedata->translation.z = (float)atof(strtok(NULL, " "));
-                        curframedata->rotation.w = (float)atof(strtok(NULL, " "));
-                        curframedata->rotation.x = (float)atof(strtok(NULL, " "));
-                        curframedata->rotation.y = (float)atof(strtok(NULL, " "));
-                        curframedata->rotation.z = (float)atof(strtok(NULL, " "));
-                        curframedata->scale.x = (float)atof(strtok(NULL, " "));
-                        curframedata->scale.y = (float)atof(strtok(NULL, " "));
-                        curframedata->scale.z = (float)atof(strtok(NULL, " "));
+                        if (itindex->second >= curkeyframe->framedata.size())
+                            curkeyframe->framedata.resize(itindex->second + 1);
+                        curframedata = &curkeyframe->framedata[itindex->second];
+                        curframedata->translation.x = NextFloat(&cursor);
+                        curframedata->translation.y = NextFloat(&cursor);
+                        curframedata->translation.z = NextFloat(&cursor);
+                        curframedata->rotation.w = NextFloat(&cursor);
+                        curframedata->rotation.x = NextFloat(&cursor);
+                        curframedata->rotation.y = NextFloat(&cursor);
+                        curframedata->rotation.z = NextFloat(&cursor);
+                        curframedata->scale.x = NextFloat(&cursor);
+                        curframedata->scale.y = NextFloat(&cursor);
+                        curframedata->scale.z = NextFloat(&cursor);
                         break;
                     default: break;
                 }
+                break;
             }
-
         }
-        while ((strdata = strtok(NULL, " ")) != NULL);
+        line = next;
     }
+    if (progress != NULL)
+        progress->read += (long)(blockend - reported);
+    result->success = true;
+}
+
 
-    // Close the file, as we're done with it.
+/*==============================
+    RemapMesh
+    Finds where a mesh that an animation refers to ended up in
+    the final model, and adds it to the animation's remap table
+    @param The final index of each mesh name in the model
+    @param The name of the mesh
+    @param The remap table to add the mesh to
+    @param A flag to clear if the table stops being the identity
+    @param The number of meshes in the model
+==============================*/
+
+static void RemapMesh(std::map<std::string, size_t>* meshindices, const std::string& name, std::vector<int>* remap, bool* inorder, size_t meshcount)
+{
+    std::map<std::string, size_t>::iterator itmesh = meshindices->find(name);
+    int index = (itmesh != meshindices->end()) ? (int)itmesh->second : -1;
+    *inorder = *inorder && index == (int)remap->size() && remap->size() < meshcount;
+    remap->push_back(index);
+}
+
+
+/*==============================
+    RemapFrames
+    Reorders the frame data of an animation's keyframes so that
+    it is indexed by the model's final mesh order
+    @param The animation to remap
+    @param The final index for each of the frame data's meshes, or -1
+    @param Whether the remap table is the identity
+    @param The number of meshes in the model
+==============================*/
+
+static void RemapFrames(s64Anim* anim, const std::vector<int>& remap, bool inorder, size_t meshcount)
+{
+    for (std::vector<s64Keyframe>::iterator itkeyf = anim->keyframes.begin(); itkeyf != anim->keyframes.end(); ++itkeyf)
+    {
+        std::vector<s64FrameData> framedata;
+        if (inorder && itkeyf->framedata.size() == meshcount)
+            continue;
+        framedata.resize(meshcount);
+        for (size_t m=0; m<itkeyf->framedata.size() && m<remap.size(); m++)
+            if (remap[m] != -1)
+                framedata[remap[m]] = itkeyf->framedata[m];
+        itkeyf->framedata.swap(framedata);
+    }
+}
+
+
+/*==============================
+    s64Model::GenerateFromFile
+    Generates a Sausage64 model from a .S64 file. The file is
+    split into its top level blocks, which are parsed in
+    parallel and then stitched together in file order.
+    If a previous version of the model is given, blocks whose
+    text didn't change are copied from it instead of parsed.
+    @param The filepath to the .S64 model
+    @param The struct to report progress to and check for
+           cancellation with, or NULL
+    @param The previously generated version of this model, or NULL
+    @returns Whether the model generated successfully
+==============================*/
+
+bool s64Model::GenerateFromFile(std::string path, s64LoadProgress* progress, s64Model* previous)
+{
+    long size;
+    std::vector<char> text;
+    std::vector<s64Block> blocks;
+    std::vector<s64BlockResult> results;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextblock(0);
+    std::map<std::string, n64Material*> materials;
+    std::map<std::string, size_t> meshindices;
+    std::map<std::pair<uint64_t, size_t>, int> previousmeshes;
+    std::map<std::pair<uint64_t, size_t>, int> previousanims;
+    std::vector<int> previousremap;
+    bool previousinorder = true;
+    bool previousremapped = false;
+    size_t meshcount = 0;
+    size_t animcount = 0;
+    unsigned int threads;
+    FILE* fp = fopen(path.c_str(), "rb");
+    if (fp == NULL)
+        return false;
+
+    // Read the entire file into memory
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    text.resize(size + 1);
+    if (size < 0 || fread(&text[0], 1, size, fp) != (size_t)size)
+    {
+        fclose(fp);
+        return false;
+    }
+    text[size] = '\0';
     fclose(fp);
+    if (progress != NULL)
+        progress->total = size;
+
+    // Index the blocks of the previous model by their hash
+    if (previous != NULL)
+    {
+        for (std::vector<s64BlockInfo>::iterator it = previous->m_blocks.begin(); it != previous->m_blocks.end(); ++it)
+        {
+            if (it->type == STATE_MESH)
+                previousmeshes.insert(std::make_pair(std::make_pair(it->hash, it->size), (int)(meshcount++)));
+            else
+                previousanims.insert(std::make_pair(std::make_pair(it->hash, it->size), (int)(animcount++)));
+        }
+        meshcount = 0;
+        animcount = 0;
+    }
+
+    // Find the blocks, and give each one the mesh or animation it will fill in
+    FindBlocks(&text[0], size, &blocks);
+    results.resize(blocks.size());
+    this->m_blocks.resize(blocks.size());
+    for (std::vector<s64Block>::iterator it = blocks.begin(); it != blocks.end(); ++it)
+    {
+        if (it->type == STATE_MESH)
+            meshcount++;
+        else
+            animcount++;
+    }
+    this->m_meshes.resize(meshcount);
+    this->m_anims.resize(animcount);
+    meshcount = 0;
+    animcount = 0;
+    for (size_t i=0; i<blocks.size(); i++)
+    {
+        results[i].mesh = (blocks[i].type == STATE_MESH) ? &this->m_meshes[meshcount++] : NULL;
+        results[i].anim = (blocks[i].type == STATE_ANIMATION) ? &this->m_anims[animcount++] : NULL;
+        results[i].reuse = -1;
+        this->m_blocks[i].type = blocks[i].type;
+        this->m_blocks[i].size = blocks[i].end - blocks[i].start;
+    }
+
+    // Parse the blocks on a pool of worker threads
+    threads = std::max(1u, std::min(std::thread::hardware_concurrency(), (unsigned int)blocks.size()));
+    for (unsigned int i=0; i<threads; i++)
+    {
+        workers.push_back(std::thread([&]{
+            size_t index;
+            while ((index = nextblock++) < blocks.size())
+            {
+                s64BlockInfo* info = &this->m_blocks[index];
+                std::map<std::pair<uint64_t, size_t>, int>* previousblocks = (info->type == STATE_MESH) ? &previousmeshes : &previousanims;
+                std::map<std::pair<uint64_t, size_t>, int>::iterator itprev;
+                if (progress != NULL && progress->cancel)
+                    break;
+
+                // Hash the block before parsing it, as the parser modifies the text
+                info->hash = HashBlock(&text[blocks[index].start], info->size);
+                itprev = previousblocks->find(std::make_pair(info->hash, info->size));
+                if (itprev != previousblocks->end())
+                    results[index].reuse = itprev->second;
+                if (results[index].reuse != -1)
+                {
+                    ReuseBlock(previous, results[index].reuse, &results[index]);
+                    if (progress != NULL)
+                        progress->read += (long)info->size;
+                }
+                else
+                    ParseBlock(&text[blocks[index].start], info->size, &results[index], progress);
+            }
+        }));
+    }
+    for (std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+        it->join();
+    if (progress != NULL && progress->cancel)
+        return false;
+    for (std::vector<s64BlockResult>::iterator it = results.begin(); it != results.end(); ++it)
+    {
+        if (!it->success)
+            return false;
+        if (it->reuse != -1)
+            this->m_reusedblocks++;
+    }
 
-    // Correct animation keyframes that don't start on zero
-    for (std::list<s64Anim*>::iterator itanim = this->m_anims.begin(); itanim != this->m_anims.end(); ++itanim)
+    // Stitch the meshes together in file order, creating the materials as they are first used
+    for (size_t i=0; i<blocks.size(); i++)
+    {
+        s64BlockResult* result = &results[i];
+        s64Mesh* mesh = result->mesh;
+        std::vector<n64Material*> blockmats;
+        if (mesh == NULL)
+            continue;
+        for (std::vector<std::string>::iterator itname = result->materials.begin(); itname != result->materials.end(); ++itname)
+        {
+            n64Material*& mat = materials[*itname];
+            if (mat == NULL)
+            {
+                mat = new n64Material(TYPE_UNKNOWN);
+                mat->name = *itname;
+                this->m_materials.push_back(mat);
+            }
+            blockmats.push_back(mat);
+        }
+        meshindices[mesh->name] = mesh - &this->m_meshes[0];
+        mesh->materials = blockmats;
+        for (size_t j=0; j<mesh->faces.size(); j++)
+            mesh->faces[j].material = blockmats[result->facematerials[j]];
+    }
+
+    // Resolve the mesh parents
+    for (std::vector<s64Mesh>::iterator itmesh = this->m_meshes.begin(); itmesh != this->m_meshes.end(); ++itmesh)
+    {
+        std::map<std::string, size_t>::iterator itparent = meshindices.find(itmesh->parent);
+        if (!itmesh->parent.empty() && itparent != meshindices.end())
+            itmesh->parentindex = (int)itparent->second;
+    }
+
+    // Stitch the animations together, remapping their frame data to the final mesh order
+    for (size_t i=0; i<blocks.size(); i++)
+    {
+        s64BlockResult* result = &results[i];
+        if (result->anim == NULL)
+            continue;
+        if (result->reuse != -1)
+        {
+            if (!previousremapped)
+            {
+                for (std::vector<s64Mesh>::iterator itmesh = previous->m_meshes.begin(); itmesh != previous->m_meshes.end(); ++itmesh)
+                    RemapMesh(&meshindices, itmesh->name, &previousremap, &previousinorder, this->m_meshes.size());
+                previousremapped = true;
+            }
+            RemapFrames(result->anim, previousremap, previousinorder, this->m_meshes.size());
+        }
+        else
+        {
+            std::vector<int> remap;
+            bool inorder = true;
+            for (std::vector<std::string>::iterator itname = result->meshnames.begin(); itname != result->meshnames.end(); ++itname)
+                RemapMesh(&meshindices, *itname, &remap, &inorder, this->m_meshes.size());
+            RemapFrames(result->anim, remap, inorder, this->m_meshes.size());
+        }
+    }
+
+    // Correct animation keyframes that don't start on zero, and build the tick lookup tables
+    for (std::vector<s64Anim>::iterator itanim = this->m_anims.begin(); itanim != this->m_anims.end(); ++itanim)
     {
         int firstframe = -1;
-        s64Anim* anim = *itanim;
-        for (std::list<s64Keyframe*>::iterator itkeyf = anim->keyframes.begin(); itkeyf != anim->keyframes.end(); ++itkeyf)
+        s64Anim* anim = &(*itanim);
+        for (std::vector<s64Keyframe>::iterator itkeyf = anim->keyframes.begin(); itkeyf != anim->keyframes.end(); ++itkeyf)
         {
-            s64Keyframe* keyf = *itkeyf;
-            if (firstframe == -1 && keyf->keyframe == 0)
+            if (firstframe == -1 && itkeyf->keyframe == 0)
                 break;
-            if (firstframe == -1 && keyf->keyframe != 0)
-                firstframe = keyf->keyframe;
-            keyf->keyframe -= firstframe;
+            if (firstframe == -1 && itkeyf->keyframe != 0)
+                firstframe = itkeyf->keyframe;
+            itkeyf->keyframe -= firstframe;
         }
+        anim->BuildLookup(this->m_meshes.size());
     }
 
     // Return success
@@ -313,6 +793,66 @@ bool s64Model::GenerateFromFile(std::string path)
 }
 
 
+/*==============================
+    s64Model::AdoptMaterials
+    Takes over the materials of a previous version of this model
+    which share a name with this model's materials, so that their
+    settings and textures survive a reload. The adopted materials
+    are removed from the previous model. Must be called from the
+    OpenGL thread, as the replaced materials are deleted.
+    @param The previous version of this model
+    @returns The number of materials that weren't in the previous model
+==============================*/
+
+size_t s64Model::AdoptMaterials(s64Model* previous)
+{
+    size_t created = 0;
+    std::map<n64Material*, n64Material*> replaced;
+    for (std::vector<n64Material*>::iterator itmat = this->m_materials.begin(); itmat != this->m_materials.end(); ++itmat)
+    {
+        std::vector<n64Material*>::iterator itprev;
+        for (itprev = previous->m_materials.begin(); itprev != previous->m_materials.end(); ++itprev)
+            if ((*itprev)->name == (*itmat)->name)
+                break;
+        if (itprev == previous->m_materials.end())
+        {
+            created++;
+            continue;
+        }
+        replaced[*itmat] = *itprev;
+        *itmat = *itprev;
+        previous->m_materials.erase(itprev);
+    }
+
+    // Point the meshes at the adopted materials, then get rid of the ones they replaced
+    for (std::vector<s64Mesh>::iterator itmesh = this->m_meshes.begin(); itmesh != this->m_meshes.end() && replaced.size() > 0; ++itmesh)
+    {
+        for (std::vector<n64Material*>::iterator itmat = itmesh->materials.begin(); itmat != itmesh->materials.end(); ++itmat)
+            if (replaced.count(*itmat) > 0)
+                *itmat = replaced[*itmat];
+        for (std::vector<s64Face>::iterator itface = itmesh->faces.begin(); itface != itmesh->faces.end(); ++itface)
+            if (replaced.count(itface->material) > 0)
+                itface->material = replaced[itface->material];
+    }
+    for (std::map<n64Material*, n64Material*>::iterator it = replaced.begin(); it != replaced.end(); ++it)
+        delete it->first;
+    return created;
+}
+
+
+/*==============================
+    s64Model::GetReusedBlockCount
+    Gets how many blocks were copied from the previous version of
+    the model when it was generated, instead of being parsed
+    @returns The number of reused blocks
+==============================*/
+
+size_t s64Model::GetReusedBlockCount()
+{
+    return this->m_reusedblocks;
+}
+
+
 /*==============================
     s64Model::GetMeshCount
     Gets the number of meshes in this model
@@ -355,7 +895,7 @@ int s64Model::GetAnimCount()
     @returns A pointer to the list of meshes
 ==============================*/
 
-std::list<s64Mesh*>* s64Model::GetMeshList()
+std::vector<s64Mesh>* s64Model::GetMeshList()
 {
     return &this->m_meshes;
 }
@@ -367,7 +907,7 @@ std::list<s64Mesh*>* s64Model::GetMeshList()
     @returns A pointer to the list of materials
 ==============================*/
 
-std::list<n64Material*>* s64Model::GetMaterialList()
+std::vector<n64Material*>* s64Model::GetMaterialList()
 {
     return &this->m_materials;
 }
@@ -379,7 +919,7 @@ std::list<n64Material*>* s64Model::GetMaterialList()
     @returns A pointer to the list of animations
 ==============================*/
 
-std::list<s64Anim*>* s64Model::GetAnimList()
+std::vector<s64Anim>* s64Model::GetAnimList()
 {
     return &this->m_anims;
 }
\ No newline at end of file
@@ -4,7 +4,9 @@ typedef struct IUnknown IUnknown;
 
 #include <string>
 #include <list>
+#include <vector>
 #include <stack>
+#include <atomic>
 #include "Include/glm/glm/glm.hpp"
 #include "sausage_material.h"
 #include "sausage_mesh.h"
@@ -26,6 +28,25 @@ typedef enum {
 } lexState;
 
 
+/*********************************
+            Structures
+*********************************/
+
+// Progress of a model that's being generated on another thread
+typedef struct {
+    std::atomic<long> read;
+    std::atomic<long> total;
+    std::atomic<bool> cancel;
+} s64LoadProgress;
+
+// A top level block of the .S64 file a model was generated from
+typedef struct {
+    lexState type;
+    size_t size;
+    uint64_t hash;
+} s64BlockInfo;
+
+
 /*********************************
              Classes
 *********************************/
@@ -33,10 +54,12 @@ typedef enum {
 class s64Model
 {
     private:
-        std::list<s64Mesh*> m_meshes;
-        std::list<n64Material*> m_materials;
-        std::list<s64Anim*> m_anims;
-        std::stack<lexState> m_lexer_statestack;
+        std::vector<s64Mesh> m_meshes;
+        std::vector<n64Material*> m_materials;
+        std::vector<s64Anim> m_anims;
+        std::vector<s64BlockInfo> m_blocks; // In file order
+        size_t m_reusedblocks;
+        bool m_binary;
         
     protected:
     
@@ -44,11 +67,15 @@ class s64Model
         s64Model();
         ~s64Model();
         n64Material* GetMaterialFromName(std::string name);
-        bool GenerateFromFile(std::string path);
+        bool GenerateFromFile(std::string path, s64LoadProgress* progress = NULL, s64Model* previous = NULL);
+        bool GenerateFromBinary(std::string path, s64LoadProgress* progress = NULL);
+        size_t AdoptMaterials(s64Model* previous);
+        size_t GetReusedBlockCount();
+        bool IsBinary();
         int GetMeshCount();
         int GetMaterialCount();
         int GetAnimCount();
-        std::list<s64Mesh*>* GetMeshList();
-        std::list<n64Material*>* GetMaterialList();
-        std::list<s64Anim*>* GetAnimList();
+        std::vector<s64Mesh>* GetMeshList();
+        std::vector<n64Material*>* GetMaterialList();
+        std::vector<s64Anim>* GetAnimList();
 };
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "sausage_animation.h"
 
 
@@ -12,10 +13,9 @@
 
 s64FrameData::s64FrameData()
 {
-	this->mesh = NULL;
 	this->translation = glm::vec3(0.0f, 0.0f, 0.0f);
-	this->rotation = glm::quat(0.0f, 0.0f, 0.0f, 0.0f);
-	this->scale = glm::vec3(0.0f, 0.0f, 0.0f);
+	this->rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+	this->scale = glm::vec3(1.0f, 1.0f, 1.0f);
 }
 
 
@@ -52,8 +52,7 @@ s64Keyframe::s64Keyframe()
 
 s64Keyframe::~s64Keyframe()
 {
-	for (std::list<s64FrameData*>::iterator it = this->framedata.begin(); it != this->framedata.end(); ++it)
-		delete* it;
+
 }
 
 
@@ -79,6 +78,87 @@ s64Anim::s64Anim()
 
 s64Anim::~s64Anim()
 {
-	for (std::list<s64Keyframe*>::iterator it = this->keyframes.begin(); it != this->keyframes.end(); ++it)
-		delete *it;
+
+}
+
+
+/*==============================
+    s64Anim::BuildLookup
+    Makes sure every keyframe has data for every mesh, and
+    builds the table that maps a tick to its keyframe
+    @param The number of meshes in the model
+==============================*/
+
+void s64Anim::BuildLookup(size_t meshcount)
+{
+	unsigned int keyf = 0;
+	unsigned int length = this->GetLength();
+
+	// Meshes without data in a keyframe keep their rest pose
+	for (std::vector<s64Keyframe>::iterator it = this->keyframes.begin(); it != this->keyframes.end(); ++it)
+		it->framedata.resize(meshcount);
+
+	// Find the last keyframe at or before each tick
+	this->tickkeyframes.clear();
+	if (this->keyframes.size() == 0)
+		return;
+	this->tickkeyframes.reserve(length + 1);
+	for (unsigned int tick = 0; tick <= length; tick++)
+	{
+		while (keyf + 1 < this->keyframes.size() && this->keyframes[keyf + 1].keyframe <= tick)
+			keyf++;
+		this->tickkeyframes.push_back(keyf);
+	}
+}
+
+
+/*==============================
+    s64Anim::GetLength
+    Gets the tick of the last keyframe in this animation
+    @returns The length of the animation, in ticks
+==============================*/
+
+unsigned int s64Anim::GetLength()
+{
+	if (this->keyframes.size() == 0)
+		return 0;
+	return this->keyframes.back().keyframe;
+}
+
+
+/*==============================
+    s64Anim::GetKeyframes
+    Finds the keyframes to interpolate between for a given tick
+    @param The tick to sample the animation at
+    @param A pointer to store the current keyframe in
+    @param A pointer to store the next keyframe in
+    @param A pointer to store the interpolation amount in
+==============================*/
+
+void s64Anim::GetKeyframes(float tick, const s64Keyframe** cur, const s64Keyframe** next, float* lerp)
+{
+	unsigned int index;
+	if (this->tickkeyframes.size() == 0)
+	{
+		*cur = NULL;
+		*next = NULL;
+		*lerp = 0.0f;
+		return;
+	}
+
+	// Look up the keyframe for this tick
+	if (tick <= 0.0f)
+		index = 0;
+	else if ((size_t)tick >= this->tickkeyframes.size())
+		index = this->tickkeyframes.back();
+	else
+		index = this->tickkeyframes[(size_t)tick];
+	*cur = &this->keyframes[index];
+	*next = &this->keyframes[std::min(index + 1, (unsigned int)this->keyframes.size() - 1)];
+
+	// Calculate how far along we are between the two keyframes
+	if ((*next)->keyframe > (*cur)->keyframe)
+		*lerp = std::max(0.0f, std::min(1.0f, (tick - (float)(*cur)->keyframe)/((float)((*next)->keyframe - (*cur)->keyframe))));
+	else
+		*lerp = 0.0f;
 }
\ No newline at end of file
@@ -4,6 +4,7 @@ typedef struct IUnknown IUnknown;
 
 #include <string>
 #include <list>
+#include <vector>
 #include "Include/glm/glm/glm.hpp"
 #include "Include/glm/glm/gtx/quaternion.hpp"
 #include "sausage_mesh.h"
@@ -20,7 +21,6 @@ class s64FrameData
     protected:
     
     public:
-        s64Mesh* mesh;
         glm::vec3 translation;
         glm::quat rotation;
         glm::vec3 scale;
@@ -36,7 +36,7 @@ class s64Keyframe
     
     public:
         unsigned int keyframe;
-        std::list<s64FrameData*> framedata;
+        std::vector<s64FrameData> framedata; // Indexed by mesh
         s64Keyframe();
         ~s64Keyframe();
 };
@@ -49,7 +49,11 @@ class s64Anim
     
     public:
         std::string name;
-        std::list<s64Keyframe*> keyframes;
+        std::vector<s64Keyframe> keyframes;
+        std::vector<unsigned int> tickkeyframes; // Keyframe index for each whole tick
         s64Anim();
         ~s64Anim();
+        void BuildLookup(size_t meshcount);
+        unsigned int GetLength();
+        void GetKeyframes(float tick, const s64Keyframe** cur, const s64Keyframe** next, float* lerp);
 };
\ No newline at end of file
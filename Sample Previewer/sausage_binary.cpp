@@ -0,0 +1,764 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <algorithm>
+#include "sausage.h"
+
+
+/*********************************
+              Macros
+*********************************/
+
+// Binary file layout, as written by Arabiki64
+#define BINARY_VERSION          3
+#define BINARY_HEADERSIZE       0x14
+#define BINARY_MESHTOCSIZE_GBI  0x1C
+#define BINARY_MESHTOCSIZE_GL   0x24
+#define BINARY_LODTOCSIZE_GBI   0x18
+#define BINARY_LODTOCSIZE_GL    0x20
+#define BINARY_MESHDATASIZE     0x14
+#define BINARY_VERTSIZE_GBI     0x10
+#define BINARY_VERTSIZE_GL      0x2C
+#define BINARY_RENDERBLOCKSIZE  0x0C
+#define BINARY_MATTOCSIZE       0x10
+#define BINARY_MATDATASIZE      0x06
+#define BINARY_ANIMTOCSIZE      0x10
+#define BINARY_ANIMDATASIZE     0x18
+#define BINARY_KEYFRAMESIZE     0x28
+
+// Size of a single display list command on the N64
+#define GFX_SIZE 8
+
+// Geometry mode bits, as the display list sets them
+#define GBI_ZBUFFER        0x00000001
+#define GBI_CULL_FRONT     0x00000200
+#define GBI_CULL_BACK      0x00000400
+#define GBI_LIGHTING       0x00020000
+#define GBI_SHADING_SMOOTH 0x00200000
+
+// Vertices the RSP can hold at once
+#define GBI_VERTEXCACHE 64
+
+
+/*********************************
+           Custom Types
+*********************************/
+
+// The display list commands Arabiki64 writes to binary files, numbered like the parser's DListCName
+typedef enum {
+    DLCMD_DPPIPESYNC          = 5,
+    DLCMD_DPLOADTEXTUREBLOCK  = 8,
+    DLCMD_DPLOADTEXTUREBLOCK4 = 9,
+    DLCMD_DPSETPRIMCOLOR      = 20,
+    DLCMD_DPSETCOMBINELERP    = 30,
+    DLCMD_DPSETCYCLETYPE      = 33,
+    DLCMD_DPSETRENDERMODE     = 39,
+    DLCMD_DPSETTEXTUREFILTER  = 42,
+    DLCMD_SP1TRIANGLE         = 48,
+    DLCMD_SP2TRIANGLES        = 49,
+    DLCMD_SPCULLDISPLAYLIST   = 54,
+    DLCMD_SPENDDISPLAYLIST    = 56,
+    DLCMD_SPSETGEOMETRYMODE   = 59,
+    DLCMD_SPCLEARGEOMETRYMODE = 60,
+    DLCMD_SPVERTEX            = 88
+} binCommand;
+
+
+/*********************************
+            Structures
+*********************************/
+
+// The state of the RSP while walking the display lists, which carries over from one mesh to the next
+typedef struct {
+    n64Material* material;
+    uint32_t geometrymode;
+    uint32_t texw;
+    uint32_t texh;
+    int cache[GBI_VERTEXCACHE]; // Index into the vertex data of each cache slot, or -1
+} binState;
+
+// A binary model that's being read
+typedef struct {
+    const unsigned char* data;
+    size_t size;
+    std::vector<std::string> texnames;           // Texture names, from the header Arabiki64 generated alongside the model
+    std::map<std::string, n64Material*> materials;
+} binFile;
+
+
+/*==============================
+    Read16
+    Reads a big endian 16-bit value
+    @param The data to read from
+    @returns The value
+==============================*/
+
+static uint16_t Read16(const unsigned char* data)
+{
+    return (uint16_t)((data[0] << 8) | data[1]);
+}
+
+
+/*==============================
+    Read32
+    Reads a big endian 32-bit value
+    @param The data to read from
+    @returns The value
+==============================*/
+
+static uint32_t Read32(const unsigned char* data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+
+
+/*==============================
+    ReadFloat
+    Reads a big endian 32-bit float
+    @param The data to read from
+    @returns The value
+==============================*/
+
+static float ReadFloat(const unsigned char* data)
+{
+    float ret;
+    uint32_t val = Read32(data);
+    memcpy(&ret, &val, sizeof(float));
+    return ret;
+}
+
+
+/*==============================
+    InRange
+    Checks that a block of data fits inside the file
+    @param The file being read
+    @param The offset of the block
+    @param The size of the block
+    @returns Whether the block is inside the file
+==============================*/
+
+static bool InRange(binFile* file, size_t offset, size_t size)
+{
+    return offset <= file->size && size <= file->size - offset;
+}
+
+
+/*==============================
+    ReadTextureNames
+    Reads the texture indices from the header that Arabiki64
+    writes next to a binary model, so that textures can be
+    given the same names as in the material definitions
+    @param The path of the binary model
+    @param The list to store the names in, by texture index
+==============================*/
+
+static void ReadTextureNames(std::string path, std::vector<std::string>* names)
+{
+    char line[512];
+    size_t dot = path.find_last_of('.');
+    FILE* fp = fopen(((dot != std::string::npos) ? path.substr(0, dot) : path).append(".h").c_str(), "r");
+    if (fp == NULL)
+        return;
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        char name[256];
+        unsigned int index;
+        if (sscanf(line, "#define TEXTURE_%255s %u", name, &index) != 2)
+            continue;
+        if (index >= names->size())
+            names->resize(index + 1);
+        (*names)[index] = name;
+    }
+    fclose(fp);
+}
+
+
+/*==============================
+    FindMaterial
+    Gets a material of the model by name, creating it if it
+    doesn't exist yet. The flags are taken from the geometry
+    mode it was first used with.
+    @param The file being read
+    @param The model being generated
+    @param The name of the material
+    @param The type of the material
+    @param The geometry mode the material is used with
+    @returns The material
+==============================*/
+
+static n64Material* FindMaterial(binFile* file, std::vector<n64Material*>* materials, std::string name, matType type, uint32_t geometrymode)
+{
+    n64Material*& mat = file->materials[name];
+    if (mat != NULL)
+        return mat;
+
+    // Textures need an OpenGL context to be created, so they start unknown until their definition is loaded
+    mat = new n64Material((type == TYPE_PRIMCOL) ? TYPE_PRIMCOL : TYPE_UNKNOWN);
+    mat->name = name;
+    mat->geomode.clear();
+    mat->geomode.push_back("G_SHADE");
+    if (geometrymode & GBI_ZBUFFER)
+        mat->geomode.push_back("G_ZBUFFER");
+    if (geometrymode & GBI_CULL_FRONT)
+        mat->geomode.push_back("G_CULL_FRONT");
+    if (geometrymode & GBI_CULL_BACK)
+        mat->geomode.push_back("G_CULL_BACK");
+    if (geometrymode & GBI_SHADING_SMOOTH)
+        mat->geomode.push_back("G_SHADING_SMOOTH");
+    if (geometrymode & GBI_LIGHTING)
+        mat->geomode.push_back("G_LIGHTING");
+    mat->UpdateRenderState();
+    materials->push_back(mat);
+    return mat;
+}
+
+
+/*==============================
+    AddVertex
+    Adds a vertex to a mesh the first time a triangle uses it.
+    Positions are kept as the integers the N64 sees, and texture
+    coordinates are converted back from s10.5 texels.
+    @param The file being read
+    @param The mesh to add the vertex to
+    @param The offset of the mesh's vertex data
+    @param The number of vertices in the vertex data
+    @param The index of the vertex in the vertex data
+    @param The map of vertex data indices to mesh vertices
+    @param The RSP state
+    @returns The index of the vertex in the mesh, or -1 if it's invalid
+==============================*/
+
+static int AddVertex(binFile* file, s64Mesh* mesh, size_t vertoffset, size_t vertcount, int index, std::map<int, unsigned int>* added, binState* state)
+{
+    s64Vert vert;
+    const unsigned char* data;
+    std::map<int, unsigned int>::iterator it = added->find(index);
+    if (it != added->end())
+        return (int)it->second;
+    if (index < 0 || (size_t)index >= vertcount)
+        return -1;
+    data = file->data + vertoffset + index*BINARY_VERTSIZE_GBI;
+    vert.pos = glm::vec3((int16_t)Read16(data + 0), (int16_t)Read16(data + 2), (int16_t)Read16(data + 4));
+    if (state->texw > 0 && state->texh > 0)
+        vert.UV = glm::vec2(((int16_t)Read16(data + 8))/(32.0f*state->texw), ((int16_t)Read16(data + 10))/(32.0f*state->texh));
+    if (state->geometrymode & GBI_LIGHTING)
+    {
+        vert.normal = glm::vec3(((int8_t)data[12])/127.0f, ((int8_t)data[13])/127.0f, ((int8_t)data[14])/127.0f);
+        vert.color = glm::vec3(1.0f, 1.0f, 1.0f);
+    }
+    else
+    {
+        vert.normal = glm::vec3(0.0f, 0.0f, 1.0f);
+        vert.color = glm::vec3(data[12]/255.0f, data[13]/255.0f, data[14]/255.0f);
+    }
+    mesh->verts.push_back(vert);
+    (*added)[index] = (unsigned int)(mesh->verts.size() - 1);
+    return (int)(mesh->verts.size() - 1);
+}
+
+
+/*==============================
+    AddTriangle
+    Adds a triangle from the vertex cache to a mesh
+    @param The file being read
+    @param The mesh to add the triangle to
+    @param The offset of the mesh's vertex data
+    @param The number of vertices in the vertex data
+    @param The vertex cache slots of the triangle
+    @param The map of vertex data indices to mesh vertices
+    @param The RSP state
+    @returns Whether the triangle was valid
+==============================*/
+
+static bool AddTriangle(binFile* file, s64Mesh* mesh, size_t vertoffset, size_t vertcount, const unsigned char* slots, std::map<int, unsigned int>* added, binState* state)
+{
+    s64Face face;
+    for (int i=0; i<3; i++)
+    {
+        int vert;
+        if (slots[i] >= GBI_VERTEXCACHE)
+            return false;
+        vert = AddVertex(file, mesh, vertoffset, vertcount, state->cache[slots[i]], added, state);
+        if (vert < 0)
+            return false;
+        face.verts[i] = vert;
+    }
+    face.material = state->material;
+    mesh->faces.push_back(face);
+    return true;
+}
+
+
+/*==============================
+    DecodeDisplayList
+    Walks through a mesh's display list the way the RSP would,
+    rebuilding the triangles it draws and counting how much
+    they cost
+    @param The file being read
+    @param The model's materials
+    @param The mesh to fill in
+    @param The offset of the mesh's vertex data
+    @param The size of the mesh's vertex data
+    @param The offset of the mesh's display list
+    @param The size of the mesh's display list
+    @param The RSP state
+    @returns Whether the display list was valid
+==============================*/
+
+static bool DecodeDisplayList(binFile* file, std::vector<n64Material*>* materials, s64Mesh* mesh, size_t vertoffset, size_t vertsize, size_t dloffset, size_t dlsize, binState* state)
+{
+    std::map<int, unsigned int> added;
+    size_t vertcount = vertsize/BINARY_VERTSIZE_GBI;
+    const unsigned char* cmd = file->data + dloffset;
+    const unsigned char* end = cmd + dlsize;
+    if (!InRange(file, vertoffset, vertsize) || !InRange(file, dloffset, dlsize))
+        return false;
+    while (cmd + 4 <= end)
+    {
+        size_t args;
+        switch (Read32(cmd))
+        {
+            case DLCMD_DPPIPESYNC:
+                args = 0;
+                break;
+            case DLCMD_DPSETCYCLETYPE:
+            case DLCMD_DPSETTEXTUREFILTER:
+            case DLCMD_SPCULLDISPLAYLIST:
+                args = 1;
+                break;
+            case DLCMD_DPSETRENDERMODE:
+                args = 2;
+                break;
+            case DLCMD_DPSETCOMBINELERP:
+                args = 4;
+                break;
+            case DLCMD_SPSETGEOMETRYMODE:
+                args = 1;
+                if (cmd + 8 <= end)
+                    state->geometrymode |= Read32(cmd + 4);
+                break;
+            case DLCMD_SPCLEARGEOMETRYMODE:
+                args = 1;
+                if (cmd + 8 <= end)
+                    state->geometrymode &= ~Read32(cmd + 4);
+                break;
+            case DLCMD_DPSETPRIMCOLOR:
+                args = 2;
+                if (cmd + 12 <= end)
+                {
+                    char name[32];
+                    const unsigned char* col = cmd + 8;
+                    sprintf(name, "PrimColor_%02X%02X%02X", col[0], col[1], col[2]);
+                    state->material = FindMaterial(file, materials, name, TYPE_PRIMCOL, state->geometrymode);
+                    state->material->GetPrimColorData()->r = col[0];
+                    state->material->GetPrimColorData()->g = col[1];
+                    state->material->GetPrimColorData()->b = col[2];
+                    state->material->GetPrimColorData()->a = col[3];
+                }
+                break;
+            case DLCMD_DPLOADTEXTUREBLOCK:
+            case DLCMD_DPLOADTEXTUREBLOCK4:
+                args = 4;
+                if (cmd + 20 <= end)
+                {
+                    char name[32];
+                    uint16_t index = Read16(cmd + 4);
+                    sprintf(name, "Texture%d", index);
+                    state->texw = Read16(cmd + 8);
+                    state->texh = Read16(cmd + 10);
+                    state->material = FindMaterial(file, materials, (index < file->texnames.size() && !file->texnames[index].empty()) ? file->texnames[index] : std::string(name), TYPE_TEXTURE, state->geometrymode);
+                    mesh->cost.texloads++;
+                }
+                break;
+            case DLCMD_SPVERTEX:
+                args = 1;
+                if (cmd + 8 <= end)
+                {
+                    int offset = Read16(cmd + 4);
+                    int count = cmd[6];
+                    int first = cmd[7];
+                    for (int i=0; i<count && first + i < GBI_VERTEXCACHE; i++)
+                        state->cache[first + i] = offset + i;
+                    mesh->cost.vertloads += count;
+                }
+                break;
+            case DLCMD_SP1TRIANGLE:
+                args = 1;
+                if (cmd + 8 <= end && !AddTriangle(file, mesh, vertoffset, vertcount, cmd + 4, &added, state))
+                    return false;
+                mesh->cost.tri1++;
+                break;
+            case DLCMD_SP2TRIANGLES:
+                args = 2;
+                if (cmd + 12 <= end && (!AddTriangle(file, mesh, vertoffset, vertcount, cmd + 4, &added, state) || !AddTriangle(file, mesh, vertoffset, vertcount, cmd + 8, &added, state)))
+                    return false;
+                mesh->cost.tri2++;
+                break;
+            case DLCMD_SPENDDISPLAYLIST:
+                return true;
+            default:
+                return false;
+        }
+        cmd += 4 + args*4;
+    }
+    return cmd == end;
+}
+
+
+/*==============================
+    DecodeRenderBlocks
+    Reads an OpenGL mesh's vertices, faces and render blocks,
+    counting how much they cost
+    @param The file being read
+    @param The materials in the file, by index
+    @param The mesh to fill in
+    @param The offset of the mesh's vertex data
+    @param The size of the mesh's vertex data
+    @param The offset of the mesh's face data
+    @param The size of the mesh's face data
+    @param The offset of the mesh's render blocks
+    @param The size of the mesh's render blocks
+    @param The RSP state, only used for keeping track of the last material
+    @returns Whether the data was valid
+==============================*/
+
+static bool DecodeRenderBlocks(binFile* file, std::vector<n64Material*>* filemats, s64Mesh* mesh, size_t vertoffset, size_t vertsize, size_t faceoffset, size_t facesize, size_t dloffset, size_t dlsize, binState* state)
+{
+    size_t vertcount = vertsize/BINARY_VERTSIZE_GL;
+    size_t facecount = facesize/(3*sizeof(uint16_t));
+    if (!InRange(file, vertoffset, vertsize) || !InRange(file, faceoffset, facesize) || !InRange(file, dloffset, dlsize))
+        return false;
+
+    // The vertices are stored as is
+    mesh->verts.resize(vertcount);
+    for (size_t i=0; i<vertcount; i++)
+    {
+        const unsigned char* data = file->data + vertoffset + i*BINARY_VERTSIZE_GL;
+        s64Vert* vert = &mesh->verts[i];
+        vert->pos = glm::vec3(ReadFloat(data + 0), ReadFloat(data + 4), ReadFloat(data + 8));
+        vert->UV = glm::vec2(ReadFloat(data + 12), ReadFloat(data + 16));
+        vert->normal = glm::vec3(ReadFloat(data + 20), ReadFloat(data + 24), ReadFloat(data + 28));
+        vert->color = glm::vec3(ReadFloat(data + 32), ReadFloat(data + 36), ReadFloat(data + 40));
+    }
+
+    // Each render block draws a range of faces with a material
+    for (size_t i=0; i<dlsize/BINARY_RENDERBLOCKSIZE; i++)
+    {
+        const unsigned char* block = file->data + dloffset + i*BINARY_RENDERBLOCKSIZE;
+        size_t blockverts = Read16(block + 0);
+        size_t blockfaces = Read16(block + 4);
+        size_t firstface = Read16(block + 6);
+        int32_t matid = (int32_t)Read32(block + 8);
+        if (firstface + blockfaces > facecount)
+            return false;
+        if (matid >= 0 && (size_t)matid < filemats->size() && (*filemats)[matid] != state->material)
+        {
+            state->material = (*filemats)[matid];
+            if (state->material->type != TYPE_PRIMCOL)
+                mesh->cost.texloads++;
+        }
+        for (size_t j=firstface; j<firstface + blockfaces; j++)
+        {
+            s64Face face;
+            const unsigned char* data = file->data + faceoffset + j*3*sizeof(uint16_t);
+            for (int k=0; k<3; k++)
+            {
+                face.verts[k] = Read16(data + k*sizeof(uint16_t));
+                if (face.verts[k] >= vertcount)
+                    return false;
+            }
+            face.material = state->material;
+            mesh->faces.push_back(face);
+        }
+        mesh->cost.vertloads += blockverts;
+        mesh->cost.tri1 += blockfaces;
+    }
+    return true;
+}
+
+
+/*==============================
+    ReadMaterials
+    Reads the material data that Arabiki64 writes to OpenGL
+    binary models
+    @param The file being read
+    @param The model's materials
+    @param The offset of the material table of contents
+    @param The number of materials
+    @param The list to store the materials in, by index
+    @returns Whether the materials were valid
+==============================*/
+
+static bool ReadMaterials(binFile* file, std::vector<n64Material*>* materials, size_t offset, size_t count, std::vector<n64Material*>* filemats)
+{
+    if (!InRange(file, offset, count*BINARY_MATTOCSIZE))
+        return false;
+    for (size_t i=0; i<count; i++)
+    {
+        const unsigned char* toc = file->data + offset + i*BINARY_MATTOCSIZE;
+        size_t matdataoffset = Read32(toc + 0);
+        size_t matdatasize = Read32(toc + 4);
+        size_t materialoffset = Read32(toc + 8);
+        const unsigned char* matdata;
+        uint32_t geometrymode = 0;
+        n64Material* mat;
+        if (matdatasize <= BINARY_MATDATASIZE || !InRange(file, matdataoffset, matdatasize) || !InRange(file, materialoffset, 4))
+            return false;
+        matdata = file->data + matdataoffset;
+        if (matdata[1]) geometrymode |= GBI_LIGHTING;
+        if (matdata[2]) geometrymode |= GBI_CULL_FRONT;
+        if (matdata[3]) geometrymode |= GBI_CULL_BACK;
+        if (matdata[4]) geometrymode |= GBI_SHADING_SMOOTH;
+        if (matdata[5]) geometrymode |= GBI_ZBUFFER;
+        mat = FindMaterial(file, materials, std::string((const char*)matdata + BINARY_MATDATASIZE, strnlen((const char*)matdata + BINARY_MATDATASIZE, matdatasize - BINARY_MATDATASIZE)), (matType)matdata[0], geometrymode);
+        if (mat->type == TYPE_PRIMCOL)
+        {
+            const unsigned char* col = file->data + materialoffset;
+            mat->GetPrimColorData()->r = col[0];
+            mat->GetPrimColorData()->g = col[1];
+            mat->GetPrimColorData()->b = col[2];
+            mat->GetPrimColorData()->a = col[3];
+        }
+        filemats->push_back(mat);
+    }
+    return true;
+}
+
+
+/*==============================
+    ReadAnimations
+    Reads the animations of a binary model
+    @param The file being read
+    @param The list to store the animations in
+    @param The offset of the animation table of contents
+    @param The number of animations
+    @param The number of meshes in the model
+    @returns Whether the animations were valid
+==============================*/
+
+static bool ReadAnimations(binFile* file, std::vector<s64Anim>* anims, size_t offset, size_t count, size_t meshcount)
+{
+    if (!InRange(file, offset, count*BINARY_ANIMTOCSIZE))
+        return false;
+    anims->resize(count);
+    for (size_t i=0; i<count; i++)
+    {
+        const unsigned char* toc = file->data + offset + i*BINARY_ANIMTOCSIZE;
+        size_t animdataoffset = Read32(toc + 0);
+        size_t animdatasize = Read32(toc + 4);
+        size_t kfdataoffset = Read32(toc + 8);
+        const unsigned char* animdata;
+        const unsigned char* kfdata;
+        size_t kfcount, framecount, nameoffset;
+        s64Anim* anim = &(*anims)[i];
+        if (!InRange(file, animdataoffset, animdatasize) || animdatasize < BINARY_ANIMDATASIZE)
+            return false;
+        animdata = file->data + animdataoffset;
+        kfcount = Read32(animdata + 0);
+        framecount = Read32(animdata + 20);
+        nameoffset = BINARY_ANIMDATASIZE + (kfcount + framecount)*sizeof(uint16_t);
+        if (nameoffset >= animdatasize || !InRange(file, kfdataoffset, kfcount*meshcount*BINARY_KEYFRAMESIZE))
+            return false;
+        anim->name = std::string((const char*)animdata + nameoffset, strnlen((const char*)animdata + nameoffset, animdatasize - nameoffset));
+
+        // The keyframes store every mesh's transform, in the same order as the meshes
+        kfdata = file->data + kfdataoffset;
+        anim->keyframes.resize(kfcount);
+        for (size_t j=0; j<kfcount; j++)
+        {
+            s64Keyframe* keyf = &anim->keyframes[j];
+            keyf->keyframe = Read16(animdata + BINARY_ANIMDATASIZE + j*sizeof(uint16_t));
+            keyf->framedata.resize(meshcount);
+            for (size_t k=0; k<meshcount; k++)
+            {
+                const unsigned char* data = kfdata + (j*meshcount + k)*BINARY_KEYFRAMESIZE;
+                keyf->framedata[k].translation = glm::vec3(ReadFloat(data + 0), ReadFloat(data + 4), ReadFloat(data + 8));
+                keyf->framedata[k].rotation = glm::quat(ReadFloat(data + 12), ReadFloat(data + 16), ReadFloat(data + 20), ReadFloat(data + 24));
+                keyf->framedata[k].scale = glm::vec3(ReadFloat(data + 28), ReadFloat(data + 32), ReadFloat(data + 36));
+            }
+        }
+        anim->BuildLookup(meshcount);
+    }
+    return true;
+}
+
+
+/*==============================
+    s64Model::GenerateFromBinary
+    Generates a model from a binary file exported by Arabiki64,
+    for either Libultra or OpenGL, so that it can be seen as the
+    N64 will draw it. Each mesh's display list is decoded to
+    count what it costs to draw. Arabiki64 bakes the mesh roots
+    into the animations, so the first keyframe is used instead.
+    @param The path of the binary file
+    @param The struct to report the progress in, or NULL
+    @returns Whether the model generated successfully
+==============================*/
+
+bool s64Model::GenerateFromBinary(std::string path, s64LoadProgress* progress)
+{
+    long size;
+    std::vector<unsigned char> data;
+    std::vector<n64Material*> filemats;
+    binFile file;
+    binState state;
+    size_t meshcount, matcount, animcount, meshoffset, matoffset, animoffset;
+    size_t meshtocsize, lodtocsize;
+    bool opengl;
+    FILE* fp = fopen(path.c_str(), "rb");
+    if (fp == NULL)
+        return false;
+
+    // Read the entire file into memory
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (size < BINARY_HEADERSIZE)
+    {
+        fclose(fp);
+        return false;
+    }
+    data.resize(size);
+    if (fread(&data[0], 1, size, fp) != (size_t)size)
+    {
+        fclose(fp);
+        return false;
+    }
+    fclose(fp);
+    if (progress != NULL)
+        progress->total = size;
+    file.data = &data[0];
+    file.size = size;
+
+    // Check the header
+    if (data[0] != 'S' || data[1] != '6' || data[2] != '4' || data[3] != BINARY_VERSION)
+        return false;
+    meshcount = Read16(&data[4]);
+    matcount = Read16(&data[6]);
+    animcount = Read16(&data[8]);
+    meshoffset = Read16(&data[10]);
+    matoffset = Read32(&data[12]);
+    animoffset = Read32(&data[16]);
+
+    // The header doesn't say which library the model is for, but the size of the mesh table of contents gives it away
+    opengl = (matcount > 0);
+    if (!opengl && meshcount > 0 && InRange(&file, meshoffset, 4))
+        opengl = (Read32(&data[meshoffset]) == meshoffset + meshcount*BINARY_MESHTOCSIZE_GL);
+    meshtocsize = opengl ? BINARY_MESHTOCSIZE_GL : BINARY_MESHTOCSIZE_GBI;
+    lodtocsize = opengl ? BINARY_LODTOCSIZE_GL : BINARY_LODTOCSIZE_GBI;
+    if (!InRange(&file, meshoffset, meshcount*meshtocsize))
+        return false;
+    if (opengl && !ReadMaterials(&file, &this->m_materials, matoffset, matcount, &filemats))
+        return false;
+    if (!opengl)
+        ReadTextureNames(path, &file.texnames);
+
+    // Decode the full detail version of each mesh, in order, as the RSP state carries over between them
+    state.material = NULL;
+    state.geometrymode = GBI_ZBUFFER | GBI_CULL_BACK | GBI_LIGHTING | GBI_SHADING_SMOOTH;
+    state.texw = 0;
+    state.texh = 0;
+    for (int i=0; i<GBI_VERTEXCACHE; i++)
+        state.cache[i] = -1;
+    this->m_meshes.resize(meshcount);
+    for (size_t i=0; i<meshcount; i++)
+    {
+        const unsigned char* toc = &data[meshoffset + i*meshtocsize];
+        size_t meshdataoffset = Read32(toc + 0);
+        size_t meshdatasize = Read32(toc + 4);
+        const unsigned char* meshdata;
+        size_t nameoffset;
+        s64Mesh* mesh = &this->m_meshes[i];
+        bool success;
+        if (progress != NULL && progress->cancel)
+            return false;
+        if (!InRange(&file, meshdataoffset, meshdatasize) || meshdatasize < BINARY_MESHDATASIZE)
+            return false;
+
+        // Read the mesh data
+        meshdata = &data[meshdataoffset];
+        mesh->parentindex = (int16_t)Read16(meshdata + 0);
+        mesh->billboard = (meshdata[2] != 0);
+        nameoffset = BINARY_MESHDATASIZE + meshdata[3]*lodtocsize;
+        if (nameoffset >= meshdatasize)
+            return false;
+        mesh->name = std::string((const char*)meshdata + nameoffset, strnlen((const char*)meshdata + nameoffset, meshdatasize - nameoffset));
+        if (mesh->billboard)
+            mesh->props.push_back("Billboard");
+
+        // Then its geometry
+        if (opengl)
+        {
+            success = DecodeRenderBlocks(&file, &filemats, mesh, Read32(toc + 8), Read32(toc + 12), Read32(toc + 16), Read32(toc + 20), Read32(toc + 24), Read32(toc + 28), &state);
+            mesh->cost.dlbytes = Read32(toc + 28);
+        }
+        else
+        {
+            success = DecodeDisplayList(&file, &this->m_materials, mesh, Read32(toc + 8), Read32(toc + 12), Read32(toc + 16), Read32(toc + 20), &state);
+            mesh->cost.dlbytes = Read32(toc + 24)*GFX_SIZE;
+        }
+        if (!success)
+            return false;
+        for (std::vector<s64Face>::iterator itface = mesh->faces.begin(); itface != mesh->faces.end(); ++itface)
+            if (itface->material != NULL && std::find(mesh->materials.begin(), mesh->materials.end(), itface->material) == mesh->materials.end())
+                mesh->materials.push_back(itface->material);
+        if (progress != NULL)
+            progress->read = (long)meshdataoffset;
+    }
+
+    // Meshes that were drawn before any material was loaded use whatever the game left behind
+    for (std::vector<s64Mesh>::iterator itmesh = this->m_meshes.begin(); itmesh != this->m_meshes.end(); ++itmesh)
+    {
+        for (std::vector<s64Face>::iterator itface = itmesh->faces.begin(); itface != itmesh->faces.end(); ++itface)
+        {
+            if (itface->material == NULL)
+            {
+                itface->material = FindMaterial(&file, &this->m_materials, "Unknown", TYPE_UNKNOWN, GBI_ZBUFFER | GBI_CULL_BACK | GBI_LIGHTING | GBI_SHADING_SMOOTH);
+                if (std::find(itmesh->materials.begin(), itmesh->materials.end(), itface->material) == itmesh->materials.end())
+                    itmesh->materials.push_back(itface->material);
+            }
+        }
+    }
+
+    // Resolve the mesh parents
+    for (std::vector<s64Mesh>::iterator itmesh = this->m_meshes.begin(); itmesh != this->m_meshes.end(); ++itmesh)
+    {
+        if (itmesh->parentindex < 0 || (size_t)itmesh->parentindex >= meshcount)
+            itmesh->parentindex = -1;
+        else
+            itmesh->parent = this->m_meshes[itmesh->parentindex].name;
+    }
+
+    // Finally, the animations
+    if (!ReadAnimations(&file, &this->m_anims, animoffset, animcount, meshcount))
+        return false;
+
+    // Without an animation, every mesh would sit on the origin, so take the first keyframe's position out as the root
+    if (this->m_anims.size() > 0 && this->m_anims[0].keyframes.size() > 0)
+    {
+        for (size_t i=0; i<meshcount; i++)
+            this->m_meshes[i].root = this->m_anims[0].keyframes[0].framedata[i].translation;
+        for (std::vector<s64Anim>::iterator itanim = this->m_anims.begin(); itanim != this->m_anims.end(); ++itanim)
+            for (std::vector<s64Keyframe>::iterator itkeyf = itanim->keyframes.begin(); itkeyf != itanim->keyframes.end(); ++itkeyf)
+                for (size_t i=0; i<meshcount; i++)
+                    itkeyf->framedata[i].translation -= this->m_meshes[i].root;
+    }
+    if (progress != NULL)
+        progress->read = size;
+    this->m_binary = true;
+    return true;
+}
+
+
+/*==============================
+    s64Model::IsBinary
+    Checks whether this model was generated from an Arabiki64
+    binary file, and so has the cost of each mesh
+    @returns Whether the model came from a binary file
+==============================*/
+
+bool s64Model::IsBinary()
+{
+    return this->m_binary;
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Resources/MISSING.h"
 #include "sausage_material.h"
 #include <wx/glcanvas.h>
+#include <wx/mstream.h>
 #ifdef MACOS
     #include <OpenGL/glu.h>
 #else
@@ -9,6 +10,14 @@
 #endif
 
 
+/*********************************
+             Globals
+*********************************/
+
+std::atomic<uint32_t> material_staterevision(0);
+bool material_previews = true;
+
+
 /*==============================
     n64Material (Constructor)
     Initializes the class
@@ -128,6 +137,7 @@ void n64Material::CreateDefaultTexture(uint32_t w, uint32_t h)
 	this->GetTextureData()->colsize = DEFAULT_IMAGESIZE;
 	this->GetTextureData()->texmodes = DEFAULT_TEXFLAGS;
 	this->GetTextureData()->texmodet = DEFAULT_TEXFLAGT;
+	this->UpdateRenderState();
 }
 
 
@@ -159,6 +169,7 @@ void n64Material::CreateDefaultPrimCol()
 	this->GetPrimColorData()->g = 255;
 	this->GetPrimColorData()->b = 0;
 	this->GetPrimColorData()->a = 255;
+	this->UpdateRenderState();
 }
 
 
@@ -188,6 +199,70 @@ void n64Material::CreateDefaultUnknown()
 	this->combinemode1 = DEFAULT_COMBINE1_TEX;
 	this->combinemode2 = DEFAULT_COMBINE2_TEX;
 	this->data = NULL;
+	this->UpdateRenderState();
+}
+
+
+/*==============================
+    BuildTexturePixels
+    Converts a wxImage into the pixel layout that OpenGL expects,
+    with the alpha channel interleaved if the image has one
+    @param The image to convert
+    @param The vector to store the pixels in
+    @returns The number of bytes per pixel
+==============================*/
+
+static int BuildTexturePixels(wxImage* img, std::vector<unsigned char>* pixels)
+{
+	size_t count = ((size_t)img->GetWidth())*((size_t)img->GetHeight());
+	const unsigned char* rgb = img->GetData();
+	const unsigned char* alpha = img->GetAlpha();
+
+	// Without alpha, the image data is already in the right format
+	if (!img->HasAlpha())
+	{
+		pixels->assign(rgb, rgb + count*3);
+		return 3;
+	}
+
+	// Otherwise, interleave the alpha channel
+	pixels->resize(count*4);
+	unsigned char* out = &(*pixels)[0];
+	for (size_t i=0; i<count; i++)
+	{
+		out[0] = rgb[0];
+		out[1] = rgb[1];
+		out[2] = rgb[2];
+		out[3] = alpha[i];
+		rgb += 3;
+		out += 4;
+	}
+	return 4;
+}
+
+
+/*==============================
+    n64Material::DecodeImageFile
+    Loads an image file and prepares everything needed to turn
+    it into a texture. This doesn't touch OpenGL or any GUI
+    objects, so it is safe to call from a worker thread.
+    @param The path to the image to load
+    @param The struct to store the decoded image in
+    @returns Whether the image was decoded successfully
+==============================*/
+
+bool n64Material::DecodeImageFile(std::string path, matDecodedImage* img)
+{
+	if (!img->image.LoadFile(path) || !img->image.IsOk())
+		return false;
+
+	// Create a preview image, scaled to match the preview box
+	img->preview = img->image.Copy();
+	img->preview.Rescale(64, 64, wxIMAGE_QUALITY_NEAREST);
+
+	// Generate the texture data
+	img->depth = BuildTexturePixels(&img->image, &img->pixels);
+	return true;
 }
 
 
@@ -199,55 +274,44 @@ void n64Material::CreateDefaultUnknown()
 
 void n64Material::SetImageFromFile(std::string path)
 {
-	wxImage img;
-	wxImage old = this->GetTextureData()->wximg;
+	matDecodedImage img;
+	if (!n64Material::DecodeImageFile(path, &img))
+		return;
+	this->SetImageFromDecoded(&img);
+}
 
-	// Generate the wxImage
-	if (!this->GetTextureData()->wximg.LoadFile(path))
-	{
-		img = old;
+
+/*==============================
+    n64Material::SetImageFromDecoded
+    Sets the texture image from an image that was decoded with
+    DecodeImageFile. Must be called from the OpenGL thread.
+    @param The decoded image
+==============================*/
+
+void n64Material::SetImageFromDecoded(matDecodedImage* img)
+{
+	matImage* tex = this->GetTextureData();
+	if (tex == NULL)
 		return;
-	}
-	this->GetTextureData()->w = this->GetTextureData()->wximg.GetWidth();
-	this->GetTextureData()->h = this->GetTextureData()->wximg.GetHeight();
 
-	// Create a wxBitmap, scaled to match the preview box
-	img = this->GetTextureData()->wximg;
-	img.Rescale(64, 64, wxIMAGE_QUALITY_NEAREST);
-	this->GetTextureData()->wxbmp = wxBitmap(img);
+	// Store the images
+	tex->wximg = img->image;
+	tex->w = img->image.GetWidth();
+	tex->h = img->image.GetHeight();
+	if (material_previews)
+		tex->wxbmp = wxBitmap(img->preview);
 
 	// Generate the OpenGL data
-	glGenTextures(1, &this->GetTextureData()->glid);
-	glBindTexture(GL_TEXTURE_2D, this->GetTextureData()->glid);
+	glDeleteTextures(1, &tex->glid);
+	glGenTextures(1, &tex->glid);
+	glBindTexture(GL_TEXTURE_2D, tex->glid);
 	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_MIRRORED_REPEAT);
 	glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_MIRRORED_REPEAT);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
-	// Get the image data
-	GLubyte* imgdata = this->GetTextureData()->wximg.GetData();
-	GLubyte* alpadata = this->GetTextureData()->wximg.GetAlpha();
-	int depth = this->GetTextureData()->wximg.HasAlpha() ? 4 : 3;
-	GLubyte* finalimage = new GLubyte[this->GetTextureData()->w*this->GetTextureData()->h*depth];
-
-	// Generate image data in the format OpenGL expects (with alpha included)
-	for (size_t y=0; y<this->GetTextureData()->h; y++)
-	{
-		for (size_t x=0; x<this->GetTextureData()->w; x++)
-		{
-			finalimage[(x + y*this->GetTextureData()->w)*depth + 0] = imgdata[(x + y*this->GetTextureData()->w)*3];
-			finalimage[(x + y*this->GetTextureData()->w)*depth + 1] = imgdata[(x + y*this->GetTextureData()->w)*3 + 1];
-			finalimage[(x + y*this->GetTextureData()->w)*depth + 2] = imgdata[(x + y*this->GetTextureData()->w)*3 + 2];
-			if (depth == 4)
-				finalimage[(x + y*this->GetTextureData()->w)*depth + 3] = alpadata[x + y*this->GetTextureData()->w];
-		}
-	}
-
-	// Make the texture and free the memory
-	glTexImage2D(GL_TEXTURE_2D, 0, depth, this->GetTextureData()->w, this->GetTextureData()->h, 0, this->GetTextureData()->wximg.HasAlpha() ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, finalimage);
-	delete[] finalimage;
+	glTexImage2D(GL_TEXTURE_2D, 0, img->depth, tex->w, tex->h, 0, (img->depth == 4) ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, &img->pixels[0]);
 }
 
 
@@ -263,17 +327,20 @@ void n64Material::SetImageFromFile(std::string path)
 void n64Material::SetImageFromData(const unsigned char* data, size_t size, uint32_t w, uint32_t h)
 {
 	wxImage img;
+	wxMemoryInputStream stream(data, size);
 
-	// Generate the wxImage and wxBitmap
-	this->GetTextureData()->wxbmp = wxBitmap::NewFromPNGData(data, size);
-	this->GetTextureData()->wximg = this->GetTextureData()->wxbmp.ConvertToImage();
+	// Generate the wxImage
+	this->GetTextureData()->wximg.LoadFile(stream, wxBITMAP_TYPE_PNG);
 	this->GetTextureData()->w = (w == 0) ? this->GetTextureData()->wximg.GetWidth() : w;
 	this->GetTextureData()->h = (h == 0) ? this->GetTextureData()->wximg.GetHeight() : h;
 
 	// Create a wxBitmap, scaled to match the preview box
-	img = this->GetTextureData()->wxbmp.ConvertToImage();
-	img.Rescale(64, 64, wxIMAGE_QUALITY_NEAREST);
-	this->GetTextureData()->wxbmp = wxBitmap(img);
+	if (material_previews)
+	{
+		img = this->GetTextureData()->wximg.Copy();
+		img.Rescale(64, 64, wxIMAGE_QUALITY_NEAREST);
+		this->GetTextureData()->wxbmp = wxBitmap(img);
+	}
 
 	// Generate the OpenGL data
 	glGenTextures(1, &this->GetTextureData()->glid);
@@ -325,28 +392,10 @@ void n64Material::RegenerateTexture()
 		glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-	// Get the image data
-	GLubyte* imgdata = this->GetTextureData()->wximg.GetData();
-	GLubyte* alpadata = this->GetTextureData()->wximg.GetAlpha();
-	int depth = this->GetTextureData()->wximg.HasAlpha() ? 4 : 3;
-	GLubyte* finalimage = new GLubyte[this->GetTextureData()->w * this->GetTextureData()->h * depth];
-
-	// Generate image data in the format OpenGL expects (with alpha included)
-	for (size_t y = 0; y < this->GetTextureData()->h; y++)
-	{
-		for (size_t x = 0; x < this->GetTextureData()->w; x++)
-		{
-			finalimage[(x + y * this->GetTextureData()->w) * depth + 0] = imgdata[(x + y * this->GetTextureData()->w) * 3];
-			finalimage[(x + y * this->GetTextureData()->w) * depth + 1] = imgdata[(x + y * this->GetTextureData()->w) * 3 + 1];
-			finalimage[(x + y * this->GetTextureData()->w) * depth + 2] = imgdata[(x + y * this->GetTextureData()->w) * 3 + 2];
-			if (depth == 4)
-				finalimage[(x + y * this->GetTextureData()->w) * depth + 3] = alpadata[x + y * this->GetTextureData()->w];
-		}
-	}
-
-	// make the texture and free the memory
-	glTexImage2D(GL_TEXTURE_2D, 0, depth, this->GetTextureData()->w, this->GetTextureData()->h, 0, this->GetTextureData()->wximg.HasAlpha() ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, finalimage);
-	delete[] finalimage;
+	// Make the texture
+	std::vector<unsigned char> pixels;
+	int depth = BuildTexturePixels(&this->GetTextureData()->wximg, &pixels);
+	glTexImage2D(GL_TEXTURE_2D, 0, depth, this->GetTextureData()->wximg.GetWidth(), this->GetTextureData()->wximg.GetHeight(), 0, (depth == 4) ? GL_RGBA : GL_RGB, GL_UNSIGNED_BYTE, &pixels[0]);
 }
 
 
@@ -446,5 +495,78 @@ void n64Material::SetFlag(std::string flag)
 			flag.erase(0, 1);
 			this->geomode.remove(flag);
 		}
+		this->UpdateRenderState();
 	}
+}
+
+
+/*==============================
+    n64Material::ResetFlags
+    Puts every flag of the material back to its default value,
+    so that a material definition can be applied to it again
+    without the old flags piling up
+==============================*/
+
+void n64Material::ResetFlags()
+{
+	std::string defaultgeo[] = DEFAULT_GEOFLAGS;
+	int size = sizeof(defaultgeo)/sizeof(defaultgeo[0]);
+
+	// Reset the attributes that every material type has
+	this->cycle = DEFAULT_CYCLE;
+	this->rendermode1 = DEFAULT_RENDERMODE1;
+	this->rendermode2 = DEFAULT_RENDERMODE2;
+	this->texfilter = DEFAULT_TEXFILTER;
+	this->geomode.clear();
+	for (int i=0; i<size; i++)
+		this->geomode.push_back(defaultgeo[i]);
+	this->dontload = false;
+	this->loadfirst = false;
+
+	// Reset the attributes that depend on the material type
+	switch (this->type)
+	{
+		case TYPE_PRIMCOL:
+			this->combinemode1 = DEFAULT_COMBINE1_PRIM;
+			this->combinemode2 = DEFAULT_COMBINE2_PRIM;
+			break;
+		case TYPE_TEXTURE:
+			this->combinemode1 = DEFAULT_COMBINE1_TEX;
+			this->combinemode2 = DEFAULT_COMBINE2_TEX;
+			this->GetTextureData()->coltype = DEFAULT_IMAGEFORMAT;
+			this->GetTextureData()->colsize = DEFAULT_IMAGESIZE;
+			this->GetTextureData()->texmodes = DEFAULT_TEXFLAGS;
+			this->GetTextureData()->texmodet = DEFAULT_TEXFLAGT;
+			break;
+		default:
+			this->combinemode1 = DEFAULT_COMBINE1_TEX;
+			this->combinemode2 = DEFAULT_COMBINE2_TEX;
+			break;
+	}
+	this->UpdateRenderState();
+}
+
+
+/*==============================
+    n64Material::UpdateRenderState
+    Regenerates the render state from the material's type and
+    geometry flags. Call this whenever either of them changes.
+==============================*/
+
+void n64Material::UpdateRenderState()
+{
+	uint32_t flags = 0;
+	if (this->HasGeoFlag("G_LIGHTING"))
+		flags |= RENDERFLAG_LIGHTING;
+	if (this->HasGeoFlag("G_ZBUFFER"))
+		flags |= RENDERFLAG_ZBUFFER;
+	if (this->HasGeoFlag("G_CULL_FRONT"))
+		flags |= RENDERFLAG_CULLFRONT;
+	if (this->HasGeoFlag("G_CULL_BACK"))
+		flags |= RENDERFLAG_CULLBACK;
+	if (this->HasGeoFlag("G_SHADING_SMOOTH"))
+		flags |= RENDERFLAG_SMOOTH;
+	this->renderstate.flags = flags;
+	this->renderstate.type = this->type;
+	material_staterevision++;
 }
\ No newline at end of file
@@ -4,6 +4,8 @@ typedef struct IUnknown IUnknown;
 
 #include <string>
 #include <list>
+#include <vector>
+#include <atomic>
 #include <wx/image.h>
 #include <wx/bitmap.h>
 #include <wx/filename.h>
@@ -45,6 +47,13 @@ typedef struct IUnknown IUnknown;
 #define DEFAULT_TEXFLAGT       "G_TX_MIRROR"
 #define DEFAULT_GEOFLAGS       {"G_SHADE", "G_ZBUFFER", "G_CULL_BACK", "G_SHADING_SMOOTH", "G_LIGHTING"}
 
+// Render state flags, generated from the geometry flags
+#define RENDERFLAG_LIGHTING  0x01
+#define RENDERFLAG_ZBUFFER   0x02
+#define RENDERFLAG_CULLFRONT 0x04
+#define RENDERFLAG_CULLBACK  0x08
+#define RENDERFLAG_SMOOTH    0x10
+
 
 /*********************************
            Custom Types
@@ -83,6 +92,31 @@ typedef struct {
     uint8_t a;
 } matCol;
 
+// A decoded texture image, waiting to be uploaded on the OpenGL thread
+typedef struct {
+    wxImage image;
+    wxImage preview;
+    std::vector<unsigned char> pixels;
+    int depth;
+} matDecodedImage;
+
+// Material render state, so the renderer doesn't need to look at the flag strings
+typedef struct {
+    uint32_t flags;
+    matType  type;
+} matRenderState;
+
+
+/*********************************
+             Globals
+*********************************/
+
+// Increases every time a material's render state changes
+extern std::atomic<uint32_t> material_staterevision;
+
+// Whether materials should create wxBitmap previews of their textures
+extern bool material_previews;
+
 
 /*********************************
              Classes
@@ -107,6 +141,7 @@ class n64Material
         void*                  data;
         bool                   dontload;
         bool                   loadfirst;
+        matRenderState         renderstate;
         n64Material(matType type);
         ~n64Material();
         matImage* GetTextureData();
@@ -115,8 +150,12 @@ class n64Material
         void CreateDefaultPrimCol();
         void CreateDefaultUnknown();
         void SetImageFromFile(std::string path);
+        void SetImageFromDecoded(matDecodedImage* img);
+        static bool DecodeImageFile(std::string path, matDecodedImage* img);
         void SetImageFromData(const unsigned char* data, size_t size, uint32_t w, uint32_t h);
         bool HasGeoFlag(std::string flag);
         void RegenerateTexture();
         void SetFlag(std::string flag);
+        void ResetFlags();
+        void UpdateRenderState();
 };
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "sausage_mesh.h"
 
 
@@ -41,6 +42,9 @@ s64Vert::~s64Vert()
 
 s64Face::s64Face()
 {
+	this->verts[0] = 0;
+	this->verts[1] = 0;
+	this->verts[2] = 0;
 	this->material = NULL;
 }
 
@@ -56,23 +60,6 @@ s64Face::~s64Face()
 }
 
 
-/*==============================
-    s64Face::GetVertFromIndex
-    Gets an s64Vert struct pointer given a vertex index
-    @param The vertex index to get
-    @returns A pointer to the requested vertex, or NULL
-==============================*/
-
-s64Vert* s64Face::GetVertFromIndex(unsigned int index)
-{
-	if (index >= this->verts.size())
-		return NULL;
-	std::list<s64Vert*>::iterator vertit = this->verts.begin();
-	std::advance(vertit, index);
-	return *vertit;
-}
-
-
 /*********************************
           s64Mesh Class
 *********************************/
@@ -85,8 +72,11 @@ s64Vert* s64Face::GetVertFromIndex(unsigned int index)
 s64Mesh::s64Mesh()
 {
 	this->name = "";
+	this->parent = "";
+	this->parentindex = -1;
 	this->root = glm::vec3(0.0f, 0.0f, 0.0f);
 	this->billboard = false;
+	memset(&this->cost, 0, sizeof(this->cost));
 }
 
 
@@ -97,10 +87,7 @@ s64Mesh::s64Mesh()
 
 s64Mesh::~s64Mesh()
 {
-	for (std::list<s64Vert*>::iterator itvert = this->verts.begin(); itvert != this->verts.end(); ++itvert)
-		delete *itvert;
-	for (std::list<s64Face*>::iterator itface = this->faces.begin(); itface != this->faces.end(); ++itface)
-		delete *itface;
+
 }
 
 
@@ -132,9 +119,7 @@ s64Vert* s64Mesh::GetVertFromIndex(unsigned int index)
 {
 	if (index >= this->verts.size())
 		return NULL;
-	std::list<s64Vert*>::iterator vertit = this->verts.begin();
-	std::advance(vertit, index);
-	return *vertit;
+	return &this->verts[index];
 }
 
 
@@ -147,7 +132,7 @@ s64Vert* s64Mesh::GetVertFromIndex(unsigned int index)
 
 n64Material* s64Mesh::GetMaterialFromName(std::string name)
 {
-	for (std::list<n64Material*>::iterator itmat = this->materials.begin(); itmat != this->materials.end(); ++itmat)
+	for (std::vector<n64Material*>::iterator itmat = this->materials.begin(); itmat != this->materials.end(); ++itmat)
 		if (name == (*itmat)->name.c_str())
 			return *itmat;
 	return NULL;
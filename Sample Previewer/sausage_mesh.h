@@ -4,10 +4,25 @@ typedef struct IUnknown IUnknown;
 
 #include <string>
 #include <list>
+#include <vector>
 #include "Include/glm/glm/glm.hpp"
 #include "sausage_material.h"
 
 
+/*********************************
+            Structures
+*********************************/
+
+// What drawing a mesh costs on the N64, decoded from an Arabiki64 binary model
+typedef struct {
+    size_t vertloads; // Vertices loaded into the vertex cache
+    size_t texloads;  // Texture loads
+    size_t tri1;      // Triangles drawn on their own
+    size_t tri2;      // Triangle pairs drawn together
+    size_t dlbytes;   // Size of the display list, in bytes
+} s64MeshCost;
+
+
 /*********************************
              Classes
 *********************************/
@@ -34,11 +49,10 @@ class s64Face
     protected:
     
     public:
-        std::list<s64Vert*> verts;
+        unsigned int verts[3]; // Indices into the mesh's vertices
         n64Material* material;
         s64Face();
         ~s64Face();
-        s64Vert* GetVertFromIndex(unsigned int index);
 };
 
 class s64Mesh
@@ -49,12 +63,15 @@ class s64Mesh
     
     public:
         std::string name;
+        std::string parent;
+        int parentindex; // Index of the parent mesh in the model, or -1
         glm::vec3 root;
-        std::list<s64Vert*> verts;
-        std::list<s64Face*> faces;
-        std::list<n64Material*> materials;
+        std::vector<s64Vert> verts;
+        std::vector<s64Face> faces;
+        std::vector<n64Material*> materials;
         std::list<std::string> props;
         bool billboard;
+        s64MeshCost cost;
         s64Mesh();
         ~s64Mesh();
         void ParseProperties();
@@ -2,12 +2,26 @@
 #define SAUSAGE64_H
 
     // UNCOMMENT THE #DEFINE IF USING LIBDRAGON
-    #define LIBDRAGON
+    //#define LIBDRAGON
     
     // World space assumptions
     #define S64_UPVEC {0.0f, 0.0f, 1.0f}
     #define S64_FORWARDVEC {0.0f, -1.0f, 0.0f}
 
+    // LOD selection settings
+    #define S64_LOD_HYSTERESIS 0.1f  // How much bigger a mesh must get (in percent) before swapping back to a higher detail LOD
+    #ifdef LIBDRAGON
+        #define S64_LOD_PROJSCALE 2.414214f // cot(fovy/2) of the projection used by your game (Default is for 45 degrees)
+    #endif
+
+    // Animation settings
+    //#define S64_NLERP_CORRECTION // Uncomment to correct the rotation interpolation so that it's closer to a true slerp, at a small CPU cost. Mostly noticeable when blending
+
+    // Matrix buffering settings
+    #ifndef LIBDRAGON
+        #define S64_MTXBUFFERS 2 // How many frames worth of matrices each model helper keeps. Should be at least the number of frames the RCP can lag behind the CPU
+    #endif
+
 
     /*********************************
       Libultra types (for libdragon)
@@ -124,15 +138,31 @@
         const char* name;
         const u32 keyframecount;
         const s64KeyFrame* keyframes;
+        const f32 bounds[4];
+        const u16* framelookup;
     } s64Animation;
 
+    typedef struct {
+        const f32 screensize;
+        const s64Gfx* dl;
+    } s64MeshLOD;
+
     typedef struct {
         const char* name;
         const u32 is_billboard;
         const s64Gfx* dl;
         const s32 parent;
+        const f32 bounds[4];
+        const u32 lodcount;
+        const s64MeshLOD* lods;
     } s64Mesh;
 
+    typedef struct {
+        u32 framecount;
+        Mtx* matrices;
+        f32 (*bounds)[4];
+    } s64BakedAnim;
+
     typedef struct {
         const u16 meshcount;
         const u16 animcount;
@@ -144,6 +174,7 @@
             u32 _matscount;
             s64Material* _matscleanup;
         #endif
+        s64BakedAnim* baked;
     } s64ModelData;
     
     typedef struct {
@@ -152,12 +183,45 @@
         u32 curkeyframe;
     } s64AnimPlay;
 
+    typedef struct {
+        u16 meshes_drawn;
+        u16 meshes_culled;
+        u8  model_culled;
+    } s64CullStats;
+
+    typedef struct {
+        const s64Animation* anim;
+        const s64Animation* blendanim;
+        f32 tick;
+        f32 blendtick;
+        f32 blendleft;
+        f32 blendticks;
+        u8  interpolate;
+        u32 lastused;
+        s64Transform* transforms;
+    } s64PoseCacheEntry;
+
+    typedef struct {
+        u16 meshcount;
+        u16 entrycount;
+        f32 quantize;
+        u32 usecount;
+        u32 hits;
+        u32 misses;
+        s64PoseCacheEntry* entries;
+    } s64PoseCache;
+
     typedef struct {
         u8    interpolate;
         u8    loop;
+        u8    cull;
         u32   rendercount;
         #ifndef LIBDRAGON
             Mtx* matrix;
+            u8   mtxbuffer;
+            u8   mtxauto;
+            u8   mtxload;
+            f32  rootmtx[4][4];
         #endif
         u8    (*predraw)(u16);
         void  (*postdraw)(u16);
@@ -168,8 +232,20 @@
         s64AnimPlay blendanim;
         f32 blendticks;
         f32 blendticks_left;
+        u8*   lodlevels;
+        s64CullStats cullstats;
+        s64PoseCache* posecache;
     } s64ModelHelper;
 
+    typedef struct {
+        u16 count;
+        u16 size;
+        s64ModelHelper** helpers;
+        const s64Transform** curframes;
+        const s64Transform** nextframes;
+        f32* lerps;
+    } s64AnimWorld;
+
 
     /*********************************
               Asset Loading
@@ -289,6 +365,11 @@
         @param (Libultra) The view matrix
         @param (Libultra) The projection matrix
         @param (Libdragon) The location of the camera, relative to the model's root
+        The camera is also used to pick each mesh's LOD, and
+        in Libultra, for frustum culling. Since the mesh bounds
+        are relative to the model's root, the view matrix must
+        be too (the view multiplied by the model's matrix) for
+        those to work on models that aren't drawn at the origin.
     ==============================*/
     
     #ifndef LIBDRAGON
@@ -297,6 +378,81 @@
         extern void sausage64_set_camera(f32 campos[3]);
     #endif
 
+
+    #ifdef LIBDRAGON
+        /*==============================
+            sausage64_set_frustum
+            Sets the view and projection matrices for Sausage64 
+            to use for frustum culling. In Libultra, this is done
+            by sausage64_set_camera instead.
+            @param The view matrix, relative to the model's root
+            @param The projection matrix
+        ==============================*/
+        
+        extern void sausage64_set_frustum(Mtx view, Mtx projection);
+    #endif
+    
+
+    /*==============================
+        sausage64_set_culling
+        Sets whether meshes outside the camera's view
+        should be skipped when drawing. Disabled by default.
+        Requires the camera to be relative to the model's root.
+        @param The model helper pointer
+        @param Whether to cull or not
+    ==============================*/
+    
+    extern void sausage64_set_culling(s64ModelHelper* mdl, u8 cull);
+    
+    
+    /*==============================
+        sausage64_set_posecache
+        Sets the pose cache that the helper should share its
+        animation transforms with. Helpers that land on a
+        cached pose copy it instead of calculating it.
+        @param The model helper pointer
+        @param The pose cache to use, or NULL to disable
+    ==============================*/
+    
+    extern void sausage64_set_posecache(s64ModelHelper* mdl, s64PoseCache* cache);
+    
+    
+    /*==============================
+        sausage64_set_mtxbuffer
+        (Libultra only)
+        Sets which of the helper's S64_MTXBUFFERS matrix buffers
+        the next sausage64_drawmodel call will write to. By
+        default, the buffers are cycled on every draw call, 
+        which breaks if the model is drawn more than once per 
+        frame. Calling this disables the automatic cycling.
+        @param The model helper pointer
+        @param The current frame number
+    ==============================*/
+    
+    #ifndef LIBDRAGON
+        extern void sausage64_set_mtxbuffer(s64ModelHelper* mdl, u32 frame);
+    #endif
+    
+    
+    /*==============================
+        sausage64_set_rootmatrix
+        (Libultra only)
+        Sets the modelview matrix at the model's root (for 
+        instance, the model matrix multiplied by the view). 
+        Every mesh's matrix is then composed with it on the CPU
+        and loaded with G_MTX_LOAD, rather than being pushed 
+        and multiplied by the RSP. The modelview matrix is left
+        modified after drawing, and this must be called again
+        whenever the root matrix changes.
+        @param The model helper pointer
+        @param The root modelview matrix, or NULL to go back
+               to multiplying onto the matrix stack
+    ==============================*/
+    
+    #ifndef LIBDRAGON
+        extern void sausage64_set_rootmatrix(s64ModelHelper* mdl, Mtx* root);
+    #endif
+
     
     /*==============================
         sausage64_set_anim
@@ -321,6 +477,18 @@
     extern void sausage64_set_anim_blend(s64ModelHelper* mdl, u16 anim, f32 ticks);
     
     
+    /*==============================
+        sausage64_set_anim_time
+        Jumps to a specific tick of the current animation. The
+        tick is wrapped if the model is looping, otherwise it is
+        clamped. Does not call the animation end callback.
+        @param The model helper pointer
+        @param The tick to jump to
+    ==============================*/
+    
+    extern void sausage64_set_anim_time(s64ModelHelper* mdl, f32 tick);
+    
+    
     /*==============================
         sausage64_set_animcallback
         Set a function that gets called when an animation finishes
@@ -386,6 +554,17 @@
     extern void sausage64_lookat(s64ModelHelper* mdl, const u16 mesh, f32 dir[3], f32 amount, u8 affectchildren);
 
 
+    /*==============================
+        sausage64_get_meshlod
+        Get the LOD level that was last used to draw a mesh
+        @param  The model helper pointer
+        @param  The mesh to check
+        @return The LOD level (0 is full detail)
+    ==============================*/
+    
+    extern u32 sausage64_get_meshlod(s64ModelHelper* mdl, const u16 mesh);
+
+
     /*==============================
         sausage64_drawmodel
         Renders a Sausage64 model
@@ -399,5 +578,120 @@
     #else
         extern void sausage64_drawmodel(s64ModelHelper* mdl);
     #endif
+    
+    
+    /*********************************
+            Animation Worlds
+    *********************************/
+    
+    /*==============================
+        sausage64_initworld
+        Allocate an animation world, which advances and 
+        calculates the transforms of many model helpers at once
+        @param  The maximum number of helpers in the world
+        @return A newly allocated animation world
+    ==============================*/
+    
+    extern s64AnimWorld* sausage64_initworld(u16 size);
+    
+    
+    /*==============================
+        sausage64_world_addhelper
+        Adds a model helper to an animation world
+        @param  The animation world
+        @param  The model helper to add
+        @return Whether the helper was added (FALSE if the world is full)
+    ==============================*/
+    
+    extern u8 sausage64_world_addhelper(s64AnimWorld* world, s64ModelHelper* mdl);
+    
+    
+    /*==============================
+        sausage64_world_removehelper
+        Removes a model helper from an animation world
+        @param The animation world
+        @param The model helper to remove
+    ==============================*/
+    
+    extern void sausage64_world_removehelper(s64AnimWorld* world, s64ModelHelper* mdl);
+    
+    
+    /*==============================
+        sausage64_advance_world
+        Advances the animation of every helper in the world,
+        and calculates all of their mesh transforms so that
+        sausage64_drawmodel doesn't have to. Helpers which
+        can use the model's baked matrices are only advanced
+        @param The animation world
+        @param The amount to increase the animation ticks by
+    ==============================*/
+    
+    extern void sausage64_advance_world(s64AnimWorld* world, f32 tickamount);
+    
+    
+    /*==============================
+        sausage64_freeworld
+        Frees the memory used up by an animation world. 
+        The helpers inside it are not freed.
+        @param A pointer to the animation world
+    ==============================*/
+    
+    extern void sausage64_freeworld(s64AnimWorld* world);
+    
+    
+    /*********************************
+              Pose Caches
+    *********************************/
+    
+    /*==============================
+        sausage64_initposecache
+        Allocate a pose cache, which lets helpers that play the
+        same animation at the same tick share their transforms
+        @param  The model data that the helpers will use
+        @param  The number of poses to keep
+        @param  The step (in ticks) to snap animation ticks to.
+                Bigger steps give more cache hits, at the cost of
+                less precise animation timing. 0 for no snapping
+        @return A newly allocated pose cache
+    ==============================*/
+    
+    extern s64PoseCache* sausage64_initposecache(const s64ModelData* mdldata, u16 entries, f32 quantize);
+    
+    
+    /*==============================
+        sausage64_freeposecache
+        Frees the memory used up by a pose cache. Make sure no
+        helpers are still using it.
+        @param A pointer to the pose cache
+    ==============================*/
+    
+    extern void sausage64_freeposecache(s64PoseCache* cache);
+    
+    
+    /*********************************
+            Animation Baking
+    *********************************/
+    
+    /*==============================
+        sausage64_bake_anims
+        Samples every frame of every animation of a model, and
+        stores the resulting matrices (and bounding spheres) of
+        each mesh. Helpers using this model will then draw 
+        them directly, without interpolation, whenever they're
+        not blending. Uses 80 bytes per mesh per frame.
+        @param  The model data to bake
+        @return Whether the animations were baked
+    ==============================*/
+    
+    extern u8 sausage64_bake_anims(s64ModelData* mdldata);
+    
+    
+    /*==============================
+        sausage64_unbake_anims
+        Frees the baked animations of a model
+        @param The model data to unbake
+    ==============================*/
+    
+    extern void sausage64_unbake_anims(s64ModelData* mdldata);
 
 #endif
\ No newline at end of file
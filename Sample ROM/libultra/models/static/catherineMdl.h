@@ -32,8 +32,8 @@ arabiki64.exe -s -f sample/CatherineExported.S64 -t sample/CatherineMaterials.tx
 #define MESH_Catherine_LeftLeg      14
 #define MESH_Catherine_RightLeg     15
 #define MESH_Catherine_Pad          16
-#define MESH_Catherine_Sword        17
-#define MESH_Catherine_Pelvis       18
+#define MESH_Catherine_Pelvis       17
+#define MESH_Catherine_Sword        18
 
 // Animation data
 #define ANIMATIONCOUNT_Catherine 8
@@ -135,118 +135,159 @@ static Vtx vtx_Catherine_Head[] = {
     {0, -22, 22, 0, 0, 576, 0, -126, -15, 255}, /* 1 */
     {0, -24, 12, 0, 0, 1152, 0, -111, -62, 255}, /* 2 */
     {0, -20, 0, 0, 0, 2048, 0, -95, -85, 255}, /* 3 */
-    {0, -20, 11, 0, 0, 1280, 0, -117, -50, 255}, /* 4 */
-    {18, -13, 28, 0, 928, 256, 109, -63, 17, 255}, /* 5 */
-    {18, -10, 11, 0, 896, 1376, 110, -49, -42, 255}, /* 6 */
-    {11, -22, 30, 0, 512, 32, 76, -102, 0, 255}, /* 7 */
-    {0, -24, 30, 0, 0, 0, 0, -127, -3, 255}, /* 8 */
-    {11, -14, 4, 0, 640, 1792, 82, -68, -69, 255}, /* 9 */
-    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 10 */
-    {-18, -13, 28, 0, 928, 256, -109, -63, 17, 255}, /* 11 */
-    {-18, -10, 11, 0, 896, 1376, -110, -49, -42, 255}, /* 12 */
-    {-11, -22, 30, 0, 512, 32, -76, -102, 0, 255}, /* 13 */
-    {-11, -14, 4, 0, 640, 1792, -82, -68, -69, 255}, /* 14 */
-    {0, 13, 2, 0, 0, 0, 0, 86, -94, 255}, /* 15 */
-    {0, 24, 27, 0, 0, 0, 0, 126, 12, 255}, /* 16 */
-    {16, 15, 10, 0, 0, 0, 88, 77, -50, 255}, /* 17 */
-    {-16, 15, 10, 0, 0, 0, -88, 77, -50, 255}, /* 18 */
-    {15, 13, 40, 0, 0, 0, 79, 75, 66, 255}, /* 19 */
-    {21, 1, 23, 0, 0, 0, 127, 10, -4, 255}, /* 20 */
-    {-15, 13, 40, 0, 0, 0, -79, 75, 66, 255}, /* 21 */
-    {-21, 1, 23, 0, 0, 0, -127, 10, -4, 255}, /* 22 */
-    {0, 11, 47, 0, 0, 0, 0, 64, 110, 255}, /* 23 */
-    {18, 1, 41, 0, 0, 0, 101, 2, 77, 255}, /* 24 */
-    {18, -13, 28, 0, 0, 0, 109, -63, 17, 255}, /* 25 */
-    {0, -1, 49, 0, 0, 0, 0, 5, 127, 255}, /* 26 */
-    {11, -22, 30, 0, 0, 0, 76, -102, 0, 255}, /* 27 */
-    {-18, 1, 41, 0, 0, 0, -101, 2, 77, 255}, /* 28 */
-    {-18, -13, 28, 0, 0, 0, -109, -63, 17, 255}, /* 29 */
-    {-11, -22, 30, 0, 0, 0, -76, -102, 0, 255}, /* 30 */
-    {8, -22, 39, 0, 0, 0, 52, -99, 61, 255}, /* 31 */
-    {0, -24, 30, 0, 0, 0, 0, -127, -3, 255}, /* 32 */
-    {0, -16, 47, 0, 0, 0, 0, -61, 111, 255}, /* 33 */
-    {-8, -22, 39, 0, 0, 0, -52, -99, 61, 255}, /* 34 */
-    {-6, -24, 32, 0, 0, 0, 14, 94, -84, 255}, /* 35 */
-    {-3, -24, 32, 0, 0, 0, 118, -14, -45, 255}, /* 36 */
-    {-12, -26, 21, 0, 0, 0, -26, -28, -121, 255}, /* 37 */
-    {-6, -14, 37, 0, 0, 0, 32, 115, 42, 255}, /* 38 */
-    {-14, -20, 31, 0, 0, 0, -107, 63, -28, 255}, /* 39 */
-    {-9, -26, 37, 0, 0, 0, -16, -82, 96, 255}, /* 40 */
-    {15, -16, 29, 0, 0, 0, -101, 56, -52, 255}, /* 41 */
-    {19, -12, 28, 0, 0, 0, 54, 106, -44, 255}, /* 42 */
-    {17, -19, 20, 0, 0, 0, 7, -35, -122, 255}, /* 43 */
-    {14, -10, 35, 0, 0, 0, -42, 83, 86, 255}, /* 44 */
-    {13, -20, 29, 0, 0, 0, -95, -82, 16, 255}, /* 45 */
-    {20, -18, 32, 0, 0, 0, 89, -61, 66, 255}, /* 46 */
-    {-17, -15, 31, 0, 0, 0, 90, 47, -76, 255}, /* 47 */
-    {-13, -18, 31, 0, 0, 0, 104, -73, 5, 255}, /* 48 */
-    {-20, -18, 18, 0, 0, 0, -16, -29, -123, 255}, /* 49 */
-    {-11, -10, 36, 0, 0, 0, 78, 70, 72, 255}, /* 50 */
-    {-20, -11, 27, 0, 0, 0, -42, 115, -36, 255}, /* 51 */
-    {-20, -17, 32, 0, 0, 0, -89, -52, 74, 255}, /* 52 */
-    {-21, -8, 27, 0, 0, 0, 118, 29, -38, 255}, /* 53 */
-    {-19, -11, 28, 0, 0, 0, 77, -99, 20, 255}, /* 54 */
-    {-21, -8, 7, 0, 0, 0, 84, -95, -7, 255}, /* 55 */
-    {-20, -8, -3, 0, 0, 0, 18, -3, -126, 255}, /* 56 */
-    {-23, -8, 4, 0, 0, 0, -114, -50, -24, 255}, /* 57 */
-    {-17, -5, 32, 0, 0, 0, 83, 35, 89, 255}, /* 58 */
-    {-21, -3, 4, 0, 0, 0, 22, 121, -31, 255}, /* 59 */
-    {-21, -2, 26, 0, 0, 0, 11, 126, 16, 255}, /* 60 */
-    {-23, -8, 28, 0, 0, 0, -108, -34, 57, 255}, /* 61 */
-    {21, -8, 27, 0, 0, 0, -122, -5, -36, 255}, /* 62 */
-    {21, -11, -3, 0, 0, 0, -25, -37, -119, 255}, /* 63 */
-    {20, -11, 5, 0, 0, 0, -65, -109, -2, 255}, /* 64 */
-    {20, -12, 28, 0, 0, 0, -38, -107, 58, 255}, /* 65 */
-    {22, -10, 2, 0, 0, 0, 123, -21, -22, 255}, /* 66 */
-    {21, -3, 24, 0, 0, 0, -25, 124, 0, 255}, /* 67 */
-    {17, -5, 32, 0, 0, 0, -68, 45, 98, 255}, /* 68 */
-    {23, -8, 26, 0, 0, 0, 120, 0, 41, 255}, /* 69 */
-    {20, -7, 5, 0, 0, 0, -37, 118, -28, 255}, /* 70 */
-    {22, 3, 17, 0, 0, 0, 103, 57, -47, 255}, /* 71 */
-    {21, 1, 23, 0, 0, 0, 126, 9, 16, 255}, /* 72 */
-    {20, -3, 20, 0, 0, 0, 114, -47, -30, 255}, /* 73 */
-    {18, 2, 13, 0, 0, 0, 83, 20, -94, 255}, /* 74 */
-    {19, 4, 19, 0, 0, 0, 53, 114, 19, 255}, /* 75 */
-    {16, 15, 10, 0, 0, 0, 88, 77, -50, 255}, /* 76 */
-    {21, 1, 23, 0, 0, 0, 127, 10, -4, 255}, /* 77 */
-    {13, 4, 2, 0, 0, 0, 82, 17, -95, 255}, /* 78 */
-    {18, -10, 11, 0, 0, 0, 110, -49, -42, 255}, /* 79 */
-    {18, -13, 28, 0, 0, 0, 109, -63, 17, 255}, /* 80 */
-    {0, -20, 0, 0, 0, 0, 0, -95, -85, 255}, /* 81 */
-    {0, 0, -4, 0, 0, 0, 0, 9, -127, 255}, /* 82 */
-    {0, 13, 2, 0, 0, 0, 0, 86, -94, 255}, /* 83 */
-    {11, -14, 4, 0, 0, 0, 82, -68, -69, 255}, /* 84 */
-    {-16, 15, 10, 0, 0, 0, -88, 77, -50, 255}, /* 85 */
-    {-13, 4, 2, 0, 0, 0, -82, 17, -95, 255}, /* 86 */
-    {-21, 1, 23, 0, 0, 0, -127, 10, -4, 255}, /* 87 */
-    {-18, -10, 11, 0, 0, 0, -110, -49, -42, 255}, /* 88 */
-    {-18, -13, 28, 0, 0, 0, -109, -63, 17, 255}, /* 89 */
-    {-11, -14, 4, 0, 0, 0, -82, -68, -69, 255}, /* 90 */
-    {-22, 3, 17, 0, 0, 0, -103, 57, -47, 255}, /* 91 */
-    {-20, -3, 20, 0, 0, 0, -114, -47, -30, 255}, /* 92 */
-    {-21, 1, 23, 0, 0, 0, -126, 9, 16, 255}, /* 93 */
-    {-18, 2, 13, 0, 0, 0, -83, 20, -94, 255}, /* 94 */
-    {-19, 4, 19, 0, 0, 0, -53, 114, 19, 255}, /* 95 */
+    {3, -21, 13, 0, 192, 1152, 71, -103, -23, 255}, /* 4 */
+    {0, -20, 11, 0, 0, 1280, 0, -117, -50, 255}, /* 5 */
+    {18, -13, 28, 0, 928, 256, 109, -63, 17, 255}, /* 6 */
+    {3, -21, 13, 0, 192, 1152, 71, -103, -23, 255}, /* 7 */
+    {18, -10, 11, 0, 896, 1376, 110, -49, -42, 255}, /* 8 */
+    {0, -20, 11, 0, 0, 1280, 0, -117, -50, 255}, /* 9 */
+    {3, -21, 13, 0, 192, 1152, 71, -103, -23, 255}, /* 10 */
+    {0, -24, 12, 0, 0, 1152, 0, -111, -62, 255}, /* 11 */
+    {0, -22, 22, 0, 0, 576, 0, -126, -15, 255}, /* 12 */
+    {3, -21, 13, 0, 192, 1152, 71, -103, -23, 255}, /* 13 */
+    {11, -22, 30, 0, 512, 32, 76, -102, 0, 255}, /* 14 */
+    {0, -22, 22, 0, 0, 576, 0, -126, -15, 255}, /* 15 */
+    {11, -22, 30, 0, 512, 32, 76, -102, 0, 255}, /* 16 */
+    {0, -24, 30, 0, 0, 0, 0, -127, -3, 255}, /* 17 */
+    {3, -21, 13, 0, 192, 1152, 71, -103, -23, 255}, /* 18 */
+    {11, -14, 4, 0, 640, 1792, 82, -68, -69, 255}, /* 19 */
+    {18, -10, 11, 0, 896, 1376, 110, -49, -42, 255}, /* 20 */
+    {0, -20, 0, 0, 0, 2048, 0, -95, -85, 255}, /* 21 */
+    {11, -14, 4, 0, 640, 1792, 82, -68, -69, 255}, /* 22 */
+    {3, -21, 13, 0, 192, 1152, 71, -103, -23, 255}, /* 23 */
+    {11, -22, 30, 0, 512, 32, 76, -102, 0, 255}, /* 24 */
+    {3, -21, 13, 0, 192, 1152, 71, -103, -23, 255}, /* 25 */
+    {18, -13, 28, 0, 928, 256, 109, -63, 17, 255}, /* 26 */
+    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 27 */
+    {0, -24, 12, 0, 0, 1152, 0, -111, -62, 255}, /* 28 */
+    {0, -22, 22, 0, 0, 576, 0, -126, -15, 255}, /* 29 */
+    {0, -20, 0, 0, 0, 2048, 0, -95, -85, 255}, /* 30 */
+    {0, -20, 11, 0, 0, 1280, 0, -117, -50, 255}, /* 31 */
+    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 32 */
+    {-18, -13, 28, 0, 928, 256, -109, -63, 17, 255}, /* 33 */
+    {-18, -10, 11, 0, 896, 1376, -110, -49, -42, 255}, /* 34 */
+    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 35 */
+    {0, -20, 11, 0, 0, 1280, 0, -117, -50, 255}, /* 36 */
+    {0, -24, 12, 0, 0, 1152, 0, -111, -62, 255}, /* 37 */
+    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 38 */
+    {0, -22, 22, 0, 0, 576, 0, -126, -15, 255}, /* 39 */
+    {-11, -22, 30, 0, 512, 32, -76, -102, 0, 255}, /* 40 */
+    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 41 */
+    {0, -22, 22, 0, 0, 576, 0, -126, -15, 255}, /* 42 */
+    {0, -24, 30, 0, 0, 0, 0, -127, -3, 255}, /* 43 */
+    {-11, -22, 30, 0, 512, 32, -76, -102, 0, 255}, /* 44 */
+    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 45 */
+    {-18, -10, 11, 0, 896, 1376, -110, -49, -42, 255}, /* 46 */
+    {-11, -14, 4, 0, 640, 1792, -82, -68, -69, 255}, /* 47 */
+    {0, -20, 0, 0, 0, 2048, 0, -95, -85, 255}, /* 48 */
+    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 49 */
+    {-11, -14, 4, 0, 640, 1792, -82, -68, -69, 255}, /* 50 */
+    {-11, -22, 30, 0, 512, 32, -76, -102, 0, 255}, /* 51 */
+    {-18, -13, 28, 0, 928, 256, -109, -63, 17, 255}, /* 52 */
+    {-3, -21, 13, 0, 192, 1152, -71, -103, -23, 255}, /* 53 */
+    {0, 13, 2, 0, 0, 0, 0, 86, -94, 255}, /* 54 */
+    {0, 24, 27, 0, 0, 0, 0, 126, 12, 255}, /* 55 */
+    {16, 15, 10, 0, 0, 0, 88, 77, -50, 255}, /* 56 */
+    {-16, 15, 10, 0, 0, 0, -88, 77, -50, 255}, /* 57 */
+    {15, 13, 40, 0, 0, 0, 79, 75, 66, 255}, /* 58 */
+    {21, 1, 23, 0, 0, 0, 127, 10, -4, 255}, /* 59 */
+    {-15, 13, 40, 0, 0, 0, -79, 75, 66, 255}, /* 60 */
+    {-21, 1, 23, 0, 0, 0, -127, 10, -4, 255}, /* 61 */
+    {0, 11, 47, 0, 0, 0, 0, 64, 110, 255}, /* 62 */
+    {18, 1, 41, 0, 0, 0, 101, 2, 77, 255}, /* 63 */
+    {18, -13, 28, 0, 0, 0, 109, -63, 17, 255}, /* 64 */
+    {0, -1, 49, 0, 0, 0, 0, 5, 127, 255}, /* 65 */
+    {11, -22, 30, 0, 0, 0, 76, -102, 0, 255}, /* 66 */
+    {-18, 1, 41, 0, 0, 0, -101, 2, 77, 255}, /* 67 */
+    {-18, -13, 28, 0, 0, 0, -109, -63, 17, 255}, /* 68 */
+    {-11, -22, 30, 0, 0, 0, -76, -102, 0, 255}, /* 69 */
+    {8, -22, 39, 0, 0, 0, 52, -99, 61, 255}, /* 70 */
+    {0, -24, 30, 0, 0, 0, 0, -127, -3, 255}, /* 71 */
+    {0, -16, 47, 0, 0, 0, 0, -61, 111, 255}, /* 72 */
+    {-8, -22, 39, 0, 0, 0, -52, -99, 61, 255}, /* 73 */
+    {-6, -24, 32, 0, 0, 0, 14, 94, -84, 255}, /* 74 */
+    {-3, -24, 32, 0, 0, 0, 118, -14, -45, 255}, /* 75 */
+    {-12, -26, 21, 0, 0, 0, -26, -28, -121, 255}, /* 76 */
+    {-6, -14, 37, 0, 0, 0, 32, 115, 42, 255}, /* 77 */
+    {-14, -20, 31, 0, 0, 0, -107, 63, -28, 255}, /* 78 */
+    {-9, -26, 37, 0, 0, 0, -16, -82, 96, 255}, /* 79 */
+    {15, -16, 29, 0, 0, 0, -101, 56, -52, 255}, /* 80 */
+    {19, -12, 28, 0, 0, 0, 54, 106, -44, 255}, /* 81 */
+    {17, -19, 20, 0, 0, 0, 7, -35, -122, 255}, /* 82 */
+    {14, -10, 35, 0, 0, 0, -42, 83, 86, 255}, /* 83 */
+    {13, -20, 29, 0, 0, 0, -95, -82, 16, 255}, /* 84 */
+    {20, -18, 32, 0, 0, 0, 89, -61, 66, 255}, /* 85 */
+    {-17, -15, 31, 0, 0, 0, 90, 47, -76, 255}, /* 86 */
+    {-13, -18, 31, 0, 0, 0, 104, -73, 5, 255}, /* 87 */
+    {-20, -18, 18, 0, 0, 0, -16, -29, -123, 255}, /* 88 */
+    {-11, -10, 36, 0, 0, 0, 78, 70, 72, 255}, /* 89 */
+    {-20, -11, 27, 0, 0, 0, -42, 115, -36, 255}, /* 90 */
+    {-20, -17, 32, 0, 0, 0, -89, -52, 74, 255}, /* 91 */
+    {-21, -8, 27, 0, 0, 0, 118, 29, -38, 255}, /* 92 */
+    {-19, -11, 28, 0, 0, 0, 77, -99, 20, 255}, /* 93 */
+    {-21, -8, 7, 0, 0, 0, 84, -95, -7, 255}, /* 94 */
+    {-20, -8, -3, 0, 0, 0, 18, -3, -126, 255}, /* 95 */
+    {-23, -8, 4, 0, 0, 0, -114, -50, -24, 255}, /* 96 */
+    {-17, -5, 32, 0, 0, 0, 83, 35, 89, 255}, /* 97 */
+    {-21, -3, 4, 0, 0, 0, 22, 121, -31, 255}, /* 98 */
+    {-21, -2, 26, 0, 0, 0, 11, 126, 16, 255}, /* 99 */
+    {-23, -8, 28, 0, 0, 0, -108, -34, 57, 255}, /* 100 */
+    {21, -8, 27, 0, 0, 0, -122, -5, -36, 255}, /* 101 */
+    {21, -11, -3, 0, 0, 0, -25, -37, -119, 255}, /* 102 */
+    {20, -11, 5, 0, 0, 0, -65, -109, -2, 255}, /* 103 */
+    {20, -12, 28, 0, 0, 0, -38, -107, 58, 255}, /* 104 */
+    {22, -10, 2, 0, 0, 0, 123, -21, -22, 255}, /* 105 */
+    {21, -3, 24, 0, 0, 0, -25, 124, 0, 255}, /* 106 */
+    {17, -5, 32, 0, 0, 0, -68, 45, 98, 255}, /* 107 */
+    {23, -8, 26, 0, 0, 0, 120, 0, 41, 255}, /* 108 */
+    {20, -7, 5, 0, 0, 0, -37, 118, -28, 255}, /* 109 */
+    {22, 3, 17, 0, 0, 0, 103, 57, -47, 255}, /* 110 */
+    {21, 1, 23, 0, 0, 0, 126, 9, 16, 255}, /* 111 */
+    {20, -3, 20, 0, 0, 0, 114, -47, -30, 255}, /* 112 */
+    {18, 2, 13, 0, 0, 0, 83, 20, -94, 255}, /* 113 */
+    {19, 4, 19, 0, 0, 0, 53, 114, 19, 255}, /* 114 */
+    {16, 15, 10, 0, 0, 0, 88, 77, -50, 255}, /* 115 */
+    {21, 1, 23, 0, 0, 0, 127, 10, -4, 255}, /* 116 */
+    {13, 4, 2, 0, 0, 0, 82, 17, -95, 255}, /* 117 */
+    {18, -10, 11, 0, 0, 0, 110, -49, -42, 255}, /* 118 */
+    {18, -13, 28, 0, 0, 0, 109, -63, 17, 255}, /* 119 */
+    {0, -20, 0, 0, 0, 0, 0, -95, -85, 255}, /* 120 */
+    {0, 0, -4, 0, 0, 0, 0, 9, -127, 255}, /* 121 */
+    {0, 13, 2, 0, 0, 0, 0, 86, -94, 255}, /* 122 */
+    {11, -14, 4, 0, 0, 0, 82, -68, -69, 255}, /* 123 */
+    {-16, 15, 10, 0, 0, 0, -88, 77, -50, 255}, /* 124 */
+    {-13, 4, 2, 0, 0, 0, -82, 17, -95, 255}, /* 125 */
+    {-21, 1, 23, 0, 0, 0, -127, 10, -4, 255}, /* 126 */
+    {-18, -10, 11, 0, 0, 0, -110, -49, -42, 255}, /* 127 */
+    {-18, -13, 28, 0, 0, 0, -109, -63, 17, 255}, /* 128 */
+    {-11, -14, 4, 0, 0, 0, -82, -68, -69, 255}, /* 129 */
+    {-22, 3, 17, 0, 0, 0, -103, 57, -47, 255}, /* 130 */
+    {-20, -3, 20, 0, 0, 0, -114, -47, -30, 255}, /* 131 */
+    {-21, 1, 23, 0, 0, 0, -126, 9, 16, 255}, /* 132 */
+    {-18, 2, 13, 0, 0, 0, -83, 20, -94, 255}, /* 133 */
+    {-19, 4, 19, 0, 0, 0, -53, 114, 19, 255}, /* 134 */
 };
 
 static Gfx gfx_Catherine_Head[] = {
     gsDPSetCombineMode(G_CC_MODULATEIDECALA, G_CC_MODULATEIDECALA),
     gsDPPipeSync(),
-    gsSPVertex(vtx_Catherine_Head+0, 15, 0),
-    gsSP2Triangles(0, 1, 2, 0, 3, 0, 4, 0),
-    gsSP2Triangles(5, 0, 6, 0, 4, 0, 2, 0),
-    gsSP2Triangles(1, 0, 7, 0, 1, 7, 8, 0),
-    gsSP2Triangles(0, 9, 6, 0, 3, 9, 0, 0),
-    gsSP2Triangles(7, 0, 5, 0, 10, 2, 1, 0),
-    gsSP2Triangles(3, 4, 10, 0, 11, 12, 10, 0),
-    gsSP2Triangles(4, 2, 10, 0, 1, 13, 10, 0),
-    gsSP2Triangles(1, 8, 13, 0, 10, 12, 14, 0),
-    gsSP2Triangles(3, 10, 14, 0, 13, 11, 10, 0),
-
-    gsSPVertex(vtx_Catherine_Head+15, 32, 0),
+    gsSPVertex(vtx_Catherine_Head+0, 30, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(6, 7, 8, 0, 9, 10, 11, 0),
+    gsSP2Triangles(12, 13, 14, 0, 15, 16, 17, 0),
+    gsSP2Triangles(18, 19, 20, 0, 21, 22, 23, 0),
+    gsSP2Triangles(24, 25, 26, 0, 27, 28, 29, 0),
+
+    gsSPVertex(vtx_Catherine_Head+30, 24, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(6, 7, 8, 0, 9, 10, 11, 0),
+    gsSP2Triangles(12, 13, 14, 0, 15, 16, 17, 0),
+    gsSP2Triangles(18, 19, 20, 0, 21, 22, 23, 0),
+
     gsDPSetCombineMode(G_CC_PRIMLITE, G_CC_PRIMLITE),
     gsDPSetPrimColor(0, 0, 175, 42, 44, 255),
     gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_Head+54, 32, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 3, 1, 0),
     gsSP2Triangles(2, 1, 4, 0, 5, 2, 4, 0),
     gsSP2Triangles(3, 6, 1, 0, 7, 6, 3, 0),
@@ -270,7 +311,7 @@ static Gfx gfx_Catherine_Head[] = {
     gsSP2Triangles(28, 27, 31, 0, 28, 31, 30, 0),
     gsSP2Triangles(27, 29, 31, 0, 30, 31, 29, 0),
 
-    gsSPVertex(vtx_Catherine_Head+47, 24, 0),
+    gsSPVertex(vtx_Catherine_Head+86, 24, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 3, 1, 0),
     gsSP2Triangles(0, 2, 4, 0, 0, 4, 3, 0),
     gsSP2Triangles(2, 1, 5, 0, 2, 5, 4, 0),
@@ -290,8 +331,8 @@ static Gfx gfx_Catherine_Head[] = {
     gsSP2Triangles(20, 23, 16, 0, 19, 16, 23, 0),
     gsSP2Triangles(22, 23, 20, 0, 22, 19, 23, 0),
 
-    gsSPVertex(vtx_Catherine_Head+71, 25, 0),
     gsDPSetPrimColor(0, 0, 250, 210, 184, 255),
+    gsSPVertex(vtx_Catherine_Head+110, 25, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
     gsSP2Triangles(4, 0, 3, 0, 1, 0, 4, 0),
     gsSP2Triangles(5, 6, 7, 0, 7, 6, 8, 0),
@@ -318,111 +359,203 @@ static Vtx vtx_Catherine_Chest[] = {
     {13, 15, -1, 0, 576, 2048, 61, 90, -66, 255}, /* 7 */
     {16, 16, 26, 0, 512, 1024, 72, 103, -17, 255}, /* 8 */
     {21, 4, 19, 0, 128, 1280, 125, 7, -19, 255}, /* 9 */
-    {0, 16, -1, 0, 992, 2048, 0, 110, -63, 255}, /* 10 */
-    {0, 16, 25, 0, 1024, 1024, 0, 127, -9, 255}, /* 11 */
-    {23, 0, 28, 0, 0, 928, 125, -20, -12, 255}, /* 12 */
-    {0, 18, 37, 0, 1024, 608, 0, 121, 39, 255}, /* 13 */
-    {19, 17, 39, 0, 480, 608, 70, 100, 36, 255}, /* 14 */
-    {24, 4, 41, 0, 128, 416, 116, 5, 51, 255}, /* 15 */
-    {0, 5, 50, 0, 896, 0, 0, 26, 124, 255}, /* 16 */
-    {11, 4, 50, 0, 576, 32, 26, 16, 123, 255}, /* 17 */
-    {-18, 3, 0, 0, 960, 128, -107, -1, -69, 255}, /* 18 */
-    {-13, 15, -1, 0, 960, 128, -61, 90, -66, 255}, /* 19 */
-    {-13, 15, -1, 0, 96, 96, -61, 90, -66, 255}, /* 20 */
-    {-18, 3, 0, 0, 160, 2048, -107, -1, -69, 255}, /* 21 */
-    {-21, 4, 19, 0, 128, 1280, -125, 7, -19, 255}, /* 22 */
-    {-16, 16, 26, 0, 512, 1024, -72, 103, -17, 255}, /* 23 */
-    {-13, 15, -1, 0, 576, 2048, -61, 90, -66, 255}, /* 24 */
-    {-23, 0, 28, 0, 0, 928, -125, -20, -12, 255}, /* 25 */
-    {-19, 17, 39, 0, 480, 608, -70, 100, 36, 255}, /* 26 */
-    {-24, 4, 41, 0, 128, 416, -116, 5, 51, 255}, /* 27 */
-    {-11, 4, 50, 0, 576, 32, -26, 16, 123, 255}, /* 28 */
-    {0, -13, 0, 0, 960, 128, 0, -110, -63, 255}, /* 29 */
-    {0, 2, -9, 0, 960, 128, 0, -3, -127, 255}, /* 30 */
-    {14, -8, 0, 0, 960, 128, 78, -78, -63, 255}, /* 31 */
-    {18, 3, 0, 0, 960, 128, 107, -1, -69, 255}, /* 32 */
-    {23, 0, 28, 0, 896, 928, 125, -20, -12, 255}, /* 33 */
-    {24, 4, 41, 0, 896, 416, 116, 5, 51, 255}, /* 34 */
-    {14, -8, 44, 0, 448, 512, 58, -75, 85, 255}, /* 35 */
-    {13, -19, 30, 0, 320, 1056, 59, -113, 2, 255}, /* 36 */
-    {14, -8, 0, 0, 640, 1984, 78, -78, -63, 255}, /* 37 */
-    {18, 3, 0, 0, 1024, 2016, 107, -1, -69, 255}, /* 38 */
-    {21, 4, 19, 0, 960, 1280, 125, 7, -19, 255}, /* 39 */
-    {15, -10, 17, 0, 576, 1408, 85, -89, -31, 255}, /* 40 */
-    {0, -13, 0, 0, 96, 2048, 0, -110, -63, 255}, /* 41 */
-    {0, -14, 18, 0, 128, 1472, 0, -121, -39, 255}, /* 42 */
-    {0, -19, 30, 0, 0, 1088, 0, -127, 5, 255}, /* 43 */
-    {11, 4, 50, 0, 448, 96, 26, 16, 123, 255}, /* 44 */
-    {0, -12, 42, 0, 0, 512, 0, -86, 93, 255}, /* 45 */
-    {0, 5, 50, 0, 160, 0, 0, 26, 124, 255}, /* 46 */
-    {-14, -8, 0, 0, 960, 128, -78, -78, -63, 255}, /* 47 */
-    {-18, 3, 0, 0, 960, 128, -107, -1, -69, 255}, /* 48 */
-    {-23, 0, 28, 0, 896, 928, -125, -20, -12, 255}, /* 49 */
-    {-13, -19, 30, 0, 320, 1056, -59, -113, 2, 255}, /* 50 */
-    {-14, -8, 44, 0, 448, 512, -58, -75, 85, 255}, /* 51 */
-    {-24, 4, 41, 0, 896, 416, -116, 5, 51, 255}, /* 52 */
-    {-14, -8, 0, 0, 640, 1984, -78, -78, -63, 255}, /* 53 */
-    {-15, -10, 17, 0, 576, 1408, -85, -89, -31, 255}, /* 54 */
-    {-21, 4, 19, 0, 960, 1280, -125, 7, -19, 255}, /* 55 */
-    {-18, 3, 0, 0, 1024, 2016, -107, -1, -69, 255}, /* 56 */
-    {-11, 4, 50, 0, 448, 96, -26, 16, 123, 255}, /* 57 */
-    {-19, 18, 45, 0, 0, 0, -105, -68, 24, 255}, /* 58 */
-    {-19, 20, 45, 0, 0, 0, -97, 78, 23, 255}, /* 59 */
-    {12, 19, -3, 0, 0, 0, -65, 87, -65, 255}, /* 60 */
-    {12, 17, -3, 0, 0, 0, -72, -81, -65, 255}, /* 61 */
-    {-11, 20, 50, 0, 0, 0, 28, 73, 100, 255}, /* 62 */
-    {19, 20, 1, 0, 0, 0, 93, 80, 33, 255}, /* 63 */
-    {-11, 18, 50, 0, 0, 0, 18, -73, 102, 255}, /* 64 */
-    {19, 17, 1, 0, 0, 0, 84, -89, 34, 255}, /* 65 */
-    {21, 19, -10, 0, 0, 0, 62, 65, -90, 255}, /* 66 */
-    {21, 17, -10, 0, 0, 0, 50, -74, -91, 255}, /* 67 */
+    {13, 15, -1, 0, 576, 2048, 61, 90, -66, 255}, /* 10 */
+    {0, 16, -1, 0, 992, 2048, 0, 110, -63, 255}, /* 11 */
+    {0, 16, 25, 0, 1024, 1024, 0, 127, -9, 255}, /* 12 */
+    {16, 16, 26, 0, 512, 1024, 72, 103, -17, 255}, /* 13 */
+    {21, 4, 19, 0, 128, 1280, 125, 7, -19, 255}, /* 14 */
+    {16, 16, 26, 0, 512, 1024, 72, 103, -17, 255}, /* 15 */
+    {23, 0, 28, 0, 0, 928, 125, -20, -12, 255}, /* 16 */
+    {16, 16, 26, 0, 512, 1024, 72, 103, -17, 255}, /* 17 */
+    {0, 16, 25, 0, 1024, 1024, 0, 127, -9, 255}, /* 18 */
+    {0, 18, 37, 0, 1024, 608, 0, 121, 39, 255}, /* 19 */
+    {19, 17, 39, 0, 480, 608, 70, 100, 36, 255}, /* 20 */
+    {23, 0, 28, 0, 0, 928, 125, -20, -12, 255}, /* 21 */
+    {16, 16, 26, 0, 512, 1024, 72, 103, -17, 255}, /* 22 */
+    {19, 17, 39, 0, 480, 608, 70, 100, 36, 255}, /* 23 */
+    {24, 4, 41, 0, 128, 416, 116, 5, 51, 255}, /* 24 */
+    {19, 17, 39, 0, 480, 608, 70, 100, 36, 255}, /* 25 */
+    {0, 18, 37, 0, 1024, 608, 0, 121, 39, 255}, /* 26 */
+    {0, 5, 50, 0, 896, 0, 0, 26, 124, 255}, /* 27 */
+    {11, 4, 50, 0, 576, 32, 26, 16, 123, 255}, /* 28 */
+    {24, 4, 41, 0, 128, 416, 116, 5, 51, 255}, /* 29 */
+    {19, 17, 39, 0, 480, 608, 70, 100, 36, 255}, /* 30 */
+    {11, 4, 50, 0, 576, 32, 26, 16, 123, 255}, /* 31 */
+    {-18, 3, 0, 0, 960, 128, -107, -1, -69, 255}, /* 32 */
+    {-13, 15, -1, 0, 960, 128, -61, 90, -66, 255}, /* 33 */
+    {0, 2, -9, 0, 960, 128, 0, -3, -127, 255}, /* 34 */
+    {-13, 15, -1, 0, 96, 96, -61, 90, -66, 255}, /* 35 */
+    {0, 16, -1, 0, 96, 96, 0, 110, -63, 255}, /* 36 */
+    {0, 2, -9, 0, 96, 96, 0, -3, -127, 255}, /* 37 */
+    {-18, 3, 0, 0, 160, 2048, -107, -1, -69, 255}, /* 38 */
+    {-21, 4, 19, 0, 128, 1280, -125, 7, -19, 255}, /* 39 */
+    {-16, 16, 26, 0, 512, 1024, -72, 103, -17, 255}, /* 40 */
+    {-13, 15, -1, 0, 576, 2048, -61, 90, -66, 255}, /* 41 */
+    {-13, 15, -1, 0, 576, 2048, -61, 90, -66, 255}, /* 42 */
+    {-16, 16, 26, 0, 512, 1024, -72, 103, -17, 255}, /* 43 */
+    {0, 16, 25, 0, 1024, 1024, 0, 127, -9, 255}, /* 44 */
+    {0, 16, -1, 0, 992, 2048, 0, 110, -63, 255}, /* 45 */
+    {-21, 4, 19, 0, 128, 1280, -125, 7, -19, 255}, /* 46 */
+    {-23, 0, 28, 0, 0, 928, -125, -20, -12, 255}, /* 47 */
+    {-16, 16, 26, 0, 512, 1024, -72, 103, -17, 255}, /* 48 */
+    {-16, 16, 26, 0, 512, 1024, -72, 103, -17, 255}, /* 49 */
+    {-19, 17, 39, 0, 480, 608, -70, 100, 36, 255}, /* 50 */
+    {0, 18, 37, 0, 1024, 608, 0, 121, 39, 255}, /* 51 */
+    {0, 16, 25, 0, 1024, 1024, 0, 127, -9, 255}, /* 52 */
+    {-23, 0, 28, 0, 0, 928, -125, -20, -12, 255}, /* 53 */
+    {-24, 4, 41, 0, 128, 416, -116, 5, 51, 255}, /* 54 */
+    {-19, 17, 39, 0, 480, 608, -70, 100, 36, 255}, /* 55 */
+    {-16, 16, 26, 0, 512, 1024, -72, 103, -17, 255}, /* 56 */
+    {-19, 17, 39, 0, 480, 608, -70, 100, 36, 255}, /* 57 */
+    {-11, 4, 50, 0, 576, 32, -26, 16, 123, 255}, /* 58 */
+    {0, 5, 50, 0, 896, 0, 0, 26, 124, 255}, /* 59 */
+    {0, 18, 37, 0, 1024, 608, 0, 121, 39, 255}, /* 60 */
+    {-24, 4, 41, 0, 128, 416, -116, 5, 51, 255}, /* 61 */
+    {-11, 4, 50, 0, 576, 32, -26, 16, 123, 255}, /* 62 */
+    {-19, 17, 39, 0, 480, 608, -70, 100, 36, 255}, /* 63 */
+    {0, -13, 0, 0, 960, 128, 0, -110, -63, 255}, /* 64 */
+    {0, 2, -9, 0, 960, 128, 0, -3, -127, 255}, /* 65 */
+    {14, -8, 0, 0, 960, 128, 78, -78, -63, 255}, /* 66 */
+    {14, -8, 0, 0, 960, 128, 78, -78, -63, 255}, /* 67 */
+    {0, 2, -9, 0, 960, 128, 0, -3, -127, 255}, /* 68 */
+    {18, 3, 0, 0, 960, 128, 107, -1, -69, 255}, /* 69 */
+    {23, 0, 28, 0, 896, 928, 125, -20, -12, 255}, /* 70 */
+    {24, 4, 41, 0, 896, 416, 116, 5, 51, 255}, /* 71 */
+    {14, -8, 44, 0, 448, 512, 58, -75, 85, 255}, /* 72 */
+    {13, -19, 30, 0, 320, 1056, 59, -113, 2, 255}, /* 73 */
+    {14, -8, 0, 0, 640, 1984, 78, -78, -63, 255}, /* 74 */
+    {18, 3, 0, 0, 1024, 2016, 107, -1, -69, 255}, /* 75 */
+    {21, 4, 19, 0, 960, 1280, 125, 7, -19, 255}, /* 76 */
+    {15, -10, 17, 0, 576, 1408, 85, -89, -31, 255}, /* 77 */
+    {0, -13, 0, 0, 96, 2048, 0, -110, -63, 255}, /* 78 */
+    {14, -8, 0, 0, 640, 1984, 78, -78, -63, 255}, /* 79 */
+    {15, -10, 17, 0, 576, 1408, 85, -89, -31, 255}, /* 80 */
+    {0, -14, 18, 0, 128, 1472, 0, -121, -39, 255}, /* 81 */
+    {15, -10, 17, 0, 576, 1408, 85, -89, -31, 255}, /* 82 */
+    {21, 4, 19, 0, 960, 1280, 125, 7, -19, 255}, /* 83 */
+    {23, 0, 28, 0, 896, 928, 125, -20, -12, 255}, /* 84 */
+    {13, -19, 30, 0, 320, 1056, 59, -113, 2, 255}, /* 85 */
+    {0, -14, 18, 0, 128, 1472, 0, -121, -39, 255}, /* 86 */
+    {15, -10, 17, 0, 576, 1408, 85, -89, -31, 255}, /* 87 */
+    {13, -19, 30, 0, 320, 1056, 59, -113, 2, 255}, /* 88 */
+    {0, -19, 30, 0, 0, 1088, 0, -127, 5, 255}, /* 89 */
+    {14, -8, 44, 0, 448, 512, 58, -75, 85, 255}, /* 90 */
+    {24, 4, 41, 0, 896, 416, 116, 5, 51, 255}, /* 91 */
+    {11, 4, 50, 0, 448, 96, 26, 16, 123, 255}, /* 92 */
+    {0, -12, 42, 0, 0, 512, 0, -86, 93, 255}, /* 93 */
+    {11, 4, 50, 0, 448, 96, 26, 16, 123, 255}, /* 94 */
+    {0, 5, 50, 0, 160, 0, 0, 26, 124, 255}, /* 95 */
+    {14, -8, 44, 0, 448, 512, 58, -75, 85, 255}, /* 96 */
+    {11, 4, 50, 0, 448, 96, 26, 16, 123, 255}, /* 97 */
+    {0, -12, 42, 0, 0, 512, 0, -86, 93, 255}, /* 98 */
+    {13, -19, 30, 0, 320, 1056, 59, -113, 2, 255}, /* 99 */
+    {14, -8, 44, 0, 448, 512, 58, -75, 85, 255}, /* 100 */
+    {0, -12, 42, 0, 0, 512, 0, -86, 93, 255}, /* 101 */
+    {0, -19, 30, 0, 0, 1088, 0, -127, 5, 255}, /* 102 */
+    {0, -13, 0, 0, 960, 128, 0, -110, -63, 255}, /* 103 */
+    {-14, -8, 0, 0, 960, 128, -78, -78, -63, 255}, /* 104 */
+    {0, 2, -9, 0, 960, 128, 0, -3, -127, 255}, /* 105 */
+    {-14, -8, 0, 0, 960, 128, -78, -78, -63, 255}, /* 106 */
+    {-18, 3, 0, 0, 960, 128, -107, -1, -69, 255}, /* 107 */
+    {0, 2, -9, 0, 960, 128, 0, -3, -127, 255}, /* 108 */
+    {-23, 0, 28, 0, 896, 928, -125, -20, -12, 255}, /* 109 */
+    {-13, -19, 30, 0, 320, 1056, -59, -113, 2, 255}, /* 110 */
+    {-14, -8, 44, 0, 448, 512, -58, -75, 85, 255}, /* 111 */
+    {-24, 4, 41, 0, 896, 416, -116, 5, 51, 255}, /* 112 */
+    {-14, -8, 0, 0, 640, 1984, -78, -78, -63, 255}, /* 113 */
+    {-15, -10, 17, 0, 576, 1408, -85, -89, -31, 255}, /* 114 */
+    {-21, 4, 19, 0, 960, 1280, -125, 7, -19, 255}, /* 115 */
+    {-18, 3, 0, 0, 1024, 2016, -107, -1, -69, 255}, /* 116 */
+    {0, -13, 0, 0, 96, 2048, 0, -110, -63, 255}, /* 117 */
+    {0, -14, 18, 0, 128, 1472, 0, -121, -39, 255}, /* 118 */
+    {-15, -10, 17, 0, 576, 1408, -85, -89, -31, 255}, /* 119 */
+    {-14, -8, 0, 0, 640, 1984, -78, -78, -63, 255}, /* 120 */
+    {-15, -10, 17, 0, 576, 1408, -85, -89, -31, 255}, /* 121 */
+    {-13, -19, 30, 0, 320, 1056, -59, -113, 2, 255}, /* 122 */
+    {-23, 0, 28, 0, 896, 928, -125, -20, -12, 255}, /* 123 */
+    {-21, 4, 19, 0, 960, 1280, -125, 7, -19, 255}, /* 124 */
+    {0, -14, 18, 0, 128, 1472, 0, -121, -39, 255}, /* 125 */
+    {0, -19, 30, 0, 0, 1088, 0, -127, 5, 255}, /* 126 */
+    {-13, -19, 30, 0, 320, 1056, -59, -113, 2, 255}, /* 127 */
+    {0, -14, 18, 0, 128, 1472, 0, -121, -39, 255}, /* 128 */
+    {-13, -19, 30, 0, 320, 1056, -59, -113, 2, 255}, /* 129 */
+    {-15, -10, 17, 0, 576, 1408, -85, -89, -31, 255}, /* 130 */
+    {-14, -8, 44, 0, 448, 512, -58, -75, 85, 255}, /* 131 */
+    {-11, 4, 50, 0, 448, 96, -26, 16, 123, 255}, /* 132 */
+    {-24, 4, 41, 0, 896, 416, -116, 5, 51, 255}, /* 133 */
+    {0, -12, 42, 0, 0, 512, 0, -86, 93, 255}, /* 134 */
+    {0, 5, 50, 0, 160, 0, 0, 26, 124, 255}, /* 135 */
+    {-11, 4, 50, 0, 448, 96, -26, 16, 123, 255}, /* 136 */
+    {-14, -8, 44, 0, 448, 512, -58, -75, 85, 255}, /* 137 */
+    {0, -12, 42, 0, 0, 512, 0, -86, 93, 255}, /* 138 */
+    {-11, 4, 50, 0, 448, 96, -26, 16, 123, 255}, /* 139 */
+    {-13, -19, 30, 0, 320, 1056, -59, -113, 2, 255}, /* 140 */
+    {0, -19, 30, 0, 0, 1088, 0, -127, 5, 255}, /* 141 */
+    {0, -12, 42, 0, 0, 512, 0, -86, 93, 255}, /* 142 */
+    {-14, -8, 44, 0, 448, 512, -58, -75, 85, 255}, /* 143 */
+    {-19, 18, 45, 0, 0, 0, -105, -68, 24, 255}, /* 144 */
+    {-19, 20, 45, 0, 0, 0, -97, 78, 23, 255}, /* 145 */
+    {12, 19, -3, 0, 0, 0, -65, 87, -65, 255}, /* 146 */
+    {12, 17, -3, 0, 0, 0, -72, -81, -65, 255}, /* 147 */
+    {-11, 20, 50, 0, 0, 0, 28, 73, 100, 255}, /* 148 */
+    {19, 20, 1, 0, 0, 0, 93, 80, 33, 255}, /* 149 */
+    {-11, 18, 50, 0, 0, 0, 18, -73, 102, 255}, /* 150 */
+    {19, 17, 1, 0, 0, 0, 84, -89, 34, 255}, /* 151 */
+    {21, 19, -10, 0, 0, 0, 62, 65, -90, 255}, /* 152 */
+    {21, 17, -10, 0, 0, 0, 50, -74, -91, 255}, /* 153 */
 };
 
 static Gfx gfx_Catherine_Chest[] = {
-    gsSPVertex(vtx_Catherine_Chest+0, 29, 0),
     gsDPSetCombineMode(G_CC_MODULATEIDECALA, G_CC_MODULATEIDECALA),
-    gsDPLoadTextureBlock(tex_Back, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
+    gsDPLoadTextureBlock(BackTex, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
     gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_Chest+0, 32, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(6, 7, 8, 0, 6, 8, 9, 0),
+    gsSP2Triangles(10, 11, 12, 0, 10, 12, 13, 0),
+    gsSP2Triangles(14, 15, 16, 0, 17, 18, 19, 0),
+    gsSP2Triangles(17, 19, 20, 0, 21, 22, 23, 0),
+    gsSP2Triangles(21, 23, 24, 0, 25, 26, 27, 0),
+    gsSP2Triangles(25, 27, 28, 0, 29, 30, 31, 0),
+
+    gsSPVertex(vtx_Catherine_Chest+32, 32, 0),
     gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
     gsSP2Triangles(6, 7, 8, 0, 6, 8, 9, 0),
-    gsSP2Triangles(7, 10, 11, 0, 7, 11, 8, 0),
-    gsSP2Triangles(9, 8, 12, 0, 8, 11, 13, 0),
-    gsSP2Triangles(8, 13, 14, 0, 12, 8, 14, 0),
-    gsSP2Triangles(12, 14, 15, 0, 14, 13, 16, 0),
-    gsSP2Triangles(14, 16, 17, 0, 15, 14, 17, 0),
-    gsSP2Triangles(18, 19, 1, 0, 20, 5, 4, 0),
-    gsSP2Triangles(21, 22, 23, 0, 21, 23, 24, 0),
-    gsSP2Triangles(24, 23, 11, 0, 24, 11, 10, 0),
-    gsSP2Triangles(22, 25, 23, 0, 23, 26, 13, 0),
-    gsSP2Triangles(23, 13, 11, 0, 25, 27, 26, 0),
-    gsSP2Triangles(25, 26, 23, 0, 26, 28, 16, 0),
-    gsSP2Triangles(26, 16, 13, 0, 27, 28, 26, 0),
-
-    gsSPVertex(vtx_Catherine_Chest+29, 29, 0),
-    gsDPLoadTextureBlock(tex_Chest, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
+    gsSP2Triangles(10, 11, 12, 0, 10, 12, 13, 0),
+    gsSP2Triangles(14, 15, 16, 0, 17, 18, 19, 0),
+    gsSP2Triangles(17, 19, 20, 0, 21, 22, 23, 0),
+    gsSP2Triangles(21, 23, 24, 0, 25, 26, 27, 0),
+    gsSP2Triangles(25, 27, 28, 0, 29, 30, 31, 0),
+
+    gsDPLoadTextureBlock(ChestTex, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
     gsDPPipeSync(),
-    gsSP2Triangles(0, 1, 2, 0, 2, 1, 3, 0),
-    gsSP2Triangles(4, 5, 6, 0, 4, 6, 7, 0),
-    gsSP2Triangles(8, 9, 10, 0, 8, 10, 11, 0),
-    gsSP2Triangles(12, 8, 11, 0, 12, 11, 13, 0),
-    gsSP2Triangles(11, 10, 4, 0, 11, 4, 7, 0),
-    gsSP2Triangles(13, 11, 7, 0, 13, 7, 14, 0),
-    gsSP2Triangles(6, 5, 15, 0, 16, 15, 17, 0),
-    gsSP2Triangles(6, 15, 16, 0, 7, 6, 16, 0),
-    gsSP2Triangles(7, 16, 14, 0, 0, 18, 1, 0),
-    gsSP2Triangles(18, 19, 1, 0, 20, 21, 22, 0),
-    gsSP2Triangles(20, 22, 23, 0, 24, 25, 26, 0),
-    gsSP2Triangles(24, 26, 27, 0, 12, 13, 25, 0),
-    gsSP2Triangles(12, 25, 24, 0, 25, 21, 20, 0),
-    gsSP2Triangles(25, 20, 26, 0, 13, 14, 21, 0),
-    gsSP2Triangles(13, 21, 25, 0, 22, 28, 23, 0),
-    gsSP2Triangles(16, 17, 28, 0, 22, 16, 28, 0),
-    gsSP2Triangles(21, 14, 16, 0, 21, 16, 22, 0),
-
-    gsSPVertex(vtx_Catherine_Chest+58, 10, 0),
+    gsSPVertex(vtx_Catherine_Chest+64, 32, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(6, 7, 8, 0, 6, 8, 9, 0),
+    gsSP2Triangles(10, 11, 12, 0, 10, 12, 13, 0),
+    gsSP2Triangles(14, 15, 16, 0, 14, 16, 17, 0),
+    gsSP2Triangles(18, 19, 20, 0, 18, 20, 21, 0),
+    gsSP2Triangles(22, 23, 24, 0, 22, 24, 25, 0),
+    gsSP2Triangles(26, 27, 28, 0, 29, 30, 31, 0),
+
+    gsSPVertex(vtx_Catherine_Chest+96, 32, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(3, 5, 6, 0, 7, 8, 9, 0),
+    gsSP2Triangles(10, 11, 12, 0, 13, 14, 15, 0),
+    gsSP2Triangles(13, 15, 16, 0, 17, 18, 19, 0),
+    gsSP2Triangles(17, 19, 20, 0, 21, 22, 23, 0),
+    gsSP2Triangles(21, 23, 24, 0, 25, 26, 27, 0),
+    gsSP2Triangles(25, 27, 28, 0, 29, 30, 31, 0),
+
+    gsSPVertex(vtx_Catherine_Chest+128, 16, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(6, 7, 8, 0, 9, 10, 11, 0),
+    gsSP2Triangles(12, 13, 14, 0, 12, 14, 15, 0),
+
     gsDPSetCombineMode(G_CC_PRIMLITE, G_CC_PRIMLITE),
     gsDPSetPrimColor(0, 0, 119, 83, 50, 255),
     gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_Chest+144, 10, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
     gsSP2Triangles(1, 4, 5, 0, 1, 5, 2, 0),
     gsSP2Triangles(4, 6, 7, 0, 4, 7, 5, 0),
@@ -450,8 +583,8 @@ static Vtx vtx_Catherine_LeftArm[] = {
 };
 
 static Gfx gfx_Catherine_LeftArm[] = {
-    gsSPVertex(vtx_Catherine_LeftArm+0, 12, 0),
     gsDPSetPrimColor(0, 0, 60, 71, 119, 255),
+    gsSPVertex(vtx_Catherine_LeftArm+0, 12, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
     gsSP2Triangles(1, 0, 4, 0, 5, 6, 4, 0),
     gsSP2Triangles(0, 7, 4, 0, 6, 1, 4, 0),
@@ -504,33 +637,35 @@ static Vtx vtx_Catherine_LeftFemur[] = {
     {-9, 11, -1, 0, 864, 0, -78, 75, 66, 255}, /* 5 */
     {-8, 9, -31, 0, 800, 1024, -72, 72, -76, 255}, /* 6 */
     {-7, -5, -32, 0, 800, 1024, -68, -71, -80, 255}, /* 7 */
-    {6, 11, -1, 0, 864, 0, 69, 79, 72, 255}, /* 8 */
-    {6, 9, -31, 0, 800, 1024, 72, 76, -72, 255}, /* 9 */
-    {6, 11, -1, 0, 160, 0, 69, 79, 72, 255}, /* 10 */
-    {7, -5, 0, 0, 160, 0, 75, -70, 75, 255}, /* 11 */
-    {6, -5, -32, 0, 224, 1024, 76, -68, -76, 255}, /* 12 */
-    {6, 9, -31, 0, 224, 1024, 72, 76, -72, 255}, /* 13 */
-    {-7, -5, -32, 0, 96, 960, -68, -71, -80, 255}, /* 14 */
-    {-8, 9, -31, 0, 96, 960, -72, 72, -76, 255}, /* 15 */
-    {6, 9, -31, 0, 96, 960, 72, 76, -72, 255}, /* 16 */
-    {6, -5, -32, 0, 96, 960, 76, -68, -76, 255}, /* 17 */
-    {7, -5, 0, 0, 96, 32, 75, -70, 75, 255}, /* 18 */
-    {6, 11, -1, 0, 96, 32, 69, 79, 72, 255}, /* 19 */
-    {-9, 11, -1, 0, 96, 32, -78, 75, 66, 255}, /* 20 */
-    {-10, -6, -1, 0, 96, 32, -76, -75, 69, 255}, /* 21 */
+    {-9, 11, -1, 0, 864, 0, -78, 75, 66, 255}, /* 8 */
+    {6, 11, -1, 0, 864, 0, 69, 79, 72, 255}, /* 9 */
+    {6, 9, -31, 0, 800, 1024, 72, 76, -72, 255}, /* 10 */
+    {-8, 9, -31, 0, 800, 1024, -72, 72, -76, 255}, /* 11 */
+    {6, 11, -1, 0, 160, 0, 69, 79, 72, 255}, /* 12 */
+    {7, -5, 0, 0, 160, 0, 75, -70, 75, 255}, /* 13 */
+    {6, -5, -32, 0, 224, 1024, 76, -68, -76, 255}, /* 14 */
+    {6, 9, -31, 0, 224, 1024, 72, 76, -72, 255}, /* 15 */
+    {-7, -5, -32, 0, 96, 960, -68, -71, -80, 255}, /* 16 */
+    {-8, 9, -31, 0, 96, 960, -72, 72, -76, 255}, /* 17 */
+    {6, 9, -31, 0, 96, 960, 72, 76, -72, 255}, /* 18 */
+    {6, -5, -32, 0, 96, 960, 76, -68, -76, 255}, /* 19 */
+    {7, -5, 0, 0, 96, 32, 75, -70, 75, 255}, /* 20 */
+    {6, 11, -1, 0, 96, 32, 69, 79, 72, 255}, /* 21 */
+    {-9, 11, -1, 0, 96, 32, -78, 75, 66, 255}, /* 22 */
+    {-10, -6, -1, 0, 96, 32, -76, -75, 69, 255}, /* 23 */
 };
 
 static Gfx gfx_Catherine_LeftFemur[] = {
-    gsSPVertex(vtx_Catherine_LeftFemur+0, 22, 0),
     gsDPSetCombineMode(G_CC_MODULATEIDECALA, G_CC_MODULATEIDECALA),
-    gsDPLoadTextureBlock(tex_Boot, G_IM_FMT_RGBA, G_IM_SIZ_16b, 64, 32, 0, G_TX_MIRROR, G_TX_MIRROR, 6, 5, G_TX_NOLOD, G_TX_NOLOD),
+    gsDPLoadTextureBlock(BootTex, G_IM_FMT_RGBA, G_IM_SIZ_16b, 64, 32, 0, G_TX_MIRROR, G_TX_MIRROR, 6, 5, G_TX_NOLOD, G_TX_NOLOD),
     gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_LeftFemur+0, 24, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
     gsSP2Triangles(4, 5, 6, 0, 4, 6, 7, 0),
-    gsSP2Triangles(5, 8, 9, 0, 5, 9, 6, 0),
-    gsSP2Triangles(10, 11, 12, 0, 10, 12, 13, 0),
-    gsSP2Triangles(14, 15, 16, 0, 14, 16, 17, 0),
-    gsSP2Triangles(18, 19, 20, 0, 18, 20, 21, 0),
+    gsSP2Triangles(8, 9, 10, 0, 8, 10, 11, 0),
+    gsSP2Triangles(12, 13, 14, 0, 12, 14, 15, 0),
+    gsSP2Triangles(16, 17, 18, 0, 16, 18, 19, 0),
+    gsSP2Triangles(20, 21, 22, 0, 20, 22, 23, 0),
     gsSPEndDisplayList(),
 };
 
@@ -543,30 +678,32 @@ static Vtx vtx_Catherine_RightFemur[] = {
     {6, -5, -32, 0, 800, 1024, 68, -71, -80, 255}, /* 5 */
     {7, 9, -31, 0, 800, 1024, 72, 72, -76, 255}, /* 6 */
     {8, 11, -1, 0, 864, 0, 78, 75, 66, 255}, /* 7 */
-    {-7, 9, -31, 0, 800, 1024, -72, 76, -72, 255}, /* 8 */
-    {-7, 11, -1, 0, 864, 0, -69, 79, 72, 255}, /* 9 */
-    {-7, 11, -1, 0, 160, 0, -69, 79, 72, 255}, /* 10 */
-    {-7, 9, -31, 0, 224, 1024, -72, 76, -72, 255}, /* 11 */
-    {-7, -5, -32, 0, 224, 1024, -76, -68, -76, 255}, /* 12 */
-    {-8, -5, 0, 0, 160, 0, -75, -70, 75, 255}, /* 13 */
-    {6, -5, -32, 0, 96, 960, 68, -71, -80, 255}, /* 14 */
-    {-7, -5, -32, 0, 96, 960, -76, -68, -76, 255}, /* 15 */
-    {-7, 9, -31, 0, 96, 960, -72, 76, -72, 255}, /* 16 */
-    {7, 9, -31, 0, 96, 960, 72, 72, -76, 255}, /* 17 */
-    {-8, -5, 0, 0, 96, 32, -75, -70, 75, 255}, /* 18 */
-    {8, -6, -1, 0, 96, 32, 76, -75, 69, 255}, /* 19 */
-    {8, 11, -1, 0, 96, 32, 78, 75, 66, 255}, /* 20 */
-    {-7, 11, -1, 0, 96, 32, -69, 79, 72, 255}, /* 21 */
+    {8, 11, -1, 0, 864, 0, 78, 75, 66, 255}, /* 8 */
+    {7, 9, -31, 0, 800, 1024, 72, 72, -76, 255}, /* 9 */
+    {-7, 9, -31, 0, 800, 1024, -72, 76, -72, 255}, /* 10 */
+    {-7, 11, -1, 0, 864, 0, -69, 79, 72, 255}, /* 11 */
+    {-7, 11, -1, 0, 160, 0, -69, 79, 72, 255}, /* 12 */
+    {-7, 9, -31, 0, 224, 1024, -72, 76, -72, 255}, /* 13 */
+    {-7, -5, -32, 0, 224, 1024, -76, -68, -76, 255}, /* 14 */
+    {-8, -5, 0, 0, 160, 0, -75, -70, 75, 255}, /* 15 */
+    {6, -5, -32, 0, 96, 960, 68, -71, -80, 255}, /* 16 */
+    {-7, -5, -32, 0, 96, 960, -76, -68, -76, 255}, /* 17 */
+    {-7, 9, -31, 0, 96, 960, -72, 76, -72, 255}, /* 18 */
+    {7, 9, -31, 0, 96, 960, 72, 72, -76, 255}, /* 19 */
+    {-8, -5, 0, 0, 96, 32, -75, -70, 75, 255}, /* 20 */
+    {8, -6, -1, 0, 96, 32, 76, -75, 69, 255}, /* 21 */
+    {8, 11, -1, 0, 96, 32, 78, 75, 66, 255}, /* 22 */
+    {-7, 11, -1, 0, 96, 32, -69, 79, 72, 255}, /* 23 */
 };
 
 static Gfx gfx_Catherine_RightFemur[] = {
-    gsSPVertex(vtx_Catherine_RightFemur+0, 22, 0),
+    gsSPVertex(vtx_Catherine_RightFemur+0, 24, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
     gsSP2Triangles(4, 5, 6, 0, 4, 6, 7, 0),
-    gsSP2Triangles(7, 6, 8, 0, 7, 8, 9, 0),
-    gsSP2Triangles(10, 11, 12, 0, 10, 12, 13, 0),
-    gsSP2Triangles(14, 15, 16, 0, 14, 16, 17, 0),
-    gsSP2Triangles(18, 19, 20, 0, 18, 20, 21, 0),
+    gsSP2Triangles(8, 9, 10, 0, 8, 10, 11, 0),
+    gsSP2Triangles(12, 13, 14, 0, 12, 14, 15, 0),
+    gsSP2Triangles(16, 17, 18, 0, 16, 18, 19, 0),
+    gsSP2Triangles(20, 21, 22, 0, 20, 22, 23, 0),
     gsSPEndDisplayList(),
 };
 
@@ -575,58 +712,73 @@ static Vtx vtx_Catherine_LeftFoot[] = {
     {10, -17, -12, 0, 1024, 768, 106, -27, -65, 255}, /* 1 */
     {-13, -17, -12, 0, 2048, 768, -105, -27, -66, 255}, /* 2 */
     {-11, 7, -12, 0, 1952, 32, -80, 73, -65, 255}, /* 3 */
-    {4, -27, -12, 0, 1312, 1024, 54, -101, -55, 255}, /* 4 */
-    {-7, -27, -12, 0, 1792, 1024, -54, -101, -55, 255}, /* 5 */
-    {-7, -27, -12, 0, -96, 2048, -54, -101, -55, 255}, /* 6 */
-    {4, -27, -12, 0, 256, 2048, 54, -101, -55, 255}, /* 7 */
-    {3, -22, -2, 0, 96, 1088, 46, -77, 89, 255}, /* 8 */
-    {-5, -22, -2, 0, 0, 1088, -47, -78, 89, 255}, /* 9 */
-    {8, 7, -12, 0, 512, 2048, 81, 73, -65, 255}, /* 10 */
-    {-11, 7, -12, 0, -96, 2048, -80, 73, -65, 255}, /* 11 */
-    {-8, 8, -1, 0, 32, 1088, -69, 86, 63, 255}, /* 12 */
-    {5, 8, -1, 0, 384, 1088, 68, 84, 66, 255}, /* 13 */
-    {4, -27, -12, 0, -32, 2048, 54, -101, -55, 255}, /* 14 */
-    {10, -17, -12, 0, 192, 2048, 106, -27, -65, 255}, /* 15 */
-    {7, -15, -2, 0, 224, 1088, 95, -24, 80, 255}, /* 16 */
-    {3, -22, -2, 0, -96, 1088, 46, -77, 89, 255}, /* 17 */
-    {10, -17, -12, 0, 224, 2048, 106, -27, -65, 255}, /* 18 */
-    {8, 7, -12, 0, 928, 2048, 81, 73, -65, 255}, /* 19 */
-    {5, 8, -1, 0, 896, 1088, 68, 84, 66, 255}, /* 20 */
-    {7, -15, -2, 0, 256, 1088, 95, -24, 80, 255}, /* 21 */
-    {-11, 7, -12, 0, 928, 2048, -80, 73, -65, 255}, /* 22 */
-    {-13, -17, -12, 0, 224, 2048, -105, -27, -66, 255}, /* 23 */
-    {-9, -15, -2, 0, 256, 1088, -98, -25, 77, 255}, /* 24 */
-    {-8, 8, -1, 0, 896, 1088, -69, 86, 63, 255}, /* 25 */
-    {-13, -17, -12, 0, 192, 2048, -105, -27, -66, 255}, /* 26 */
-    {-7, -27, -12, 0, -32, 2048, -54, -101, -55, 255}, /* 27 */
-    {-5, -22, -2, 0, -96, 1088, -47, -78, 89, 255}, /* 28 */
-    {-9, -15, -2, 0, 224, 1088, -98, -25, 77, 255}, /* 29 */
-    {-5, -22, -2, 0, 128, 1568, -47, -78, 89, 255}, /* 30 */
-    {3, -22, -2, 0, 128, 1568, 46, -77, 89, 255}, /* 31 */
-    {-2, -1, 5, 0, 128, 1568, -7, 9, 126, 255}, /* 32 */
-    {7, -15, -2, 0, 128, 1568, 95, -24, 80, 255}, /* 33 */
-    {5, 8, -1, 0, 128, 1568, 68, 84, 66, 255}, /* 34 */
-    {-8, 8, -1, 0, 128, 1568, -69, 86, 63, 255}, /* 35 */
-    {-9, -15, -2, 0, 128, 1568, -98, -25, 77, 255}, /* 36 */
+    {10, -17, -12, 0, 1024, 768, 106, -27, -65, 255}, /* 4 */
+    {4, -27, -12, 0, 1312, 1024, 54, -101, -55, 255}, /* 5 */
+    {-7, -27, -12, 0, 1792, 1024, -54, -101, -55, 255}, /* 6 */
+    {-13, -17, -12, 0, 2048, 768, -105, -27, -66, 255}, /* 7 */
+    {-5, -22, -2, 0, 128, 1568, -47, -78, 89, 255}, /* 8 */
+    {3, -22, -2, 0, 128, 1568, 46, -77, 89, 255}, /* 9 */
+    {-2, -1, 5, 0, 128, 1568, -7, 9, 126, 255}, /* 10 */
+    {-7, -27, -12, 0, -96, 2048, -54, -101, -55, 255}, /* 11 */
+    {4, -27, -12, 0, 256, 2048, 54, -101, -55, 255}, /* 12 */
+    {3, -22, -2, 0, 96, 1088, 46, -77, 89, 255}, /* 13 */
+    {-5, -22, -2, 0, 0, 1088, -47, -78, 89, 255}, /* 14 */
+    {8, 7, -12, 0, 512, 2048, 81, 73, -65, 255}, /* 15 */
+    {-11, 7, -12, 0, -96, 2048, -80, 73, -65, 255}, /* 16 */
+    {-8, 8, -1, 0, 32, 1088, -69, 86, 63, 255}, /* 17 */
+    {5, 8, -1, 0, 384, 1088, 68, 84, 66, 255}, /* 18 */
+    {4, -27, -12, 0, -32, 2048, 54, -101, -55, 255}, /* 19 */
+    {10, -17, -12, 0, 192, 2048, 106, -27, -65, 255}, /* 20 */
+    {7, -15, -2, 0, 224, 1088, 95, -24, 80, 255}, /* 21 */
+    {3, -22, -2, 0, -96, 1088, 46, -77, 89, 255}, /* 22 */
+    {10, -17, -12, 0, 224, 2048, 106, -27, -65, 255}, /* 23 */
+    {8, 7, -12, 0, 928, 2048, 81, 73, -65, 255}, /* 24 */
+    {5, 8, -1, 0, 896, 1088, 68, 84, 66, 255}, /* 25 */
+    {7, -15, -2, 0, 256, 1088, 95, -24, 80, 255}, /* 26 */
+    {-11, 7, -12, 0, 928, 2048, -80, 73, -65, 255}, /* 27 */
+    {-13, -17, -12, 0, 224, 2048, -105, -27, -66, 255}, /* 28 */
+    {-9, -15, -2, 0, 256, 1088, -98, -25, 77, 255}, /* 29 */
+    {-8, 8, -1, 0, 896, 1088, -69, 86, 63, 255}, /* 30 */
+    {-13, -17, -12, 0, 192, 2048, -105, -27, -66, 255}, /* 31 */
+    {-7, -27, -12, 0, -32, 2048, -54, -101, -55, 255}, /* 32 */
+    {-5, -22, -2, 0, -96, 1088, -47, -78, 89, 255}, /* 33 */
+    {-9, -15, -2, 0, 224, 1088, -98, -25, 77, 255}, /* 34 */
+    {7, -15, -2, 0, 128, 1568, 95, -24, 80, 255}, /* 35 */
+    {5, 8, -1, 0, 128, 1568, 68, 84, 66, 255}, /* 36 */
+    {-2, -1, 5, 0, 128, 1568, -7, 9, 126, 255}, /* 37 */
+    {-8, 8, -1, 0, 128, 1568, -69, 86, 63, 255}, /* 38 */
+    {-9, -15, -2, 0, 128, 1568, -98, -25, 77, 255}, /* 39 */
+    {-2, -1, 5, 0, 128, 1568, -7, 9, 126, 255}, /* 40 */
+    {3, -22, -2, 0, 128, 1568, 46, -77, 89, 255}, /* 41 */
+    {7, -15, -2, 0, 128, 1568, 95, -24, 80, 255}, /* 42 */
+    {-2, -1, 5, 0, 128, 1568, -7, 9, 126, 255}, /* 43 */
+    {5, 8, -1, 0, 128, 1568, 68, 84, 66, 255}, /* 44 */
+    {-8, 8, -1, 0, 128, 1568, -69, 86, 63, 255}, /* 45 */
+    {-2, -1, 5, 0, 128, 1568, -7, 9, 126, 255}, /* 46 */
+    {-9, -15, -2, 0, 128, 1568, -98, -25, 77, 255}, /* 47 */
+    {-5, -22, -2, 0, 128, 1568, -47, -78, 89, 255}, /* 48 */
+    {-2, -1, 5, 0, 128, 1568, -7, 9, 126, 255}, /* 49 */
 };
 
 static Gfx gfx_Catherine_LeftFoot[] = {
-    gsSPVertex(vtx_Catherine_LeftFoot+0, 6, 0),
+    gsSPVertex(vtx_Catherine_LeftFoot+0, 8, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
-    gsSP2Triangles(1, 4, 5, 0, 1, 5, 2, 0),
+    gsSP2Triangles(4, 5, 6, 0, 4, 6, 7, 0),
 
-    gsSPVertex(vtx_Catherine_LeftFoot+6, 31, 0),
-    gsDPLoadTextureBlock(tex_Pants, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
+    gsDPLoadTextureBlock(PantsTex, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
     gsDPPipeSync(),
-    gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
-    gsSP2Triangles(4, 5, 6, 0, 4, 6, 7, 0),
-    gsSP2Triangles(8, 9, 10, 0, 8, 10, 11, 0),
-    gsSP2Triangles(12, 13, 14, 0, 12, 14, 15, 0),
-    gsSP2Triangles(16, 17, 18, 0, 16, 18, 19, 0),
-    gsSP2Triangles(20, 21, 22, 0, 20, 22, 23, 0),
-    gsSP2Triangles(24, 25, 26, 0, 27, 28, 26, 0),
-    gsSP2Triangles(29, 30, 26, 0, 25, 27, 26, 0),
-    gsSP2Triangles(28, 29, 26, 0, 30, 24, 26, 0),
+    gsSPVertex(vtx_Catherine_LeftFoot+8, 30, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(3, 5, 6, 0, 7, 8, 9, 0),
+    gsSP2Triangles(7, 9, 10, 0, 11, 12, 13, 0),
+    gsSP2Triangles(11, 13, 14, 0, 15, 16, 17, 0),
+    gsSP2Triangles(15, 17, 18, 0, 19, 20, 21, 0),
+    gsSP2Triangles(19, 21, 22, 0, 23, 24, 25, 0),
+    gsSP2Triangles(23, 25, 26, 0, 27, 28, 29, 0),
+
+    gsSPVertex(vtx_Catherine_LeftFoot+38, 12, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(6, 7, 8, 0, 9, 10, 11, 0),
     gsSPEndDisplayList(),
 };
 
@@ -635,60 +787,75 @@ static Vtx vtx_Catherine_RightFoot[] = {
     {10, 7, -12, 0, 1952, 32, 80, 73, -65, 255}, /* 1 */
     {12, -17, -12, 0, 2048, 768, 105, -27, -66, 255}, /* 2 */
     {-11, -17, -12, 0, 1024, 768, -106, -27, -65, 255}, /* 3 */
-    {6, -27, -12, 0, 1792, 1024, 54, -101, -55, 255}, /* 4 */
-    {-5, -27, -12, 0, 1312, 1024, -54, -101, -55, 255}, /* 5 */
-    {6, -27, -12, 0, -96, 2048, 54, -101, -55, 255}, /* 6 */
-    {4, -22, -2, 0, 0, 1088, 47, -78, 89, 255}, /* 7 */
-    {-4, -22, -2, 0, 96, 1088, -46, -77, 89, 255}, /* 8 */
-    {-5, -27, -12, 0, 256, 2048, -54, -101, -55, 255}, /* 9 */
-    {-9, 7, -12, 0, 512, 2048, -81, 73, -65, 255}, /* 10 */
-    {-6, 8, -1, 0, 384, 1088, -68, 84, 66, 255}, /* 11 */
-    {7, 8, -1, 0, 32, 1088, 69, 86, 63, 255}, /* 12 */
-    {10, 7, -12, 0, -96, 2048, 80, 73, -65, 255}, /* 13 */
-    {-5, -27, -12, 0, -32, 2048, -54, -101, -55, 255}, /* 14 */
-    {-4, -22, -2, 0, -96, 1088, -46, -77, 89, 255}, /* 15 */
-    {-8, -15, -2, 0, 224, 1088, -95, -24, 80, 255}, /* 16 */
-    {-11, -17, -12, 0, 192, 2048, -106, -27, -65, 255}, /* 17 */
-    {-11, -17, -12, 0, 224, 2048, -106, -27, -65, 255}, /* 18 */
-    {-8, -15, -2, 0, 256, 1088, -95, -24, 80, 255}, /* 19 */
-    {-6, 8, -1, 0, 896, 1088, -68, 84, 66, 255}, /* 20 */
-    {-9, 7, -12, 0, 928, 2048, -81, 73, -65, 255}, /* 21 */
-    {10, 7, -12, 0, 928, 2048, 80, 73, -65, 255}, /* 22 */
-    {7, 8, -1, 0, 896, 1088, 69, 86, 63, 255}, /* 23 */
-    {8, -15, -2, 0, 256, 1088, 98, -25, 77, 255}, /* 24 */
-    {12, -17, -12, 0, 224, 2048, 105, -27, -66, 255}, /* 25 */
-    {12, -17, -12, 0, 192, 2048, 105, -27, -66, 255}, /* 26 */
-    {8, -15, -2, 0, 224, 1088, 98, -25, 77, 255}, /* 27 */
-    {4, -22, -2, 0, -96, 1088, 47, -78, 89, 255}, /* 28 */
-    {6, -27, -12, 0, -32, 2048, 54, -101, -55, 255}, /* 29 */
-    {4, -22, -2, 0, 128, 1568, 47, -78, 89, 255}, /* 30 */
-    {1, -1, 5, 0, 128, 1568, 7, 9, 126, 255}, /* 31 */
-    {-4, -22, -2, 0, 128, 1568, -46, -77, 89, 255}, /* 32 */
-    {-8, -15, -2, 0, 128, 1568, -95, -24, 80, 255}, /* 33 */
-    {-6, 8, -1, 0, 128, 1568, -68, 84, 66, 255}, /* 34 */
-    {7, 8, -1, 0, 128, 1568, 69, 86, 63, 255}, /* 35 */
-    {8, -15, -2, 0, 128, 1568, 98, -25, 77, 255}, /* 36 */
+    {-11, -17, -12, 0, 1024, 768, -106, -27, -65, 255}, /* 4 */
+    {12, -17, -12, 0, 2048, 768, 105, -27, -66, 255}, /* 5 */
+    {6, -27, -12, 0, 1792, 1024, 54, -101, -55, 255}, /* 6 */
+    {-5, -27, -12, 0, 1312, 1024, -54, -101, -55, 255}, /* 7 */
+    {4, -22, -2, 0, 128, 1568, 47, -78, 89, 255}, /* 8 */
+    {1, -1, 5, 0, 128, 1568, 7, 9, 126, 255}, /* 9 */
+    {-4, -22, -2, 0, 128, 1568, -46, -77, 89, 255}, /* 10 */
+    {6, -27, -12, 0, -96, 2048, 54, -101, -55, 255}, /* 11 */
+    {4, -22, -2, 0, 0, 1088, 47, -78, 89, 255}, /* 12 */
+    {-4, -22, -2, 0, 96, 1088, -46, -77, 89, 255}, /* 13 */
+    {-5, -27, -12, 0, 256, 2048, -54, -101, -55, 255}, /* 14 */
+    {-9, 7, -12, 0, 512, 2048, -81, 73, -65, 255}, /* 15 */
+    {-6, 8, -1, 0, 384, 1088, -68, 84, 66, 255}, /* 16 */
+    {7, 8, -1, 0, 32, 1088, 69, 86, 63, 255}, /* 17 */
+    {10, 7, -12, 0, -96, 2048, 80, 73, -65, 255}, /* 18 */
+    {-5, -27, -12, 0, -32, 2048, -54, -101, -55, 255}, /* 19 */
+    {-4, -22, -2, 0, -96, 1088, -46, -77, 89, 255}, /* 20 */
+    {-8, -15, -2, 0, 224, 1088, -95, -24, 80, 255}, /* 21 */
+    {-11, -17, -12, 0, 192, 2048, -106, -27, -65, 255}, /* 22 */
+    {-11, -17, -12, 0, 224, 2048, -106, -27, -65, 255}, /* 23 */
+    {-8, -15, -2, 0, 256, 1088, -95, -24, 80, 255}, /* 24 */
+    {-6, 8, -1, 0, 896, 1088, -68, 84, 66, 255}, /* 25 */
+    {-9, 7, -12, 0, 928, 2048, -81, 73, -65, 255}, /* 26 */
+    {10, 7, -12, 0, 928, 2048, 80, 73, -65, 255}, /* 27 */
+    {7, 8, -1, 0, 896, 1088, 69, 86, 63, 255}, /* 28 */
+    {8, -15, -2, 0, 256, 1088, 98, -25, 77, 255}, /* 29 */
+    {12, -17, -12, 0, 224, 2048, 105, -27, -66, 255}, /* 30 */
+    {12, -17, -12, 0, 192, 2048, 105, -27, -66, 255}, /* 31 */
+    {8, -15, -2, 0, 224, 1088, 98, -25, 77, 255}, /* 32 */
+    {4, -22, -2, 0, -96, 1088, 47, -78, 89, 255}, /* 33 */
+    {6, -27, -12, 0, -32, 2048, 54, -101, -55, 255}, /* 34 */
+    {-8, -15, -2, 0, 128, 1568, -95, -24, 80, 255}, /* 35 */
+    {1, -1, 5, 0, 128, 1568, 7, 9, 126, 255}, /* 36 */
+    {-6, 8, -1, 0, 128, 1568, -68, 84, 66, 255}, /* 37 */
+    {7, 8, -1, 0, 128, 1568, 69, 86, 63, 255}, /* 38 */
+    {1, -1, 5, 0, 128, 1568, 7, 9, 126, 255}, /* 39 */
+    {8, -15, -2, 0, 128, 1568, 98, -25, 77, 255}, /* 40 */
+    {-4, -22, -2, 0, 128, 1568, -46, -77, 89, 255}, /* 41 */
+    {1, -1, 5, 0, 128, 1568, 7, 9, 126, 255}, /* 42 */
+    {-8, -15, -2, 0, 128, 1568, -95, -24, 80, 255}, /* 43 */
+    {-6, 8, -1, 0, 128, 1568, -68, 84, 66, 255}, /* 44 */
+    {1, -1, 5, 0, 128, 1568, 7, 9, 126, 255}, /* 45 */
+    {7, 8, -1, 0, 128, 1568, 69, 86, 63, 255}, /* 46 */
+    {8, -15, -2, 0, 128, 1568, 98, -25, 77, 255}, /* 47 */
+    {1, -1, 5, 0, 128, 1568, 7, 9, 126, 255}, /* 48 */
+    {4, -22, -2, 0, 128, 1568, 47, -78, 89, 255}, /* 49 */
 };
 
 static Gfx gfx_Catherine_RightFoot[] = {
-    gsSPVertex(vtx_Catherine_RightFoot+0, 6, 0),
-    gsDPLoadTextureBlock(tex_Boot, G_IM_FMT_RGBA, G_IM_SIZ_16b, 64, 32, 0, G_TX_MIRROR, G_TX_MIRROR, 6, 5, G_TX_NOLOD, G_TX_NOLOD),
+    gsDPLoadTextureBlock(BootTex, G_IM_FMT_RGBA, G_IM_SIZ_16b, 64, 32, 0, G_TX_MIRROR, G_TX_MIRROR, 6, 5, G_TX_NOLOD, G_TX_NOLOD),
     gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_RightFoot+0, 8, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
-    gsSP2Triangles(3, 2, 4, 0, 3, 4, 5, 0),
+    gsSP2Triangles(4, 5, 6, 0, 4, 6, 7, 0),
 
-    gsSPVertex(vtx_Catherine_RightFoot+6, 31, 0),
-    gsDPLoadTextureBlock(tex_Pants, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
+    gsDPLoadTextureBlock(PantsTex, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
     gsDPPipeSync(),
-    gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
-    gsSP2Triangles(4, 5, 6, 0, 4, 6, 7, 0),
-    gsSP2Triangles(8, 9, 10, 0, 8, 10, 11, 0),
-    gsSP2Triangles(12, 13, 14, 0, 12, 14, 15, 0),
-    gsSP2Triangles(16, 17, 18, 0, 16, 18, 19, 0),
-    gsSP2Triangles(20, 21, 22, 0, 20, 22, 23, 0),
-    gsSP2Triangles(24, 25, 26, 0, 27, 25, 28, 0),
-    gsSP2Triangles(29, 25, 30, 0, 26, 25, 27, 0),
-    gsSP2Triangles(28, 25, 29, 0, 30, 25, 24, 0),
+    gsSPVertex(vtx_Catherine_RightFoot+8, 30, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(3, 5, 6, 0, 7, 8, 9, 0),
+    gsSP2Triangles(7, 9, 10, 0, 11, 12, 13, 0),
+    gsSP2Triangles(11, 13, 14, 0, 15, 16, 17, 0),
+    gsSP2Triangles(15, 17, 18, 0, 19, 20, 21, 0),
+    gsSP2Triangles(19, 21, 22, 0, 23, 24, 25, 0),
+    gsSP2Triangles(23, 25, 26, 0, 27, 28, 29, 0),
+
+    gsSPVertex(vtx_Catherine_RightFoot+38, 12, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(6, 7, 8, 0, 9, 10, 11, 0),
     gsSPEndDisplayList(),
 };
 
@@ -708,10 +875,10 @@ static Vtx vtx_Catherine_LeftForearm[] = {
 };
 
 static Gfx gfx_Catherine_LeftForearm[] = {
-    gsSPVertex(vtx_Catherine_LeftForearm+0, 12, 0),
     gsDPSetCombineMode(G_CC_PRIMLITE, G_CC_PRIMLITE),
     gsDPSetPrimColor(0, 0, 250, 210, 184, 255),
     gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_LeftForearm+0, 12, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
     gsSP2Triangles(3, 4, 0, 0, 5, 4, 6, 0),
     gsSP2Triangles(0, 4, 7, 0, 6, 4, 3, 0),
@@ -829,8 +996,8 @@ static Vtx vtx_Catherine_LeftLeg[] = {
 };
 
 static Gfx gfx_Catherine_LeftLeg[] = {
-    gsSPVertex(vtx_Catherine_LeftLeg+0, 14, 0),
     gsDPSetPrimColor(0, 0, 66, 66, 66, 255),
+    gsSPVertex(vtx_Catherine_LeftLeg+0, 14, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
     gsSP2Triangles(4, 5, 6, 0, 7, 8, 6, 0),
     gsSP2Triangles(5, 1, 6, 0, 8, 4, 6, 0),
@@ -892,8 +1059,8 @@ static Vtx vtx_Catherine_Pad[] = {
 };
 
 static Gfx gfx_Catherine_Pad[] = {
-    gsSPVertex(vtx_Catherine_Pad+0, 8, 0),
     gsDPSetPrimColor(0, 0, 138, 138, 138, 255),
+    gsSPVertex(vtx_Catherine_Pad+0, 8, 0),
     gsSP2Triangles(0, 1, 2, 0, 3, 1, 4, 0),
     gsSP2Triangles(2, 1, 5, 0, 4, 1, 0, 0),
     gsSP2Triangles(5, 1, 3, 0, 2, 6, 0, 0),
@@ -903,78 +1070,6 @@ static Gfx gfx_Catherine_Pad[] = {
     gsSPEndDisplayList(),
 };
 
-static Vtx vtx_Catherine_Sword[] = {
-    {6, -1, -3, 0, 0, 0, 6, 127, 2, 255}, /* 0 */
-    {34, -2, -48, 0, 0, 0, 9, 127, 3, 255}, /* 1 */
-    {29, -1, -51, 0, 0, 0, 9, 127, 3, 255}, /* 2 */
-    {0, -1, -6, 0, 0, 0, 6, 127, 2, 255}, /* 3 */
-    {37, -2, -60, 0, 0, 0, 12, 126, 5, 255}, /* 4 */
-    {2, 1, 0, 0, 0, 0, 78, 89, 45, 255}, /* 5 */
-    {-1, 1, -1, 0, 0, 0, -74, 90, -50, 255}, /* 6 */
-    {-10, 1, 14, 0, 0, 0, -44, 83, -86, 255}, /* 7 */
-    {-8, 1, 16, 0, 0, 0, 97, 82, 2, 255}, /* 8 */
-    {2, -2, 0, 0, 0, 0, 74, -90, 50, 255}, /* 9 */
-    {-8, -1, 16, 0, 0, 0, 93, -86, 6, 255}, /* 10 */
-    {-1, -2, -1, 0, 0, 0, -78, -89, -45, 255}, /* 11 */
-    {-10, -1, 14, 0, 0, 0, -47, -85, -82, 255}, /* 12 */
-    {6, -3, -3, 0, 0, 0, 92, -79, -36, 255}, /* 13 */
-    {0, -3, -7, 0, 0, 0, -10, -77, -100, 255}, /* 14 */
-    {0, 1, -7, 0, 0, 0, -5, 74, -103, 255}, /* 15 */
-    {6, 1, -3, 0, 0, 0, 97, 72, -40, 255}, /* 16 */
-    {5, -3, 3, 0, 0, 0, 36, -71, 99, 255}, /* 17 */
-    {5, 2, 3, 0, 0, 0, 42, 72, 96, 255}, /* 18 */
-    {-4, 2, -3, 0, 0, 0, -102, 75, 7, 255}, /* 19 */
-    {-4, -3, -3, 0, 0, 0, -107, -68, 8, 255}, /* 20 */
-    {-8, -1, 16, 0, 0, 0, 93, -86, 6, 255}, /* 21 */
-    {-8, 1, 16, 0, 0, 0, 97, 82, 2, 255}, /* 22 */
-    {-8, 2, 18, 0, 0, 0, 81, 88, 41, 255}, /* 23 */
-    {-8, -2, 18, 0, 0, 0, 77, -90, 46, 255}, /* 24 */
-    {-12, -2, 15, 0, 0, 0, -76, -89, -50, 255}, /* 25 */
-    {-11, -1, 20, 0, 0, 0, -6, -55, 115, 255}, /* 26 */
-    {-13, -1, 18, 0, 0, 0, -101, -54, 55, 255}, /* 27 */
-    {-10, 1, 14, 0, 0, 0, -44, 83, -86, 255}, /* 28 */
-    {-10, -1, 14, 0, 0, 0, -47, -85, -82, 255}, /* 29 */
-    {-12, 2, 15, 0, 0, 0, -72, 89, -55, 255}, /* 30 */
-    {-11, 1, 20, 0, 0, 0, -3, 60, 112, 255}, /* 31 */
-    {-13, 1, 18, 0, 0, 0, -98, 61, 52, 255}, /* 32 */
-    {-13, 1, 18, 0, 0, 0, -98, 61, 52, 255}, /* 33 */
-    {-11, 1, 20, 0, 0, 0, -3, 60, 112, 255}, /* 34 */
-};
-
-static Gfx gfx_Catherine_Sword[] = {
-    gsSPVertex(vtx_Catherine_Sword+0, 13, 0),
-    gsSPClearGeometryMode(0xFFFFFFFF),
-    gsSPSetGeometryMode(G_SHADE | G_ZBUFFER | G_SHADING_SMOOTH | G_LIGHTING),
-    gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
-    gsSP1Triangle(1, 4, 2, 0),
-    gsSPClearGeometryMode(0xFFFFFFFF),
-    gsSPSetGeometryMode(G_SHADE | G_ZBUFFER | G_CULL_BACK | G_SHADING_SMOOTH | G_LIGHTING),
-    gsDPSetPrimColor(0, 0, 82, 70, 39, 255),
-    gsSP2Triangles(5, 6, 7, 0, 5, 7, 8, 0),
-    gsSP2Triangles(9, 5, 8, 0, 9, 8, 10, 0),
-    gsSP2Triangles(6, 11, 12, 0, 6, 12, 7, 0),
-    gsSP2Triangles(11, 9, 10, 0, 11, 10, 12, 0),
-
-    gsSPVertex(vtx_Catherine_Sword+13, 22, 0),
-    gsDPSetPrimColor(0, 0, 231, 201, 85, 255),
-    gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
-    gsSP2Triangles(4, 5, 6, 0, 4, 6, 7, 0),
-    gsSP2Triangles(3, 2, 6, 0, 3, 6, 5, 0),
-    gsSP2Triangles(0, 3, 5, 0, 0, 5, 4, 0),
-    gsSP2Triangles(2, 1, 7, 0, 2, 7, 6, 0),
-    gsSP2Triangles(1, 0, 4, 0, 1, 4, 7, 0),
-    gsSP2Triangles(8, 9, 10, 0, 8, 10, 11, 0),
-    gsSP2Triangles(12, 11, 13, 0, 12, 13, 14, 0),
-    gsSP2Triangles(15, 16, 12, 0, 15, 12, 17, 0),
-    gsSP2Triangles(16, 8, 11, 0, 16, 11, 12, 0),
-    gsSP2Triangles(9, 15, 17, 0, 9, 17, 10, 0),
-    gsSP2Triangles(13, 18, 19, 0, 13, 19, 14, 0),
-    gsSP2Triangles(10, 17, 20, 0, 10, 20, 21, 0),
-    gsSP2Triangles(11, 10, 21, 0, 11, 21, 13, 0),
-    gsSP2Triangles(17, 12, 14, 0, 17, 14, 20, 0),
-    gsSPEndDisplayList(),
-};
-
 static Vtx vtx_Catherine_Pelvis[] = {
     {20, -5, 8, 0, -768, 2048, 127, 0, 2, 255}, /* 0 */
     {20, 9, 8, 0, 256, 2048, 127, 0, 2, 255}, /* 1 */
@@ -990,62 +1085,192 @@ static Vtx vtx_Catherine_Pelvis[] = {
     {19, -10, 0, 0, 64, 864, 79, -74, -66, 255}, /* 11 */
     {0, -12, 0, 0, 64, 864, 0, -92, -88, 255}, /* 12 */
     {0, 14, -3, 0, 64, 864, 0, 66, -108, 255}, /* 13 */
-    {0, 14, -3, 0, 1024, 960, 0, 66, -108, 255}, /* 14 */
-    {20, 8, 1, 0, 64, 864, 101, 37, -68, 255}, /* 15 */
-    {20, 8, 1, 0, 672, 896, 101, 37, -68, 255}, /* 16 */
-    {19, 2, 22, 0, 224, 256, 103, 10, 73, 255}, /* 17 */
-    {13, 16, 22, 0, 224, 256, 61, 86, 71, 255}, /* 18 */
-    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 19 */
-    {19, 2, 22, 0, 480, 0, 103, 10, 73, 255}, /* 20 */
-    {14, -8, 22, 0, 288, 0, 76, -68, 76, 255}, /* 21 */
-    {0, -14, 22, 0, 224, 256, 0, -109, 64, 255}, /* 22 */
-    {14, -8, 22, 0, 224, 256, 76, -68, 76, 255}, /* 23 */
-    {0, 17, 22, 0, 224, 256, 0, 103, 75, 255}, /* 24 */
-    {-19, -10, 0, 0, 352, 1024, -79, -74, -66, 255}, /* 25 */
-    {-11, 17, 8, 0, 832, 640, -58, 111, -21, 255}, /* 26 */
-    {-13, 16, 22, 0, 768, 0, -61, 86, 71, 255}, /* 27 */
-    {-19, -10, 0, 0, 64, 864, -79, -74, -66, 255}, /* 28 */
-    {-20, 8, 1, 0, 64, 864, -101, 37, -68, 255}, /* 29 */
-    {-20, 8, 1, 0, 672, 896, -101, 37, -68, 255}, /* 30 */
-    {-19, 2, 22, 0, 224, 256, -103, 10, 73, 255}, /* 31 */
-    {-13, 16, 22, 0, 224, 256, -61, 86, 71, 255}, /* 32 */
-    {-14, -8, 22, 0, 288, 0, -76, -68, 76, 255}, /* 33 */
-    {-19, 2, 22, 0, 480, 0, -103, 10, 73, 255}, /* 34 */
-    {-14, -8, 22, 0, 224, 256, -76, -68, 76, 255}, /* 35 */
+    {0, 19, 9, 0, 1024, 608, 0, 126, -15, 255}, /* 14 */
+    {11, 17, 8, 0, 832, 640, 58, 111, -21, 255}, /* 15 */
+    {0, 14, -3, 0, 1024, 960, 0, 66, -108, 255}, /* 16 */
+    {20, 8, 1, 0, 64, 864, 101, 37, -68, 255}, /* 17 */
+    {19, -10, 0, 0, 64, 864, 79, -74, -66, 255}, /* 18 */
+    {0, 14, -3, 0, 64, 864, 0, 66, -108, 255}, /* 19 */
+    {11, 17, 8, 0, 832, 640, 58, 111, -21, 255}, /* 20 */
+    {20, 8, 1, 0, 672, 896, 101, 37, -68, 255}, /* 21 */
+    {0, 14, -3, 0, 1024, 960, 0, 66, -108, 255}, /* 22 */
+    {19, 2, 22, 0, 224, 256, 103, 10, 73, 255}, /* 23 */
+    {13, 16, 22, 0, 224, 256, 61, 86, 71, 255}, /* 24 */
+    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 25 */
+    {19, -10, 0, 0, 352, 1024, 79, -74, -66, 255}, /* 26 */
+    {20, 8, 1, 0, 672, 896, 101, 37, -68, 255}, /* 27 */
+    {19, 2, 22, 0, 480, 0, 103, 10, 73, 255}, /* 28 */
+    {14, -8, 22, 0, 288, 0, 76, -68, 76, 255}, /* 29 */
+    {20, 8, 1, 0, 672, 896, 101, 37, -68, 255}, /* 30 */
+    {11, 17, 8, 0, 832, 640, 58, 111, -21, 255}, /* 31 */
+    {13, 16, 22, 0, 768, 0, 61, 86, 71, 255}, /* 32 */
+    {19, 2, 22, 0, 480, 0, 103, 10, 73, 255}, /* 33 */
+    {0, -14, 22, 0, 224, 256, 0, -109, 64, 255}, /* 34 */
+    {14, -8, 22, 0, 224, 256, 76, -68, 76, 255}, /* 35 */
+    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 36 */
+    {14, -8, 22, 0, 224, 256, 76, -68, 76, 255}, /* 37 */
+    {19, 2, 22, 0, 224, 256, 103, 10, 73, 255}, /* 38 */
+    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 39 */
+    {13, 16, 22, 0, 224, 256, 61, 86, 71, 255}, /* 40 */
+    {0, 17, 22, 0, 224, 256, 0, 103, 75, 255}, /* 41 */
+    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 42 */
+    {0, -14, 22, 0, 0, 0, 0, -109, 64, 255}, /* 43 */
+    {19, -10, 0, 0, 352, 1024, 79, -74, -66, 255}, /* 44 */
+    {14, -8, 22, 0, 288, 0, 76, -68, 76, 255}, /* 45 */
+    {0, -12, 0, 0, 0, 1024, 0, -92, -88, 255}, /* 46 */
+    {0, -14, 22, 0, 0, 0, 0, -109, 64, 255}, /* 47 */
+    {-19, -10, 0, 0, 352, 1024, -79, -74, -66, 255}, /* 48 */
+    {-11, 17, 8, 0, 832, 640, -58, 111, -21, 255}, /* 49 */
+    {-13, 16, 22, 0, 768, 0, -61, 86, 71, 255}, /* 50 */
+    {0, 17, 22, 0, 1024, 0, 0, 103, 75, 255}, /* 51 */
+    {0, 19, 9, 0, 1024, 608, 0, 126, -15, 255}, /* 52 */
+    {-19, -10, 0, 0, 64, 864, -79, -74, -66, 255}, /* 53 */
+    {0, 14, -3, 0, 64, 864, 0, 66, -108, 255}, /* 54 */
+    {0, -12, 0, 0, 64, 864, 0, -92, -88, 255}, /* 55 */
+    {0, 19, 9, 0, 1024, 608, 0, 126, -15, 255}, /* 56 */
+    {0, 14, -3, 0, 1024, 960, 0, 66, -108, 255}, /* 57 */
+    {-11, 17, 8, 0, 832, 640, -58, 111, -21, 255}, /* 58 */
+    {-20, 8, 1, 0, 64, 864, -101, 37, -68, 255}, /* 59 */
+    {0, 14, -3, 0, 64, 864, 0, 66, -108, 255}, /* 60 */
+    {-19, -10, 0, 0, 64, 864, -79, -74, -66, 255}, /* 61 */
+    {-11, 17, 8, 0, 832, 640, -58, 111, -21, 255}, /* 62 */
+    {0, 14, -3, 0, 1024, 960, 0, 66, -108, 255}, /* 63 */
+    {-20, 8, 1, 0, 672, 896, -101, 37, -68, 255}, /* 64 */
+    {-19, 2, 22, 0, 224, 256, -103, 10, 73, 255}, /* 65 */
+    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 66 */
+    {-13, 16, 22, 0, 224, 256, -61, 86, 71, 255}, /* 67 */
+    {-19, -10, 0, 0, 352, 1024, -79, -74, -66, 255}, /* 68 */
+    {-14, -8, 22, 0, 288, 0, -76, -68, 76, 255}, /* 69 */
+    {-19, 2, 22, 0, 480, 0, -103, 10, 73, 255}, /* 70 */
+    {-20, 8, 1, 0, 672, 896, -101, 37, -68, 255}, /* 71 */
+    {-20, 8, 1, 0, 672, 896, -101, 37, -68, 255}, /* 72 */
+    {-19, 2, 22, 0, 480, 0, -103, 10, 73, 255}, /* 73 */
+    {-13, 16, 22, 0, 768, 0, -61, 86, 71, 255}, /* 74 */
+    {-11, 17, 8, 0, 832, 640, -58, 111, -21, 255}, /* 75 */
+    {0, -14, 22, 0, 224, 256, 0, -109, 64, 255}, /* 76 */
+    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 77 */
+    {-14, -8, 22, 0, 224, 256, -76, -68, 76, 255}, /* 78 */
+    {-14, -8, 22, 0, 224, 256, -76, -68, 76, 255}, /* 79 */
+    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 80 */
+    {-19, 2, 22, 0, 224, 256, -103, 10, 73, 255}, /* 81 */
+    {-13, 16, 22, 0, 224, 256, -61, 86, 71, 255}, /* 82 */
+    {0, 2, 28, 0, 224, 256, 0, -2, 127, 255}, /* 83 */
+    {0, 17, 22, 0, 224, 256, 0, 103, 75, 255}, /* 84 */
+    {0, -14, 22, 0, 0, 0, 0, -109, 64, 255}, /* 85 */
+    {-14, -8, 22, 0, 288, 0, -76, -68, 76, 255}, /* 86 */
+    {-19, -10, 0, 0, 352, 1024, -79, -74, -66, 255}, /* 87 */
 };
 
 static Gfx gfx_Catherine_Pelvis[] = {
-    gsSPVertex(vtx_Catherine_Pelvis+0, 4, 0),
     gsDPSetRenderMode(G_RM_AA_ZB_TEX_EDGE, G_RM_AA_ZB_TEX_EDGE2),
     gsDPSetCombineMode(G_CC_MODULATEIDECALA, G_CC_MODULATEIDECALA),
     gsSPClearGeometryMode(0xFFFFFFFF),
     gsSPSetGeometryMode(G_SHADE | G_ZBUFFER | G_SHADING_SMOOTH | G_LIGHTING),
-    gsDPLoadTextureBlock(tex_KnifeSheathe, G_IM_FMT_RGBA, G_IM_SIZ_16b, 8, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 3, 6, G_TX_NOLOD, G_TX_NOLOD),
+    gsDPLoadTextureBlock(KnifeSheatheTex, G_IM_FMT_RGBA, G_IM_SIZ_16b, 8, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 3, 6, G_TX_NOLOD, G_TX_NOLOD),
     gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_Pelvis+0, 4, 0),
     gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
 
-    gsSPVertex(vtx_Catherine_Pelvis+4, 32, 0),
     gsDPSetRenderMode(G_RM_AA_ZB_OPA_SURF, G_RM_AA_ZB_OPA_SURF2),
     gsSPClearGeometryMode(0xFFFFFFFF),
     gsSPSetGeometryMode(G_SHADE | G_ZBUFFER | G_CULL_BACK | G_SHADING_SMOOTH | G_LIGHTING),
-    gsDPLoadTextureBlock(tex_Pants, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
+    gsDPLoadTextureBlock(PantsTex, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 64, 0, G_TX_MIRROR, G_TX_MIRROR, 5, 6, G_TX_NOLOD, G_TX_NOLOD),
     gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_Pelvis+4, 30, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(3, 5, 6, 0, 7, 8, 9, 0),
+    gsSP2Triangles(10, 11, 12, 0, 13, 14, 15, 0),
+    gsSP2Triangles(16, 17, 18, 0, 19, 20, 21, 0),
+    gsSP2Triangles(22, 23, 24, 0, 22, 24, 25, 0),
+    gsSP2Triangles(26, 27, 28, 0, 26, 28, 29, 0),
+
+    gsSPVertex(vtx_Catherine_Pelvis+34, 31, 0),
+    gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
+    gsSP2Triangles(6, 7, 8, 0, 9, 10, 11, 0),
+    gsSP2Triangles(12, 13, 14, 0, 15, 16, 17, 0),
+    gsSP2Triangles(15, 17, 18, 0, 19, 20, 21, 0),
+    gsSP2Triangles(22, 23, 24, 0, 25, 26, 27, 0),
+    gsSP1Triangle(28, 29, 30, 0),
+
+    gsSPVertex(vtx_Catherine_Pelvis+65, 23, 0),
     gsSP2Triangles(0, 1, 2, 0, 3, 4, 5, 0),
     gsSP2Triangles(3, 5, 6, 0, 7, 8, 9, 0),
-    gsSP2Triangles(4, 3, 10, 0, 11, 7, 9, 0),
-    gsSP2Triangles(3, 12, 10, 0, 13, 14, 15, 0),
-    gsSP2Triangles(1, 12, 16, 0, 1, 16, 17, 0),
-    gsSP2Triangles(12, 3, 6, 0, 12, 6, 16, 0),
-    gsSP2Triangles(18, 19, 15, 0, 19, 13, 15, 0),
-    gsSP2Triangles(14, 20, 15, 0, 2, 1, 17, 0),
-    gsSP2Triangles(0, 2, 21, 0, 22, 23, 5, 0),
-    gsSP2Triangles(22, 5, 4, 0, 24, 9, 8, 0),
-    gsSP2Triangles(4, 10, 22, 0, 25, 9, 24, 0),
-    gsSP2Triangles(22, 10, 26, 0, 27, 15, 28, 0),
-    gsSP2Triangles(21, 29, 30, 0, 21, 30, 26, 0),
-    gsSP2Triangles(26, 30, 23, 0, 26, 23, 22, 0),
-    gsSP2Triangles(18, 15, 31, 0, 31, 15, 27, 0),
-    gsSP2Triangles(28, 15, 20, 0, 2, 29, 21, 0),
+    gsSP2Triangles(7, 9, 10, 0, 11, 12, 13, 0),
+    gsSP2Triangles(14, 15, 16, 0, 17, 18, 19, 0),
+    gsSP1Triangle(20, 21, 22, 0),
+    gsSPEndDisplayList(),
+};
+
+static Vtx vtx_Catherine_Sword[] = {
+    {2, 1, 0, 0, 0, 0, 78, 89, 45, 255}, /* 0 */
+    {-1, 1, -1, 0, 0, 0, -74, 90, -50, 255}, /* 1 */
+    {-10, 1, 14, 0, 0, 0, -44, 83, -86, 255}, /* 2 */
+    {-8, 1, 16, 0, 0, 0, 97, 82, 2, 255}, /* 3 */
+    {2, -2, 0, 0, 0, 0, 74, -90, 50, 255}, /* 4 */
+    {-8, -1, 16, 0, 0, 0, 93, -86, 6, 255}, /* 5 */
+    {-1, -2, -1, 0, 0, 0, -78, -89, -45, 255}, /* 6 */
+    {-10, -1, 14, 0, 0, 0, -47, -85, -82, 255}, /* 7 */
+    {6, -3, -3, 0, 0, 0, 92, -79, -36, 255}, /* 8 */
+    {0, -3, -7, 0, 0, 0, -10, -77, -100, 255}, /* 9 */
+    {0, 1, -7, 0, 0, 0, -5, 74, -103, 255}, /* 10 */
+    {6, 1, -3, 0, 0, 0, 97, 72, -40, 255}, /* 11 */
+    {5, -3, 3, 0, 0, 0, 36, -71, 99, 255}, /* 12 */
+    {5, 2, 3, 0, 0, 0, 42, 72, 96, 255}, /* 13 */
+    {-4, 2, -3, 0, 0, 0, -102, 75, 7, 255}, /* 14 */
+    {-4, -3, -3, 0, 0, 0, -107, -68, 8, 255}, /* 15 */
+    {-8, -1, 16, 0, 0, 0, 93, -86, 6, 255}, /* 16 */
+    {-8, 1, 16, 0, 0, 0, 97, 82, 2, 255}, /* 17 */
+    {-8, 2, 18, 0, 0, 0, 81, 88, 41, 255}, /* 18 */
+    {-8, -2, 18, 0, 0, 0, 77, -90, 46, 255}, /* 19 */
+    {-12, -2, 15, 0, 0, 0, -76, -89, -50, 255}, /* 20 */
+    {-11, -1, 20, 0, 0, 0, -6, -55, 115, 255}, /* 21 */
+    {-13, -1, 18, 0, 0, 0, -101, -54, 55, 255}, /* 22 */
+    {-10, 1, 14, 0, 0, 0, -44, 83, -86, 255}, /* 23 */
+    {-10, -1, 14, 0, 0, 0, -47, -85, -82, 255}, /* 24 */
+    {-12, 2, 15, 0, 0, 0, -72, 89, -55, 255}, /* 25 */
+    {-11, 1, 20, 0, 0, 0, -3, 60, 112, 255}, /* 26 */
+    {-13, 1, 18, 0, 0, 0, -98, 61, 52, 255}, /* 27 */
+    {-13, 1, 18, 0, 0, 0, -98, 61, 52, 255}, /* 28 */
+    {-11, 1, 20, 0, 0, 0, -3, 60, 112, 255}, /* 29 */
+    {6, -1, -3, 0, 0, 0, 6, 127, 2, 255}, /* 30 */
+    {34, -2, -48, 0, 0, 0, 9, 127, 3, 255}, /* 31 */
+    {29, -1, -51, 0, 0, 0, 9, 127, 3, 255}, /* 32 */
+    {0, -1, -6, 0, 0, 0, 6, 127, 2, 255}, /* 33 */
+    {37, -2, -60, 0, 0, 0, 12, 126, 5, 255}, /* 34 */
+};
+
+static Gfx gfx_Catherine_Sword[] = {
+    gsDPSetCombineMode(G_CC_PRIMLITE, G_CC_PRIMLITE),
+    gsDPSetPrimColor(0, 0, 82, 70, 39, 255),
+    gsDPPipeSync(),
+    gsSPVertex(vtx_Catherine_Sword+0, 30, 0),
+    gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
+    gsSP2Triangles(4, 0, 3, 0, 4, 3, 5, 0),
+    gsSP2Triangles(1, 6, 7, 0, 1, 7, 2, 0),
+    gsSP2Triangles(6, 4, 5, 0, 6, 5, 7, 0),
+    gsDPSetPrimColor(0, 0, 231, 201, 85, 255),
+    gsSP2Triangles(8, 9, 10, 0, 8, 10, 11, 0),
+    gsSP2Triangles(12, 13, 14, 0, 12, 14, 15, 0),
+    gsSP2Triangles(11, 10, 14, 0, 11, 14, 13, 0),
+    gsSP2Triangles(8, 11, 13, 0, 8, 13, 12, 0),
+    gsSP2Triangles(10, 9, 15, 0, 10, 15, 14, 0),
+    gsSP2Triangles(9, 8, 12, 0, 9, 12, 15, 0),
+    gsSP2Triangles(16, 17, 18, 0, 16, 18, 19, 0),
+    gsSP2Triangles(20, 19, 21, 0, 20, 21, 22, 0),
+    gsSP2Triangles(23, 24, 20, 0, 23, 20, 25, 0),
+    gsSP2Triangles(24, 16, 19, 0, 24, 19, 20, 0),
+    gsSP2Triangles(17, 23, 25, 0, 17, 25, 18, 0),
+    gsSP2Triangles(21, 26, 27, 0, 21, 27, 22, 0),
+    gsSP2Triangles(18, 25, 28, 0, 18, 28, 29, 0),
+    gsSP2Triangles(19, 18, 29, 0, 19, 29, 21, 0),
+    gsSP2Triangles(25, 20, 22, 0, 25, 22, 28, 0),
+
+    gsSPClearGeometryMode(0xFFFFFFFF),
+    gsSPSetGeometryMode(G_SHADE | G_ZBUFFER | G_SHADING_SMOOTH | G_LIGHTING),
+    gsDPSetPrimColor(0, 0, 138, 138, 138, 255),
+    gsSPVertex(vtx_Catherine_Sword+30, 5, 0),
+    gsSP2Triangles(0, 1, 2, 0, 0, 2, 3, 0),
+    gsSP1Triangle(1, 4, 2, 0),
     gsSPEndDisplayList(),
 };
 
@@ -1055,172 +1280,172 @@ static Gfx gfx_Catherine_Pelvis[] = {
 *********************************/
 
 static s64Transform anim_Catherine_Attack1_framedata0[] = {
-    {9.7273, -42.8110, 176.8345, 0.9946, -0.0454, 0.0031, 0.0933, 1.0000, 1.0000, 1.0000},
-    {-2.3373, -9.6257, 171.8021, 0.9889, 0.1160, -0.0120, 0.0925, 1.0000, 1.0000, 1.0000},
-    {0.3454, -21.6322, 141.6292, 0.9953, 0.0259, -0.0036, 0.0932, 1.0000, 1.0000, 1.0000},
-    {0.4607, -18.9983, 91.2880, 0.9953, 0.0259, -0.0036, 0.0932, 1.0000, 1.0000, 1.0000},
-    {24.0211, -14.6705, 132.7400, 0.7561, 0.2262, 0.3738, -0.4873, 1.0000, 1.0000, 1.0000},
-    {-23.8910, -23.7113, 132.1573, 0.8515, -0.3391, 0.2894, -0.2762, 1.0000, 1.0000, 1.0000},
-    {15.5137, -17.7455, 34.1208, 0.9337, 0.3577, 0.0141, -0.0080, 1.0000, 1.0000, 1.0000},
-    {-10.8176, -47.2190, 73.3006, 0.9897, 0.1222, 0.0745, -0.0095, 1.0000, 1.0000, 1.0000},
-    {15.3569, 3.5794, 13.1855, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-15.4399, -38.1123, 45.2165, 0.9728, -0.2277, 0.0269, 0.0317, 1.0000, 1.0000, 1.0000},
-    {29.3976, -24.7209, 114.8628, 0.6552, 0.2773, 0.4714, -0.5212, 1.0000, 1.0000, 1.0000},
-    {28.9417, -35.6967, 94.2193, 0.6523, 0.2103, 0.3955, -0.6114, 1.0000, 1.0000, 1.0000},
-    {-38.8123, -8.9989, 135.8659, 0.7394, -0.0501, 0.6560, 0.1431, 1.0000, 1.0000, 1.0000},
-    {-39.8729, -14.4844, 158.6409, 0.2309, -0.2178, 0.8903, 0.3266, 1.0000, 1.0000, 1.0000},
-    {12.8748, -13.6801, 64.2244, 0.9990, -0.0343, -0.0164, -0.0244, 1.0000, 1.0000, 1.0000},
-    {-12.0555, -18.1367, 64.2244, 0.6143, -0.7813, 0.0542, 0.0960, 1.0000, 1.0000, 1.0000},
-    {-10.6317, -23.7264, 141.9377, 0.9692, 0.1132, 0.2155, 0.0382, 1.0000, 1.0000, 1.0000},
-    {-28.9311, -7.4972, 157.4605, 0.9941, 0.0487, -0.0718, 0.0650, 1.0000, 1.0000, 1.0000},
-    {0.0000, -16.4212, 68.0632, 0.9945, 0.0559, 0.0050, 0.0882, 1.0000, 1.0000, 1.0000},
+    {{9.7273f, -42.8110f, 176.8345f}, {0.9946f, -0.0454f, 0.0031f, 0.0933f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-2.3373f, -9.6257f, 171.8021f}, {0.9889f, 0.1160f, -0.0120f, 0.0925f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.3454f, -21.6322f, 141.6292f}, {0.9953f, 0.0259f, -0.0036f, 0.0932f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.4607f, -18.9983f, 91.2880f}, {0.9953f, 0.0259f, -0.0036f, 0.0932f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.0211f, -14.6705f, 132.7400f}, {0.7561f, 0.2262f, 0.3738f, -0.4873f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-23.8910f, -23.7113f, 132.1573f}, {0.8515f, -0.3391f, 0.2894f, -0.2762f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.5137f, -17.7456f, 34.1208f}, {0.9337f, 0.3577f, 0.0141f, -0.0080f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.8162f, -47.2192f, 73.3008f}, {0.9897f, 0.1222f, 0.0745f, -0.0095f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3569f, 3.5791f, 13.1854f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-15.4391f, -38.1120f, 45.2164f}, {0.9728f, -0.2277f, 0.0269f, 0.0317f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.3976f, -24.7209f, 114.8628f}, {0.6552f, 0.2773f, 0.4714f, -0.5212f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.9417f, -35.6967f, 94.2193f}, {0.6523f, 0.2103f, 0.3955f, -0.6114f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-38.8123f, -8.9989f, 135.8659f}, {0.7394f, -0.0501f, 0.6560f, 0.1431f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-39.8729f, -14.4843f, 158.6410f}, {0.2309f, -0.2178f, 0.8903f, 0.3266f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8748f, -13.6801f, 64.2244f}, {0.9990f, -0.0343f, -0.0164f, -0.0244f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.0555f, -18.1367f, 64.2244f}, {0.6143f, -0.7813f, 0.0542f, 0.0959f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.6317f, -23.7264f, 141.9377f}, {0.9692f, 0.1132f, 0.2155f, 0.0382f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, -16.4212f, 68.0632f}, {0.9945f, 0.0559f, 0.0050f, 0.0882f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-28.9311f, -7.4972f, 157.4605f}, {0.9941f, 0.0487f, -0.0718f, 0.0650f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Attack1_framedata2[] = {
-    {10.7270, -53.3122, 172.7934, 0.9965, 0.0094, 0.0027, 0.0836, 1.0000, 1.0000, 1.0000},
-    {-0.7267, -19.6640, 169.8344, 0.9961, 0.0048, -0.0052, 0.0875, 1.0000, 1.0000, 1.0000},
-    {1.5619, -29.8887, 138.9804, 0.9949, 0.0560, -0.0036, 0.0836, 1.0000, 1.0000, 1.0000},
-    {0.8068, -24.2845, 88.8884, 0.9770, 0.0560, -0.0041, 0.2056, 1.0000, 1.0000, 1.0000},
-    {23.0068, -17.2449, 130.7178, 0.6656, -0.1914, 0.5565, -0.4590, 1.0000, 1.0000, 1.0000},
-    {-21.6308, -36.8110, 129.2016, 0.8891, -0.2888, 0.3501, -0.0594, 1.0000, 1.0000, 1.0000},
-    {13.8253, -19.8019, 31.7330, 0.9134, 0.4066, -0.0132, -0.0152, 1.0000, 1.0000, 1.0000},
-    {-11.9000, -44.0125, 41.1660, 0.9757, -0.2014, 0.0442, 0.0737, 1.0000, 1.0000, 1.0000},
-    {15.3569, 3.5797, 13.1852, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2612, -54.2402, 13.1866, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {20.6328, -33.5569, 117.3838, 0.2639, -0.2747, 0.5679, -0.7296, 1.0000, 1.0000, 1.0000},
-    {4.6414, -50.2271, 121.0183, 0.2944, -0.2194, 0.0737, -0.9272, 1.0000, 1.0000, 1.0000},
-    {-38.7792, -29.2900, 139.3121, 0.7744, -0.1443, 0.5826, 0.2000, 1.0000, 1.0000, 1.0000},
-    {-42.7665, -34.3809, 161.8532, 0.3379, -0.6200, 0.2533, 0.6613, 1.0000, 1.0000, 1.0000},
-    {13.0994, -17.4093, 62.1217, 0.9996, -0.0076, 0.0160, -0.0211, 1.0000, 1.0000, 1.0000},
-    {-11.8516, -21.7464, 61.9967, 0.9226, -0.3623, 0.0308, 0.1291, 1.0000, 1.0000, 1.0000},
-    {-8.6574, -34.4203, 139.0728, 0.9274, 0.1423, 0.3288, 0.1075, 1.0000, 1.0000, 1.0000},
-    {-45.8151, -28.0201, 172.3194, 0.5783, 0.4749, -0.3467, 0.5655, 1.0000, 1.0000, 1.0000},
-    {0.2327, -20.3180, 65.8626, 0.9926, 0.0859, 0.0049, 0.0858, 1.0000, 1.0000, 1.0000},
+    {{10.7270f, -53.3122f, 172.7934f}, {0.9965f, 0.0094f, 0.0027f, 0.0836f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.7267f, -19.6640f, 169.8344f}, {0.9961f, 0.0048f, -0.0052f, 0.0875f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.5619f, -29.8887f, 138.9804f}, {0.9949f, 0.0560f, -0.0036f, 0.0836f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.8068f, -24.2845f, 88.8884f}, {0.9770f, 0.0560f, -0.0041f, 0.2056f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.0068f, -17.2449f, 130.7178f}, {0.6656f, -0.1914f, 0.5565f, -0.4590f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-21.6308f, -36.8110f, 129.2016f}, {0.8891f, -0.2888f, 0.3501f, -0.0594f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.8253f, -19.8020f, 31.7330f}, {0.9134f, 0.4066f, -0.0132f, -0.0152f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.8990f, -44.0123f, 41.1660f}, {0.9757f, -0.2014f, 0.0442f, 0.0736f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3569f, 3.5795f, 13.1851f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2597f, -54.2399f, 13.1864f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{20.6327f, -33.5569f, 117.3838f}, {0.2639f, -0.2748f, 0.5679f, -0.7296f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{4.6414f, -50.2271f, 121.0182f}, {0.2944f, -0.2194f, 0.0737f, -0.9272f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-38.7792f, -29.2900f, 139.3121f}, {0.7744f, -0.1443f, 0.5826f, 0.2000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-42.7665f, -34.3809f, 161.8532f}, {0.3379f, -0.6200f, 0.2533f, 0.6613f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.0994f, -17.4094f, 62.1217f}, {0.9996f, -0.0076f, 0.0160f, -0.0211f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.8516f, -21.7464f, 61.9967f}, {0.9226f, -0.3623f, 0.0308f, 0.1291f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-8.6574f, -34.4203f, 139.0728f}, {0.9274f, 0.1423f, 0.3288f, 0.1075f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.2327f, -20.3180f, 65.8626f}, {0.9926f, 0.0859f, 0.0049f, 0.0858f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-45.8151f, -28.0201f, 172.3194f}, {0.5783f, 0.4749f, -0.3467f, 0.5655f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Attack1_framedata5[] = {
-    {18.1371, -89.0818, 154.7091, 0.9809, 0.1920, 0.0190, 0.0254, 1.0000, 1.0000, 1.0000},
-    {10.2540, -54.6530, 159.6752, 0.9845, -0.1622, 0.0415, 0.0513, 1.0000, 1.0000, 1.0000},
-    {9.9977, -58.1413, 127.2789, 0.9858, 0.1646, 0.0132, 0.0300, 1.0000, 1.0000, 1.0000},
-    {1.4523, -34.5368, 83.5641, 0.8986, 0.2576, -0.0075, 0.3552, 1.0000, 1.0000, 1.0000},
-    {25.4277, -37.0604, 124.9272, 0.6915, -0.1203, 0.6011, -0.3822, 1.0000, 1.0000, 1.0000},
-    {-11.0259, -67.9964, 115.3487, 0.5205, 0.1429, -0.4472, 0.7132, 1.0000, 1.0000, 1.0000},
-    {13.9063, -22.7640, 27.2182, 0.8728, 0.4877, -0.0080, -0.0197, 1.0000, 1.0000, 1.0000},
-    {-11.9295, -55.6718, 42.9426, 0.9994, -0.0076, 0.0324, 0.0091, 1.0000, 1.0000, 1.0000},
-    {15.3570, 3.5805, 13.1849, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2613, -54.2410, 13.1843, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {23.5689, -49.9383, 108.1875, 0.6672, -0.0473, 0.6417, -0.3753, 1.0000, 1.0000, 1.0000},
-    {21.4575, -64.2279, 89.7978, 0.3173, 0.4120, 0.3251, -0.7898, 1.0000, 1.0000, 1.0000},
-    {-3.7304, -79.6982, 99.1407, 0.5429, 0.1837, -0.4520, 0.6835, 1.0000, 1.0000, 1.0000},
-    {6.2612, -93.6266, 83.1379, 0.5515, 0.1849, -0.7037, 0.4079, 1.0000, 1.0000, 1.0000},
-    {13.5419, -24.6908, 57.6464, 0.9975, 0.0632, 0.0234, -0.0220, 1.0000, 1.0000, 1.0000},
-    {-11.4499, -28.7732, 57.2933, 0.8673, -0.4783, 0.0569, 0.1257, 1.0000, 1.0000, 1.0000},
-    {1.7217, -65.4356, 125.4684, 0.7757, 0.2099, 0.0384, 0.5940, 1.0000, 1.0000, 1.0000},
-    {8.6250, -103.2142, 76.1631, 0.4329, -0.6979, 0.5492, 0.1543, 1.0000, 1.0000, 1.0000},
-    {0.6858, -27.9073, 61.1652, 0.9862, 0.1442, 0.0048, 0.0810, 1.0000, 1.0000, 1.0000},
+    {{18.1371f, -89.0818f, 154.7091f}, {0.9809f, 0.1920f, 0.0190f, 0.0254f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{10.2540f, -54.6530f, 159.6752f}, {0.9845f, -0.1622f, 0.0415f, 0.0513f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{9.9977f, -58.1413f, 127.2789f}, {0.9858f, 0.1646f, 0.0132f, 0.0300f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.4523f, -34.5368f, 83.5641f}, {0.8986f, 0.2576f, -0.0075f, 0.3552f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{25.4277f, -37.0604f, 124.9271f}, {0.6915f, -0.1203f, 0.6011f, -0.3822f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.0259f, -67.9964f, 115.3488f}, {0.5205f, 0.1429f, -0.4472f, 0.7132f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.9063f, -22.7641f, 27.2181f}, {0.8728f, 0.4877f, -0.0080f, -0.0197f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.9284f, -55.6715f, 42.9425f}, {0.9994f, -0.0076f, 0.0324f, 0.0091f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3570f, 3.5802f, 13.1847f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2599f, -54.2407f, 13.1842f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.5690f, -49.9383f, 108.1875f}, {0.6672f, -0.0473f, 0.6417f, -0.3753f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{21.4575f, -64.2278f, 89.7978f}, {0.3173f, 0.4120f, 0.3251f, -0.7898f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-3.7305f, -79.6981f, 99.1407f}, {0.5429f, 0.1837f, -0.4520f, 0.6835f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{6.2612f, -93.6265f, 83.1380f}, {0.5515f, 0.1849f, -0.7037f, 0.4079f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.5419f, -24.6908f, 57.6464f}, {0.9975f, 0.0632f, 0.0234f, -0.0220f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.4499f, -28.7732f, 57.2933f}, {0.8673f, -0.4783f, 0.0568f, 0.1257f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.7217f, -65.4356f, 125.4684f}, {0.7757f, 0.2099f, 0.0384f, 0.5940f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.6858f, -27.9073f, 61.1652f}, {0.9862f, 0.1442f, 0.0048f, 0.0810f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{8.6250f, -103.2142f, 76.1631f}, {0.4329f, -0.6979f, 0.5492f, 0.1543f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Attack1_framedata11[] = {
-    {13.0949, -94.5409, 149.7334, 0.9529, 0.2965, -0.0392, 0.0506, 1.0000, 1.0000, 1.0000},
-    {2.9394, -60.8587, 155.6087, 0.9899, -0.0316, -0.1138, 0.0788, 1.0000, 1.0000, 1.0000},
-    {7.3742, -62.1775, 123.3543, 0.9776, 0.1932, -0.0538, 0.0636, 1.0000, 1.0000, 1.0000},
-    {1.1337, -32.4374, 83.1328, 0.8169, 0.3012, -0.1017, 0.4812, 1.0000, 1.0000, 1.0000},
-    {17.1636, -38.2646, 127.8673, 0.7750, 0.0553, 0.5296, -0.3402, 1.0000, 1.0000, 1.0000},
-    {-8.0033, -73.6179, 105.6318, 0.4746, 0.1236, -0.8401, 0.2317, 1.0000, 1.0000, 1.0000},
-    {14.3862, -23.1351, 26.5429, 0.8668, 0.4986, -0.0096, -0.0024, 1.0000, 1.0000, 1.0000},
-    {-12.4801, -54.6377, 43.0138, 0.9994, -0.0250, 0.0233, 0.0088, 1.0000, 1.0000, 1.0000},
-    {15.3570, 3.5801, 13.1852, 1.0000, -0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2612, -54.2405, 13.1858, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {20.4892, -46.4311, 108.5862, 0.7508, 0.1161, 0.5711, -0.3109, 1.0000, 1.0000, 1.0000},
-    {24.1595, -55.5928, 87.3867, 0.3773, 0.4703, 0.5494, -0.5785, 1.0000, 1.0000, 1.0000},
-    {3.2821, -71.0303, 87.7768, 0.4500, 0.2202, -0.8468, 0.1786, 1.0000, 1.0000, 1.0000},
-    {15.7370, -68.3619, 68.0875, 0.0347, 0.5511, -0.7278, 0.4067, 1.0000, 1.0000, 1.0000},
-    {13.3104, -23.2492, 57.0150, 0.9993, 0.0333, 0.0114, -0.0112, 1.0000, 1.0000, 1.0000},
-    {-11.6724, -27.3871, 56.6689, 0.8615, -0.4887, 0.0632, 0.1225, 1.0000, 1.0000, 1.0000},
-    {1.6636, -70.5376, 118.6135, 0.6468, 0.2920, -0.1228, 0.6938, 1.0000, 1.0000, 1.0000},
-    {24.2365, -64.9818, 58.6903, 0.6222, -0.5832, 0.0591, 0.5190, 1.0000, 1.0000, 1.0000},
-    {0.4459, -26.3972, 60.5654, 0.9879, 0.1311, 0.0040, 0.0822, 1.0000, 1.0000, 1.0000},
+    {{13.0949f, -94.5409f, 149.7334f}, {0.9529f, 0.2965f, -0.0392f, 0.0506f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{2.9394f, -60.8587f, 155.6087f}, {0.9899f, -0.0316f, -0.1138f, 0.0788f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{7.3742f, -62.1775f, 123.3543f}, {0.9776f, 0.1932f, -0.0538f, 0.0636f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.1337f, -32.4374f, 83.1328f}, {0.8169f, 0.3012f, -0.1017f, 0.4812f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{17.1636f, -38.2647f, 127.8673f}, {0.7750f, 0.0553f, 0.5296f, -0.3402f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-8.0033f, -73.6178f, 105.6317f}, {0.4746f, 0.1236f, -0.8401f, 0.2317f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.3862f, -23.1352f, 26.5428f}, {0.8668f, 0.4986f, -0.0096f, -0.0024f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.4790f, -54.6374f, 43.0137f}, {0.9994f, -0.0250f, 0.0233f, 0.0088f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3570f, 3.5798f, 13.1851f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2598f, -54.2402f, 13.1857f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{20.4892f, -46.4311f, 108.5862f}, {0.7508f, 0.1161f, 0.5711f, -0.3109f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.1595f, -55.5928f, 87.3867f}, {0.3773f, 0.4703f, 0.5494f, -0.5785f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{3.2821f, -71.0303f, 87.7767f}, {0.4500f, 0.2202f, -0.8468f, 0.1786f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.7370f, -68.3619f, 68.0873f}, {0.0347f, 0.5511f, -0.7278f, 0.4067f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.3104f, -23.2492f, 57.0150f}, {0.9993f, 0.0333f, 0.0114f, -0.0112f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.6724f, -27.3871f, 56.6689f}, {0.8615f, -0.4887f, 0.0632f, 0.1224f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.6636f, -70.5376f, 118.6135f}, {0.6468f, 0.2920f, -0.1228f, 0.6938f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.4459f, -26.3972f, 60.5654f}, {0.9879f, 0.1311f, 0.0040f, 0.0822f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.2365f, -64.9817f, 58.6903f}, {0.6222f, -0.5832f, 0.0591f, 0.5190f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Attack1_framedata17[] = {
-    {6.4681, -62.1959, 168.9091, 0.9953, -0.0417, -0.0665, 0.0560, 1.0000, 1.0000, 1.0000},
-    {-2.1134, -27.5796, 168.4468, 0.9934, 0.0981, -0.0390, 0.0446, 1.0000, 1.0000, 1.0000},
-    {1.2954, -35.2138, 136.9531, 0.9934, 0.0981, -0.0390, 0.0446, 1.0000, 1.0000, 1.0000},
-    {0.4452, -16.5592, 90.1293, 0.9311, 0.1814, -0.0518, 0.3123, 1.0000, 1.0000, 1.0000},
-    {19.4981, -16.5522, 134.0506, 0.7712, 0.2987, 0.5371, -0.1664, 1.0000, 1.0000, 1.0000},
-    {-19.4905, -43.9929, 123.8261, 0.9862, 0.0808, 0.0119, 0.1437, 1.0000, 1.0000, 1.0000},
-    {14.9084, -18.3273, 33.5066, 0.9287, 0.3708, -0.0035, 0.0060, 1.0000, 1.0000, 1.0000},
-    {-11.6214, -41.6311, 49.9981, 0.9571, 0.2893, 0.0065, 0.0147, 1.0000, 1.0000, 1.0000},
-    {15.3569, 3.5795, 13.1852, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-12.6580, -23.5470, 26.2297, 0.9899, 0.1401, -0.0012, 0.0216, 1.0000, 1.0000, 1.0000},
-    {26.3066, -13.0779, 114.2747, 0.8080, 0.2235, 0.4680, -0.2798, 1.0000, 1.0000, 1.0000},
-    {35.6254, -20.1549, 94.0286, 0.7847, 0.3622, 0.4554, -0.2138, 1.0000, 1.0000, 1.0000},
-    {-40.4183, -47.5978, 122.4526, 0.6812, 0.0117, 0.2534, 0.6868, 1.0000, 1.0000, 1.0000},
-    {-36.3381, -69.4897, 129.8023, 0.1513, -0.2990, -0.1254, 0.9338, 1.0000, 1.0000, 1.0000},
-    {13.2381, -11.5383, 63.1856, 0.9967, -0.0810, 0.0009, -0.0076, 1.0000, 1.0000, 1.0000},
-    {-11.9568, -14.1056, 63.1106, 0.8557, -0.5000, 0.0444, 0.1254, 1.0000, 1.0000, 1.0000},
-    {-7.6290, -41.6640, 135.0219, 0.8574, 0.3289, 0.1877, 0.3486, 1.0000, 1.0000, 1.0000},
-    {-32.3874, -71.6140, 139.3432, 0.0809, 0.8152, -0.2417, 0.5200, 1.0000, 1.0000, 1.0000},
-    {0.1916, -13.3950, 66.9739, 0.9964, 0.0680, 0.0020, 0.0507, 1.0000, 1.0000, 1.0000},
+    {{6.4681f, -62.1959f, 168.9091f}, {0.9953f, -0.0417f, -0.0665f, 0.0560f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-2.1134f, -27.5796f, 168.4468f}, {0.9934f, 0.0981f, -0.0390f, 0.0446f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.2954f, -35.2138f, 136.9531f}, {0.9934f, 0.0981f, -0.0390f, 0.0446f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.4452f, -16.5592f, 90.1293f}, {0.9311f, 0.1814f, -0.0518f, 0.3123f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{19.4981f, -16.5522f, 134.0506f}, {0.7712f, 0.2987f, 0.5371f, -0.1664f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.4905f, -43.9929f, 123.8261f}, {0.9862f, 0.0808f, 0.0119f, 0.1437f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.9084f, -18.3274f, 33.5066f}, {0.9287f, 0.3708f, -0.0035f, 0.0060f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.6203f, -41.6310f, 49.9979f}, {0.9571f, 0.2893f, 0.0064f, 0.0147f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3569f, 3.5792f, 13.1852f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.6575f, -23.5470f, 26.2295f}, {0.9899f, 0.1401f, -0.0012f, 0.0216f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.3066f, -13.0779f, 114.2747f}, {0.8080f, 0.2235f, 0.4680f, -0.2798f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{35.6254f, -20.1549f, 94.0286f}, {0.7847f, 0.3622f, 0.4554f, -0.2138f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-40.4183f, -47.5978f, 122.4527f}, {0.6812f, 0.0117f, 0.2534f, 0.6868f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-36.3381f, -69.4897f, 129.8023f}, {0.1513f, -0.2990f, -0.1254f, 0.9338f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.2381f, -11.5383f, 63.1855f}, {0.9967f, -0.0810f, 0.0009f, -0.0076f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.9568f, -14.1056f, 63.1106f}, {0.8557f, -0.5000f, 0.0443f, 0.1254f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-7.6290f, -41.6640f, 135.0219f}, {0.8574f, 0.3289f, 0.1877f, 0.3486f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.1916f, -13.3950f, 66.9739f}, {0.9964f, 0.0680f, 0.0020f, 0.0507f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-32.3874f, -71.6140f, 139.3432f}, {0.0809f, 0.8152f, -0.2417f, 0.5200f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Attack1_framedata22[] = {
-    {5.0594, -24.2067, 184.9950, 0.9994, -0.0289, -0.0137, 0.0138, 1.0000, 1.0000, 1.0000},
-    {-1.1849, 10.4116, 179.1025, 0.9998, 0.0134, -0.0073, 0.0083, 1.0000, 1.0000, 1.0000},
-    {-0.4804, -2.6028, 149.2382, 0.9998, 0.0134, -0.0073, 0.0083, 1.0000, 1.0000, 1.0000},
-    {0.0451, 0.3637, 98.9180, 0.9982, 0.0291, -0.0067, 0.0519, 1.0000, 1.0000, 1.0000},
-    {23.7249, 2.4323, 140.4762, 0.7482, 0.1703, 0.6027, -0.2189, 1.0000, 1.0000, 1.0000},
-    {-24.7694, -2.5976, 139.6732, 0.7646, -0.5028, 0.0869, -0.3937, 1.0000, 1.0000, 1.0000},
-    {15.2209, -4.8446, 41.8585, 0.9938, 0.1112, 0.0044, 0.0018, 1.0000, 1.0000, 1.0000},
-    {-12.7526, -11.9046, 43.9518, 0.9863, 0.1642, 0.0108, 0.0086, 1.0000, 1.0000, 1.0000},
-    {15.3567, 3.5787, 13.1863, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-13.8690, -0.4550, 16.3711, 0.9994, 0.0343, -0.0003, 0.0053, 1.0000, 1.0000, 1.0000},
-    {26.2757, 1.8054, 119.4379, 0.7153, 0.2135, 0.6423, -0.1740, 1.0000, 1.0000, 1.0000},
-    {29.1533, 0.9623, 96.2465, 0.7562, 0.0669, 0.6463, -0.0782, 1.0000, 1.0000, 1.0000},
-    {-38.7738, 11.1170, 131.3882, 0.7031, -0.1182, 0.6930, 0.1071, 1.0000, 1.0000, 1.0000},
-    {-37.8434, 9.3840, 154.7559, 0.4055, -0.2258, 0.8551, 0.2313, 1.0000, 1.0000, 1.0000},
-    {13.1783, 1.1563, 71.6835, 0.9977, -0.0681, -0.0046, -0.0029, 1.0000, 1.0000, 1.0000},
-    {-12.1436, 0.7315, 71.6942, 0.9826, -0.1795, -0.0072, 0.0465, 1.0000, 1.0000, 1.0000},
-    {-11.5945, -3.7811, 149.4960, 0.9788, 0.1277, 0.1595, 0.0170, 1.0000, 1.0000, 1.0000},
-    {-27.6032, 13.6135, 157.9743, 0.9775, -0.0058, -0.1787, 0.1121, 1.0000, 1.0000, 1.0000},
-    {0.0270, 0.8545, 75.5513, 0.9999, 0.0105, 0.0003, 0.0084, 1.0000, 1.0000, 1.0000},
+    {{5.0594f, -24.2067f, 184.9950f}, {0.9994f, -0.0289f, -0.0137f, 0.0138f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.1849f, 10.4116f, 179.1026f}, {0.9998f, 0.0134f, -0.0073f, 0.0083f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.4804f, -2.6028f, 149.2382f}, {0.9998f, 0.0134f, -0.0073f, 0.0083f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0451f, 0.3637f, 98.9180f}, {0.9982f, 0.0291f, -0.0067f, 0.0519f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.7249f, 2.4323f, 140.4762f}, {0.7482f, 0.1703f, 0.6027f, -0.2189f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.7694f, -2.5976f, 139.6732f}, {0.7646f, -0.5028f, 0.0869f, -0.3937f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.2209f, -4.8447f, 41.8585f}, {0.9938f, 0.1112f, 0.0044f, 0.0018f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.7520f, -11.9050f, 43.9517f}, {0.9863f, 0.1642f, 0.0108f, 0.0086f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3567f, 3.5787f, 13.1863f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.8689f, -0.4553f, 16.3711f}, {0.9994f, 0.0343f, -0.0003f, 0.0053f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.2757f, 1.8054f, 119.4379f}, {0.7153f, 0.2135f, 0.6423f, -0.1740f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.1533f, 0.9623f, 96.2465f}, {0.7562f, 0.0669f, 0.6463f, -0.0782f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-38.7738f, 11.1170f, 131.3882f}, {0.7031f, -0.1182f, 0.6930f, 0.1071f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-37.8434f, 9.3840f, 154.7559f}, {0.4055f, -0.2258f, 0.8551f, 0.2313f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1783f, 1.1563f, 71.6835f}, {0.9977f, -0.0681f, -0.0046f, -0.0029f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1436f, 0.7315f, 71.6942f}, {0.9826f, -0.1795f, -0.0072f, 0.0464f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.5945f, -3.7811f, 149.4960f}, {0.9788f, 0.1277f, 0.1595f, 0.0170f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0270f, 0.8545f, 75.5513f}, {0.9999f, 0.0105f, 0.0003f, 0.0084f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-27.6032f, 13.6135f, 157.9743f}, {0.9775f, -0.0058f, -0.1787f, 0.1121f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Attack1_framedata24[] = {
-    {5.6276, -17.9195, 187.0379, 1.0000, -0.0034, -0.0015, 0.0016, 1.0000, 1.0000, 1.0000},
-    {-0.1879, 16.6376, 180.3948, 1.0000, 0.0014, -0.0008, 0.0009, 1.0000, 1.0000, 1.0000},
-    {-0.0652, 2.9054, 150.8455, 1.0000, 0.0014, -0.0008, 0.0009, 1.0000, 1.0000, 1.0000},
-    {0.0044, 3.2262, 100.4364, 1.0000, 0.0032, -0.0007, 0.0057, 1.0000, 1.0000, 1.0000},
-    {24.3714, 5.2232, 141.5989, 0.7507, 0.1422, 0.6249, -0.1606, 1.0000, 1.0000, 1.0000},
-    {-24.3865, 4.6675, 141.5280, 0.6517, -0.6896, 0.1216, -0.2915, 1.0000, 1.0000, 1.0000},
-    {15.2124, 0.4861, 42.9102, 0.9998, 0.0204, 0.0044, 0.0014, 1.0000, 1.0000, 1.0000},
-    {-14.0507, 0.4231, 42.9026, 0.9998, 0.0209, -0.0022, -0.0052, 1.0000, 1.0000, 1.0000},
-    {15.3567, 3.5787, 13.1868, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2602, 3.5789, 13.1868, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {26.4536, 5.6827, 120.5047, 0.7138, 0.1820, 0.6661, -0.1172, 1.0000, 1.0000, 1.0000},
-    {28.8379, 6.0423, 97.2449, 0.7113, 0.0316, 0.6994, -0.0629, 1.0000, 1.0000, 1.0000},
-    {-41.7786, 14.4763, 134.1689, 0.4994, -0.1688, 0.8473, 0.0650, 1.0000, 1.0000, 1.0000},
-    {-30.0898, 17.6057, 154.2561, 0.2509, -0.1432, 0.9138, 0.2855, 1.0000, 1.0000, 1.0000},
-    {13.1588, 3.3128, 73.2006, 0.9999, -0.0156, -0.0043, 0.0004, 1.0000, 1.0000, 1.0000},
-    {-12.1667, 3.2659, 73.2022, 0.9999, -0.0154, 0.0026, -0.0005, 1.0000, 1.0000, 1.0000},
-    {-11.2357, 2.7753, 151.2718, 0.9915, 0.0465, 0.1074, -0.0560, 1.0000, 1.0000, 1.0000},
-    {-18.1110, 22.5156, 152.7345, 0.9998, 0.0140, 0.0039, -0.0096, 1.0000, 1.0000, 1.0000},
-    {0.0029, 3.2796, 77.0645, 1.0000, 0.0011, 0.0000, 0.0009, 1.0000, 1.0000, 1.0000},
+    {{5.6276f, -17.9195f, 187.0379f}, {1.0000f, -0.0034f, -0.0015f, 0.0016f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.1879f, 16.6376f, 180.3948f}, {1.0000f, 0.0014f, -0.0008f, 0.0009f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0652f, 2.9054f, 150.8455f}, {1.0000f, 0.0014f, -0.0008f, 0.0009f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0044f, 3.2262f, 100.4364f}, {1.0000f, 0.0032f, -0.0007f, 0.0057f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.3714f, 5.2232f, 141.5989f}, {0.7507f, 0.1422f, 0.6249f, -0.1606f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3865f, 4.6675f, 141.5280f}, {0.6517f, -0.6896f, 0.1216f, -0.2915f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.2125f, 0.4859f, 42.9102f}, {0.9998f, 0.0204f, 0.0044f, 0.0014f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.0506f, 0.4231f, 42.9026f}, {0.9998f, 0.0209f, -0.0022f, -0.0053f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3567f, 3.5787f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2602f, 3.5787f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.4536f, 5.6827f, 120.5047f}, {0.7138f, 0.1820f, 0.6661f, -0.1172f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.8379f, 6.0423f, 97.2450f}, {0.7113f, 0.0316f, 0.6994f, -0.0629f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-41.7786f, 14.4763f, 134.1688f}, {0.4994f, -0.1688f, 0.8473f, 0.0650f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.0898f, 17.6057f, 154.2561f}, {0.2509f, -0.1432f, 0.9138f, 0.2855f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1588f, 3.3128f, 73.2006f}, {0.9999f, -0.0156f, -0.0043f, 0.0004f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1667f, 3.2659f, 73.2022f}, {0.9999f, -0.0154f, 0.0026f, -0.0005f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.2357f, 2.7753f, 151.2718f}, {0.9915f, 0.0465f, 0.1074f, -0.0560f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0029f, 3.2796f, 77.0645f}, {1.0000f, 0.0011f, 0.0000f, 0.0009f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.1110f, 22.5156f, 152.7345f}, {0.9998f, 0.0140f, 0.0039f, -0.0096f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Attack1_framedata25[] = {
-    {5.7124, -17.1539, 187.2770, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0493, 17.3950, 180.5452, 1.0000, 0.0000, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 151.0348, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 100.6246, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4480, 5.5590, 141.7399, 0.7514, 0.1379, 0.6270, -0.1525, 1.0000, 1.0000, 1.0000},
-    {-24.3131, 5.5590, 141.7399, 0.7510, 0.0896, -0.6220, 0.2026, 1.0000, 1.0000, 1.0000},
-    {14.9496, 1.7005, 43.0092, 1.0000, -0.0000, 0.0000, 0.0012, 1.0000, 1.0000, 1.0000},
-    {-13.8958, 1.6727, 43.0074, 1.0000, -0.0000, -0.0000, -0.0012, 1.0000, 1.0000, 1.0000},
-    {15.3567, 3.5787, 13.1868, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2602, 3.5789, 13.1868, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {26.4904, 6.1434, 120.6449, 0.7140, 0.1772, 0.6685, -0.1093, 1.0000, 1.0000, 1.0000},
-    {28.8340, 6.6419, 97.3836, 0.7053, 0.0283, 0.7056, -0.0619, 1.0000, 1.0000, 1.0000},
-    {-26.7043, 4.2125, 120.6372, 0.7334, 0.1638, -0.6481, 0.1234, 1.0000, 1.0000, 1.0000},
-    {-29.3517, 2.5449, 97.3965, 0.7179, 0.0072, -0.6937, 0.0577, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 73.3896, 1.0000, -0.0000, -0.0000, 0.0012, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 73.3896, 1.0000, -0.0000, 0.0000, -0.0012, 1.0000, 1.0000, 1.0000},
-    {-11.1706, 3.5788, 151.4774, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-18.0278, 23.6679, 152.7758, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 77.2527, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.7124f, -17.1539f, 187.2770f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0493f, 17.3950f, 180.5452f}, {1.0000f, 0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 151.0348f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 100.6246f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4480f, 5.5590f, 141.7399f}, {0.7514f, 0.1379f, 0.6270f, -0.1525f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3131f, 5.5590f, 141.7399f}, {0.7510f, 0.0896f, -0.6220f, 0.2026f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.9496f, 1.7003f, 43.0092f}, {1.0000f, -0.0000f, 0.0000f, 0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.8956f, 1.6729f, 43.0074f}, {1.0000f, -0.0000f, 0.0000f, -0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3567f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2602f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.4904f, 6.1434f, 120.6449f}, {0.7140f, 0.1772f, 0.6685f, -0.1093f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.8340f, 6.6419f, 97.3836f}, {0.7053f, 0.0283f, 0.7056f, -0.0619f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.7043f, 4.2125f, 120.6372f}, {0.7334f, 0.1638f, -0.6481f, 0.1234f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.3517f, 2.5449f, 97.3965f}, {0.7179f, 0.0072f, -0.6937f, 0.0577f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 73.3896f}, {1.0000f, -0.0000f, -0.0000f, 0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 73.3896f}, {1.0000f, -0.0000f, -0.0000f, -0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1706f, 3.5788f, 151.4774f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 77.2527f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0278f, 23.6679f, 152.7758f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64KeyFrame anim_Catherine_Attack1_keyframes[] = {
     {0, anim_Catherine_Attack1_framedata0},
@@ -1232,243 +1457,257 @@ static s64KeyFrame anim_Catherine_Attack1_keyframes[] = {
     {24, anim_Catherine_Attack1_framedata24},
     {25, anim_Catherine_Attack1_framedata25},
 };
+static u16 anim_Catherine_Attack1_framelookup[] = {
+    0, 0, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3,
+    3, 4, 4, 4, 4, 4, 5, 5, 6, 7,
+};
 
 static s64Transform anim_Catherine_Idle_framedata0[] = {
-    {5.7124, -17.1539, 187.2770, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0493, 17.3950, 180.5452, 1.0000, 0.0000, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 151.0348, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 100.6246, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4480, 5.5590, 141.7399, 0.7514, 0.1379, 0.6270, -0.1525, 1.0000, 1.0000, 1.0000},
-    {-24.3131, 5.5590, 141.7399, 0.7510, 0.0896, -0.6220, 0.2026, 1.0000, 1.0000, 1.0000},
-    {14.9496, 1.7005, 43.0092, 1.0000, -0.0000, 0.0000, 0.0012, 1.0000, 1.0000, 1.0000},
-    {-13.8958, 1.6727, 43.0074, 1.0000, -0.0000, -0.0000, -0.0012, 1.0000, 1.0000, 1.0000},
-    {15.3567, 3.5787, 13.1868, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2602, 3.5789, 13.1868, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {26.4904, 6.1434, 120.6449, 0.7140, 0.1772, 0.6685, -0.1093, 1.0000, 1.0000, 1.0000},
-    {28.8340, 6.6419, 97.3836, 0.7053, 0.0283, 0.7056, -0.0619, 1.0000, 1.0000, 1.0000},
-    {-26.7043, 4.2125, 120.6372, 0.7334, 0.1638, -0.6481, 0.1234, 1.0000, 1.0000, 1.0000},
-    {-29.3517, 2.5449, 97.3965, 0.7179, 0.0072, -0.6937, 0.0577, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 73.3896, 1.0000, -0.0000, -0.0000, 0.0012, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 73.3896, 1.0000, -0.0000, 0.0000, -0.0012, 1.0000, 1.0000, 1.0000},
-    {-11.1706, 3.5788, 151.4774, 0.9899, 0.1399, 0.0185, -0.0099, 1.0000, 1.0000, 1.0000},
-    {-18.0278, 23.6679, 152.7758, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 77.2527, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.7124f, -17.1539f, 187.2770f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0493f, 17.3950f, 180.5452f}, {1.0000f, 0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 151.0348f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 100.6246f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4480f, 5.5590f, 141.7399f}, {0.7514f, 0.1379f, 0.6270f, -0.1525f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3131f, 5.5590f, 141.7399f}, {0.7510f, 0.0896f, -0.6220f, 0.2026f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.9496f, 1.7003f, 43.0092f}, {1.0000f, -0.0000f, 0.0000f, 0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.8956f, 1.6729f, 43.0074f}, {1.0000f, -0.0000f, 0.0000f, -0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3567f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2602f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.4904f, 6.1434f, 120.6449f}, {0.7140f, 0.1772f, 0.6685f, -0.1093f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.8340f, 6.6419f, 97.3836f}, {0.7053f, 0.0283f, 0.7056f, -0.0619f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.7043f, 4.2125f, 120.6372f}, {0.7334f, 0.1638f, -0.6481f, 0.1234f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.3517f, 2.5449f, 97.3965f}, {0.7179f, 0.0072f, -0.6937f, 0.0577f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 73.3896f}, {1.0000f, -0.0000f, -0.0000f, 0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 73.3896f}, {1.0000f, -0.0000f, -0.0000f, -0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1706f, 3.5788f, 151.4774f}, {0.9899f, 0.1399f, 0.0185f, -0.0099f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 77.2527f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0278f, 23.6679f, 152.7758f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Idle_framedata60[] = {
-    {5.6414, -18.4070, 187.8860, 0.9998, -0.0201, 0.0011, -0.0001, 1.0000, 1.0000, 1.0000},
-    {-0.1265, 15.8457, 179.7850, 0.9998, -0.0201, 0.0011, -0.0001, 1.0000, 1.0000, 1.0000},
-    {-0.1438, 0.8559, 150.8530, 0.9998, -0.0201, 0.0011, -0.0001, 1.0000, 1.0000, 1.0000},
-    {-0.1534, 0.6761, 100.4432, 1.0000, -0.0018, 0.0001, -0.0000, 1.0000, 1.0000, 1.0000},
-    {24.3025, 2.8023, 141.5465, 0.7647, 0.1257, 0.6133, -0.1523, 1.0000, 1.0000, 1.0000},
-    {-24.4587, 2.8036, 141.5557, 0.7635, 0.1049, -0.6139, 0.1711, 1.0000, 1.0000, 1.0000},
-    {14.4993, 3.2140, 43.0565, 0.9997, -0.0254, -0.0075, 0.0001, 1.0000, 1.0000, 1.0000},
-    {-13.9937, 1.5934, 43.0033, 1.0000, 0.0013, -0.0016, -0.0013, 1.0000, 1.0000, 1.0000},
-    {15.3566, 3.5787, 13.1868, 1.0000, -0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2604, 3.5789, 13.1868, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {27.0503, 2.8790, 120.5237, 0.7283, 0.1644, 0.6562, -0.1093, 1.0000, 1.0000, 1.0000},
-    {30.1739, 2.8192, 97.3490, 0.7653, 0.0766, 0.6382, -0.0344, 1.0000, 1.0000, 1.0000},
-    {-27.7050, 2.7426, 120.5245, 0.7430, 0.1766, -0.6393, 0.0900, 1.0000, 1.0000, 1.0000},
-    {-31.3003, 2.4917, 97.3528, 0.7556, 0.0338, -0.6534, 0.0325, 1.0000, 1.0000, 1.0000},
-    {13.1813, 4.0646, 73.5074, 0.9998, 0.0168, 0.0078, 0.0016, 1.0000, 1.0000, 1.0000},
-    {-12.1437, 4.0530, 73.3384, 1.0000, -0.0092, 0.0020, -0.0010, 1.0000, 1.0000, 1.0000},
-    {-11.3143, 0.8578, 151.2977, 0.9902, 0.1381, 0.0186, -0.0100, 1.0000, 1.0000, 1.0000},
-    {-18.1708, 20.9515, 152.5258, 1.0000, -0.0018, 0.0001, -0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 77.2527, 0.9981, 0.0622, -0.0033, 0.0004, 1.0000, 1.0000, 1.0000},
+    {{5.6414f, -18.4070f, 187.8860f}, {0.9998f, -0.0201f, 0.0011f, -0.0001f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.1265f, 15.8457f, 179.7850f}, {0.9998f, -0.0201f, 0.0011f, -0.0001f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.1438f, 0.8559f, 150.8530f}, {0.9998f, -0.0201f, 0.0011f, -0.0001f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.1534f, 0.6761f, 100.4432f}, {1.0000f, -0.0018f, 0.0001f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.3025f, 2.8023f, 141.5465f}, {0.7647f, 0.1257f, 0.6133f, -0.1523f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.4587f, 2.8036f, 141.5557f}, {0.7635f, 0.1049f, -0.6139f, 0.1711f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.4992f, 3.2143f, 43.0565f}, {0.9996f, -0.0254f, -0.0075f, 0.0001f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.9934f, 1.5935f, 43.0032f}, {1.0000f, 0.0013f, -0.0016f, -0.0013f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3566f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2601f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{27.0502f, 2.8790f, 120.5237f}, {0.7283f, 0.1644f, 0.6562f, -0.1093f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{30.1739f, 2.8192f, 97.3490f}, {0.7653f, 0.0766f, 0.6382f, -0.0344f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-27.7050f, 2.7426f, 120.5244f}, {0.7430f, 0.1766f, -0.6393f, 0.0900f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-31.3003f, 2.4917f, 97.3527f}, {0.7556f, 0.0338f, -0.6534f, 0.0325f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1813f, 4.0646f, 73.5074f}, {0.9998f, 0.0168f, 0.0078f, 0.0016f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1437f, 4.0530f, 73.3384f}, {1.0000f, -0.0091f, 0.0020f, -0.0010f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.3143f, 0.8578f, 151.2977f}, {0.9902f, 0.1381f, 0.0186f, -0.0100f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 77.2527f}, {0.9981f, 0.0622f, -0.0033f, 0.0004f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.1708f, 20.9515f, 152.5258f}, {1.0000f, -0.0018f, 0.0001f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Idle_framedata120[] = {
-    {5.7124, -17.1539, 187.2770, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0493, 17.3950, 180.5452, 1.0000, 0.0000, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 151.0348, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 100.6246, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4480, 5.5590, 141.7399, 0.7514, 0.1379, 0.6270, -0.1525, 1.0000, 1.0000, 1.0000},
-    {-24.3131, 5.5590, 141.7399, 0.7510, 0.0896, -0.6220, 0.2026, 1.0000, 1.0000, 1.0000},
-    {14.9496, 1.7005, 43.0092, 1.0000, -0.0000, 0.0000, 0.0012, 1.0000, 1.0000, 1.0000},
-    {-13.8958, 1.6727, 43.0074, 1.0000, -0.0000, -0.0000, -0.0012, 1.0000, 1.0000, 1.0000},
-    {15.3567, 3.5787, 13.1868, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2602, 3.5789, 13.1868, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {26.4904, 6.1434, 120.6449, 0.7140, 0.1772, 0.6685, -0.1093, 1.0000, 1.0000, 1.0000},
-    {28.8340, 6.6419, 97.3836, 0.7053, 0.0283, 0.7056, -0.0619, 1.0000, 1.0000, 1.0000},
-    {-26.7043, 4.2125, 120.6372, 0.7334, 0.1638, -0.6481, 0.1234, 1.0000, 1.0000, 1.0000},
-    {-29.3517, 2.5449, 97.3965, 0.7179, 0.0072, -0.6937, 0.0577, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 73.3896, 1.0000, -0.0000, -0.0000, 0.0012, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 73.3896, 1.0000, -0.0000, 0.0000, -0.0012, 1.0000, 1.0000, 1.0000},
-    {-11.1706, 3.5788, 151.4774, 0.9899, 0.1399, 0.0185, -0.0099, 1.0000, 1.0000, 1.0000},
-    {-18.0278, 23.6679, 152.7758, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 77.2527, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.7124f, -17.1539f, 187.2770f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0493f, 17.3950f, 180.5452f}, {1.0000f, 0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 151.0348f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 100.6246f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4480f, 5.5590f, 141.7399f}, {0.7514f, 0.1379f, 0.6270f, -0.1525f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3131f, 5.5590f, 141.7399f}, {0.7510f, 0.0896f, -0.6220f, 0.2026f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.9496f, 1.7003f, 43.0092f}, {1.0000f, -0.0000f, 0.0000f, 0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.8956f, 1.6729f, 43.0074f}, {1.0000f, -0.0000f, 0.0000f, -0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3567f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2602f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.4904f, 6.1434f, 120.6449f}, {0.7140f, 0.1772f, 0.6685f, -0.1093f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.8340f, 6.6419f, 97.3836f}, {0.7053f, 0.0283f, 0.7056f, -0.0619f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.7043f, 4.2125f, 120.6372f}, {0.7334f, 0.1638f, -0.6481f, 0.1234f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.3517f, 2.5449f, 97.3965f}, {0.7179f, 0.0072f, -0.6937f, 0.0577f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 73.3896f}, {1.0000f, -0.0000f, -0.0000f, 0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 73.3896f}, {1.0000f, -0.0000f, -0.0000f, -0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1706f, 3.5788f, 151.4774f}, {0.9899f, 0.1399f, 0.0185f, -0.0099f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 77.2527f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0278f, 23.6679f, 152.7758f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64KeyFrame anim_Catherine_Idle_keyframes[] = {
     {0, anim_Catherine_Idle_framedata0},
     {60, anim_Catherine_Idle_framedata60},
     {120, anim_Catherine_Idle_framedata120},
 };
+static u16 anim_Catherine_Idle_framelookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 2,
+};
 
 static s64Transform anim_Catherine_Roll_framedata0[] = {
-    {9.5381, -69.1327, 150.9954, 0.9439, 0.3294, 0.0144, 0.0188, 1.0000, 1.0000, 1.0000},
-    {2.6157, -38.1819, 167.3133, 0.9439, 0.3294, 0.0144, 0.0188, 1.0000, 1.0000, 1.0000},
-    {1.8551, -30.6552, 135.6190, 0.9439, 0.3294, 0.0144, 0.0188, 1.0000, 1.0000, 1.0000},
-    {0.3871, -3.4272, 93.2201, 0.9591, 0.2818, 0.0080, 0.0244, 1.0000, 1.0000, 1.0000},
-    {25.9164, -22.7163, 128.8330, 0.6243, -0.0316, 0.7699, -0.1285, 1.0000, 1.0000, 1.0000},
-    {-22.7804, -25.2196, 128.9115, 0.7463, -0.0129, -0.6280, 0.2200, 1.0000, 1.0000, 1.0000},
-    {14.6724, -8.8379, 40.3594, 0.9831, 0.1813, -0.0106, 0.0234, 1.0000, 1.0000, 1.0000},
-    {-12.6160, 10.7793, 37.5016, 0.9612, 0.2742, 0.0134, 0.0262, 1.0000, 1.0000, 1.0000},
-    {15.3565, 3.5788, 13.1854, 1.0000, -0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2600, 28.0743, 13.1867, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {19.3898, -25.8071, 108.8991, 0.5769, 0.0130, 0.8102, -0.1027, 1.0000, 1.0000, 1.0000},
-    {12.3124, -29.3354, 86.8924, 0.5456, -0.2120, 0.7111, -0.3895, 1.0000, 1.0000, 1.0000},
-    {-24.2288, -29.9905, 108.2234, 0.7304, 0.0635, -0.6641, 0.1465, 1.0000, 1.0000, 1.0000},
-    {-25.8571, -35.4237, 85.4694, 0.6670, -0.1643, -0.6804, 0.2554, 1.0000, 1.0000, 1.0000},
-    {13.0722, 5.4629, 67.2415, 0.9773, -0.2115, 0.0009, -0.0084, 1.0000, 1.0000, 1.0000},
-    {-12.2147, 4.0652, 67.2414, 0.9894, 0.1424, -0.0229, 0.0144, 1.0000, 1.0000, 1.0000},
-    {-9.2879, -31.4678, 136.0093, 0.9102, 0.4126, 0.0319, 0.0188, 1.0000, 1.0000, 1.0000},
-    {-16.9482, -15.6460, 147.9787, 0.9591, 0.2818, 0.0080, 0.0244, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 70.9263, 0.9880, 0.1518, 0.0042, 0.0273, 1.0000, 1.0000, 1.0000},
+    {{9.5381f, -69.1327f, 150.9954f}, {0.9439f, 0.3294f, 0.0144f, 0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{2.6157f, -38.1819f, 167.3133f}, {0.9439f, 0.3294f, 0.0144f, 0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.8551f, -30.6552f, 135.6190f}, {0.9439f, 0.3294f, 0.0144f, 0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.3871f, -3.4272f, 93.2201f}, {0.9591f, 0.2818f, 0.0080f, 0.0244f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{25.9164f, -22.7163f, 128.8330f}, {0.6243f, -0.0316f, 0.7699f, -0.1285f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-22.7804f, -25.2196f, 128.9115f}, {0.7463f, -0.0129f, -0.6280f, 0.2200f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.6724f, -8.8380f, 40.3594f}, {0.9831f, 0.1813f, -0.0106f, 0.0234f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.6159f, 10.7790f, 37.5015f}, {0.9612f, 0.2742f, 0.0134f, 0.0262f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3565f, 3.5787f, 13.1854f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2603f, 28.0740f, 13.1867f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{19.3898f, -25.8071f, 108.8991f}, {0.5769f, 0.0130f, 0.8102f, -0.1027f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.3124f, -29.3354f, 86.8924f}, {0.5456f, -0.2120f, 0.7111f, -0.3895f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.2288f, -29.9905f, 108.2235f}, {0.7304f, 0.0635f, -0.6641f, 0.1465f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-25.8571f, -35.4236f, 85.4694f}, {0.6670f, -0.1643f, -0.6804f, 0.2554f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.0722f, 5.4629f, 67.2415f}, {0.9773f, -0.2115f, 0.0009f, -0.0084f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.2147f, 4.0652f, 67.2414f}, {0.9894f, 0.1424f, -0.0229f, 0.0144f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-9.2879f, -31.4678f, 136.0093f}, {0.9102f, 0.4126f, 0.0319f, 0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 70.9263f}, {0.9880f, 0.1518f, 0.0042f, 0.0273f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.9482f, -15.6460f, 147.9788f}, {0.9591f, 0.2818f, 0.0080f, 0.0244f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Roll_framedata3[] = {
-    {-36.4458, -87.3531, 35.2604, 0.4718, 0.7589, 0.1020, -0.4372, 1.0000, 1.0000, 1.0000},
-    {-16.4679, -98.8980, 62.4587, 0.4718, 0.7589, 0.1020, -0.4372, 1.0000, 1.0000, 1.0000},
-    {-7.5346, -67.7700, 58.8534, 0.4718, 0.7589, 0.1020, -0.4372, 1.0000, 1.0000, 1.0000},
-    {-2.4356, -18.7859, 69.6121, 0.6167, 0.7765, 0.0616, -0.1141, 1.0000, 1.0000, 1.0000},
-    {17.4998, -60.2973, 56.5172, 0.4801, 0.0565, 0.8578, 0.1743, 1.0000, 1.0000, 1.0000},
-    {-29.6222, -58.1031, 68.8598, 0.7517, 0.0460, -0.6552, 0.0599, 1.0000, 1.0000, 1.0000},
-    {6.6461, -18.3277, 31.5467, 0.9042, 0.3985, -0.0965, -0.1199, 1.0000, 1.0000, 1.0000},
-    {-16.6772, 28.3787, 36.0730, 0.5712, 0.8062, 0.0682, -0.1384, 1.0000, 1.0000, 1.0000},
-    {15.3570, 3.5801, 13.1828, 0.9968, -0.0000, -0.0000, -0.0800, 1.0000, 1.0000, 1.0000},
-    {-12.1865, 55.7791, 47.1226, 0.7859, 0.6182, 0.0083, -0.0084, 1.0000, 1.0000, 1.0000},
-    {4.4358, -54.2903, 40.9365, 0.4135, 0.0846, 0.8846, 0.1983, 1.0000, 1.0000, 1.0000},
-    {-9.8567, -47.7164, 23.6351, 0.3971, 0.3555, 0.7018, -0.4727, 1.0000, 1.0000, 1.0000},
-    {-31.0604, -56.2352, 47.7104, 0.7182, 0.1162, -0.6859, -0.0161, 1.0000, 1.0000, 1.0000},
-    {-32.7076, -54.3510, 24.3940, 0.5017, 0.0235, -0.8336, -0.2299, 1.0000, 1.0000, 1.0000},
-    {11.3989, 2.5590, 53.2466, 0.9194, -0.3460, 0.0351, -0.1839, 1.0000, 1.0000, 1.0000},
-    {-13.9181, 3.1652, 52.9948, 0.8620, 0.4815, 0.0850, -0.1342, 1.0000, 1.0000, 1.0000},
-    {-18.3745, -67.6975, 61.5864, 0.4996, 0.8564, 0.0641, -0.1133, 1.0000, 1.0000, 1.0000},
-    {-20.3843, -73.3083, 82.0010, 0.6167, 0.7765, 0.0616, -0.1141, 1.0000, 1.0000, 1.0000},
-    {-1.8497, -0.1984, 55.4557, 0.8960, 0.4439, -0.0098, -0.0085, 1.0000, 1.0000, 1.0000},
+    {{-36.4458f, -87.3531f, 35.2604f}, {0.4718f, 0.7589f, 0.1020f, -0.4372f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.4679f, -98.8980f, 62.4587f}, {0.4718f, 0.7589f, 0.1020f, -0.4372f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-7.5346f, -67.7700f, 58.8534f}, {0.4718f, 0.7589f, 0.1020f, -0.4372f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-2.4356f, -18.7859f, 69.6121f}, {0.6167f, 0.7765f, 0.0616f, -0.1141f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{17.4998f, -60.2974f, 56.5172f}, {0.4801f, 0.0565f, 0.8578f, 0.1743f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.6222f, -58.1031f, 68.8598f}, {0.7517f, 0.0460f, -0.6552f, 0.0599f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{6.6461f, -18.3279f, 31.5468f}, {0.9042f, 0.3985f, -0.0965f, -0.1199f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.6773f, 28.3787f, 36.0724f}, {0.5712f, 0.8062f, 0.0682f, -0.1384f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3571f, 3.5801f, 13.1827f}, {0.9968f, -0.0000f, -0.0000f, -0.0800f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1876f, 55.7789f, 47.1225f}, {0.7859f, 0.6182f, 0.0082f, -0.0084f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{4.4358f, -54.2903f, 40.9365f}, {0.4135f, 0.0846f, 0.8846f, 0.1983f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-9.8567f, -47.7164f, 23.6351f}, {0.3971f, 0.3555f, 0.7018f, -0.4727f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-31.0604f, -56.2352f, 47.7104f}, {0.7182f, 0.1162f, -0.6859f, -0.0161f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-32.7076f, -54.3510f, 24.3940f}, {0.5017f, 0.0235f, -0.8336f, -0.2299f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{11.3989f, 2.5590f, 53.2466f}, {0.9194f, -0.3460f, 0.0351f, -0.1839f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.9181f, 3.1652f, 52.9948f}, {0.8620f, 0.4815f, 0.0850f, -0.1342f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.3745f, -67.6975f, 61.5864f}, {0.4996f, 0.8564f, 0.0641f, -0.1133f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.8497f, -0.1984f, 55.4557f}, {0.8960f, 0.4439f, -0.0098f, -0.0085f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-20.3843f, -73.3083f, 82.0011f}, {0.6167f, 0.7765f, 0.0616f, -0.1141f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Roll_framedata8[] = {
-    {-68.9445, -69.8319, 28.4402, 0.1799, -0.6787, -0.2845, 0.6528, 1.0000, 1.0000, 1.0000},
-    {-56.9858, -99.2751, 12.2467, 0.0955, 0.6358, 0.1581, -0.7495, 1.0000, 1.0000, 1.0000},
-    {-29.9074, -84.8068, 23.1636, 0.1799, -0.6787, -0.2845, 0.6528, 1.0000, 1.0000, 1.0000},
-    {11.5237, -77.4351, 50.9182, 0.0106, 0.8701, 0.1348, -0.4739, 1.0000, 1.0000, 1.0000},
-    {-9.2065, -79.8647, 7.8316, 0.0750, -0.5770, -0.6091, -0.5390, 1.0000, 1.0000, 1.0000},
-    {-34.2914, -90.8156, 48.1859, 0.6608, 0.5028, -0.3846, -0.4032, 1.0000, 1.0000, 1.0000},
-    {21.9051, -48.0438, 7.5882, 0.5577, 0.8262, -0.0653, -0.0463, 1.0000, 1.0000, 1.0000},
-    {10.7778, -20.8659, 69.3272, 0.2967, 0.7395, 0.3069, -0.5205, 1.0000, 1.0000, 1.0000},
-    {26.6590, -21.5034, 20.4750, 0.7702, 0.5932, 0.1406, -0.1874, 1.0000, 1.0000, 1.0000},
-    {29.6618, 0.4786, 78.3191, 0.3791, 0.7577, 0.2984, -0.4394, 1.0000, 1.0000, 1.0000},
-    {-16.3275, -68.5673, 24.2989, 0.1916, 0.5787, 0.6988, 0.3744, 1.0000, 1.0000, 1.0000},
-    {-22.4057, -46.1179, 26.7301, 0.5308, -0.0766, -0.8440, 0.0087, 1.0000, 1.0000, 1.0000},
-    {-40.3353, -70.4140, 47.8683, 0.5947, 0.5185, -0.3679, -0.4921, 1.0000, 1.0000, 1.0000},
-    {-47.1048, -47.9674, 47.3763, 0.6658, 0.0448, -0.1958, -0.7186, 1.0000, 1.0000, 1.0000},
-    {21.5535, -52.0907, 37.8074, 0.9897, 0.1003, 0.0270, -0.0983, 1.0000, 1.0000, 1.0000},
-    {6.6363, -48.8779, 58.0197, 0.4164, 0.7035, 0.4164, -0.3978, 1.0000, 1.0000, 1.0000},
-    {-36.0178, -87.3802, 32.1646, 0.1184, -0.8703, -0.0760, 0.4720, 1.0000, 1.0000, 1.0000},
-    {-35.6974, -108.4643, 34.9279, 0.0106, 0.8701, 0.1348, -0.4739, 1.0000, 1.0000, 1.0000},
-    {13.4808, -54.2534, 48.6777, 0.6470, 0.6131, 0.2760, -0.3596, 1.0000, 1.0000, 1.0000},
+    {{-68.9445f, -69.8319f, 28.4402f}, {0.1799f, -0.6787f, -0.2845f, 0.6528f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-56.9858f, -99.2751f, 12.2467f}, {0.0955f, 0.6358f, 0.1581f, -0.7495f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.9074f, -84.8068f, 23.1636f}, {0.1799f, -0.6787f, -0.2845f, 0.6528f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{11.5237f, -77.4351f, 50.9182f}, {0.0106f, 0.8701f, 0.1348f, -0.4739f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-9.2065f, -79.8647f, 7.8316f}, {0.0750f, -0.5770f, -0.6091f, -0.5390f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-34.2914f, -90.8156f, 48.1859f}, {0.6608f, 0.5028f, -0.3846f, -0.4032f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{21.9051f, -48.0439f, 7.5881f}, {0.5577f, 0.8262f, -0.0652f, -0.0463f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{10.7778f, -20.8659f, 69.3277f}, {0.2966f, 0.7395f, 0.3069f, -0.5205f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.6590f, -21.5035f, 20.4749f}, {0.7702f, 0.5932f, 0.1406f, -0.1874f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.6612f, 0.4786f, 78.3202f}, {0.3791f, 0.7577f, 0.2983f, -0.4394f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.3275f, -68.5673f, 24.2989f}, {0.1916f, 0.5787f, 0.6988f, 0.3744f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-22.4056f, -46.1179f, 26.7301f}, {0.5308f, -0.0766f, -0.8440f, 0.0087f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-40.3353f, -70.4140f, 47.8683f}, {0.5947f, 0.5185f, -0.3679f, -0.4921f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-47.1048f, -47.9674f, 47.3763f}, {0.6658f, 0.0448f, -0.1958f, -0.7186f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{21.5535f, -52.0907f, 37.8074f}, {0.9897f, 0.1003f, 0.0270f, -0.0983f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{6.6363f, -48.8779f, 58.0197f}, {0.4164f, 0.7036f, 0.4164f, -0.3978f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-36.0178f, -87.3802f, 32.1646f}, {0.1184f, -0.8703f, -0.0760f, 0.4720f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.4808f, -54.2534f, 48.6777f}, {0.6470f, 0.6131f, 0.2760f, -0.3596f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-35.6974f, -108.4643f, 34.9279f}, {0.0106f, 0.8701f, 0.1348f, -0.4739f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Roll_framedata11[] = {
-    {-51.5928, 46.1916, 33.2844, 0.7089, -0.4754, -0.5188, 0.0481, 1.0000, 1.0000, 1.0000},
-    {-34.2789, 57.5286, 4.2355, 0.2339, -0.7272, -0.4668, 0.4455, 1.0000, 1.0000, 1.0000},
-    {-17.0734, 31.6320, 13.9867, 0.7089, -0.4754, -0.5188, 0.0481, 1.0000, 1.0000, 1.0000},
-    {2.3166, -14.8945, 13.2734, 0.7099, -0.6673, -0.2181, 0.0561, 1.0000, 1.0000, 1.0000},
-    {8.8876, 32.3240, 17.6704, 0.1080, -0.5832, 0.0329, -0.8045, 1.0000, 1.0000, 1.0000},
-    {-34.9253, 14.2404, 6.2224, 0.8209, -0.4950, 0.0320, 0.2830, 1.0000, 1.0000, 1.0000},
-    {13.3002, 5.9255, 63.4616, 0.8410, -0.5042, -0.0852, -0.1770, 1.0000, 1.0000, 1.0000},
-    {-28.1084, -2.0769, 36.2870, 0.3559, -0.8093, -0.2185, 0.4131, 1.0000, 1.0000, 1.0000},
-    {13.3512, -19.5439, 47.8291, 0.2735, -0.9510, -0.1223, 0.0763, 1.0000, 1.0000, 1.0000},
-    {-3.6221, -15.3468, 47.1215, 0.6866, -0.5926, -0.3693, 0.2025, 1.0000, 1.0000, 1.0000},
-    {0.7933, 26.7062, 36.4436, 0.0293, 0.7623, 0.0911, 0.6401, 1.0000, 1.0000, 1.0000},
-    {5.4219, 31.9808, 58.7502, 0.4163, -0.2011, -0.6698, -0.5810, 1.0000, 1.0000, 1.0000},
-    {-53.3091, 4.4321, 10.5455, 0.6832, -0.5080, 0.2994, 0.4308, 1.0000, 1.0000, 1.0000},
-    {-61.7122, -1.8863, 31.5070, 0.0503, 0.8174, 0.4010, -0.4105, 1.0000, 1.0000, 1.0000},
-    {19.4456, -8.6932, 37.4182, 0.2072, 0.9570, -0.1144, 0.1680, 1.0000, 1.0000, 1.0000},
-    {-3.2858, -18.7244, 42.3213, 0.7378, 0.5161, 0.3902, 0.1923, 1.0000, 1.0000, 1.0000},
-    {-27.2806, 27.8978, 11.3703, 0.8007, -0.5602, -0.2016, 0.0667, 1.0000, 1.0000, 1.0000},
-    {-29.6938, 28.6226, -9.7467, 0.7099, -0.6673, -0.2181, 0.0561, 1.0000, 1.0000, 1.0000},
-    {6.8823, -14.0447, 36.1792, -0.0022, 0.9741, 0.2031, -0.0998, 1.0000, 1.0000, 1.0000},
+    {{-51.5928f, 46.1916f, 33.2844f}, {0.7089f, -0.4754f, -0.5188f, 0.0481f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-34.2789f, 57.5286f, 4.2355f}, {0.2339f, -0.7272f, -0.4668f, 0.4455f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-17.0734f, 31.6320f, 13.9867f}, {0.7089f, -0.4754f, -0.5188f, 0.0481f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{2.3166f, -14.8945f, 13.2734f}, {0.7099f, -0.6673f, -0.2181f, 0.0561f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{8.8876f, 32.3240f, 17.6704f}, {0.1080f, -0.5832f, 0.0329f, -0.8045f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-34.9253f, 14.2404f, 6.2224f}, {0.8209f, -0.4950f, 0.0320f, 0.2830f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.3002f, 5.9257f, 63.4617f}, {0.8410f, -0.5042f, -0.0852f, -0.1770f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-28.1076f, -2.0766f, 36.2867f}, {0.3558f, -0.8093f, -0.2185f, 0.4132f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.3511f, -19.5443f, 47.8292f}, {0.2735f, -0.9510f, -0.1223f, 0.0763f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-3.6220f, -15.3467f, 47.1215f}, {0.6866f, -0.5926f, -0.3693f, 0.2025f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.7933f, 26.7062f, 36.4436f}, {0.0293f, 0.7623f, 0.0911f, 0.6401f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{5.4219f, 31.9808f, 58.7502f}, {0.4163f, -0.2011f, -0.6698f, -0.5810f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-53.3091f, 4.4321f, 10.5455f}, {0.6832f, -0.5080f, 0.2994f, 0.4308f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-61.7122f, -1.8862f, 31.5070f}, {0.0503f, 0.8174f, 0.4010f, -0.4105f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{19.4456f, -8.6932f, 37.4182f}, {0.2072f, 0.9569f, -0.1144f, 0.1680f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-3.2858f, -18.7244f, 42.3213f}, {0.7378f, 0.5161f, 0.3902f, 0.1923f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-27.2806f, 27.8978f, 11.3703f}, {0.8007f, -0.5602f, -0.2016f, 0.0667f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{6.8823f, -14.0447f, 36.1792f}, {0.0022f, -0.9741f, -0.2031f, 0.0998f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.6938f, 28.6226f, -9.7467f}, {0.7099f, -0.6673f, -0.2181f, 0.0561f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Roll_framedata13[] = {
-    {-39.6594, 71.8850, 74.5816, 0.8117, -0.1790, -0.4524, -0.3232, 1.0000, 1.0000, 1.0000},
-    {-13.9722, 95.1685, 66.2035, 0.4653, -0.6927, -0.5274, 0.1599, 1.0000, 1.0000, 1.0000},
-    {-5.1805, 67.9021, 50.6793, 0.8117, -0.1790, -0.4524, -0.3232, 1.0000, 1.0000, 1.0000},
-    {4.0407, 36.5671, 12.2830, 0.9184, -0.3040, -0.1636, -0.1933, 1.0000, 1.0000, 1.0000},
-    {18.7330, 57.3423, 52.8369, 0.2339, -0.6405, 0.2978, -0.6681, 1.0000, 1.0000, 1.0000},
-    {-23.7761, 69.8045, 32.4576, 0.8069, -0.5445, -0.2207, 0.0605, 1.0000, 1.0000, 1.0000},
-    {9.8262, 12.8185, 61.2490, 0.7051, -0.6989, -0.0117, -0.1196, 1.0000, 1.0000, 1.0000},
-    {-30.4826, 0.3477, 43.4295, 0.8678, -0.2722, -0.2675, -0.3183, 1.0000, 1.0000, 1.0000},
-    {6.0797, -16.7281, 58.7944, 0.7336, -0.6696, -0.0417, -0.1085, 1.0000, 1.0000, 1.0000},
-    {-20.7116, -17.4297, 21.4862, 0.9246, -0.2033, -0.3206, 0.0313, 1.0000, 1.0000, 1.0000},
-    {15.0964, 42.1969, 67.2210, 0.2447, -0.5800, 0.3408, -0.6983, 1.0000, 1.0000, 1.0000},
-    {11.2293, 25.5346, 83.1661, 0.4716, -0.1704, -0.3486, -0.7918, 1.0000, 1.0000, 1.0000},
-    {-41.5845, 62.0732, 23.7431, 0.8038, -0.5307, -0.2664, 0.0360, 1.0000, 1.0000, 1.0000},
-    {-62.3490, 53.6118, 16.8760, 0.3948, -0.8199, -0.3964, -0.1216, 1.0000, 1.0000, 1.0000},
-    {16.0585, 16.6875, 31.6531, 0.0980, -0.9855, 0.0478, -0.1303, 1.0000, 1.0000, 1.0000},
-    {-8.6919, 13.9742, 27.0232, 0.3076, -0.8769, 0.0328, -0.3679, 1.0000, 1.0000, 1.0000},
-    {-14.9998, 71.0322, 46.3477, 0.9528, -0.1673, -0.1750, -0.1832, 1.0000, 1.0000, 1.0000},
-    {-12.0856, 88.4672, 34.5236, 0.9184, -0.3040, -0.1636, -0.1933, 1.0000, 1.0000, 1.0000},
-    {3.3201, 18.2977, 26.8416, 0.4301, -0.8965, -0.0883, -0.0596, 1.0000, 1.0000, 1.0000},
+    {{-39.6594f, 71.8850f, 74.5816f}, {0.8117f, -0.1790f, -0.4524f, -0.3232f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.9722f, 95.1685f, 66.2035f}, {0.4653f, -0.6927f, -0.5274f, 0.1599f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-5.1805f, 67.9021f, 50.6793f}, {0.8117f, -0.1790f, -0.4524f, -0.3232f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{4.0407f, 36.5671f, 12.2830f}, {0.9184f, -0.3040f, -0.1636f, -0.1933f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{18.7330f, 57.3423f, 52.8369f}, {0.2339f, -0.6405f, 0.2978f, -0.6681f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-23.7761f, 69.8045f, 32.4576f}, {0.8069f, -0.5445f, -0.2207f, 0.0605f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{9.8262f, 12.8187f, 61.2492f}, {0.7051f, -0.6989f, -0.0117f, -0.1196f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.4826f, 0.3473f, 43.4299f}, {0.8678f, -0.2722f, -0.2676f, -0.3183f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{6.0797f, -16.7283f, 58.7943f}, {0.7336f, -0.6696f, -0.0417f, -0.1085f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-20.7123f, -17.4301f, 21.4856f}, {0.9246f, -0.2033f, -0.3206f, 0.0313f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.0964f, 42.1969f, 67.2210f}, {0.2447f, -0.5800f, 0.3408f, -0.6983f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{11.2293f, 25.5346f, 83.1660f}, {0.4716f, -0.1704f, -0.3486f, -0.7918f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-41.5845f, 62.0732f, 23.7431f}, {0.8038f, -0.5307f, -0.2664f, 0.0360f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-62.3490f, 53.6118f, 16.8760f}, {0.3948f, -0.8199f, -0.3964f, -0.1216f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{16.0585f, 16.6875f, 31.6532f}, {0.0980f, -0.9855f, 0.0477f, -0.1302f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-8.6919f, 13.9742f, 27.0232f}, {0.3076f, -0.8769f, 0.0328f, -0.3679f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.9998f, 71.0322f, 46.3477f}, {0.9528f, -0.1673f, -0.1750f, -0.1832f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{3.3201f, 18.2977f, 26.8416f}, {0.4301f, -0.8965f, -0.0883f, -0.0596f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.0856f, 88.4672f, 34.5236f}, {0.9184f, -0.3040f, -0.1636f, -0.1933f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Roll_framedata17[] = {
-    {-1.0559, 22.7101, 92.6032, 0.9668, 0.2262, 0.0150, -0.1178, 1.0000, 1.0000, 1.0000},
-    {1.6111, 57.0057, 102.0292, 0.8807, -0.0390, -0.4226, 0.2105, 1.0000, 1.0000, 1.0000},
-    {-0.8618, 57.9897, 69.5535, 0.9668, 0.2262, 0.0150, -0.1178, 1.0000, 1.0000, 1.0000},
-    {2.8918, 55.0499, 19.3692, 0.9774, -0.0209, -0.0425, -0.2058, 1.0000, 1.0000, 1.0000},
-    {22.9189, 49.4648, 62.4948, 0.4276, -0.0694, 0.8390, -0.3292, 1.0000, 1.0000, 1.0000},
-    {-21.5347, 68.9979, 58.0256, 0.6971, 0.1634, -0.6647, 0.2134, 1.0000, 1.0000, 1.0000},
-    {9.8051, 8.4046, 33.8743, 0.9268, -0.3488, 0.0416, -0.1329, 1.0000, 1.0000, 1.0000},
-    {-12.3022, -0.1381, 5.0943, 0.6797, 0.1613, -0.7135, 0.0537, 1.0000, 1.0000, 1.0000},
-    {5.5463, -9.3027, 10.1809, 0.8991, 0.0686, -0.0250, -0.4317, 1.0000, 1.0000, 1.0000},
-    {15.5362, 10.5402, 7.0988, 0.6741, 0.3454, -0.5717, 0.3153, 1.0000, 1.0000, 1.0000},
-    {8.3201, 42.9017, 48.5911, 0.6453, -0.5112, 0.4342, -0.3656, 1.0000, 1.0000, 1.0000},
-    {17.4617, 21.6138, 45.4152, 0.5293, -0.0650, -0.0634, -0.8436, 1.0000, 1.0000, 1.0000},
-    {-21.7121, 70.1438, 36.7768, 0.7074, 0.0720, -0.6367, 0.2982, 1.0000, 1.0000, 1.0000},
-    {-21.2895, 60.2395, 15.5249, 0.5537, -0.5068, -0.5107, -0.4192, 1.0000, 1.0000, 1.0000},
-    {16.1300, 28.8333, 12.1396, 0.3974, -0.9048, 0.1158, -0.0997, 1.0000, 1.0000, 1.0000},
-    {-8.8673, 29.9940, 8.2446, 0.4680, -0.4784, -0.5007, -0.5490, 1.0000, 1.0000, 1.0000},
-    {-11.0785, 62.4904, 68.9702, 0.9693, 0.1203, -0.0530, -0.2079, 1.0000, 1.0000, 1.0000},
-    {-9.3079, 83.6825, 69.1654, 0.9774, -0.0209, -0.0425, -0.2058, 1.0000, 1.0000, 1.0000},
-    {3.1085, 33.0694, 11.4287, 0.8160, -0.5724, -0.0500, -0.0631, 1.0000, 1.0000, 1.0000},
+    {{-1.0559f, 22.7101f, 92.6032f}, {0.9668f, 0.2262f, 0.0150f, -0.1178f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.6111f, 57.0057f, 102.0292f}, {0.8807f, -0.0390f, -0.4226f, 0.2105f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.8618f, 57.9897f, 69.5535f}, {0.9668f, 0.2262f, 0.0150f, -0.1178f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{2.8918f, 55.0499f, 19.3692f}, {0.9774f, -0.0209f, -0.0425f, -0.2058f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{22.9190f, 49.4648f, 62.4948f}, {0.4276f, -0.0694f, 0.8390f, -0.3292f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-21.5347f, 68.9979f, 58.0256f}, {0.6971f, 0.1634f, -0.6647f, 0.2134f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{9.8052f, 8.4046f, 33.8744f}, {0.9268f, -0.3488f, 0.0416f, -0.1329f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.3024f, -0.1390f, 5.0945f}, {0.6797f, 0.1613f, -0.7136f, 0.0537f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{5.5463f, -9.3029f, 10.1807f}, {0.8991f, 0.0686f, -0.0250f, -0.4317f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.5363f, 10.5398f, 7.0998f}, {0.6741f, 0.3454f, -0.5718f, 0.3153f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{8.3201f, 42.9017f, 48.5911f}, {0.6453f, -0.5112f, 0.4342f, -0.3656f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{17.4617f, 21.6138f, 45.4152f}, {0.5293f, -0.0650f, -0.0634f, -0.8436f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-21.7121f, 70.1437f, 36.7768f}, {0.7074f, 0.0720f, -0.6367f, 0.2982f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-21.2895f, 60.2395f, 15.5249f}, {0.5537f, -0.5068f, -0.5107f, -0.4192f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{16.1300f, 28.8333f, 12.1396f}, {0.3974f, -0.9048f, 0.1158f, -0.0997f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-8.8673f, 29.9939f, 8.2445f}, {0.4680f, -0.4784f, -0.5007f, -0.5491f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.0785f, 62.4904f, 68.9702f}, {0.9693f, 0.1203f, -0.0530f, -0.2079f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{3.1085f, 33.0694f, 11.4287f}, {0.8160f, -0.5724f, -0.0500f, -0.0631f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-9.3079f, 83.6825f, 69.1655f}, {0.9774f, -0.0209f, -0.0425f, -0.2058f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Roll_framedata20[] = {
-    {34.4672, -36.9205, 104.7143, 0.9048, 0.3612, 0.2137, -0.0722, 1.0000, 1.0000, 1.0000},
-    {36.8866, -7.2736, 124.3956, 0.9545, 0.2904, -0.0276, 0.0620, 1.0000, 1.0000, 1.0000},
-    {23.1216, 2.8572, 96.6531, 0.9048, 0.3612, 0.2137, -0.0722, 1.0000, 1.0000, 1.0000},
-    {7.5086, 23.4002, 53.3471, 0.9578, 0.1917, 0.1836, -0.1098, 1.0000, 1.0000, 1.0000},
-    {43.0080, 5.0097, 79.6849, 0.4015, 0.1821, 0.8976, 0.0062, 1.0000, 1.0000, 1.0000},
-    {-1.2878, 11.8354, 98.8926, 0.7851, 0.2321, -0.5696, -0.0729, 1.0000, 1.0000, 1.0000},
-    {20.1090, -5.9649, 39.6376, 0.9749, 0.0670, -0.0921, 0.1914, 1.0000, 1.0000, 1.0000},
-    {-13.8376, -10.9333, 24.2406, 0.8490, 0.4663, -0.2486, 0.0045, 1.0000, 1.0000, 1.0000},
-    {24.3476, 0.8555, 10.8523, 0.9963, 0.0208, 0.0104, 0.0830, 1.0000, 1.0000, 1.0000},
-    {-2.1554, 13.9042, 12.4226, 0.9700, 0.0135, -0.1830, -0.1596, 1.0000, 1.0000, 1.0000},
-    {28.9367, 13.2385, 66.1277, 0.7245, -0.1016, 0.6579, -0.1786, 1.0000, 1.0000, 1.0000},
-    {31.3692, 2.9781, 45.2557, 0.6618, 0.0507, 0.4495, -0.5978, 1.0000, 1.0000, 1.0000},
-    {-7.1657, 22.3150, 81.3290, 0.8217, 0.1677, -0.5440, 0.0286, 1.0000, 1.0000, 1.0000},
-    {-16.6465, 23.0733, 59.8941, 0.7816, -0.3684, -0.3278, -0.3821, 1.0000, 1.0000, 1.0000},
-    {13.8816, 19.4845, 24.0404, 0.5262, -0.8232, -0.2114, -0.0289, 1.0000, 1.0000, 1.0000},
-    {-10.6849, 18.8108, 30.1572, 0.7432, -0.6015, -0.1755, -0.2348, 1.0000, 1.0000, 1.0000},
-    {13.1111, 4.2406, 101.4336, 0.9169, 0.3239, 0.1861, -0.1403, 1.0000, 1.0000, 1.0000},
-    {12.9246, 22.7998, 111.8161, 0.9578, 0.1917, 0.1836, -0.1098, 1.0000, 1.0000, 1.0000},
-    {2.0259, 19.7396, 30.9242, 0.9895, -0.0764, 0.1203, 0.0227, 1.0000, 1.0000, 1.0000},
+    {{34.4672f, -36.9205f, 104.7143f}, {0.9048f, 0.3612f, 0.2137f, -0.0722f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{36.8866f, -7.2736f, 124.3956f}, {0.9545f, 0.2904f, -0.0276f, 0.0620f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.1216f, 2.8572f, 96.6531f}, {0.9048f, 0.3612f, 0.2137f, -0.0722f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{7.5086f, 23.4002f, 53.3471f}, {0.9578f, 0.1917f, 0.1836f, -0.1098f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{43.0080f, 5.0097f, 79.6849f}, {0.4015f, 0.1821f, 0.8976f, 0.0062f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.2878f, 11.8354f, 98.8926f}, {0.7851f, 0.2321f, -0.5696f, -0.0729f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{20.1090f, -5.9650f, 39.6378f}, {0.9749f, 0.0670f, -0.0921f, 0.1914f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.8366f, -10.9344f, 24.2403f}, {0.8490f, 0.4663f, -0.2486f, 0.0045f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.3477f, 0.8554f, 10.8522f}, {0.9963f, 0.0208f, 0.0104f, 0.0830f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-2.1551f, 13.9037f, 12.4224f}, {0.9700f, 0.0135f, -0.1830f, -0.1596f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.9367f, 13.2385f, 66.1276f}, {0.7245f, -0.1016f, 0.6579f, -0.1786f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{31.3692f, 2.9781f, 45.2557f}, {0.6618f, 0.0507f, 0.4495f, -0.5978f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-7.1658f, 22.3149f, 81.3289f}, {0.8217f, 0.1677f, -0.5440f, 0.0286f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.6467f, 23.0733f, 59.8940f}, {0.7816f, -0.3684f, -0.3278f, -0.3821f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.8816f, 19.4845f, 24.0404f}, {0.5262f, -0.8232f, -0.2115f, -0.0289f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.6849f, 18.8109f, 30.1572f}, {0.7432f, -0.6015f, -0.1755f, -0.2348f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1111f, 4.2406f, 101.4336f}, {0.9169f, 0.3239f, 0.1861f, -0.1403f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{2.0259f, 19.7396f, 30.9242f}, {0.9895f, -0.0764f, 0.1203f, 0.0227f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.9246f, 22.7998f, 111.8162f}, {0.9578f, 0.1917f, 0.1836f, -0.1098f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Roll_framedata25[] = {
-    {5.1380, -24.2262, 183.8474, 0.9986, 0.0485, -0.0173, -0.0098, 1.0000, 1.0000, 1.0000},
-    {0.2364, 10.9254, 180.3139, 0.9986, 0.0485, -0.0173, -0.0098, 1.0000, 1.0000, 1.0000},
-    {1.0879, 0.0228, 149.6193, 0.9986, 0.0485, -0.0173, -0.0098, 1.0000, 1.0000, 1.0000},
-    {-0.0852, 5.2250, 99.4920, 0.9984, 0.0514, 0.0127, -0.0197, 1.0000, 1.0000, 1.0000},
-    {25.3732, 2.0202, 139.9109, 0.7415, 0.0778, 0.6525, -0.1354, 1.0000, 1.0000, 1.0000},
-    {-23.3344, 3.8750, 141.2433, 0.7058, 0.1454, -0.6872, 0.0920, 1.0000, 1.0000, 1.0000},
-    {14.7298, 1.9081, 42.2635, 0.9961, 0.0839, -0.0125, 0.0235, 1.0000, 1.0000, 1.0000},
-    {-13.5049, 0.6510, 41.9317, 0.9940, 0.1024, 0.0243, -0.0302, 1.0000, 1.0000, 1.0000},
-    {15.6711, 8.7773, 13.1947, 0.9997, -0.0136, 0.0109, 0.0183, 1.0000, 1.0000, 1.0000},
-    {-15.0078, 8.6470, 13.1768, 0.9998, -0.0080, -0.0002, 0.0198, 1.0000, 1.0000, 1.0000},
-    {26.0490, 1.5109, 118.7261, 0.7017, 0.1174, 0.6960, -0.0968, 1.0000, 1.0000, 1.0000},
-    {26.8993, 0.8153, 95.3675, 0.7113, 0.1717, 0.6809, -0.0296, 1.0000, 1.0000, 1.0000},
-    {-23.2243, 8.0643, 120.3796, 0.7311, 0.0588, -0.6561, 0.1776, 1.0000, 1.0000, 1.0000},
-    {-24.7756, 1.4263, 97.9419, 0.6807, -0.3768, -0.5395, -0.3219, 1.0000, 1.0000, 1.0000},
-    {13.2929, 6.3845, 72.3901, 0.9991, -0.0430, 0.0061, 0.0024, 1.0000, 1.0000, 1.0000},
-    {-11.9622, 4.5136, 72.1375, 0.9988, -0.0341, -0.0062, -0.0340, 1.0000, 1.0000, 1.0000},
-    {-10.0602, 0.4020, 150.3646, 0.9807, 0.1908, 0.0288, -0.0302, 1.0000, 1.0000, 1.0000},
-    {-16.0631, 20.4960, 153.8962, 0.9984, 0.0514, 0.0127, -0.0197, 1.0000, 1.0000, 1.0000},
-    {0.1366, 5.3860, 76.1217, 0.9993, 0.0033, -0.0049, 0.0370, 1.0000, 1.0000, 1.0000},
+    {{5.1380f, -24.2262f, 183.8474f}, {0.9986f, 0.0485f, -0.0173f, -0.0098f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.2364f, 10.9254f, 180.3139f}, {0.9986f, 0.0485f, -0.0173f, -0.0098f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.0879f, 0.0228f, 149.6193f}, {0.9986f, 0.0485f, -0.0173f, -0.0098f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0852f, 5.2250f, 99.4920f}, {0.9984f, 0.0514f, 0.0127f, -0.0197f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{25.3732f, 2.0202f, 139.9109f}, {0.7415f, 0.0778f, 0.6525f, -0.1354f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-23.3344f, 3.8749f, 141.2433f}, {0.7058f, 0.1454f, -0.6872f, 0.0920f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.7298f, 1.9079f, 42.2635f}, {0.9961f, 0.0839f, -0.0125f, 0.0235f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.5047f, 0.6508f, 41.9316f}, {0.9940f, 0.1024f, 0.0243f, -0.0302f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.6711f, 8.7773f, 13.1947f}, {0.9997f, -0.0136f, 0.0109f, 0.0183f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-15.0079f, 8.6468f, 13.1769f}, {0.9998f, -0.0080f, -0.0003f, 0.0199f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.0490f, 1.5109f, 118.7261f}, {0.7017f, 0.1174f, 0.6960f, -0.0968f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.8992f, 0.8153f, 95.3675f}, {0.7113f, 0.1717f, 0.6809f, -0.0296f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-23.2243f, 8.0642f, 120.3796f}, {0.7311f, 0.0588f, -0.6561f, 0.1776f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.7756f, 1.4264f, 97.9419f}, {0.6807f, -0.3768f, -0.5395f, -0.3219f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.2929f, 6.3845f, 72.3901f}, {0.9991f, -0.0430f, 0.0061f, 0.0024f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.9622f, 4.5136f, 72.1375f}, {0.9988f, -0.0341f, -0.0062f, -0.0340f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.0602f, 0.4020f, 150.3646f}, {0.9807f, 0.1908f, 0.0288f, -0.0302f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.1366f, 5.3860f, 76.1217f}, {0.9993f, 0.0033f, -0.0049f, 0.0370f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.0631f, 20.4960f, 153.8962f}, {0.9984f, 0.0514f, 0.0127f, -0.0197f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64KeyFrame anim_Catherine_Roll_keyframes[] = {
     {0, anim_Catherine_Roll_framedata0},
@@ -1480,153 +1719,157 @@ static s64KeyFrame anim_Catherine_Roll_keyframes[] = {
     {20, anim_Catherine_Roll_framedata20},
     {25, anim_Catherine_Roll_framedata25},
 };
+static u16 anim_Catherine_Roll_framelookup[] = {
+    0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 4, 4, 4,
+    4, 5, 5, 5, 6, 6, 6, 6, 6, 7,
+};
 
 static s64Transform anim_Catherine_Run_framedata0[] = {
-    {11.4697, -68.3174, 159.7529, 0.9879, 0.0352, -0.0272, 0.1487, 1.0000, 1.0000, 1.0000},
-    {-4.5924, -37.7428, 168.6606, 0.9823, -0.0339, -0.0999, 0.1547, 1.0000, 1.0000, 1.0000},
-    {-0.3100, -35.2345, 136.4562, 0.9576, 0.2428, -0.0382, 0.1502, 1.0000, 1.0000, 1.0000},
-    {-0.3011, -11.2179, 92.1348, 0.9263, 0.2348, -0.0725, 0.2856, 1.0000, 1.0000, 1.0000},
-    {18.7809, -17.2659, 135.6249, 0.2327, 0.6082, 0.7575, -0.0470, 1.0000, 1.0000, 1.0000},
-    {-21.5160, -41.4019, 122.5382, 0.4092, 0.3222, -0.5760, 0.6300, 1.0000, 1.0000, 1.0000},
-    {15.2485, -28.0253, 61.4696, 0.9992, 0.0260, -0.0225, 0.0213, 1.0000, 1.0000, 1.0000},
-    {-14.0346, 23.3332, 46.6474, 0.9130, 0.4077, 0.0032, -0.0137, 1.0000, 1.0000, 1.0000},
-    {16.8869, -24.5543, 31.8328, 0.8264, 0.5621, -0.0331, 0.0009, 1.0000, 1.0000, 1.0000},
-    {-14.1888, 46.8161, 28.1658, 0.6602, 0.7506, 0.0170, -0.0201, 1.0000, 1.0000, 1.0000},
-    {15.9195, 2.6922, 129.0679, 0.1829, 0.6442, 0.7426, 0.0032, 1.0000, 1.0000, 1.0000},
-    {12.7113, 24.6473, 121.6845, 0.8069, 0.0545, 0.5865, 0.0432, 1.0000, 1.0000, 1.0000},
-    {-13.7578, -42.7001, 102.7650, 0.2867, 0.0199, -0.5780, 0.7638, 1.0000, 1.0000, 1.0000},
-    {6.6156, -52.5258, 96.5763, 0.0095, -0.3433, -0.6392, 0.6881, 1.0000, 1.0000, 1.0000},
-    {12.8592, 1.6346, 68.1254, 0.7996, -0.6004, -0.0085, 0.0053, 1.0000, 1.0000, 1.0000},
-    {-12.4649, 1.8710, 68.2484, 0.9123, 0.4092, 0.0026, -0.0140, 1.0000, 1.0000, 1.0000},
-    {-9.5416, -40.9747, 133.8473, 0.9273, 0.2113, -0.0179, 0.3084, 1.0000, 1.0000, 1.0000},
-    {-26.5201, -30.3899, 141.0563, 0.9263, 0.2348, -0.0725, 0.2856, 1.0000, 1.0000, 1.0000},
-    {-0.2970, -0.0831, 71.5858, 0.9693, 0.2457, 0.0012, -0.0051, 1.0000, 1.0000, 1.0000},
+    {{11.4697f, -68.3174f, 159.7529f}, {0.9879f, 0.0352f, -0.0272f, 0.1487f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-4.5924f, -37.7428f, 168.6606f}, {0.9823f, -0.0339f, -0.0999f, 0.1547f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3100f, -35.2345f, 136.4562f}, {0.9576f, 0.2428f, -0.0382f, 0.1502f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3011f, -11.2179f, 92.1348f}, {0.9263f, 0.2348f, -0.0725f, 0.2856f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{18.7809f, -17.2660f, 135.6249f}, {0.2327f, 0.6082f, 0.7575f, -0.0470f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-21.5160f, -41.4019f, 122.5382f}, {0.4092f, 0.3222f, -0.5760f, 0.6300f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.2485f, -28.0254f, 61.4697f}, {0.9992f, 0.0260f, -0.0225f, 0.0213f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.0348f, 23.3333f, 46.6476f}, {0.9130f, 0.4077f, 0.0032f, -0.0137f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{16.8869f, -24.5545f, 31.8330f}, {0.8264f, 0.5621f, -0.0331f, 0.0009f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.1896f, 46.8159f, 28.1659f}, {0.6602f, 0.7506f, 0.0170f, -0.0201f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.9195f, 2.6922f, 129.0680f}, {0.1829f, 0.6442f, 0.7426f, 0.0032f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.7113f, 24.6472f, 121.6845f}, {0.8069f, 0.0545f, 0.5865f, 0.0432f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.7578f, -42.7001f, 102.7650f}, {0.2867f, 0.0199f, -0.5780f, 0.7638f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{6.6156f, -52.5258f, 96.5763f}, {0.0095f, -0.3433f, -0.6392f, 0.6881f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8592f, 1.6346f, 68.1254f}, {0.7996f, -0.6004f, -0.0085f, 0.0053f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.4649f, 1.8710f, 68.2484f}, {0.9123f, 0.4093f, 0.0026f, -0.0141f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-9.5416f, -40.9747f, 133.8473f}, {0.9273f, 0.2113f, -0.0179f, 0.3084f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.2970f, -0.0831f, 71.5858f}, {0.9693f, 0.2457f, 0.0012f, -0.0051f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.5201f, -30.3899f, 141.0563f}, {0.9263f, 0.2348f, -0.0725f, 0.2856f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Run_framedata1[] = {
-    {11.4506, -70.2140, 149.2987, 0.9888, 0.0680, -0.0188, 0.1319, 1.0000, 1.0000, 1.0000},
-    {-3.3179, -38.6749, 157.0004, 0.9856, -0.0801, -0.0729, 0.1297, 1.0000, 1.0000, 1.0000},
-    {0.4259, -37.8648, 124.6418, 0.9661, 0.2203, -0.0301, 0.1312, 1.0000, 1.0000, 1.0000},
-    {-0.3315, -12.1251, 81.3050, 0.9441, 0.2608, -0.0462, 0.1962, 1.0000, 1.0000, 1.0000},
-    {21.9661, -23.0928, 122.2271, 0.2485, 0.6666, 0.7023, 0.0255, 1.0000, 1.0000, 1.0000},
-    {-22.8324, -39.9813, 112.9792, 0.4587, 0.3645, -0.5439, 0.6007, 1.0000, 1.0000, 1.0000},
-    {14.3915, -23.5152, 38.8682, 0.9458, -0.3234, 0.0018, 0.0293, 1.0000, 1.0000, 1.0000},
-    {-13.8206, 15.9307, 30.8870, 0.7020, 0.7000, -0.1260, 0.0349, 1.0000, 1.0000, 1.0000},
-    {15.1604, -40.2579, 14.1263, 0.9793, -0.2006, -0.0246, 0.0034, 1.0000, 1.0000, 1.0000},
-    {-10.7856, 45.5840, 33.0153, 0.6220, 0.7816, 0.0189, -0.0430, 1.0000, 1.0000, 1.0000},
-    {22.3640, -2.3630, 117.7970, 0.3090, 0.6242, 0.7162, -0.0441, 1.0000, 1.0000, 1.0000},
-    {21.0095, 17.2088, 105.0714, 0.7738, 0.1186, 0.6221, -0.0133, 1.0000, 1.0000, 1.0000},
-    {-18.2568, -41.4650, 92.2495, 0.3613, 0.1345, -0.5580, 0.7349, 1.0000, 1.0000, 1.0000},
-    {-0.3882, -50.6338, 80.1432, 0.1396, -0.3335, -0.6629, 0.6556, 1.0000, 1.0000, 1.0000},
-    {12.8287, 0.7275, 57.2956, 0.9063, -0.4186, 0.0304, 0.0489, 1.0000, 1.0000, 1.0000},
-    {-12.4954, 0.9639, 57.4186, 0.9529, 0.2875, -0.0280, 0.0929, 1.0000, 1.0000, 1.0000},
-    {-9.8303, -41.9598, 122.9037, 0.9458, 0.2381, 0.0148, 0.2205, 1.0000, 1.0000, 1.0000},
-    {-24.0377, -29.1882, 132.2479, 0.9441, 0.2608, -0.0462, 0.1962, 1.0000, 1.0000, 1.0000},
-    {-0.3274, -0.9902, 60.7560, 0.9693, 0.2457, 0.0012, -0.0051, 1.0000, 1.0000, 1.0000},
+    {{11.4506f, -70.2140f, 149.2987f}, {0.9888f, 0.0680f, -0.0188f, 0.1319f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-3.3179f, -38.6749f, 157.0004f}, {0.9856f, -0.0801f, -0.0729f, 0.1297f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.4259f, -37.8648f, 124.6418f}, {0.9661f, 0.2203f, -0.0301f, 0.1312f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3315f, -12.1251f, 81.3050f}, {0.9441f, 0.2608f, -0.0462f, 0.1962f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{21.9661f, -23.0928f, 122.2271f}, {0.2485f, 0.6666f, 0.7023f, 0.0255f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-22.8324f, -39.9813f, 112.9792f}, {0.4587f, 0.3645f, -0.5439f, 0.6007f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.3915f, -23.5152f, 38.8683f}, {0.9458f, -0.3234f, 0.0018f, 0.0293f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.8207f, 15.9308f, 30.8870f}, {0.7020f, 0.7000f, -0.1260f, 0.0349f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.1605f, -40.2580f, 14.1264f}, {0.9793f, -0.2007f, -0.0246f, 0.0034f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.7867f, 45.5834f, 33.0150f}, {0.6220f, 0.7816f, 0.0188f, -0.0430f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{22.3640f, -2.3630f, 117.7970f}, {0.3090f, 0.6242f, 0.7162f, -0.0441f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{21.0095f, 17.2088f, 105.0714f}, {0.7738f, 0.1186f, 0.6221f, -0.0133f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.2569f, -41.4650f, 92.2495f}, {0.3613f, 0.1345f, -0.5580f, 0.7349f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3882f, -50.6338f, 80.1431f}, {0.1396f, -0.3335f, -0.6629f, 0.6556f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8287f, 0.7275f, 57.2956f}, {0.9063f, -0.4186f, 0.0304f, 0.0489f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.4954f, 0.9639f, 57.4186f}, {0.9529f, 0.2875f, -0.0279f, 0.0929f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-9.8303f, -41.9598f, 122.9037f}, {0.9458f, 0.2381f, 0.0148f, 0.2205f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3274f, -0.9902f, 60.7560f}, {0.9693f, 0.2457f, 0.0012f, -0.0051f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.0377f, -29.1882f, 132.2479f}, {0.9441f, 0.2608f, -0.0462f, 0.1962f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Run_framedata3[] = {
-    {10.1486, -80.3628, 143.2869, 0.9747, 0.2159, 0.0494, 0.0291, 1.0000, 1.0000, 1.0000},
-    {2.3756, -46.3934, 150.8895, 0.9805, -0.1757, 0.0823, 0.0321, 1.0000, 1.0000, 1.0000},
-    {-0.3708, -47.9759, 118.4594, 0.9791, 0.1947, 0.0515, 0.0294, 1.0000, 1.0000, 1.0000},
-    {-0.3619, -14.0529, 81.1711, 0.9199, 0.3558, 0.0594, -0.1537, 1.0000, 1.0000, 1.0000},
-    {23.3944, -46.2181, 107.4984, 0.4094, 0.6069, 0.6808, -0.0258, 1.0000, 1.0000, 1.0000},
-    {-22.7176, -34.4861, 118.1606, 0.4247, 0.5568, -0.5140, 0.4954, 1.0000, 1.0000, 1.0000},
-    {14.6283, -8.1773, 28.9244, 0.8881, 0.4594, -0.0126, 0.0092, 1.0000, 1.0000, 1.0000},
-    {-16.5166, 10.5855, 29.6992, 0.4633, 0.8809, -0.0966, -0.0021, 1.0000, 1.0000, 1.0000},
-    {15.4027, 17.2503, 13.2433, 0.9977, 0.0628, -0.0033, -0.0261, 1.0000, 1.0000, 1.0000},
-    {-14.4224, 33.9240, 48.2459, 0.4911, 0.8694, -0.0048, -0.0541, 1.0000, 1.0000, 1.0000},
-    {24.6666, -27.8673, 96.9562, 0.5252, 0.4969, 0.6644, -0.1890, 1.0000, 1.0000, 1.0000},
-    {25.2547, -18.2935, 75.6295, 0.5739, 0.3608, 0.7053, -0.2074, 1.0000, 1.0000, 1.0000},
-    {-24.7616, -29.8024, 97.5029, 0.4085, 0.5627, -0.5157, 0.5006, 1.0000, 1.0000, 1.0000},
-    {-21.5775, -26.0809, 74.5698, 0.5953, -0.2863, -0.6718, 0.3352, 1.0000, 1.0000, 1.0000},
-    {12.7983, 0.4407, 58.1153, 0.9934, -0.1134, 0.0022, 0.0165, 1.0000, 1.0000, 1.0000},
-    {-12.5258, 0.6680, 58.2544, 0.9699, 0.2069, 0.0201, 0.1268, 1.0000, 1.0000, 1.0000},
-    {-10.9346, -45.5861, 121.2294, 0.9148, 0.3523, 0.1509, -0.1272, 1.0000, 1.0000, 1.0000},
-    {-10.8882, -30.7581, 136.4744, 0.9199, 0.3558, 0.0594, -0.1537, 1.0000, 1.0000, 1.0000},
-    {-0.3578, -1.5138, 61.4476, 0.9602, 0.2794, 0.0014, -0.0051, 1.0000, 1.0000, 1.0000},
+    {{10.1486f, -80.3628f, 143.2869f}, {0.9747f, 0.2159f, 0.0494f, 0.0291f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{2.3756f, -46.3934f, 150.8895f}, {0.9805f, -0.1757f, 0.0823f, 0.0321f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3708f, -47.9759f, 118.4594f}, {0.9791f, 0.1947f, 0.0515f, 0.0294f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3619f, -14.0529f, 81.1711f}, {0.9199f, 0.3558f, 0.0594f, -0.1537f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.3944f, -46.2181f, 107.4984f}, {0.4094f, 0.6069f, 0.6808f, -0.0258f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-22.7176f, -34.4861f, 118.1606f}, {0.4247f, 0.5568f, -0.5140f, 0.4954f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.6283f, -8.1775f, 28.9244f}, {0.8881f, 0.4594f, -0.0126f, 0.0092f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.5164f, 10.5859f, 29.6990f}, {0.4633f, 0.8810f, -0.0965f, -0.0021f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.4027f, 17.2502f, 13.2431f}, {0.9977f, 0.0628f, -0.0033f, -0.0261f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4233f, 33.9236f, 48.2462f}, {0.4911f, 0.8694f, -0.0049f, -0.0541f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.6666f, -27.8673f, 96.9562f}, {0.5252f, 0.4969f, 0.6644f, -0.1890f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{25.2547f, -18.2935f, 75.6295f}, {0.5739f, 0.3608f, 0.7053f, -0.2074f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.7617f, -29.8024f, 97.5029f}, {0.4085f, 0.5627f, -0.5157f, 0.5006f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-21.5776f, -26.0809f, 74.5698f}, {0.5953f, -0.2863f, -0.6718f, 0.3352f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.7983f, 0.4407f, 58.1152f}, {0.9934f, -0.1134f, 0.0022f, 0.0165f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.5258f, 0.6680f, 58.2544f}, {0.9699f, 0.2069f, 0.0201f, 0.1269f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.9346f, -45.5861f, 121.2294f}, {0.9148f, 0.3523f, 0.1509f, -0.1272f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3578f, -1.5138f, 61.4476f}, {0.9602f, 0.2794f, 0.0014f, -0.0051f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.8882f, -30.7582f, 136.4744f}, {0.9199f, 0.3558f, 0.0594f, -0.1537f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Run_framedata8[] = {
-    {3.3389, -65.2860, 171.7510, 0.9920, -0.0446, 0.0577, -0.1033, 1.0000, 1.0000, 1.0000},
-    {4.5837, -29.7230, 174.1726, 0.9961, -0.0401, 0.0381, -0.0692, 1.0000, 1.0000, 1.0000},
-    {-0.3100, -35.2345, 142.4326, 0.9857, 0.1256, 0.0475, -0.1014, 1.0000, 1.0000, 1.0000},
-    {-0.3011, -11.2179, 98.1111, 0.9311, 0.2361, 0.0682, -0.2695, 1.0000, 1.0000, 1.0000},
-    {21.4186, -40.8159, 128.8408, 0.4300, 0.3693, 0.7249, -0.3916, 1.0000, 1.0000, 1.0000},
-    {-19.8061, -17.9162, 141.2412, 0.5253, 0.4257, -0.6801, -0.2833, 1.0000, 1.0000, 1.0000},
-    {13.8368, 22.6831, 52.0627, 0.9370, 0.3456, 0.0121, -0.0505, 1.0000, 1.0000, 1.0000},
-    {-12.2556, -25.6414, 61.0834, 0.9946, 0.0397, -0.0002, 0.0962, 1.0000, 1.0000, 1.0000},
-    {14.8058, 43.4166, 30.5628, 0.7101, 0.7033, 0.0194, -0.0286, 1.0000, 1.0000, 1.0000},
-    {-13.1966, -21.4901, 31.5044, 0.8536, 0.5206, -0.0055, 0.0203, 1.0000, 1.0000, 1.0000},
-    {14.0709, -34.3452, 110.0351, 0.5750, -0.2148, 0.4503, -0.6485, 1.0000, 1.0000, 1.0000},
-    {8.4476, -56.6528, 105.8419, 0.0676, -0.4831, 0.2518, -0.8359, 1.0000, 1.0000, 1.0000},
-    {-16.9460, 1.7574, 133.6502, 0.4247, 0.5111, -0.6817, -0.3060, 1.0000, 1.0000, 1.0000},
-    {-13.7375, 23.3821, 125.1652, 0.7157, -0.0898, -0.6741, 0.1593, 1.0000, 1.0000, 1.0000},
-    {12.8592, 1.6346, 74.1018, 0.9158, 0.4011, 0.0180, -0.0105, 1.0000, 1.0000, 1.0000},
-    {-12.4649, 1.8710, 74.2248, 0.8596, -0.5026, 0.0223, 0.0894, 1.0000, 1.0000, 1.0000},
-    {-9.7542, -30.1994, 145.6625, 0.8784, 0.2840, 0.1811, -0.3390, 1.0000, 1.0000, 1.0000},
-    {-4.8229, -12.6657, 156.6413, 0.9311, 0.2361, 0.0682, -0.2695, 1.0000, 1.0000, 1.0000},
-    {-0.2970, -0.0831, 77.5622, 0.9693, 0.2457, 0.0012, -0.0051, 1.0000, 1.0000, 1.0000},
+    {{3.3389f, -65.2860f, 171.7510f}, {0.9920f, -0.0446f, 0.0577f, -0.1033f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{4.5837f, -29.7230f, 174.1726f}, {0.9961f, -0.0401f, 0.0381f, -0.0692f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3100f, -35.2345f, 142.4326f}, {0.9857f, 0.1256f, 0.0475f, -0.1014f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3011f, -11.2179f, 98.1111f}, {0.9311f, 0.2361f, 0.0682f, -0.2695f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{21.4186f, -40.8159f, 128.8408f}, {0.4300f, 0.3693f, 0.7249f, -0.3916f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.8061f, -17.9162f, 141.2412f}, {0.5253f, 0.4257f, -0.6801f, -0.2833f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.8368f, 22.6831f, 52.0627f}, {0.9370f, 0.3456f, 0.0121f, -0.0505f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.2543f, -25.6418f, 61.0828f}, {0.9946f, 0.0397f, -0.0002f, 0.0962f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.8058f, 43.4167f, 30.5628f}, {0.7101f, 0.7033f, 0.0194f, -0.0286f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.1950f, -21.4904f, 31.5038f}, {0.8536f, 0.5206f, -0.0055f, 0.0203f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.0708f, -34.3452f, 110.0351f}, {0.5750f, -0.2148f, 0.4503f, -0.6485f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{8.4476f, -56.6528f, 105.8419f}, {0.0676f, -0.4831f, 0.2518f, -0.8359f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.9460f, 1.7574f, 133.6502f}, {0.4247f, 0.5111f, -0.6817f, -0.3060f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.7375f, 23.3821f, 125.1652f}, {0.7157f, -0.0898f, -0.6741f, 0.1593f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8592f, 1.6346f, 74.1017f}, {0.9158f, 0.4011f, 0.0180f, -0.0105f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.4649f, 1.8710f, 74.2248f}, {0.8596f, -0.5026f, 0.0223f, 0.0894f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-9.7542f, -30.1994f, 145.6625f}, {0.8784f, 0.2840f, 0.1811f, -0.3390f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.2970f, -0.0831f, 77.5622f}, {0.9693f, 0.2457f, 0.0012f, -0.0051f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-4.8229f, -12.6657f, 156.6413f}, {0.9311f, 0.2361f, 0.0682f, -0.2695f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Run_framedata9[] = {
-    {0.8121, -66.3727, 152.9924, 0.9947, -0.0100, 0.0320, -0.0971, 1.0000, 1.0000, 1.0000},
-    {1.9833, -30.7969, 155.2583, 0.9922, -0.1001, 0.0242, -0.0698, 1.0000, 1.0000, 1.0000},
-    {-1.4351, -36.4939, 123.3583, 0.9869, 0.1250, 0.0242, -0.0991, 1.0000, 1.0000, 1.0000},
-    {-0.3011, -10.2868, 80.3107, 0.9430, 0.2668, 0.0430, -0.1942, 1.0000, 1.0000, 1.0000},
-    {22.0579, -38.5069, 111.8670, 0.4780, 0.4298, 0.6960, -0.3200, 1.0000, 1.0000, 1.0000},
-    {-22.8440, -21.7649, 120.8765, 0.5488, 0.5274, -0.5098, -0.4010, 1.0000, 1.0000, 1.0000},
-    {13.9664, 26.3610, 37.2678, 0.8529, 0.5216, -0.0005, -0.0222, 1.0000, 1.0000, 1.0000},
-    {-13.1624, -22.1741, 38.9489, 0.9346, -0.3506, 0.0137, 0.0581, 1.0000, 1.0000, 1.0000},
-    {15.1658, 53.7344, 25.3380, 0.6249, 0.7801, 0.0149, -0.0271, 1.0000, 1.0000, 1.0000},
-    {-13.3028, -40.3731, 15.2466, 0.9759, -0.2142, 0.0089, 0.0405, 1.0000, 1.0000, 1.0000},
-    {18.5016, -30.1154, 92.7241, 0.6229, -0.0914, 0.4449, -0.6369, 1.0000, 1.0000, 1.0000},
-    {13.4994, -51.1468, 83.8084, 0.1676, -0.4313, 0.3059, -0.8321, 1.0000, 1.0000, 1.0000},
-    {-24.6708, -0.5693, 120.3635, 0.5518, 0.3781, -0.6973, -0.2574, 1.0000, 1.0000, 1.0000},
-    {-22.2352, 16.9530, 104.9702, 0.6731, -0.0442, -0.7109, 0.1991, 1.0000, 1.0000, 1.0000},
-    {12.8592, 2.5657, 56.3013, 0.8876, 0.4603, 0.0053, 0.0157, 1.0000, 1.0000, 1.0000},
-    {-12.4649, 2.8021, 56.4244, 0.9007, -0.4318, 0.0069, 0.0467, 1.0000, 1.0000, 1.0000},
-    {-11.7315, -32.8886, 125.8002, 0.8999, 0.3115, 0.1559, -0.2623, 1.0000, 1.0000, 1.0000},
-    {-10.2554, -15.4954, 137.9484, 0.9430, 0.2668, 0.0430, -0.1942, 1.0000, 1.0000, 1.0000},
-    {-0.2970, 0.8481, 59.7618, 0.9693, 0.2457, 0.0012, -0.0051, 1.0000, 1.0000, 1.0000},
+    {{0.8121f, -66.3727f, 152.9924f}, {0.9947f, -0.0100f, 0.0320f, -0.0971f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{1.9833f, -30.7969f, 155.2583f}, {0.9922f, -0.1001f, 0.0242f, -0.0698f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.4351f, -36.4939f, 123.3583f}, {0.9869f, 0.1250f, 0.0242f, -0.0991f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3011f, -10.2868f, 80.3107f}, {0.9430f, 0.2668f, 0.0430f, -0.1942f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{22.0579f, -38.5069f, 111.8670f}, {0.4780f, 0.4298f, 0.6960f, -0.3200f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-22.8440f, -21.7649f, 120.8765f}, {0.5488f, 0.5274f, -0.5098f, -0.4010f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.9664f, 26.3609f, 37.2678f}, {0.8529f, 0.5216f, -0.0005f, -0.0222f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.1612f, -22.1742f, 38.9486f}, {0.9346f, -0.3506f, 0.0137f, 0.0581f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.1658f, 53.7344f, 25.3380f}, {0.6249f, 0.7801f, 0.0149f, -0.0271f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.3005f, -40.3732f, 15.2460f}, {0.9759f, -0.2142f, 0.0089f, 0.0405f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{18.5016f, -30.1155f, 92.7241f}, {0.6229f, -0.0914f, 0.4449f, -0.6369f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.4994f, -51.1468f, 83.8084f}, {0.1676f, -0.4313f, 0.3059f, -0.8321f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.6708f, -0.5693f, 120.3634f}, {0.5518f, 0.3781f, -0.6973f, -0.2574f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-22.2352f, 16.9530f, 104.9701f}, {0.6731f, -0.0442f, -0.7109f, 0.1991f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8592f, 2.5657f, 56.3013f}, {0.8876f, 0.4603f, 0.0053f, 0.0157f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.4649f, 2.8021f, 56.4244f}, {0.9007f, -0.4318f, 0.0069f, 0.0466f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.7315f, -32.8886f, 125.8002f}, {0.8999f, 0.3115f, 0.1559f, -0.2623f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.2970f, 0.8481f, 59.7618f}, {0.9693f, 0.2457f, 0.0012f, -0.0051f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.2554f, -15.4955f, 137.9484f}, {0.9430f, 0.2668f, 0.0430f, -0.1942f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Run_framedata11[] = {
-    {0.5152, -74.9657, 149.4437, 0.9906, 0.1207, -0.0639, 0.0057, 1.0000, 1.0000, 1.0000},
-    {-3.7944, -39.6913, 152.4914, 0.9627, -0.2632, -0.0570, -0.0242, 1.0000, 1.0000, 1.0000},
-    {-0.3100, -44.4045, 120.4384, 0.9872, 0.1470, -0.0603, -0.0173, 1.0000, 1.0000, 1.0000},
-    {-0.3011, -11.2179, 82.4932, 0.9267, 0.3481, -0.0499, 0.1326, 1.0000, 1.0000, 1.0000},
-    {22.6030, -31.6959, 119.2104, 0.4714, 0.6103, 0.6326, -0.0715, 1.0000, 1.0000, 1.0000},
-    {-24.2009, -41.9849, 110.2007, 0.6759, 0.5435, -0.4038, -0.2911, 1.0000, 1.0000, 1.0000},
-    {18.5529, 11.5571, 30.2198, 0.4895, 0.8662, -0.0248, 0.0971, 1.0000, 1.0000, 1.0000},
-    {-15.5129, -1.6938, 28.4790, 0.8954, 0.4407, -0.0626, 0.0018, 1.0000, 1.0000, 1.0000},
-    {14.4051, 36.0371, 46.8509, 0.5089, 0.8606, -0.0018, -0.0209, 1.0000, 1.0000, 1.0000},
-    {-12.6940, 23.0367, 11.9409, 0.9983, -0.0045, 0.0066, 0.0582, 1.0000, 1.0000, 1.0000},
-    {26.3829, -15.1998, 106.4391, 0.6569, 0.3043, 0.5207, -0.4525, 1.0000, 1.0000, 1.0000},
-    {26.8806, -22.9441, 84.3799, 0.5974, -0.2515, 0.4806, -0.5907, 1.0000, 1.0000, 1.0000},
-    {-33.4138, -23.0068, 107.4057, 0.6230, 0.1544, -0.7543, 0.1380, 1.0000, 1.0000, 1.0000},
-    {-28.9006, -23.9781, 84.4143, 0.4318, 0.0755, -0.8064, 0.3968, 1.0000, 1.0000, 1.0000},
-    {12.8592, 1.6346, 58.4838, 0.9775, 0.1893, -0.0731, 0.0582, 1.0000, 1.0000, 1.0000},
-    {-12.4649, 1.8710, 58.6068, 0.9992, -0.0259, 0.0236, 0.0191, 1.0000, 1.0000, 1.0000},
-    {-11.0323, -47.0530, 118.7075, 0.9226, 0.3747, 0.0558, 0.0726, 1.0000, 1.0000, 1.0000},
-    {-23.2489, -34.8394, 131.1115, 0.9267, 0.3481, -0.0499, 0.1326, 1.0000, 1.0000, 1.0000},
-    {-0.2970, -0.0831, 61.9442, 0.9693, 0.2457, 0.0012, -0.0051, 1.0000, 1.0000, 1.0000},
+    {{0.5152f, -74.9657f, 149.4437f}, {0.9906f, 0.1207f, -0.0639f, 0.0057f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-3.7944f, -39.6913f, 152.4914f}, {0.9627f, -0.2632f, -0.0570f, -0.0242f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3100f, -44.4045f, 120.4384f}, {0.9872f, 0.1470f, -0.0603f, -0.0173f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3011f, -11.2179f, 82.4932f}, {0.9267f, 0.3481f, -0.0499f, 0.1326f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{22.6030f, -31.6959f, 119.2103f}, {0.4714f, 0.6103f, 0.6326f, -0.0715f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.2009f, -41.9849f, 110.2007f}, {0.6759f, 0.5435f, -0.4038f, -0.2911f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{18.5529f, 11.5570f, 30.2196f}, {0.4895f, 0.8662f, -0.0247f, 0.0971f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-15.5122f, -1.6938f, 28.4786f}, {0.8954f, 0.4407f, -0.0626f, 0.0018f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.4050f, 36.0372f, 46.8509f}, {0.5089f, 0.8606f, -0.0018f, -0.0209f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.6939f, 23.0362f, 11.9407f}, {0.9983f, -0.0045f, 0.0066f, 0.0582f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.3829f, -15.1998f, 106.4391f}, {0.6569f, 0.3043f, 0.5207f, -0.4525f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.8806f, -22.9441f, 84.3799f}, {0.5974f, -0.2515f, 0.4806f, -0.5907f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-33.4138f, -23.0068f, 107.4057f}, {0.6230f, 0.1544f, -0.7543f, 0.1380f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-28.9006f, -23.9781f, 84.4143f}, {0.4318f, 0.0755f, -0.8064f, 0.3968f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8592f, 1.6346f, 58.4838f}, {0.9775f, 0.1893f, -0.0731f, 0.0582f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.4649f, 1.8710f, 58.6068f}, {0.9992f, -0.0259f, 0.0236f, 0.0191f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.0323f, -47.0530f, 118.7075f}, {0.9226f, 0.3747f, 0.0558f, 0.0726f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.2970f, -0.0831f, 61.9442f}, {0.9693f, 0.2457f, 0.0012f, -0.0051f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-23.2489f, -34.8394f, 131.1115f}, {0.9267f, 0.3481f, -0.0499f, 0.1326f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Run_framedata16[] = {
-    {11.4697, -68.3174, 159.7529, 0.9879, 0.0352, -0.0272, 0.1487, 1.0000, 1.0000, 1.0000},
-    {-4.5924, -37.7428, 168.6606, 0.9823, -0.0339, -0.0999, 0.1547, 1.0000, 1.0000, 1.0000},
-    {-0.3100, -35.2345, 136.4562, 0.9576, 0.2428, -0.0382, 0.1502, 1.0000, 1.0000, 1.0000},
-    {-0.3011, -11.2179, 92.1348, 0.9263, 0.2348, -0.0725, 0.2856, 1.0000, 1.0000, 1.0000},
-    {18.7809, -17.2659, 135.6249, 0.2327, 0.6082, 0.7575, -0.0470, 1.0000, 1.0000, 1.0000},
-    {-21.5160, -41.4019, 122.5382, 0.4092, 0.3222, -0.5760, 0.6300, 1.0000, 1.0000, 1.0000},
-    {15.2485, -28.0253, 61.4696, 0.9992, 0.0260, -0.0225, 0.0213, 1.0000, 1.0000, 1.0000},
-    {-14.0346, 23.3332, 46.6474, 0.9130, 0.4077, 0.0032, -0.0137, 1.0000, 1.0000, 1.0000},
-    {16.8869, -24.5543, 31.8328, 0.8264, 0.5621, -0.0331, 0.0009, 1.0000, 1.0000, 1.0000},
-    {-14.1888, 46.8161, 28.1658, 0.6602, 0.7506, 0.0170, -0.0201, 1.0000, 1.0000, 1.0000},
-    {15.9195, 2.6922, 129.0679, 0.1829, 0.6442, 0.7426, 0.0032, 1.0000, 1.0000, 1.0000},
-    {12.7113, 24.6473, 121.6845, 0.8069, 0.0545, 0.5865, 0.0432, 1.0000, 1.0000, 1.0000},
-    {-13.7578, -42.7001, 102.7650, 0.2867, 0.0199, -0.5780, 0.7638, 1.0000, 1.0000, 1.0000},
-    {6.6156, -52.5258, 96.5763, 0.0095, -0.3433, -0.6392, 0.6881, 1.0000, 1.0000, 1.0000},
-    {12.8592, 1.6346, 68.1254, 0.7996, -0.6004, -0.0085, 0.0053, 1.0000, 1.0000, 1.0000},
-    {-12.4649, 1.8710, 68.2484, 0.9123, 0.4092, 0.0026, -0.0140, 1.0000, 1.0000, 1.0000},
-    {-9.5416, -40.9747, 133.8473, 0.9273, 0.2113, -0.0179, 0.3084, 1.0000, 1.0000, 1.0000},
-    {-26.5201, -30.3899, 141.0563, 0.9263, 0.2348, -0.0725, 0.2856, 1.0000, 1.0000, 1.0000},
-    {-0.2970, -0.0831, 71.5858, 0.9693, 0.2457, 0.0012, -0.0051, 1.0000, 1.0000, 1.0000},
+    {{11.4697f, -68.3174f, 159.7529f}, {0.9879f, 0.0352f, -0.0272f, 0.1487f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-4.5924f, -37.7428f, 168.6606f}, {0.9823f, -0.0339f, -0.0999f, 0.1547f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3100f, -35.2345f, 136.4562f}, {0.9576f, 0.2428f, -0.0382f, 0.1502f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.3011f, -11.2179f, 92.1348f}, {0.9263f, 0.2348f, -0.0725f, 0.2856f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{18.7809f, -17.2660f, 135.6249f}, {0.2327f, 0.6082f, 0.7575f, -0.0470f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-21.5160f, -41.4019f, 122.5382f}, {0.4092f, 0.3222f, -0.5760f, 0.6300f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.2485f, -28.0254f, 61.4697f}, {0.9992f, 0.0260f, -0.0225f, 0.0213f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.0348f, 23.3333f, 46.6476f}, {0.9130f, 0.4077f, 0.0032f, -0.0137f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{16.8869f, -24.5545f, 31.8330f}, {0.8264f, 0.5621f, -0.0331f, 0.0009f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.1896f, 46.8159f, 28.1659f}, {0.6602f, 0.7506f, 0.0170f, -0.0201f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.9195f, 2.6922f, 129.0680f}, {0.1829f, 0.6442f, 0.7426f, 0.0032f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.7113f, 24.6472f, 121.6845f}, {0.8069f, 0.0545f, 0.5865f, 0.0432f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.7578f, -42.7001f, 102.7650f}, {0.2867f, 0.0199f, -0.5780f, 0.7638f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{6.6156f, -52.5258f, 96.5763f}, {0.0095f, -0.3433f, -0.6392f, 0.6881f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8592f, 1.6346f, 68.1254f}, {0.7996f, -0.6004f, -0.0085f, 0.0053f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.4649f, 1.8710f, 68.2484f}, {0.9123f, 0.4093f, 0.0026f, -0.0141f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-9.5416f, -40.9747f, 133.8473f}, {0.9273f, 0.2113f, -0.0179f, 0.3084f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.2970f, -0.0831f, 71.5858f}, {0.9693f, 0.2457f, 0.0012f, -0.0051f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.5201f, -30.3899f, 141.0563f}, {0.9263f, 0.2348f, -0.0725f, 0.2856f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64KeyFrame anim_Catherine_Run_keyframes[] = {
     {0, anim_Catherine_Run_framedata0},
@@ -1637,153 +1880,157 @@ static s64KeyFrame anim_Catherine_Run_keyframes[] = {
     {11, anim_Catherine_Run_framedata11},
     {16, anim_Catherine_Run_framedata16},
 };
+static u16 anim_Catherine_Run_framelookup[] = {
+    0, 1, 1, 2, 2, 2, 2, 2, 3, 4, 4, 5, 5, 5, 5, 5,
+    6,
+};
 
 static s64Transform anim_Catherine_Sneak_framedata0[] = {
-    {5.0370, -41.8403, 170.1616, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {-1.6473, -7.0007, 173.8581, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {-0.7492, -11.4113, 141.5859, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 93.4618, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {23.7647, -6.1722, 133.8630, 0.6982, 0.4422, 0.5443, -0.1438, 1.0000, 1.0000, 1.0000},
-    {-24.9695, -7.3392, 132.7408, 0.7052, 0.4104, -0.5780, 0.0147, 1.0000, 1.0000, 1.0000},
-    {13.3122, 0.0385, 35.9422, 0.8134, 0.5798, 0.0323, -0.0345, 1.0000, 1.0000, 1.0000},
-    {-13.1044, -15.3905, 42.3736, 0.9995, -0.0028, 0.0238, 0.0181, 1.0000, 1.0000, 1.0000},
-    {13.5222, 28.8363, 27.9606, 0.9298, 0.3677, -0.0027, -0.0188, 1.0000, 1.0000, 1.0000},
-    {-14.9599, -13.6874, 12.5963, 0.9992, -0.0079, 0.0037, 0.0383, 1.0000, 1.0000, 1.0000},
-    {30.8458, 1.9422, 115.6003, 0.6377, 0.2379, 0.6564, -0.3253, 1.0000, 1.0000, 1.0000},
-    {28.9624, -1.8849, 92.6082, 0.7324, -0.0334, 0.6781, -0.0517, 1.0000, 1.0000, 1.0000},
-    {-31.6561, 4.7775, 116.5751, 0.6430, 0.2880, -0.6892, 0.1692, 1.0000, 1.0000, 1.0000},
-    {-30.5205, 6.7682, 93.2370, 0.7428, 0.0542, -0.6654, -0.0500, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 66.2268, 0.9978, -0.0255, 0.0218, -0.0570, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 66.2268, 0.9540, -0.2991, -0.0059, 0.0207, 1.0000, 1.0000, 1.0000},
-    {-11.9202, -11.8103, 141.7513, 0.9579, 0.2869, 0.0122, 0.0078, 1.0000, 1.0000, 1.0000},
-    {-19.3894, 6.8139, 148.7963, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 70.0899, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.0370f, -41.8403f, 170.1616f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.6473f, -7.0007f, 173.8581f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.7492f, -11.4113f, 141.5859f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 93.4618f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.7647f, -6.1722f, 133.8629f}, {0.6982f, 0.4422f, 0.5443f, -0.1438f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.9695f, -7.3392f, 132.7408f}, {0.7052f, 0.4104f, -0.5780f, 0.0147f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.3122f, 0.0384f, 35.9421f}, {0.8134f, 0.5798f, 0.0323f, -0.0345f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.1036f, -15.3909f, 42.3736f}, {0.9995f, -0.0028f, 0.0238f, 0.0181f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.5221f, 28.8361f, 27.9605f}, {0.9298f, 0.3677f, -0.0027f, -0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.9592f, -13.6877f, 12.5963f}, {0.9992f, -0.0079f, 0.0037f, 0.0383f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{30.8458f, 1.9422f, 115.6003f}, {0.6377f, 0.2379f, 0.6564f, -0.3253f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.9623f, -1.8849f, 92.6082f}, {0.7324f, -0.0334f, 0.6781f, -0.0517f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-31.6561f, 4.7775f, 116.5750f}, {0.6430f, 0.2880f, -0.6892f, 0.1692f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.5205f, 6.7682f, 93.2370f}, {0.7428f, 0.0542f, -0.6654f, -0.0500f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 66.2268f}, {0.9978f, -0.0255f, 0.0218f, -0.0570f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 66.2268f}, {0.9540f, -0.2991f, -0.0059f, 0.0207f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.9202f, -11.8103f, 141.7513f}, {0.9579f, 0.2869f, 0.0122f, 0.0078f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 70.0899f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.3894f, 6.8139f, 148.7963f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Sneak_framedata8[] = {
-    {5.1224, -37.5339, 174.2507, 0.9929, 0.1185, 0.0053, 0.0066, 1.0000, 1.0000, 1.0000},
-    {-1.4233, -2.4891, 175.3269, 0.9963, 0.0794, -0.0285, 0.0175, 1.0000, 1.0000, 1.0000},
-    {-0.6579, -9.3282, 143.4773, 0.9935, 0.1128, -0.0076, 0.0118, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 94.3561, 0.9935, 0.1128, -0.0076, 0.0118, 1.0000, 1.0000, 1.0000},
-    {23.8465, -4.7818, 135.2989, 0.7271, 0.4076, 0.5321, -0.1485, 1.0000, 1.0000, 1.0000},
-    {-24.8953, -5.8425, 134.4307, 0.7228, 0.3632, -0.5851, 0.0572, 1.0000, 1.0000, 1.0000},
-    {13.9421, 4.2506, 36.7253, 0.8049, 0.5919, 0.0254, -0.0343, 1.0000, 1.0000, 1.0000},
-    {-13.4106, -13.9768, 41.1680, 0.9965, 0.0734, 0.0090, 0.0391, 1.0000, 1.0000, 1.0000},
-    {14.5029, 33.2663, 29.5948, 0.9035, 0.4213, -0.0383, -0.0679, 1.0000, 1.0000, 1.0000},
-    {-14.6323, -7.7835, 11.9587, 0.9995, -0.0029, 0.0154, 0.0279, 1.0000, 1.0000, 1.0000},
-    {31.3483, 2.0210, 116.6722, 0.6359, 0.2177, 0.6693, -0.3167, 1.0000, 1.0000, 1.0000},
-    {28.9924, -2.0144, 93.7594, 0.7284, -0.0472, 0.6807, -0.0626, 1.0000, 1.0000, 1.0000},
-    {-31.1315, 4.0725, 116.6640, 0.6530, 0.2488, -0.6834, 0.2112, 1.0000, 1.0000, 1.0000},
-    {-29.6181, 3.3442, 93.2739, 0.7384, 0.0089, -0.6742, 0.0051, 1.0000, 1.0000, 1.0000},
-    {13.1271, 1.9811, 67.1211, 0.9956, 0.0705, 0.0163, -0.0599, 1.0000, 1.0000, 1.0000},
-    {-12.1984, 1.9811, 67.1211, 0.9698, -0.2395, 0.0055, 0.0452, 1.0000, 1.0000, 1.0000},
-    {-11.8296, -9.6704, 143.7097, 0.9760, 0.2172, 0.0112, 0.0047, 1.0000, 1.0000, 1.0000},
-    {-19.2064, 9.4612, 149.3525, 0.9935, 0.1128, -0.0076, 0.0118, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 70.9842, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.1224f, -37.5339f, 174.2507f}, {0.9929f, 0.1185f, 0.0053f, 0.0066f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.4233f, -2.4891f, 175.3269f}, {0.9963f, 0.0794f, -0.0285f, 0.0175f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.6579f, -9.3282f, 143.4773f}, {0.9935f, 0.1128f, -0.0076f, 0.0118f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 94.3561f}, {0.9935f, 0.1128f, -0.0076f, 0.0118f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.8465f, -4.7819f, 135.2989f}, {0.7271f, 0.4076f, 0.5321f, -0.1485f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.8953f, -5.8425f, 134.4308f}, {0.7228f, 0.3632f, -0.5851f, 0.0572f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.9421f, 4.2505f, 36.7253f}, {0.8049f, 0.5919f, 0.0254f, -0.0343f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.4099f, -13.9771f, 41.1680f}, {0.9965f, 0.0734f, 0.0090f, 0.0391f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.5029f, 33.2660f, 29.5947f}, {0.9035f, 0.4213f, -0.0383f, -0.0679f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.6319f, -7.7838f, 11.9587f}, {0.9995f, -0.0029f, 0.0154f, 0.0279f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{31.3483f, 2.0210f, 116.6722f}, {0.6359f, 0.2177f, 0.6693f, -0.3167f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.9924f, -2.0143f, 93.7594f}, {0.7284f, -0.0472f, 0.6807f, -0.0626f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-31.1315f, 4.0725f, 116.6640f}, {0.6530f, 0.2488f, -0.6834f, 0.2112f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.6181f, 3.3442f, 93.2739f}, {0.7384f, 0.0089f, -0.6742f, 0.0051f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1271f, 1.9811f, 67.1211f}, {0.9956f, 0.0705f, 0.0163f, -0.0599f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1984f, 1.9811f, 67.1211f}, {0.9698f, -0.2395f, 0.0055f, 0.0452f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.8296f, -9.6704f, 143.7097f}, {0.9760f, 0.2172f, 0.0112f, 0.0047f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 70.9842f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.2064f, 9.4612f, 149.3525f}, {0.9935f, 0.1128f, -0.0076f, 0.0118f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Sneak_framedata14[] = {
-    {5.2250, -32.9385, 180.2298, 0.9986, 0.0488, -0.0163, 0.0140, 1.0000, 1.0000, 1.0000},
-    {-1.2387, 2.1335, 179.6671, 0.9942, 0.1070, -0.0062, 0.0108, 1.0000, 1.0000, 1.0000},
-    {-0.5597, -6.2006, 148.1737, 0.9959, 0.0894, -0.0064, 0.0107, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 98.5728, 0.9959, 0.0894, -0.0064, 0.0107, 1.0000, 1.0000, 1.0000},
-    {23.9367, -2.1028, 139.7382, 0.7527, 0.3694, 0.5286, -0.1329, 1.0000, 1.0000, 1.0000},
-    {-24.8093, -3.0876, 139.0242, 0.7306, 0.3070, -0.5982, 0.1185, 1.0000, 1.0000, 1.0000},
-    {13.6343, -12.2116, 44.7911, 0.8250, 0.5629, 0.0362, -0.0356, 1.0000, 1.0000, 1.0000},
-    {-13.4245, 8.1910, 41.3566, 0.9981, 0.0601, 0.0128, 0.0104, 1.0000, 1.0000, 1.0000},
-    {13.6459, 16.2378, 35.6425, 0.7633, 0.6459, -0.0017, -0.0164, 1.0000, 1.0000, 1.0000},
-    {-14.6300, 13.6472, 12.0000, 0.9995, -0.0021, 0.0155, -0.0265, 1.0000, 1.0000, 1.0000},
-    {31.6276, 4.0773, 120.9722, 0.6346, 0.2088, 0.6944, -0.2673, 1.0000, 1.0000, 1.0000},
-    {29.1437, 1.4782, 97.8658, 0.7244, -0.0418, 0.6861, -0.0521, 1.0000, 1.0000, 1.0000},
-    {-30.0151, 3.8212, 119.5813, 0.6566, 0.2188, -0.6766, 0.2516, 1.0000, 1.0000, 1.0000},
-    {-28.0333, 0.8115, 96.4095, 0.7242, -0.0364, -0.6846, 0.0748, 1.0000, 1.0000, 1.0000},
-    {13.1416, 2.7800, 71.3378, 0.9732, -0.2217, 0.0039, -0.0617, 1.0000, 1.0000, 1.0000},
-    {-12.1839, 2.7800, 71.3378, 0.9927, 0.1204, -0.0080, 0.0015, 1.0000, 1.0000, 1.0000},
-    {-11.7316, -6.5050, 148.4456, 0.9907, 0.1360, 0.0080, 0.0026, 1.0000, 1.0000, 1.0000},
-    {-19.0523, 12.8888, 153.1960, 0.9959, 0.0894, -0.0064, 0.0107, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 75.2009, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.2250f, -32.9385f, 180.2298f}, {0.9986f, 0.0488f, -0.0163f, 0.0140f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.2387f, 2.1335f, 179.6671f}, {0.9942f, 0.1070f, -0.0062f, 0.0108f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.5597f, -6.2006f, 148.1737f}, {0.9959f, 0.0894f, -0.0064f, 0.0107f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 98.5728f}, {0.9959f, 0.0894f, -0.0064f, 0.0107f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.9367f, -2.1028f, 139.7382f}, {0.7527f, 0.3694f, 0.5286f, -0.1329f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.8092f, -3.0876f, 139.0242f}, {0.7306f, 0.3070f, -0.5982f, 0.1185f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.6343f, -12.2118f, 44.7910f}, {0.8250f, 0.5629f, 0.0362f, -0.0356f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.4247f, 8.1909f, 41.3566f}, {0.9981f, 0.0601f, 0.0128f, 0.0104f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.6459f, 16.2377f, 35.6425f}, {0.7633f, 0.6459f, -0.0017f, -0.0164f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.6304f, 13.6471f, 12.0001f}, {0.9995f, -0.0021f, 0.0155f, -0.0265f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{31.6276f, 4.0773f, 120.9722f}, {0.6346f, 0.2088f, 0.6944f, -0.2673f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.1437f, 1.4782f, 97.8658f}, {0.7244f, -0.0418f, 0.6861f, -0.0521f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.0151f, 3.8212f, 119.5813f}, {0.6566f, 0.2188f, -0.6766f, 0.2516f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-28.0333f, 0.8115f, 96.4095f}, {0.7242f, -0.0364f, -0.6846f, 0.0748f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1416f, 2.7800f, 71.3378f}, {0.9732f, -0.2217f, 0.0039f, -0.0617f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1839f, 2.7800f, 71.3378f}, {0.9927f, 0.1204f, -0.0080f, 0.0015f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.7316f, -6.5050f, 148.4456f}, {0.9907f, 0.1360f, 0.0080f, 0.0026f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 75.2009f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.0524f, 12.8888f, 153.1960f}, {0.9959f, 0.0894f, -0.0064f, 0.0107f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Sneak_framedata26[] = {
-    {5.0370, -41.8403, 170.1616, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {-1.6473, -7.0007, 173.8581, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {-0.7492, -11.4113, 141.5859, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 93.4618, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {23.7647, -6.1722, 133.8630, 0.7546, 0.3591, 0.5475, -0.0426, 1.0000, 1.0000, 1.0000},
-    {-24.9695, -7.3392, 132.7408, 0.7075, 0.2690, -0.6378, 0.1427, 1.0000, 1.0000, 1.0000},
-    {12.3430, -15.4434, 42.4105, 0.9999, 0.0126, 0.0047, -0.0005, 1.0000, 1.0000, 1.0000},
-    {-14.4070, 6.6926, 35.9781, 0.8517, 0.5238, -0.0037, -0.0115, 1.0000, 1.0000, 1.0000},
-    {12.4766, -12.8131, 12.6425, 0.9986, -0.0024, -0.0061, 0.0525, 1.0000, 1.0000, 1.0000},
-    {-14.1961, 34.1688, 24.2288, 0.9504, 0.3093, 0.0227, -0.0247, 1.0000, 1.0000, 1.0000},
-    {30.9240, 2.7484, 116.0115, 0.6360, 0.2354, 0.7261, -0.1132, 1.0000, 1.0000, 1.0000},
-    {29.3300, 5.9746, 92.9056, 0.7225, 0.0274, 0.6903, 0.0262, 1.0000, 1.0000, 1.0000},
-    {-27.8133, -1.5253, 112.4684, 0.6498, 0.2447, -0.6892, 0.2074, 1.0000, 1.0000, 1.0000},
-    {-26.0319, -2.1807, 89.0950, 0.7022, -0.0247, -0.7044, 0.1008, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 66.2268, 0.9524, -0.3013, 0.0459, 0.0005, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 66.2268, 0.9965, 0.0830, 0.0083, 0.0076, 1.0000, 1.0000, 1.0000},
-    {-11.9202, -11.8103, 141.7513, 0.9922, 0.1249, 0.0001, 0.0055, 1.0000, 1.0000, 1.0000},
-    {-19.3894, 6.8139, 148.7963, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 70.0899, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.0370f, -41.8403f, 170.1616f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.6473f, -7.0007f, 173.8581f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.7492f, -11.4113f, 141.5859f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 93.4618f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.7647f, -6.1722f, 133.8629f}, {0.7546f, 0.3591f, 0.5475f, -0.0426f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.9695f, -7.3392f, 132.7408f}, {0.7075f, 0.2690f, -0.6378f, 0.1427f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.3430f, -15.4435f, 42.4105f}, {0.9999f, 0.0126f, 0.0047f, -0.0005f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4071f, 6.6923f, 35.9779f}, {0.8517f, 0.5238f, -0.0037f, -0.0115f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.4766f, -12.8133f, 12.6425f}, {0.9986f, -0.0024f, -0.0061f, 0.0525f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.1973f, 34.1685f, 24.2288f}, {0.9504f, 0.3093f, 0.0226f, -0.0247f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{30.9240f, 2.7484f, 116.0114f}, {0.6360f, 0.2354f, 0.7261f, -0.1132f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.3299f, 5.9746f, 92.9056f}, {0.7225f, 0.0274f, 0.6903f, 0.0262f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-27.8132f, -1.5254f, 112.4684f}, {0.6498f, 0.2447f, -0.6892f, 0.2074f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.0319f, -2.1807f, 89.0950f}, {0.7022f, -0.0247f, -0.7044f, 0.1008f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 66.2268f}, {0.9524f, -0.3013f, 0.0459f, 0.0005f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 66.2268f}, {0.9965f, 0.0830f, 0.0083f, 0.0076f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.9202f, -11.8103f, 141.7513f}, {0.9922f, 0.1249f, 0.0001f, 0.0055f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 70.0899f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.3894f, 6.8139f, 148.7963f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Sneak_framedata34[] = {
-    {5.0549, -40.1580, 172.9027, 0.9916, 0.1292, 0.0047, 0.0065, 1.0000, 1.0000, 1.0000},
-    {-1.4817, -5.1661, 175.1336, 0.9932, 0.1117, -0.0290, 0.0168, 1.0000, 1.0000, 1.0000},
-    {-0.6958, -10.9475, 143.0756, 0.9915, 0.1292, -0.0082, 0.0116, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 94.3561, 0.9915, 0.1292, -0.0082, 0.0116, 1.0000, 1.0000, 1.0000},
-    {23.8157, -6.1405, 135.0692, 0.7641, 0.3626, 0.5253, -0.0933, 1.0000, 1.0000, 1.0000},
-    {-24.9258, -7.1570, 134.1326, 0.7183, 0.2930, -0.6197, 0.1190, 1.0000, 1.0000, 1.0000},
-    {12.4352, -14.5034, 41.4794, 0.9961, 0.0881, -0.0016, 0.0104, 1.0000, 1.0000, 1.0000},
-    {-14.5235, -3.7747, 37.2691, 0.8044, 0.5939, -0.0006, -0.0123, 1.0000, 1.0000, 1.0000},
-    {12.8476, -7.4125, 12.4515, 1.0000, -0.0026, -0.0014, 0.0027, 1.0000, 1.0000, 1.0000},
-    {-14.3903, 25.2884, 30.3158, 0.8471, 0.5299, 0.0192, -0.0352, 1.0000, 1.0000, 1.0000},
-    {31.8822, 0.9831, 116.8019, 0.6191, 0.2382, 0.7276, -0.1745, 1.0000, 1.0000, 1.0000},
-    {29.2255, 2.6028, 93.6254, 0.7243, 0.0008, 0.6894, -0.0060, 1.0000, 1.0000, 1.0000},
-    {-28.9727, -0.2922, 114.4005, 0.6524, 0.2295, -0.6870, 0.2230, 1.0000, 1.0000, 1.0000},
-    {-27.0165, -1.9601, 91.0915, 0.7134, -0.0247, -0.6954, 0.0829, 1.0000, 1.0000, 1.0000},
-    {13.1271, 1.9812, 67.1211, 0.9669, -0.2517, 0.0366, -0.0190, 1.0000, 1.0000, 1.0000},
-    {-12.1984, 1.9811, 67.1211, 0.9978, -0.0625, 0.0124, 0.0193, 1.0000, 1.0000, 1.0000},
-    {-11.8677, -11.2939, 143.2888, 0.9904, 0.1379, 0.0038, 0.0037, 1.0000, 1.0000, 1.0000},
-    {-19.2431, 7.6428, 149.5566, 0.9915, 0.1292, -0.0082, 0.0116, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 70.9842, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.0549f, -40.1580f, 172.9027f}, {0.9916f, 0.1292f, 0.0047f, 0.0065f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.4817f, -5.1661f, 175.1336f}, {0.9932f, 0.1117f, -0.0290f, 0.0168f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.6958f, -10.9475f, 143.0756f}, {0.9915f, 0.1292f, -0.0082f, 0.0116f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 94.3561f}, {0.9915f, 0.1292f, -0.0082f, 0.0116f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.8157f, -6.1405f, 135.0692f}, {0.7641f, 0.3626f, 0.5253f, -0.0933f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.9258f, -7.1570f, 134.1325f}, {0.7183f, 0.2930f, -0.6197f, 0.1190f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.4352f, -14.5036f, 41.4795f}, {0.9961f, 0.0881f, -0.0016f, 0.0104f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.5232f, -3.7751f, 37.2687f}, {0.8044f, 0.5939f, -0.0006f, -0.0123f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8476f, -7.4123f, 12.4514f}, {1.0000f, -0.0026f, -0.0014f, 0.0027f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.3912f, 25.2882f, 30.3159f}, {0.8471f, 0.5299f, 0.0192f, -0.0352f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{31.8822f, 0.9831f, 116.8018f}, {0.6191f, 0.2382f, 0.7276f, -0.1745f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.2255f, 2.6028f, 93.6254f}, {0.7243f, 0.0008f, 0.6894f, -0.0060f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-28.9727f, -0.2922f, 114.4005f}, {0.6524f, 0.2295f, -0.6870f, 0.2230f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-27.0166f, -1.9601f, 91.0915f}, {0.7134f, -0.0247f, -0.6954f, 0.0829f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1271f, 1.9812f, 67.1211f}, {0.9669f, -0.2517f, 0.0366f, -0.0190f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1984f, 1.9811f, 67.1211f}, {0.9978f, -0.0625f, 0.0124f, 0.0193f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.8677f, -11.2939f, 143.2888f}, {0.9904f, 0.1379f, 0.0038f, 0.0037f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 70.9842f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.2431f, 7.6428f, 149.5566f}, {0.9915f, 0.1292f, -0.0082f, 0.0116f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Sneak_framedata40[] = {
-    {5.1081, -37.2746, 178.2001, 0.9969, 0.0756, -0.0173, 0.0133, 1.0000, 1.0000, 1.0000},
-    {-1.3383, -2.2195, 179.5138, 0.9915, 0.1293, -0.0072, 0.0104, 1.0000, 1.0000, 1.0000},
-    {-0.6247, -8.8508, 147.6192, 0.9932, 0.1161, -0.0073, 0.0103, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 98.5728, 0.9932, 0.1161, -0.0073, 0.0103, 1.0000, 1.0000, 1.0000},
-    {23.8839, -4.3192, 139.4453, 0.7627, 0.3818, 0.4999, -0.1506, 1.0000, 1.0000, 1.0000},
-    {-24.8615, -5.2379, 138.6210, 0.7226, 0.3402, -0.5959, 0.0831, 1.0000, 1.0000, 1.0000},
-    {12.5019, -1.3922, 41.1402, 0.9938, 0.1102, 0.0030, -0.0110, 1.0000, 1.0000, 1.0000},
-    {-14.0331, -9.9975, 43.7155, 0.8245, 0.5658, 0.0069, -0.0070, 1.0000, 1.0000, 1.0000},
-    {12.8478, 6.9688, 12.4515, 1.0000, -0.0026, -0.0014, 0.0027, 1.0000, 1.0000, 1.0000},
-    {-14.4689, 18.5140, 34.7751, 0.8014, 0.5972, 0.0294, -0.0161, 1.0000, 1.0000, 1.0000},
-    {32.7321, 1.0960, 120.9549, 0.6029, 0.2438, 0.7145, -0.2580, 1.0000, 1.0000, 1.0000},
-    {29.0913, 0.5136, 97.8629, 0.7266, -0.0298, 0.6850, -0.0436, 1.0000, 1.0000, 1.0000},
-    {-30.4439, 3.5294, 120.0515, 0.6513, 0.2388, -0.6844, 0.2246, 1.0000, 1.0000, 1.0000},
-    {-28.5866, 2.1085, 96.7181, 0.7299, -0.0074, -0.6825, 0.0369, 1.0000, 1.0000, 1.0000},
-    {13.1416, 2.7800, 71.3378, 0.9982, -0.0372, 0.0371, -0.0289, 1.0000, 1.0000, 1.0000},
-    {-12.1839, 2.7800, 71.3378, 0.9828, -0.1825, 0.0090, 0.0269, 1.0000, 1.0000, 1.0000},
-    {-11.7971, -9.1634, 147.8609, 0.9830, 0.1832, 0.0087, 0.0029, 1.0000, 1.0000, 1.0000},
-    {-19.1144, 9.9513, 153.6372, 0.9932, 0.1161, -0.0073, 0.0103, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 75.2009, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.1081f, -37.2746f, 178.2001f}, {0.9969f, 0.0756f, -0.0173f, 0.0133f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.3383f, -2.2195f, 179.5138f}, {0.9915f, 0.1293f, -0.0072f, 0.0104f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.6247f, -8.8508f, 147.6192f}, {0.9932f, 0.1161f, -0.0073f, 0.0103f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 98.5728f}, {0.9932f, 0.1161f, -0.0073f, 0.0103f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.8839f, -4.3192f, 139.4453f}, {0.7627f, 0.3818f, 0.4999f, -0.1506f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.8615f, -5.2379f, 138.6210f}, {0.7226f, 0.3402f, -0.5959f, 0.0831f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.5019f, -1.3922f, 41.1402f}, {0.9938f, 0.1102f, 0.0030f, -0.0110f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.0325f, -9.9980f, 43.7151f}, {0.8245f, 0.5658f, 0.0070f, -0.0070f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8478f, 6.9689f, 12.4515f}, {1.0000f, -0.0026f, -0.0014f, 0.0027f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4695f, 18.5139f, 34.7751f}, {0.8014f, 0.5971f, 0.0293f, -0.0161f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{32.7321f, 1.0960f, 120.9549f}, {0.6029f, 0.2438f, 0.7145f, -0.2580f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.0912f, 0.5136f, 97.8630f}, {0.7266f, -0.0298f, 0.6850f, -0.0436f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.4439f, 3.5294f, 120.0515f}, {0.6513f, 0.2388f, -0.6844f, 0.2246f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-28.5866f, 2.1085f, 96.7181f}, {0.7299f, -0.0074f, -0.6825f, 0.0369f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1416f, 2.7800f, 71.3378f}, {0.9982f, -0.0372f, 0.0371f, -0.0289f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1839f, 2.7800f, 71.3378f}, {0.9828f, -0.1825f, 0.0090f, 0.0269f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.7971f, -9.1634f, 147.8609f}, {0.9830f, 0.1832f, 0.0087f, 0.0029f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 75.2009f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.1144f, 9.9513f, 153.6372f}, {0.9932f, 0.1161f, -0.0073f, 0.0103f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Sneak_framedata52[] = {
-    {5.0370, -41.8403, 170.1616, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {-1.6473, -7.0007, 173.8581, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {-0.7492, -11.4113, 141.5859, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 93.4618, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {23.7647, -6.1722, 133.8630, 0.6982, 0.4422, 0.5443, -0.1438, 1.0000, 1.0000, 1.0000},
-    {-24.9695, -7.3392, 132.7408, 0.7052, 0.4104, -0.5780, 0.0147, 1.0000, 1.0000, 1.0000},
-    {13.3122, 0.0385, 35.9422, 0.8134, 0.5798, 0.0323, -0.0345, 1.0000, 1.0000, 1.0000},
-    {-13.1044, -15.3905, 42.3736, 0.9995, -0.0028, 0.0238, 0.0181, 1.0000, 1.0000, 1.0000},
-    {13.5222, 28.8363, 27.9606, 0.9298, 0.3677, -0.0027, -0.0188, 1.0000, 1.0000, 1.0000},
-    {-14.9599, -13.6874, 12.5963, 0.9992, -0.0079, 0.0037, 0.0383, 1.0000, 1.0000, 1.0000},
-    {30.8458, 1.9422, 115.6003, 0.6377, 0.2379, 0.6564, -0.3253, 1.0000, 1.0000, 1.0000},
-    {28.9624, -1.8849, 92.6082, 0.7324, -0.0334, 0.6781, -0.0517, 1.0000, 1.0000, 1.0000},
-    {-31.6561, 4.7775, 116.5751, 0.6430, 0.2880, -0.6892, 0.1692, 1.0000, 1.0000, 1.0000},
-    {-30.5205, 6.7682, 93.2370, 0.7428, 0.0542, -0.6654, -0.0500, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 66.2268, 0.9978, -0.0255, 0.0218, -0.0570, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 66.2268, 0.9540, -0.2991, -0.0059, 0.0207, 1.0000, 1.0000, 1.0000},
-    {-11.9202, -11.8103, 141.7513, 0.9579, 0.2869, 0.0122, 0.0078, 1.0000, 1.0000, 1.0000},
-    {-19.3894, 6.8139, 148.7963, 0.9885, 0.1503, -0.0096, 0.0136, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 70.0899, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.0370f, -41.8403f, 170.1616f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.6473f, -7.0007f, 173.8581f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.7492f, -11.4113f, 141.5859f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 93.4618f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.7647f, -6.1722f, 133.8629f}, {0.6982f, 0.4422f, 0.5443f, -0.1438f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.9695f, -7.3392f, 132.7408f}, {0.7052f, 0.4104f, -0.5780f, 0.0147f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.3122f, 0.0384f, 35.9421f}, {0.8134f, 0.5798f, 0.0323f, -0.0345f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.1036f, -15.3909f, 42.3736f}, {0.9995f, -0.0028f, 0.0238f, 0.0181f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.5221f, 28.8361f, 27.9605f}, {0.9298f, 0.3677f, -0.0027f, -0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.9592f, -13.6877f, 12.5963f}, {0.9992f, -0.0079f, 0.0037f, 0.0383f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{30.8458f, 1.9422f, 115.6003f}, {0.6377f, 0.2379f, 0.6564f, -0.3253f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.9623f, -1.8849f, 92.6082f}, {0.7324f, -0.0334f, 0.6781f, -0.0517f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-31.6561f, 4.7775f, 116.5750f}, {0.6430f, 0.2880f, -0.6892f, 0.1692f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.5205f, 6.7682f, 93.2370f}, {0.7428f, 0.0542f, -0.6654f, -0.0500f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 66.2268f}, {0.9978f, -0.0255f, 0.0218f, -0.0570f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 66.2268f}, {0.9540f, -0.2991f, -0.0059f, 0.0207f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.9202f, -11.8103f, 141.7513f}, {0.9579f, 0.2869f, 0.0122f, 0.0078f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 70.0899f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.3894f, 6.8139f, 148.7963f}, {0.9885f, 0.1503f, -0.0096f, 0.0136f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64KeyFrame anim_Catherine_Sneak_keyframes[] = {
     {0, anim_Catherine_Sneak_framedata0},
@@ -1794,111 +2041,117 @@ static s64KeyFrame anim_Catherine_Sneak_keyframes[] = {
     {40, anim_Catherine_Sneak_framedata40},
     {52, anim_Catherine_Sneak_framedata52},
 };
+static u16 anim_Catherine_Sneak_framelookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 6,
+};
 
 static s64Transform anim_Catherine_ThrowKnife_framedata0[] = {
-    {22.6434, -69.0379, 160.5652, 0.9879, 0.1440, -0.0156, 0.0547, 1.0000, 1.0000, 1.0000},
-    {13.1289, -34.7992, 163.6184, 0.9879, 0.1440, -0.0156, 0.0547, 1.0000, 1.0000, 1.0000},
-    {15.1781, -39.5078, 131.4410, 0.9879, 0.1440, -0.0156, 0.0547, 1.0000, 1.0000, 1.0000},
-    {0.6904, -11.6712, 91.9896, 0.8205, 0.3295, -0.0124, 0.4670, 1.0000, 1.0000, 1.0000},
-    {24.7508, -15.1528, 133.2336, 0.5219, 0.6047, 0.4644, 0.3825, 1.0000, 1.0000, 1.0000},
-    {-2.7285, -52.1220, 117.2395, 0.1944, 0.4643, -0.7990, 0.3289, 1.0000, 1.0000, 1.0000},
-    {15.1856, -27.4153, 42.7470, 0.9990, 0.0418, 0.0025, 0.0146, 1.0000, 1.0000, 1.0000},
-    {-13.0166, -15.4389, 36.2020, 0.9510, 0.3072, 0.0253, -0.0241, 1.0000, 1.0000, 1.0000},
-    {15.3564, -23.0415, 13.1851, 1.0000, -0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2603, 3.5795, 13.1849, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {28.7447, 5.6507, 134.1138, 0.5642, 0.3193, 0.7368, 0.1921, 1.0000, 1.0000, 1.0000},
-    {25.6304, 20.8149, 116.5874, 0.5705, 0.3010, 0.6345, 0.4258, 1.0000, 1.0000, 1.0000},
-    {5.7158, -37.1273, 104.7212, 0.1982, 0.4274, -0.8122, 0.3442, 1.0000, 1.0000, 1.0000},
-    {20.6246, -25.4979, 90.8502, 0.4831, -0.4523, 0.6868, -0.3005, 1.0000, 1.0000, 1.0000},
-    {13.2057, -6.5870, 64.9276, 0.9404, -0.3398, 0.0015, 0.0115, 1.0000, 1.0000, 1.0000},
-    {-12.1117, -6.9287, 65.4669, 0.9936, -0.1106, -0.0160, -0.0138, 1.0000, 1.0000, 1.0000},
-    {9.0101, -48.2215, 128.1233, 0.8020, 0.3005, -0.0694, 0.5115, 1.0000, 1.0000, 1.0000},
-    {-10.0396, -47.1712, 137.5191, 0.8205, 0.3295, -0.0124, 0.4670, 1.0000, 1.0000, 1.0000},
-    {0.1440, -7.4605, 69.0066, 0.9958, 0.0905, 0.0112, 0.0058, 1.0000, 1.0000, 1.0000},
+    {{22.6434f, -69.0379f, 160.5652f}, {0.9879f, 0.1440f, -0.0156f, 0.0547f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1289f, -34.7992f, 163.6184f}, {0.9879f, 0.1440f, -0.0156f, 0.0547f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.1781f, -39.5078f, 131.4410f}, {0.9879f, 0.1440f, -0.0156f, 0.0547f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.6904f, -11.6712f, 91.9896f}, {0.8205f, 0.3295f, -0.0124f, 0.4670f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.7508f, -15.1528f, 133.2336f}, {0.5219f, 0.6047f, 0.4644f, 0.3825f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-2.7285f, -52.1220f, 117.2395f}, {0.1944f, 0.4643f, -0.7990f, 0.3289f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.1856f, -27.4154f, 42.7470f}, {0.9990f, 0.0418f, 0.0025f, 0.0146f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.0160f, -15.4395f, 36.2017f}, {0.9510f, 0.3072f, 0.0253f, -0.0241f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3564f, -23.0416f, 13.1851f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2603f, 3.5792f, 13.1849f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.7447f, 5.6507f, 134.1139f}, {0.5642f, 0.3193f, 0.7368f, 0.1921f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{25.6304f, 20.8149f, 116.5874f}, {0.5705f, 0.3010f, 0.6345f, 0.4258f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{5.7159f, -37.1273f, 104.7212f}, {0.1982f, 0.4274f, -0.8122f, 0.3442f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{20.6246f, -25.4979f, 90.8503f}, {0.4831f, -0.4523f, 0.6868f, -0.3005f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.2057f, -6.5870f, 64.9276f}, {0.9404f, -0.3398f, 0.0015f, 0.0115f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1117f, -6.9287f, 65.4669f}, {0.9936f, -0.1106f, -0.0160f, -0.0138f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{9.0101f, -48.2215f, 128.1233f}, {0.8020f, 0.3005f, -0.0694f, 0.5115f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.1440f, -7.4605f, 69.0066f}, {0.9958f, 0.0905f, 0.0112f, 0.0058f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-10.0396f, -47.1712f, 137.5191f}, {0.8205f, 0.3295f, -0.0124f, 0.4670f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_ThrowKnife_framedata4[] = {
-    {3.9876, -61.1813, 174.9410, 0.9955, -0.0720, -0.0470, 0.0398, 1.0000, 1.0000, 1.0000},
-    {-1.8933, -26.0203, 173.8183, 0.9800, 0.1972, 0.0112, -0.0242, 1.0000, 1.0000, 1.0000},
-    {-0.9200, -34.7929, 142.4520, 0.9965, 0.0825, -0.0139, 0.0033, 1.0000, 1.0000, 1.0000},
-    {0.1686, -19.7626, 94.3470, 0.9883, 0.1506, -0.0137, 0.0184, 1.0000, 1.0000, 1.0000},
-    {23.6227, -29.3442, 134.9695, 0.6819, 0.4101, 0.5267, 0.2991, 1.0000, 1.0000, 1.0000},
-    {-25.0870, -30.9163, 133.3760, 0.8200, 0.1330, -0.2980, 0.4702, 1.0000, 1.0000, 1.0000},
-    {15.5137, -34.7797, 40.6656, 0.9853, 0.1694, 0.0041, 0.0238, 1.0000, 1.0000, 1.0000},
-    {-13.1802, -14.2462, 37.1475, 0.9584, 0.2829, 0.0232, -0.0288, 1.0000, 1.0000, 1.0000},
-    {15.3567, -23.0410, 13.1839, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2596, 3.5790, 13.1864, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {27.2368, -10.6396, 125.6643, 0.6368, 0.3819, 0.6077, 0.2818, 1.0000, 1.0000, 1.0000},
-    {30.4378, 7.8232, 111.6748, 0.6278, 0.3868, 0.6052, 0.3000, 1.0000, 1.0000, 1.0000},
-    {-34.3819, -43.4429, 118.9003, 0.7364, 0.0152, -0.2324, 0.6352, 1.0000, 1.0000, 1.0000},
-    {-34.3459, -65.7441, 111.6498, 0.6244, -0.5300, -0.4614, 0.3411, 1.0000, 1.0000, 1.0000},
-    {13.3248, -19.7625, 67.1120, 0.9738, -0.2266, -0.0007, 0.0207, 1.0000, 1.0000, 1.0000},
-    {-12.0007, -19.7626, 67.1120, 0.9922, 0.1206, -0.0071, -0.0303, 1.0000, 1.0000, 1.0000},
-    {-12.0884, -35.2850, 142.5093, 0.9941, 0.0258, 0.1054, 0.0077, 1.0000, 1.0000, 1.0000},
-    {-19.7802, -16.7288, 149.4937, 0.9883, 0.1506, -0.0137, 0.0184, 1.0000, 1.0000, 1.0000},
-    {0.1686, -19.7626, 70.9751, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{3.9876f, -61.1813f, 174.9410f}, {0.9955f, -0.0720f, -0.0470f, 0.0398f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.8933f, -26.0203f, 173.8183f}, {0.9800f, 0.1972f, 0.0112f, -0.0242f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.9200f, -34.7929f, 142.4520f}, {0.9965f, 0.0825f, -0.0139f, 0.0033f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.1686f, -19.7626f, 94.3470f}, {0.9883f, 0.1506f, -0.0137f, 0.0184f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.6227f, -29.3442f, 134.9695f}, {0.6819f, 0.4101f, 0.5267f, 0.2991f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-25.0870f, -30.9163f, 133.3760f}, {0.8200f, 0.1330f, -0.2980f, 0.4702f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.5138f, -34.7799f, 40.6656f}, {0.9853f, 0.1694f, 0.0041f, 0.0238f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.1804f, -14.2465f, 37.1474f}, {0.9584f, 0.2829f, 0.0233f, -0.0289f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3568f, -23.0411f, 13.1839f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2605f, 3.5788f, 13.1865f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{27.2367f, -10.6396f, 125.6643f}, {0.6368f, 0.3819f, 0.6077f, 0.2818f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{30.4378f, 7.8232f, 111.6748f}, {0.6278f, 0.3868f, 0.6052f, 0.3000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-34.3820f, -43.4428f, 118.9003f}, {0.7364f, 0.0152f, -0.2324f, 0.6352f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-34.3459f, -65.7442f, 111.6498f}, {0.6244f, -0.5300f, -0.4614f, 0.3411f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.3248f, -19.7626f, 67.1120f}, {0.9738f, -0.2266f, -0.0007f, 0.0207f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.0007f, -19.7626f, 67.1120f}, {0.9922f, 0.1206f, -0.0071f, -0.0303f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.0884f, -35.2850f, 142.5093f}, {0.9941f, 0.0258f, 0.1054f, 0.0077f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.1686f, -19.7626f, 70.9751f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-19.7802f, -16.7288f, 149.4937f}, {0.9883f, 0.1506f, -0.0137f, 0.0184f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_ThrowKnife_framedata6[] = {
-    {3.7676, -56.7548, 175.5241, 0.9989, -0.0397, -0.0248, 0.0050, 1.0000, 1.0000, 1.0000},
-    {-0.2310, -21.3127, 175.4372, 0.9770, 0.2072, 0.0135, -0.0493, 1.0000, 1.0000, 1.0000},
-    {-0.4737, -29.2884, 143.8448, 0.9952, 0.0950, -0.0040, -0.0247, 1.0000, 1.0000, 1.0000},
-    {0.1686, -19.7626, 94.3470, 0.9952, 0.0950, -0.0040, -0.0247, 1.0000, 1.0000, 1.0000},
-    {24.1579, -26.8094, 135.1752, 0.7414, 0.2974, 0.5665, 0.2022, 1.0000, 1.0000, 1.0000},
-    {-24.5422, -24.3772, 135.0114, 0.8951, 0.0129, -0.1950, 0.4007, 1.0000, 1.0000, 1.0000},
-    {15.5137, -34.7797, 40.6656, 0.9853, 0.1694, 0.0041, 0.0238, 1.0000, 1.0000, 1.0000},
-    {-13.1802, -14.2462, 37.1475, 0.9584, 0.2829, 0.0232, -0.0288, 1.0000, 1.0000, 1.0000},
-    {15.3567, -23.0410, 13.1839, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2596, 3.5790, 13.1864, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {28.0053, -12.1897, 120.3101, 0.6795, 0.3332, 0.6101, 0.2346, 1.0000, 1.0000, 1.0000},
-    {32.2253, 3.8440, 103.8194, 0.6320, 0.4029, 0.6409, 0.1658, 1.0000, 1.0000, 1.0000},
-    {-38.2865, -37.5456, 125.4960, 0.8027, -0.0197, -0.2389, 0.5460, 1.0000, 1.0000, 1.0000},
-    {-43.2461, -59.2983, 118.2751, 0.5540, -0.5947, -0.4822, 0.3270, 1.0000, 1.0000, 1.0000},
-    {13.3248, -19.7625, 67.1120, 0.9738, -0.2266, -0.0007, 0.0207, 1.0000, 1.0000, 1.0000},
-    {-12.0007, -19.7626, 67.1120, 0.9922, 0.1206, -0.0071, -0.0303, 1.0000, 1.0000, 1.0000},
-    {-11.6359, -28.8149, 144.2418, 0.9917, -0.0249, 0.1195, -0.0404, 1.0000, 1.0000, 1.0000},
-    {-17.5300, -9.0165, 149.2979, 0.9952, 0.0950, -0.0040, -0.0247, 1.0000, 1.0000, 1.0000},
-    {0.1686, -19.7626, 70.9751, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{3.7676f, -56.7548f, 175.5241f}, {0.9989f, -0.0397f, -0.0248f, 0.0050f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.2310f, -21.3127f, 175.4372f}, {0.9770f, 0.2072f, 0.0135f, -0.0493f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.4737f, -29.2884f, 143.8448f}, {0.9952f, 0.0950f, -0.0040f, -0.0247f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.1686f, -19.7626f, 94.3470f}, {0.9952f, 0.0950f, -0.0040f, -0.0247f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.1579f, -26.8094f, 135.1752f}, {0.7414f, 0.2974f, 0.5665f, 0.2022f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.5422f, -24.3772f, 135.0114f}, {0.8951f, 0.0129f, -0.1950f, 0.4007f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.5138f, -34.7799f, 40.6656f}, {0.9853f, 0.1694f, 0.0041f, 0.0238f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.1804f, -14.2465f, 37.1474f}, {0.9584f, 0.2829f, 0.0233f, -0.0289f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3568f, -23.0411f, 13.1839f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2605f, 3.5788f, 13.1865f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.0053f, -12.1897f, 120.3101f}, {0.6795f, 0.3332f, 0.6101f, 0.2346f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{32.2253f, 3.8440f, 103.8194f}, {0.6320f, 0.4029f, 0.6409f, 0.1658f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-38.2865f, -37.5457f, 125.4960f}, {0.8027f, -0.0197f, -0.2389f, 0.5460f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-43.2461f, -59.2983f, 118.2751f}, {0.5540f, -0.5947f, -0.4822f, 0.3270f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.3248f, -19.7626f, 67.1120f}, {0.9738f, -0.2266f, -0.0007f, 0.0207f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.0007f, -19.7626f, 67.1120f}, {0.9922f, 0.1206f, -0.0071f, -0.0303f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.6359f, -28.8149f, 144.2418f}, {0.9917f, -0.0249f, 0.1195f, -0.0404f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.1686f, -19.7626f, 70.9751f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-17.5300f, -9.0165f, 149.2979f}, {0.9952f, 0.0950f, -0.0040f, -0.0247f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_ThrowKnife_framedata16[] = {
-    {5.3234, -28.5862, 184.2658, 0.9896, 0.1366, 0.0292, -0.0334, 1.0000, 1.0000, 1.0000},
-    {0.1956, 6.2580, 178.6332, 0.9923, -0.1187, -0.0288, 0.0188, 1.0000, 1.0000, 1.0000},
-    {0.0192, -6.6127, 148.6989, 0.9998, 0.0159, -0.0003, -0.0091, 1.0000, 1.0000, 1.0000},
-    {0.0620, -5.0120, 98.3141, 0.9998, 0.0159, -0.0003, -0.0091, 1.0000, 1.0000, 1.0000},
-    {24.5070, -4.7830, 139.4782, 0.7557, 0.1594, 0.6332, -0.0506, 1.0000, 1.0000, 1.0000},
-    {-24.2461, -3.8969, 139.4649, 0.8193, 0.0105, -0.5535, 0.1491, 1.0000, 1.0000, 1.0000},
-    {14.6984, -28.9052, 52.1939, 0.9743, 0.2197, -0.0199, 0.0461, 1.0000, 1.0000, 1.0000},
-    {-14.7177, -7.7734, 40.8260, 0.9866, 0.1622, -0.0111, -0.0133, 1.0000, 1.0000, 1.0000},
-    {15.4729, -14.3606, 26.0994, 0.9912, 0.1123, -0.0320, 0.0624, 1.0000, 1.0000, 1.0000},
-    {-14.2600, 3.5790, 13.1863, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {26.8821, -0.5388, 118.8420, 0.7107, 0.2008, 0.6740, -0.0150, 1.0000, 1.0000, 1.0000},
-    {29.5693, 3.9737, 96.0549, 0.6929, 0.1565, 0.7037, -0.0170, 1.0000, 1.0000, 1.0000},
-    {-30.4537, -6.3226, 119.2551, 0.8034, -0.0713, -0.5355, 0.2503, 1.0000, 1.0000, 1.0000},
-    {-37.2575, -19.6108, 101.1706, 0.6692, -0.2911, -0.6729, 0.1212, 1.0000, 1.0000, 1.0000},
-    {13.2182, -5.0120, 71.0791, 0.9115, -0.4094, 0.0227, 0.0326, 1.0000, 1.0000, 1.0000},
-    {-12.1073, -5.0120, 71.0791, 0.9998, -0.0145, 0.0142, -0.0056, 1.0000, 1.0000, 1.0000},
-    {-11.1500, -6.4238, 149.1382, 0.9984, -0.0289, 0.0440, -0.0183, 1.0000, 1.0000, 1.0000},
-    {-17.6424, 13.7352, 151.0722, 0.9998, 0.0159, -0.0003, -0.0091, 1.0000, 1.0000, 1.0000},
-    {0.0620, -5.0120, 74.9422, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.3234f, -28.5862f, 184.2658f}, {0.9896f, 0.1366f, 0.0292f, -0.0334f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.1956f, 6.2580f, 178.6332f}, {0.9923f, -0.1187f, -0.0288f, 0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0192f, -6.6127f, 148.6989f}, {0.9998f, 0.0159f, -0.0003f, -0.0091f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0620f, -5.0120f, 98.3141f}, {0.9998f, 0.0159f, -0.0003f, -0.0091f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.5070f, -4.7830f, 139.4782f}, {0.7557f, 0.1594f, 0.6332f, -0.0506f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.2461f, -3.8969f, 139.4649f}, {0.8193f, 0.0105f, -0.5535f, 0.1491f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.6984f, -28.9054f, 52.1940f}, {0.9743f, 0.2197f, -0.0199f, 0.0461f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.7176f, -7.7734f, 40.8259f}, {0.9866f, 0.1622f, -0.0111f, -0.0134f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.4729f, -14.3607f, 26.0994f}, {0.9912f, 0.1123f, -0.0320f, 0.0624f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2603f, 3.5787f, 13.1863f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.8822f, -0.5388f, 118.8420f}, {0.7107f, 0.2008f, 0.6740f, -0.0150f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.5693f, 3.9737f, 96.0550f}, {0.6929f, 0.1565f, 0.7037f, -0.0170f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.4537f, -6.3226f, 119.2551f}, {0.8034f, -0.0713f, -0.5355f, 0.2503f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-37.2575f, -19.6109f, 101.1706f}, {0.6692f, -0.2911f, -0.6729f, 0.1212f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.2182f, -5.0120f, 71.0791f}, {0.9115f, -0.4094f, 0.0227f, 0.0326f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1073f, -5.0120f, 71.0791f}, {0.9998f, -0.0145f, 0.0142f, -0.0056f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1500f, -6.4238f, 149.1382f}, {0.9984f, -0.0289f, 0.0440f, -0.0183f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0620f, -5.0120f, 74.9422f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-17.6424f, 13.7352f, 151.0722f}, {0.9998f, 0.0159f, -0.0003f, -0.0091f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_ThrowKnife_framedata25[] = {
-    {5.7124, -17.1539, 187.2770, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0493, 17.3950, 180.5452, 1.0000, 0.0000, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 151.0348, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 100.6246, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4480, 5.5590, 141.7399, 0.7514, 0.1379, 0.6270, -0.1525, 1.0000, 1.0000, 1.0000},
-    {-24.3131, 5.5590, 141.7399, 0.7510, 0.0896, -0.6220, 0.2026, 1.0000, 1.0000, 1.0000},
-    {14.9496, 1.7005, 43.0092, 1.0000, -0.0000, 0.0000, 0.0012, 1.0000, 1.0000, 1.0000},
-    {-13.8958, 1.6727, 43.0074, 1.0000, -0.0000, -0.0000, -0.0012, 1.0000, 1.0000, 1.0000},
-    {15.3567, 3.5787, 13.1868, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2602, 3.5789, 13.1868, 1.0000, -0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {26.4904, 6.1434, 120.6449, 0.7140, 0.1772, 0.6685, -0.1093, 1.0000, 1.0000, 1.0000},
-    {28.8340, 6.6419, 97.3836, 0.7053, 0.0283, 0.7056, -0.0619, 1.0000, 1.0000, 1.0000},
-    {-26.7043, 4.2125, 120.6372, 0.7334, 0.1638, -0.6481, 0.1234, 1.0000, 1.0000, 1.0000},
-    {-29.3517, 2.5449, 97.3965, 0.7179, 0.0072, -0.6937, 0.0577, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 73.3896, 1.0000, -0.0000, -0.0000, 0.0012, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 73.3896, 1.0000, -0.0000, 0.0000, -0.0012, 1.0000, 1.0000, 1.0000},
-    {-11.1706, 3.5788, 151.4774, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-18.0278, 23.6679, 152.7758, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 77.2527, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.7124f, -17.1539f, 187.2770f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0493f, 17.3950f, 180.5452f}, {1.0000f, 0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 151.0348f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 100.6246f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4480f, 5.5590f, 141.7399f}, {0.7514f, 0.1379f, 0.6270f, -0.1525f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3131f, 5.5590f, 141.7399f}, {0.7510f, 0.0896f, -0.6220f, 0.2026f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.9496f, 1.7003f, 43.0092f}, {1.0000f, -0.0000f, 0.0000f, 0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.8956f, 1.6729f, 43.0074f}, {1.0000f, -0.0000f, 0.0000f, -0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3567f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2602f, 3.5788f, 13.1868f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{26.4904f, 6.1434f, 120.6449f}, {0.7140f, 0.1772f, 0.6685f, -0.1093f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.8340f, 6.6419f, 97.3836f}, {0.7053f, 0.0283f, 0.7056f, -0.0619f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.7043f, 4.2125f, 120.6372f}, {0.7334f, 0.1638f, -0.6481f, 0.1234f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.3517f, 2.5449f, 97.3965f}, {0.7179f, 0.0072f, -0.6937f, 0.0577f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 73.3896f}, {1.0000f, -0.0000f, -0.0000f, 0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 73.3896f}, {1.0000f, -0.0000f, -0.0000f, -0.0012f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1706f, 3.5788f, 151.4774f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 77.2527f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0278f, 23.6679f, 152.7758f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64KeyFrame anim_Catherine_ThrowKnife_keyframes[] = {
     {0, anim_Catherine_ThrowKnife_framedata0},
@@ -1907,222 +2160,230 @@ static s64KeyFrame anim_Catherine_ThrowKnife_keyframes[] = {
     {16, anim_Catherine_ThrowKnife_framedata16},
     {25, anim_Catherine_ThrowKnife_framedata25},
 };
+static u16 anim_Catherine_ThrowKnife_framelookup[] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 4,
+};
 
 static s64Transform anim_Catherine_Tired_framedata0[] = {
-    {3.1220, -76.5527, 116.2245, 0.9571, 0.2895, -0.0125, 0.0063, 1.0000, 1.0000, 1.0000},
-    {-3.1696, -49.4460, 138.5357, 0.9835, -0.1804, -0.0082, 0.0114, 1.0000, 1.0000, 1.0000},
-    {-2.2536, -35.3542, 109.1701, 0.9036, 0.4282, -0.0133, 0.0044, 1.0000, 1.0000, 1.0000},
-    {-1.2301, 3.6622, 77.2661, 0.9036, 0.4282, -0.0133, 0.0044, 1.0000, 1.0000, 1.0000},
-    {22.3351, -26.9908, 105.5003, 0.2895, 0.6272, 0.4761, -0.5441, 1.0000, 1.0000, 1.0000},
-    {-26.4068, -26.8222, 104.1427, 0.3379, 0.5917, -0.5083, 0.5266, 1.0000, 1.0000, 1.0000},
-    {14.2375, -10.8474, 39.3321, 0.9756, 0.2183, -0.0167, 0.0151, 1.0000, 1.0000, 1.0000},
-    {-14.4956, -10.9147, 39.3156, 0.9755, 0.2194, -0.0121, 0.0055, 1.0000, 1.0000, 1.0000},
-    {15.3565, 3.5787, 13.1843, 1.0000, -0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2610, 3.5786, 13.1830, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {23.1580, -19.5798, 85.6531, 0.3020, 0.4821, 0.4912, -0.6596, 1.0000, 1.0000, 1.0000},
-    {13.6405, -18.3326, 64.3296, 0.4828, 0.3897, 0.7239, -0.3018, 1.0000, 1.0000, 1.0000},
-    {-27.5605, -20.5607, 83.8371, 0.2974, 0.4657, -0.5644, 0.6133, 1.0000, 1.0000, 1.0000},
-    {-16.2422, -16.9587, 63.6174, 0.5827, 0.1718, -0.7940, 0.0206, 1.0000, 1.0000, 1.0000},
-    {11.9261, 16.2522, 53.1158, 0.8688, -0.4941, -0.0245, -0.0216, 1.0000, 1.0000, 1.0000},
-    {-13.3994, 16.2521, 53.1158, 0.8685, -0.4953, 0.0002, 0.0191, 1.0000, 1.0000, 1.0000},
-    {-13.4288, -35.6581, 109.1392, 0.9100, 0.3753, -0.0540, 0.1675, 1.0000, 1.0000, 1.0000},
-    {-20.6986, -23.9189, 125.3138, 0.9036, 0.4282, -0.0133, 0.0044, 1.0000, 1.0000, 1.0000},
-    {-1.2301, 14.4663, 56.5414, 0.9713, 0.2380, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{3.1220f, -76.5527f, 116.2245f}, {0.9571f, 0.2895f, -0.0125f, 0.0063f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-3.1696f, -49.4460f, 138.5357f}, {0.9835f, -0.1804f, -0.0082f, 0.0114f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-2.2536f, -35.3542f, 109.1701f}, {0.9036f, 0.4282f, -0.0133f, 0.0044f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.2301f, 3.6622f, 77.2661f}, {0.9036f, 0.4282f, -0.0133f, 0.0044f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{22.3351f, -26.9908f, 105.5003f}, {0.2895f, 0.6272f, 0.4761f, -0.5441f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.4068f, -26.8222f, 104.1427f}, {0.3379f, 0.5917f, -0.5083f, 0.5266f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.2375f, -10.8476f, 39.3321f}, {0.9756f, 0.2183f, -0.0167f, 0.0151f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4943f, -10.9152f, 39.3156f}, {0.9755f, 0.2194f, -0.0121f, 0.0055f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3565f, 3.5785f, 13.1843f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2599f, 3.5785f, 13.1829f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.1581f, -19.5798f, 85.6531f}, {0.3020f, 0.4821f, 0.4912f, -0.6596f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.6405f, -18.3326f, 64.3296f}, {0.4828f, 0.3897f, 0.7239f, -0.3018f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-27.5605f, -20.5607f, 83.8371f}, {0.2974f, 0.4657f, -0.5644f, 0.6133f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.2422f, -16.9587f, 63.6174f}, {0.5827f, 0.1718f, -0.7940f, 0.0206f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{11.9261f, 16.2521f, 53.1158f}, {0.8688f, -0.4941f, -0.0245f, -0.0216f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.3994f, 16.2521f, 53.1158f}, {0.8685f, -0.4953f, 0.0002f, 0.0191f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.4288f, -35.6581f, 109.1392f}, {0.9100f, 0.3753f, -0.0540f, 0.1675f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.2301f, 14.4663f, 56.5414f}, {0.9713f, 0.2380f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-20.6986f, -23.9189f, 125.3138f}, {0.9036f, 0.4282f, -0.0133f, 0.0044f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Tired_framedata15[] = {
-    {3.1220, -76.8711, 123.6967, 0.9496, 0.3131, -0.0127, 0.0060, 1.0000, 1.0000, 1.0000},
-    {-3.1696, -45.8105, 140.0613, 0.9472, -0.3203, -0.0065, 0.0124, 1.0000, 1.0000, 1.0000},
-    {-2.2536, -37.9523, 108.4518, 0.9424, 0.3341, -0.0128, 0.0057, 1.0000, 1.0000, 1.0000},
-    {-1.2301, 0.1376, 75.4472, 0.9096, 0.4153, -0.0133, 0.0046, 1.0000, 1.0000, 1.0000},
-    {22.3351, -29.6971, 104.5447, 0.2905, 0.5369, 0.5175, -0.5996, 1.0000, 1.0000, 1.0000},
-    {-26.4068, -29.5672, 103.1830, 0.3086, 0.5400, -0.5633, 0.5439, 1.0000, 1.0000, 1.0000},
-    {14.2040, -10.0620, 39.7500, 0.9788, 0.2038, -0.0167, 0.0138, 1.0000, 1.0000, 1.0000},
-    {-14.4764, -10.1295, 39.7373, 0.9787, 0.2049, -0.0118, 0.0059, 1.0000, 1.0000, 1.0000},
-    {15.3563, 3.5787, 13.1856, 1.0000, -0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2612, 3.5785, 13.1842, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {18.6096, -23.6729, 84.5612, 0.2845, 0.5817, 0.5123, -0.5641, 1.0000, 1.0000, 1.0000},
-    {13.4824, -17.7555, 62.5265, 0.5223, 0.3823, 0.7042, -0.2918, 1.0000, 1.0000, 1.0000},
-    {-24.1942, -22.5401, 83.2185, 0.3079, 0.5374, -0.5645, 0.5457, 1.0000, 1.0000, 1.0000},
-    {-16.4008, -16.3967, 61.9714, 0.6315, 0.1549, -0.7597, 0.0055, 1.0000, 1.0000, 1.0000},
-    {11.9261, 16.8347, 53.9309, 0.8724, -0.4878, -0.0232, -0.0211, 1.0000, 1.0000, 1.0000},
-    {-13.3994, 16.8347, 53.9309, 0.8721, -0.4890, -0.0004, 0.0189, 1.0000, 1.0000, 1.0000},
-    {-13.4288, -38.2570, 108.4296, 0.9153, 0.3623, -0.0516, 0.1682, 1.0000, 1.0000, 1.0000},
-    {-20.6986, -26.0609, 124.2625, 0.9096, 0.4153, -0.0133, 0.0046, 1.0000, 1.0000, 1.0000},
-    {-1.2301, 14.4663, 56.9828, 0.9461, 0.3240, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{3.1220f, -76.8711f, 123.6967f}, {0.9496f, 0.3131f, -0.0127f, 0.0060f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-3.1696f, -45.8105f, 140.0613f}, {0.9472f, -0.3203f, -0.0065f, 0.0124f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-2.2536f, -37.9523f, 108.4518f}, {0.9424f, 0.3341f, -0.0128f, 0.0057f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.2301f, 0.1376f, 75.4472f}, {0.9096f, 0.4153f, -0.0133f, 0.0046f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{22.3351f, -29.6971f, 104.5447f}, {0.2905f, 0.5369f, 0.5175f, -0.5996f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.4068f, -29.5672f, 103.1830f}, {0.3086f, 0.5400f, -0.5633f, 0.5439f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.2040f, -10.0622f, 39.7501f}, {0.9788f, 0.2038f, -0.0167f, 0.0138f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4751f, -10.1299f, 39.7373f}, {0.9787f, 0.2049f, -0.0118f, 0.0059f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3563f, 3.5786f, 13.1857f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2598f, 3.5785f, 13.1841f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{18.6094f, -23.6730f, 84.5612f}, {0.2845f, 0.5817f, 0.5123f, -0.5641f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.4824f, -17.7555f, 62.5266f}, {0.5223f, 0.3823f, 0.7042f, -0.2918f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.1942f, -22.5401f, 83.2185f}, {0.3079f, 0.5374f, -0.5645f, 0.5457f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.4007f, -16.3967f, 61.9715f}, {0.6315f, 0.1549f, -0.7597f, 0.0055f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{11.9261f, 16.8347f, 53.9309f}, {0.8724f, -0.4878f, -0.0232f, -0.0211f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.3994f, 16.8347f, 53.9309f}, {0.8721f, -0.4890f, -0.0004f, 0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.4288f, -38.2570f, 108.4295f}, {0.9153f, 0.3623f, -0.0516f, 0.1682f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.2301f, 14.4663f, 56.9828f}, {0.9461f, 0.3240f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-20.6986f, -26.0609f, 124.2625f}, {0.9096f, 0.4153f, -0.0133f, 0.0046f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Tired_framedata30[] = {
-    {3.1220, -76.5527, 116.2245, 0.9571, 0.2895, -0.0125, 0.0063, 1.0000, 1.0000, 1.0000},
-    {-3.1696, -49.4460, 138.5357, 0.9835, -0.1804, -0.0082, 0.0114, 1.0000, 1.0000, 1.0000},
-    {-2.2536, -35.3542, 109.1701, 0.9036, 0.4282, -0.0133, 0.0044, 1.0000, 1.0000, 1.0000},
-    {-1.2301, 3.6622, 77.2661, 0.9036, 0.4282, -0.0133, 0.0044, 1.0000, 1.0000, 1.0000},
-    {22.3351, -26.9908, 105.5003, 0.2895, 0.6272, 0.4761, -0.5441, 1.0000, 1.0000, 1.0000},
-    {-26.4068, -26.8222, 104.1427, 0.3379, 0.5917, -0.5083, 0.5266, 1.0000, 1.0000, 1.0000},
-    {14.2375, -10.8474, 39.3321, 0.9756, 0.2183, -0.0167, 0.0151, 1.0000, 1.0000, 1.0000},
-    {-14.4956, -10.9147, 39.3156, 0.9755, 0.2194, -0.0121, 0.0055, 1.0000, 1.0000, 1.0000},
-    {15.3565, 3.5787, 13.1843, 1.0000, -0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-14.2610, 3.5786, 13.1830, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {23.1580, -19.5798, 85.6531, 0.3020, 0.4821, 0.4912, -0.6596, 1.0000, 1.0000, 1.0000},
-    {13.6405, -18.3326, 64.3296, 0.4828, 0.3897, 0.7239, -0.3018, 1.0000, 1.0000, 1.0000},
-    {-27.5605, -20.5607, 83.8371, 0.2974, 0.4657, -0.5644, 0.6133, 1.0000, 1.0000, 1.0000},
-    {-16.2422, -16.9587, 63.6174, 0.5827, 0.1718, -0.7940, 0.0206, 1.0000, 1.0000, 1.0000},
-    {11.9261, 16.2522, 53.1158, 0.8688, -0.4941, -0.0245, -0.0216, 1.0000, 1.0000, 1.0000},
-    {-13.3994, 16.2521, 53.1158, 0.8685, -0.4953, 0.0002, 0.0191, 1.0000, 1.0000, 1.0000},
-    {-13.4288, -35.6581, 109.1392, 0.9100, 0.3753, -0.0540, 0.1675, 1.0000, 1.0000, 1.0000},
-    {-20.6986, -23.9189, 125.3138, 0.9036, 0.4282, -0.0133, 0.0044, 1.0000, 1.0000, 1.0000},
-    {-1.2301, 14.4663, 56.5414, 0.9713, 0.2380, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{3.1220f, -76.5527f, 116.2245f}, {0.9571f, 0.2895f, -0.0125f, 0.0063f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-3.1696f, -49.4460f, 138.5357f}, {0.9835f, -0.1804f, -0.0082f, 0.0114f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-2.2536f, -35.3542f, 109.1701f}, {0.9036f, 0.4282f, -0.0133f, 0.0044f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.2301f, 3.6622f, 77.2661f}, {0.9036f, 0.4282f, -0.0133f, 0.0044f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{22.3351f, -26.9908f, 105.5003f}, {0.2895f, 0.6272f, 0.4761f, -0.5441f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-26.4068f, -26.8222f, 104.1427f}, {0.3379f, 0.5917f, -0.5083f, 0.5266f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.2375f, -10.8476f, 39.3321f}, {0.9756f, 0.2183f, -0.0167f, 0.0151f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4943f, -10.9152f, 39.3156f}, {0.9755f, 0.2194f, -0.0121f, 0.0055f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.3565f, 3.5785f, 13.1843f}, {1.0000f, -0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.2599f, 3.5785f, 13.1829f}, {1.0000f, -0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{23.1581f, -19.5798f, 85.6531f}, {0.3020f, 0.4821f, 0.4912f, -0.6596f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.6405f, -18.3326f, 64.3296f}, {0.4828f, 0.3897f, 0.7239f, -0.3018f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-27.5605f, -20.5607f, 83.8371f}, {0.2974f, 0.4657f, -0.5644f, 0.6133f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-16.2422f, -16.9587f, 63.6174f}, {0.5827f, 0.1718f, -0.7940f, 0.0206f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{11.9261f, 16.2521f, 53.1158f}, {0.8688f, -0.4941f, -0.0245f, -0.0216f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.3994f, 16.2521f, 53.1158f}, {0.8685f, -0.4953f, 0.0002f, 0.0191f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.4288f, -35.6581f, 109.1392f}, {0.9100f, 0.3753f, -0.0540f, 0.1675f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-1.2301f, 14.4663f, 56.5414f}, {0.9713f, 0.2380f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-20.6986f, -23.9189f, 125.3138f}, {0.9036f, 0.4282f, -0.0133f, 0.0044f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64KeyFrame anim_Catherine_Tired_keyframes[] = {
     {0, anim_Catherine_Tired_framedata0},
     {15, anim_Catherine_Tired_framedata15},
     {30, anim_Catherine_Tired_framedata30},
 };
+static u16 anim_Catherine_Tired_framelookup[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2,
+};
 
 static s64Transform anim_Catherine_Walk_framedata0[] = {
-    {5.7124, -17.1539, 180.1142, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0493, 17.3950, 173.3824, 1.0000, 0.0000, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 143.8720, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 93.4618, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4480, 5.5590, 134.5771, 0.7809, 0.1644, 0.5520, -0.2419, 1.0000, 1.0000, 1.0000},
-    {-24.3131, 5.5590, 134.5771, 0.6751, 0.4356, -0.5906, 0.0755, 1.0000, 1.0000, 1.0000},
-    {15.1369, 15.4089, 38.1940, 0.8601, 0.5076, 0.0398, -0.0303, 1.0000, 1.0000, 1.0000},
-    {-13.9252, -11.7708, 39.9400, 0.9686, -0.2327, 0.0319, 0.0818, 1.0000, 1.0000, 1.0000},
-    {14.5936, 42.4254, 25.4318, 0.9298, 0.3677, -0.0027, -0.0188, 1.0000, 1.0000, 1.0000},
-    {-15.3264, -23.7476, 12.5973, 0.9745, -0.2232, 0.0166, 0.0178, 1.0000, 1.0000, 1.0000},
-    {29.1417, 3.3649, 114.0183, 0.7171, 0.0494, 0.5999, -0.3513, 1.0000, 1.0000, 1.0000},
-    {30.0669, -8.3029, 93.7738, 0.7211, -0.1703, 0.6422, -0.1965, 1.0000, 1.0000, 1.0000},
-    {-30.5495, 16.8337, 117.6407, 0.6118, 0.3648, -0.6806, 0.1716, 1.0000, 1.0000, 1.0000},
-    {-29.6587, 21.5148, 94.6796, 0.7292, 0.1340, -0.6635, -0.1002, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 66.2268, 0.9710, 0.2317, 0.0068, -0.0589, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 66.2268, 0.9706, -0.2253, 0.0251, 0.0804, 1.0000, 1.0000, 1.0000},
-    {-11.1706, 3.5788, 144.3146, 0.9899, 0.1399, 0.0185, -0.0099, 1.0000, 1.0000, 1.0000},
-    {-18.0278, 23.6679, 145.6130, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 70.0899, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.7124f, -17.1539f, 180.1142f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0493f, 17.3950f, 173.3824f}, {1.0000f, 0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 143.8720f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 93.4618f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4480f, 5.5590f, 134.5771f}, {0.7809f, 0.1644f, 0.5520f, -0.2419f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3131f, 5.5590f, 134.5771f}, {0.6751f, 0.4356f, -0.5906f, 0.0755f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.1369f, 15.4088f, 38.1939f}, {0.8601f, 0.5076f, 0.0398f, -0.0303f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.9246f, -11.7706f, 39.9398f}, {0.9686f, -0.2327f, 0.0319f, 0.0818f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.5936f, 42.4253f, 25.4317f}, {0.9298f, 0.3677f, -0.0027f, -0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-15.3253f, -23.7477f, 12.5971f}, {0.9745f, -0.2232f, 0.0166f, 0.0178f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.1417f, 3.3649f, 114.0183f}, {0.7171f, 0.0494f, 0.5999f, -0.3513f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{30.0668f, -8.3029f, 93.7738f}, {0.7211f, -0.1703f, 0.6422f, -0.1965f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.5495f, 16.8337f, 117.6407f}, {0.6118f, 0.3648f, -0.6806f, 0.1716f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.6587f, 21.5148f, 94.6796f}, {0.7292f, 0.1340f, -0.6635f, -0.1002f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 66.2268f}, {0.9710f, 0.2317f, 0.0068f, -0.0589f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 66.2268f}, {0.9706f, -0.2253f, 0.0250f, 0.0804f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1706f, 3.5788f, 144.3146f}, {0.9899f, 0.1399f, 0.0185f, -0.0099f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 70.0899f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0278f, 23.6679f, 145.6130f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Walk_framedata4[] = {
-    {5.6833, -18.7516, 181.0085, 0.9999, 0.0058, 0.0121, -0.0066, 1.0000, 1.0000, 1.0000},
-    {-0.0784, 15.7973, 174.2767, 0.9992, -0.0338, -0.0197, 0.0083, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 144.7663, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 94.3561, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4189, 3.9613, 135.4714, 0.7696, 0.2083, 0.5709, -0.1960, 1.0000, 1.0000, 1.0000},
-    {-24.3422, 3.9613, 135.4714, 0.7162, 0.3758, -0.5798, 0.0985, 1.0000, 1.0000, 1.0000},
-    {14.7157, 16.6792, 40.4535, 0.8295, 0.5564, 0.0357, -0.0332, 1.0000, 1.0000, 1.0000},
-    {-13.9044, -13.9633, 41.1874, 0.9927, 0.0736, -0.0071, 0.0957, 1.0000, 1.0000, 1.0000},
-    {14.6403, 44.9828, 30.8640, 0.7606, 0.6490, -0.0019, -0.0165, 1.0000, 1.0000, 1.0000},
-    {-14.6323, -7.7835, 11.9587, 1.0000, -0.0022, 0.0053, 0.0025, 1.0000, 1.0000, 1.0000},
-    {29.0156, 4.6102, 114.7842, 0.6960, 0.0975, 0.6477, -0.2943, 1.0000, 1.0000, 1.0000},
-    {28.9268, -3.3843, 92.8089, 0.7435, -0.1261, 0.6360, -0.1637, 1.0000, 1.0000, 1.0000},
-    {-30.8074, 12.9082, 117.2777, 0.6427, 0.2806, -0.6737, 0.2329, 1.0000, 1.0000, 1.0000},
-    {-29.2802, 12.6095, 93.8790, 0.7519, 0.0678, -0.6558, 0.0017, 1.0000, 1.0000, 1.0000},
-    {13.1271, 1.9811, 67.1211, 0.9577, 0.2817, 0.0161, -0.0566, 1.0000, 1.0000, 1.0000},
-    {-12.1984, 1.9811, 67.1211, 0.9662, -0.2346, 0.0320, 0.1018, 1.0000, 1.0000, 1.0000},
-    {-11.1997, 1.9811, 145.2089, 0.9942, 0.1059, 0.0165, -0.0098, 1.0000, 1.0000, 1.0000},
-    {-18.0569, 22.0702, 146.5073, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 70.9842, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.6833f, -18.7516f, 181.0085f}, {0.9999f, 0.0058f, 0.0121f, -0.0066f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0784f, 15.7973f, 174.2767f}, {0.9992f, -0.0338f, -0.0197f, 0.0083f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 144.7663f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 94.3561f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4189f, 3.9613f, 135.4714f}, {0.7696f, 0.2083f, 0.5709f, -0.1960f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3422f, 3.9613f, 135.4714f}, {0.7162f, 0.3758f, -0.5798f, 0.0985f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.7157f, 16.6791f, 40.4535f}, {0.8295f, 0.5564f, 0.0357f, -0.0332f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.9038f, -13.9634f, 41.1873f}, {0.9927f, 0.0736f, -0.0071f, 0.0957f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.6403f, 44.9827f, 30.8638f}, {0.7606f, 0.6490f, -0.0019f, -0.0165f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.6319f, -7.7838f, 11.9588f}, {1.0000f, -0.0022f, 0.0053f, 0.0025f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.0156f, 4.6102f, 114.7842f}, {0.6960f, 0.0975f, 0.6477f, -0.2943f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.9267f, -3.3843f, 92.8089f}, {0.7435f, -0.1261f, 0.6360f, -0.1637f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.8074f, 12.9082f, 117.2777f}, {0.6427f, 0.2806f, -0.6737f, 0.2329f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.2803f, 12.6095f, 93.8791f}, {0.7519f, 0.0678f, -0.6558f, 0.0017f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1271f, 1.9811f, 67.1211f}, {0.9577f, 0.2817f, 0.0161f, -0.0566f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1984f, 1.9811f, 67.1211f}, {0.9662f, -0.2346f, 0.0320f, 0.1018f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1997f, 1.9811f, 145.2089f}, {0.9942f, 0.1059f, 0.0165f, -0.0098f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 70.9842f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0569f, 22.0702f, 146.5073f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Walk_framedata7[] = {
-    {5.6978, -17.9527, 185.2252, 0.9991, -0.0407, -0.0091, 0.0044, 1.0000, 1.0000, 1.0000},
-    {-0.0639, 16.5962, 178.4934, 0.9998, 0.0177, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 148.9830, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 98.5728, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4334, 4.7602, 139.6881, 0.7476, 0.2601, 0.5876, -0.1679, 1.0000, 1.0000, 1.0000},
-    {-24.3277, 4.7602, 139.6881, 0.7489, 0.2885, -0.5737, 0.1635, 1.0000, 1.0000, 1.0000},
-    {13.6343, -12.2116, 44.7911, 0.8250, 0.5629, 0.0362, -0.0356, 1.0000, 1.0000, 1.0000},
-    {-13.4255, 8.1800, 41.3546, 0.9956, 0.0617, 0.0054, 0.0696, 1.0000, 1.0000, 1.0000},
-    {13.6459, 16.2378, 35.6425, 0.7633, 0.6459, -0.0017, -0.0164, 1.0000, 1.0000, 1.0000},
-    {-14.6300, 13.6471, 12.0000, 1.0000, -0.0022, 0.0053, 0.0025, 1.0000, 1.0000, 1.0000},
-    {28.6745, 7.9639, 119.1635, 0.6716, 0.1895, 0.6847, -0.2103, 1.0000, 1.0000, 1.0000},
-    {28.2486, 5.9891, 95.8665, 0.7637, -0.0474, 0.6375, -0.0899, 1.0000, 1.0000, 1.0000},
-    {-30.3518, 9.4358, 119.8210, 0.6671, 0.2056, -0.6494, 0.3016, 1.0000, 1.0000, 1.0000},
-    {-28.6375, 4.1475, 97.0391, 0.7588, -0.0290, -0.6399, 0.1181, 1.0000, 1.0000, 1.0000},
-    {13.1416, 2.7800, 71.3378, 0.9732, -0.2217, 0.0039, -0.0617, 1.0000, 1.0000, 1.0000},
-    {-12.1839, 2.7800, 71.3378, 0.9903, 0.1230, -0.0115, 0.0631, 1.0000, 1.0000, 1.0000},
-    {-11.1851, 2.7800, 149.4256, 0.9988, 0.0470, 0.0131, -0.0096, 1.0000, 1.0000, 1.0000},
-    {-18.0424, 22.8691, 150.7240, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 75.2009, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.6978f, -17.9527f, 185.2252f}, {0.9991f, -0.0407f, -0.0091f, 0.0044f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0639f, 16.5962f, 178.4934f}, {0.9998f, 0.0177f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 148.9830f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 98.5728f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4334f, 4.7602f, 139.6881f}, {0.7476f, 0.2601f, 0.5876f, -0.1679f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3277f, 4.7602f, 139.6881f}, {0.7489f, 0.2885f, -0.5737f, 0.1635f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.6343f, -12.2118f, 44.7910f}, {0.8250f, 0.5629f, 0.0362f, -0.0356f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.4257f, 8.1799f, 41.3547f}, {0.9956f, 0.0617f, 0.0054f, 0.0696f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.6459f, 16.2377f, 35.6425f}, {0.7633f, 0.6459f, -0.0017f, -0.0164f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.6304f, 13.6471f, 12.0002f}, {1.0000f, -0.0022f, 0.0053f, 0.0025f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.6745f, 7.9639f, 119.1635f}, {0.6716f, 0.1895f, 0.6847f, -0.2103f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.2486f, 5.9891f, 95.8665f}, {0.7637f, -0.0474f, 0.6375f, -0.0899f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.3518f, 9.4358f, 119.8210f}, {0.6671f, 0.2056f, -0.6494f, 0.3016f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-28.6376f, 4.1475f, 97.0391f}, {0.7588f, -0.0290f, -0.6399f, 0.1181f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1416f, 2.7800f, 71.3378f}, {0.9732f, -0.2217f, 0.0039f, -0.0617f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1839f, 2.7800f, 71.3378f}, {0.9903f, 0.1230f, -0.0115f, 0.0631f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1851f, 2.7800f, 149.4256f}, {0.9988f, 0.0470f, 0.0131f, -0.0096f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 75.2009f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0424f, 22.8691f, 150.7240f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Walk_framedata13[] = {
-    {5.7124, -17.1539, 180.1142, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0493, 17.3950, 173.3824, 1.0000, 0.0000, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 143.8720, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 93.4618, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4480, 5.5590, 134.5771, 0.6908, 0.4186, 0.5831, -0.0869, 1.0000, 1.0000, 1.0000},
-    {-24.3131, 5.5590, 134.5771, 0.7611, 0.1265, -0.5472, 0.3244, 1.0000, 1.0000, 1.0000},
-    {12.8058, -13.1552, 40.7402, 0.9842, -0.1771, 0.0059, -0.0025, 1.0000, 1.0000, 1.0000},
-    {-14.0512, 19.0218, 40.0035, 0.8891, 0.4577, 0.0020, -0.0018, 1.0000, 1.0000, 1.0000},
-    {12.8474, -21.7938, 12.1318, 0.9806, -0.1961, -0.0008, 0.0029, 1.0000, 1.0000, 1.0000},
-    {-14.4682, 44.3998, 24.2295, 0.9510, 0.3092, 0.0039, -0.0003, 1.0000, 1.0000, 1.0000},
-    {29.9564, 15.3876, 116.6170, 0.5924, 0.3390, 0.7238, -0.1009, 1.0000, 1.0000, 1.0000},
-    {28.4246, 22.7064, 94.4603, 0.6946, 0.1808, 0.6755, 0.1692, 1.0000, 1.0000, 1.0000},
-    {-28.4336, 0.7458, 114.2618, 0.6953, 0.1186, -0.5846, 0.4009, 1.0000, 1.0000, 1.0000},
-    {-27.1188, -10.9394, 93.9728, 0.6829, -0.2410, -0.6340, 0.2712, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 66.2268, 0.9658, -0.2568, 0.0372, 0.0006, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 66.2268, 0.9560, 0.2932, 0.0021, 0.0026, 1.0000, 1.0000, 1.0000},
-    {-11.1706, 3.5788, 144.3146, 0.9996, -0.0256, 0.0087, -0.0093, 1.0000, 1.0000, 1.0000},
-    {-18.0278, 23.6679, 145.6130, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 70.0899, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.7124f, -17.1539f, 180.1142f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0493f, 17.3950f, 173.3824f}, {1.0000f, 0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 143.8720f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 93.4618f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4480f, 5.5590f, 134.5771f}, {0.6908f, 0.4186f, 0.5831f, -0.0869f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3131f, 5.5590f, 134.5771f}, {0.7611f, 0.1265f, -0.5472f, 0.3244f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8058f, -13.1553f, 40.7402f}, {0.9842f, -0.1771f, 0.0059f, -0.0025f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.0518f, 19.0217f, 40.0035f}, {0.8891f, 0.4577f, 0.0020f, -0.0018f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8474f, -21.7938f, 12.1317f}, {0.9806f, -0.1961f, -0.0008f, 0.0029f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4698f, 44.3997f, 24.2296f}, {0.9510f, 0.3092f, 0.0039f, -0.0003f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.9563f, 15.3876f, 116.6170f}, {0.5924f, 0.3390f, 0.7238f, -0.1009f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.4245f, 22.7064f, 94.4603f}, {0.6946f, 0.1808f, 0.6755f, 0.1692f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-28.4336f, 0.7458f, 114.2618f}, {0.6953f, 0.1186f, -0.5846f, 0.4009f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-27.1188f, -10.9394f, 93.9728f}, {0.6829f, -0.2410f, -0.6340f, 0.2712f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 66.2268f}, {0.9658f, -0.2568f, 0.0372f, 0.0006f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 66.2268f}, {0.9560f, 0.2932f, 0.0021f, 0.0026f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1706f, 3.5788f, 144.3146f}, {0.9996f, -0.0256f, 0.0087f, -0.0093f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 70.0899f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0278f, 23.6679f, 145.6130f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Walk_framedata17[] = {
-    {5.6833, -18.7516, 181.0085, 0.9999, 0.0001, 0.0121, -0.0067, 1.0000, 1.0000, 1.0000},
-    {-0.0784, 15.7973, 174.2767, 0.9996, -0.0178, -0.0198, 0.0080, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 144.7663, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 94.3561, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4189, 3.9613, 135.4714, 0.7144, 0.3411, 0.5977, -0.1266, 1.0000, 1.0000, 1.0000},
-    {-24.3422, 3.9613, 135.4714, 0.7735, 0.2339, -0.5533, 0.2021, 1.0000, 1.0000, 1.0000},
-    {14.0095, -14.4739, 41.4663, 0.9932, 0.0884, 0.0153, 0.0742, 1.0000, 1.0000, 1.0000},
-    {-14.9999, 15.8292, 40.1013, 0.7968, 0.6027, 0.0143, -0.0396, 1.0000, 1.0000, 1.0000},
-    {12.8476, -7.4125, 12.4515, 1.0000, -0.0026, -0.0014, 0.0027, 1.0000, 1.0000, 1.0000},
-    {-14.4681, 45.0398, 33.8167, 0.8020, 0.5973, 0.0038, 0.0010, 1.0000, 1.0000, 1.0000},
-    {28.7505, 10.8302, 115.8865, 0.6339, 0.3073, 0.6998, -0.1183, 1.0000, 1.0000, 1.0000},
-    {28.6924, 15.9792, 93.0761, 0.7264, 0.0936, 0.6742, 0.0945, 1.0000, 1.0000, 1.0000},
-    {-30.7392, 5.6895, 115.2490, 0.6828, 0.1511, -0.6207, 0.3547, 1.0000, 1.0000, 1.0000},
-    {-29.0952, -3.2784, 93.6436, 0.6944, -0.1729, -0.6665, 0.2093, 1.0000, 1.0000, 1.0000},
-    {13.1271, 1.9812, 67.1211, 0.9657, -0.2534, 0.0309, 0.0468, 1.0000, 1.0000, 1.0000},
-    {-12.1984, 1.9812, 67.1211, 0.9643, 0.2629, 0.0227, -0.0222, 1.0000, 1.0000, 1.0000},
-    {-11.1997, 1.9811, 145.2089, 0.9999, 0.0088, 0.0108, -0.0094, 1.0000, 1.0000, 1.0000},
-    {-18.0569, 22.0702, 146.5073, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0291, 1.9811, 70.9842, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.6833f, -18.7516f, 181.0085f}, {0.9999f, 0.0001f, 0.0121f, -0.0067f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0784f, 15.7973f, 174.2767f}, {0.9996f, -0.0178f, -0.0198f, 0.0080f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 144.7663f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 94.3561f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4189f, 3.9613f, 135.4714f}, {0.7144f, 0.3411f, 0.5977f, -0.1266f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3422f, 3.9613f, 135.4714f}, {0.7735f, 0.2339f, -0.5533f, 0.2021f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.0095f, -14.4740f, 41.4663f}, {0.9932f, 0.0884f, 0.0153f, 0.0742f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-15.0004f, 15.8290f, 40.1011f}, {0.7968f, 0.6027f, 0.0143f, -0.0397f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8476f, -7.4123f, 12.4514f}, {1.0000f, -0.0026f, -0.0014f, 0.0027f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4699f, 45.0396f, 33.8168f}, {0.8020f, 0.5973f, 0.0038f, 0.0010f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.7504f, 10.8301f, 115.8865f}, {0.6339f, 0.3073f, 0.6998f, -0.1183f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.6923f, 15.9792f, 93.0761f}, {0.7264f, 0.0936f, 0.6742f, 0.0945f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.7393f, 5.6895f, 115.2490f}, {0.6828f, 0.1511f, -0.6207f, 0.3547f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.0952f, -3.2784f, 93.6436f}, {0.6944f, -0.1729f, -0.6665f, 0.2093f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1271f, 1.9812f, 67.1211f}, {0.9657f, -0.2534f, 0.0309f, 0.0468f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1984f, 1.9811f, 67.1211f}, {0.9643f, 0.2629f, 0.0228f, -0.0222f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1997f, 1.9811f, 145.2089f}, {0.9999f, 0.0088f, 0.0108f, -0.0094f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0291f, 1.9811f, 70.9842f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0569f, 22.0702f, 146.5073f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Walk_framedata20[] = {
-    {5.6978, -17.9527, 185.2252, 0.9991, -0.0407, -0.0091, 0.0044, 1.0000, 1.0000, 1.0000},
-    {-0.0639, 16.5962, 178.4934, 0.9999, 0.0134, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 148.9830, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 98.5728, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4335, 4.7602, 139.6881, 0.7452, 0.2717, 0.5855, -0.1677, 1.0000, 1.0000, 1.0000},
-    {-24.3277, 4.7602, 139.6881, 0.7451, 0.3171, -0.5700, 0.1393, 1.0000, 1.0000, 1.0000},
-    {13.1589, -1.4088, 41.1357, 0.9931, 0.1102, 0.0055, 0.0385, 1.0000, 1.0000, 1.0000},
-    {-15.5714, -9.9416, 43.8357, 0.8248, 0.5640, 0.0003, -0.0404, 1.0000, 1.0000, 1.0000},
-    {12.8478, 6.9688, 12.4515, 1.0000, -0.0026, -0.0014, 0.0027, 1.0000, 1.0000, 1.0000},
-    {-14.4689, 18.5140, 34.7751, 0.8020, 0.5973, 0.0038, 0.0010, 1.0000, 1.0000, 1.0000},
-    {28.8148, 8.2720, 119.2435, 0.6674, 0.2372, 0.6843, -0.1732, 1.0000, 1.0000, 1.0000},
-    {29.0530, 9.0189, 95.8723, 0.7448, -0.0118, 0.6672, -0.0058, 1.0000, 1.0000, 1.0000},
-    {-30.8345, 10.8390, 120.3603, 0.6722, 0.2464, -0.6474, 0.2614, 1.0000, 1.0000, 1.0000},
-    {-30.2947, 7.9284, 97.0976, 0.7078, -0.0723, -0.6936, 0.1132, 1.0000, 1.0000, 1.0000},
-    {13.1416, 2.7800, 71.3378, 0.9986, -0.0387, 0.0312, 0.0201, 1.0000, 1.0000, 1.0000},
-    {-12.1839, 2.7800, 71.3378, 0.9826, -0.1837, 0.0279, -0.0013, 1.0000, 1.0000, 1.0000},
-    {-11.1852, 2.7800, 149.4256, 0.9975, 0.0679, 0.0143, -0.0097, 1.0000, 1.0000, 1.0000},
-    {-18.0424, 22.8691, 150.7240, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0146, 2.7800, 75.2009, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.6978f, -17.9527f, 185.2252f}, {0.9991f, -0.0407f, -0.0091f, 0.0044f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0639f, 16.5962f, 178.4934f}, {0.9999f, 0.0134f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 148.9830f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 98.5728f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4335f, 4.7602f, 139.6881f}, {0.7452f, 0.2717f, 0.5855f, -0.1677f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3277f, 4.7602f, 139.6881f}, {0.7451f, 0.3171f, -0.5700f, 0.1393f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1589f, -1.4089f, 41.1357f}, {0.9931f, 0.1102f, 0.0055f, 0.0385f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-15.5708f, -9.9420f, 43.8354f}, {0.8248f, 0.5640f, 0.0004f, -0.0404f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{12.8478f, 6.9690f, 12.4515f}, {1.0000f, -0.0026f, -0.0014f, 0.0027f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-14.4695f, 18.5139f, 34.7751f}, {0.8020f, 0.5973f, 0.0038f, 0.0010f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{28.8148f, 8.2720f, 119.2435f}, {0.6674f, 0.2372f, 0.6843f, -0.1732f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.0531f, 9.0189f, 95.8723f}, {0.7448f, -0.0118f, 0.6672f, -0.0058f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.8346f, 10.8389f, 120.3603f}, {0.6722f, 0.2464f, -0.6474f, 0.2614f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.2948f, 7.9284f, 97.0976f}, {0.7078f, -0.0723f, -0.6936f, 0.1132f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1416f, 2.7800f, 71.3378f}, {0.9986f, -0.0387f, 0.0312f, 0.0201f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1839f, 2.7800f, 71.3378f}, {0.9826f, -0.1837f, 0.0279f, -0.0014f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1852f, 2.7800f, 149.4256f}, {0.9975f, 0.0679f, 0.0143f, -0.0097f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0146f, 2.7800f, 75.2009f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0424f, 22.8691f, 150.7240f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64Transform anim_Catherine_Walk_framedata26[] = {
-    {5.7124, -17.1539, 180.1142, 1.0000, 0.0000, 0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {-0.0493, 17.3950, 173.3824, 1.0000, 0.0000, -0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 143.8720, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 93.4618, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
-    {24.4480, 5.5590, 134.5771, 0.7809, 0.1644, 0.5520, -0.2419, 1.0000, 1.0000, 1.0000},
-    {-24.3131, 5.5590, 134.5771, 0.6751, 0.4356, -0.5906, 0.0755, 1.0000, 1.0000, 1.0000},
-    {15.1369, 15.4089, 38.1940, 0.8601, 0.5076, 0.0398, -0.0303, 1.0000, 1.0000, 1.0000},
-    {-13.9252, -11.7708, 39.9400, 0.9686, -0.2327, 0.0319, 0.0818, 1.0000, 1.0000, 1.0000},
-    {14.5936, 42.4254, 25.4318, 0.9298, 0.3677, -0.0027, -0.0188, 1.0000, 1.0000, 1.0000},
-    {-15.3264, -23.7476, 12.5973, 0.9745, -0.2232, 0.0166, 0.0178, 1.0000, 1.0000, 1.0000},
-    {29.1417, 3.3649, 114.0183, 0.7171, 0.0494, 0.5999, -0.3513, 1.0000, 1.0000, 1.0000},
-    {30.0669, -8.3029, 93.7738, 0.7211, -0.1703, 0.6422, -0.1965, 1.0000, 1.0000, 1.0000},
-    {-30.5495, 16.8337, 117.6407, 0.6118, 0.3648, -0.6806, 0.1716, 1.0000, 1.0000, 1.0000},
-    {-29.6587, 21.5148, 94.6796, 0.7292, 0.1340, -0.6635, -0.1002, 1.0000, 1.0000, 1.0000},
-    {13.1562, 3.5788, 66.2268, 0.9710, 0.2317, 0.0068, -0.0589, 1.0000, 1.0000, 1.0000},
-    {-12.1693, 3.5788, 66.2268, 0.9706, -0.2253, 0.0251, 0.0804, 1.0000, 1.0000, 1.0000},
-    {-11.1706, 3.5788, 144.3146, 0.9899, 0.1399, 0.0185, -0.0099, 1.0000, 1.0000, 1.0000},
-    {-18.0278, 23.6679, 145.6130, 1.0000, 0.0000, -0.0000, -0.0000, 1.0000, 1.0000, 1.0000},
-    {0.0000, 3.5788, 70.0899, 1.0000, 0.0000, 0.0000, 0.0000, 1.0000, 1.0000, 1.0000},
+    {{5.7124f, -17.1539f, 180.1142f}, {1.0000f, 0.0000f, 0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-0.0493f, 17.3950f, 173.3824f}, {1.0000f, 0.0000f, -0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 143.8720f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 93.4618f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{24.4480f, 5.5590f, 134.5771f}, {0.7809f, 0.1644f, 0.5520f, -0.2419f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-24.3131f, 5.5590f, 134.5771f}, {0.6751f, 0.4356f, -0.5906f, 0.0755f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{15.1369f, 15.4088f, 38.1939f}, {0.8601f, 0.5076f, 0.0398f, -0.0303f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-13.9246f, -11.7706f, 39.9398f}, {0.9686f, -0.2327f, 0.0319f, 0.0818f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{14.5936f, 42.4253f, 25.4317f}, {0.9298f, 0.3677f, -0.0027f, -0.0188f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-15.3253f, -23.7477f, 12.5971f}, {0.9745f, -0.2232f, 0.0166f, 0.0178f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{29.1417f, 3.3649f, 114.0183f}, {0.7171f, 0.0494f, 0.5999f, -0.3513f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{30.0668f, -8.3029f, 93.7738f}, {0.7211f, -0.1703f, 0.6422f, -0.1965f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-30.5495f, 16.8337f, 117.6407f}, {0.6118f, 0.3648f, -0.6806f, 0.1716f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-29.6587f, 21.5148f, 94.6796f}, {0.7292f, 0.1340f, -0.6635f, -0.1002f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{13.1562f, 3.5788f, 66.2268f}, {0.9710f, 0.2317f, 0.0068f, -0.0589f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-12.1693f, 3.5788f, 66.2268f}, {0.9706f, -0.2253f, 0.0250f, 0.0804f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-11.1706f, 3.5788f, 144.3146f}, {0.9899f, 0.1399f, 0.0185f, -0.0099f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{0.0000f, 3.5788f, 70.0899f}, {1.0000f, 0.0000f, 0.0000f, 0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
+    {{-18.0278f, 23.6679f, 145.6130f}, {1.0000f, 0.0000f, -0.0000f, -0.0000f}, {1.0000f, 1.0000f, 1.0000f}},
 };
 static s64KeyFrame anim_Catherine_Walk_keyframes[] = {
     {0, anim_Catherine_Walk_framedata0},
@@ -2133,6 +2394,10 @@ static s64KeyFrame anim_Catherine_Walk_keyframes[] = {
     {20, anim_Catherine_Walk_framedata20},
     {26, anim_Catherine_Walk_framedata26},
 };
+static u16 anim_Catherine_Walk_framelookup[] = {
+    0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+    3, 4, 4, 4, 5, 5, 5, 5, 5, 5, 6,
+};
 
 
 /*********************************
@@ -2140,36 +2405,36 @@ static s64KeyFrame anim_Catherine_Walk_keyframes[] = {
 *********************************/
 
 static s64Mesh meshes_Catherine[] = {
-    {"Bang", 0, gfx_Catherine_Bang, 2},
-    {"Ponytail", 0, gfx_Catherine_Ponytail, 2},
-    {"Head", 0, gfx_Catherine_Head, 3},
-    {"Chest", 0, gfx_Catherine_Chest, 17},
-    {"LeftArm", 0, gfx_Catherine_LeftArm, 3},
-    {"RightArm", 0, gfx_Catherine_RightArm, 3},
-    {"LeftFemur", 0, gfx_Catherine_LeftFemur, 14},
-    {"RightFemur", 0, gfx_Catherine_RightFemur, 15},
-    {"LeftFoot", 0, gfx_Catherine_LeftFoot, 6},
-    {"RightFoot", 0, gfx_Catherine_RightFoot, 7},
-    {"LeftForearm", 0, gfx_Catherine_LeftForearm, 4},
-    {"LeftHand", 0, gfx_Catherine_LeftHand, 10},
-    {"RightForearm", 0, gfx_Catherine_RightForearm, 5},
-    {"RightHand", 0, gfx_Catherine_RightHand, 12},
-    {"LeftLeg", 0, gfx_Catherine_LeftLeg, 18},
-    {"RightLeg", 0, gfx_Catherine_RightLeg, 18},
-    {"Pad", 0, gfx_Catherine_Pad, 3},
-    {"Sword", 0, gfx_Catherine_Sword, -1},
-    {"Pelvis", 0, gfx_Catherine_Pelvis, -1},
+    {"Bang", 0, gfx_Catherine_Bang, 2, {-0.0637f, -2.4822f, -13.2795f, 20.2214f}, 0, NULL},
+    {"Ponytail", 0, gfx_Catherine_Ponytail, 2, {-1.2593f, 29.0750f, 15.9586f, 35.9990f}, 0, NULL},
+    {"Head", 0, gfx_Catherine_Head, 3, {-0.2170f, -1.0364f, 22.4603f, 34.7577f}, 0, NULL},
+    {"Chest", 0, gfx_Catherine_Chest, 17, {0.0000f, 0.5674f, 20.2647f, 41.3485f}, 0, NULL},
+    {"LeftArm", 0, gfx_Catherine_LeftArm, 3, {11.1494f, 2.7274f, -3.4084f, 20.1144f}, 0, NULL},
+    {"RightArm", 0, gfx_Catherine_RightArm, 3, {-11.2843f, 2.7274f, -3.4084f, 20.1144f}, 0, NULL},
+    {"LeftFemur", 0, gfx_Catherine_LeftFemur, 14, {-1.3610f, 2.6906f, -16.2916f, 19.5349f}, 0, NULL},
+    {"RightFemur", 0, gfx_Catherine_RightFemur, 15, {0.3070f, 2.7183f, -16.2898f, 19.5349f}, 0, NULL},
+    {"LeftFoot", 0, gfx_Catherine_LeftFoot, 6, {-1.2454f, -9.6242f, -3.8132f, 20.9194f}, 0, NULL},
+    {"RightFoot", 0, gfx_Catherine_RightFoot, 7, {0.1488f, -9.6243f, -3.8132f, 20.9194f}, 0, NULL},
+    {"LeftForearm", 0, gfx_Catherine_LeftForearm, 4, {10.6786f, 1.1275f, 0.1659f, 16.1093f}, 0, NULL},
+    {"LeftHand", 0, gfx_Catherine_LeftHand, 10, {10.7293f, 1.5001f, -0.1711f, 14.1479f}, 0, NULL},
+    {"RightForearm", 0, gfx_Catherine_RightForearm, 5, {-10.8004f, -0.1134f, -0.1631f, 16.1093f}, 0, NULL},
+    {"RightHand", 0, gfx_Catherine_RightHand, 12, {-10.8663f, 1.5009f, -0.1730f, 14.1479f}, 0, NULL},
+    {"LeftLeg", 0, gfx_Catherine_LeftLeg, 17, {-1.9774f, 0.0993f, -10.7898f, 24.6700f}, 0, NULL},
+    {"RightLeg", 0, gfx_Catherine_RightLeg, 17, {0.9905f, 0.0993f, -10.7898f, 24.6700f}, 0, NULL},
+    {"Pad", 0, gfx_Catherine_Pad, 3, {-13.6087f, 2.7481f, -4.9578f, 16.3977f}, 0, NULL},
+    {"Pelvis", 0, gfx_Catherine_Pelvis, -1, {0.0461f, 2.6705f, 17.2561f, 29.1175f}, 0, NULL},
+    {"Sword", 0, gfx_Catherine_Sword, -1, {12.4382f, -0.3056f, -19.9738f, 46.8265f}, 0, NULL},
 };
 
 static s64Animation anims_Catherine[] = {
-    {"Attack1", 8, anim_Catherine_Attack1_keyframes},
-    {"Idle", 3, anim_Catherine_Idle_keyframes},
-    {"Roll", 8, anim_Catherine_Roll_keyframes},
-    {"Run", 7, anim_Catherine_Run_keyframes},
-    {"Sneak", 7, anim_Catherine_Sneak_keyframes},
-    {"ThrowKnife", 5, anim_Catherine_ThrowKnife_keyframes},
-    {"Tired", 3, anim_Catherine_Tired_keyframes},
-    {"Walk", 7, anim_Catherine_Walk_keyframes},
+    {"Attack1", 8, anim_Catherine_Attack1_keyframes, {-3.0063f, -45.4462f, 110.4772f, 161.9039f}, anim_Catherine_Attack1_framelookup},
+    {"Idle", 3, anim_Catherine_Idle_keyframes, {-3.1090f, 20.4133f, 110.4785f, 126.8383f}, anim_Catherine_Idle_framelookup},
+    {"Roll", 8, anim_Catherine_Roll_keyframes, {-15.0111f, -15.4114f, 86.9449f, 182.1186f}, anim_Catherine_Roll_framelookup},
+    {"Run", 7, anim_Catherine_Run_keyframes, {-5.2655f, -8.3967f, 105.4653f, 134.1450f}, anim_Catherine_Run_framelookup},
+    {"Sneak", 7, anim_Catherine_Sneak_keyframes, {-2.4740f, 1.3710f, 112.8181f, 128.6005f}, anim_Catherine_Sneak_framelookup},
+    {"ThrowKnife", 5, anim_Catherine_ThrowKnife_keyframes, {-5.4541f, -3.5590f, 113.1309f, 133.3187f}, anim_Catherine_ThrowKnife_framelookup},
+    {"Tired", 3, anim_Catherine_Tired_keyframes, {-4.4316f, -26.6745f, 83.7825f, 100.3325f}, anim_Catherine_Tired_framelookup},
+    {"Walk", 7, anim_Catherine_Walk_keyframes, {-2.6612f, 13.7428f, 109.3685f, 129.2307f}, anim_Catherine_Walk_framelookup},
 };
 
 static s64ModelData mdl_Catherine = {19, 8, meshes_Catherine, anims_Catherine, NULL};
\ No newline at end of file
@@ -40,7 +40,7 @@ void matrix_inverse(float mat[4][4], float dest[4][4]);
 *********************************/
 
 // Matricies and vectors
-static Mtx projection, viewing, modeling;
+static Mtx projection, viewing, modeling, modelview;
 static u16 normal;
 // Lights
 static Light light_amb;
@@ -289,7 +289,7 @@ void stage00_update(void)
 void stage00_draw(void)
 {
     int i, ambcol = 100;
-    float fmat1[4][4], fmat2[4][4], w;
+    float fmat1[4][4], fmat2[4][4], fmodel[4][4], w;
     
     // Assign our glist pointer to our glist array for ease of access
     glistp = glist;
@@ -314,8 +314,14 @@ void stage00_draw(void)
     gSPMatrix(glistp++, &viewing, G_MTX_PROJECTION | G_MTX_MUL | G_MTX_NOPUSH);
     gSPPerspNormalize(glistp++, &normal);
     
-    // Setup the Sausage64 camera for billboarding
-    sausage64_set_camera(&viewing, &projection);
+    // Catherine stands at the origin, but any model matrix works as long as Sausage64 gets the view relative to it
+    guMtxIdentF(fmodel);
+    guMtxF2L(fmodel, &modeling);
+    
+    // Setup the Sausage64 camera for billboarding, LODs and culling, which work relative to the model's root
+    guMtxCatF(fmodel, fmat1, fmat2);
+    guMtxF2L(fmat2, &modelview);
+    sausage64_set_camera(&modelview, &projection);
     
     // Setup the lights
     if (!uselight)
@@ -343,7 +349,6 @@ void stage00_draw(void)
     gDPPipeSync(glistp++);
     
     // Initialize the model matrix
-    guMtxIdent(&modeling);
     gSPMatrix(glistp++, &modeling, G_MTX_MODELVIEW | G_MTX_LOAD | G_MTX_NOPUSH);
 
     // Initialize the RCP to draw stuff nicely